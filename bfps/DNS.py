@@ -145,8 +145,14 @@ class DNS(_code):
         self.parameters['niter_todo'] = int(8)
         self.parameters['niter_stat'] = int(1)
         self.parameters['niter_out'] = int(8)
+        # statistics are kept in memory and written to the stat file in
+        # blocks covering this many iterations, and at every checkpoint
+        self.parameters['niter_stat_flush'] = int(64)
         self.parameters['checkpoints_per_file'] = int(1)
         self.parameters['dt'] = float(0.01)
+        # if positive, dt is only an upper bound for the time step, which is
+        # chosen at every step to satisfy the CFL condition with this number
+        self.parameters['CFL_number'] = float(0.0)
         self.parameters['nu'] = float(0.1)
         self.parameters['fmode'] = int(1)
         self.parameters['famplitude'] = float(0.5)
@@ -156,6 +162,11 @@ class DNS(_code):
         self.parameters['histogram_bins'] = int(256)
         self.parameters['max_velocity_estimate'] = float(1)
         self.parameters['max_vorticity_estimate'] = float(1)
+        # 'RK3' or 'low_storage_RK3'
+        self.parameters['time_stepper'] = 'RK3'
+        self.parameters['truncated_checkpoints'] = int(0)
+        # skip the modes outside the dealiasing sphere in the transforms
+        self.parameters['truncated_transforms'] = int(0)
         # parameters specific to particle version
         self.NSVEp_extra_parameters = {}
         self.NSVEp_extra_parameters['niter_part'] = int(1)
@@ -163,6 +174,8 @@ class DNS(_code):
         self.NSVEp_extra_parameters['tracers0_integration_steps'] = int(4)
         self.NSVEp_extra_parameters['tracers0_neighbours'] = int(1)
         self.NSVEp_extra_parameters['tracers0_smoothness'] = int(1)
+        # sort tracers by cell once this fraction is out of order, 0 to never sort
+        self.NSVEp_extra_parameters['tracers0_sort_threshold'] = float(0)
         return None
     def get_kspace(self):
         kspace = {}
@@ -248,9 +261,12 @@ class DNS(_code):
                 pp_file['iter1'] = iter1
                 pp_file['ii0'] = ii0
                 pp_file['ii1'] = ii1
-                pp_file['t'] = (self.parameters['dt']*
-                                self.parameters['niter_stat']*
-                                (np.arange(ii0, ii1+1).astype(np.float)))
+                if 'time' in data_file['statistics'].keys():
+                    pp_file['t'] = data_file['statistics/time'][ii0:ii1+1]
+                else:
+                    pp_file['t'] = (self.parameters['dt']*
+                                    self.parameters['niter_stat']*
+                                    (np.arange(ii0, ii1+1).astype(np.float)))
                 pp_file['energy(t, k)'] = (
                     data_file['statistics/spectra/velocity_velocity'][ii0:ii1+1, :, 0, 0] +
                     data_file['statistics/spectra/velocity_velocity'][ii0:ii1+1, :, 1, 1] +
@@ -418,6 +434,20 @@ class DNS(_code):
                                                  self.parameters['histogram_bins'],
                                                  4),
                                      dtype = np.int64)
+            time_chunk = 2**20//(8*3*3*nshells)
+            time_chunk = max(time_chunk, 1)
+            ofile.create_dataset('statistics/spectra/velocity_vorticity',
+                                 (1, nshells, 3, 3),
+                                 chunks = (time_chunk, nshells, 3, 3),
+                                 maxshape = (None, nshells, 3, 3),
+                                 dtype = np.float64)
+            time_chunk = 2**20//8
+            ofile.create_dataset('statistics/time',
+                                 (1,),
+                                 chunks = (time_chunk,),
+                                 maxshape = (None,),
+                                 dtype = np.float64)
+            ofile['time'] = float(iter0*self.parameters['dt'])
             ofile['checkpoint'] = int(0)
         if self.dns_type in ['NSVE', 'NSVE_no_output']:
             return None
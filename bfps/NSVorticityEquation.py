@@ -326,6 +326,9 @@ class NSVorticityEquation(_fluid_particle_base):
                         H5P_DEFAULT,
                         &checkpoint);
                     H5Dclose(dset);
+                    // buffered statistics go to the file with each checkpoint
+                    hdf5_tools::flush_stats(stat_file);
+                    H5Fflush(stat_file, H5F_SCOPE_GLOBAL);
                 }
                 //endcpp
         """
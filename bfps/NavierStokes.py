@@ -379,7 +379,13 @@ class NavierStokes(_fluid_particle_base):
         else:
             self.fluid_loop = ''
         self.fluid_loop += ('if (fs->iteration % niter_out == 0)\n{\n' +
-                            self.fluid_output + '\n}\n')
+                            self.fluid_output +
+                            # buffered statistics go to the file with each output
+                            'if (myrank == 0)\n{\n' +
+                            'hdf5_tools::flush_stats(stat_file);\n' +
+                            'H5Fflush(stat_file, H5F_SCOPE_GLOBAL);\n' +
+                            '}\n' +
+                            '\n}\n')
         self.fluid_end = ('if (fs->iteration % niter_out != 0)\n{\n' +
                           self.fluid_output + '\n}\n' +
                           'delete fs;\n' +
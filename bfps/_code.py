@@ -57,6 +57,9 @@ class _code(_base):
                 #include "fluid_solver.hpp"
                 #include "scope_timer.hpp"
                 #include "fftw_interface.hpp"
+                #include "pencil_fft.hpp"
+                #include "truncated_fft.hpp"
+                #include "hdf5_tools.hpp"
                 #include <iostream>
                 #include <hdf5.h>
                 #include <string>
@@ -155,8 +158,15 @@ class _code(_base):
                         Cdset = H5Dopen(stat_file, "iteration", H5P_DEFAULT);
                         H5Dwrite(Cdset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &iteration);
                         H5Dclose(Cdset);
+                        hdf5_tools::close_cached_datasets(stat_file);
                         H5Fclose(stat_file);
                     }
+                    fftw_plan_registry<float>::clear();
+                    fftw_plan_registry<double>::clear();
+                    pencil_fft<float>::clear();
+                    pencil_fft<double>::clear();
+                    truncated_fft<float>::clear();
+                    truncated_fft<double>::clear();
                     fftwf_mpi_cleanup();
                     fftw_mpi_cleanup();
                 #ifndef NO_FFTWOMP
@@ -25,507 +25,1990 @@
 
 
 #include "Lagrange_polys.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_Lagrange_n1(int deriv, double x, double *poly_val) {
+template <>
+struct Lagrange_polynomials<1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.16666666666666666, 0.5, -0.5, 0.16666666666666666},
+        {0.25, -0.25, -0.25, 0.25},
+        {0.041666666666666664, -1.125, 1.125, -0.041666666666666664},
+        {-0.0625, 0.5625, 0.5625, -0.0625}};
+};
+constexpr double Lagrange_polynomials<1, 0>::coefficients[4][4];
+
+template <>
+struct Lagrange_polynomials<1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.5, 1.5, -1.5, 0.5},
+        {0.5, -0.5, -0.5, 0.5},
+        {0.041666666666666664, -1.125, 1.125, -0.041666666666666664}};
+};
+constexpr double Lagrange_polynomials<1, 1>::coefficients[3][4];
+
+template <>
+struct Lagrange_polynomials<1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.0, 3.0, -3.0, 1.0},
+        {0.5, -0.5, -0.5, 0.5}};
+};
+constexpr double Lagrange_polynomials<1, 2>::coefficients[2][4];
+
+template <class real_number>
+void beta_Lagrange_n1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(-1.0L/6.0L*x + 1.0L/2.0L) - 1.0L/3.0L);
-        poly_val[1] = x*(x*((1.0L/2.0L)*x - 1) - 1.0L/2.0L) + 1;
-        poly_val[2] = x*(x*(-1.0L/2.0L*x + 1.0L/2.0L) + 1);
-        poly_val[3] = x*((1.0L/6.0L)*pow(x, 2) - 1.0L/6.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(-1.0L/2.0L*x + 1) - 1.0L/3.0L;
-        poly_val[1] = x*((3.0L/2.0L)*x - 2) - 1.0L/2.0L;
-        poly_val[2] = x*(-3.0L/2.0L*x + 1) + 1;
-        poly_val[3] = (1.0L/2.0L)*pow(x, 2) - 1.0L/6.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = -x + 1;
-        poly_val[1] = 3*x - 2;
-        poly_val[2] = -3*x + 1;
-        poly_val[3] = x;
+        evaluate_beta_polynomials<Lagrange_polynomials<1, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n2(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.008333333333333333, 0.041666666666666664, -0.08333333333333333, 0.08333333333333333,
+         -0.041666666666666664, 0.008333333333333333},
+        {0.020833333333333332, -0.0625, 0.041666666666666664, 0.041666666666666664,
+         -0.0625, 0.020833333333333332},
+        {0.020833333333333332, -0.2708333333333333, 0.7083333333333334, -0.7083333333333334,
+         0.2708333333333333, -0.020833333333333332},
+        {-0.052083333333333336, 0.40625, -0.3541666666666667, -0.3541666666666667,
+         0.40625, -0.052083333333333336},
+        {-0.0046875, 0.06510416666666667, -1.171875, 1.171875,
+         -0.06510416666666667, 0.0046875},
+        {0.01171875, -0.09765625, 0.5859375, 0.5859375,
+         -0.09765625, 0.01171875}};
+};
+constexpr double Lagrange_polynomials<2, 0>::coefficients[6][6];
+
+template <>
+struct Lagrange_polynomials<2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.041666666666666664, 0.20833333333333334, -0.4166666666666667, 0.4166666666666667,
+         -0.20833333333333334, 0.041666666666666664},
+        {0.08333333333333333, -0.25, 0.16666666666666666, 0.16666666666666666,
+         -0.25, 0.08333333333333333},
+        {0.0625, -0.8125, 2.125, -2.125,
+         0.8125, -0.0625},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667},
+        {-0.0046875, 0.06510416666666667, -1.171875, 1.171875,
+         -0.06510416666666667, 0.0046875}};
+};
+constexpr double Lagrange_polynomials<2, 1>::coefficients[5][6];
+
+template <>
+struct Lagrange_polynomials<2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.16666666666666666, 0.8333333333333334, -1.6666666666666667, 1.6666666666666667,
+         -0.8333333333333334, 0.16666666666666666},
+        {0.25, -0.75, 0.5, 0.5,
+         -0.75, 0.25},
+        {0.125, -1.625, 4.25, -4.25,
+         1.625, -0.125},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667}};
+};
+constexpr double Lagrange_polynomials<2, 2>::coefficients[4][6];
+
+template <class real_number>
+void beta_Lagrange_n2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(-1.0L/120.0L*x + 1.0L/24.0L) - 1.0L/24.0L) - 1.0L/24.0L) + 1.0L/20.0L);
-        poly_val[1] = x*(x*(x*(x*((1.0L/24.0L)*x - 1.0L/6.0L) - 1.0L/24.0L) + 2.0L/3.0L) - 1.0L/2.0L);
-        poly_val[2] = x*(x*(x*(x*(-1.0L/12.0L*x + 1.0L/4.0L) + 5.0L/12.0L) - 5.0L/4.0L) - 1.0L/3.0L) + 1;
-        poly_val[3] = x*(x*(x*(x*((1.0L/12.0L)*x - 1.0L/6.0L) - 7.0L/12.0L) + 2.0L/3.0L) + 1);
-        poly_val[4] = x*(x*(x*(x*(-1.0L/24.0L*x + 1.0L/24.0L) + 7.0L/24.0L) - 1.0L/24.0L) - 1.0L/4.0L);
-        poly_val[5] = x*(pow(x, 2)*((1.0L/120.0L)*pow(x, 2) - 1.0L/24.0L) + 1.0L/30.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(-1.0L/24.0L*x + 1.0L/6.0L) - 1.0L/8.0L) - 1.0L/12.0L) + 1.0L/20.0L;
-        poly_val[1] = x*(x*(x*((5.0L/24.0L)*x - 2.0L/3.0L) - 1.0L/8.0L) + 4.0L/3.0L) - 1.0L/2.0L;
-        poly_val[2] = x*(x*(x*(-5.0L/12.0L*x + 1) + 5.0L/4.0L) - 5.0L/2.0L) - 1.0L/3.0L;
-        poly_val[3] = x*(x*(x*((5.0L/12.0L)*x - 2.0L/3.0L) - 7.0L/4.0L) + 4.0L/3.0L) + 1;
-        poly_val[4] = x*(x*(x*(-5.0L/24.0L*x + 1.0L/6.0L) + 7.0L/8.0L) - 1.0L/12.0L) - 1.0L/4.0L;
-        poly_val[5] = pow(x, 2)*((1.0L/24.0L)*pow(x, 2) - 1.0L/8.0L) + 1.0L/30.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(-1.0L/6.0L*x + 1.0L/2.0L) - 1.0L/4.0L) - 1.0L/12.0L;
-        poly_val[1] = x*(x*((5.0L/6.0L)*x - 2) - 1.0L/4.0L) + 4.0L/3.0L;
-        poly_val[2] = x*(x*(-5.0L/3.0L*x + 3) + 5.0L/2.0L) - 5.0L/2.0L;
-        poly_val[3] = x*(x*((5.0L/3.0L)*x - 2) - 7.0L/2.0L) + 4.0L/3.0L;
-        poly_val[4] = x*(x*(-5.0L/6.0L*x + 1.0L/2.0L) + 7.0L/4.0L) - 1.0L/12.0L;
-        poly_val[5] = x*((1.0L/6.0L)*pow(x, 2) - 1.0L/4.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<2, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n3(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0001984126984126984, 0.001388888888888889, -0.004166666666666667, 0.006944444444444444,
+         -0.006944444444444444, 0.004166666666666667, -0.001388888888888889, 0.0001984126984126984},
+        {0.0006944444444444445, -0.003472222222222222, 0.00625, -0.003472222222222222,
+         -0.003472222222222222, 0.00625, -0.003472222222222222, 0.0006944444444444445},
+        {0.001736111111111111, -0.02048611111111111, 0.078125, -0.1440972222222222,
+         0.1440972222222222, -0.078125, 0.02048611111111111, -0.001736111111111111},
+        {-0.006076388888888889, 0.051215277777777776, -0.1171875, 0.0720486111111111,
+         0.0720486111111111, -0.1171875, 0.051215277777777776, -0.006076388888888889},
+        {-0.0032118055555555554, 0.04331597222222222, -0.33828125, 0.8207465277777778,
+         -0.8207465277777778, 0.33828125, -0.04331597222222222, 0.0032118055555555554},
+        {0.011241319444444444, -0.10828993055555555, 0.507421875, -0.4103732638888889,
+         -0.4103732638888889, 0.507421875, -0.10828993055555555, 0.011241319444444444},
+        {0.0006975446428571429, -0.0095703125, 0.07975260416666667, -1.1962890625,
+         1.1962890625, -0.07975260416666667, 0.0095703125, -0.0006975446428571429},
+        {-0.00244140625, 0.02392578125, -0.11962890625, 0.59814453125,
+         0.59814453125, -0.11962890625, 0.02392578125, -0.00244140625}};
+};
+constexpr double Lagrange_polynomials<3, 0>::coefficients[8][8];
+
+template <>
+struct Lagrange_polynomials<3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.001388888888888889, 0.009722222222222222, -0.029166666666666667, 0.04861111111111111,
+         -0.04861111111111111, 0.029166666666666667, -0.009722222222222222, 0.001388888888888889},
+        {0.004166666666666667, -0.020833333333333332, 0.0375, -0.020833333333333332,
+         -0.020833333333333332, 0.0375, -0.020833333333333332, 0.004166666666666667},
+        {0.008680555555555556, -0.10243055555555555, 0.390625, -0.7204861111111112,
+         0.7204861111111112, -0.390625, 0.10243055555555555, -0.008680555555555556},
+        {-0.024305555555555556, 0.2048611111111111, -0.46875, 0.2881944444444444,
+         0.2881944444444444, -0.46875, 0.2048611111111111, -0.024305555555555556},
+        {-0.009635416666666667, 0.12994791666666666, -1.01484375, 2.4622395833333335,
+         -2.4622395833333335, 1.01484375, -0.12994791666666666, 0.009635416666666667},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889},
+        {0.0006975446428571429, -0.0095703125, 0.07975260416666667, -1.1962890625,
+         1.1962890625, -0.07975260416666667, 0.0095703125, -0.0006975446428571429}};
+};
+constexpr double Lagrange_polynomials<3, 1>::coefficients[7][8];
+
+template <>
+struct Lagrange_polynomials<3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.008333333333333333, 0.058333333333333334, -0.175, 0.2916666666666667,
+         -0.2916666666666667, 0.175, -0.058333333333333334, 0.008333333333333333},
+        {0.020833333333333332, -0.10416666666666667, 0.1875, -0.10416666666666667,
+         -0.10416666666666667, 0.1875, -0.10416666666666667, 0.020833333333333332},
+        {0.034722222222222224, -0.4097222222222222, 1.5625, -2.8819444444444446,
+         2.8819444444444446, -1.5625, 0.4097222222222222, -0.034722222222222224},
+        {-0.07291666666666667, 0.6145833333333334, -1.40625, 0.8645833333333334,
+         0.8645833333333334, -1.40625, 0.6145833333333334, -0.07291666666666667},
+        {-0.019270833333333334, 0.2598958333333333, -2.0296875, 4.924479166666667,
+         -4.924479166666667, 2.0296875, -0.2598958333333333, 0.019270833333333334},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889}};
+};
+constexpr double Lagrange_polynomials<3, 2>::coefficients[6][8];
+
+template <class real_number>
+void beta_Lagrange_n3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-1.0L/5040.0L*x + 1.0L/720.0L) - 1.0L/720.0L) - 1.0L/144.0L) + 1.0L/90.0L) + 1.0L/180.0L) - 1.0L/105.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*((1.0L/720.0L)*x - 1.0L/120.0L) - 1.0L/360.0L) + 1.0L/12.0L) - 71.0L/720.0L) - 3.0L/40.0L) + 1.0L/10.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-1.0L/240.0L*x + 1.0L/48.0L) + 3.0L/80.0L) - 13.0L/48.0L) + 1.0L/15.0L) + 3.0L/4.0L) - 3.0L/5.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*((1.0L/144.0L)*x - 1.0L/36.0L) - 7.0L/72.0L) + 7.0L/18.0L) + 49.0L/144.0L) - 49.0L/36.0L) - 1.0L/4.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-1.0L/144.0L*x + 1.0L/48.0L) + 17.0L/144.0L) - 13.0L/48.0L) - 11.0L/18.0L) + 3.0L/4.0L) + 1);
-        poly_val[5] = x*(x*(x*(x*(x*(x*((1.0L/240.0L)*x - 1.0L/120.0L) - 3.0L/40.0L) + 1.0L/12.0L) + 89.0L/240.0L) - 3.0L/40.0L) - 3.0L/10.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-1.0L/720.0L*x + 1.0L/720.0L) + 17.0L/720.0L) - 1.0L/144.0L) - 4.0L/45.0L) + 1.0L/180.0L) + 1.0L/15.0L);
-        poly_val[7] = x*(pow(x, 2)*(pow(x, 2)*((1.0L/5040.0L)*pow(x, 2) - 1.0L/360.0L) + 7.0L/720.0L) - 1.0L/140.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(-1.0L/720.0L*x + 1.0L/120.0L) - 1.0L/144.0L) - 1.0L/36.0L) + 1.0L/30.0L) + 1.0L/90.0L) - 1.0L/105.0L;
-        poly_val[1] = x*(x*(x*(x*(x*((7.0L/720.0L)*x - 1.0L/20.0L) - 1.0L/72.0L) + 1.0L/3.0L) - 71.0L/240.0L) - 3.0L/20.0L) + 1.0L/10.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(-7.0L/240.0L*x + 1.0L/8.0L) + 3.0L/16.0L) - 13.0L/12.0L) + 1.0L/5.0L) + 3.0L/2.0L) - 3.0L/5.0L;
-        poly_val[3] = x*(x*(x*(x*(x*((7.0L/144.0L)*x - 1.0L/6.0L) - 35.0L/72.0L) + 14.0L/9.0L) + 49.0L/48.0L) - 49.0L/18.0L) - 1.0L/4.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(-7.0L/144.0L*x + 1.0L/8.0L) + 85.0L/144.0L) - 13.0L/12.0L) - 11.0L/6.0L) + 3.0L/2.0L) + 1;
-        poly_val[5] = x*(x*(x*(x*(x*((7.0L/240.0L)*x - 1.0L/20.0L) - 3.0L/8.0L) + 1.0L/3.0L) + 89.0L/80.0L) - 3.0L/20.0L) - 3.0L/10.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(-7.0L/720.0L*x + 1.0L/120.0L) + 17.0L/144.0L) - 1.0L/36.0L) - 4.0L/15.0L) + 1.0L/90.0L) + 1.0L/15.0L;
-        poly_val[7] = pow(x, 2)*(pow(x, 2)*((1.0L/720.0L)*pow(x, 2) - 1.0L/72.0L) + 7.0L/240.0L) - 1.0L/140.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(-1.0L/120.0L*x + 1.0L/24.0L) - 1.0L/36.0L) - 1.0L/12.0L) + 1.0L/15.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(x*(x*((7.0L/120.0L)*x - 1.0L/4.0L) - 1.0L/18.0L) + 1) - 71.0L/120.0L) - 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(-7.0L/40.0L*x + 5.0L/8.0L) + 3.0L/4.0L) - 13.0L/4.0L) + 2.0L/5.0L) + 3.0L/2.0L;
-        poly_val[3] = x*(x*(x*(x*((7.0L/24.0L)*x - 5.0L/6.0L) - 35.0L/18.0L) + 14.0L/3.0L) + 49.0L/24.0L) - 49.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(-7.0L/24.0L*x + 5.0L/8.0L) + 85.0L/36.0L) - 13.0L/4.0L) - 11.0L/3.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(x*(x*((7.0L/40.0L)*x - 1.0L/4.0L) - 3.0L/2.0L) + 1) + 89.0L/40.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(-7.0L/120.0L*x + 1.0L/24.0L) + 17.0L/36.0L) - 1.0L/12.0L) - 8.0L/15.0L) + 1.0L/90.0L;
-        poly_val[7] = x*(pow(x, 2)*((1.0L/120.0L)*pow(x, 2) - 1.0L/18.0L) + 7.0L/120.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<3, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n4(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.7557319223985893e-06, 2.48015873015873e-05, -9.92063492063492e-05, 0.0002314814814814815,
+         -0.00034722222222222224, 0.00034722222222222224, -0.0002314814814814815, 9.92063492063492e-05,
+         -2.48015873015873e-05, 2.7557319223985893e-06},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {5.787037037037037e-05, -0.0007192460317460318, 0.003472222222222222, -0.009027777777777777,
+         0.01423611111111111, -0.01423611111111111, 0.009027777777777777, -0.003472222222222222,
+         0.0007192460317460318, -5.787037037037037e-05},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.00033998842592592593, 0.004796006944444445, -0.032725694444444446, 0.10668402777777777,
+         -0.18693576388888888, 0.18693576388888888, -0.10668402777777777, 0.032725694444444446,
+         -0.004796006944444445, 0.00033998842592592593},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.0005561411485890652, -0.008217075892857143, 0.06333705357142858, -0.3849971064814815,
+         0.8908203125, -0.8908203125, 0.3849971064814815, -0.06333705357142858,
+         0.008217075892857143, -0.0005561411485890652},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.00011867947048611111, 0.0017656598772321428, -0.0138427734375, 0.0897216796875,
+         -1.21124267578125, 1.21124267578125, -0.0897216796875, 0.0138427734375,
+         -0.0017656598772321428, 0.00011867947048611111},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double Lagrange_polynomials<4, 0>::coefficients[10][10];
+
+template <>
+struct Lagrange_polynomials<4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.48015873015873e-05, 0.0002232142857142857, -0.0008928571428571428, 0.0020833333333333333,
+         -0.003125, 0.003125, -0.0020833333333333333, 0.0008928571428571428,
+         -0.0002232142857142857, 2.48015873015873e-05},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {0.0004050925925925926, -0.0050347222222222225, 0.024305555555555556, -0.06319444444444444,
+         0.09965277777777778, -0.09965277777777778, 0.06319444444444444, -0.024305555555555556,
+         0.0050347222222222225, -0.0004050925925925926},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-0.0016999421296296296, 0.023980034722222224, -0.1636284722222222, 0.5334201388888888,
+         -0.9346788194444444, 0.9346788194444444, -0.5334201388888888, 0.1636284722222222,
+         -0.023980034722222224, 0.0016999421296296296},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.0016684234457671958, -0.02465122767857143, 0.19001116071428573, -1.1549913194444446,
+         2.6724609375, -2.6724609375, 1.1549913194444446, -0.19001116071428573,
+         0.02465122767857143, -0.0016684234457671958},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.00011867947048611111, 0.0017656598772321428, -0.0138427734375, 0.0897216796875,
+         -1.21124267578125, 1.21124267578125, -0.0897216796875, 0.0138427734375,
+         -0.0017656598772321428, 0.00011867947048611111}};
+};
+constexpr double Lagrange_polynomials<4, 1>::coefficients[9][10];
+
+template <>
+struct Lagrange_polynomials<4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0001984126984126984, 0.0017857142857142857, -0.007142857142857143, 0.016666666666666666,
+         -0.025, 0.025, -0.016666666666666666, 0.007142857142857143,
+         -0.0017857142857142857, 0.0001984126984126984},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {0.0024305555555555556, -0.030208333333333334, 0.14583333333333334, -0.37916666666666665,
+         0.5979166666666667, -0.5979166666666667, 0.37916666666666665, -0.14583333333333334,
+         0.030208333333333334, -0.0024305555555555556},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-0.006799768518518518, 0.0959201388888889, -0.6545138888888888, 2.1336805555555554,
+         -3.7387152777777777, 3.7387152777777777, -2.1336805555555554, 0.6545138888888888,
+         -0.0959201388888889, 0.006799768518518518},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.0033368468915343915, -0.04930245535714286, 0.38002232142857145, -2.309982638888889,
+         5.344921875, -5.344921875, 2.309982638888889, -0.38002232142857145,
+         0.04930245535714286, -0.0033368468915343915},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double Lagrange_polynomials<4, 2>::coefficients[8][10];
+
+template <class real_number>
+void beta_Lagrange_n4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/362880.0L*x + 1.0L/40320.0L) - 1.0L/60480.0L) - 1.0L/2880.0L) + 11.0L/17280.0L) + 7.0L/5760.0L) - 59.0L/22680.0L) - 1.0L/1120.0L) + 1.0L/504.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((1.0L/40320.0L)*x - 1.0L/5040.0L) - 1.0L/6720.0L) + 1.0L/240.0L) - 11.0L/1920.0L) - 1.0L/60.0L) + 299.0L/10080.0L) + 4.0L/315.0L) - 1.0L/42.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/10080.0L*x + 1.0L/1440.0L) + 1.0L/630.0L) - 13.0L/720.0L) + 13.0L/1440.0L) + 169.0L/1440.0L) - 773.0L/5040.0L) - 1.0L/10.0L) + 1.0L/7.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((1.0L/4320.0L)*x - 1.0L/720.0L) - 1.0L/180.0L) + 29.0L/720.0L) + 11.0L/480.0L) - 61.0L/180.0L) + 161.0L/1080.0L) + 4.0L/5.0L) - 2.0L/3.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2880.0L*x + 1.0L/576.0L) + 1.0L/96.0L) - 5.0L/96.0L) - 91.0L/960.0L) + 91.0L/192.0L) + 41.0L/144.0L) - 205.0L/144.0L) - 1.0L/5.0L) + 1;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2880.0L)*x - 1.0L/720.0L) - 17.0L/1440.0L) + 29.0L/720.0L) + 389.0L/2880.0L) - 61.0L/180.0L) - 449.0L/720.0L) + 4.0L/5.0L) + 1);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/4320.0L*x + 1.0L/1440.0L) + 1.0L/120.0L) - 13.0L/720.0L) - 143.0L/1440.0L) + 169.0L/1440.0L) + 917.0L/2160.0L) - 1.0L/10.0L) - 1.0L/3.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((1.0L/10080.0L)*x - 1.0L/5040.0L) - 1.0L/280.0L) + 1.0L/240.0L) + 19.0L/480.0L) - 1.0L/60.0L) - 331.0L/2520.0L) + 4.0L/315.0L) + 2.0L/21.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/40320.0L*x + 1.0L/40320.0L) + 17.0L/20160.0L) - 1.0L/2880.0L) - 47.0L/5760.0L) + 7.0L/5760.0L) + 127.0L/5040.0L) - 1.0L/1120.0L) - 1.0L/56.0L);
-        poly_val[9] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/362880.0L)*pow(x, 2) - 1.0L/12096.0L) + 13.0L/17280.0L) - 41.0L/18144.0L) + 1.0L/630.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-1.0L/40320.0L*x + 1.0L/5040.0L) - 1.0L/8640.0L) - 1.0L/480.0L) + 11.0L/3456.0L) + 7.0L/1440.0L) - 59.0L/7560.0L) - 1.0L/560.0L) + 1.0L/504.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*((1.0L/4480.0L)*x - 1.0L/630.0L) - 1.0L/960.0L) + 1.0L/40.0L) - 11.0L/384.0L) - 1.0L/15.0L) + 299.0L/3360.0L) + 8.0L/315.0L) - 1.0L/42.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(-1.0L/1120.0L*x + 1.0L/180.0L) + 1.0L/90.0L) - 13.0L/120.0L) + 13.0L/288.0L) + 169.0L/360.0L) - 773.0L/1680.0L) - 1.0L/5.0L) + 1.0L/7.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*((1.0L/480.0L)*x - 1.0L/90.0L) - 7.0L/180.0L) + 29.0L/120.0L) + 11.0L/96.0L) - 61.0L/45.0L) + 161.0L/360.0L) + 8.0L/5.0L) - 2.0L/3.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(-1.0L/320.0L*x + 1.0L/72.0L) + 7.0L/96.0L) - 5.0L/16.0L) - 91.0L/192.0L) + 91.0L/48.0L) + 41.0L/48.0L) - 205.0L/72.0L) - 1.0L/5.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*((1.0L/320.0L)*x - 1.0L/90.0L) - 119.0L/1440.0L) + 29.0L/120.0L) + 389.0L/576.0L) - 61.0L/45.0L) - 449.0L/240.0L) + 8.0L/5.0L) + 1;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(-1.0L/480.0L*x + 1.0L/180.0L) + 7.0L/120.0L) - 13.0L/120.0L) - 143.0L/288.0L) + 169.0L/360.0L) + 917.0L/720.0L) - 1.0L/5.0L) - 1.0L/3.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*((1.0L/1120.0L)*x - 1.0L/630.0L) - 1.0L/40.0L) + 1.0L/40.0L) + 19.0L/96.0L) - 1.0L/15.0L) - 331.0L/840.0L) + 8.0L/315.0L) + 2.0L/21.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(-1.0L/4480.0L*x + 1.0L/5040.0L) + 17.0L/2880.0L) - 1.0L/480.0L) - 47.0L/1152.0L) + 7.0L/1440.0L) + 127.0L/1680.0L) - 1.0L/560.0L) - 1.0L/56.0L;
-        poly_val[9] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/40320.0L)*pow(x, 2) - 1.0L/1728.0L) + 13.0L/3456.0L) - 41.0L/6048.0L) + 1.0L/630.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-1.0L/5040.0L*x + 1.0L/720.0L) - 1.0L/1440.0L) - 1.0L/96.0L) + 11.0L/864.0L) + 7.0L/480.0L) - 59.0L/3780.0L) - 1.0L/560.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*((1.0L/560.0L)*x - 1.0L/90.0L) - 1.0L/160.0L) + 1.0L/8.0L) - 11.0L/96.0L) - 1.0L/5.0L) + 299.0L/1680.0L) + 8.0L/315.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-1.0L/140.0L*x + 7.0L/180.0L) + 1.0L/15.0L) - 13.0L/24.0L) + 13.0L/72.0L) + 169.0L/120.0L) - 773.0L/840.0L) - 1.0L/5.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*((1.0L/60.0L)*x - 7.0L/90.0L) - 7.0L/30.0L) + 29.0L/24.0L) + 11.0L/24.0L) - 61.0L/15.0L) + 161.0L/180.0L) + 8.0L/5.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-1.0L/40.0L*x + 7.0L/72.0L) + 7.0L/16.0L) - 25.0L/16.0L) - 91.0L/48.0L) + 91.0L/16.0L) + 41.0L/24.0L) - 205.0L/72.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*((1.0L/40.0L)*x - 7.0L/90.0L) - 119.0L/240.0L) + 29.0L/24.0L) + 389.0L/144.0L) - 61.0L/15.0L) - 449.0L/120.0L) + 8.0L/5.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-1.0L/60.0L*x + 7.0L/180.0L) + 7.0L/20.0L) - 13.0L/24.0L) - 143.0L/72.0L) + 169.0L/120.0L) + 917.0L/360.0L) - 1.0L/5.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*((1.0L/140.0L)*x - 1.0L/90.0L) - 3.0L/20.0L) + 1.0L/8.0L) + 19.0L/24.0L) - 1.0L/5.0L) - 331.0L/420.0L) + 8.0L/315.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(-1.0L/560.0L*x + 1.0L/720.0L) + 17.0L/480.0L) - 1.0L/96.0L) - 47.0L/288.0L) + 7.0L/480.0L) + 127.0L/840.0L) - 1.0L/560.0L;
-        poly_val[9] = x*(pow(x, 2)*(pow(x, 2)*((1.0L/5040.0L)*pow(x, 2) - 1.0L/288.0L) + 13.0L/864.0L) - 41.0L/3024.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<4, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n5(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<5, 0>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.505210838544172e-08, 2.755731922398589e-07, -1.3778659611992946e-06, 4.133597883597884e-06,
+         -8.267195767195768e-06, 1.1574074074074073e-05, -1.1574074074074073e-05, 8.267195767195768e-06,
+         -4.133597883597884e-06, 1.3778659611992946e-06, -2.755731922398589e-07, 2.505210838544172e-08},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {1.033399470899471e-06, -1.4123126102292769e-05, 8.16385582010582e-05, -0.0002697172619047619,
+         0.0005725033068783069, -0.0008246527777777778, 0.0008246527777777778, -0.0005725033068783069,
+         0.0002697172619047619, -8.16385582010582e-05, 1.4123126102292769e-05, -1.033399470899471e-06},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-1.3744212962962963e-05, 0.00020905671296296297, -0.0014751777447089948, 0.0057400173611111115,
+         -0.013563368055555556, 0.0205859375, -0.0205859375, 0.013563368055555556,
+         -0.0057400173611111115, 0.0014751777447089948, -0.00020905671296296297, 1.3744212962962963e-05},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {6.764460703262786e-05, -0.0010840791032848325, 0.008516460331238977, -0.043887054604828044,
+         0.12900674809854498, -0.21818757233796296, 0.21818757233796296, -0.12900674809854498,
+         0.043887054604828044, -0.008516460331238977, 0.0010840791032848325, -6.764460703262786e-05},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.00010345943390376985, 0.0016941949215305335, -0.013907344757564484, 0.0804078601655506,
+         -0.41913871966972555, 0.9386185709635416, -0.9386185709635416, 0.41913871966972555,
+         -0.0804078601655506, 0.013907344757564484, -0.0016941949215305335, 0.00010345943390376985},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {2.184781161221591e-05, -0.0003590053982204861, 0.002967289515904018, -0.017447662353515626,
+         0.09693145751953125, -1.2213363647460938, 1.2213363647460938, -0.09693145751953125,
+         0.017447662353515626, -0.002967289515904018, 0.0003590053982204861, -2.184781161221591e-05},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double Lagrange_polynomials<5, 0>::coefficients[12][12];
+
+template <>
+struct Lagrange_polynomials<5, 1>
+{
+    static constexpr int degree = 10;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.755731922398589e-07, 3.031305114638448e-06, -1.515652557319224e-05, 4.546957671957672e-05,
+         -9.093915343915344e-05, 0.0001273148148148148, -0.0001273148148148148, 9.093915343915344e-05,
+         -4.546957671957672e-05, 1.515652557319224e-05, -3.031305114638448e-06, 2.755731922398589e-07},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {9.300595238095239e-06, -0.00012710813492063493, 0.0007347470238095238, -0.002427455357142857,
+         0.005152529761904762, -0.007421875, 0.007421875, -0.005152529761904762,
+         0.002427455357142857, -0.0007347470238095238, 0.00012710813492063493, -9.300595238095239e-06},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-9.620949074074074e-05, 0.0014633969907407408, -0.010326244212962963, 0.04018012152777778,
+         -0.0949435763888889, 0.1441015625, -0.1441015625, 0.0949435763888889,
+         -0.04018012152777778, 0.010326244212962963, -0.0014633969907407408, 9.620949074074074e-05},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.00033822303516313934, -0.005420395516424162, 0.042582301656194886, -0.2194352730241402,
+         0.6450337404927249, -1.0909378616898149, 1.0909378616898149, -0.6450337404927249,
+         0.2194352730241402, -0.042582301656194886, 0.005420395516424162, -0.00033822303516313934},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.0003103783017113095, 0.0050825847645916, -0.04172203427269345, 0.2412235804966518,
+         -1.2574161590091766, 2.815855712890625, -2.815855712890625, 1.2574161590091766,
+         -0.2412235804966518, 0.04172203427269345, -0.0050825847645916, 0.0003103783017113095},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {2.184781161221591e-05, -0.0003590053982204861, 0.002967289515904018, -0.017447662353515626,
+         0.09693145751953125, -1.2213363647460938, 1.2213363647460938, -0.09693145751953125,
+         0.017447662353515626, -0.002967289515904018, 0.0003590053982204861, -2.184781161221591e-05}};
+};
+constexpr double Lagrange_polynomials<5, 1>::coefficients[11][12];
+
+template <>
+struct Lagrange_polynomials<5, 2>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.7557319223985893e-06, 3.031305114638448e-05, -0.0001515652557319224, 0.00045469576719576717,
+         -0.0009093915343915343, 0.0012731481481481483, -0.0012731481481481483, 0.0009093915343915343,
+         -0.00045469576719576717, 0.0001515652557319224, -3.031305114638448e-05, 2.7557319223985893e-06},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {7.440476190476191e-05, -0.0010168650793650794, 0.00587797619047619, -0.019419642857142858,
+         0.041220238095238095, -0.059375, 0.059375, -0.041220238095238095,
+         0.019419642857142858, -0.00587797619047619, 0.0010168650793650794, -7.440476190476191e-05},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-0.0005772569444444445, 0.008780381944444445, -0.061957465277777776, 0.24108072916666667,
+         -0.5696614583333334, 0.864609375, -0.864609375, 0.5696614583333334,
+         -0.24108072916666667, 0.061957465277777776, -0.008780381944444445, 0.0005772569444444445},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {0.0013528921406525574, -0.021681582065696647, 0.17032920662477954, -0.8777410920965608,
+         2.5801349619708995, -4.3637514467592595, 4.3637514467592595, -2.5801349619708995,
+         0.8777410920965608, -0.17032920662477954, 0.021681582065696647, -0.0013528921406525574},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.000620756603422619, 0.0101651695291832, -0.0834440685453869, 0.4824471609933036,
+         -2.514832318018353, 5.63171142578125, -5.63171142578125, 2.514832318018353,
+         -0.4824471609933036, 0.0834440685453869, -0.0101651695291832, 0.000620756603422619},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double Lagrange_polynomials<5, 2>::coefficients[10][12];
+
+template <class real_number>
+void beta_Lagrange_n5(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(pow(x, 2)*(-1.0L/39916800.0L*x + 1.0L/3628800.0L) - 1.0L/120960.0L) + 19.0L/1209600.0L) + 13.0L/172800.0L) - 67.0L/362880.0L) - 41.0L/181440.0L) + 13.0L/21600.0L) + 1.0L/6300.0L) - 1.0L/2310.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/3628800.0L)*x - 1.0L/362880.0L) - 1.0L/241920.0L) + 13.0L/120960.0L) - 179.0L/1209600.0L) - 19.0L/17280.0L) + 1663.0L/725760.0L) + 1261.0L/362880.0L) - 2447.0L/302400.0L) - 5.0L/2016.0L) + 1.0L/168.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/725760.0L*x + 1.0L/80640.0L) + 1.0L/25920.0L) - 23.0L/40320.0L) + 73.0L/241920.0L) + 29.0L/3840.0L) - 4399.0L/362880.0L) - 541.0L/20160.0L) + 667.0L/12960.0L) + 5.0L/252.0L) - 5.0L/126.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/241920.0L)*x - 1.0L/30240.0L) - 13.0L/80640.0L) + 17.0L/10080.0L) + 23.0L/26880.0L) - 13.0L/480.0L) + 5459.0L/241920.0L) + 4369.0L/30240.0L) - 4069.0L/20160.0L) - 5.0L/42.0L) + 5.0L/28.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/120960.0L*x + 1.0L/17280.0L) + 1.0L/2520.0L) - 1.0L/320.0L) - 43.0L/8064.0L) + 323.0L/5760.0L) + 431.0L/60480.0L) - 1669.0L/4320.0L) + 1069.0L/5040.0L) + 5.0L/6.0L) - 5.0L/7.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/86400.0L)*x - 1.0L/14400.0L) - 11.0L/17280.0L) + 11.0L/2880.0L) + 341.0L/28800.0L) - 341.0L/4800.0L) - 1529.0L/17280.0L) + 1529.0L/2880.0L) + 5269.0L/21600.0L) - 5269.0L/3600.0L) - 1.0L/6.0L) + 1;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/86400.0L*x + 1.0L/17280.0L) + 1.0L/1440.0L) - 1.0L/320.0L) - 431.0L/28800.0L) + 323.0L/5760.0L) + 1249.0L/8640.0L) - 1669.0L/4320.0L) - 2269.0L/3600.0L) + 5.0L/6.0L) + 1);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/120960.0L)*x - 1.0L/30240.0L) - 1.0L/1920.0L) + 17.0L/10080.0L) + 53.0L/4480.0L) - 13.0L/480.0L) - 14197.0L/120960.0L) + 4369.0L/30240.0L) + 667.0L/1440.0L) - 5.0L/42.0L) - 5.0L/14.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/241920.0L*x + 1.0L/80640.0L) + 1.0L/3780.0L) - 23.0L/40320.0L) - 479.0L/80640.0L) + 29.0L/3840.0L) + 6563.0L/120960.0L) - 541.0L/20160.0L) - 5069.0L/30240.0L) + 5.0L/252.0L) + 5.0L/42.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/725760.0L)*x - 1.0L/362880.0L) - 1.0L/11520.0L) + 13.0L/120960.0L) + 89.0L/48384.0L) - 19.0L/17280.0L) - 10837.0L/725760.0L) + 1261.0L/362880.0L) + 371.0L/8640.0L) - 5.0L/2016.0L) - 5.0L/168.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/3628800.0L*x + 1.0L/3628800.0L) + 1.0L/60480.0L) - 1.0L/120960.0L) - 391.0L/1209600.0L) + 13.0L/172800.0L) + 901.0L/362880.0L) - 41.0L/181440.0L) - 1049.0L/151200.0L) + 1.0L/6300.0L) + 1.0L/210.0L);
-        poly_val[11] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/39916800.0L)*pow(x, 2) - 1.0L/725760.0L) + 31.0L/1209600.0L) - 139.0L/725760.0L) + 479.0L/907200.0L) - 1.0L/2772.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<5, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(pow(x, 2)*(-1.0L/3628800.0L*x + 1.0L/362880.0L) - 1.0L/15120.0L) + 19.0L/172800.0L) + 13.0L/28800.0L) - 67.0L/72576.0L) - 41.0L/45360.0L) + 13.0L/7200.0L) + 1.0L/3150.0L) - 1.0L/2310.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*((11.0L/3628800.0L)*x - 1.0L/36288.0L) - 1.0L/26880.0L) + 13.0L/15120.0L) - 179.0L/172800.0L) - 19.0L/2880.0L) + 1663.0L/145152.0L) + 1261.0L/90720.0L) - 2447.0L/100800.0L) - 5.0L/1008.0L) + 1.0L/168.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/725760.0L*x + 1.0L/8064.0L) + 1.0L/2880.0L) - 23.0L/5040.0L) + 73.0L/34560.0L) + 29.0L/640.0L) - 4399.0L/72576.0L) - 541.0L/5040.0L) + 667.0L/4320.0L) + 5.0L/126.0L) - 5.0L/126.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*((11.0L/241920.0L)*x - 1.0L/3024.0L) - 13.0L/8960.0L) + 17.0L/1260.0L) + 23.0L/3840.0L) - 13.0L/80.0L) + 5459.0L/48384.0L) + 4369.0L/7560.0L) - 4069.0L/6720.0L) - 5.0L/21.0L) + 5.0L/28.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/120960.0L*x + 1.0L/1728.0L) + 1.0L/280.0L) - 1.0L/40.0L) - 43.0L/1152.0L) + 323.0L/960.0L) + 431.0L/12096.0L) - 1669.0L/1080.0L) + 1069.0L/1680.0L) + 5.0L/3.0L) - 5.0L/7.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*((11.0L/86400.0L)*x - 1.0L/1440.0L) - 11.0L/1920.0L) + 11.0L/360.0L) + 2387.0L/28800.0L) - 341.0L/800.0L) - 1529.0L/3456.0L) + 1529.0L/720.0L) + 5269.0L/7200.0L) - 5269.0L/1800.0L) - 1.0L/6.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/86400.0L*x + 1.0L/1728.0L) + 1.0L/160.0L) - 1.0L/40.0L) - 3017.0L/28800.0L) + 323.0L/960.0L) + 1249.0L/1728.0L) - 1669.0L/1080.0L) - 2269.0L/1200.0L) + 5.0L/3.0L) + 1;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*((11.0L/120960.0L)*x - 1.0L/3024.0L) - 3.0L/640.0L) + 17.0L/1260.0L) + 53.0L/640.0L) - 13.0L/80.0L) - 14197.0L/24192.0L) + 4369.0L/7560.0L) + 667.0L/480.0L) - 5.0L/21.0L) - 5.0L/14.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/241920.0L*x + 1.0L/8064.0L) + 1.0L/420.0L) - 23.0L/5040.0L) - 479.0L/11520.0L) + 29.0L/640.0L) + 6563.0L/24192.0L) - 541.0L/5040.0L) - 5069.0L/10080.0L) + 5.0L/126.0L) + 5.0L/42.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*((11.0L/725760.0L)*x - 1.0L/36288.0L) - 1.0L/1280.0L) + 13.0L/15120.0L) + 89.0L/6912.0L) - 19.0L/2880.0L) - 10837.0L/145152.0L) + 1261.0L/90720.0L) + 371.0L/2880.0L) - 5.0L/1008.0L) - 5.0L/168.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/3628800.0L*x + 1.0L/362880.0L) + 1.0L/6720.0L) - 1.0L/15120.0L) - 391.0L/172800.0L) + 13.0L/28800.0L) + 901.0L/72576.0L) - 41.0L/45360.0L) - 1049.0L/50400.0L) + 1.0L/3150.0L) + 1.0L/210.0L;
-        poly_val[11] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/3628800.0L)*pow(x, 2) - 1.0L/80640.0L) + 31.0L/172800.0L) - 139.0L/145152.0L) + 479.0L/302400.0L) - 1.0L/2772.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<5, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(pow(x, 2)*(-1.0L/362880.0L*x + 1.0L/40320.0L) - 1.0L/2160.0L) + 19.0L/28800.0L) + 13.0L/5760.0L) - 67.0L/18144.0L) - 41.0L/15120.0L) + 13.0L/3600.0L) + 1.0L/3150.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((11.0L/362880.0L)*x - 1.0L/4032.0L) - 1.0L/3360.0L) + 13.0L/2160.0L) - 179.0L/28800.0L) - 19.0L/576.0L) + 1663.0L/36288.0L) + 1261.0L/30240.0L) - 2447.0L/50400.0L) - 5.0L/1008.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/72576.0L*x + 1.0L/896.0L) + 1.0L/360.0L) - 23.0L/720.0L) + 73.0L/5760.0L) + 29.0L/128.0L) - 4399.0L/18144.0L) - 541.0L/1680.0L) + 667.0L/2160.0L) + 5.0L/126.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((11.0L/24192.0L)*x - 1.0L/336.0L) - 13.0L/1120.0L) + 17.0L/180.0L) + 23.0L/640.0L) - 13.0L/16.0L) + 5459.0L/12096.0L) + 4369.0L/2520.0L) - 4069.0L/3360.0L) - 5.0L/21.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/12096.0L*x + 1.0L/192.0L) + 1.0L/35.0L) - 7.0L/40.0L) - 43.0L/192.0L) + 323.0L/192.0L) + 431.0L/3024.0L) - 1669.0L/360.0L) + 1069.0L/840.0L) + 5.0L/3.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((11.0L/8640.0L)*x - 1.0L/160.0L) - 11.0L/240.0L) + 77.0L/360.0L) + 2387.0L/4800.0L) - 341.0L/160.0L) - 1529.0L/864.0L) + 1529.0L/240.0L) + 5269.0L/3600.0L) - 5269.0L/1800.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/8640.0L*x + 1.0L/192.0L) + 1.0L/20.0L) - 7.0L/40.0L) - 3017.0L/4800.0L) + 323.0L/192.0L) + 1249.0L/432.0L) - 1669.0L/360.0L) - 2269.0L/600.0L) + 5.0L/3.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((11.0L/12096.0L)*x - 1.0L/336.0L) - 3.0L/80.0L) + 17.0L/180.0L) + 159.0L/320.0L) - 13.0L/16.0L) - 14197.0L/6048.0L) + 4369.0L/2520.0L) + 667.0L/240.0L) - 5.0L/21.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/24192.0L*x + 1.0L/896.0L) + 2.0L/105.0L) - 23.0L/720.0L) - 479.0L/1920.0L) + 29.0L/128.0L) + 6563.0L/6048.0L) - 541.0L/1680.0L) - 5069.0L/5040.0L) + 5.0L/126.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*((11.0L/72576.0L)*x - 1.0L/4032.0L) - 1.0L/160.0L) + 13.0L/2160.0L) + 89.0L/1152.0L) - 19.0L/576.0L) - 10837.0L/36288.0L) + 1261.0L/30240.0L) + 371.0L/1440.0L) - 5.0L/1008.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(-11.0L/362880.0L*x + 1.0L/40320.0L) + 1.0L/840.0L) - 1.0L/2160.0L) - 391.0L/28800.0L) + 13.0L/5760.0L) + 901.0L/18144.0L) - 41.0L/15120.0L) - 1049.0L/25200.0L) + 1.0L/3150.0L;
-        poly_val[11] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/362880.0L)*pow(x, 2) - 1.0L/10080.0L) + 31.0L/28800.0L) - 139.0L/36288.0L) + 479.0L/151200.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<5, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n6(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n5<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n5<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<6, 0>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.6059043836821613e-10, 2.08767569878681e-09, -1.252605419272086e-08, 4.592886537330982e-08,
+         -1.1482216343327455e-07, 2.066798941798942e-07, -2.755731922398589e-07, 2.755731922398589e-07,
+         -2.066798941798942e-07, 1.1482216343327455e-07, -4.592886537330982e-08, 1.252605419272086e-08,
+         -2.08767569878681e-09, 1.6059043836821613e-10},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {1.1482216343327455e-08, -1.7432092084869863e-07, 1.1711860670194003e-06, -4.661779835390946e-06,
+         1.2343382569077014e-05, -2.30448082010582e-05, 3.1277557319223986e-05, -3.1277557319223986e-05,
+         2.30448082010582e-05, -1.2343382569077014e-05, 4.661779835390946e-06, -1.1711860670194003e-06,
+         1.7432092084869863e-07, -1.1482216343327455e-08},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-2.884906856261023e-07, 4.783778384038801e-06, -3.6625399581128747e-05, 0.00016414689429012345,
+         -0.00047598810212742506, 0.0009437908192791005, -0.0013197027943121693, 0.0013197027943121693,
+         -0.0009437908192791005, 0.00047598810212742506, -0.00016414689429012345, 3.6625399581128747e-05,
+         -4.783778384038801e-06, 2.884906856261023e-07},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {3.098763135655497e-06, -5.402813372648442e-05, 0.0004507602375440917, -0.002361424001506467,
+         0.007955633003104791, -0.01755147621114418, 0.025903415040784833, -0.025903415040784833,
+         0.01755147621114418, -0.007955633003104791, 0.002361424001506467, -0.0004507602375440917,
+         5.402813372648442e-05, -3.098763135655497e-06},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-1.3780184593851044e-05, 0.00024678700675269144, -0.002158933501605214, 0.012457593125080376,
+         -0.05373988658943154, 0.14674184567083126, -0.24183436910101136, 0.24183436910101136,
+         -0.14674184567083126, 0.05373988658943154, -0.012457593125080376, 0.002158933501605214,
+         -0.00024678700675269144, 1.3780184593851044e-05},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {2.0201895430777267e-05, -0.0003660840745038743, 0.0032699427651311603, -0.01968508685076678,
+         0.09485221539855634, -0.44513855908913585, 0.9732850235227555, -0.9732850235227555,
+         0.44513855908913585, -0.09485221539855634, 0.01968508685076678, -0.0032699427651311603,
+         0.0003660840745038743, -2.0201895430777267e-05},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-4.236514751727765e-06, 7.692250338467684e-05, -0.0006894535488552517, 0.004178932734898159,
+         -0.020476770401000977, 0.10238385200500488, -1.2286062240600586, 1.2286062240600586,
+         -0.10238385200500488, 0.020476770401000977, -0.004178932734898159, 0.0006894535488552517,
+         -7.692250338467684e-05, 4.236514751727765e-06},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double Lagrange_polynomials<6, 0>::coefficients[14][14];
+
+template <>
+struct Lagrange_polynomials<6, 1>
+{
+    static constexpr int degree = 12;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.08767569878681e-09, 2.713978408422853e-08, -1.6283870450537117e-07, 5.970752498530276e-07,
+         -1.4926881246325691e-06, 2.6868386243386245e-06, -3.5824514991181657e-06, 3.5824514991181657e-06,
+         -2.6868386243386245e-06, 1.4926881246325691e-06, -5.970752498530276e-07, 1.6283870450537117e-07,
+         -2.713978408422853e-08, 2.08767569878681e-09},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {1.26304379776602e-07, -1.917530129335685e-06, 1.2883046737213404e-05, -5.1279578189300414e-05,
+         0.00013577720825984715, -0.0002534928902116402, 0.00034405313051146387, -0.00034405313051146387,
+         0.0002534928902116402, -0.00013577720825984715, 5.1279578189300414e-05, -1.2883046737213404e-05,
+         1.917530129335685e-06, -1.26304379776602e-07},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-2.5964161706349205e-06, 4.3054005456349204e-05, -0.0003296285962301587, 0.0014773220486111111,
+         -0.004283892919146826, 0.008494117373511904, -0.011877325148809523, 0.011877325148809523,
+         -0.008494117373511904, 0.004283892919146826, -0.0014773220486111111, 0.0003296285962301587,
+         -4.3054005456349204e-05, 2.5964161706349205e-06},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {2.1691341949588477e-05, -0.000378196936085391, 0.003155321662808642, -0.01652996801054527,
+         0.055689431021733536, -0.12286033347800926, 0.18132390528549383, -0.18132390528549383,
+         0.12286033347800926, -0.055689431021733536, 0.01652996801054527, -0.003155321662808642,
+         0.000378196936085391, -2.1691341949588477e-05},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-6.890092296925522e-05, 0.0012339350337634571, -0.01079466750802607, 0.06228796562540188,
+         -0.2686994329471577, 0.7337092283541563, -1.2091718455050569, 1.2091718455050569,
+         -0.7337092283541563, 0.2686994329471577, -0.06228796562540188, 0.01079466750802607,
+         -0.0012339350337634571, 6.890092296925522e-05},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {6.06056862923318e-05, -0.001098252223511623, 0.00980982829539348, -0.05905526055230035,
+         0.284556646195669, -1.3354156772674075, 2.9198550705682664, -2.9198550705682664,
+         1.3354156772674075, -0.284556646195669, 0.05905526055230035, -0.00980982829539348,
+         0.001098252223511623, -6.06056862923318e-05},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-4.236514751727765e-06, 7.692250338467684e-05, -0.0006894535488552517, 0.004178932734898159,
+         -0.020476770401000977, 0.10238385200500488, -1.2286062240600586, 1.2286062240600586,
+         -0.10238385200500488, 0.020476770401000977, -0.004178932734898159, 0.0006894535488552517,
+         -7.692250338467684e-05, 4.236514751727765e-06}};
+};
+constexpr double Lagrange_polynomials<6, 1>::coefficients[13][14];
+
+template <>
+struct Lagrange_polynomials<6, 2>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.505210838544172e-08, 3.2567740901074235e-07, -1.954064454064454e-06, 7.164902998236331e-06,
+         -1.791225749559083e-05, 3.2242063492063495e-05, -4.298941798941799e-05, 4.298941798941799e-05,
+         -3.2242063492063495e-05, 1.791225749559083e-05, -7.164902998236331e-06, 1.954064454064454e-06,
+         -3.2567740901074235e-07, 2.505210838544172e-08},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {1.26304379776602e-06, -1.917530129335685e-05, 0.00012883046737213405, -0.0005127957818930041,
+         0.0013577720825984714, -0.002534928902116402, 0.0034405313051146386, -0.0034405313051146386,
+         0.002534928902116402, -0.0013577720825984714, 0.0005127957818930041, -0.00012883046737213405,
+         1.917530129335685e-05, -1.26304379776602e-06},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-2.0771329365079364e-05, 0.00034443204365079363, -0.0026370287698412698, 0.011818576388888889,
+         -0.034271143353174605, 0.06795293898809524, -0.09501860119047618, 0.09501860119047618,
+         -0.06795293898809524, 0.034271143353174605, -0.011818576388888889, 0.0026370287698412698,
+         -0.00034443204365079363, 2.0771329365079364e-05},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {0.00013014805169753087, -0.002269181616512346, 0.018931929976851853, -0.0991798080632716,
+         0.33413658613040126, -0.7371620008680555, 1.087943431712963, -1.087943431712963,
+         0.7371620008680555, -0.33413658613040126, 0.0991798080632716, -0.018931929976851853,
+         0.002269181616512346, -0.00013014805169753087},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.00027560369187702087, 0.0049357401350538285, -0.04317867003210428, 0.2491518625016075,
+         -1.0747977317886308, 2.9348369134166252, -4.836687382020227, 4.836687382020227,
+         -2.9348369134166252, 1.0747977317886308, -0.2491518625016075, 0.04317867003210428,
+         -0.0049357401350538285, 0.00027560369187702087},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.0001212113725846636, -0.002196504447023246, 0.01961965659078696, -0.1181105211046007,
+         0.569113292391338, -2.670831354534815, 5.839710141136533, -5.839710141136533,
+         2.670831354534815, -0.569113292391338, 0.1181105211046007, -0.01961965659078696,
+         0.002196504447023246, -0.0001212113725846636},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double Lagrange_polynomials<6, 2>::coefficients[12][14];
+
+template <class real_number>
+void beta_Lagrange_n6(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/6227020800.0L*x + 1.0L/479001600.0L) + 1.0L/479001600.0L) - 1.0L/8709120.0L) + 1.0L/4838400.0L) + 31.0L/14515200.0L) - 247.0L/43545600.0L) - 139.0L/8709120.0L) + 1049.0L/21772800.0L) + 479.0L/10886400.0L) - 2791.0L/19958400.0L) - 1.0L/33264.0L) + 1.0L/10296.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/479001600.0L)*x - 1.0L/39916800.0L) - 31.0L/479001600.0L) + 1.0L/604800.0L) - 29.0L/14515200.0L) - 41.0L/1209600.0L) + 3337.0L/43545600.0L) + 121.0L/453600.0L) - 3893.0L/5443200.0L) - 19.0L/25200.0L) + 7171.0L/3326400.0L) + 1.0L/1925.0L) - 1.0L/660.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/79833600.0L*x + 1.0L/7257600.0L) + 47.0L/79833600.0L) - 1.0L/96768.0L) + 1.0L/268800.0L) + 601.0L/2419200.0L) - 3169.0L/7257600.0L) - 625.0L/290304.0L) + 8891.0L/1814400.0L) + 643.0L/100800.0L) - 8777.0L/554400.0L) - 1.0L/224.0L) + 1.0L/88.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/21772800.0L)*x - 1.0L/2177280.0L) - 61.0L/21772800.0L) + 41.0L/1088640.0L) + 181.0L/7257600.0L) - 151.0L/145152.0L) + 23477.0L/21772800.0L) + 3011.0L/272160.0L) - 53293.0L/2721600.0L) - 4969.0L/136080.0L) + 33583.0L/453600.0L) + 5.0L/189.0L) - 1.0L/18.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/8709120.0L*x + 1.0L/967680.0L) + 73.0L/8709120.0L) - 29.0L/322560.0L) - 479.0L/2903040.0L) + 59.0L/21504.0L) - 3317.0L/8709120.0L) - 33853.0L/967680.0L) + 156529.0L/4354560.0L) + 4469.0L/26880.0L) - 29483.0L/120960.0L) - 15.0L/112.0L) + 5.0L/24.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/4838400.0L)*x - 1.0L/604800.0L) - 83.0L/4838400.0L) + 1.0L/6720.0L) + 761.0L/1612800.0L) - 971.0L/201600.0L) - 21169.0L/4838400.0L) + 1039.0L/15120.0L) - 4523.0L/604800.0L) - 1769.0L/4200.0L) + 8783.0L/33600.0L) + 6.0L/7.0L) - 3.0L/4.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/3628800.0L*x + 1.0L/518400.0L) + 13.0L/518400.0L) - 91.0L/518400.0L) - 143.0L/172800.0L) + 1001.0L/172800.0L) + 44473.0L/3628800.0L) - 44473.0L/518400.0L) - 5291.0L/64800.0L) + 37037.0L/64800.0L) + 767.0L/3600.0L) - 5369.0L/3600.0L) - 1.0L/7.0L) + 1;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/3628800.0L)*x - 1.0L/604800.0L) - 97.0L/3628800.0L) + 1.0L/6720.0L) + 1181.0L/1209600.0L) - 971.0L/201600.0L) - 61951.0L/3628800.0L) + 1039.0L/15120.0L) + 68207.0L/453600.0L) - 1769.0L/4200.0L) - 15983.0L/25200.0L) + 6.0L/7.0L) + 1);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/4838400.0L*x + 1.0L/967680.0L) + 101.0L/4838400.0L) - 29.0L/322560.0L) - 1291.0L/1612800.0L) + 59.0L/21504.0L) + 71023.0L/4838400.0L) - 33853.0L/967680.0L) - 317413.0L/2419200.0L) + 4469.0L/26880.0L) + 33083.0L/67200.0L) - 15.0L/112.0L) - 3.0L/8.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/8709120.0L)*x - 1.0L/2177280.0L) - 103.0L/8709120.0L) + 41.0L/1088640.0L) + 443.0L/967680.0L) - 151.0L/145152.0L) - 71653.0L/8709120.0L) + 3011.0L/272160.0L) + 73169.0L/1088640.0L) - 4969.0L/136080.0L) - 35983.0L/181440.0L) + 5.0L/189.0L) + 5.0L/36.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/21772800.0L*x + 1.0L/7257600.0L) + 103.0L/21772800.0L) - 1.0L/96768.0L) - 1301.0L/7257600.0L) + 601.0L/2419200.0L) + 66109.0L/21772800.0L) - 625.0L/290304.0L) - 120949.0L/5443200.0L) + 643.0L/100800.0L) + 9227.0L/151200.0L) - 1.0L/224.0L) - 1.0L/24.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/79833600.0L)*x - 1.0L/39916800.0L) - 101.0L/79833600.0L) + 1.0L/604800.0L) + 37.0L/806400.0L) - 41.0L/1209600.0L) - 5273.0L/7257600.0L) + 121.0L/453600.0L) + 4577.0L/907200.0L) - 19.0L/25200.0L) - 7459.0L/554400.0L) + 1.0L/1925.0L) + 1.0L/110.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/479001600.0L*x + 1.0L/479001600.0L) + 97.0L/479001600.0L) - 1.0L/8709120.0L) - 101.0L/14515200.0L) + 31.0L/14515200.0L) + 4601.0L/43545600.0L) - 139.0L/8709120.0L) - 15553.0L/21772800.0L) + 479.0L/10886400.0L) + 37483.0L/19958400.0L) - 1.0L/33264.0L) - 1.0L/792.0L);
-        poly_val[13] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/6227020800.0L)*pow(x, 2) - 1.0L/68428800.0L) + 1.0L/2073600.0L) - 311.0L/43545600.0L) + 37.0L/777600.0L) - 59.0L/475200.0L) + 1.0L/12012.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<6, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/479001600.0L*x + 1.0L/39916800.0L) + 1.0L/43545600.0L) - 1.0L/870912.0L) + 1.0L/537600.0L) + 31.0L/1814400.0L) - 247.0L/6220800.0L) - 139.0L/1451520.0L) + 1049.0L/4354560.0L) + 479.0L/2721600.0L) - 2791.0L/6652800.0L) - 1.0L/16632.0L) + 1.0L/10296.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/479001600.0L)*x - 1.0L/3326400.0L) - 31.0L/43545600.0L) + 1.0L/60480.0L) - 29.0L/1612800.0L) - 41.0L/151200.0L) + 3337.0L/6220800.0L) + 121.0L/75600.0L) - 3893.0L/1088640.0L) - 19.0L/6300.0L) + 7171.0L/1108800.0L) + 2.0L/1925.0L) - 1.0L/660.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/79833600.0L*x + 1.0L/604800.0L) + 47.0L/7257600.0L) - 5.0L/48384.0L) + 3.0L/89600.0L) + 601.0L/302400.0L) - 3169.0L/1036800.0L) - 625.0L/48384.0L) + 8891.0L/362880.0L) + 643.0L/25200.0L) - 8777.0L/184800.0L) - 1.0L/112.0L) + 1.0L/88.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/21772800.0L)*x - 1.0L/181440.0L) - 671.0L/21772800.0L) + 41.0L/108864.0L) + 181.0L/806400.0L) - 151.0L/18144.0L) + 23477.0L/3110400.0L) + 3011.0L/45360.0L) - 53293.0L/544320.0L) - 4969.0L/34020.0L) + 33583.0L/151200.0L) + 10.0L/189.0L) - 1.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/8709120.0L*x + 1.0L/80640.0L) + 803.0L/8709120.0L) - 29.0L/32256.0L) - 479.0L/322560.0L) + 59.0L/2688.0L) - 3317.0L/1244160.0L) - 33853.0L/161280.0L) + 156529.0L/870912.0L) + 4469.0L/6720.0L) - 29483.0L/40320.0L) - 15.0L/56.0L) + 5.0L/24.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/4838400.0L)*x - 1.0L/50400.0L) - 913.0L/4838400.0L) + 1.0L/672.0L) + 761.0L/179200.0L) - 971.0L/25200.0L) - 21169.0L/691200.0L) + 1039.0L/2520.0L) - 4523.0L/120960.0L) - 1769.0L/1050.0L) + 8783.0L/11200.0L) + 12.0L/7.0L) - 3.0L/4.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/3628800.0L*x + 1.0L/43200.0L) + 143.0L/518400.0L) - 91.0L/51840.0L) - 143.0L/19200.0L) + 1001.0L/21600.0L) + 44473.0L/518400.0L) - 44473.0L/86400.0L) - 5291.0L/12960.0L) + 37037.0L/16200.0L) + 767.0L/1200.0L) - 5369.0L/1800.0L) - 1.0L/7.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/3628800.0L)*x - 1.0L/50400.0L) - 1067.0L/3628800.0L) + 1.0L/672.0L) + 1181.0L/134400.0L) - 971.0L/25200.0L) - 61951.0L/518400.0L) + 1039.0L/2520.0L) + 68207.0L/90720.0L) - 1769.0L/1050.0L) - 15983.0L/8400.0L) + 12.0L/7.0L) + 1;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/4838400.0L*x + 1.0L/80640.0L) + 1111.0L/4838400.0L) - 29.0L/32256.0L) - 1291.0L/179200.0L) + 59.0L/2688.0L) + 71023.0L/691200.0L) - 33853.0L/161280.0L) - 317413.0L/483840.0L) + 4469.0L/6720.0L) + 33083.0L/22400.0L) - 15.0L/56.0L) - 3.0L/8.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/8709120.0L)*x - 1.0L/181440.0L) - 1133.0L/8709120.0L) + 41.0L/108864.0L) + 443.0L/107520.0L) - 151.0L/18144.0L) - 71653.0L/1244160.0L) + 3011.0L/45360.0L) + 73169.0L/217728.0L) - 4969.0L/34020.0L) - 35983.0L/60480.0L) + 10.0L/189.0L) + 5.0L/36.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/21772800.0L*x + 1.0L/604800.0L) + 1133.0L/21772800.0L) - 5.0L/48384.0L) - 1301.0L/806400.0L) + 601.0L/302400.0L) + 66109.0L/3110400.0L) - 625.0L/48384.0L) - 120949.0L/1088640.0L) + 643.0L/25200.0L) + 9227.0L/50400.0L) - 1.0L/112.0L) - 1.0L/24.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/79833600.0L)*x - 1.0L/3326400.0L) - 101.0L/7257600.0L) + 1.0L/60480.0L) + 37.0L/89600.0L) - 41.0L/151200.0L) - 5273.0L/1036800.0L) + 121.0L/75600.0L) + 4577.0L/181440.0L) - 19.0L/6300.0L) - 7459.0L/184800.0L) + 2.0L/1925.0L) + 1.0L/110.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/479001600.0L*x + 1.0L/39916800.0L) + 97.0L/43545600.0L) - 1.0L/870912.0L) - 101.0L/1612800.0L) + 31.0L/1814400.0L) + 4601.0L/6220800.0L) - 139.0L/1451520.0L) - 15553.0L/4354560.0L) + 479.0L/2721600.0L) + 37483.0L/6652800.0L) - 1.0L/16632.0L) - 1.0L/792.0L;
-        poly_val[13] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/479001600.0L)*pow(x, 2) - 1.0L/6220800.0L) + 1.0L/230400.0L) - 311.0L/6220800.0L) + 37.0L/155520.0L) - 59.0L/158400.0L) + 1.0L/12012.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<6, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/39916800.0L*x + 1.0L/3628800.0L) + 1.0L/4354560.0L) - 1.0L/96768.0L) + 1.0L/67200.0L) + 31.0L/259200.0L) - 247.0L/1036800.0L) - 139.0L/290304.0L) + 1049.0L/1088640.0L) + 479.0L/907200.0L) - 2791.0L/3326400.0L) - 1.0L/16632.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/39916800.0L)*x - 1.0L/302400.0L) - 31.0L/4354560.0L) + 1.0L/6720.0L) - 29.0L/201600.0L) - 41.0L/21600.0L) + 3337.0L/1036800.0L) + 121.0L/15120.0L) - 3893.0L/272160.0L) - 19.0L/2100.0L) + 7171.0L/554400.0L) + 2.0L/1925.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/6652800.0L*x + 11.0L/604800.0L) + 47.0L/725760.0L) - 5.0L/5376.0L) + 3.0L/11200.0L) + 601.0L/43200.0L) - 3169.0L/172800.0L) - 3125.0L/48384.0L) + 8891.0L/90720.0L) + 643.0L/8400.0L) - 8777.0L/92400.0L) - 1.0L/112.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/1814400.0L)*x - 11.0L/181440.0L) - 671.0L/2177280.0L) + 41.0L/12096.0L) + 181.0L/100800.0L) - 151.0L/2592.0L) + 23477.0L/518400.0L) + 3011.0L/9072.0L) - 53293.0L/136080.0L) - 4969.0L/11340.0L) + 33583.0L/75600.0L) + 10.0L/189.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/725760.0L*x + 11.0L/80640.0L) + 803.0L/870912.0L) - 29.0L/3584.0L) - 479.0L/40320.0L) + 59.0L/384.0L) - 3317.0L/207360.0L) - 33853.0L/32256.0L) + 156529.0L/217728.0L) + 4469.0L/2240.0L) - 29483.0L/20160.0L) - 15.0L/56.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/403200.0L)*x - 11.0L/50400.0L) - 913.0L/483840.0L) + 3.0L/224.0L) + 761.0L/22400.0L) - 971.0L/3600.0L) - 21169.0L/115200.0L) + 1039.0L/504.0L) - 4523.0L/30240.0L) - 1769.0L/350.0L) + 8783.0L/5600.0L) + 12.0L/7.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/302400.0L*x + 11.0L/43200.0L) + 143.0L/51840.0L) - 91.0L/5760.0L) - 143.0L/2400.0L) + 7007.0L/21600.0L) + 44473.0L/86400.0L) - 44473.0L/17280.0L) - 5291.0L/3240.0L) + 37037.0L/5400.0L) + 767.0L/600.0L) - 5369.0L/1800.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/302400.0L)*x - 11.0L/50400.0L) - 1067.0L/362880.0L) + 3.0L/224.0L) + 1181.0L/16800.0L) - 971.0L/3600.0L) - 61951.0L/86400.0L) + 1039.0L/504.0L) + 68207.0L/22680.0L) - 1769.0L/350.0L) - 15983.0L/4200.0L) + 12.0L/7.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/403200.0L*x + 11.0L/80640.0L) + 1111.0L/483840.0L) - 29.0L/3584.0L) - 1291.0L/22400.0L) + 59.0L/384.0L) + 71023.0L/115200.0L) - 33853.0L/32256.0L) - 317413.0L/120960.0L) + 4469.0L/2240.0L) + 33083.0L/11200.0L) - 15.0L/56.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/725760.0L)*x - 11.0L/181440.0L) - 1133.0L/870912.0L) + 41.0L/12096.0L) + 443.0L/13440.0L) - 151.0L/2592.0L) - 71653.0L/207360.0L) + 3011.0L/9072.0L) + 73169.0L/54432.0L) - 4969.0L/11340.0L) - 35983.0L/30240.0L) + 10.0L/189.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/1814400.0L*x + 11.0L/604800.0L) + 1133.0L/2177280.0L) - 5.0L/5376.0L) - 1301.0L/100800.0L) + 601.0L/43200.0L) + 66109.0L/518400.0L) - 3125.0L/48384.0L) - 120949.0L/272160.0L) + 643.0L/8400.0L) + 9227.0L/25200.0L) - 1.0L/112.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13.0L/6652800.0L)*x - 1.0L/302400.0L) - 101.0L/725760.0L) + 1.0L/6720.0L) + 37.0L/11200.0L) - 41.0L/21600.0L) - 5273.0L/172800.0L) + 121.0L/15120.0L) + 4577.0L/45360.0L) - 19.0L/2100.0L) - 7459.0L/92400.0L) + 2.0L/1925.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13.0L/39916800.0L*x + 1.0L/3628800.0L) + 97.0L/4354560.0L) - 1.0L/96768.0L) - 101.0L/201600.0L) + 31.0L/259200.0L) + 4601.0L/1036800.0L) - 139.0L/290304.0L) - 15553.0L/1088640.0L) + 479.0L/907200.0L) + 37483.0L/3326400.0L) - 1.0L/16632.0L;
-        poly_val[13] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/39916800.0L)*pow(x, 2) - 1.0L/622080.0L) + 1.0L/28800.0L) - 311.0L/1036800.0L) + 37.0L/38880.0L) - 59.0L/79200.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<6, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n7(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n6<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n6<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<7, 0>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-7.647163731819816e-13, 1.1470745597729725e-11, -8.029521918410807e-11, 3.4794594979780167e-10,
+         -1.043837849393405e-09, 2.2964432686654908e-09, -3.827405447775818e-09, 4.920949861426052e-09,
+         -4.920949861426052e-09, 3.827405447775818e-09, -2.2964432686654908e-09, 1.043837849393405e-09,
+         -3.4794594979780167e-10, 8.029521918410807e-11, -1.1470745597729725e-11, 7.647163731819816e-13},
+        {5.735372798864862e-12, -7.455984638524321e-11, 4.416237055125944e-10, -1.5657567740901075e-09,
+         3.653432472876917e-09, -5.7411081716637276e-09, 5.7411081716637276e-09, -2.460474930713026e-09,
+         -2.460474930713026e-09, 5.7411081716637276e-09, -5.7411081716637276e-09, 3.653432472876917e-09,
+         -1.5657567740901075e-09, 4.416237055125944e-10, -7.455984638524321e-11, 5.735372798864862e-12},
+        {8.698648744945042e-11, -1.4653877501099724e-09, 1.1221256880979103e-08, -5.21049059822208e-08,
+         1.6466542074180963e-07, -3.760425852439741e-07, 6.420472638643935e-07, -8.353312389770723e-07,
+         8.353312389770723e-07, -6.420472638643935e-07, 3.760425852439741e-07, -1.6466542074180963e-07,
+         5.21049059822208e-08, -1.1221256880979103e-08, 1.4653877501099724e-09, -8.698648744945042e-11},
+        {-6.523986558708781e-10, 9.52502037571482e-09, -6.171691284538507e-08, 2.3447207691999358e-07,
+         -5.763289725963337e-07, 9.401064631099353e-07, -9.630708957965901e-07, 4.1766561948853615e-07,
+         4.1766561948853615e-07, -9.630708957965901e-07, 9.401064631099353e-07, -5.763289725963337e-07,
+         2.3447207691999358e-07, -6.171691284538507e-08, 9.52502037571482e-09, -6.523986558708781e-10},
+        {-3.683877743484225e-09, 6.674038249559083e-08, -5.611280839145422e-07, 2.847350440304723e-06,
+         -9.690272955246913e-06, 2.340606743276014e-05, -4.1482616307196744e-05, 5.4983310598544977e-05,
+         -5.4983310598544977e-05, 4.1482616307196744e-05, -2.340606743276014e-05, 9.690272955246913e-06,
+         -2.847350440304723e-06, 5.611280839145422e-07, -6.674038249559083e-08, 3.683877743484225e-09},
+        {2.7629083076131687e-08, -4.338124862213404e-07, 3.0862044615299823e-06, -1.2813076981371252e-05,
+         3.3915955343364194e-05, -5.851516858190035e-05, 6.222392446079512e-05, -2.7491655299272488e-05,
+         -2.7491655299272488e-05, 6.222392446079512e-05, -5.851516858190035e-05, 3.3915955343364194e-05,
+         -1.2813076981371252e-05, 3.0862044615299823e-06, -4.338124862213404e-07, 2.7629083076131687e-08},
+        {7.279759334932533e-08, -1.3804545858659822e-06, 1.242752568571796e-05, -6.974830455507178e-05,
+         0.0002635156092119525, -0.000694599274955449, 0.0013081427739924738, -0.001788155307515078,
+         0.001788155307515078, -0.0013081427739924738, 0.000694599274955449, -0.0002635156092119525,
+         6.974830455507178e-05, -1.242752568571796e-05, 1.3804545858659822e-06, -7.279759334932533e-08},
+        {-5.4598195011994e-07, 8.972954808128884e-06, -6.835139127144878e-05, 0.00031386737049782297,
+         -0.0009223046322418338, 0.0017364981873886226, -0.0019622141609887105, 0.000894077653757539,
+         0.000894077653757539, -0.0019622141609887105, 0.0017364981873886226, -0.0009223046322418338,
+         0.00031386737049782297, -6.835139127144878e-05, 8.972954808128884e-06, -5.4598195011994e-07},
+        {-6.890615575014084e-07, 1.3434686498176624e-05, -0.0001263795972641323, 0.0007642832462072326,
+         -0.0033019930274958893, 0.010024884860281521, -0.02100022930643873, 0.030337526163306396,
+         -0.030337526163306396, 0.02100022930643873, -0.010024884860281521, 0.0033019930274958893,
+         -0.0007642832462072326, 0.0001263795972641323, -1.3434686498176624e-05, 6.890615575014084e-07},
+        {5.167961681260564e-06, -8.732546223814806e-05, 0.0006950877849527278, -0.0034392746079325467,
+         0.011556975596235614, -0.025062212150703804, 0.031500343959658096, -0.015168763081653198,
+         -0.015168763081653198, 0.031500343959658096, -0.025062212150703804, 0.011556975596235614,
+         -0.0034392746079325467, 0.0006950877849527278, -8.732546223814806e-05, 5.167961681260564e-06},
+        {2.8686414024808754e-06, -5.680980563106418e-05, 0.0005479943540131833, -0.003464165339734012,
+         0.01637328863946677, -0.06235441672108161, 0.16109939589024805, -0.2602940765259758,
+         0.2602940765259758, -0.16109939589024805, 0.06235441672108161, -0.01637328863946677,
+         0.003464165339734012, -0.0005479943540131833, 5.680980563106418e-05, -2.8686414024808754e-06},
+        {-2.1514810518606568e-05, 0.00036926373660191715, -0.0030139689470725086, 0.015588744028803055,
+         -0.0573065102381337, 0.15588604180270402, -0.2416490938353721, 0.1301470382629879,
+         0.1301470382629879, -0.2416490938353721, 0.15588604180270402, -0.0573065102381337,
+         0.015588744028803055, -0.0030139689470725086, 0.00036926373660191715, -2.1514810518606568e-05},
+        {-4.084602841438415e-06, 8.14709380523535e-05, -0.0007949673728549079, 0.005128437057985639,
+         -0.02526056972933022, 0.1071182777313959, -0.46558199631053515, 0.9995694428074117,
+         -0.9995694428074117, 0.46558199631053515, -0.1071182777313959, 0.02526056972933022,
+         -0.005128437057985639, 0.0007949673728549079, -8.14709380523535e-05, 4.084602841438415e-06},
+        {3.0634521310788115e-05, -0.0005295610973402977, 0.004372320550701993, -0.02307796676093538,
+         0.08841199405265576, -0.26779569432848976, 0.6983729944658027, -0.49978472140370583,
+         -0.49978472140370583, 0.6983729944658027, -0.26779569432848976, 0.08841199405265576,
+         -0.02307796676093538, 0.004372320550701993, -0.0005295610973402977, 3.0634521310788115e-05},
+        {8.52346420288086e-07, -1.7021711056049055e-05, 0.00016641887751492587, -0.0010772711700863307,
+         0.005342385598591396, -0.023036366701126097, 0.10664984583854675, -1.2340910732746124,
+         1.2340910732746124, -0.10664984583854675, 0.023036366701126097, -0.005342385598591396,
+         0.0010772711700863307, -0.00016641887751492587, 1.7021711056049055e-05, -8.52346420288086e-07},
+        {-6.3925981521606445e-06, 0.00011064112186431885, -0.0009153038263320923, 0.004847720265388489,
+         -0.018698349595069885, 0.05759091675281525, -0.15997476875782013, 0.6170455366373062,
+         0.6170455366373062, -0.15997476875782013, 0.05759091675281525, -0.018698349595069885,
+         0.004847720265388489, -0.0009153038263320923, 0.00011064112186431885, -6.3925981521606445e-06}};
+};
+constexpr double Lagrange_polynomials<7, 0>::coefficients[16][16];
+
+template <>
+struct Lagrange_polynomials<7, 1>
+{
+    static constexpr int degree = 14;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.1470745597729725e-11, 1.7206118396594586e-10, -1.2044282877616211e-09, 5.219189246967025e-09,
+         -1.5657567740901073e-08, 3.444664902998236e-08, -5.7411081716637274e-08, 7.381424792139078e-08,
+         -7.381424792139078e-08, 5.7411081716637274e-08, -3.444664902998236e-08, 1.5657567740901073e-08,
+         -5.219189246967025e-09, 1.2044282877616211e-09, -1.7206118396594586e-10, 1.1470745597729725e-11},
+        {8.029521918410807e-11, -1.043837849393405e-09, 6.182731877176321e-09, -2.1920594837261504e-08,
+         5.114805462027684e-08, -8.037551440329219e-08, 8.037551440329219e-08, -3.444664902998236e-08,
+         -3.444664902998236e-08, 8.037551440329219e-08, -8.037551440329219e-08, 5.114805462027684e-08,
+         -2.1920594837261504e-08, 6.182731877176321e-09, -1.043837849393405e-09, 8.029521918410807e-11},
+        {1.1308243368428554e-09, -1.905004075142964e-08, 1.4587633945272835e-07, -6.773637777688704e-07,
+         2.140650469643525e-06, -4.8885536081716634e-06, 8.346614430237115e-06, -1.085930610670194e-05,
+         1.085930610670194e-05, -8.346614430237115e-06, 4.8885536081716634e-06, -2.140650469643525e-06,
+         6.773637777688704e-07, -1.4587633945272835e-07, 1.905004075142964e-08, -1.1308243368428554e-09},
+        {-7.828783870450537e-09, 1.1430024450857785e-07, -7.406029541446208e-07, 2.813664923039923e-06,
+         -6.915947671156005e-06, 1.1281277557319224e-05, -1.1556850749559083e-05, 5.011987433862434e-06,
+         5.011987433862434e-06, -1.1556850749559083e-05, 1.1281277557319224e-05, -6.915947671156005e-06,
+         2.813664923039923e-06, -7.406029541446208e-07, 1.1430024450857785e-07, -7.828783870450537e-09},
+        {-4.052265517832647e-08, 7.341442074514991e-07, -6.172408923059965e-06, 3.1320854843351946e-05,
+         -0.00010659300250771605, 0.00025746674176036155, -0.00045630877937916423, 0.0006048164165839947,
+         -0.0006048164165839947, 0.00045630877937916423, -0.00025746674176036155, 0.00010659300250771605,
+         -3.1320854843351946e-05, 6.172408923059965e-06, -7.341442074514991e-07, 4.052265517832647e-08},
+        {2.7629083076131685e-07, -4.338124862213404e-06, 3.086204461529982e-05, -0.0001281307698137125,
+         0.00033915955343364197, -0.0005851516858190035, 0.0006222392446079512, -0.00027491655299272485,
+         -0.00027491655299272485, 0.0006222392446079512, -0.0005851516858190035, 0.00033915955343364197,
+         -0.0001281307698137125, 3.086204461529982e-05, -4.338124862213404e-06, 2.7629083076131685e-07},
+        {6.551783401439279e-07, -1.2424091272793839e-05, 0.00011184773117146163, -0.0006277347409956459,
+         0.002371640482907573, -0.006251393474599041, 0.011773284965932265, -0.0160933977676357,
+         0.0160933977676357, -0.011773284965932265, 0.006251393474599041, -0.002371640482907573,
+         0.0006277347409956459, -0.00011184773117146163, 1.2424091272793839e-05, -6.551783401439279e-07},
+        {-4.36785560095952e-06, 7.178363846503108e-05, -0.0005468111301715902, 0.0025109389639825837,
+         -0.007378437057934671, 0.01389198549910898, -0.015697713287909684, 0.007152621230060312,
+         0.007152621230060312, -0.015697713287909684, 0.01389198549910898, -0.007378437057934671,
+         0.0025109389639825837, -0.0005468111301715902, 7.178363846503108e-05, -4.36785560095952e-06},
+        {-4.8234309025098595e-06, 9.404280548723636e-05, -0.0008846571808489262, 0.005349982723450628,
+         -0.023113951192471227, 0.07017419402197064, -0.1470016051450711, 0.21236268314314477,
+         -0.21236268314314477, 0.1470016051450711, -0.07017419402197064, 0.023113951192471227,
+         -0.005349982723450628, 0.0008846571808489262, -9.404280548723636e-05, 4.8234309025098595e-06},
+        {3.100777008756338e-05, -0.0005239527734288884, 0.004170526709716366, -0.02063564764759528,
+         0.06934185357741368, -0.1503732729042228, 0.18900206375794856, -0.09101257848991919,
+         -0.09101257848991919, 0.18900206375794856, -0.1503732729042228, 0.06934185357741368,
+         -0.02063564764759528, 0.004170526709716366, -0.0005239527734288884, 3.100777008756338e-05},
+        {1.4343207012404377e-05, -0.0002840490281553209, 0.0027399717700659167, -0.01732082669867006,
+         0.08186644319733385, -0.31177208360540803, 0.8054969794512402, -1.301470382629879,
+         1.301470382629879, -0.8054969794512402, 0.31177208360540803, -0.08186644319733385,
+         0.01732082669867006, -0.0027399717700659167, 0.0002840490281553209, -1.4343207012404377e-05},
+        {-8.605924207442627e-05, 0.0014770549464076686, -0.012055875788290035, 0.06235497611521222,
+         -0.2292260409525348, 0.6235441672108161, -0.9665963753414883, 0.5205881530519516,
+         0.5205881530519516, -0.9665963753414883, 0.6235441672108161, -0.2292260409525348,
+         0.06235497611521222, -0.012055875788290035, 0.0014770549464076686, -8.605924207442627e-05},
+        {-1.2253808524315247e-05, 0.0002444128141570605, -0.002384902118564724, 0.015385311173956919,
+         -0.07578170918799065, 0.32135483319418773, -1.3967459889316054, 2.998708328422235,
+         -2.998708328422235, 1.3967459889316054, -0.32135483319418773, 0.07578170918799065,
+         -0.015385311173956919, 0.002384902118564724, -0.0002444128141570605, 1.2253808524315247e-05},
+        {6.126904262157623e-05, -0.0010591221946805954, 0.008744641101403987, -0.04615593352187076,
+         0.17682398810531152, -0.5355913886569795, 1.3967459889316054, -0.9995694428074117,
+         -0.9995694428074117, 1.3967459889316054, -0.5355913886569795, 0.17682398810531152,
+         -0.04615593352187076, 0.008744641101403987, -0.0010591221946805954, 6.126904262157623e-05},
+        {8.52346420288086e-07, -1.7021711056049055e-05, 0.00016641887751492587, -0.0010772711700863307,
+         0.005342385598591396, -0.023036366701126097, 0.10664984583854675, -1.2340910732746124,
+         1.2340910732746124, -0.10664984583854675, 0.023036366701126097, -0.005342385598591396,
+         0.0010772711700863307, -0.00016641887751492587, 1.7021711056049055e-05, -8.52346420288086e-07}};
+};
+constexpr double Lagrange_polynomials<7, 1>::coefficients[15][16];
+
+template <>
+struct Lagrange_polynomials<7, 2>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.6059043836821613e-10, 2.4088565755232422e-09, -1.6861996028662696e-08, 7.306864945753835e-08,
+         -2.1920594837261504e-07, 4.822530864197531e-07, -8.037551440329218e-07, 1.033399470899471e-06,
+         -1.033399470899471e-06, 8.037551440329218e-07, -4.822530864197531e-07, 2.1920594837261504e-07,
+         -7.306864945753835e-08, 1.6861996028662696e-08, -2.4088565755232422e-09, 1.6059043836821613e-10},
+        {1.043837849393405e-09, -1.3569892042114265e-08, 8.037551440329219e-08, -2.8496773288439956e-07,
+         6.64924710063599e-07, -1.0448816872427983e-06, 1.0448816872427983e-06, -4.478064373897707e-07,
+         -4.478064373897707e-07, 1.0448816872427983e-06, -1.0448816872427983e-06, 6.64924710063599e-07,
+         -2.8496773288439956e-07, 8.037551440329219e-08, -1.3569892042114265e-08, 1.043837849393405e-09},
+        {1.3569892042114265e-08, -2.286004890171557e-07, 1.75051607343274e-06, -8.128365333226444e-06,
+         2.56878056357223e-05, -5.8662643298059965e-05, 0.00010015937316284538, -0.00013031167328042328,
+         0.00013031167328042328, -0.00010015937316284538, 5.8662643298059965e-05, -2.56878056357223e-05,
+         8.128365333226444e-06, -1.75051607343274e-06, 2.286004890171557e-07, -1.3569892042114265e-08},
+        {-8.611662257495591e-08, 1.2573026895943562e-06, -8.146632495590829e-06, 3.095031415343915e-05,
+         -7.607542438271605e-05, 0.00012409405313051146, -0.00012712535824514992, 5.513186177248677e-05,
+         5.513186177248677e-05, -0.00012712535824514992, 0.00012409405313051146, -7.607542438271605e-05,
+         3.095031415343915e-05, -8.146632495590829e-06, 1.2573026895943562e-06, -8.611662257495591e-08},
+        {-4.052265517832647e-07, 7.3414420745149915e-06, -6.172408923059964e-05, 0.0003132085484335195,
+         -0.0010659300250771605, 0.0025746674176036154, -0.004563087793791642, 0.006048164165839947,
+         -0.006048164165839947, 0.004563087793791642, -0.0025746674176036154, 0.0010659300250771605,
+         -0.0003132085484335195, 6.172408923059964e-05, -7.3414420745149915e-06, 4.052265517832647e-07},
+        {2.486617476851852e-06, -3.904312375992063e-05, 0.0002777584015376984, -0.0011531769283234126,
+         0.003052435980902778, -0.005266365172371032, 0.005600153201471561, -0.002474248976934524,
+         -0.002474248976934524, 0.005600153201471561, -0.005266365172371032, 0.003052435980902778,
+         -0.0011531769283234126, 0.0002777584015376984, -3.904312375992063e-05, 2.486617476851852e-06},
+        {5.241426721151423e-06, -9.939273018235071e-05, 0.0008947818493716931, -0.0050218779279651675,
+         0.018973123863260583, -0.050011147796792325, 0.09418627972745812, -0.1287471821410856,
+         0.1287471821410856, -0.09418627972745812, 0.050011147796792325, -0.018973123863260583,
+         0.0050218779279651675, -0.0008947818493716931, 9.939273018235071e-05, -5.241426721151423e-06},
+        {-3.057498920671664e-05, 0.0005024854692552175, -0.0038276779112011317, 0.017576572747878088,
+         -0.051649059405542694, 0.09724389849376286, -0.1098839930153678, 0.05006834861042218,
+         0.05006834861042218, -0.1098839930153678, 0.09724389849376286, -0.051649059405542694,
+         0.017576572747878088, -0.0038276779112011317, 0.0005024854692552175, -3.057498920671664e-05},
+        {-2.8940585415059156e-05, 0.0005642568329234182, -0.005307943085093557, 0.03209989634070377,
+         -0.13868370715482736, 0.42104516413182386, -0.8820096308704266, 1.2741760988588686,
+         -1.2741760988588686, 0.8820096308704266, -0.42104516413182386, 0.13868370715482736,
+         -0.03209989634070377, 0.005307943085093557, -0.0005642568329234182, 2.8940585415059156e-05},
+        {0.0001550388504378169, -0.0026197638671444415, 0.02085263354858183, -0.1031782382379764,
+         0.3467092678870684, -0.7518663645211141, 0.9450103187897428, -0.45506289244959597,
+         -0.45506289244959597, 0.9450103187897428, -0.7518663645211141, 0.3467092678870684,
+         -0.1031782382379764, 0.02085263354858183, -0.0026197638671444415, 0.0001550388504378169},
+        {5.737282804961751e-05, -0.0011361961126212835, 0.010959887080263667, -0.06928330679468024,
+         0.3274657727893354, -1.2470883344216321, 3.221987917804961, -5.205881530519516,
+         5.205881530519516, -3.221987917804961, 1.2470883344216321, -0.3274657727893354,
+         0.06928330679468024, -0.010959887080263667, 0.0011361961126212835, -5.737282804961751e-05},
+        {-0.0002581777262232788, 0.004431164839223006, -0.0361676273648701, 0.18706492834563665,
+         -0.6876781228576043, 1.8706325016324483, -2.899789126024465, 1.5617644591558548,
+         1.5617644591558548, -2.899789126024465, 1.8706325016324483, -0.6876781228576043,
+         0.18706492834563665, -0.0361676273648701, 0.004431164839223006, -0.0002581777262232788},
+        {-2.4507617048630495e-05, 0.000488825628314121, -0.004769804237129448, 0.030770622347913838,
+         -0.1515634183759813, 0.6427096663883755, -2.793491977863211, 5.99741665684447,
+         -5.99741665684447, 2.793491977863211, -0.6427096663883755, 0.1515634183759813,
+         -0.030770622347913838, 0.004769804237129448, -0.000488825628314121, 2.4507617048630495e-05},
+        {6.126904262157623e-05, -0.0010591221946805954, 0.008744641101403987, -0.04615593352187076,
+         0.17682398810531152, -0.5355913886569795, 1.3967459889316054, -0.9995694428074117,
+         -0.9995694428074117, 1.3967459889316054, -0.5355913886569795, 0.17682398810531152,
+         -0.04615593352187076, 0.008744641101403987, -0.0010591221946805954, 6.126904262157623e-05}};
+};
+constexpr double Lagrange_polynomials<7, 2>::coefficients[14][16];
+
+template <class real_number>
+void beta_Lagrange_n7(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1307674368000.0L*x + 1.0L/87178291200.0L) + 1.0L/37362124800.0L) - 1.0L/958003200.0L) + 23.0L/14370048000.0L) + 1.0L/29030400.0L) - 173.0L/1828915200.0L) - 311.0L/609638400.0L) + 137.0L/81648000.0L) + 37.0L/10886400.0L) - 2173.0L/179625600.0L) - 59.0L/6652800.0L) + 37133.0L/1135134000.0L) + 1.0L/168168.0L) - 1.0L/45045.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/87178291200.0L)*x - 1.0L/6227020800.0L) - 1.0L/1556755200.0L) + 1.0L/59875200.0L) - 1.0L/68428800.0L) - 13.0L/21772800.0L) + 211.0L/152409600.0L) + 101.0L/10886400.0L) - 95.0L/3483648.0L) - 2767.0L/43545600.0L) + 7043.0L/34214400.0L) + 20137.0L/119750400.0L) - 129053.0L/227026800.0L) - 7.0L/61776.0L) + 1.0L/2574.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/12454041600.0L*x + 1.0L/958003200.0L) + 1.0L/166053888.0L) - 23.0L/191600640.0L) + 1.0L/958003200.0L) + 139.0L/29030400.0L) - 149.0L/17418240.0L) - 1399.0L/17418240.0L) + 23.0L/113400.0L) + 6271.0L/10886400.0L) - 19787.0L/11975040.0L) - 2077.0L/1330560.0L) + 51043.0L/10810800.0L) + 7.0L/6600.0L) - 7.0L/2145.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2874009600.0L)*x - 1.0L/239500800.0L) - 23.0L/718502400.0L) + 31.0L/59875200.0L) + 151.0L/287400960.0L) - 83.0L/3628800.0L) + 1621.0L/65318400.0L) + 2363.0L/5443200.0L) - 228653.0L/261273600.0L) - 73811.0L/21772800.0L) + 2960071.0L/359251200.0L) + 31957.0L/3326400.0L) - 500287.0L/19958400.0L) - 7.0L/1056.0L) + 7.0L/396.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/958003200.0L*x + 1.0L/87091200.0L) + 107.0L/958003200.0L) - 131.0L/87091200.0L) - 3139.0L/958003200.0L) + 6283.0L/87091200.0L) - 1429.0L/87091200.0L) - 135073.0L/87091200.0L) + 11261.0L/5443200.0L) + 157477.0L/10886400.0L) - 1642643.0L/59875200.0L) - 247081.0L/5443200.0L) + 239731.0L/2494800.0L) + 7.0L/216.0L) - 7.0L/99.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/435456000.0L)*x - 1.0L/43545600.0L) - 1.0L/3628800.0L) + 17.0L/5443200.0L) + 2371.0L/217728000.0L) - 1153.0L/7257600.0L) - 2663.0L/21772800.0L) + 40987.0L/10886400.0L) - 267829.0L/145152000.0L) - 1819681.0L/43545600.0L) + 1055099.0L/21772800.0L) + 222581.0L/1209600.0L) - 52889.0L/189000.0L) - 7.0L/48.0L) + 7.0L/30.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/261273600.0L*x + 1.0L/29030400.0L) + 131.0L/261273600.0L) - 139.0L/29030400.0L) - 6211.0L/261273600.0L) + 2441.0L/9676800.0L) + 17959.0L/37324800.0L) - 184297.0L/29030400.0L) - 1021.0L/326592.0L) + 286397.0L/3628800.0L) - 333059.0L/16329600.0L) - 90281.0L/201600.0L) + 68231.0L/226800.0L) + 7.0L/8.0L) - 7.0L/9.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/203212800.0L)*x - 1.0L/25401600.0L) - 1.0L/1451520.0L) + 1.0L/181440.0L) + 533.0L/14515200.0L) - 533.0L/1814400.0L) - 9581.0L/10160640.0L) + 9581.0L/1270080.0L) + 353639.0L/29030400.0L) - 353639.0L/3628800.0L) - 54613.0L/725760.0L) + 54613.0L/90720.0L) + 266681.0L/1411200.0L) - 266681.0L/176400.0L) - 1.0L/8.0L) + 1;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/203212800.0L*x + 1.0L/29030400.0L) + 1.0L/1382400.0L) - 139.0L/29030400.0L) - 241.0L/5806080.0L) + 2441.0L/9676800.0L) + 242881.0L/203212800.0L) - 184297.0L/29030400.0L) - 1601.0L/86400.0L) + 286397.0L/3628800.0L) + 279731.0L/1814400.0L) - 90281.0L/201600.0L) - 112331.0L/176400.0L) + 7.0L/8.0L) + 1);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/261273600.0L)*x - 1.0L/43545600.0L) - 19.0L/32659200.0L) + 17.0L/5443200.0L) + 4547.0L/130636800.0L) - 1153.0L/7257600.0L) - 68659.0L/65318400.0L) + 40987.0L/10886400.0L) + 4442849.0L/261273600.0L) - 1819681.0L/43545600.0L) - 9281953.0L/65318400.0L) + 222581.0L/1209600.0L) + 116803.0L/226800.0L) - 7.0L/48.0L) - 7.0L/18.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/435456000.0L*x + 1.0L/87091200.0L) + 31.0L/87091200.0L) - 131.0L/87091200.0L) - 9427.0L/435456000.0L) + 6283.0L/87091200.0L) + 57173.0L/87091200.0L) - 135073.0L/87091200.0L) - 70337.0L/6804000.0L) + 157477.0L/10886400.0L) + 427361.0L/5443200.0L) - 247081.0L/5443200.0L) - 254431.0L/1134000.0L) + 7.0L/216.0L) + 7.0L/45.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/958003200.0L)*x - 1.0L/239500800.0L) - 13.0L/79833600.0L) + 31.0L/59875200.0L) + 4723.0L/479001600.0L) - 83.0L/3628800.0L) - 6347.0L/21772800.0L) + 2363.0L/5443200.0L) + 5017.0L/1161216.0L) - 73811.0L/21772800.0L) - 3535297.0L/119750400.0L) + 31957.0L/3326400.0L) + 522337.0L/6652800.0L) - 7.0L/1056.0L) - 7.0L/132.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2874009600.0L*x + 1.0L/958003200.0L) + 31.0L/574801920.0L) - 23.0L/191600640.0L) - 9187.0L/2874009600.0L) + 139.0L/29030400.0L) + 947.0L/10450944.0L) - 1399.0L/17418240.0L) - 20623.0L/16329600.0L) + 6271.0L/10886400.0L) + 294617.0L/35925120.0L) - 2077.0L/1330560.0L) - 52807.0L/2494800.0L) + 7.0L/6600.0L) + 7.0L/495.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/12454041600.0L)*x - 1.0L/6227020800.0L) - 19.0L/1556755200.0L) + 1.0L/59875200.0L) + 67.0L/95800320.0L) - 13.0L/21772800.0L) - 59.0L/3110400.0L) + 101.0L/10886400.0L) + 22159.0L/87091200.0L) - 2767.0L/43545600.0L) - 385381.0L/239500800.0L) + 20137.0L/119750400.0L) + 16591.0L/4054050.0L) - 7.0L/61776.0L) - 7.0L/2574.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/87178291200.0L*x + 1.0L/87178291200.0L) + 1.0L/593049600.0L) - 1.0L/958003200.0L) - 89.0L/958003200.0L) + 1.0L/29030400.0L) + 1487.0L/609638400.0L) - 311.0L/609638400.0L) - 29.0L/907200.0L) + 37.0L/10886400.0L) + 11927.0L/59875200.0L) - 59.0L/6652800.0L) - 38033.0L/75675600.0L) + 1.0L/168168.0L) + 1.0L/3003.0L);
-        poly_val[15] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/1307674368000.0L)*pow(x, 2) - 1.0L/9340531200.0L) + 41.0L/7185024000.0L) - 67.0L/457228800.0L) + 2473.0L/1306368000.0L) - 4201.0L/359251200.0L) + 266681.0L/9081072000.0L) - 1.0L/51480.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<7, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/87178291200.0L*x + 1.0L/6227020800.0L) + 1.0L/2874009600.0L) - 1.0L/79833600.0L) + 23.0L/1306368000.0L) + 1.0L/2903040.0L) - 173.0L/203212800.0L) - 311.0L/76204800.0L) + 137.0L/11664000.0L) + 37.0L/1814400.0L) - 2173.0L/35925120.0L) - 59.0L/1663200.0L) + 37133.0L/378378000.0L) + 1.0L/84084.0L) - 1.0L/45045.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/5811886080.0L)*x - 1.0L/444787200.0L) - 1.0L/119750400.0L) + 1.0L/4989600.0L) - 1.0L/6220800.0L) - 13.0L/2177280.0L) + 211.0L/16934400.0L) + 101.0L/1360800.0L) - 95.0L/497664.0L) - 2767.0L/7257600.0L) + 7043.0L/6842880.0L) + 20137.0L/29937600.0L) - 129053.0L/75675600.0L) - 7.0L/30888.0L) + 1.0L/2574.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/830269440.0L*x + 1.0L/68428800.0L) + 1.0L/12773376.0L) - 23.0L/15966720.0L) + 1.0L/87091200.0L) + 139.0L/2903040.0L) - 149.0L/1935360.0L) - 1399.0L/2177280.0L) + 23.0L/16200.0L) + 6271.0L/1814400.0L) - 19787.0L/2395008.0L) - 2077.0L/332640.0L) + 51043.0L/3603600.0L) + 7.0L/3300.0L) - 7.0L/2145.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/191600640.0L)*x - 1.0L/17107200.0L) - 299.0L/718502400.0L) + 31.0L/4989600.0L) + 151.0L/26127360.0L) - 83.0L/362880.0L) + 1621.0L/7257600.0L) + 2363.0L/680400.0L) - 228653.0L/37324800.0L) - 73811.0L/3628800.0L) + 2960071.0L/71850240.0L) + 31957.0L/831600.0L) - 500287.0L/6652800.0L) - 7.0L/528.0L) + 7.0L/396.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/63866880.0L*x + 1.0L/6220800.0L) + 1391.0L/958003200.0L) - 131.0L/7257600.0L) - 3139.0L/87091200.0L) + 6283.0L/8709120.0L) - 1429.0L/9676800.0L) - 135073.0L/10886400.0L) + 11261.0L/777600.0L) + 157477.0L/1814400.0L) - 1642643.0L/11975040.0L) - 247081.0L/1360800.0L) + 239731.0L/831600.0L) + 7.0L/108.0L) - 7.0L/99.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/29030400.0L)*x - 1.0L/3110400.0L) - 13.0L/3628800.0L) + 17.0L/453600.0L) + 26081.0L/217728000.0L) - 1153.0L/725760.0L) - 2663.0L/2419200.0L) + 40987.0L/1360800.0L) - 267829.0L/20736000.0L) - 1819681.0L/7257600.0L) + 1055099.0L/4354560.0L) + 222581.0L/302400.0L) - 52889.0L/63000.0L) - 7.0L/24.0L) + 7.0L/30.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/17418240.0L*x + 1.0L/2073600.0L) + 1703.0L/261273600.0L) - 139.0L/2419200.0L) - 68321.0L/261273600.0L) + 2441.0L/967680.0L) + 17959.0L/4147200.0L) - 184297.0L/3628800.0L) - 1021.0L/46656.0L) + 286397.0L/604800.0L) - 333059.0L/3265920.0L) - 90281.0L/50400.0L) + 68231.0L/75600.0L) + 7.0L/4.0L) - 7.0L/9.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/13547520.0L)*x - 1.0L/1814400.0L) - 13.0L/1451520.0L) + 1.0L/15120.0L) + 5863.0L/14515200.0L) - 533.0L/181440.0L) - 9581.0L/1128960.0L) + 9581.0L/158760.0L) + 353639.0L/4147200.0L) - 353639.0L/604800.0L) - 54613.0L/145152.0L) + 54613.0L/22680.0L) + 266681.0L/470400.0L) - 266681.0L/88200.0L) - 1.0L/8.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/13547520.0L*x + 1.0L/2073600.0L) + 13.0L/1382400.0L) - 139.0L/2419200.0L) - 2651.0L/5806080.0L) + 2441.0L/967680.0L) + 242881.0L/22579200.0L) - 184297.0L/3628800.0L) - 11207.0L/86400.0L) + 286397.0L/604800.0L) + 279731.0L/362880.0L) - 90281.0L/50400.0L) - 112331.0L/58800.0L) + 7.0L/4.0L) + 1;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/17418240.0L)*x - 1.0L/3110400.0L) - 247.0L/32659200.0L) + 17.0L/453600.0L) + 50017.0L/130636800.0L) - 1153.0L/725760.0L) - 68659.0L/7257600.0L) + 40987.0L/1360800.0L) + 4442849.0L/37324800.0L) - 1819681.0L/7257600.0L) - 9281953.0L/13063680.0L) + 222581.0L/302400.0L) + 116803.0L/75600.0L) - 7.0L/24.0L) - 7.0L/18.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/29030400.0L*x + 1.0L/6220800.0L) + 403.0L/87091200.0L) - 131.0L/7257600.0L) - 103697.0L/435456000.0L) + 6283.0L/8709120.0L) + 57173.0L/9676800.0L) - 135073.0L/10886400.0L) - 70337.0L/972000.0L) + 157477.0L/1814400.0L) + 427361.0L/1088640.0L) - 247081.0L/1360800.0L) - 254431.0L/378000.0L) + 7.0L/108.0L) + 7.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/63866880.0L)*x - 1.0L/17107200.0L) - 169.0L/79833600.0L) + 31.0L/4989600.0L) + 4723.0L/43545600.0L) - 83.0L/362880.0L) - 6347.0L/2419200.0L) + 2363.0L/680400.0L) + 5017.0L/165888.0L) - 73811.0L/3628800.0L) - 3535297.0L/23950080.0L) + 31957.0L/831600.0L) + 522337.0L/2217600.0L) - 7.0L/528.0L) - 7.0L/132.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/191600640.0L*x + 1.0L/68428800.0L) + 403.0L/574801920.0L) - 23.0L/15966720.0L) - 9187.0L/261273600.0L) + 139.0L/2903040.0L) + 947.0L/1161216.0L) - 1399.0L/2177280.0L) - 20623.0L/2332800.0L) + 6271.0L/1814400.0L) + 294617.0L/7185024.0L) - 2077.0L/332640.0L) - 52807.0L/831600.0L) + 7.0L/3300.0L) + 7.0L/495.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/830269440.0L)*x - 1.0L/444787200.0L) - 19.0L/119750400.0L) + 1.0L/4989600.0L) + 67.0L/8709120.0L) - 13.0L/2177280.0L) - 59.0L/345600.0L) + 101.0L/1360800.0L) + 22159.0L/12441600.0L) - 2767.0L/7257600.0L) - 385381.0L/47900160.0L) + 20137.0L/29937600.0L) + 16591.0L/1351350.0L) - 7.0L/30888.0L) - 7.0L/2574.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/5811886080.0L*x + 1.0L/6227020800.0L) + 1.0L/45619200.0L) - 1.0L/79833600.0L) - 89.0L/87091200.0L) + 1.0L/2903040.0L) + 1487.0L/67737600.0L) - 311.0L/76204800.0L) - 29.0L/129600.0L) + 37.0L/1814400.0L) + 11927.0L/11975040.0L) - 59.0L/1663200.0L) - 38033.0L/25225200.0L) + 1.0L/84084.0L) + 1.0L/3003.0L;
-        poly_val[15] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/87178291200.0L)*pow(x, 2) - 1.0L/718502400.0L) + 41.0L/653184000.0L) - 67.0L/50803200.0L) + 2473.0L/186624000.0L) - 4201.0L/71850240.0L) + 266681.0L/3027024000.0L) - 1.0L/51480.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<7, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/6227020800.0L*x + 1.0L/479001600.0L) + 1.0L/239500800.0L) - 1.0L/7257600.0L) + 23.0L/130636800.0L) + 1.0L/322560.0L) - 173.0L/25401600.0L) - 311.0L/10886400.0L) + 137.0L/1944000.0L) + 37.0L/362880.0L) - 2173.0L/8981280.0L) - 59.0L/554400.0L) + 37133.0L/189189000.0L) + 1.0L/84084.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/415134720.0L)*x - 1.0L/34214400.0L) - 1.0L/9979200.0L) + 1.0L/453600.0L) - 1.0L/622080.0L) - 13.0L/241920.0L) + 211.0L/2116800.0L) + 101.0L/194400.0L) - 95.0L/82944.0L) - 2767.0L/1451520.0L) + 7043.0L/1710720.0L) + 20137.0L/9979200.0L) - 129053.0L/37837800.0L) - 7.0L/30888.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/59304960.0L*x + 13.0L/68428800.0L) + 1.0L/1064448.0L) - 23.0L/1451520.0L) + 1.0L/8709120.0L) + 139.0L/322560.0L) - 149.0L/241920.0L) - 1399.0L/311040.0L) + 23.0L/2700.0L) + 6271.0L/362880.0L) - 19787.0L/598752.0L) - 2077.0L/110880.0L) + 51043.0L/1801800.0L) + 7.0L/3300.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/13685760.0L)*x - 13.0L/17107200.0L) - 299.0L/59875200.0L) + 31.0L/453600.0L) + 151.0L/2612736.0L) - 83.0L/40320.0L) + 1621.0L/907200.0L) + 2363.0L/97200.0L) - 228653.0L/6220800.0L) - 73811.0L/725760.0L) + 2960071.0L/17962560.0L) + 31957.0L/277200.0L) - 500287.0L/3326400.0L) - 7.0L/528.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/4561920.0L*x + 13.0L/6220800.0L) + 1391.0L/79833600.0L) - 1441.0L/7257600.0L) - 3139.0L/8709120.0L) + 6283.0L/967680.0L) - 1429.0L/1209600.0L) - 135073.0L/1555200.0L) + 11261.0L/129600.0L) + 157477.0L/362880.0L) - 1642643.0L/2993760.0L) - 247081.0L/453600.0L) + 239731.0L/415800.0L) + 7.0L/108.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2073600.0L)*x - 13.0L/3110400.0L) - 13.0L/302400.0L) + 187.0L/453600.0L) + 26081.0L/21772800.0L) - 1153.0L/80640.0L) - 2663.0L/302400.0L) + 40987.0L/194400.0L) - 267829.0L/3456000.0L) - 1819681.0L/1451520.0L) + 1055099.0L/1088640.0L) + 222581.0L/100800.0L) - 52889.0L/31500.0L) - 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1244160.0L*x + 13.0L/2073600.0L) + 1703.0L/21772800.0L) - 1529.0L/2419200.0L) - 68321.0L/26127360.0L) + 2441.0L/107520.0L) + 17959.0L/518400.0L) - 184297.0L/518400.0L) - 1021.0L/7776.0L) + 286397.0L/120960.0L) - 333059.0L/816480.0L) - 90281.0L/16800.0L) + 68231.0L/37800.0L) + 7.0L/4.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/967680.0L)*x - 13.0L/1814400.0L) - 13.0L/120960.0L) + 11.0L/15120.0L) + 5863.0L/1451520.0L) - 533.0L/20160.0L) - 9581.0L/141120.0L) + 9581.0L/22680.0L) + 353639.0L/691200.0L) - 353639.0L/120960.0L) - 54613.0L/36288.0L) + 54613.0L/7560.0L) + 266681.0L/235200.0L) - 266681.0L/88200.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/967680.0L*x + 13.0L/2073600.0L) + 13.0L/115200.0L) - 1529.0L/2419200.0L) - 2651.0L/580608.0L) + 2441.0L/107520.0L) + 242881.0L/2822400.0L) - 184297.0L/518400.0L) - 11207.0L/14400.0L) + 286397.0L/120960.0L) + 279731.0L/90720.0L) - 90281.0L/16800.0L) - 112331.0L/29400.0L) + 7.0L/4.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/1244160.0L)*x - 13.0L/3110400.0L) - 247.0L/2721600.0L) + 187.0L/453600.0L) + 50017.0L/13063680.0L) - 1153.0L/80640.0L) - 68659.0L/907200.0L) + 40987.0L/194400.0L) + 4442849.0L/6220800.0L) - 1819681.0L/1451520.0L) - 9281953.0L/3265920.0L) + 222581.0L/100800.0L) + 116803.0L/37800.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2073600.0L*x + 13.0L/6220800.0L) + 403.0L/7257600.0L) - 1441.0L/7257600.0L) - 103697.0L/43545600.0L) + 6283.0L/967680.0L) + 57173.0L/1209600.0L) - 135073.0L/1555200.0L) - 70337.0L/162000.0L) + 157477.0L/362880.0L) + 427361.0L/272160.0L) - 247081.0L/453600.0L) - 254431.0L/189000.0L) + 7.0L/108.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/4561920.0L)*x - 13.0L/17107200.0L) - 169.0L/6652800.0L) + 31.0L/453600.0L) + 4723.0L/4354560.0L) - 83.0L/40320.0L) - 6347.0L/302400.0L) + 2363.0L/97200.0L) + 5017.0L/27648.0L) - 73811.0L/725760.0L) - 3535297.0L/5987520.0L) + 31957.0L/277200.0L) + 522337.0L/1108800.0L) - 7.0L/528.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/13685760.0L*x + 13.0L/68428800.0L) + 403.0L/47900160.0L) - 23.0L/1451520.0L) - 9187.0L/26127360.0L) + 139.0L/322560.0L) + 947.0L/145152.0L) - 1399.0L/311040.0L) - 20623.0L/388800.0L) + 6271.0L/362880.0L) + 294617.0L/1796256.0L) - 2077.0L/110880.0L) - 52807.0L/415800.0L) + 7.0L/3300.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/59304960.0L)*x - 1.0L/34214400.0L) - 19.0L/9979200.0L) + 1.0L/453600.0L) + 67.0L/870912.0L) - 13.0L/241920.0L) - 59.0L/43200.0L) + 101.0L/194400.0L) + 22159.0L/2073600.0L) - 2767.0L/1451520.0L) - 385381.0L/11975040.0L) + 20137.0L/9979200.0L) + 16591.0L/675675.0L) - 7.0L/30888.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/415134720.0L*x + 1.0L/479001600.0L) + 1.0L/3801600.0L) - 1.0L/7257600.0L) - 89.0L/8709120.0L) + 1.0L/322560.0L) + 1487.0L/8467200.0L) - 311.0L/10886400.0L) - 29.0L/21600.0L) + 37.0L/362880.0L) + 11927.0L/2993760.0L) - 59.0L/554400.0L) - 38033.0L/12612600.0L) + 1.0L/84084.0L;
-        poly_val[15] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/6227020800.0L)*pow(x, 2) - 1.0L/59875200.0L) + 41.0L/65318400.0L) - 67.0L/6350400.0L) + 2473.0L/31104000.0L) - 4201.0L/17962560.0L) + 266681.0L/1513512000.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<7, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n8(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n7<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n7<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<8, 0>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.8114572543455206e-15, 4.779477332387385e-14, -3.823581865909908e-13, 1.911790932954954e-12,
+         -6.6912682653423394e-12, 1.7397297489890082e-11, -3.4794594979780164e-11, 5.467722068251169e-11,
+         -6.834652585313961e-11, 6.834652585313961e-11, -5.467722068251169e-11, 3.4794594979780164e-11,
+         -1.7397297489890082e-11, 6.6912682653423394e-12, -1.911790932954954e-12, 3.823581865909908e-13,
+         -4.779477332387385e-14, 2.8114572543455206e-15},
+        {2.3897386661936926e-14, -3.584607999290539e-13, 2.4853282128414403e-12, -1.0514850131252248e-11,
+         3.0110707194040527e-11, -6.089054121461528e-11, 8.698648744945042e-11, -8.201583102376753e-11,
+         3.417326292656981e-11, 3.417326292656981e-11, -8.201583102376753e-11, 8.698648744945042e-11,
+         -6.089054121461528e-11, 3.0110707194040527e-11, -1.0514850131252248e-11, 2.4853282128414403e-12,
+         -3.584607999290539e-13, 2.3897386661936926e-14},
+        {4.779477332387385e-13, -8.889827838240537e-12, 7.647163731819816e-11, -4.0529967778645026e-10,
+         1.4854615549059994e-09, -4.001378422674719e-09, 8.211524415228119e-09, -1.3122532963802806e-08,
+         1.6539859256459784e-08, -1.6539859256459784e-08, 1.3122532963802806e-08, -8.211524415228119e-09,
+         4.001378422674719e-09, -1.4854615549059994e-09, 4.0529967778645026e-10, -7.647163731819816e-11,
+         8.889827838240537e-12, -4.779477332387385e-13},
+        {-4.062555732529278e-12, 6.667370878680402e-11, -4.970656425682881e-10, 2.2291482278254767e-09,
+         -6.684576997076997e-09, 1.4004824479361517e-08, -2.0528811038070297e-08, 1.968379944570421e-08,
+         -8.269929628229892e-09, -8.269929628229892e-09, 1.968379944570421e-08, -2.0528811038070297e-08,
+         1.4004824479361517e-08, -6.684576997076997e-09, 2.2291482278254767e-09, -4.970656425682881e-10,
+         6.667370878680402e-11, -4.062555732529278e-12},
+        {-3.153260170042578e-11, 6.230407163566886e-10, -5.7538215813678775e-09, 3.266342603726863e-08,
+         -1.2715249802923413e-07, 3.597891600640443e-07, -7.662900638884435e-07, 1.255293301734274e-06,
+         -1.601888786314423e-06, 1.601888786314423e-06, -1.255293301734274e-06, 7.662900638884435e-07,
+         -3.597891600640443e-07, 1.2715249802923413e-07, -3.266342603726863e-08, 5.7538215813678775e-09,
+         -6.230407163566886e-10, 3.153260170042578e-11},
+        {2.680271144536191e-10, -4.6728053726751645e-09, 3.73998402788912e-08, -1.7964884320497746e-07,
+         5.721862411315536e-07, -1.2592620602241552e-06, 1.915725159721109e-06, -1.8829399526014108e-06,
+         8.009443931572115e-07, 8.009443931572115e-07, -1.8829399526014108e-06, 1.915725159721109e-06,
+         -1.2592620602241552e-06, 5.721862411315536e-07, -1.7964884320497746e-07, 3.73998402788912e-08,
+         -4.6728053726751645e-09, 2.680271144536191e-10},
+        {1.0294695456629155e-09, -2.1184860019753787e-08, 2.067482407057473e-07, -1.2611673749653246e-06,
+         5.297487958982461e-06, -1.6060630503809033e-05, 3.614678252988438e-05, -6.150374003124913e-05,
+         8.000971525361045e-05, -8.000971525361045e-05, 6.150374003124913e-05, -3.614678252988438e-05,
+         1.6060630503809033e-05, -5.297487958982461e-06, 1.2611673749653246e-06, -2.067482407057473e-07,
+         2.1184860019753787e-08, -1.0294695456629155e-09},
+        {-8.75049113813478e-09, 1.588864501481534e-07, -1.3438635645873576e-06, 6.936420562309286e-06,
+         -2.3838695815421077e-05, 5.621220676333162e-05, -9.036695632471096e-05, 9.225561004687368e-05,
+         -4.0004857626805224e-05, -4.0004857626805224e-05, 9.225561004687368e-05, -9.036695632471096e-05,
+         5.621220676333162e-05, -2.3838695815421077e-05, 6.936420562309286e-06, -1.3438635645873576e-06,
+         1.588864501481534e-07, -8.75049113813478e-09},
+        {-1.7587963909562345e-08, 3.717929798118852e-07, -3.772417677566461e-06, 2.4387341144220354e-05,
+         -0.00011160765865983016, 0.00037234992988432434, -0.0009122679163001926, 0.0016501934961056423,
+         -0.0022157187101565384, 0.0022157187101565384, -0.0016501934961056423, 0.0009122679163001926,
+         -0.00037234992988432434, 0.00011160765865983016, -2.4387341144220354e-05, 3.772417677566461e-06,
+         -3.717929798118852e-07, 1.7587963909562345e-08},
+        {1.4949769323127994e-07, -2.788447348589139e-06, 2.4520714904181998e-05, -0.00013413037629321197,
+         0.0005022344639692357, -0.001303224754595135, 0.0022806697907504815, -0.0024752902441584636,
+         0.0011078593550782692, 0.0011078593550782692, -0.0024752902441584636, 0.0022806697907504815,
+         -0.001303224754595135, 0.0005022344639692357, -0.00013413037629321197, 2.4520714904181998e-05,
+         -2.788447348589139e-06, 1.4949769323127994e-07},
+        {1.530454191615261e-07, -3.2908336832473525e-06, 3.424886350414417e-05, -0.00023045048229397008,
+         0.0011285313438116648, -0.004249038081267413, 0.011918974967824568, -0.02397665661829209,
+         0.0340580603031231, -0.0340580603031231, 0.02397665661829209, -0.011918974967824568,
+         0.004249038081267413, -0.0011285313438116648, 0.00023045048229397008, -3.424886350414417e-05,
+         3.2908336832473525e-06, -1.530454191615261e-07},
+        {-1.300886062872972e-06, 2.4681252624355144e-05, -0.00022261761277693714, 0.0012674776526168353,
+         -0.005078391047152491, 0.014871633284435946, -0.02979743741956142, 0.03596498492743813,
+         -0.01702903015156155, -0.01702903015156155, 0.03596498492743813, -0.02979743741956142,
+         0.014871633284435946, -0.005078391047152491, 0.0012674776526168353, -0.00022261761277693714,
+         2.4681252624355144e-05, -1.300886062872972e-06},
+        {-6.082561828345134e-07, 1.3208996510667605e-05, -0.000139532646496558, 0.0009616085583406525,
+         -0.004911815054880154, 0.02013717789884674, -0.06988219523984154, 0.17292876213401367,
+         -0.27508078433068284, 0.27508078433068284, -0.17292876213401367, 0.06988219523984154,
+         -0.02013717789884674, 0.004911815054880154, -0.0009616085583406525, 0.000139532646496558,
+         -1.3208996510667605e-05, 6.082561828345134e-07},
+        {5.170177554093365e-06, -9.906747383000703e-05, 0.0009069622022276271, -0.005288847070873588,
+         0.022103167746960695, -0.0704801226459636, 0.17470548809960387, -0.2593931432010205,
+         0.13754039216534142, 0.13754039216534142, -0.2593931432010205, 0.17470548809960387,
+         -0.0704801226459636, 0.022103167746960695, -0.005288847070873588, 0.0009069622022276271,
+         -9.906747383000703e-05, 5.170177554093365e-06},
+        {8.478355009235256e-07, -1.849780635713835e-05, 0.00019677656617795298, -0.0013714955134829054,
+         0.00714628555018363, -0.030506975809044996, 0.11761108989082546, -0.4820707011324959,
+         1.0201803238348626, -1.0201803238348626, 0.4820707011324959, -0.11761108989082546,
+         0.030506975809044996, -0.00714628555018363, 0.0013714955134829054, -0.00019677656617795298,
+         1.849780635713835e-05, -8.478355009235256e-07},
+        {-7.206601757849968e-06, 0.00013873354767853763, -0.0012790476801566944, 0.00754322532415598,
+         -0.03215828497582634, 0.10677441533165749, -0.2940277247270636, 0.7231060516987438,
+         -0.5100901619174313, -0.5100901619174313, 0.7231060516987438, -0.2940277247270636,
+         0.10677441533165749, -0.03215828497582634, 0.00754322532415598, -0.0012790476801566944,
+         0.00013873354767853763, -7.206601757849968e-06},
+        {-1.7626649316619423e-07, 3.848876804113388e-06, -4.099395412665147e-05, 0.000286280092867938,
+         -0.001496785423821873, 0.006433122658303806, -0.025217840820550917, 0.1100778765976429,
+         -1.2383761117234826, 1.2383761117234826, -0.1100778765976429, 0.025217840820550917,
+         -0.006433122658303806, 0.001496785423821873, -0.000286280092867938, 4.099395412665147e-05,
+         -3.848876804113388e-06, 1.7626649316619423e-07},
+        {1.498265191912651e-06, -2.886657603085041e-05, 0.00026646070182323456, -0.0015745405107736588,
+         0.006735534407198429, -0.02251592930406332, 0.0630446020513773, -0.16511681489646435,
+         0.6191880558617413, 0.6191880558617413, -0.16511681489646435, 0.0630446020513773,
+         -0.02251592930406332, 0.006735534407198429, -0.0015745405107736588, 0.00026646070182323456,
+         -2.886657603085041e-05, 1.498265191912651e-06}};
+};
+constexpr double Lagrange_polynomials<8, 0>::coefficients[18][18];
+
+template <>
+struct Lagrange_polynomials<8, 1>
+{
+    static constexpr int degree = 16;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4.779477332387385e-14, 8.125111465058555e-13, -6.500089172046844e-12, 3.250044586023422e-11,
+         -1.1375156051081977e-10, 2.957540573281314e-10, -5.915081146562628e-10, 9.295127516026987e-10,
+         -1.1618909395033734e-09, 1.1618909395033734e-09, -9.295127516026987e-10, 5.915081146562628e-10,
+         -2.957540573281314e-10, 1.1375156051081977e-10, -3.250044586023422e-11, 6.500089172046844e-12,
+         -8.125111465058555e-13, 4.779477332387385e-14},
+        {3.823581865909908e-13, -5.735372798864862e-12, 3.9765251405463044e-11, -1.6823760210003597e-10,
+         4.817713151046484e-10, -9.742486594338446e-10, 1.3917837991912067e-09, -1.3122532963802805e-09,
+         5.467722068251169e-10, 5.467722068251169e-10, -1.3122532963802805e-09, 1.3917837991912067e-09,
+         -9.742486594338446e-10, 4.817713151046484e-10, -1.6823760210003597e-10, 3.9765251405463044e-11,
+         -5.735372798864862e-12, 3.823581865909908e-13},
+        {7.169215998581078e-12, -1.3334741757360805e-10, 1.1470745597729725e-09, -6.079495166796754e-09,
+         2.228192332358999e-08, -6.002067634012078e-08, 1.231728662284218e-07, -1.9683799445704207e-07,
+         2.480978888468968e-07, -2.480978888468968e-07, 1.9683799445704207e-07, -1.231728662284218e-07,
+         6.002067634012078e-08, -2.228192332358999e-08, 6.079495166796754e-09, -1.1470745597729725e-09,
+         1.3334741757360805e-10, -7.169215998581078e-12},
+        {-5.6875780255409884e-11, 9.334319230152564e-10, -6.958918995956033e-09, 3.1208075189556674e-08,
+         -9.358407795907796e-08, 1.9606754271106122e-07, -2.8740335453298414e-07, 2.755731922398589e-07,
+         -1.157790147952185e-07, -1.157790147952185e-07, 2.755731922398589e-07, -2.8740335453298414e-07,
+         1.9606754271106122e-07, -9.358407795907796e-08, 3.1208075189556674e-08, -6.958918995956033e-09,
+         9.334319230152564e-10, -5.6875780255409884e-11},
+        {-4.099238221055351e-10, 8.099529312636951e-09, -7.47996805577824e-08, 4.246245384844922e-07,
+         -1.6529824743800438e-06, 4.6772590808325765e-06, -9.961770830549765e-06, 1.631881292254556e-05,
+         -2.0824554222087497e-05, 2.0824554222087497e-05, -1.631881292254556e-05, 9.961770830549765e-06,
+         -4.6772590808325765e-06, 1.6529824743800438e-06, -4.246245384844922e-07, 7.47996805577824e-08,
+         -8.099529312636951e-09, 4.099238221055351e-10},
+        {3.216325373443429e-09, -5.6073664472101974e-08, 4.487980833466945e-07, -2.1557861184597297e-06,
+         6.866234893578644e-06, -1.5111144722689861e-05, 2.2988701916653304e-05, -2.259527943121693e-05,
+         9.611332717886537e-06, 9.611332717886537e-06, -2.259527943121693e-05, 2.2988701916653304e-05,
+         -1.5111144722689861e-05, 6.866234893578644e-06, -2.1557861184597297e-06, 4.487980833466945e-07,
+         -5.6073664472101974e-08, 3.216325373443429e-09},
+        {1.1324165002292069e-08, -2.3303346021729166e-07, 2.2742306477632204e-06, -1.3872841124618571e-05,
+         5.827236754880708e-05, -0.00017666693554189937, 0.0003976146078287282, -0.0006765411403437403,
+         0.0008801068677897149, -0.0008801068677897149, 0.0006765411403437403, -0.0003976146078287282,
+         0.00017666693554189937, -5.827236754880708e-05, 1.3872841124618571e-05, -2.2742306477632204e-06,
+         2.3303346021729166e-07, -1.1324165002292069e-08},
+        {-8.750491138134781e-08, 1.588864501481534e-06, -1.3438635645873576e-05, 6.936420562309286e-05,
+         -0.00023838695815421075, 0.0005621220676333162, -0.0009036695632471095, 0.0009225561004687369,
+         -0.00040004857626805223, -0.00040004857626805223, 0.0009225561004687369, -0.0009036695632471095,
+         0.0005621220676333162, -0.00023838695815421075, 6.936420562309286e-05, -1.3438635645873576e-05,
+         1.588864501481534e-06, -8.750491138134781e-08},
+        {-1.5829167518606112e-07, 3.346136818306967e-06, -3.395175909809815e-05, 0.0002194860702979832,
+         -0.0010044689279384714, 0.003351149368958919, -0.008210411246701733, 0.014851741464950781,
+         -0.019941468391408847, 0.019941468391408847, -0.014851741464950781, 0.008210411246701733,
+         -0.003351149368958919, 0.0010044689279384714, -0.0002194860702979832, 3.395175909809815e-05,
+         -3.346136818306967e-06, 1.5829167518606112e-07},
+        {1.1959815458502395e-06, -2.2307578788713112e-05, 0.00019616571923345599, -0.0010730430103456957,
+         0.004017875711753886, -0.01042579803676108, 0.018245358326003852, -0.01980232195326771,
+         0.008862874840626154, 0.008862874840626154, -0.01980232195326771, 0.018245358326003852,
+         -0.01042579803676108, 0.004017875711753886, -0.0010730430103456957, 0.00019616571923345599,
+         -2.2307578788713112e-05, 1.1959815458502395e-06},
+        {1.0713179341306828e-06, -2.3035835782731467e-05, 0.00023974204452900923, -0.0016131533760577906,
+         0.007899719406681653, -0.02974326656887189, 0.08343282477477197, -0.16783659632804462,
+         0.23840642212186167, -0.23840642212186167, 0.16783659632804462, -0.08343282477477197,
+         0.02974326656887189, -0.007899719406681653, 0.0016131533760577906, -0.00023974204452900923,
+         2.3035835782731467e-05, -1.0713179341306828e-06},
+        {-7.805316377237833e-06, 0.00014808751574613087, -0.0013357056766616227, 0.007604865915701012,
+         -0.030470346282914947, 0.08922979970661567, -0.1787846245173685, 0.2157899095646288,
+         -0.10217418090936929, -0.10217418090936929, 0.2157899095646288, -0.1787846245173685,
+         0.08922979970661567, -0.030470346282914947, 0.007604865915701012, -0.0013357056766616227,
+         0.00014808751574613087, -7.805316377237833e-06},
+        {-3.0412809141725673e-06, 6.604498255333803e-05, -0.00069766323248279, 0.004808042791703262,
+         -0.024559075274400773, 0.1006858894942337, -0.34941097619920775, 0.8646438106700683,
+         -1.375403921653414, 1.375403921653414, -0.8646438106700683, 0.34941097619920775,
+         -0.1006858894942337, 0.024559075274400773, -0.004808042791703262, 0.00069766323248279,
+         -6.604498255333803e-05, 3.0412809141725673e-06},
+        {2.068071021637346e-05, -0.0003962698953200281, 0.0036278488089105084, -0.021155388283494354,
+         0.08841267098784278, -0.2819204905838544, 0.6988219523984155, -1.037572572804082,
+         0.5501615686613657, 0.5501615686613657, -1.037572572804082, 0.6988219523984155,
+         -0.2819204905838544, 0.08841267098784278, -0.021155388283494354, 0.0036278488089105084,
+         -0.0003962698953200281, 2.068071021637346e-05},
+        {2.5435065027705767e-06, -5.5493419071415054e-05, 0.0005903296985338589, -0.004114486540448716,
+         0.02143885665055089, -0.09152092742713498, 0.35283326967247636, -1.4462121033974875,
+         3.060540971504588, -3.060540971504588, 1.4462121033974875, -0.35283326967247636,
+         0.09152092742713498, -0.02143885665055089, 0.004114486540448716, -0.0005903296985338589,
+         5.5493419071415054e-05, -2.5435065027705767e-06},
+        {-1.4413203515699936e-05, 0.00027746709535707525, -0.0025580953603133887, 0.01508645064831196,
+         -0.06431656995165268, 0.21354883066331498, -0.5880554494541272, 1.4462121033974875,
+         -1.0201803238348626, -1.0201803238348626, 1.4462121033974875, -0.5880554494541272,
+         0.21354883066331498, -0.06431656995165268, 0.01508645064831196, -0.0025580953603133887,
+         0.00027746709535707525, -1.4413203515699936e-05},
+        {-1.7626649316619423e-07, 3.848876804113388e-06, -4.099395412665147e-05, 0.000286280092867938,
+         -0.001496785423821873, 0.006433122658303806, -0.025217840820550917, 0.1100778765976429,
+         -1.2383761117234826, 1.2383761117234826, -0.1100778765976429, 0.025217840820550917,
+         -0.006433122658303806, 0.001496785423821873, -0.000286280092867938, 4.099395412665147e-05,
+         -3.848876804113388e-06, 1.7626649316619423e-07}};
+};
+constexpr double Lagrange_polynomials<8, 1>::coefficients[17][18];
+
+template <>
+struct Lagrange_polynomials<8, 2>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-7.647163731819816e-13, 1.3000178344093688e-11, -1.040014267527495e-10, 5.200071337637476e-10,
+         -1.8200249681731163e-09, 4.732064917250102e-09, -9.464129834500204e-09, 1.487220402564318e-08,
+         -1.8590255032053975e-08, 1.8590255032053975e-08, -1.487220402564318e-08, 9.464129834500204e-09,
+         -4.732064917250102e-09, 1.8200249681731163e-09, -5.200071337637476e-10, 1.040014267527495e-10,
+         -1.3000178344093688e-11, 7.647163731819816e-13},
+        {5.735372798864862e-12, -8.603059198297293e-11, 5.964787710819457e-10, -2.5235640315005394e-09,
+         7.226569726569726e-09, -1.4613729891507668e-08, 2.08767569878681e-08, -1.968379944570421e-08,
+         8.201583102376754e-09, 8.201583102376754e-09, -1.968379944570421e-08, 2.08767569878681e-08,
+         -1.4613729891507668e-08, 7.226569726569726e-09, -2.5235640315005394e-09, 5.964787710819457e-10,
+         -8.603059198297293e-11, 5.735372798864862e-12},
+        {1.0036902398013509e-10, -1.8668638460305127e-09, 1.6059043836821613e-08, -8.511293233515456e-08,
+         3.119469265302599e-07, -8.40289468761691e-07, 1.724420127197905e-06, -2.7557319223985893e-06,
+         3.473370443856555e-06, -3.473370443856555e-06, 2.7557319223985893e-06, -1.724420127197905e-06,
+         8.40289468761691e-07, -3.119469265302599e-07, 8.511293233515456e-08, -1.6059043836821613e-08,
+         1.8668638460305127e-09, -1.0036902398013509e-10},
+        {-7.393851433203285e-10, 1.2134614999198332e-08, -9.046594694742843e-08, 4.057049774642367e-07,
+         -1.2165930134680135e-06, 2.548878055243796e-06, -3.736243608928794e-06, 3.5824514991181657e-06,
+         -1.5051271923378405e-06, -1.5051271923378405e-06, 3.5824514991181657e-06, -3.736243608928794e-06,
+         2.548878055243796e-06, -1.2165930134680135e-06, 4.057049774642367e-07, -9.046594694742843e-08,
+         1.2134614999198332e-08, -7.393851433203285e-10},
+        {-4.919085865266421e-09, 9.719435175164342e-08, -8.97596166693389e-07, 5.095494461813906e-06,
+         -1.9835789692560525e-05, 5.6127108969990915e-05, -0.00011954124996659718, 0.00019582575507054673,
+         -0.00024989465066504996, 0.00024989465066504996, -0.00019582575507054673, 0.00011954124996659718,
+         -5.6127108969990915e-05, 1.9835789692560525e-05, -5.095494461813906e-06, 8.97596166693389e-07,
+         -9.719435175164342e-08, 4.919085865266421e-09},
+        {3.537957910787772e-08, -6.168103091931217e-07, 4.936778916813639e-06, -2.3713647303057026e-05,
+         7.552858382936507e-05, -0.0001662225919495885, 0.0002528757210831864, -0.00024854807374338625,
+         0.00010572465989675191, 0.00010572465989675191, -0.00024854807374338625, 0.0002528757210831864,
+         -0.0001662225919495885, 7.552858382936507e-05, -2.3713647303057026e-05, 4.936778916813639e-06,
+         -6.168103091931217e-07, 3.537957910787772e-08},
+        {1.1324165002292069e-07, -2.3303346021729166e-06, 2.2742306477632206e-05, -0.00013872841124618572,
+         0.0005827236754880707, -0.0017666693554189937, 0.003976146078287282, -0.006765411403437404,
+         0.008801068677897149, -0.008801068677897149, 0.006765411403437404, -0.003976146078287282,
+         0.0017666693554189937, -0.0005827236754880707, 0.00013872841124618572, -2.2742306477632206e-05,
+         2.3303346021729166e-06, -1.1324165002292069e-07},
+        {-7.875442024321303e-07, 1.4299780513333806e-05, -0.00012094772081286218, 0.0006242778506078357,
+         -0.0021454826233878966, 0.0050590986086998455, -0.008133026069223986, 0.008303004904218632,
+         -0.0036004371864124703, -0.0036004371864124703, 0.008303004904218632, -0.008133026069223986,
+         0.0050590986086998455, -0.0021454826233878966, 0.0006242778506078357, -0.00012094772081286218,
+         1.4299780513333806e-05, -7.875442024321303e-07},
+        {-1.266333401488489e-06, 2.6769094546455735e-05, -0.0002716140727847852, 0.0017558885623838655,
+         -0.008035751423507771, 0.02680919495167135, -0.06568328997361386, 0.11881393171960625,
+         -0.15953174713127077, 0.15953174713127077, -0.11881393171960625, 0.06568328997361386,
+         -0.02680919495167135, 0.008035751423507771, -0.0017558885623838655, 0.0002716140727847852,
+         -2.6769094546455735e-05, 1.266333401488489e-06},
+        {8.371870820951676e-06, -0.00015615305152099179, 0.001373160034634192, -0.007511301072419869,
+         0.0281251299822772, -0.07298058625732756, 0.12771750828202696, -0.13861625367287395,
+         0.062040123884383076, 0.062040123884383076, -0.13861625367287395, 0.12771750828202696,
+         -0.07298058625732756, 0.0281251299822772, -0.007511301072419869, 0.001373160034634192,
+         -0.00015615305152099179, 8.371870820951676e-06},
+        {6.427907604784097e-06, -0.0001382150146963888, 0.0014384522671740555, -0.009678920256346743,
+         0.04739831644008992, -0.17845959941323133, 0.5005969486486319, -1.0070195779682678,
+         1.43043853273117, -1.43043853273117, 1.0070195779682678, -0.5005969486486319,
+         0.17845959941323133, -0.04739831644008992, 0.009678920256346743, -0.0014384522671740555,
+         0.0001382150146963888, -6.427907604784097e-06},
+        {-3.902658188618916e-05, 0.0007404375787306543, -0.006678528383308114, 0.03802432957850506,
+         -0.15235173141457473, 0.4461489985330784, -0.8939231225868426, 1.0789495478231441,
+         -0.5108709045468465, -0.5108709045468465, 1.0789495478231441, -0.8939231225868426,
+         0.4461489985330784, -0.15235173141457473, 0.03802432957850506, -0.006678528383308114,
+         0.0007404375787306543, -3.902658188618916e-05},
+        {-1.216512365669027e-05, 0.0002641799302133521, -0.00279065292993116, 0.01923217116681305,
+         -0.09823630109760309, 0.4027435579769348, -1.397643904796831, 3.4585752426802734,
+         -5.501615686613656, 5.501615686613656, -3.4585752426802734, 1.397643904796831,
+         -0.4027435579769348, 0.09823630109760309, -0.01923217116681305, 0.00279065292993116,
+         -0.0002641799302133521, 1.216512365669027e-05},
+        {6.204213064912037e-05, -0.0011888096859600844, 0.010883546426731524, -0.06346616485048306,
+         0.26523801296352834, -0.845761471751563, 2.0964658571952466, -3.112717718412246,
+         1.6504847059840968, 1.6504847059840968, -3.112717718412246, 2.0964658571952466,
+         -0.845761471751563, 0.26523801296352834, -0.06346616485048306, 0.010883546426731524,
+         -0.0011888096859600844, 6.204213064912037e-05},
+        {5.0870130055411535e-06, -0.00011098683814283011, 0.0011806593970677178, -0.008228973080897432,
+         0.04287771330110178, -0.18304185485426996, 0.7056665393449527, -2.892424206794975,
+         6.121081943009176, -6.121081943009176, 2.892424206794975, -0.7056665393449527,
+         0.18304185485426996, -0.04287771330110178, 0.008228973080897432, -0.0011806593970677178,
+         0.00011098683814283011, -5.0870130055411535e-06},
+        {-1.4413203515699936e-05, 0.00027746709535707525, -0.0025580953603133887, 0.01508645064831196,
+         -0.06431656995165268, 0.21354883066331498, -0.5880554494541272, 1.4462121033974875,
+         -1.0201803238348626, -1.0201803238348626, 1.4462121033974875, -0.5880554494541272,
+         0.21354883066331498, -0.06431656995165268, 0.01508645064831196, -0.0025580953603133887,
+         0.00027746709535707525, -1.4413203515699936e-05}};
+};
+constexpr double Lagrange_polynomials<8, 2>::coefficients[16][18];
+
+template <class real_number>
+void beta_Lagrange_n8(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/355687428096000.0L*x + 1.0L/20922789888000.0L) + 1.0L/5230697472000.0L) - 1.0L/149448499200.0L) + 1.0L/135862272000.0L) + 41.0L/114960384000.0L) - 391.0L/402361344000.0L) - 67.0L/7315660800.0L) + 4657.0L/146313216000.0L) + 2473.0L/20901888000.0L) - 6583.0L/14370048000.0L) - 4201.0L/5748019200.0L) + 144689.0L/48432384000.0L) + 266681.0L/145297152000.0L) - 157.0L/20384000.0L) - 1.0L/823680.0L) + 1.0L/194480.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/20922789888000.0L)*x - 1.0L/1307674368000.0L) - 23.0L/5230697472000.0L) + 31.0L/261534873600.0L) - 67.0L/1494484992000.0L) - 97.0L/14370048000.0L) + 6143.0L/402361344000.0L) + 331.0L/1828915200.0L) - 82289.0L/146313216000.0L) - 2747.0L/1143072000.0L) + 244843.0L/28740096000.0L) + 2711.0L/179625600.0L) - 8287319.0L/145297152000.0L) - 21701.0L/567567000.0L) + 150307.0L/1009008000.0L) + 8.0L/315315.0L) - 1.0L/10010.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2615348736000.0L*x + 1.0L/174356582400.0L) + 19.0L/435891456000.0L) - 1.0L/1037836800.0L) - 31.0L/62270208000.0L) + 19.0L/319334400.0L) - 2543.0L/25147584000.0L) - 517.0L/304819200.0L) + 27683.0L/6096384000.0L) + 1363.0L/58060800.0L) - 356513.0L/4790016000.0L) - 24149.0L/159667200.0L) + 169537087.0L/326918592000.0L) + 1058149.0L/2724321600.0L) - 3135247.0L/2270268000.0L) - 1.0L/3861.0L) + 2.0L/2145.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/523069747200.0L)*x - 1.0L/37362124800.0L) - 67.0L/261534873600.0L) + 179.0L/37362124800.0L) + 139.0L/18681062400.0L) - 919.0L/2874009600.0L) + 6427.0L/20118067200.0L) + 2591.0L/261273600.0L) - 78299.0L/3657830400.0L) - 4787.0L/32659200.0L) + 287941.0L/718502400.0L) + 176989.0L/179625600.0L) - 401207.0L/134534400.0L) - 41981.0L/16216200.0L) + 68923.0L/8408400.0L) + 56.0L/32175.0L) - 4.0L/715.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/149448499200.0L*x + 1.0L/11496038400.0L) + 19.0L/18681062400.0L) - 47.0L/2874009600.0L) - 3323.0L/74724249600.0L) + 6707.0L/5748019200.0L) - 109.0L/574801920.0L) - 10331.0L/261273600.0L) + 2489.0L/41803776.0L) + 678739.0L/1045094400.0L) - 4125323.0L/2874009600.0L) - 6782981.0L/1437004800.0L) + 12532313.0L/1037836800.0L) + 1033649.0L/79833600.0L) - 1014049.0L/28828800.0L) - 7.0L/792.0L) + 7.0L/286.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/57480192000.0L)*x - 1.0L/4790016000.0L) - 1.0L/342144000.0L) + 13.0L/319334400.0L) + 1567.0L/9580032000.0L) - 4889.0L/1596672000.0L) - 2521.0L/1026432000.0L) + 9767.0L/87091200.0L) - 139379.0L/1741824000.0L) - 37517.0L/18144000.0L) + 7618319.0L/2395008000.0L) + 352423.0L/19958400.0L) - 126741731.0L/3592512000.0L) - 999349.0L/18711000.0L) + 2919647.0L/24948000.0L) + 56.0L/1485.0L) - 14.0L/165.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/28740096000.0L*x + 1.0L/2612736000.0L) + 13.0L/2052864000.0L) - 1.0L/13063680.0L) - 6011.0L/14370048000.0L) + 7811.0L/1306368000.0L) + 2543.0L/224532000.0L) - 6067.0L/26127360.0L) - 126523.0L/2612736000.0L) + 12312353.0L/2612736000.0L) - 48574927.0L/14370048000.0L) - 248945.0L/5225472.0L) + 7969111.0L/133056000.0L) + 901349.0L/4536000.0L) - 287383.0L/924000.0L) - 7.0L/45.0L) + 14.0L/55.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/18289152000.0L)*x - 1.0L/1828915200.0L) - 97.0L/9144576000.0L) + 29.0L/261273600.0L) + 257.0L/326592000.0L) - 331.0L/37324800.0L) - 253499.0L/9144576000.0L) + 652969.0L/1828915200.0L) + 8209463.0L/18289152000.0L) - 251539.0L/32659200.0L) - 586787.0L/326592000.0L) + 203617.0L/2332800.0L) - 4022849.0L/127008000.0L) - 372149.0L/793800.0L) + 293749.0L/882000.0L) + 8.0L/9.0L) - 4.0L/5.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/14631321600.0L*x + 1.0L/1625702400.0L) + 17.0L/1219276800.0L) - 17.0L/135475200.0L) - 391.0L/348364800.0L) + 391.0L/38707200.0L) + 167297.0L/3657830400.0L) - 167297.0L/406425600.0L) - 4913051.0L/4877107200.0L) + 4913051.0L/541900800.0L) + 1034059.0L/87091200.0L) - 1034059.0L/9676800.0L) - 63566689.0L/914457600.0L) + 63566689.0L/101606400.0L) + 1077749.0L/6350400.0L) - 1077749.0L/705600.0L) - 1.0L/9.0L) + 1;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/14631321600.0L)*x - 1.0L/1828915200.0L) - 53.0L/3657830400.0L) + 29.0L/261273600.0L) + 1289.0L/1045094400.0L) - 331.0L/37324800.0L) - 39947.0L/731566080.0L) + 652969.0L/1828915200.0L) + 3992581.0L/2926264320.0L) - 251539.0L/32659200.0L) - 5114489.0L/261273600.0L) + 203617.0L/2332800.0L) + 5310539.0L/33868800.0L) - 372149.0L/793800.0L) - 50061.0L/78400.0L) + 8.0L/9.0L) + 1);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/18289152000.0L*x + 1.0L/2612736000.0L) + 109.0L/9144576000.0L) - 1.0L/13063680.0L) - 1373.0L/1306368000.0L) + 7811.0L/1306368000.0L) + 110987.0L/2286144000.0L) - 6067.0L/26127360.0L) - 23232953.0L/18289152000.0L) + 12312353.0L/2612736000.0L) + 24721061.0L/1306368000.0L) - 248945.0L/5225472.0L) - 38328917.0L/254016000.0L) + 901349.0L/4536000.0L) + 940549.0L/1764000.0L) - 7.0L/45.0L) - 2.0L/5.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/28740096000.0L)*x - 1.0L/4790016000.0L) - 37.0L/4790016000.0L) + 13.0L/319334400.0L) + 151.0L/217728000.0L) - 4889.0L/1596672000.0L) - 466597.0L/14370048000.0L) + 9767.0L/87091200.0L) + 739651.0L/870912000.0L) - 37517.0L/18144000.0L) - 14666779.0L/1197504000.0L) + 352423.0L/19958400.0L) + 158720899.0L/1796256000.0L) - 999349.0L/18711000.0L) - 279677.0L/1134000.0L) + 56.0L/1485.0L) + 28.0L/165.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/57480192000.0L*x + 1.0L/11496038400.0L) + 1.0L/256608000.0L) - 47.0L/2874009600.0L) - 10091.0L/28740096000.0L) + 6707.0L/5748019200.0L) + 33481.0L/2052864000.0L) - 10331.0L/261273600.0L) - 2166403.0L/5225472000.0L) + 678739.0L/1045094400.0L) + 80761123.0L/14370048000.0L) - 6782981.0L/1437004800.0L) - 1622179.0L/44352000.0L) + 1033649.0L/79833600.0L) + 351083.0L/3696000.0L) - 7.0L/792.0L) - 7.0L/110.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/149448499200.0L)*x - 1.0L/37362124800.0L) - 1.0L/667180800.0L) + 179.0L/37362124800.0L) + 10001.0L/74724249600.0L) - 919.0L/2874009600.0L) - 2183.0L/359251200.0L) + 2591.0L/261273600.0L) + 154891.0L/1045094400.0L) - 4787.0L/32659200.0L) - 2723543.0L/1437004800.0L) + 176989.0L/179625600.0L) + 12175981.0L/1037836800.0L) - 41981.0L/16216200.0L) - 213041.0L/7207200.0L) + 56.0L/32175.0L) + 14.0L/715.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/523069747200.0L*x + 1.0L/174356582400.0L) + 37.0L/87178291200.0L) - 1.0L/1037836800.0L) - 463.0L/12454041600.0L) + 19.0L/319334400.0L) + 823.0L/502951680.0L) - 517.0L/304819200.0L) - 9353.0L/243855360.0L) + 1363.0L/58060800.0L) + 453109.0L/958003200.0L) - 24149.0L/159667200.0L) - 186467471.0L/65383718400.0L) + 1058149.0L/2724321600.0L) + 3213647.0L/454053600.0L) - 1.0L/3861.0L) - 2.0L/429.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2615348736000.0L)*x - 1.0L/1307674368000.0L) - 109.0L/1307674368000.0L) + 31.0L/261534873600.0L) + 83.0L/11675664000.0L) - 97.0L/14370048000.0L) - 30491.0L/100590336000.0L) + 331.0L/1828915200.0L) + 126241.0L/18289152000.0L) - 2747.0L/1143072000.0L) - 299063.0L/3592512000.0L) + 2711.0L/179625600.0L) + 2993917.0L/6054048000.0L) - 21701.0L/567567000.0L) - 51169.0L/42042000.0L) + 8.0L/315315.0L) + 4.0L/5005.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/20922789888000.0L*x + 1.0L/20922789888000.0L) + 53.0L/5230697472000.0L) - 1.0L/149448499200.0L) - 179.0L/213497856000.0L) + 41.0L/114960384000.0L) + 14017.0L/402361344000.0L) - 67.0L/7315660800.0L) - 113791.0L/146313216000.0L) + 2473.0L/20901888000.0L) + 4747.0L/513216000.0L) - 4201.0L/5748019200.0L) - 7912501.0L/145297152000.0L) + 266681.0L/145297152000.0L) + 269131.0L/2018016000.0L) - 1.0L/823680.0L) - 1.0L/11440.0L);
-        poly_val[17] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/355687428096000.0L)*pow(x, 2) - 1.0L/1743565824000.0L) + 23.0L/498161664000.0L) - 757.0L/402361344000.0L) + 2021.0L/48771072000.0L) - 4679.0L/9580032000.0L) + 3739217.0L/1307674368000.0L) - 63397.0L/9081072000.0L) + 1.0L/218790.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<8, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/20922789888000.0L*x + 1.0L/1307674368000.0L) + 1.0L/348713164800.0L) - 1.0L/10674892800.0L) + 1.0L/10450944000.0L) + 41.0L/9580032000.0L) - 391.0L/36578304000.0L) - 67.0L/731566080.0L) + 4657.0L/16257024000.0L) + 2473.0L/2612736000.0L) - 6583.0L/2052864000.0L) - 4201.0L/958003200.0L) + 144689.0L/9686476800.0L) + 266681.0L/36324288000.0L) - 471.0L/20384000.0L) - 1.0L/411840.0L) + 1.0L/194480.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/20922789888000.0L)*x - 1.0L/81729648000.0L) - 23.0L/348713164800.0L) + 31.0L/18681062400.0L) - 67.0L/114960384000.0L) - 97.0L/1197504000.0L) + 6143.0L/36578304000.0L) + 331.0L/182891520.0L) - 82289.0L/16257024000.0L) - 2747.0L/142884000.0L) + 244843.0L/4105728000.0L) + 2711.0L/29937600.0L) - 8287319.0L/29059430400.0L) - 21701.0L/141891750.0L) + 150307.0L/336336000.0L) + 16.0L/315315.0L) - 1.0L/10010.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/2615348736000.0L*x + 1.0L/10897286400.0L) + 19.0L/29059430400.0L) - 1.0L/74131200.0L) - 31.0L/4790016000.0L) + 19.0L/26611200.0L) - 2543.0L/2286144000.0L) - 517.0L/30481920.0L) + 27683.0L/677376000.0L) + 1363.0L/7257600.0L) - 356513.0L/684288000.0L) - 24149.0L/26611200.0L) + 169537087.0L/65383718400.0L) + 1058149.0L/681080400.0L) - 3135247.0L/756756000.0L) - 2.0L/3861.0L) + 2.0L/2145.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/523069747200.0L)*x - 1.0L/2335132800.0L) - 67.0L/17435658240.0L) + 179.0L/2668723200.0L) + 139.0L/1437004800.0L) - 919.0L/239500800.0L) + 6427.0L/1828915200.0L) + 2591.0L/26127360.0L) - 78299.0L/406425600.0L) - 4787.0L/4082400.0L) + 287941.0L/102643200.0L) + 176989.0L/29937600.0L) - 401207.0L/26906880.0L) - 41981.0L/4054050.0L) + 68923.0L/2802800.0L) + 112.0L/32175.0L) - 4.0L/715.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/149448499200.0L*x + 1.0L/718502400.0L) + 19.0L/1245404160.0L) - 47.0L/205286400.0L) - 3323.0L/5748019200.0L) + 6707.0L/479001600.0L) - 109.0L/52254720.0L) - 10331.0L/26127360.0L) + 2489.0L/4644864.0L) + 678739.0L/130636800.0L) - 4125323.0L/410572800.0L) - 6782981.0L/239500800.0L) + 12532313.0L/207567360.0L) + 1033649.0L/19958400.0L) - 1014049.0L/9609600.0L) - 7.0L/396.0L) + 7.0L/286.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/57480192000.0L)*x - 1.0L/299376000.0L) - 1.0L/22809600.0L) + 13.0L/22809600.0L) + 20371.0L/9580032000.0L) - 4889.0L/133056000.0L) - 2521.0L/93312000.0L) + 9767.0L/8709120.0L) - 139379.0L/193536000.0L) - 37517.0L/2268000.0L) + 7618319.0L/342144000.0L) + 352423.0L/3326400.0L) - 126741731.0L/718502400.0L) - 999349.0L/4677750.0L) + 2919647.0L/8316000.0L) + 112.0L/1485.0L) - 14.0L/165.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/28740096000.0L*x + 1.0L/163296000.0L) + 13.0L/136857600.0L) - 1.0L/933120.0L) - 78143.0L/14370048000.0L) + 7811.0L/108864000.0L) + 2543.0L/20412000.0L) - 6067.0L/2612736.0L) - 126523.0L/290304000.0L) + 12312353.0L/326592000.0L) - 48574927.0L/2052864000.0L) - 248945.0L/870912.0L) + 7969111.0L/26611200.0L) + 901349.0L/1134000.0L) - 287383.0L/308000.0L) - 14.0L/45.0L) + 14.0L/55.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/18289152000.0L)*x - 1.0L/114307200.0L) - 97.0L/609638400.0L) + 29.0L/18662400.0L) + 3341.0L/326592000.0L) - 331.0L/3110400.0L) - 2788489.0L/9144576000.0L) + 652969.0L/182891520.0L) + 8209463.0L/2032128000.0L) - 251539.0L/4082400.0L) - 586787.0L/46656000.0L) + 203617.0L/388800.0L) - 4022849.0L/25401600.0L) - 372149.0L/198450.0L) + 293749.0L/294000.0L) + 16.0L/9.0L) - 4.0L/5.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/14631321600.0L*x + 1.0L/101606400.0L) + 17.0L/81285120.0L) - 17.0L/9676800.0L) - 5083.0L/348364800.0L) + 391.0L/3225600.0L) + 1840267.0L/3657830400.0L) - 167297.0L/40642560.0L) - 4913051.0L/541900800.0L) + 4913051.0L/67737600.0L) + 1034059.0L/12441600.0L) - 1034059.0L/1612800.0L) - 63566689.0L/182891520.0L) + 63566689.0L/25401600.0L) + 1077749.0L/2116800.0L) - 1077749.0L/352800.0L) - 1.0L/9.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/14631321600.0L)*x - 1.0L/114307200.0L) - 53.0L/243855360.0L) + 29.0L/18662400.0L) + 16757.0L/1045094400.0L) - 331.0L/3110400.0L) - 439417.0L/731566080.0L) + 652969.0L/182891520.0L) + 3992581.0L/325140480.0L) - 251539.0L/4082400.0L) - 5114489.0L/37324800.0L) + 203617.0L/388800.0L) + 5310539.0L/6773760.0L) - 372149.0L/198450.0L) - 150183.0L/78400.0L) + 16.0L/9.0L) + 1;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/18289152000.0L*x + 1.0L/163296000.0L) + 109.0L/609638400.0L) - 1.0L/933120.0L) - 17849.0L/1306368000.0L) + 7811.0L/108864000.0L) + 1220857.0L/2286144000.0L) - 6067.0L/2612736.0L) - 23232953.0L/2032128000.0L) + 12312353.0L/326592000.0L) + 24721061.0L/186624000.0L) - 248945.0L/870912.0L) - 38328917.0L/50803200.0L) + 901349.0L/1134000.0L) + 940549.0L/588000.0L) - 14.0L/45.0L) - 2.0L/5.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/28740096000.0L)*x - 1.0L/299376000.0L) - 37.0L/319334400.0L) + 13.0L/22809600.0L) + 1963.0L/217728000.0L) - 4889.0L/133056000.0L) - 466597.0L/1306368000.0L) + 9767.0L/8709120.0L) + 739651.0L/96768000.0L) - 37517.0L/2268000.0L) - 14666779.0L/171072000.0L) + 352423.0L/3326400.0L) + 158720899.0L/359251200.0L) - 999349.0L/4677750.0L) - 279677.0L/378000.0L) + 112.0L/1485.0L) + 28.0L/165.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/57480192000.0L*x + 1.0L/718502400.0L) + 1.0L/17107200.0L) - 47.0L/205286400.0L) - 131183.0L/28740096000.0L) + 6707.0L/479001600.0L) + 33481.0L/186624000.0L) - 10331.0L/26127360.0L) - 2166403.0L/580608000.0L) + 678739.0L/130636800.0L) + 80761123.0L/2052864000.0L) - 6782981.0L/239500800.0L) - 1622179.0L/8870400.0L) + 1033649.0L/19958400.0L) + 351083.0L/1232000.0L) - 7.0L/396.0L) - 7.0L/110.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/149448499200.0L)*x - 1.0L/2335132800.0L) - 1.0L/44478720.0L) + 179.0L/2668723200.0L) + 10001.0L/5748019200.0L) - 919.0L/239500800.0L) - 2183.0L/32659200.0L) + 2591.0L/26127360.0L) + 154891.0L/116121600.0L) - 4787.0L/4082400.0L) - 2723543.0L/205286400.0L) + 176989.0L/29937600.0L) + 12175981.0L/207567360.0L) - 41981.0L/4054050.0L) - 213041.0L/2402400.0L) + 112.0L/32175.0L) + 14.0L/715.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/523069747200.0L*x + 1.0L/10897286400.0L) + 37.0L/5811886080.0L) - 1.0L/74131200.0L) - 463.0L/958003200.0L) + 19.0L/26611200.0L) + 823.0L/45722880.0L) - 517.0L/30481920.0L) - 9353.0L/27095040.0L) + 1363.0L/7257600.0L) + 453109.0L/136857600.0L) - 24149.0L/26611200.0L) - 186467471.0L/13076743680.0L) + 1058149.0L/681080400.0L) + 3213647.0L/151351200.0L) - 2.0L/3861.0L) - 2.0L/429.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/2615348736000.0L)*x - 1.0L/81729648000.0L) - 109.0L/87178291200.0L) + 31.0L/18681062400.0L) + 83.0L/898128000.0L) - 97.0L/1197504000.0L) - 30491.0L/9144576000.0L) + 331.0L/182891520.0L) + 126241.0L/2032128000.0L) - 2747.0L/142884000.0L) - 299063.0L/513216000.0L) + 2711.0L/29937600.0L) + 2993917.0L/1210809600.0L) - 21701.0L/141891750.0L) - 51169.0L/14014000.0L) + 16.0L/315315.0L) + 4.0L/5005.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/20922789888000.0L*x + 1.0L/1307674368000.0L) + 53.0L/348713164800.0L) - 1.0L/10674892800.0L) - 179.0L/16422912000.0L) + 41.0L/9580032000.0L) + 14017.0L/36578304000.0L) - 67.0L/731566080.0L) - 113791.0L/16257024000.0L) + 2473.0L/2612736000.0L) + 33229.0L/513216000.0L) - 4201.0L/958003200.0L) - 7912501.0L/29059430400.0L) + 266681.0L/36324288000.0L) + 269131.0L/672672000.0L) - 1.0L/411840.0L) - 1.0L/11440.0L;
-        poly_val[17] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/20922789888000.0L)*pow(x, 2) - 1.0L/116237721600.0L) + 23.0L/38320128000.0L) - 757.0L/36578304000.0L) + 2021.0L/5419008000.0L) - 4679.0L/1368576000.0L) + 3739217.0L/261534873600.0L) - 63397.0L/3027024000.0L) + 1.0L/218790.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<8, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1307674368000.0L*x + 1.0L/87178291200.0L) + 1.0L/24908083200.0L) - 1.0L/821145600.0L) + 1.0L/870912000.0L) + 41.0L/870912000.0L) - 391.0L/3657830400.0L) - 67.0L/81285120.0L) + 4657.0L/2032128000.0L) + 2473.0L/373248000.0L) - 6583.0L/342144000.0L) - 4201.0L/191600640.0L) + 144689.0L/2421619200.0L) + 266681.0L/12108096000.0L) - 471.0L/10192000.0L) - 1.0L/411840.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/1307674368000.0L)*x - 1.0L/5448643200.0L) - 23.0L/24908083200.0L) + 31.0L/1437004800.0L) - 67.0L/9580032000.0L) - 97.0L/108864000.0L) + 6143.0L/3657830400.0L) + 331.0L/20321280.0L) - 82289.0L/2032128000.0L) - 2747.0L/20412000.0L) + 244843.0L/684288000.0L) + 2711.0L/5987520.0L) - 8287319.0L/7264857600.0L) - 21701.0L/47297250.0L) + 150307.0L/168168000.0L) + 16.0L/315315.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/163459296000.0L*x + 1.0L/726485760.0L) + 19.0L/2075673600.0L) - 1.0L/5702400.0L) - 31.0L/399168000.0L) + 19.0L/2419200.0L) - 2543.0L/228614400.0L) - 517.0L/3386880.0L) + 27683.0L/84672000.0L) + 1363.0L/1036800.0L) - 356513.0L/114048000.0L) - 24149.0L/5322240.0L) + 169537087.0L/16345929600.0L) + 1058149.0L/227026800.0L) - 3135247.0L/378378000.0L) - 2.0L/3861.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/32691859200.0L)*x - 1.0L/155675520.0L) - 67.0L/1245404160.0L) + 179.0L/205286400.0L) + 139.0L/119750400.0L) - 919.0L/21772800.0L) + 6427.0L/182891520.0L) + 2591.0L/2903040.0L) - 78299.0L/50803200.0L) - 4787.0L/583200.0L) + 287941.0L/17107200.0L) + 176989.0L/5987520.0L) - 401207.0L/6726720.0L) - 41981.0L/1351350.0L) + 68923.0L/1401400.0L) + 112.0L/32175.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/9340531200.0L*x + 1.0L/47900160.0L) + 19.0L/88957440.0L) - 611.0L/205286400.0L) - 3323.0L/479001600.0L) + 6707.0L/43545600.0L) - 109.0L/5225472.0L) - 10331.0L/2903040.0L) + 2489.0L/580608.0L) + 678739.0L/18662400.0L) - 4125323.0L/68428800.0L) - 6782981.0L/47900160.0L) + 12532313.0L/51891840.0L) + 1033649.0L/6652800.0L) - 1014049.0L/4804800.0L) - 7.0L/396.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/3592512000.0L)*x - 1.0L/19958400.0L) - 7.0L/11404800.0L) + 169.0L/22809600.0L) + 20371.0L/798336000.0L) - 4889.0L/12096000.0L) - 2521.0L/9331200.0L) + 9767.0L/967680.0L) - 139379.0L/24192000.0L) - 37517.0L/324000.0L) + 7618319.0L/57024000.0L) + 352423.0L/665280.0L) - 126741731.0L/179625600.0L) - 999349.0L/1559250.0L) + 2919647.0L/4158000.0L) + 112.0L/1485.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/1796256000.0L*x + 1.0L/10886400.0L) + 91.0L/68428800.0L) - 13.0L/933120.0L) - 78143.0L/1197504000.0L) + 85921.0L/108864000.0L) + 2543.0L/2041200.0L) - 6067.0L/290304.0L) - 126523.0L/36288000.0L) + 12312353.0L/46656000.0L) - 48574927.0L/342144000.0L) - 1244725.0L/870912.0L) + 7969111.0L/6652800.0L) + 901349.0L/378000.0L) - 287383.0L/154000.0L) - 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/1143072000.0L)*x - 1.0L/7620480.0L) - 97.0L/43545600.0L) + 377.0L/18662400.0L) + 3341.0L/27216000.0L) - 3641.0L/3110400.0L) - 2788489.0L/914457600.0L) + 652969.0L/20321280.0L) + 8209463.0L/254016000.0L) - 251539.0L/583200.0L) - 586787.0L/7776000.0L) + 203617.0L/77760.0L) - 4022849.0L/6350400.0L) - 372149.0L/66150.0L) + 293749.0L/147000.0L) + 16.0L/9.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/914457600.0L*x + 1.0L/6773760.0L) + 17.0L/5806080.0L) - 221.0L/9676800.0L) - 5083.0L/29030400.0L) + 4301.0L/3225600.0L) + 1840267.0L/365783040.0L) - 167297.0L/4515840.0L) - 4913051.0L/67737600.0L) + 4913051.0L/9676800.0L) + 1034059.0L/2073600.0L) - 1034059.0L/322560.0L) - 63566689.0L/45722880.0L) + 63566689.0L/8467200.0L) + 1077749.0L/1058400.0L) - 1077749.0L/352800.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/914457600.0L)*x - 1.0L/7620480.0L) - 53.0L/17418240.0L) + 377.0L/18662400.0L) + 16757.0L/87091200.0L) - 3641.0L/3110400.0L) - 439417.0L/73156608.0L) + 652969.0L/20321280.0L) + 3992581.0L/40642560.0L) - 251539.0L/583200.0L) - 5114489.0L/6220800.0L) + 203617.0L/77760.0L) + 5310539.0L/1693440.0L) - 372149.0L/66150.0L) - 150183.0L/39200.0L) + 16.0L/9.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/1143072000.0L*x + 1.0L/10886400.0L) + 109.0L/43545600.0L) - 13.0L/933120.0L) - 17849.0L/108864000.0L) + 85921.0L/108864000.0L) + 1220857.0L/228614400.0L) - 6067.0L/290304.0L) - 23232953.0L/254016000.0L) + 12312353.0L/46656000.0L) + 24721061.0L/31104000.0L) - 1244725.0L/870912.0L) - 38328917.0L/12700800.0L) + 901349.0L/378000.0L) + 940549.0L/294000.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/1796256000.0L)*x - 1.0L/19958400.0L) - 37.0L/22809600.0L) + 169.0L/22809600.0L) + 1963.0L/18144000.0L) - 4889.0L/12096000.0L) - 466597.0L/130636800.0L) + 9767.0L/967680.0L) + 739651.0L/12096000.0L) - 37517.0L/324000.0L) - 14666779.0L/28512000.0L) + 352423.0L/665280.0L) + 158720899.0L/89812800.0L) - 999349.0L/1559250.0L) - 279677.0L/189000.0L) + 112.0L/1485.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/3592512000.0L*x + 1.0L/47900160.0L) + 7.0L/8553600.0L) - 611.0L/205286400.0L) - 131183.0L/2395008000.0L) + 6707.0L/43545600.0L) + 33481.0L/18662400.0L) - 10331.0L/2903040.0L) - 2166403.0L/72576000.0L) + 678739.0L/18662400.0L) + 80761123.0L/342144000.0L) - 6782981.0L/47900160.0L) - 1622179.0L/2217600.0L) + 1033649.0L/6652800.0L) + 351083.0L/616000.0L) - 7.0L/396.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/9340531200.0L)*x - 1.0L/155675520.0L) - 7.0L/22239360.0L) + 179.0L/205286400.0L) + 10001.0L/479001600.0L) - 919.0L/21772800.0L) - 2183.0L/3265920.0L) + 2591.0L/2903040.0L) + 154891.0L/14515200.0L) - 4787.0L/583200.0L) - 2723543.0L/34214400.0L) + 176989.0L/5987520.0L) + 12175981.0L/51891840.0L) - 41981.0L/1351350.0L) - 213041.0L/1201200.0L) + 112.0L/32175.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/32691859200.0L*x + 1.0L/726485760.0L) + 37.0L/415134720.0L) - 1.0L/5702400.0L) - 463.0L/79833600.0L) + 19.0L/2419200.0L) + 823.0L/4572288.0L) - 517.0L/3386880.0L) - 9353.0L/3386880.0L) + 1363.0L/1036800.0L) + 453109.0L/22809600.0L) - 24149.0L/5322240.0L) - 186467471.0L/3269185920.0L) + 1058149.0L/227026800.0L) + 3213647.0L/75675600.0L) - 2.0L/3861.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17.0L/163459296000.0L)*x - 1.0L/5448643200.0L) - 109.0L/6227020800.0L) + 31.0L/1437004800.0L) + 83.0L/74844000.0L) - 97.0L/108864000.0L) - 30491.0L/914457600.0L) + 331.0L/20321280.0L) + 126241.0L/254016000.0L) - 2747.0L/20412000.0L) - 299063.0L/85536000.0L) + 2711.0L/5987520.0L) + 2993917.0L/302702400.0L) - 21701.0L/47297250.0L) - 51169.0L/7007000.0L) + 16.0L/315315.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17.0L/1307674368000.0L*x + 1.0L/87178291200.0L) + 53.0L/24908083200.0L) - 1.0L/821145600.0L) - 179.0L/1368576000.0L) + 41.0L/870912000.0L) + 14017.0L/3657830400.0L) - 67.0L/81285120.0L) - 113791.0L/2032128000.0L) + 2473.0L/373248000.0L) + 33229.0L/85536000.0L) - 4201.0L/191600640.0L) - 7912501.0L/7264857600.0L) + 266681.0L/12108096000.0L) + 269131.0L/336336000.0L) - 1.0L/411840.0L;
-        poly_val[17] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/1307674368000.0L)*pow(x, 2) - 1.0L/8302694400.0L) + 23.0L/3193344000.0L) - 757.0L/3657830400.0L) + 2021.0L/677376000.0L) - 4679.0L/228096000.0L) + 3739217.0L/65383718400.0L) - 63397.0L/1513512000.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<8, 2>>(x, poly_val);
         break;
     }
 }
-void beta_Lagrange_n9(int deriv, double x, double *poly_val) {
+
+template void beta_Lagrange_n8<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n8<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<9, 0>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-8.22063524662433e-18, 1.5619206968586225e-16, -1.4057286271727603e-15, 7.965795553978976e-15,
+         -3.1863182215915904e-14, 9.55895466477477e-14, -2.230422755114113e-13, 4.1422136880690674e-13,
+         -6.213320532103601e-13, 7.594058428126623e-13, -7.594058428126623e-13, 6.213320532103601e-13,
+         -4.1422136880690674e-13, 2.230422755114113e-13, -9.55895466477477e-14, 3.1863182215915904e-14,
+         -7.965795553978976e-15, 1.4057286271727603e-15, -1.5619206968586225e-16, 8.22063524662433e-18},
+        {7.809603484293113e-17, -1.3276325923298293e-15, 1.0542964703795703e-14, -5.177767110086334e-14,
+         1.7524750218753745e-13, -4.301529599148647e-13, 7.806479642899396e-13, -1.0355534220172668e-12,
+         9.319980798155401e-13, -3.7970292140633116e-13, -3.7970292140633116e-13, 9.319980798155401e-13,
+         -1.0355534220172668e-12, 7.806479642899396e-13, -4.301529599148647e-13, 1.7524750218753745e-13,
+         -5.177767110086334e-14, 1.0542964703795703e-14, -1.3276325923298293e-15, 7.809603484293113e-17},
+        {1.991448888494744e-15, -4.064898613574565e-14, 3.883325332564751e-13, -2.3120721595423974e-12,
+         9.63064682476058e-12, -2.984783594075922e-11, 7.142928873252947e-11, -1.3513972157325333e-10,
+         2.0519491057272142e-10, -2.5231259127450705e-10, 2.5231259127450705e-10, -2.0519491057272142e-10,
+         1.3513972157325333e-10, -7.142928873252947e-11, 2.984783594075922e-11, -9.63064682476058e-12,
+         2.3120721595423974e-12, -3.883325332564751e-13, 4.064898613574565e-14, -1.991448888494744e-15},
+        {-1.8918764440700068e-14, 3.4551638215383806e-13, -2.912493999423563e-12, 1.5028469037025584e-11,
+         -5.2968557536183197e-11, 1.343152617334165e-10, -2.500025105638532e-10, 3.378493039331333e-10,
+         -3.0779236585908214e-10, 1.2615629563725353e-10, 1.2615629563725353e-10, -3.0779236585908214e-10,
+         3.378493039331333e-10, -2.500025105638532e-10, 1.343152617334165e-10, -5.2968557536183197e-11,
+         1.5028469037025584e-11, -2.912493999423563e-12, 3.4551638215383806e-13, -1.8918764440700068e-14},
+        {-1.9317054218399015e-13, 4.1481880347345514e-12, -4.192199055170285e-11, 2.636538926944846e-10,
+         -1.1540286992915961e-09, 3.731648619421437e-09, -9.242481573210739e-09, 1.7945001694795014e-08,
+         -2.772274888315315e-08, 3.4384567602332425e-08, -3.4384567602332425e-08, 2.772274888315315e-08,
+         -1.7945001694795014e-08, 9.242481573210739e-09, -3.731648619421437e-09, 1.1540286992915961e-09,
+         -2.636538926944846e-10, 4.192199055170285e-11, -4.1481880347345514e-12, 1.9317054218399015e-13},
+        {1.8351201507479066e-12, -3.5259598295243686e-11, 3.144149291377714e-10, -1.71375030251415e-09,
+         6.347157846103779e-09, -1.6792418787396464e-08, 3.234868550623759e-08, -4.486250423698754e-08,
+         4.158412332472972e-08, -1.7192283801166213e-08, -1.7192283801166213e-08, 4.158412332472972e-08,
+         -4.486250423698754e-08, 3.234868550623759e-08, -1.6792418787396464e-08, 6.347157846103779e-09,
+         -1.71375030251415e-09, 3.144149291377714e-10, -3.5259598295243686e-11, 1.8351201507479066e-12},
+        {9.671637481048765e-12, -2.152937138403523e-10, 2.2768907256160273e-09, -1.512563830050413e-08,
+         7.015069291381365e-08, -2.3961429865886917e-07, 6.222000281998594e-07, -1.2536245332835287e-06,
+         1.986295005826902e-06, -2.4953353135387457e-06, 2.4953353135387457e-06, -1.986295005826902e-06,
+         1.2536245332835287e-06, -6.222000281998594e-07, 2.3961429865886917e-07, -7.015069291381365e-08,
+         1.512563830050413e-08, -2.2768907256160273e-09, 2.152937138403523e-10, -9.671637481048765e-12},
+        {-9.188055606996327e-11, 1.8299965676429947e-09, -1.7076680442120204e-08, 9.831664895327685e-08,
+         -3.8582881102597504e-07, 1.0782643439649114e-06, -2.177700098699508e-06, 3.1340613332088216e-06,
+         -2.9794425087403524e-06, 1.2476676567693729e-06, 1.2476676567693729e-06, -2.9794425087403524e-06,
+         3.1340613332088216e-06, -2.177700098699508e-06, 1.0782643439649114e-06, -3.8582881102597504e-07,
+         9.831664895327685e-08, -1.7076680442120204e-08, 1.8299965676429947e-09, -9.188055606996327e-11},
+        {-2.689097619406666e-10, 6.138755022535581e-09, -6.716842931160778e-08, 4.6732180002625325e-07,
+         -2.3034616122473486e-06, 8.424370670828532e-06, -2.33566901647832e-05, 4.969660761455069e-05,
+         -8.182847765824858e-05, 0.00010485106124216534, -0.00010485106124216534, 8.182847765824858e-05,
+         -4.969660761455069e-05, 2.33566901647832e-05, -8.424370670828532e-06, 2.3034616122473486e-06,
+         -4.6732180002625325e-07, 6.716842931160778e-08, -6.138755022535581e-09, 2.689097619406666e-10},
+        {2.554642738436333e-09, -5.217941769155244e-08, 5.037632198370583e-07, -3.037591700170646e-06,
+         1.2669038867360417e-05, -3.79096680187284e-05, 8.17484155767412e-05, -0.00012424151903637674,
+         0.0001227427164873729, -5.242553062108267e-05, -5.242553062108267e-05, 0.0001227427164873729,
+         -0.00012424151903637674, 8.17484155767412e-05, -3.79096680187284e-05, 1.2669038867360417e-05,
+         -3.037591700170646e-06, 5.037632198370583e-07, -5.217941769155244e-08, 2.554642738436333e-09},
+        {4.163087168501186e-09, -9.668662011108489e-08, 1.083680885625588e-06, -7.80644914384411e-06,
+         4.052346700933095e-05, -0.00016001603625516195, 0.0004853028109400985, -0.0011220375525466304,
+         0.0019648479504752988, -0.002600296376608341, 0.002600296376608341, -0.0019648479504752988,
+         0.0011220375525466304, -0.0004853028109400985, 0.00016001603625516195, -4.052346700933095e-05,
+         7.80644914384411e-06, -1.083680885625588e-06, 9.668662011108489e-08, -4.163087168501186e-09},
+        {-3.954932810076127e-08, 8.218362709442215e-07, -8.12760664219191e-06, 5.074191943498672e-05,
+         -0.00022287906855132024, 0.0007200721631482287, -0.0016985598382903448, 0.002805093881366576,
+         -0.0029472719257129486, 0.0013001481883041705, 0.0013001481883041705, -0.0029472719257129486,
+         0.002805093881366576, -0.0016985598382903448, 0.0007200721631482287, -0.00022287906855132024,
+         5.074191943498672e-05, -8.12760664219191e-06, 8.218362709442215e-07, -3.954932810076127e-08},
+        {-3.411049040132975e-08, 8.011447367867914e-07, -9.12372754187474e-06, 6.73019287030327e-05,
+         -0.0003626627430895242, 0.001525168126198327, -0.005174523906836292, 0.01363773435816677,
+         -0.026554795703805395, 0.03720911918541714, -0.03720911918541714, 0.026554795703805395,
+         -0.01363773435816677, 0.005174523906836292, -0.001525168126198327, 0.0003626627430895242,
+         -6.73019287030327e-05, 9.12372754187474e-06, -8.011447367867914e-07, 3.411049040132975e-08},
+        {3.2404965881263263e-07, -6.809730262687727e-06, 6.842795656406055e-05, -0.0004374625365697126,
+         0.001994645086992383, -0.006863256567892472, 0.01811083367392702, -0.03409433589541693,
+         0.03983219355570809, -0.01860455959270857, -0.01860455959270857, 0.03983219355570809,
+         -0.03409433589541693, 0.01811083367392702, -0.006863256567892472, 0.001994645086992383,
+         -0.0004374625365697126, 6.842795656406055e-05, -6.809730262687727e-06, 3.2404965881263263e-07},
+        {1.3097761611320797e-07, -3.0968308889854648e-06, 3.560616886602617e-05, -0.0002664499565102565,
+         0.0014692777983954465, -0.006434822775044536, 0.0236908625792303, -0.07648189536055387,
+         0.18282831231508215, -0.2871802345519887, 0.2871802345519887, -0.18282831231508215,
+         0.07648189536055387, -0.0236908625792303, 0.006434822775044536, -0.0014692777983954465,
+         0.0002664499565102565, -3.560616886602617e-05, 3.0968308889854648e-06, -1.3097761611320797e-07},
+        {-1.2442873530754756e-06, 2.632306255637645e-05, -0.00026704626649519625, 0.0017319247173166674,
+         -0.008081027891174956, 0.028956702487700416, -0.08291801902730604, 0.19120473840138466,
+         -0.27424246847262324, 0.14359011727599436, 0.14359011727599436, -0.27424246847262324,
+         0.19120473840138466, -0.08291801902730604, 0.028956702487700416, -0.008081027891174956,
+         0.0017319247173166674, -0.00026704626649519625, 2.632306255637645e-05, -1.2442873530754756e-06},
+        {-1.7962684630085064e-07, 4.260745580639688e-06, -4.921399707458381e-05, 0.00037083498024347727,
+         -0.0020677291697450023, 0.009234986518969921, -0.03538061140287967, 0.1266621274222327,
+         -0.49564725742960675, 1.0367738926424426, -1.0367738926424426, 0.49564725742960675,
+         -0.1266621274222327, 0.03538061140287967, -0.009234986518969921, 0.0020677291697450023,
+         -0.00037083498024347727, 4.921399707458381e-05, -4.260745580639688e-06, 1.7962684630085064e-07},
+        {1.7064550398580812e-06, -3.6216337435437346e-05, 0.0003691049780593786, -0.002410427371582602,
+         0.011372510433597513, -0.04155743933536465, 0.12383213991007887, -0.3166553185555818,
+         0.7434708861444101, -0.5183869463212213, -0.5183869463212213, 0.7434708861444101,
+         -0.3166553185555818, 0.12383213991007887, -0.04155743933536465, 0.011372510433597513,
+         -0.002410427371582602, 0.0003691049780593786, -3.6216337435437346e-05, 1.7064550398580812e-06},
+        {3.7237585179115594e-08, -8.837806115693906e-07, 1.0216503869742156e-05, -7.707717416521448e-05,
+         0.00043061297302219003, -0.0019297840642846292, 0.00744345281938357, -0.027094168262556194,
+         0.11289236776065081, -1.241816045367159, 1.241816045367159, -0.11289236776065081,
+         0.027094168262556194, -0.00744345281938357, 0.0019297840642846292, -0.00043061297302219003,
+         7.707717416521448e-05, -1.0216503869742156e-05, 8.837806115693906e-07, -3.7237585179115594e-08},
+        {-3.5375705920159817e-07, 7.51213519833982e-06, -7.662377902306616e-05, 0.0005010016320738941,
+         -0.002368371351622045, 0.008684028289280832, -0.026052084867842495, 0.06773542065639049,
+         -0.16933855164097622, 0.6209080226835795, 0.6209080226835795, -0.16933855164097622,
+         0.06773542065639049, -0.026052084867842495, 0.008684028289280832, -0.002368371351622045,
+         0.0005010016320738941, -7.662377902306616e-05, 7.51213519833982e-06, -3.5375705920159817e-07}};
+};
+constexpr double Lagrange_polynomials<9, 0>::coefficients[20][20];
+
+template <>
+struct Lagrange_polynomials<9, 1>
+{
+    static constexpr int degree = 18;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.5619206968586225e-16, 2.967649324031383e-15, -2.6708843916282446e-14, 1.5135011552560054e-13,
+         -6.054004621024022e-13, 1.8162013863072064e-12, -4.237803234716815e-12, 7.870206007331228e-12,
+         -1.1805309010996842e-11, 1.4428711013440584e-11, -1.4428711013440584e-11, 1.1805309010996842e-11,
+         -7.870206007331228e-12, 4.237803234716815e-12, -1.8162013863072064e-12, 6.054004621024022e-13,
+         -1.5135011552560054e-13, 2.6708843916282446e-14, -2.967649324031383e-15, 1.5619206968586225e-16},
+        {1.4057286271727603e-15, -2.3897386661936926e-14, 1.8977336466832264e-13, -9.319980798155401e-13,
+         3.1544550393756743e-12, -7.742753278467565e-12, 1.4051663357218913e-11, -1.8639961596310804e-11,
+         1.677596543667972e-11, -6.834652585313961e-12, -6.834652585313961e-12, 1.677596543667972e-11,
+         -1.8639961596310804e-11, 1.4051663357218913e-11, -7.742753278467565e-12, 3.1544550393756743e-12,
+         -9.319980798155401e-13, 1.8977336466832264e-13, -2.3897386661936926e-14, 1.4057286271727603e-15},
+        {3.3854631104410646e-14, -6.910327643076761e-13, 6.601653065360076e-12, -3.930522671222076e-11,
+         1.6372099602092988e-10, -5.074132109929068e-10, 1.214297908453001e-09, -2.2973752667453065e-09,
+         3.488313479736264e-09, -4.28931405166662e-09, 4.28931405166662e-09, -3.488313479736264e-09,
+         2.2973752667453065e-09, -1.214297908453001e-09, 5.074132109929068e-10, -1.6372099602092988e-10,
+         3.930522671222076e-11, -6.601653065360076e-12, 6.910327643076761e-13, -3.3854631104410646e-14},
+        {-3.027002310512011e-13, 5.528262114461409e-12, -4.659990399077701e-11, 2.4045550459240934e-10,
+         -8.474969205789311e-10, 2.149044187734664e-09, -4.000040169021651e-09, 5.405588862930133e-09,
+         -4.924677853745314e-09, 2.0185007301960564e-09, 2.0185007301960564e-09, -4.924677853745314e-09,
+         5.405588862930133e-09, -4.000040169021651e-09, 2.149044187734664e-09, -8.474969205789311e-10,
+         2.4045550459240934e-10, -4.659990399077701e-11, 5.528262114461409e-12, -3.027002310512011e-13},
+        {-2.897558132759852e-12, 6.222282052101827e-11, -6.288298582755428e-10, 3.9548083904172696e-09,
+         -1.7310430489373943e-08, 5.597472929132155e-08, -1.386372235981611e-07, 2.691750254219252e-07,
+         -4.158412332472972e-07, 5.157685140349864e-07, -5.157685140349864e-07, 4.158412332472972e-07,
+         -2.691750254219252e-07, 1.386372235981611e-07, -5.597472929132155e-08, 1.7310430489373943e-08,
+         -3.9548083904172696e-09, 6.288298582755428e-10, -6.222282052101827e-11, 2.897558132759852e-12},
+        {2.569168211047069e-11, -4.936343761334116e-10, 4.4018090079288e-09, -2.39925042351981e-08,
+         8.886020984545291e-08, -2.3509386302355051e-07, 4.528815970873263e-07, -6.280750593178255e-07,
+         5.821777265462161e-07, -2.40691973216327e-07, -2.40691973216327e-07, 5.821777265462161e-07,
+         -6.280750593178255e-07, 4.528815970873263e-07, -2.3509386302355051e-07, 8.886020984545291e-08,
+         -2.39925042351981e-08, 4.4018090079288e-09, -4.936343761334116e-10, 2.569168211047069e-11},
+        {1.2573128725363393e-10, -2.79881827992458e-09, 2.9599579433008356e-08, -1.966332979065537e-07,
+         9.119590078795774e-07, -3.1149858825652993e-06, 8.088600366598173e-06, -1.6297118932685874e-05,
+         2.5821835075749723e-05, -3.243935907600369e-05, 3.243935907600369e-05, -2.5821835075749723e-05,
+         1.6297118932685874e-05, -8.088600366598173e-06, 3.1149858825652993e-06, -9.119590078795774e-07,
+         1.966332979065537e-07, -2.9599579433008356e-08, 2.79881827992458e-09, -1.2573128725363393e-10},
+        {-1.1025666728395592e-09, 2.1959958811715934e-08, -2.0492016530544246e-07, 1.1797997874393222e-06,
+         -4.6299457323117e-06, 1.2939172127578935e-05, -2.6132401184394096e-05, 3.760873599850586e-05,
+         -3.575331010488423e-05, 1.4972011881232473e-05, 1.4972011881232473e-05, -3.575331010488423e-05,
+         3.760873599850586e-05, -2.6132401184394096e-05, 1.2939172127578935e-05, -4.6299457323117e-06,
+         1.1797997874393222e-06, -2.0492016530544246e-07, 2.1959958811715934e-08, -1.1025666728395592e-09},
+        {-2.9580073813473326e-09, 6.752630524789139e-08, -7.388527224276855e-07, 5.140539800288786e-06,
+         -2.5338077734720835e-05, 9.266807737911386e-05, -0.0002569235918126152, 0.0005466626837600576,
+         -0.0009001132542407345, 0.0011533616736638188, -0.0011533616736638188, 0.0009001132542407345,
+         -0.0005466626837600576, 0.0002569235918126152, -9.266807737911386e-05, 2.5338077734720835e-05,
+         -5.140539800288786e-06, 7.388527224276855e-07, -6.752630524789139e-08, 2.9580073813473326e-09},
+        {2.5546427384363328e-08, -5.217941769155244e-07, 5.037632198370584e-06, -3.037591700170646e-05,
+         0.00012669038867360417, -0.000379096680187284, 0.000817484155767412, -0.0012424151903637673,
+         0.001227427164873729, -0.0005242553062108267, -0.0005242553062108267, 0.001227427164873729,
+         -0.0012424151903637673, 0.000817484155767412, -0.000379096680187284, 0.00012669038867360417,
+         -3.037591700170646e-05, 5.037632198370584e-06, -5.217941769155244e-07, 2.5546427384363328e-08},
+        {3.746778451651067e-08, -8.701795809997639e-07, 9.753127970630293e-06, -7.0258042294597e-05,
+         0.00036471120308397855, -0.0014401443262964575, 0.0043677252984608865, -0.010098337972919673,
+         0.01768363155427769, -0.02340266738947507, 0.02340266738947507, -0.01768363155427769,
+         0.010098337972919673, -0.0043677252984608865, 0.0014401443262964575, -0.00036471120308397855,
+         7.0258042294597e-05, -9.753127970630293e-06, 8.701795809997639e-07, -3.746778451651067e-08},
+        {-3.1639462480609016e-07, 6.574690167553772e-06, -6.502085313753528e-05, 0.00040593535547989374,
+         -0.001783032548410562, 0.00576057730518583, -0.013588478706322758, 0.022440751050932607,
+         -0.02357817540570359, 0.010401185506433364, 0.010401185506433364, -0.02357817540570359,
+         0.022440751050932607, -0.013588478706322758, 0.00576057730518583, -0.001783032548410562,
+         0.00040593535547989374, -6.502085313753528e-05, 6.574690167553772e-06, -3.1639462480609016e-07},
+        {-2.3877343280930824e-07, 5.60801315750754e-06, -6.386609279312318e-05, 0.0004711135009212289,
+         -0.0025386392016266694, 0.01067617688338829, -0.03622166734785404, 0.09546414050716741,
+         -0.18588356992663777, 0.26046383429791997, -0.26046383429791997, 0.18588356992663777,
+         -0.09546414050716741, 0.03622166734785404, -0.01067617688338829, 0.0025386392016266694,
+         -0.0004711135009212289, 6.386609279312318e-05, -5.60801315750754e-06, 2.3877343280930824e-07},
+        {1.944297952875796e-06, -4.085838157612636e-05, 0.0004105677393843633, -0.0026247752194182754,
+         0.011967870521954298, -0.04117953940735483, 0.10866500204356212, -0.20456601537250158,
+         0.23899316133424856, -0.1116273575562514, -0.1116273575562514, 0.23899316133424856,
+         -0.20456601537250158, 0.10866500204356212, -0.04117953940735483, 0.011967870521954298,
+         -0.0026247752194182754, 0.0004105677393843633, -4.085838157612636e-05, 1.944297952875796e-06},
+        {6.548880805660399e-07, -1.5484154444927323e-05, 0.00017803084433013082, -0.0013322497825512826,
+         0.007346388991977233, -0.03217411387522268, 0.11845431289615149, -0.3824094768027693,
+         0.9141415615754107, -1.4359011727599438, 1.4359011727599438, -0.9141415615754107,
+         0.3824094768027693, -0.11845431289615149, 0.03217411387522268, -0.007346388991977233,
+         0.0013322497825512826, -0.00017803084433013082, 1.5484154444927323e-05, -6.548880805660399e-07},
+        {-4.977149412301902e-06, 0.0001052922502255058, -0.001068185065980785, 0.006927698869266669,
+         -0.032324111564699824, 0.11582680995080166, -0.33167207610922417, 0.7648189536055386,
+         -1.096969873890493, 0.5743604691039774, 0.5743604691039774, -1.096969873890493,
+         0.7648189536055386, -0.33167207610922417, 0.11582680995080166, -0.032324111564699824,
+         0.006927698869266669, -0.001068185065980785, 0.0001052922502255058, -4.977149412301902e-06},
+        {-5.388805389025519e-07, 1.2782236741919063e-05, -0.00014764199122375144, 0.0011125049407304318,
+         -0.006203187509235007, 0.027704959556909766, -0.10614183420863903, 0.3799863822666982,
+         -1.4869417722888203, 3.1103216779273275, -3.1103216779273275, 1.4869417722888203,
+         -0.3799863822666982, 0.10614183420863903, -0.027704959556909766, 0.006203187509235007,
+         -0.0011125049407304318, 0.00014764199122375144, -1.2782236741919063e-05, 5.388805389025519e-07},
+        {3.4129100797161623e-06, -7.243267487087469e-05, 0.0007382099561187572, -0.004820854743165204,
+         0.022745020867195025, -0.0831148786707293, 0.24766427982015773, -0.6333106371111636,
+         1.4869417722888203, -1.0367738926424426, -1.0367738926424426, 1.4869417722888203,
+         -0.6333106371111636, 0.24766427982015773, -0.0831148786707293, 0.022745020867195025,
+         -0.004820854743165204, 0.0007382099561187572, -7.243267487087469e-05, 3.4129100797161623e-06},
+        {3.7237585179115594e-08, -8.837806115693906e-07, 1.0216503869742156e-05, -7.707717416521448e-05,
+         0.00043061297302219003, -0.0019297840642846292, 0.00744345281938357, -0.027094168262556194,
+         0.11289236776065081, -1.241816045367159, 1.241816045367159, -0.11289236776065081,
+         0.027094168262556194, -0.00744345281938357, 0.0019297840642846292, -0.00043061297302219003,
+         7.707717416521448e-05, -1.0216503869742156e-05, 8.837806115693906e-07, -3.7237585179115594e-08}};
+};
+constexpr double Lagrange_polynomials<9, 1>::coefficients[19][20];
+
+template <>
+struct Lagrange_polynomials<9, 2>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.8114572543455206e-15, 5.341768783256489e-14, -4.807591904930841e-13, 2.7243020794608098e-12,
+         -1.0897208317843239e-11, 3.269162495352972e-11, -7.628045822490267e-11, 1.416637081319621e-10,
+         -2.1249556219794316e-10, 2.597167982419305e-10, -2.597167982419305e-10, 2.1249556219794316e-10,
+         -1.416637081319621e-10, 7.628045822490267e-11, -3.269162495352972e-11, 1.0897208317843239e-11,
+         -2.7243020794608098e-12, 4.807591904930841e-13, -5.341768783256489e-14, 2.8114572543455206e-15},
+        {2.3897386661936926e-14, -4.0625557325292775e-13, 3.226147199361485e-12, -1.5843967356864182e-11,
+         5.362573566938646e-11, -1.316268057339486e-10, 2.388782770727215e-10, -3.1687934713728366e-10,
+         2.851914124235553e-10, -1.1618909395033734e-10, -1.1618909395033734e-10, 2.851914124235553e-10,
+         -3.1687934713728366e-10, 2.388782770727215e-10, -1.316268057339486e-10, 5.362573566938646e-11,
+         -1.5843967356864182e-11, 3.226147199361485e-12, -4.0625557325292775e-13, 2.3897386661936926e-14},
+        {5.416740976705703e-13, -1.1056524228922818e-11, 1.0562644904576122e-10, -6.288836273955321e-10,
+         2.619535936334878e-09, -8.118611375886509e-09, 1.9428766535248017e-08, -3.6758004267924904e-08,
+         5.581301567578022e-08, -6.862902482666591e-08, 6.862902482666591e-08, -5.581301567578022e-08,
+         3.6758004267924904e-08, -1.9428766535248017e-08, 8.118611375886509e-09, -2.619535936334878e-09,
+         6.288836273955321e-10, -1.0562644904576122e-10, 1.1056524228922818e-11, -5.416740976705703e-13},
+        {-4.540503465768016e-12, 8.292393171692113e-11, -6.989985598616551e-10, 3.6068325688861402e-09,
+         -1.2712453808683968e-08, 3.223566281601996e-08, -6.000060253532475e-08, 8.108383294395199e-08,
+         -7.387016780617971e-08, 3.027751095294085e-08, 3.027751095294085e-08, -7.387016780617971e-08,
+         8.108383294395199e-08, -6.000060253532475e-08, 3.223566281601996e-08, -1.2712453808683968e-08,
+         3.6068325688861402e-09, -6.989985598616551e-10, 8.292393171692113e-11, -4.540503465768016e-12},
+        {-4.056581385863793e-11, 8.711194872942558e-10, -8.8036180158576e-09, 5.536731746584177e-08,
+         -2.4234602685123516e-07, 7.836462100785018e-07, -1.9409211303742553e-06, 3.768450355906953e-06,
+         -5.821777265462161e-06, 7.22075919648981e-06, -7.22075919648981e-06, 5.821777265462161e-06,
+         -3.768450355906953e-06, 1.9409211303742553e-06, -7.836462100785018e-07, 2.4234602685123516e-07,
+         -5.536731746584177e-08, 8.8036180158576e-09, -8.711194872942558e-10, 4.056581385863793e-11},
+        {3.3399186743611896e-10, -6.417246889734351e-09, 5.722351710307439e-08, -3.119025550575753e-07,
+         1.1551827279908876e-06, -3.056220219306157e-06, 5.887460762135241e-06, -8.164975771131731e-06,
+         7.568310445100809e-06, -3.128995651812251e-06, -3.128995651812251e-06, 7.568310445100809e-06,
+         -8.164975771131731e-06, 5.887460762135241e-06, -3.056220219306157e-06, 1.1551827279908876e-06,
+         -3.119025550575753e-07, 5.722351710307439e-08, -6.417246889734351e-09, 3.3399186743611896e-10},
+        {1.5087754470436073e-09, -3.358581935909496e-08, 3.5519495319610026e-07, -2.3595995748786444e-06,
+         1.0943508094554928e-05, -3.737983059078359e-05, 9.706320439917807e-05, -0.00019556542719223049,
+         0.00030986202090899664, -0.00038927230891204435, 0.00038927230891204435, -0.00030986202090899664,
+         0.00019556542719223049, -9.706320439917807e-05, 3.737983059078359e-05, -1.0943508094554928e-05,
+         2.3595995748786444e-06, -3.5519495319610026e-07, 3.358581935909496e-08, -1.5087754470436073e-09},
+        {-1.212823340123515e-08, 2.415595469288753e-07, -2.254121818359867e-06, 1.2977797661832544e-05,
+         -5.092940305542871e-05, 0.0001423308934033683, -0.00028745641302833506, 0.0004136960959835645,
+         -0.00039328641115372653, 0.00016469213069355721, 0.00016469213069355721, -0.00039328641115372653,
+         0.0004136960959835645, -0.00028745641302833506, 0.0001423308934033683, -5.092940305542871e-05,
+         1.2977797661832544e-05, -2.254121818359867e-06, 2.415595469288753e-07, -1.212823340123515e-08},
+        {-2.9580073813473327e-08, 6.752630524789139e-07, -7.388527224276855e-06, 5.140539800288786e-05,
+         -0.00025338077734720835, 0.0009266807737911386, -0.002569235918126152, 0.005466626837600576,
+         -0.009001132542407345, 0.011533616736638188, -0.011533616736638188, 0.009001132542407345,
+         -0.005466626837600576, 0.002569235918126152, -0.0009266807737911386, 0.00025338077734720835,
+         -5.140539800288786e-05, 7.388527224276855e-06, -6.752630524789139e-07, 2.9580073813473327e-08},
+        {2.2991784645926995e-07, -4.696147592239719e-06, 4.533868978533525e-05, -0.00027338325301535816,
+         0.0011402134980624376, -0.0034118701216855557, 0.007357357401906709, -0.011181736713273905,
+         0.011046844483863559, -0.004718297755897441, -0.004718297755897441, 0.011046844483863559,
+         -0.011181736713273905, 0.007357357401906709, -0.0034118701216855557, 0.0011402134980624376,
+         -0.00027338325301535816, 4.533868978533525e-05, -4.696147592239719e-06, 2.2991784645926995e-07},
+        {2.9974227613208537e-07, -6.961436647998111e-06, 7.802502376504234e-05, -0.000562064338356776,
+         0.0029176896246718284, -0.01152115461037166, 0.03494180238768709, -0.08078670378335738,
+         0.14146905243422153, -0.18722133911580055, 0.18722133911580055, -0.14146905243422153,
+         0.08078670378335738, -0.03494180238768709, 0.01152115461037166, -0.0029176896246718284,
+         0.000562064338356776, -7.802502376504234e-05, 6.961436647998111e-06, -2.9974227613208537e-07},
+        {-2.214762373642631e-06, 4.60228311728764e-05, -0.00045514597196274695, 0.002841547488359256,
+         -0.012481227838873933, 0.04032404113630081, -0.0951193509442593, 0.15708525735652826,
+         -0.16504722783992512, 0.07280829854503355, 0.07280829854503355, -0.16504722783992512,
+         0.15708525735652826, -0.0951193509442593, 0.04032404113630081, -0.012481227838873933,
+         0.002841547488359256, -0.00045514597196274695, 4.60228311728764e-05, -2.214762373642631e-06},
+        {-1.4326405968558496e-06, 3.364807894504524e-05, -0.0003831965567587391, 0.0028266810055273734,
+         -0.015231835209760016, 0.06405706130032973, -0.21733000408712425, 0.5727848430430044,
+         -1.1153014195598265, 1.5627830057875196, -1.5627830057875196, 1.1153014195598265,
+         -0.5727848430430044, 0.21733000408712425, -0.06405706130032973, 0.015231835209760016,
+         -0.0028266810055273734, 0.0003831965567587391, -3.364807894504524e-05, 1.4326405968558496e-06},
+        {9.72148976437898e-06, -0.0002042919078806318, 0.0020528386969218167, -0.013123876097091378,
+         0.05983935260977149, -0.20589769703677416, 0.5433250102178107, -1.0228300768625078,
+         1.1949658066712427, -0.5581367877812571, -0.5581367877812571, 1.1949658066712427,
+         -1.0228300768625078, 0.5433250102178107, -0.20589769703677416, 0.05983935260977149,
+         -0.013123876097091378, 0.0020528386969218167, -0.0002042919078806318, 9.72148976437898e-06},
+        {2.6195523222641594e-06, -6.193661777970929e-05, 0.0007121233773205233, -0.005328999130205131,
+         0.02938555596790893, -0.12869645550089073, 0.47381725158460597, -1.5296379072110773,
+         3.656566246301643, -5.743604691039775, 5.743604691039775, -3.656566246301643,
+         1.5296379072110773, -0.47381725158460597, 0.12869645550089073, -0.02938555596790893,
+         0.005328999130205131, -0.0007121233773205233, 6.193661777970929e-05, -2.6195523222641594e-06},
+        {-1.4931448236905709e-05, 0.0003158767506765174, -0.0032045551979423548, 0.02078309660780001,
+         -0.09697233469409948, 0.34748042985240496, -0.9950162283276726, 2.294456860816616,
+         -3.290909621671479, 1.7230814073119325, 1.7230814073119325, -3.290909621671479,
+         2.294456860816616, -0.9950162283276726, 0.34748042985240496, -0.09697233469409948,
+         0.02078309660780001, -0.0032045551979423548, 0.0003158767506765174, -1.4931448236905709e-05},
+        {-1.0777610778051038e-06, 2.5564473483838127e-05, -0.0002952839824475029, 0.0022250098814608635,
+         -0.012406375018470014, 0.05540991911381953, -0.21228366841727805, 0.7599727645333963,
+         -2.9738835445776406, 6.220643355854655, -6.220643355854655, 2.9738835445776406,
+         -0.7599727645333963, 0.21228366841727805, -0.05540991911381953, 0.012406375018470014,
+         -0.0022250098814608635, 0.0002952839824475029, -2.5564473483838127e-05, 1.0777610778051038e-06},
+        {3.4129100797161623e-06, -7.243267487087469e-05, 0.0007382099561187572, -0.004820854743165204,
+         0.022745020867195025, -0.0831148786707293, 0.24766427982015773, -0.6333106371111636,
+         1.4869417722888203, -1.0367738926424426, -1.0367738926424426, 1.4869417722888203,
+         -0.6333106371111636, 0.24766427982015773, -0.0831148786707293, 0.022745020867195025,
+         -0.004820854743165204, 0.0007382099561187572, -7.243267487087469e-05, 3.4129100797161623e-06}};
+};
+constexpr double Lagrange_polynomials<9, 2>::coefficients[18][20];
+
+template <class real_number>
+void beta_Lagrange_n9(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/121645100408832000.0L*x + 1.0L/6402373705728000.0L) + 1.0L/1067062284288000.0L) - 1.0L/31384184832000.0L) + 1.0L/62768369664000.0L) + 23.0L/8966909952000.0L) - 313.0L/47076277248000.0L) - 757.0L/7242504192000.0L) + 3611.0L/9656672256000.0L) + 2021.0L/877879296000.0L) - 45757.0L/4828336128000.0L) - 4679.0L/172440576000.0L) + 1414271.0L/11769069312000.0L) + 3739217.0L/23538138624000.0L) - 957311.0L/1307674368000.0L) - 63397.0L/163459296000.0L) + 56311.0L/30875644800.0L) + 1.0L/3938220.0L) - 1.0L/831402.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/6402373705728000.0L)*x - 1.0L/355687428096000.0L) - 47.0L/2134124568576000.0L) + 1.0L/1609445376000.0L) + 1.0L/5706215424000.0L) - 79.0L/1494484992000.0L) + 20827.0L/188305108992000.0L) + 1801.0L/804722688000.0L) - 68909.0L/9656672256000.0L) - 7403.0L/146313216000.0L) + 1846049.0L/9656672256000.0L) + 139499.0L/229920768000.0L) - 117554201.0L/47076277248000.0L) - 1043321.0L/290594304000.0L) + 3677437.0L/237758976000.0L) + 10949.0L/1241856000.0L) - 599971.0L/15437822400.0L) - 9.0L/1555840.0L) + 1.0L/38896.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/711374856192000.0L*x + 1.0L/41845579776000.0L) + 83.0L/355687428096000.0L) - 59.0L/10461394944000.0L) - 1.0L/146313216000.0L) + 10691.0L/20922789888000.0L) - 167.0L/217945728000.0L) - 18301.0L/804722688000.0L) + 200467.0L/3218890752000.0L) + 156031.0L/292626432000.0L) - 2913091.0L/1609445376000.0L) - 2637347.0L/402361344000.0L) + 16131677.0L/653837184000.0L) + 11448761.0L/290594304000.0L) - 2067001.0L/13208832000.0L) - 196909.0L/2018016000.0L) + 105031.0L/263894400.0L) + 9.0L/140140.0L) - 9.0L/34034.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/125536739328000.0L)*x - 1.0L/7846046208000.0L) - 1.0L/664215552000.0L) + 83.0L/2615348736000.0L) + 137.0L/1902071808000.0L) - 571.0L/186810624000.0L) + 151451.0L/62768369664000.0L) + 43693.0L/301771008000.0L) - 146939.0L/459841536000.0L) - 65377.0L/18289152000.0L) + 33971617.0L/3218890752000.0L) + 1311029.0L/28740096000.0L) - 2408863267.0L/15692092416000.0L) - 550937221.0L/1961511552000.0L) + 4896967.0L/4852224000.0L) + 9601741.0L/13621608000.0L) - 9495901.0L/3632428800.0L) - 1.0L/2145.0L) + 1.0L/572.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/31384184832000.0L*x + 1.0L/2092278988800.0L) + 1.0L/149448499200.0L) - 1.0L/8047226880.0L) - 83.0L/193729536000.0L) + 1889.0L/149448499200.0L) + 199.0L/392302310400.0L) - 5147.0L/8047226880.0L) + 115103.0L/114960384000.0L) + 248167.0L/14631321600.0L) - 1105981.0L/26824089600.0L) - 131977.0L/574801920.0L) + 654411847.0L/980755776000.0L) + 21379409.0L/14529715200.0L) - 14487307.0L/3113510400.0L) - 5861.0L/1552320.0L) + 9397117.0L/756756000.0L) + 9.0L/3575.0L) - 6.0L/715.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/10461394944000.0L)*x - 1.0L/747242496000.0L) - 229.0L/10461394944000.0L) + 269.0L/747242496000.0L) + 8941.0L/5230697472000.0L) - 14321.0L/373621248000.0L) - 65903.0L/1743565824000.0L) + 59273.0L/28740096000.0L) - 1335239.0L/804722688000.0L) - 309691.0L/5225472000.0L) + 85570171.0L/804722688000.0L) + 50693869.0L/57480192000.0L) - 1363537171.0L/653837184000.0L) - 63114127.0L/10378368000.0L) + 1177851371.0L/72648576000.0L) + 9381241.0L/576576000.0L) - 9222481.0L/201801600.0L) - 63.0L/5720.0L) + 9.0L/286.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/4483454976000.0L*x + 1.0L/344881152000.0L) + 41.0L/747242496000.0L) - 23.0L/28740096000.0L) - 3697.0L/747242496000.0L) + 5077.0L/57480192000.0L) + 101419.0L/560431872000.0L) - 431303.0L/86220288000.0L) - 2027.0L/5474304000.0L) + 1618681.0L/10450944000.0L) - 9174989.0L/57480192000.0L) - 36951877.0L/14370048000.0L) + 152331367.0L/35026992000.0L) + 444183529.0L/21555072000.0L) - 2003176661.0L/46702656000.0L) - 9072541.0L/149688000.0L) + 8860861.0L/64864800.0L) + 7.0L/165.0L) - 14.0L/143.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2414168064000.0L)*x - 1.0L/201180672000.0L) - 29.0L/268240896000.0L) + 281.0L/201180672000.0L) + 397.0L/36578304000.0L) - 2273.0L/14370048000.0L) - 617821.0L/1207084032000.0L) + 936041.0L/100590336000.0L) + 2668157.0L/268240896000.0L) - 5586823.0L/18289152000.0L) + 35775989.0L/804722688000.0L) + 160253299.0L/28740096000.0L) - 739625771.0L/150885504000.0L) - 294484709.0L/5588352000.0L) + 107051279.0L/1524096000.0L) + 8190541.0L/38808000.0L) - 7873021.0L/23284800.0L) - 9.0L/55.0L) + 3.0L/11.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1609445376000.0L*x + 1.0L/146313216000.0L) + 137.0L/804722688000.0L) - 71.0L/36578304000.0L) - 14911.0L/804722688000.0L) + 2333.0L/10450944000.0L) + 2531.0L/2483712000.0L) - 491677.0L/36578304000.0L) - 47309593.0L/1609445376000.0L) + 66976673.0L/146313216000.0L) + 315424951.0L/804722688000.0L) - 23225297.0L/2612736000.0L) - 24429967.0L/50295168000.0L) + 95749481.0L/1016064000.0L) - 231950053.0L/5588352000.0L) - 3427741.0L/7056000.0L) + 2792701.0L/7761600.0L) + 9.0L/10.0L) - 9.0L/11.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/1316818944000.0L)*x - 1.0L/131681894400.0L) - 19.0L/87787929600.0L) + 19.0L/8778792960.0L) + 5491.0L/219469824000.0L) - 5491.0L/21946982400.0L) - 199937.0L/131681894400.0L) + 199937.0L/13168189440.0L) + 22981127.0L/438939648000.0L) - 22981127.0L/43893964800.0L) - 91172887.0L/87787929600.0L) + 91172887.0L/8778792960.0L) + 1886067737.0L/164602368000.0L) - 1886067737.0L/16460236800.0L) - 117868837.0L/1828915200.0L) + 117868837.0L/182891520.0L) + 9778141.0L/63504000.0L) - 9778141.0L/6350400.0L) - 1.0L/10.0L) + 1;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1316818944000.0L*x + 1.0L/146313216000.0L) + 1.0L/4478976000.0L) - 71.0L/36578304000.0L) - 5917.0L/219469824000.0L) + 2333.0L/10450944000.0L) + 143333.0L/82301184000.0L) - 491677.0L/36578304000.0L) - 4125893.0L/62705664000.0L) + 66976673.0L/146313216000.0L) + 328397227.0L/219469824000.0L) - 23225297.0L/2612736000.0L) - 418657681.0L/20575296000.0L) + 95749481.0L/1016064000.0L) + 103649251.0L/653184000.0L) - 3427741.0L/7056000.0L) - 4062781.0L/6350400.0L) + 9.0L/10.0L) + 1);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/1609445376000.0L)*x - 1.0L/201180672000.0L) - 43.0L/229920768000.0L) + 281.0L/201180672000.0L) + 18721.0L/804722688000.0L) - 2273.0L/14370048000.0L) - 418087.0L/268240896000.0L) + 936041.0L/100590336000.0L) + 14128099.0L/229920768000.0L) - 5586823.0L/18289152000.0L) - 2350874153.0L/1609445376000.0L) + 160253299.0L/28740096000.0L) + 4129613923.0L/201180672000.0L) - 294484709.0L/5588352000.0L) - 252469003.0L/1596672000.0L) + 8190541.0L/38808000.0L) + 8508061.0L/15523200.0L) - 9.0L/55.0L) - 9.0L/22.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2414168064000.0L*x + 1.0L/344881152000.0L) + 17.0L/134120448000.0L) - 23.0L/28740096000.0L) - 587.0L/36578304000.0L) + 5077.0L/57480192000.0L) + 82471.0L/75442752000.0L) - 431303.0L/86220288000.0L) - 35057611.0L/804722688000.0L) + 1618681.0L/10450944000.0L) + 414889873.0L/402361344000.0L) - 36951877.0L/14370048000.0L) - 1053508997.0L/75442752000.0L) + 444183529.0L/21555072000.0L) + 221696239.0L/2286144000.0L) - 9072541.0L/149688000.0L) - 9284221.0L/34927200.0L) + 7.0L/165.0L) + 2.0L/11.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/4483454976000.0L)*x - 1.0L/747242496000.0L) - 103.0L/1494484992000.0L) + 269.0L/747242496000.0L) + 199.0L/22643712000.0L) - 14321.0L/373621248000.0L) - 1343389.0L/2241727488000.0L) + 59273.0L/28740096000.0L) + 388021.0L/16422912000.0L) - 309691.0L/5225472000.0L) - 6924367.0L/12773376000.0L) + 50693869.0L/57480192000.0L) + 965782157.0L/140107968000.0L) - 63114127.0L/10378368000.0L) - 122428519.0L/2830464000.0L) + 9381241.0L/576576000.0L) + 9540001.0L/86486400.0L) - 63.0L/5720.0L) - 21.0L/286.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/10461394944000.0L*x + 1.0L/2092278988800.0L) + 31.0L/1046139494400.0L) - 1.0L/8047226880.0L) - 1793.0L/475517952000.0L) + 1889.0L/149448499200.0L) + 22171.0L/87178291200.0L) - 5147.0L/8047226880.0L) - 7876837.0L/804722688000.0L) + 248167.0L/14631321600.0L) + 17344541.0L/80472268800.0L) - 131977.0L/574801920.0L) - 26463329.0L/10216206000.0L) + 21379409.0L/14529715200.0L) + 10216631.0L/660441600.0L) - 5861.0L/1552320.0L) - 9651133.0L/252252000.0L) + 9.0L/3575.0L) + 18.0L/715.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/31384184832000.0L)*x - 1.0L/7846046208000.0L) - 103.0L/10461394944000.0L) + 83.0L/2615348736000.0L) + 499.0L/402361344000.0L) - 571.0L/186810624000.0L) - 1287469.0L/15692092416000.0L) + 43693.0L/301771008000.0L) + 822289.0L/268240896000.0L) - 65377.0L/18289152000.0L) - 52326023.0L/804722688000.0L) + 1311029.0L/28740096000.0L) + 369975061.0L/490377888000.0L) - 550937221.0L/1961511552000.0L) - 2869906997.0L/653837184000.0L) + 9601741.0L/13621608000.0L) + 746737.0L/69854400.0L) - 1.0L/2145.0L) - 1.0L/143.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/125536739328000.0L*x + 1.0L/41845579776000.0L) + 17.0L/6974263296000.0L) - 59.0L/10461394944000.0L) - 6317.0L/20922789888000.0L) + 10691.0L/20922789888000.0L) + 306049.0L/15692092416000.0L) - 18301.0L/804722688000.0L) - 760069.0L/1072963584000.0L) + 156031.0L/292626432000.0L) + 23540441.0L/1609445376000.0L) - 2637347.0L/402361344000.0L) - 651515867.0L/3923023104000.0L) + 11448761.0L/290594304000.0L) + 414884083.0L/435891456000.0L) - 196909.0L/2018016000.0L) - 1391323.0L/605404800.0L) + 9.0L/140140.0L) + 3.0L/2002.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/711374856192000.0L)*x - 1.0L/355687428096000.0L) - 43.0L/101624979456000.0L) + 1.0L/1609445376000.0L) + 1073.0L/20922789888000.0L) - 79.0L/1494484992000.0L) - 7517.0L/2324754432000.0L) + 1801.0L/804722688000.0L) + 52799.0L/459841536000.0L) - 7403.0L/146313216000.0L) - 7491133.0L/3218890752000.0L) + 139499.0L/229920768000.0L) + 136333979.0L/5230697472000.0L) - 1043321.0L/290594304000.0L) - 6144839.0L/41513472000.0L) + 10949.0L/1241856000.0L) + 1219787.0L/3430627200.0L) - 9.0L/1555840.0L) - 9.0L/38896.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/6402373705728000.0L*x + 1.0L/6402373705728000.0L) + 1.0L/21776781312000.0L) - 1.0L/31384184832000.0L) - 31.0L/5706215424000.0L) + 23.0L/8966909952000.0L) + 3947.0L/11769069312000.0L) - 757.0L/7242504192000.0L) - 16153.0L/1379524608000.0L) + 2021.0L/877879296000.0L) + 1131407.0L/4828336128000.0L) - 4679.0L/172440576000.0L) - 15305183.0L/5884534656000.0L) + 3739217.0L/23538138624000.0L) + 83131.0L/5660928000.0L) - 63397.0L/163459296000.0L) - 40207.0L/1143542400.0L) + 1.0L/3938220.0L) + 1.0L/43758.0L);
-        poly_val[19] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/121645100408832000.0L)*pow(x, 2) - 1.0L/426824913715200.0L) + 17.0L/62768369664000.0L) - 619.0L/37661021798400.0L) + 5473.0L/9656672256000.0L) - 21713.0L/1931334451200.0L) + 5839219.0L/47076277248000.0L) - 364919.0L/523069747200.0L) + 514639.0L/308756448000.0L) - 1.0L/923780.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<9, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/6402373705728000.0L*x + 1.0L/355687428096000.0L) + 1.0L/62768369664000.0L) - 1.0L/1961511552000.0L) + 1.0L/4184557977600.0L) + 23.0L/640493568000.0L) - 313.0L/3621252096000.0L) - 757.0L/603542016000.0L) + 3611.0L/877879296000.0L) + 2021.0L/87787929600.0L) - 45757.0L/536481792000.0L) - 4679.0L/21555072000.0L) + 1414271.0L/1681295616000.0L) + 3739217.0L/3923023104000.0L) - 957311.0L/261534873600.0L) - 63397.0L/40864824000.0L) + 56311.0L/10291881600.0L) + 1.0L/1969110.0L) - 1.0L/831402.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/6402373705728000.0L)*x - 1.0L/19760412672000.0L) - 47.0L/125536739328000.0L) + 1.0L/100590336000.0L) + 1.0L/380414361600.0L) - 79.0L/106748928000.0L) + 20827.0L/14485008384000.0L) + 1801.0L/67060224000.0L) - 68909.0L/877879296000.0L) - 7403.0L/14631321600.0L) + 1846049.0L/1072963584000.0L) + 139499.0L/28740096000.0L) - 117554201.0L/6725182464000.0L) - 1043321.0L/48432384000.0L) + 3677437.0L/47551795200.0L) + 10949.0L/310464000.0L) - 599971.0L/5145940800.0L) - 9.0L/777920.0L) + 1.0L/38896.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/711374856192000.0L*x + 1.0L/2324754432000.0L) + 83.0L/20922789888000.0L) - 59.0L/653837184000.0L) - 1.0L/9754214400.0L) + 10691.0L/1494484992000.0L) - 167.0L/16765056000.0L) - 18301.0L/67060224000.0L) + 200467.0L/292626432000.0L) + 156031.0L/29262643200.0L) - 2913091.0L/178827264000.0L) - 2637347.0L/50295168000.0L) + 16131677.0L/93405312000.0L) + 11448761.0L/48432384000.0L) - 2067001.0L/2641766400.0L) - 196909.0L/504504000.0L) + 105031.0L/87964800.0L) + 9.0L/70070.0L) - 9.0L/34034.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/125536739328000.0L)*x - 1.0L/435891456000.0L) - 17.0L/664215552000.0L) + 83.0L/163459296000.0L) + 137.0L/126804787200.0L) - 571.0L/13343616000.0L) + 151451.0L/4828336128000.0L) + 43693.0L/25147584000.0L) - 146939.0L/41803776000.0L) - 65377.0L/1828915200.0L) + 33971617.0L/357654528000.0L) + 1311029.0L/3592512000.0L) - 2408863267.0L/2241727488000.0L) - 550937221.0L/326918592000.0L) + 4896967.0L/970444800.0L) + 9601741.0L/3405402000.0L) - 9495901.0L/1210809600.0L) - 2.0L/2145.0L) + 1.0L/572.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/31384184832000.0L*x + 1.0L/116237721600.0L) + 17.0L/149448499200.0L) - 1.0L/502951680.0L) - 83.0L/12915302400.0L) + 1889.0L/10674892800.0L) + 199.0L/30177100800.0L) - 5147.0L/670602240.0L) + 115103.0L/10450944000.0L) + 248167.0L/1463132160.0L) - 1105981.0L/2980454400.0L) - 131977.0L/71850240.0L) + 654411847.0L/140107968000.0L) + 21379409.0L/2421619200.0L) - 14487307.0L/622702080.0L) - 5861.0L/388080.0L) + 9397117.0L/252252000.0L) + 18.0L/3575.0L) - 6.0L/715.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/10461394944000.0L)*x - 1.0L/41513472000.0L) - 3893.0L/10461394944000.0L) + 269.0L/46702656000.0L) + 8941.0L/348713164800.0L) - 14321.0L/26687232000.0L) - 65903.0L/134120448000.0L) + 59273.0L/2395008000.0L) - 1335239.0L/73156608000.0L) - 309691.0L/522547200.0L) + 85570171.0L/89413632000.0L) + 50693869.0L/7185024000.0L) - 1363537171.0L/93405312000.0L) - 63114127.0L/1729728000.0L) + 1177851371.0L/14529715200.0L) + 9381241.0L/144144000.0L) - 9222481.0L/67267200.0L) - 63.0L/2860.0L) + 9.0L/286.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/4483454976000.0L*x + 1.0L/19160064000.0L) + 697.0L/747242496000.0L) - 23.0L/1796256000.0L) - 3697.0L/49816166400.0L) + 5077.0L/4105728000.0L) + 101419.0L/43110144000.0L) - 431303.0L/7185024000.0L) - 2027.0L/497664000.0L) + 1618681.0L/1045094400.0L) - 9174989.0L/6386688000.0L) - 36951877.0L/1796256000.0L) + 152331367.0L/5003856000.0L) + 444183529.0L/3592512000.0L) - 2003176661.0L/9340531200.0L) - 9072541.0L/37422000.0L) + 8860861.0L/21621600.0L) + 14.0L/165.0L) - 14.0L/143.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/2414168064000.0L)*x - 1.0L/11176704000.0L) - 493.0L/268240896000.0L) + 281.0L/12573792000.0L) + 397.0L/2438553600.0L) - 2273.0L/1026432000.0L) - 8031673.0L/1207084032000.0L) + 936041.0L/8382528000.0L) + 2668157.0L/24385536000.0L) - 5586823.0L/1828915200.0L) + 35775989.0L/89413632000.0L) + 160253299.0L/3592512000.0L) - 739625771.0L/21555072000.0L) - 294484709.0L/931392000.0L) + 107051279.0L/304819200.0L) + 8190541.0L/9702000.0L) - 7873021.0L/7761600.0L) - 18.0L/55.0L) + 3.0L/11.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/1609445376000.0L*x + 1.0L/8128512000.0L) + 2329.0L/804722688000.0L) - 71.0L/2286144000.0L) - 14911.0L/53648179200.0L) + 2333.0L/746496000.0L) + 32903.0L/2483712000.0L) - 491677.0L/3048192000.0L) - 47309593.0L/146313216000.0L) + 66976673.0L/14631321600.0L) + 315424951.0L/89413632000.0L) - 23225297.0L/326592000.0L) - 24429967.0L/7185024000.0L) + 95749481.0L/169344000.0L) - 231950053.0L/1117670400.0L) - 3427741.0L/1764000.0L) + 2792701.0L/2587200.0L) + 9.0L/5.0L) - 9.0L/11.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/1316818944000.0L)*x - 1.0L/7315660800.0L) - 323.0L/87787929600.0L) + 19.0L/548674560.0L) + 5491.0L/14631321600.0L) - 5491.0L/1567641600.0L) - 2599181.0L/131681894400.0L) + 199937.0L/1097349120.0L) + 252792397.0L/438939648000.0L) - 22981127.0L/4389396480.0L) - 91172887.0L/9754214400.0L) + 91172887.0L/1097349120.0L) + 1886067737.0L/23514624000.0L) - 1886067737.0L/2743372800.0L) - 117868837.0L/365783040.0L) + 117868837.0L/45722880.0L) + 9778141.0L/21168000.0L) - 9778141.0L/3175200.0L) - 1.0L/10.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/1316818944000.0L*x + 1.0L/8128512000.0L) + 17.0L/4478976000.0L) - 71.0L/2286144000.0L) - 5917.0L/14631321600.0L) + 2333.0L/746496000.0L) + 1863329.0L/82301184000.0L) - 491677.0L/3048192000.0L) - 45384823.0L/62705664000.0L) + 66976673.0L/14631321600.0L) + 328397227.0L/24385536000.0L) - 23225297.0L/326592000.0L) - 418657681.0L/2939328000.0L) + 95749481.0L/169344000.0L) + 103649251.0L/130636800.0L) - 3427741.0L/1764000.0L) - 4062781.0L/2116800.0L) + 9.0L/5.0L) + 1;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/1609445376000.0L)*x - 1.0L/11176704000.0L) - 731.0L/229920768000.0L) + 281.0L/12573792000.0L) + 18721.0L/53648179200.0L) - 2273.0L/1026432000.0L) - 5435131.0L/268240896000.0L) + 936041.0L/8382528000.0L) + 14128099.0L/20901888000.0L) - 5586823.0L/1828915200.0L) - 2350874153.0L/178827264000.0L) + 160253299.0L/3592512000.0L) + 4129613923.0L/28740096000.0L) - 294484709.0L/931392000.0L) - 252469003.0L/319334400.0L) + 8190541.0L/9702000.0L) + 8508061.0L/5174400.0L) - 18.0L/55.0L) - 9.0L/22.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/2414168064000.0L*x + 1.0L/19160064000.0L) + 289.0L/134120448000.0L) - 23.0L/1796256000.0L) - 587.0L/2438553600.0L) + 5077.0L/4105728000.0L) + 1072123.0L/75442752000.0L) - 431303.0L/7185024000.0L) - 35057611.0L/73156608000.0L) + 1618681.0L/1045094400.0L) + 414889873.0L/44706816000.0L) - 36951877.0L/1796256000.0L) - 1053508997.0L/10777536000.0L) + 444183529.0L/3592512000.0L) + 221696239.0L/457228800.0L) - 9072541.0L/37422000.0L) - 9284221.0L/11642400.0L) + 14.0L/165.0L) + 2.0L/11.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/4483454976000.0L)*x - 1.0L/41513472000.0L) - 1751.0L/1494484992000.0L) + 269.0L/46702656000.0L) + 199.0L/1509580800.0L) - 14321.0L/26687232000.0L) - 1343389.0L/172440576000.0L) + 59273.0L/2395008000.0L) + 388021.0L/1492992000.0L) - 309691.0L/522547200.0L) - 6924367.0L/1419264000.0L) + 50693869.0L/7185024000.0L) + 965782157.0L/20015424000.0L) - 63114127.0L/1729728000.0L) - 122428519.0L/566092800.0L) + 9381241.0L/144144000.0L) + 9540001.0L/28828800.0L) - 63.0L/2860.0L) - 21.0L/286.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/10461394944000.0L*x + 1.0L/116237721600.0L) + 527.0L/1046139494400.0L) - 1.0L/502951680.0L) - 1793.0L/31701196800.0L) + 1889.0L/10674892800.0L) + 22171.0L/6706022400.0L) - 5147.0L/670602240.0L) - 7876837.0L/73156608000.0L) + 248167.0L/1463132160.0L) + 17344541.0L/8941363200.0L) - 131977.0L/71850240.0L) - 26463329.0L/1459458000.0L) + 21379409.0L/2421619200.0L) + 10216631.0L/132088320.0L) - 5861.0L/388080.0L) - 9651133.0L/84084000.0L) + 18.0L/3575.0L) + 18.0L/715.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/31384184832000.0L)*x - 1.0L/435891456000.0L) - 1751.0L/10461394944000.0L) + 83.0L/163459296000.0L) + 499.0L/26824089600.0L) - 571.0L/13343616000.0L) - 1287469.0L/1207084032000.0L) + 43693.0L/25147584000.0L) + 822289.0L/24385536000.0L) - 65377.0L/1828915200.0L) - 52326023.0L/89413632000.0L) + 1311029.0L/3592512000.0L) + 369975061.0L/70053984000.0L) - 550937221.0L/326918592000.0L) - 2869906997.0L/130767436800.0L) + 9601741.0L/3405402000.0L) + 746737.0L/23284800.0L) - 2.0L/2145.0L) - 1.0L/143.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/125536739328000.0L*x + 1.0L/2324754432000.0L) + 289.0L/6974263296000.0L) - 59.0L/653837184000.0L) - 6317.0L/1394852659200.0L) + 10691.0L/1494484992000.0L) + 306049.0L/1207084032000.0L) - 18301.0L/67060224000.0L) - 760069.0L/97542144000.0L) + 156031.0L/29262643200.0L) + 23540441.0L/178827264000.0L) - 2637347.0L/50295168000.0L) - 651515867.0L/560431872000.0L) + 11448761.0L/48432384000.0L) + 414884083.0L/87178291200.0L) - 196909.0L/504504000.0L) - 1391323.0L/201801600.0L) + 9.0L/70070.0L) + 3.0L/2002.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/711374856192000.0L)*x - 1.0L/19760412672000.0L) - 43.0L/5977939968000.0L) + 1.0L/100590336000.0L) + 1073.0L/1394852659200.0L) - 79.0L/106748928000.0L) - 7517.0L/178827264000.0L) + 1801.0L/67060224000.0L) + 52799.0L/41803776000.0L) - 7403.0L/14631321600.0L) - 7491133.0L/357654528000.0L) + 139499.0L/28740096000.0L) + 136333979.0L/747242496000.0L) - 1043321.0L/48432384000.0L) - 6144839.0L/8302694400.0L) + 10949.0L/310464000.0L) + 1219787.0L/1143542400.0L) - 9.0L/777920.0L) - 9.0L/38896.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/6402373705728000.0L*x + 1.0L/355687428096000.0L) + 1.0L/1280987136000.0L) - 1.0L/1961511552000.0L) - 31.0L/380414361600.0L) + 23.0L/640493568000.0L) + 3947.0L/905313024000.0L) - 757.0L/603542016000.0L) - 16153.0L/125411328000.0L) + 2021.0L/87787929600.0L) + 1131407.0L/536481792000.0L) - 4679.0L/21555072000.0L) - 15305183.0L/840647808000.0L) + 3739217.0L/3923023104000.0L) + 83131.0L/1132185600.0L) - 63397.0L/40864824000.0L) - 40207.0L/381180800.0L) + 1.0L/1969110.0L) + 1.0L/43758.0L;
-        poly_val[19] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/6402373705728000.0L)*pow(x, 2) - 1.0L/25107347865600.0L) + 17.0L/4184557977600.0L) - 619.0L/2897001676800.0L) + 5473.0L/877879296000.0L) - 21713.0L/214592716800.0L) + 5839219.0L/6725182464000.0L) - 364919.0L/104613949440.0L) + 514639.0L/102918816000.0L) - 1.0L/923780.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<9, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/355687428096000.0L*x + 1.0L/20922789888000.0L) + 1.0L/3923023104000.0L) - 1.0L/130767436800.0L) + 1.0L/298896998400.0L) + 23.0L/49268736000.0L) - 313.0L/301771008000.0L) - 757.0L/54867456000.0L) + 3611.0L/87787929600.0L) + 2021.0L/9754214400.0L) - 45757.0L/67060224000.0L) - 4679.0L/3079296000.0L) + 1414271.0L/280215936000.0L) + 3739217.0L/784604620800.0L) - 957311.0L/65383718400.0L) - 63397.0L/13621608000.0L) + 56311.0L/5145940800.0L) + 1.0L/1969110.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/355687428096000.0L)*x - 1.0L/1162377216000.0L) - 47.0L/7846046208000.0L) + 1.0L/6706022400.0L) + 1.0L/27172454400.0L) - 79.0L/8211456000.0L) + 20827.0L/1207084032000.0L) + 1801.0L/6096384000.0L) - 68909.0L/87787929600.0L) - 7403.0L/1625702400.0L) + 1846049.0L/134120448000.0L) + 139499.0L/4105728000.0L) - 117554201.0L/1120863744000.0L) - 1043321.0L/9686476800.0L) + 3677437.0L/11887948800.0L) + 10949.0L/103488000.0L) - 599971.0L/2572970400.0L) - 9.0L/777920.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/39520825344000.0L*x + 17.0L/2324754432000.0L) + 83.0L/1307674368000.0L) - 59.0L/43589145600.0L) - 1.0L/696729600.0L) + 10691.0L/114960384000.0L) - 167.0L/1397088000.0L) - 18301.0L/6096384000.0L) + 200467.0L/29262643200.0L) + 156031.0L/3251404800.0L) - 2913091.0L/22353408000.0L) - 2637347.0L/7185024000.0L) + 16131677.0L/15567552000.0L) + 11448761.0L/9686476800.0L) - 2067001.0L/660441600.0L) - 196909.0L/168168000.0L) + 105031.0L/43982400.0L) + 9.0L/70070.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/6974263296000.0L)*x - 17.0L/435891456000.0L) - 17.0L/41513472000.0L) + 83.0L/10897286400.0L) + 137.0L/9057484800.0L) - 571.0L/1026432000.0L) + 151451.0L/402361344000.0L) + 43693.0L/2286144000.0L) - 146939.0L/4180377600.0L) - 65377.0L/203212800.0L) + 33971617.0L/44706816000.0L) + 1311029.0L/513216000.0L) - 2408863267.0L/373621248000.0L) - 550937221.0L/65383718400.0L) + 4896967.0L/242611200.0L) + 9601741.0L/1135134000.0L) - 9495901.0L/605404800.0L) - 2.0L/2145.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/1743565824000.0L*x + 17.0L/116237721600.0L) + 17.0L/9340531200.0L) - 1.0L/33530112.0L) - 83.0L/922521600.0L) + 1889.0L/821145600.0L) + 199.0L/2514758400.0L) - 5147.0L/60963840.0L) + 115103.0L/1045094400.0L) + 248167.0L/162570240.0L) - 1105981.0L/372556800.0L) - 131977.0L/10264320.0L) + 654411847.0L/23351328000.0L) + 21379409.0L/484323840.0L) - 14487307.0L/155675520.0L) - 5861.0L/129360.0L) + 9397117.0L/126126000.0L) + 18.0L/3575.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/581188608000.0L)*x - 17.0L/41513472000.0L) - 3893.0L/653837184000.0L) + 269.0L/3113510400.0L) + 8941.0L/24908083200.0L) - 14321.0L/2052864000.0L) - 65903.0L/11176704000.0L) + 59273.0L/217728000.0L) - 1335239.0L/7315660800.0L) - 309691.0L/58060800.0L) + 85570171.0L/11176704000.0L) + 50693869.0L/1026432000.0L) - 1363537171.0L/15567552000.0L) - 63114127.0L/345945600.0L) + 1177851371.0L/3632428800.0L) + 9381241.0L/48048000.0L) - 9222481.0L/33633600.0L) - 63.0L/2860.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/249080832000.0L*x + 17.0L/19160064000.0L) + 697.0L/46702656000.0L) - 23.0L/119750400.0L) - 3697.0L/3558297600.0L) + 66001.0L/4105728000.0L) + 101419.0L/3592512000.0L) - 431303.0L/653184000.0L) - 2027.0L/49766400.0L) + 1618681.0L/116121600.0L) - 9174989.0L/798336000.0L) - 36951877.0L/256608000.0L) + 152331367.0L/833976000.0L) + 444183529.0L/718502400.0L) - 2003176661.0L/2335132800.0L) - 9072541.0L/12474000.0L) + 8860861.0L/10810800.0L) + 14.0L/165.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/134120448000.0L)*x - 17.0L/11176704000.0L) - 493.0L/16765056000.0L) + 281.0L/838252800.0L) + 397.0L/174182400.0L) - 29549.0L/1026432000.0L) - 8031673.0L/100590336000.0L) + 936041.0L/762048000.0L) + 2668157.0L/2438553600.0L) - 5586823.0L/203212800.0L) + 35775989.0L/11176704000.0L) + 160253299.0L/513216000.0L) - 739625771.0L/3592512000.0L) - 294484709.0L/186278400.0L) + 107051279.0L/76204800.0L) + 8190541.0L/3234000.0L) - 7873021.0L/3880800.0L) - 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/89413632000.0L*x + 17.0L/8128512000.0L) + 2329.0L/50295168000.0L) - 71.0L/152409600.0L) - 14911.0L/3832012800.0L) + 30329.0L/746496000.0L) + 32903.0L/206976000.0L) - 5408447.0L/3048192000.0L) - 47309593.0L/14631321600.0L) + 66976673.0L/1625702400.0L) + 315424951.0L/11176704000.0L) - 23225297.0L/46656000.0L) - 24429967.0L/1197504000.0L) + 95749481.0L/33868800.0L) - 231950053.0L/279417600.0L) - 3427741.0L/588000.0L) + 2792701.0L/1293600.0L) + 9.0L/5.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/73156608000.0L)*x - 17.0L/7315660800.0L) - 323.0L/5486745600.0L) + 19.0L/36578304.0L) + 5491.0L/1045094400.0L) - 71383.0L/1567641600.0L) - 2599181.0L/10973491200.0L) + 2199307.0L/1097349120.0L) + 252792397.0L/43893964800.0L) - 22981127.0L/487710720.0L) - 91172887.0L/1219276800.0L) + 91172887.0L/156764160.0L) + 1886067737.0L/3919104000.0L) - 1886067737.0L/548674560.0L) - 117868837.0L/91445760.0L) + 117868837.0L/15240960.0L) + 9778141.0L/10584000.0L) - 9778141.0L/3175200.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/73156608000.0L*x + 17.0L/8128512000.0L) + 17.0L/279936000.0L) - 71.0L/152409600.0L) - 5917.0L/1045094400.0L) + 30329.0L/746496000.0L) + 1863329.0L/6858432000.0L) - 5408447.0L/3048192000.0L) - 45384823.0L/6270566400.0L) + 66976673.0L/1625702400.0L) + 328397227.0L/3048192000.0L) - 23225297.0L/46656000.0L) - 418657681.0L/489888000.0L) + 95749481.0L/33868800.0L) + 103649251.0L/32659200.0L) - 3427741.0L/588000.0L) - 4062781.0L/1058400.0L) + 9.0L/5.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/89413632000.0L)*x - 17.0L/11176704000.0L) - 731.0L/14370048000.0L) + 281.0L/838252800.0L) + 18721.0L/3832012800.0L) - 29549.0L/1026432000.0L) - 5435131.0L/22353408000.0L) + 936041.0L/762048000.0L) + 14128099.0L/2090188800.0L) - 5586823.0L/203212800.0L) - 2350874153.0L/22353408000.0L) + 160253299.0L/513216000.0L) + 4129613923.0L/4790016000.0L) - 294484709.0L/186278400.0L) - 252469003.0L/79833600.0L) + 8190541.0L/3234000.0L) + 8508061.0L/2587200.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/134120448000.0L*x + 17.0L/19160064000.0L) + 289.0L/8382528000.0L) - 23.0L/119750400.0L) - 587.0L/174182400.0L) + 66001.0L/4105728000.0L) + 1072123.0L/6286896000.0L) - 431303.0L/653184000.0L) - 35057611.0L/7315660800.0L) + 1618681.0L/116121600.0L) + 414889873.0L/5588352000.0L) - 36951877.0L/256608000.0L) - 1053508997.0L/1796256000.0L) + 444183529.0L/718502400.0L) + 221696239.0L/114307200.0L) - 9072541.0L/12474000.0L) - 9284221.0L/5821200.0L) + 14.0L/165.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/249080832000.0L)*x - 17.0L/41513472000.0L) - 1751.0L/93405312000.0L) + 269.0L/3113510400.0L) + 199.0L/107827200.0L) - 14321.0L/2052864000.0L) - 1343389.0L/14370048000.0L) + 59273.0L/217728000.0L) + 388021.0L/149299200.0L) - 309691.0L/58060800.0L) - 6924367.0L/177408000.0L) + 50693869.0L/1026432000.0L) + 965782157.0L/3335904000.0L) - 63114127.0L/345945600.0L) - 122428519.0L/141523200.0L) + 9381241.0L/48048000.0L) + 9540001.0L/14414400.0L) - 63.0L/2860.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/581188608000.0L*x + 17.0L/116237721600.0L) + 527.0L/65383718400.0L) - 1.0L/33530112.0L) - 1793.0L/2264371200.0L) + 1889.0L/821145600.0L) + 22171.0L/558835200.0L) - 5147.0L/60963840.0L) - 7876837.0L/7315660800.0L) + 248167.0L/162570240.0L) + 17344541.0L/1117670400.0L) - 131977.0L/10264320.0L) - 26463329.0L/243243000.0L) + 21379409.0L/484323840.0L) + 10216631.0L/33022080.0L) - 5861.0L/129360.0L) - 9651133.0L/42042000.0L) + 18.0L/3575.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/1743565824000.0L)*x - 17.0L/435891456000.0L) - 1751.0L/653837184000.0L) + 83.0L/10897286400.0L) + 499.0L/1916006400.0L) - 571.0L/1026432000.0L) - 1287469.0L/100590336000.0L) + 43693.0L/2286144000.0L) + 822289.0L/2438553600.0L) - 65377.0L/203212800.0L) - 52326023.0L/11176704000.0L) + 1311029.0L/513216000.0L) + 369975061.0L/11675664000.0L) - 550937221.0L/65383718400.0L) - 2869906997.0L/32691859200.0L) + 9601741.0L/1135134000.0L) + 746737.0L/11642400.0L) - 2.0L/2145.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/6974263296000.0L*x + 17.0L/2324754432000.0L) + 289.0L/435891456000.0L) - 59.0L/43589145600.0L) - 6317.0L/99632332800.0L) + 10691.0L/114960384000.0L) + 306049.0L/100590336000.0L) - 18301.0L/6096384000.0L) - 760069.0L/9754214400.0L) + 156031.0L/3251404800.0L) + 23540441.0L/22353408000.0L) - 2637347.0L/7185024000.0L) - 651515867.0L/93405312000.0L) + 11448761.0L/9686476800.0L) + 414884083.0L/21794572800.0L) - 196909.0L/168168000.0L) - 1391323.0L/100900800.0L) + 9.0L/70070.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((19.0L/39520825344000.0L)*x - 1.0L/1162377216000.0L) - 43.0L/373621248000.0L) + 1.0L/6706022400.0L) + 1073.0L/99632332800.0L) - 79.0L/8211456000.0L) - 7517.0L/14902272000.0L) + 1801.0L/6096384000.0L) + 52799.0L/4180377600.0L) - 7403.0L/1625702400.0L) - 7491133.0L/44706816000.0L) + 139499.0L/4105728000.0L) + 136333979.0L/124540416000.0L) - 1043321.0L/9686476800.0L) - 6144839.0L/2075673600.0L) + 10949.0L/103488000.0L) + 1219787.0L/571771200.0L) - 9.0L/777920.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-19.0L/355687428096000.0L*x + 1.0L/20922789888000.0L) + 1.0L/80061696000.0L) - 1.0L/130767436800.0L) - 31.0L/27172454400.0L) + 23.0L/49268736000.0L) + 3947.0L/75442752000.0L) - 757.0L/54867456000.0L) - 16153.0L/12541132800.0L) + 2021.0L/9754214400.0L) + 1131407.0L/67060224000.0L) - 4679.0L/3079296000.0L) - 15305183.0L/140107968000.0L) + 3739217.0L/784604620800.0L) + 83131.0L/283046400.0L) - 63397.0L/13621608000.0L) - 40207.0L/190590400.0L) + 1.0L/1969110.0L;
-        poly_val[19] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/355687428096000.0L)*pow(x, 2) - 1.0L/1569209241600.0L) + 17.0L/298896998400.0L) - 619.0L/241416806400.0L) + 5473.0L/87787929600.0L) - 21713.0L/26824089600.0L) + 5839219.0L/1120863744000.0L) - 364919.0L/26153487360.0L) + 514639.0L/51459408000.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<9, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_Lagrange_n10(int deriv, double x, double *poly_val) {
+template void beta_Lagrange_n9<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n9<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct Lagrange_polynomials<10, 0>
+{
+    static constexpr int degree = 21;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.9572941063391263e-20, 4.110317623312165e-19, -4.110317623312165e-18, 2.6032011614310378e-17,
+         -1.171440522643967e-16, 3.982897776989488e-16, -1.0621060738638633e-15, 2.275941586851136e-15,
+         -3.982897776989488e-15, 5.753074566762593e-15, -6.903689480115112e-15, 6.903689480115112e-15,
+         -5.753074566762593e-15, 3.982897776989488e-15, -2.275941586851136e-15, 1.0621060738638633e-15,
+         -3.982897776989488e-16, 1.171440522643967e-16, -2.6032011614310378e-17, 4.110317623312165e-18,
+         -4.110317623312165e-19, 1.9572941063391263e-20},
+        {2.0551588116560824e-19, -3.904801742146557e-18, 3.4937699798153404e-17, -1.9524008710732782e-16,
+         7.614363397185786e-16, -2.190593777344218e-15, 4.7794773323873856e-15, -7.965795553978976e-15,
+         9.95724444247372e-15, -8.62961185014389e-15, 3.451844740057556e-15, 3.451844740057556e-15,
+         -8.62961185014389e-15, 9.95724444247372e-15, -7.965795553978976e-15, 4.7794773323873856e-15,
+         -2.190593777344218e-15, 7.614363397185786e-16, -1.9524008710732782e-16, 3.4937699798153404e-17,
+         -3.904801742146557e-18, 2.0551588116560824e-19},
+        {6.508002903577594e-18, -1.448886962217538e-16, 1.5228726794371572e-15, -1.006137248893096e-14,
+         4.691619293189088e-14, -1.6429453330081638e-13, 4.487398162074823e-13, -9.79792853139414e-13,
+         1.7385348796559113e-12, -2.5342293466589224e-12, 3.054882594950937e-12, -3.054882594950937e-12,
+         2.5342293466589224e-12, -1.7385348796559113e-12, 9.79792853139414e-13, -4.487398162074823e-13,
+         1.6429453330081638e-13, -4.691619293189088e-14, 1.006137248893096e-14, -1.5228726794371572e-15,
+         1.448886962217538e-16, -6.508002903577594e-18},
+        {-6.833403048756475e-17, 1.3764426141066612e-15, -1.2944417775215836e-14, 7.54602936669822e-14,
+         -3.049552540572907e-13, 9.036199331544901e-13, -2.0193291729336705e-12, 3.429274985987949e-12,
+         -4.3463371991397784e-12, 3.801344019988384e-12, -1.5274412974754685e-12, -1.5274412974754685e-12,
+         3.801344019988384e-12, -4.3463371991397784e-12, 3.429274985987949e-12, -2.0193291729336705e-12,
+         9.036199331544901e-13, -3.049552540572907e-13, 7.54602936669822e-14, -1.2944417775215836e-14,
+         1.3764426141066612e-15, -6.833403048756475e-17},
+        {-8.878542961205733e-16, 2.0636389107026783e-14, -2.2709838832106606e-13, 1.5691787470968377e-12,
+         -7.625880121824028e-12, 2.7697593896518128e-11, -7.802636146544601e-11, 1.7466898628542973e-10,
+         -3.1580919229082876e-10, 4.661619238314415e-10, -5.654730071849712e-10, 5.654730071849712e-10,
+         -4.661619238314415e-10, 3.1580919229082876e-10, -1.7466898628542973e-10, 7.802636146544601e-11,
+         -2.7697593896518128e-11, 7.625880121824028e-12, -1.5691787470968377e-12, 2.2709838832106606e-13,
+         -2.0636389107026783e-14, 8.878542961205733e-16},
+        {9.32247010926602e-15, -1.9604569651675443e-13, 1.9303363007290615e-12, -1.1768840603226282e-11,
+         4.956822079185619e-11, -1.523367664308497e-10, 3.5111862659450706e-10, -6.113414519990041e-10,
+         7.895229807270719e-10, -6.992428857471622e-10, 2.827365035924856e-10, 2.827365035924856e-10,
+         -6.992428857471622e-10, 7.895229807270719e-10, -6.113414519990041e-10, 3.5111862659450706e-10,
+         -1.523367664308497e-10, 4.956822079185619e-11, -1.1768840603226282e-11, 1.9303363007290615e-12,
+         -1.9604569651675443e-13, 9.32247010926602e-15},
+        {6.453637836465208e-14, -1.548434487841684e-12, 1.770082749131149e-11, -1.2775537377669012e-10,
+         6.499041172069274e-10, -2.4672794626339013e-09, 7.233650655000918e-09, -1.6746771649452484e-08,
+         3.107750932821807e-08, -4.6691926575875336e-08, 5.714758083359905e-08, -5.714758083359905e-08,
+         4.6691926575875336e-08, -3.107750932821807e-08, 1.6746771649452484e-08, -7.233650655000918e-09,
+         2.4672794626339013e-09, -6.499041172069274e-10, 1.2775537377669012e-10, -1.770082749131149e-11,
+         1.548434487841684e-12, -6.453637836465208e-14},
+        {-6.776319728288469e-13, 1.4710127634495997e-11, -1.5045703367614767e-10, 9.58165303325176e-10,
+         -4.2243767618450275e-09, 1.3570037044486459e-08, -3.255142794750413e-08, 5.86137007730837e-08,
+         -7.769377332054517e-08, 7.0037889863813e-08, -2.8573790416799526e-08, -2.8573790416799526e-08,
+         7.0037889863813e-08, -7.769377332054517e-08, 5.86137007730837e-08, -3.255142794750413e-08,
+         1.3570037044486459e-08, -4.2243767618450275e-09, 9.58165303325176e-10, -1.5045703367614767e-10,
+         1.4710127634495997e-11, -6.776319728288469e-13},
+        {-2.718512010965042e-12, 6.676038971131464e-11, -7.861812361430111e-10, 5.8925117001995334e-09,
+         -3.139593268612991e-08, 1.254696938249413e-07, -3.871316344218762e-07, 9.383086048348745e-07,
+         -1.806814542394805e-06, 2.7853472412098566e-06, -3.4541979959982914e-06, 3.4541979959982914e-06,
+         -2.7853472412098566e-06, 1.806814542394805e-06, -9.383086048348745e-07, 3.871316344218762e-07,
+         -1.254696938249413e-07, 3.139593268612991e-08, -5.8925117001995334e-09, 7.861812361430111e-10,
+         -6.676038971131464e-11, 2.718512010965042e-12},
+        {2.854437611513294e-11, -6.342237022574892e-10, 6.682540507215594e-09, -4.41938377514965e-08,
+         2.040735624598444e-07, -6.90083316037177e-07, 1.742092354898443e-06, -3.284080116922061e-06,
+         4.517036355987013e-06, -4.1780208618147845e-06, 1.7270989979991457e-06, 1.7270989979991457e-06,
+         -4.1780208618147845e-06, 4.517036355987013e-06, -3.284080116922061e-06, 1.742092354898443e-06,
+         -6.90083316037177e-07, 2.040735624598444e-07, -4.41938377514965e-08, 6.682540507215594e-09,
+         -6.342237022574892e-10, 2.854437611513294e-11},
+        {6.769569805630083e-11, -1.690519421122984e-09, 2.0354851614358755e-08, -1.5720370772648788e-07,
+         8.724805528932137e-07, -3.6810013719950143e-06, 1.209781003015564e-05, -3.1228345934769864e-05,
+         6.347200521202735e-05, -0.00010172627418793709, 0.00012872841707779154, -0.00012872841707779154,
+         0.00010172627418793709, -6.347200521202735e-05, 3.1228345934769864e-05, -1.209781003015564e-05,
+         3.6810013719950143e-06, -8.724805528932137e-07, 1.5720370772648788e-07, -2.0354851614358755e-08,
+         1.690519421122984e-09, -6.769569805630083e-11},
+        {-7.108048295911587e-10, 1.605993450066835e-08, -1.730162387220494e-07, 1.1790278079486591e-06,
+         -5.671123593805889e-06, 2.0245507545972576e-05, -5.444014513570038e-05, 0.00010929921077169452,
+         -0.00015868001303006836, 0.00015258941128190563, -6.436420853889577e-05, -6.436420853889577e-05,
+         0.00015258941128190563, -0.00015868001303006836, 0.00010929921077169452, -5.444014513570038e-05,
+         2.0245507545972576e-05, -5.671123593805889e-06, 1.1790278079486591e-06, -1.730162387220494e-07,
+         1.605993450066835e-08, -7.108048295911587e-10},
+        {-9.757835889489566e-10, 2.4654542536429275e-08, -3.016011737903658e-07, 2.3814730589277004e-06,
+         -1.3646513923703616e-05, 6.037968726085327e-05, -0.00021296595692588813, 0.0005987669266630832,
+         -0.0013205997550618535, 0.0022516600207750656, -0.002944470860968061, 0.002944470860968061,
+         -0.0022516600207750656, 0.0013205997550618535, -0.0005987669266630832, 0.00021296595692588813,
+         -6.037968726085327e-05, 1.3646513923703616e-05, -2.3814730589277004e-06, 3.016011737903658e-07,
+         -2.4654542536429275e-08, 9.757835889489566e-10},
+        {1.0245727683964045e-08, -2.3421815409607812e-07, 2.5636099772181093e-06, -1.7861047941957754e-05,
+         8.870234050407351e-05, -0.000332088279934693, 0.0009583468061664966, -0.002095684243320791,
+         0.003301499387654634, -0.0033774900311625985, 0.0014722354304840305, 0.0014722354304840305,
+         -0.0033774900311625985, 0.003301499387654634, -0.002095684243320791, 0.0009583468061664966,
+         -0.000332088279934693, 8.870234050407351e-05, -1.7861047941957754e-05, 2.5636099772181093e-06,
+         -2.3421815409607812e-07, 1.0245727683964045e-08},
+        {7.641546130555282e-09, -1.9458295914299065e-07, 2.4058694242034003e-06, -1.9286983895513265e-05,
+         0.00011303658229440606, -0.0005181605653001936, 0.0019398289854267788, -0.00606308289089726,
+         0.015192712580273465, -0.02880087535795951, 0.039904414770402075, -0.039904414770402075,
+         0.02880087535795951, -0.015192712580273465, 0.00606308289089726, -0.0019398289854267788,
+         0.0005181605653001936, -0.00011303658229440606, 1.9286983895513265e-05, -2.4058694242034003e-06,
+         1.9458295914299065e-07, -7.641546130555282e-09},
+        {-8.023623437083045e-08, 1.8485381118584112e-06, -2.0449890105728904e-05, 0.00014465237921634948,
+         -0.0007347377849136394, 0.002849883109151065, -0.008729230434420504, 0.02122079011814041,
+         -0.03798178145068366, 0.04320131303693926, -0.019952207385201037, -0.019952207385201037,
+         0.04320131303693926, -0.03798178145068366, 0.02122079011814041, -0.008729230434420504,
+         0.002849883109151065, -0.0007347377849136394, 0.00014465237921634948, -2.0449890105728904e-05,
+         1.8485381118584112e-06, -8.023623437083045e-08},
+        {-2.8572277858375878e-08, 7.309954511391014e-07, -9.097009239244399e-06, 7.360729841766608e-05,
+         -0.00043745503949263616, 0.0020506950805355374, -0.007985268860751444, 0.027013247048602244,
+         -0.08229606818195477, 0.19122656194599458, -0.29725813410908364, 0.29725813410908364,
+         -0.19122656194599458, 0.08229606818195477, -0.027013247048602244, 0.007985268860751444,
+         -0.0020506950805355374, 0.00043745503949263616, -7.360729841766608e-05, 9.097009239244399e-06,
+         -7.309954511391014e-07, 2.8572277858375878e-08},
+        {3.0000891751294673e-07, -6.944456785821464e-06, 7.73245785335774e-05, -0.0005520547381324956,
+         0.002843457756702135, -0.011278822942945455, 0.0359337098733815, -0.09454636467010787,
+         0.20574017045488693, -0.28683984291899184, 0.14862906705454182, 0.14862906705454182,
+         -0.28683984291899184, 0.20574017045488693, -0.09454636467010787, 0.0359337098733815,
+         -0.011278822942945455, 0.002843457756702135, -0.0005520547381324956, 7.73245785335774e-05,
+         -6.944456785821464e-06, 3.0000891751294673e-07},
+        {3.868704872340687e-08, -9.92054869492395e-07, 1.2385025812555131e-05, -0.00010066777187671495,
+         0.0006023769668530674, -0.0028549719242176087, 0.011334300530896872, -0.039879141428437424,
+         0.1345345549669588, -0.5070185416608778, 1.0504194337199677, -1.0504194337199677,
+         0.5070185416608778, -0.1345345549669588, 0.039879141428437424, -0.011334300530896872,
+         0.0028549719242176087, -0.0006023769668530674, 0.00010066777187671495, -1.2385025812555131e-05,
+         9.92054869492395e-07, -3.868704872340687e-08},
+        {-4.0621401159577214e-07, 9.424521260177752e-06, -0.00010527271940671861, 0.0007550082890753621,
+         -0.003915450284544938, 0.015702345583196848, -0.051004352389035924, 0.139576994999531,
+         -0.33633638741739696, 0.7605278124913166, -0.5252097168599839, -0.5252097168599839,
+         0.7605278124913166, -0.33633638741739696, 0.139576994999531, -0.051004352389035924,
+         0.015702345583196848, -0.003915450284544938, 0.0007550082890753621, -0.00010527271940671861,
+         9.424521260177752e-06, -4.0621401159577214e-07},
+        {-8.001647767655196e-09, 2.0527218829987474e-07, -2.564126642776982e-06, 2.0858695400723566e-05,
+         -0.00012496703605463082, 0.0005934385034462056, -0.002363985478748671, 0.008373884421806517,
+         -0.02872242356679635, 0.11524429208899771, -1.2446383545611752, 1.2446383545611752,
+         -0.11524429208899771, 0.02872242356679635, -0.008373884421806517, 0.002363985478748671,
+         -0.0005934385034462056, 0.00012496703605463082, -2.0858695400723566e-05, 2.564126642776982e-06,
+         -2.0527218829987474e-07, 8.001647767655196e-09},
+        {8.401730156037956e-08, -1.95008578884881e-06, 2.1795076463604346e-05, -0.00015644021550542675,
+         0.0008122857343551004, -0.003263911768954131, 0.010637934654369019, -0.029308595476322807,
+         0.07180605891699088, -0.17286643813349656, 0.6223191772805876, 0.6223191772805876,
+         -0.17286643813349656, 0.07180605891699088, -0.029308595476322807, 0.010637934654369019,
+         -0.003263911768954131, 0.0008122857343551004, -0.00015644021550542675, 2.1795076463604346e-05,
+         -1.95008578884881e-06, 8.401730156037956e-08}};
+};
+constexpr double Lagrange_polynomials<10, 0>::coefficients[22][22];
+
+template <>
+struct Lagrange_polynomials<10, 1>
+{
+    static constexpr int degree = 20;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4.110317623312165e-19, 8.631667008955546e-18, -8.631667008955546e-17, 5.46672243900518e-16,
+         -2.4600250975523306e-15, 8.364085331677924e-15, -2.2304227551141133e-14, 4.779477332387385e-14,
+         -8.364085331677924e-14, 1.2081456590201445e-13, -1.4497747908241734e-13, 1.4497747908241734e-13,
+         -1.2081456590201445e-13, 8.364085331677924e-14, -4.779477332387385e-14, 2.2304227551141133e-14,
+         -8.364085331677924e-15, 2.4600250975523306e-15, -5.46672243900518e-16, 8.631667008955546e-17,
+         -8.631667008955546e-18, 4.110317623312165e-19},
+        {4.110317623312165e-18, -7.809603484293113e-17, 6.987539959630681e-16, -3.904801742146556e-15,
+         1.522872679437157e-14, -4.381187554688436e-14, 9.55895466477477e-14, -1.5931591107957951e-13,
+         1.9914488884947438e-13, -1.725922370028778e-13, 6.903689480115112e-14, 6.903689480115112e-14,
+         -1.725922370028778e-13, 1.9914488884947438e-13, -1.5931591107957951e-13, 9.55895466477477e-14,
+         -4.381187554688436e-14, 1.522872679437157e-14, -3.904801742146556e-15, 6.987539959630681e-16,
+         -7.809603484293113e-17, 4.110317623312165e-18},
+        {1.236520551679743e-16, -2.7528852282133225e-15, 2.8934580909305985e-14, -1.9116607728968825e-13,
+         8.914076657059267e-13, -3.121596132715511e-12, 8.526056507942163e-12, -1.8616064209648867e-11,
+         3.303216271346232e-11, -4.8150357586519524e-11, 5.80427693040678e-11, -5.80427693040678e-11,
+         4.8150357586519524e-11, -3.303216271346232e-11, 1.8616064209648867e-11, -8.526056507942163e-12,
+         3.121596132715511e-12, -8.914076657059267e-13, 1.9116607728968825e-13, -2.8934580909305985e-14,
+         2.7528852282133225e-15, -1.236520551679743e-16},
+        {-1.2300125487761653e-15, 2.4775967053919902e-14, -2.3299951995388504e-13, 1.3582852860056798e-12,
+         -5.489194573031232e-12, 1.626515879678082e-11, -3.6347925112806065e-11, 6.172694974778308e-11,
+         -7.823406958451601e-11, 6.84241923597909e-11, -2.7493943354558434e-11, -2.7493943354558434e-11,
+         6.84241923597909e-11, -7.823406958451601e-11, 6.172694974778308e-11, -3.6347925112806065e-11,
+         1.626515879678082e-11, -5.489194573031232e-12, 1.3582852860056798e-12, -2.3299951995388504e-13,
+         2.4775967053919902e-14, -1.2300125487761653e-15},
+        {-1.5093523034049747e-14, 3.508186148194553e-13, -3.860672601458123e-12, 2.6676038700646238e-11,
+         -1.296399620710085e-10, 4.708590962408082e-10, -1.3264481449125821e-09, 2.9693727668523054e-09,
+         -5.3687562689440896e-09, 7.924752705134506e-09, -9.61304112214451e-09, 9.61304112214451e-09,
+         -7.924752705134506e-09, 5.3687562689440896e-09, -2.9693727668523054e-09, 1.3264481449125821e-09,
+         -4.708590962408082e-10, 1.296399620710085e-10, -2.6676038700646238e-11, 3.860672601458123e-12,
+         -3.508186148194553e-13, 1.5093523034049747e-14},
+        {1.4915952174825633e-13, -3.136731144268071e-12, 3.0885380811664984e-11, -1.883014496516205e-10,
+         7.93091532669699e-10, -2.4373882628935953e-09, 5.617898025512113e-09, -9.781463231984065e-09,
+         1.263236769163315e-08, -1.1187886171954596e-08, 4.5237840574797694e-09, 4.5237840574797694e-09,
+         -1.1187886171954596e-08, 1.263236769163315e-08, -9.781463231984065e-09, 5.617898025512113e-09,
+         -2.4373882628935953e-09, 7.93091532669699e-10, -1.883014496516205e-10, 3.0885380811664984e-11,
+         -3.136731144268071e-12, 1.4915952174825633e-13},
+        {9.680456754697813e-13, -2.322651731762526e-11, 2.6551241236967236e-10, -1.916330606650352e-09,
+         9.74856175810391e-09, -3.700919193950852e-08, 1.0850475982501376e-07, -2.5120157474178727e-07,
+         4.66162639923271e-07, -7.003788986381301e-07, 8.572137125039858e-07, -8.572137125039858e-07,
+         7.003788986381301e-07, -4.66162639923271e-07, 2.5120157474178727e-07, -1.0850475982501376e-07,
+         3.700919193950852e-08, -9.74856175810391e-09, 1.916330606650352e-09, -2.6551241236967236e-10,
+         2.322651731762526e-11, -9.680456754697813e-13},
+        {-9.486847619603856e-12, 2.0594178688294396e-10, -2.1063984714660673e-09, 1.3414314246552464e-08,
+         -5.914127466583039e-08, 1.8998051862281042e-07, -4.557199912650578e-07, 8.205918108231718e-07,
+         -1.0877128264876323e-06, 9.805304580933821e-07, -4.0003306583519335e-07, -4.0003306583519335e-07,
+         9.805304580933821e-07, -1.0877128264876323e-06, 8.205918108231718e-07, -4.557199912650578e-07,
+         1.8998051862281042e-07, -5.914127466583039e-08, 1.3414314246552464e-08, -2.1063984714660673e-09,
+         2.0594178688294396e-10, -9.486847619603856e-12},
+        {-3.534065614254555e-11, 8.678850662470904e-10, -1.0220356069859144e-08, 7.660265210259394e-08,
+         -4.081471249196888e-07, 1.6311060197242367e-06, -5.032711247484391e-06, 1.2198011862853369e-05,
+         -2.3488589051132466e-05, 3.620951413572814e-05, -4.490457394797779e-05, 4.490457394797779e-05,
+         -3.620951413572814e-05, 2.3488589051132466e-05, -1.2198011862853369e-05, 5.032711247484391e-06,
+         -1.6311060197242367e-06, 4.081471249196888e-07, -7.660265210259394e-08, 1.0220356069859144e-08,
+         -8.678850662470904e-10, 3.534065614254555e-11},
+        {3.4253251338159527e-10, -7.61068442708987e-09, 8.019048608658713e-08, -5.30326053017958e-07,
+         2.4488827495181326e-06, -8.280999792446124e-06, 2.0905108258781314e-05, -3.940896140306473e-05,
+         5.420443627184415e-05, -5.0136250341777414e-05, 2.072518797598975e-05, 2.072518797598975e-05,
+         -5.0136250341777414e-05, 5.420443627184415e-05, -3.940896140306473e-05, 2.0905108258781314e-05,
+         -8.280999792446124e-06, 2.4488827495181326e-06, -5.30326053017958e-07, 8.019048608658713e-08,
+         -7.61068442708987e-09, 3.4253251338159527e-10},
+        {7.446526786193092e-10, -1.8595713632352825e-08, 2.239033677579463e-07, -1.7292407849913668e-06,
+         9.597286081825352e-06, -4.049101509194515e-05, 0.00013307591033171205, -0.0003435118052824685,
+         0.0006981920573323008, -0.001118989016067308, 0.001416012587855707, -0.001416012587855707,
+         0.001118989016067308, -0.0006981920573323008, 0.0003435118052824685, -0.00013307591033171205,
+         4.049101509194515e-05, -9.597286081825352e-06, 1.7292407849913668e-06, -2.239033677579463e-07,
+         1.8595713632352825e-08, -7.446526786193092e-10},
+        {-7.1080482959115866e-09, 1.605993450066835e-07, -1.7301623872204941e-06, 1.1790278079486591e-05,
+         -5.671123593805889e-05, 0.00020245507545972577, -0.0005444014513570039, 0.001092992107716945,
+         -0.0015868001303006836, 0.0015258941128190565, -0.0006436420853889578, -0.0006436420853889578,
+         0.0015258941128190565, -0.0015868001303006836, 0.001092992107716945, -0.0005444014513570039,
+         0.00020245507545972577, -5.671123593805889e-05, 1.1790278079486591e-05, -1.7301623872204941e-06,
+         1.605993450066835e-07, -7.1080482959115866e-09},
+        {-8.78205230054061e-09, 2.218908828278635e-07, -2.714410564113292e-06, 2.1433257530349303e-05,
+         -0.00012281862531333254, 0.0005434171853476794, -0.0019166936123329933, 0.0053889023399677485,
+         -0.011885397795556682, 0.020264940186975593, -0.02650023774871255, 0.02650023774871255,
+         -0.020264940186975593, 0.011885397795556682, -0.0053889023399677485, 0.0019166936123329933,
+         -0.0005434171853476794, 0.00012281862531333254, -2.1433257530349303e-05, 2.714410564113292e-06,
+         -2.218908828278635e-07, 8.78205230054061e-09},
+        {8.196582147171236e-08, -1.873745232768625e-06, 2.0508879817744874e-05, -0.00014288838353566203,
+         0.0007096187240325881, -0.002656706239477544, 0.007666774449331973, -0.01676547394656633,
+         0.02641199510123707, -0.027019920249300788, 0.011777883443872244, 0.011777883443872244,
+         -0.027019920249300788, 0.02641199510123707, -0.01676547394656633, 0.007666774449331973,
+         -0.002656706239477544, 0.0007096187240325881, -0.00014288838353566203, 2.0508879817744874e-05,
+         -1.873745232768625e-06, 8.196582147171236e-08},
+        {5.349082291388697e-08, -1.3620807140009347e-06, 1.6841085969423803e-05, -0.00013500888726859285,
+         0.0007912560760608425, -0.003627123957101355, 0.013578802897987453, -0.04244158023628082,
+         0.10634898806191426, -0.20160612750571655, 0.2793309033928145, -0.2793309033928145,
+         0.20160612750571655, -0.10634898806191426, 0.04244158023628082, -0.013578802897987453,
+         0.003627123957101355, -0.0007912560760608425, 0.00013500888726859285, -1.6841085969423803e-05,
+         1.3620807140009347e-06, -5.349082291388697e-08},
+        {-4.814174062249827e-07, 1.1091228671150467e-05, -0.00012269934063437342, 0.0008679142752980968,
+         -0.004408426709481836, 0.01709929865490639, -0.05237538260652303, 0.12732474070884245,
+         -0.22789068870410198, 0.2592078782216356, -0.11971324431120621, -0.11971324431120621,
+         0.2592078782216356, -0.22789068870410198, 0.12732474070884245, -0.05237538260652303,
+         0.01709929865490639, -0.004408426709481836, 0.0008679142752980968, -0.00012269934063437342,
+         1.1091228671150467e-05, -4.814174062249827e-07},
+        {-1.428613892918794e-07, 3.654977255695507e-06, -4.5485046196221994e-05, 0.00036803649208833045,
+         -0.0021872751974631806, 0.010253475402677686, -0.03992634430375722, 0.13506623524301123,
+         -0.41148034090977387, 0.9561328097299728, -1.4862906705454182, 1.4862906705454182,
+         -0.9561328097299728, 0.41148034090977387, -0.13506623524301123, 0.03992634430375722,
+         -0.010253475402677686, 0.0021872751974631806, -0.00036803649208833045, 4.5485046196221994e-05,
+         -3.654977255695507e-06, 1.428613892918794e-07},
+        {1.200035670051787e-06, -2.7777827143285856e-05, 0.0003092983141343096, -0.0022082189525299825,
+         0.01137383102680854, -0.04511529177178182, 0.143734839493526, -0.37818545868043146,
+         0.8229606818195477, -1.1473593716759674, 0.5945162682181673, 0.5945162682181673,
+         -1.1473593716759674, 0.8229606818195477, -0.37818545868043146, 0.143734839493526,
+         -0.04511529177178182, 0.01137383102680854, -0.0022082189525299825, 0.0003092983141343096,
+         -2.7777827143285856e-05, 1.200035670051787e-06},
+        {1.1606114617022061e-07, -2.976164608477185e-06, 3.715507743766539e-05, -0.00030200331563014487,
+         0.0018071309005592022, -0.008564915772652826, 0.034002901592690614, -0.11963742428531228,
+         0.40360366490087635, -1.5210556249826332, 3.151258301159903, -3.151258301159903,
+         1.5210556249826332, -0.40360366490087635, 0.11963742428531228, -0.034002901592690614,
+         0.008564915772652826, -0.0018071309005592022, 0.00030200331563014487, -3.715507743766539e-05,
+         2.976164608477185e-06, -1.1606114617022061e-07},
+        {-8.124280231915443e-07, 1.8849042520355504e-05, -0.00021054543881343722, 0.0015100165781507242,
+         -0.007830900569089876, 0.031404691166393696, -0.10200870477807185, 0.279153989999062,
+         -0.6726727748347939, 1.5210556249826332, -1.0504194337199677, -1.0504194337199677,
+         1.5210556249826332, -0.6726727748347939, 0.279153989999062, -0.10200870477807185,
+         0.031404691166393696, -0.007830900569089876, 0.0015100165781507242, -0.00021054543881343722,
+         1.8849042520355504e-05, -8.124280231915443e-07},
+        {-8.001647767655196e-09, 2.0527218829987474e-07, -2.564126642776982e-06, 2.0858695400723566e-05,
+         -0.00012496703605463082, 0.0005934385034462056, -0.002363985478748671, 0.008373884421806517,
+         -0.02872242356679635, 0.11524429208899771, -1.2446383545611752, 1.2446383545611752,
+         -0.11524429208899771, 0.02872242356679635, -0.008373884421806517, 0.002363985478748671,
+         -0.0005934385034462056, 0.00012496703605463082, -2.0858695400723566e-05, 2.564126642776982e-06,
+         -2.0527218829987474e-07, 8.001647767655196e-09}};
+};
+constexpr double Lagrange_polynomials<10, 1>::coefficients[21][22];
+
+template <>
+struct Lagrange_polynomials<10, 2>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-8.22063524662433e-18, 1.7263334017911091e-16, -1.7263334017911092e-15, 1.0933444878010359e-14,
+         -4.920050195104661e-14, 1.6728170663355848e-13, -4.460845510228226e-13, 9.55895466477477e-13,
+         -1.6728170663355849e-12, 2.4162913180402893e-12, -2.899549581648347e-12, 2.899549581648347e-12,
+         -2.4162913180402893e-12, 1.6728170663355849e-12, -9.55895466477477e-13, 4.460845510228226e-13,
+         -1.6728170663355848e-13, 4.920050195104661e-14, -1.0933444878010359e-14, 1.7263334017911092e-15,
+         -1.7263334017911091e-16, 8.22063524662433e-18},
+        {7.809603484293113e-17, -1.4838246620156915e-15, 1.3276325923298292e-14, -7.419123310078458e-14,
+         2.8934580909305983e-13, -8.32425635390803e-13, 1.8162013863072064e-12, -3.0270023105120108e-12,
+         3.783752888140013e-12, -3.2792525030546783e-12, 1.3117010012218713e-12, 1.3117010012218713e-12,
+         -3.2792525030546783e-12, 3.783752888140013e-12, -3.0270023105120108e-12, 1.8162013863072064e-12,
+         -8.32425635390803e-13, 2.8934580909305983e-13, -7.419123310078458e-14, 1.3276325923298292e-14,
+         -1.4838246620156915e-15, 7.809603484293113e-17},
+        {2.2257369930235373e-15, -4.9551934107839804e-14, 5.208224563675077e-13, -3.4409893912143886e-12,
+         1.604533798270668e-11, -5.6188730388879196e-11, 1.5346901714295895e-10, -3.350891557736796e-10,
+         5.945789288423217e-10, -8.667064365573515e-10, 1.0447698474732205e-09, -1.0447698474732205e-09,
+         8.667064365573515e-10, -5.945789288423217e-10, 3.350891557736796e-10, -1.5346901714295895e-10,
+         5.6188730388879196e-11, -1.604533798270668e-11, 3.4409893912143886e-12, -5.208224563675077e-13,
+         4.9551934107839804e-14, -2.2257369930235373e-15},
+        {-2.091021332919481e-14, 4.211914399166383e-13, -3.9609918392160455e-12, 2.3090849862096556e-11,
+         -9.331630774153096e-11, 2.7650769954527395e-10, -6.179147269177031e-10, 1.0493581457123124e-09,
+         -1.3299791829367723e-09, 1.1632112701164453e-09, -4.673970370274934e-10, -4.673970370274934e-10,
+         1.1632112701164453e-09, -1.3299791829367723e-09, 1.0493581457123124e-09, -6.179147269177031e-10,
+         2.7650769954527395e-10, -9.331630774153096e-11, 2.3090849862096556e-11, -3.9609918392160455e-12,
+         4.211914399166383e-13, -2.091021332919481e-14},
+        {-2.4149636854479595e-13, 5.613097837111285e-12, -6.177076162332997e-11, 4.268166192103398e-10,
+         -2.074239393136136e-09, 7.533745539852931e-09, -2.1223170318601314e-08, 4.7509964269636887e-08,
+         -8.590010030310543e-08, 1.267960432821521e-07, -1.5380865795431216e-07, 1.5380865795431216e-07,
+         -1.267960432821521e-07, 8.590010030310543e-08, -4.7509964269636887e-08, 2.1223170318601314e-08,
+         -7.533745539852931e-09, 2.074239393136136e-09, -4.268166192103398e-10, 6.177076162332997e-11,
+         -5.613097837111285e-12, 2.4149636854479595e-13},
+        {2.237392826223845e-12, -4.7050967164021066e-11, 4.6328071217497473e-10, -2.824521744774308e-09,
+         1.1896372990045484e-08, -3.656082394340393e-08, 8.42684703826817e-08, -1.4672194847976098e-07,
+         1.8948551537449727e-07, -1.6781829257931895e-07, 6.785676086219654e-08, 6.785676086219654e-08,
+         -1.6781829257931895e-07, 1.8948551537449727e-07, -1.4672194847976098e-07, 8.42684703826817e-08,
+         -3.656082394340393e-08, 1.1896372990045484e-08, -2.824521744774308e-09, 4.6328071217497473e-10,
+         -4.7050967164021066e-11, 2.237392826223845e-12},
+        {1.3552639456576938e-11, -3.2517124244675364e-10, 3.7171737731754127e-09, -2.6828628493104927e-08,
+         1.3647986461345474e-07, -5.181286871531193e-07, 1.5190666375501928e-06, -3.516822046385022e-06,
+         6.5262769589257945e-06, -9.80530458093382e-06, 1.2000991975055802e-05, -1.2000991975055802e-05,
+         9.80530458093382e-06, -6.5262769589257945e-06, 3.516822046385022e-06, -1.5190666375501928e-06,
+         5.181286871531193e-07, -1.3647986461345474e-07, 2.6828628493104927e-08, -3.7171737731754127e-09,
+         3.2517124244675364e-10, -1.3552639456576938e-11},
+        {-1.2332901905485012e-10, 2.6772432294782714e-09, -2.7383180129058875e-08, 1.7438608520518203e-07,
+         -7.688365706557951e-07, 2.4697467420965353e-06, -5.924359886445752e-06, 1.0667693540701233e-05,
+         -1.4140266744339221e-05, 1.2746895955213967e-05, -5.200429855857514e-06, -5.200429855857514e-06,
+         1.2746895955213967e-05, -1.4140266744339221e-05, 1.0667693540701233e-05, -5.924359886445752e-06,
+         2.4697467420965353e-06, -7.688365706557951e-07, 1.7438608520518203e-07, -2.7383180129058875e-08,
+         2.6772432294782714e-09, -1.2332901905485012e-10},
+        {-4.2408787371054653e-10, 1.0414620794965085e-08, -1.2264427283830973e-07, 9.192318252311272e-07,
+         -4.897765499036265e-06, 1.957327223669084e-05, -6.039253496981269e-05, 0.0001463761423542404,
+         -0.0002818630686135896, 0.0004345141696287376, -0.0005388548873757335, 0.0005388548873757335,
+         -0.0004345141696287376, 0.0002818630686135896, -0.0001463761423542404, 6.039253496981269e-05,
+         -1.957327223669084e-05, 4.897765499036265e-06, -9.192318252311272e-07, 1.2264427283830973e-07,
+         -1.0414620794965085e-08, 4.2408787371054653e-10},
+        {3.767857647197548e-09, -8.371752869798857e-08, 8.820953469524585e-07, -5.833586583197538e-06,
+         2.6937710244699462e-05, -9.109099771690737e-05, 0.00022995619084659446, -0.000433498575433712,
+         0.0005962487989902857, -0.0005514987537595516, 0.00022797706773588724, 0.00022797706773588724,
+         -0.0005514987537595516, 0.0005962487989902857, -0.000433498575433712, 0.00022995619084659446,
+         -9.109099771690737e-05, 2.6937710244699462e-05, -5.833586583197538e-06, 8.820953469524585e-07,
+         -8.371752869798857e-08, 3.767857647197548e-09},
+        {7.446526786193091e-09, -1.8595713632352825e-07, 2.239033677579463e-06, -1.7292407849913665e-05,
+         9.59728608182535e-05, -0.00040491015091945155, 0.0013307591033171204, -0.0034351180528246848,
+         0.006981920573323008, -0.01118989016067308, 0.01416012587855707, -0.01416012587855707,
+         0.01118989016067308, -0.006981920573323008, 0.0034351180528246848, -0.0013307591033171204,
+         0.00040491015091945155, -9.59728608182535e-05, 1.7292407849913665e-05, -2.239033677579463e-06,
+         1.8595713632352825e-07, -7.446526786193091e-09},
+        {-6.397243466320428e-08, 1.4453941050601513e-06, -1.5571461484984447e-05, 0.00010611250271537932,
+         -0.00051040112344253, 0.001822095679137532, -0.004899613062213035, 0.009836928969452506,
+         -0.014281201172706154, 0.013733047015371508, -0.00579277876850062, -0.00579277876850062,
+         0.013733047015371508, -0.014281201172706154, 0.009836928969452506, -0.004899613062213035,
+         0.001822095679137532, -0.00051040112344253, 0.00010611250271537932, -1.5571461484984447e-05,
+         1.4453941050601513e-06, -6.397243466320428e-08},
+        {-7.025641840432488e-08, 1.775127062622908e-06, -2.1715284512906335e-05, 0.00017146606024279442,
+         -0.0009825490025066603, 0.004347337482781435, -0.015333548898663946, 0.04311121871974199,
+         -0.09508318236445346, 0.16211952149580475, -0.2120019019897004, 0.2120019019897004,
+         -0.16211952149580475, 0.09508318236445346, -0.04311121871974199, 0.015333548898663946,
+         -0.004347337482781435, 0.0009825490025066603, -0.00017146606024279442, 2.1715284512906335e-05,
+         -1.775127062622908e-06, 7.025641840432488e-08},
+        {5.737607503019865e-07, -1.3116216629380375e-05, 0.0001435621587242141, -0.0010002186847496341,
+         0.004967331068228116, -0.018596943676342806, 0.05366742114532381, -0.1173583176259643,
+         0.1848839657086595, -0.18913944174510552, 0.08244518410710572, 0.08244518410710572,
+         -0.18913944174510552, 0.1848839657086595, -0.1173583176259643, 0.05366742114532381,
+         -0.018596943676342806, 0.004967331068228116, -0.0010002186847496341, 0.0001435621587242141,
+         -1.3116216629380375e-05, 5.737607503019865e-07},
+        {3.209449374833218e-07, -8.172484284005607e-06, 0.00010104651581654282, -0.0008100533236115571,
+         0.004747536456365054, -0.021762743742608132, 0.08147281738792471, -0.2546494814176849,
+         0.6380939283714856, -1.2096367650342994, 1.6759854203568871, -1.6759854203568871,
+         1.2096367650342994, -0.6380939283714856, 0.2546494814176849, -0.08147281738792471,
+         0.021762743742608132, -0.004747536456365054, 0.0008100533236115571, -0.00010104651581654282,
+         8.172484284005607e-06, -3.209449374833218e-07},
+        {-2.4070870311249135e-06, 5.545614335575234e-05, -0.0006134967031718671, 0.004339571376490484,
+         -0.022042133547409182, 0.08549649327453195, -0.2618769130326151, 0.6366237035442123,
+         -1.13945344352051, 1.2960393911081778, -0.5985662215560311, -0.5985662215560311,
+         1.2960393911081778, -1.13945344352051, 0.6366237035442123, -0.2618769130326151,
+         0.08549649327453195, -0.022042133547409182, 0.004339571376490484, -0.0006134967031718671,
+         5.545614335575234e-05, -2.4070870311249135e-06},
+        {-5.714455571675176e-07, 1.4619909022782029e-05, -0.00018194018478488798, 0.0014721459683533218,
+         -0.008749100789852722, 0.041013901610710744, -0.1597053772150289, 0.5402649409720449,
+         -1.6459213636390955, 3.8245312389198913, -5.945162682181673, 5.945162682181673,
+         -3.8245312389198913, 1.6459213636390955, -0.5402649409720449, 0.1597053772150289,
+         -0.041013901610710744, 0.008749100789852722, -0.0014721459683533218, 0.00018194018478488798,
+         -1.4619909022782029e-05, 5.714455571675176e-07},
+        {3.600107010155361e-06, -8.333348142985756e-05, 0.0009278949424029288, -0.0066246568575899474,
+         0.03412149308042562, -0.13534587531534548, 0.43120451848057806, -1.1345563760412942,
+         2.4688820454586433, -3.4420781150279023, 1.7835488046545018, 1.7835488046545018,
+         -3.4420781150279023, 2.4688820454586433, -1.1345563760412942, 0.43120451848057806,
+         -0.13534587531534548, 0.03412149308042562, -0.0066246568575899474, 0.0009278949424029288,
+         -8.333348142985756e-05, 3.600107010155361e-06},
+        {2.3212229234044122e-07, -5.95232921695437e-06, 7.431015487533078e-05, -0.0006040066312602897,
+         0.0036142618011184044, -0.017129831545305653, 0.06800580318538123, -0.23927484857062456,
+         0.8072073298017527, -3.0421112499652665, 6.302516602319806, -6.302516602319806,
+         3.0421112499652665, -0.8072073298017527, 0.23927484857062456, -0.06800580318538123,
+         0.017129831545305653, -0.0036142618011184044, 0.0006040066312602897, -7.431015487533078e-05,
+         5.95232921695437e-06, -2.3212229234044122e-07},
+        {-8.124280231915443e-07, 1.8849042520355504e-05, -0.00021054543881343722, 0.0015100165781507242,
+         -0.007830900569089876, 0.031404691166393696, -0.10200870477807185, 0.279153989999062,
+         -0.6726727748347939, 1.5210556249826332, -1.0504194337199677, -1.0504194337199677,
+         1.5210556249826332, -0.6726727748347939, 0.279153989999062, -0.10200870477807185,
+         0.031404691166393696, -0.007830900569089876, 0.0015100165781507242, -0.00021054543881343722,
+         1.8849042520355504e-05, -8.124280231915443e-07}};
+};
+constexpr double Lagrange_polynomials<10, 2>::coefficients[20][22];
+
+template <class real_number>
+void beta_Lagrange_n10(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/51090942171709440000.0L*x + 1.0L/2432902008176640000.0L) + 1.0L/291948240981196800.0L) - 1.0L/8536498274304000.0L) - 1.0L/32011868528640000.0L) + 17.0L/1255367393280000.0L) - 503.0L/15817629155328000.0L) - 619.0L/753220435968000.0L) + 66779.0L/22596613079040000.0L) + 5473.0L/193133445120000.0L) - 14099.0L/115880067072000.0L) - 21713.0L/38626689024000.0L) + 209515049.0L/79088145776640000.0L) + 5839219.0L/941525544960000.0L) - 4353367.0L/141228831744000.0L) - 364919.0L/10461394944000.0L) + 238420331.0L/1333827855360000.0L) + 514639.0L/6175128960000.0L) - 106924511.0L/246387645504000.0L) - 1.0L/18475600.0L) + 1.0L/3527160.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2432902008176640000.0L)*x - 1.0L/121645100408832000.0L) - 41.0L/486580401635328000.0L) + 1.0L/400148356608000.0L) + 59.0L/21341245685760000.0L) - 19.0L/62768369664000.0L) + 59.0L/107602919424000.0L) + 1789.0L/94152554496000.0L) - 455633.0L/7532204359680000.0L) - 19447.0L/28970016768000.0L) + 102191.0L/38626689024000.0L) + 32699.0L/2414168064000.0L) - 112017667.0L/1883051089920000.0L) - 3558293.0L/23538138624000.0L) + 66422087.0L/94152554496000.0L) + 5040143.0L/5884534656000.0L) - 306556247.0L/74101547520000.0L) - 11419.0L/5557616064.0L) + 790297.0L/78218300160.0L) + 5.0L/3741309.0L) - 1.0L/151164.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/243290200817664000.0L*x + 1.0L/12804747411456000.0L) + 233.0L/243290200817664000.0L) - 107.0L/4268249137152000.0L) - 37.0L/711374856192000.0L) + 401.0L/125536739328000.0L) - 1429.0L/376610217984000.0L) - 78713.0L/376610217984000.0L) + 426961.0L/753220435968000.0L) + 147211.0L/19313344512000.0L) - 173941.0L/6437781504000.0L) - 3039931.0L/19313344512000.0L) + 3416723.0L/5380145971200.0L) + 336140003.0L/188305108992000.0L) - 363897701.0L/47076277248000.0L) - 53447083.0L/5230697472000.0L) + 1023220943.0L/22230464256000.0L) + 487121.0L/19760412672.0L) - 5318641.0L/46930980096.0L) - 5.0L/311168.0L) + 5.0L/67184.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/38414242234368000.0L)*x - 1.0L/2134124568576000.0L) - 37.0L/5487748890624000.0L) + 1.0L/6351561216000.0L) + 1.0L/2010164428800.0L) - 1.0L/47443968000.0L) + 10993.0L/1129830653952000.0L) + 45439.0L/31384184832000.0L) - 144587.0L/46115536896000.0L) - 25313.0L/459841536000.0L) + 201319.0L/1182449664000.0L) + 6427.0L/5474304000.0L) - 2409537919.0L/564915326976000.0L) - 106900847.0L/7846046208000.0L) + 1087177561.0L/20175547392000.0L) + 2464771.0L/31135104000.0L) - 34334629.0L/104696064000.0L) - 809.0L/4200768.0L) + 3026437.0L/3705077376.0L) + 15.0L/119119.0L) - 5.0L/9282.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/8536498274304000.0L*x + 1.0L/502146957312000.0L) + 283.0L/8536498274304000.0L) - 349.0L/502146957312000.0L) - 359.0L/118562476032000.0L) + 8147.0L/83691159552000.0L) + 9059.0L/251073478656000.0L) - 1767109.0L/251073478656000.0L) + 1077763.0L/100429391462400.0L) + 10896041.0L/38626689024000.0L) - 9330647.0L/12875563008000.0L) - 81091903.0L/12875563008000.0L) + 5021638757.0L/251073478656000.0L) + 4749355073.0L/62768369664000.0L) - 524300089.0L/1961511552000.0L) - 14119093201.0L/31384184832000.0L) + 149510878211.0L/88921857024000.0L) + 1933049.0L/1743565824.0L) - 21051859.0L/4940103168.0L) - 5.0L/6864.0L) + 5.0L/1768.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2510734786560000.0L)*x - 1.0L/156920924160000.0L) - 61.0L/502146957312000.0L) + 1.0L/435891456000.0L) + 5441.0L/418455797760000.0L) - 8741.0L/26153487360000.0L) - 109829.0L/251073478656000.0L) + 199141.0L/7846046208000.0L) - 49745219.0L/2510734786560000.0L) - 1447093.0L/1341204480000.0L) + 5418317.0L/2575112601600.0L) + 5165621.0L/201180672000.0L) - 42621719501.0L/627683696640000.0L) - 3194891431.0L/9807557760000.0L) + 31196765993.0L/31384184832000.0L) + 109639993.0L/54486432000.0L) - 28770379499.0L/4358914560000.0L) - 9587629.0L/1891890000.0L) + 104193839.0L/6054048000.0L) + 12.0L/3575.0L) - 3.0L/260.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/941525544960000.0L*x + 1.0L/62768369664000.0L) + 1.0L/2897001676800.0L) - 41.0L/6974263296000.0L) - 6551.0L/156920924160000.0L) + 9257.0L/10461394944000.0L) + 39229.0L/18830510899200.0L) - 2202649.0L/31384184832000.0L) - 4562501.0L/941525544960000.0L) + 1695689.0L/536481792000.0L) - 747037.0L/193133445120.0L) - 130451323.0L/1609445376000.0L) + 2397003491.0L/14711336640000.0L) + 17611561711.0L/15692092416000.0L) - 253178371.0L/90531302400.0L) - 3240137519.0L/435891456000.0L) + 8379111271.0L/408648240000.0L) + 1888949.0L/96864768.0L) - 20460919.0L/363242880.0L) - 15.0L/1144.0L) + 1.0L/26.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/439378587648000.0L)*x - 1.0L/31384184832000.0L) - 1.0L/1280987136000.0L) + 47.0L/3923023104000.0L) + 1087.0L/10461394944000.0L) - 9677.0L/5230697472000.0L) - 1427683.0L/219689293824000.0L) + 1192853.0L/7846046208000.0L) + 1397573.0L/8966909952000.0L) - 17379821.0L/2414168064000.0L) + 499573.0L/178827264000.0L) + 39926233.0L/201180672000.0L) - 5487440311.0L/21968929382400.0L) - 5986965079.0L/1961511552000.0L) + 3098878547.0L/560431872000.0L) + 11431199701.0L/490377888000.0L) - 16397134673.0L/326918592000.0L) - 1827209.0L/27243216.0L) + 19675939.0L/127135008.0L) + 20.0L/429.0L) - 10.0L/91.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/251073478656000.0L*x + 1.0L/19313344512000.0L) + 359.0L/251073478656000.0L) - 127.0L/6437781504000.0L) - 859.0L/4184557977600.0L) + 3329.0L/1072963584000.0L) + 266857.0L/17933819904000.0L) - 2527141.0L/9656672256000.0L) - 137469049.0L/251073478656000.0L) + 82887751.0L/6437781504000.0L) + 46068893.0L/6437781504000.0L) - 269158459.0L/715309056000.0L) + 18550682911.0L/125536739328000.0L) + 15347344853.0L/2414168064000.0L) - 49953999287.0L/7846046208000.0L) - 7656977201.0L/134120448000.0L) + 69369468211.0L/871782912000.0L) + 1650809.0L/7451136.0L) - 17523859.0L/48432384.0L) - 15.0L/88.0L) + 15.0L/52.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/173820100608000.0L)*x - 1.0L/14485008384000.0L) - 373.0L/173820100608000.0L) + 1.0L/37721376000.0L) + 9473.0L/28970016768000.0L) - 10177.0L/2414168064000.0L) - 2280613.0L/86910050304000.0L) + 1308227.0L/3621252096000.0L) + 41217097.0L/34764020121600.0L) - 87882491.0L/4828336128000.0L) - 1699387243.0L/57940033536000.0L) + 666523661.0L/1207084032000.0L) + 1995302329.0L/6207860736000.0L) - 8990599279.0L/905313024000.0L) + 8279706833.0L/10863756288000.0L) + 2517135701.0L/25147584000.0L) - 15120010711.0L/301771008000.0L) - 698249.0L/1397088.0L) + 6410659.0L/16765056.0L) + 10.0L/11.0L) - 5.0L/6.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/144850083840000.0L*x + 1.0L/13168189440000.0L) + 1.0L/376233984000.0L) - 11.0L/376233984000.0L) - 19.0L/44789760000.0L) + 209.0L/44789760000.0L) + 48127.0L/1316818944000.0L) - 529397.0L/1316818944000.0L) - 3491953.0L/1881169920000.0L) + 38411483.0L/1881169920000.0L) + 11240723.0L/197074944000.0L) - 11240723.0L/17915904000.0L) - 3451088009.0L/3292047360000.0L) + 37961968099.0L/3292047360000.0L) + 258720739.0L/23514624000.0L) - 2845928129.0L/23514624000.0L) - 27988159.0L/466560000.0L) + 307869749.0L/466560000.0L) + 178939.0L/1270080.0L) - 1968329.0L/1270080.0L) - 1.0L/11.0L) + 1;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/144850083840000.0L)*x - 1.0L/14485008384000.0L) - 79.0L/28970016768000.0L) + 1.0L/37721376000.0L) + 403.0L/894136320000.0L) - 10177.0L/2414168064000.0L) - 590459.0L/14485008384000.0L) + 1308227.0L/3621252096000.0L) + 321209461.0L/144850083840000.0L) - 87882491.0L/4828336128000.0L) - 242186803.0L/3218890752000.0L) + 666523661.0L/1207084032000.0L) + 57957677929.0L/36212520960000.0L) - 8990599279.0L/905313024000.0L) - 37902695461.0L/1810626048000.0L) + 2517135701.0L/25147584000.0L) + 40256974711.0L/251475840000.0L) - 698249.0L/1397088.0L) - 8950819.0L/13970880.0L) + 10.0L/11.0L) + 1);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/173820100608000.0L*x + 1.0L/19313344512000.0L) + 403.0L/173820100608000.0L) - 127.0L/6437781504000.0L) - 1423.0L/3621252096000.0L) + 3329.0L/1072963584000.0L) + 3186283.0L/86910050304000.0L) - 2527141.0L/9656672256000.0L) - 359857457.0L/173820100608000.0L) + 82887751.0L/6437781504000.0L) + 4245956653.0L/57940033536000.0L) - 269158459.0L/715309056000.0L) - 28265888347.0L/17382010060800.0L) + 15347344853.0L/2414168064000.0L) + 7429174631.0L/339492384000.0L) - 7656977201.0L/134120448000.0L) - 99084030211.0L/603542016000.0L) + 1650809.0L/7451136.0L) + 18793939.0L/33530112.0L) - 15.0L/88.0L) - 5.0L/12.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/251073478656000.0L)*x - 1.0L/31384184832000.0L) - 409.0L/251073478656000.0L) + 47.0L/3923023104000.0L) + 29.0L/103322419200.0L) - 9677.0L/5230697472000.0L) - 3343729.0L/125536739328000.0L) + 1192853.0L/7846046208000.0L) + 383394269.0L/251073478656000.0L) - 17379821.0L/2414168064000.0L) - 350882963.0L/6437781504000.0L) + 39926233.0L/201180672000.0L) + 75332922187.0L/62768369664000.0L) - 5986965079.0L/1961511552000.0L) - 243294646411.0L/15692092416000.0L) + 11431199701.0L/490377888000.0L) + 136706450711.0L/1307674368000.0L) - 1827209.0L/27243216.0L) - 20522659.0L/72648576.0L) + 20.0L/429.0L) + 5.0L/26.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/439378587648000.0L*x + 1.0L/62768369664000.0L) + 59.0L/62768369664000.0L) - 41.0L/6974263296000.0L) - 1709.0L/10461394944000.0L) + 9257.0L/10461394944000.0L) + 3424573.0L/219689293824000.0L) - 2202649.0L/31384184832000.0L) - 2241307.0L/2510734786560.0L) + 1695689.0L/536481792000.0L) + 50611753.0L/1609445376000.0L) - 130451323.0L/1609445376000.0L) - 36787589639.0L/54922323456000.0L) + 17611561711.0L/15692092416000.0L) + 7960300589.0L/980755776000.0L) - 3240137519.0L/435891456000.0L) - 2697612881.0L/54486432000.0L) + 1888949.0L/96864768.0L) + 21095959.0L/169513344.0L) - 15.0L/1144.0L) - 15.0L/182.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/941525544960000.0L)*x - 1.0L/156920924160000.0L) - 83.0L/188305108992000.0L) + 1.0L/435891456000.0L) + 12041.0L/156920924160000.0L) - 8741.0L/26153487360000.0L) - 2803.0L/384296140800.0L) + 199141.0L/7846046208000.0L) + 388364981.0L/941525544960000.0L) - 1447093.0L/1341204480000.0L) - 68416553.0L/4828336128000.0L) + 5165621.0L/201180672000.0L) + 68180850949.0L/235381386240000.0L) - 3194891431.0L/9807557760000.0L) - 39090845489.0L/11769069312000.0L) + 109639993.0L/54486432000.0L) + 31531616651.0L/1634592960000.0L) - 9587629.0L/1891890000.0L) - 106733999.0L/2270268000.0L) + 12.0L/3575.0L) + 2.0L/65.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2510734786560000.0L*x + 1.0L/502146957312000.0L) + 83.0L/502146957312000.0L) - 349.0L/502146957312000.0L) - 461.0L/16094453760000.0L) + 8147.0L/83691159552000.0L) + 676043.0L/251073478656000.0L) - 1767109.0L/251073478656000.0L) - 374906921.0L/2510734786560000.0L) + 10896041.0L/38626689024000.0L) + 21386987.0L/4291854336000.0L) - 81091903.0L/12875563008000.0L) - 17623242779.0L/179338199040000.0L) + 4749355073.0L/62768369664000.0L) + 17084781061.0L/15692092416000.0L) - 14119093201.0L/31384184832000.0L) - 12393013247.0L/2011806720000.0L) + 1933049.0L/1743565824.0L) + 21475219.0L/1452971520.0L) - 5.0L/6864.0L) - 1.0L/104.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/8536498274304000.0L)*x - 1.0L/2134124568576000.0L) - 59.0L/1219499753472000.0L) + 1.0L/6351561216000.0L) + 241.0L/29035708416000.0L) - 1.0L/47443968000.0L) - 192749.0L/251073478656000.0L) + 45439.0L/31384184832000.0L) + 2986523.0L/71735279616000.0L) - 25313.0L/459841536000.0L) - 355567.0L/262766592000.0L) + 6427.0L/5474304000.0L) + 652948939.0L/25107347865600.0L) - 106900847.0L/7846046208000.0L) - 1264641073.0L/4483454976000.0L) + 2464771.0L/31135104000.0L) + 475474177.0L/302455296000.0L) - 809.0L/4200768.0L) - 3078277.0L/823350528.0L) + 15.0L/119119.0L) + 15.0L/6188.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/38414242234368000.0L*x + 1.0L/12804747411456000.0L) + 409.0L/38414242234368000.0L) - 107.0L/4268249137152000.0L) - 461.0L/256094948229120.0L) + 401.0L/125536739328000.0L) + 184577.0L/1129830653952000.0L) - 78713.0L/376610217984000.0L) - 19594717.0L/2259661307904000.0L) + 147211.0L/19313344512000.0L) + 15994499.0L/57940033536000.0L) - 3039931.0L/19313344512000.0L) - 2944400801.0L/564915326976000.0L) + 336140003.0L/188305108992000.0L) + 7876103813.0L/141228831744000.0L) - 53447083.0L/5230697472000.0L) - 20537220167.0L/66691392768000.0L) + 487121.0L/19760412672.0L) + 5398021.0L/7410154752.0L) - 5.0L/311168.0L) - 5.0L/10608.0L);
-        poly_val[19] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/243290200817664000.0L)*x - 1.0L/121645100408832000.0L) - 31.0L/18714630832128000.0L) + 1.0L/400148356608000.0L) + 587.0L/2134124568576000.0L) - 19.0L/62768369664000.0L) - 9221.0L/376610217984000.0L) + 1789.0L/94152554496000.0L) + 192251.0L/150644087193600.0L) - 19447.0L/28970016768000.0L) - 772547.0L/19313344512000.0L) + 32699.0L/2414168064000.0L) + 140484011.0L/188305108992000.0L) - 3558293.0L/23538138624000.0L) - 28648583.0L/3621252096000.0L) + 5040143.0L/5884534656000.0L) + 965344741.0L/22230464256000.0L) - 11419.0L/5557616064.0L) - 2402251.0L/23465490048.0L) + 5.0L/3741309.0L) + 5.0L/75582.0L);
-        poly_val[20] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2432902008176640000.0L*x + 1.0L/2432902008176640000.0L) + 79.0L/486580401635328000.0L) - 1.0L/8536498274304000.0L) - 47.0L/1778437140480000.0L) + 17.0L/1255367393280000.0L) + 1741.0L/753220435968000.0L) - 619.0L/753220435968000.0L) - 894347.0L/7532204359680000.0L) + 5473.0L/193133445120000.0L) + 15791.0L/4291854336000.0L) - 21713.0L/38626689024000.0L) - 256228801.0L/3766102179840000.0L) + 5839219.0L/941525544960000.0L) + 421973.0L/588453465600.0L) - 364919.0L/10461394944000.0L) - 1743050333.0L/444609285120000.0L) + 514639.0L/6175128960000.0L) + 108194591.0L/11732745024000.0L) - 1.0L/18475600.0L) - 1.0L/167960.0L);
-        poly_val[21] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/51090942171709440000.0L)*pow(x, 2) - 1.0L/132703745900544000.0L) + 1.0L/831477104640000.0L) - 149.0L/1437966286848000.0L) + 10811.0L/2054237552640000.0L) - 2677.0L/16554295296000.0L) + 10684483.0L/3594915717120000.0L) - 800993.0L/25677969408000.0L) + 1473061.0L/8661219840000.0L) - 178939.0L/447977537280.0L) + 1.0L/3879876.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<10, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2432902008176640000.0L*x + 1.0L/121645100408832000.0L) + 1.0L/15365696893747200.0L) - 1.0L/474249904128000.0L) - 1.0L/1883051089920000.0L) + 17.0L/78460462080000.0L) - 503.0L/1054508610355200.0L) - 619.0L/53801459712000.0L) + 66779.0L/1738201006080000.0L) + 5473.0L/16094453760000.0L) - 14099.0L/10534551552000.0L) - 21713.0L/3862668902400.0L) + 209515049.0L/8787571752960000.0L) + 5839219.0L/117690693120000.0L) - 4353367.0L/20175547392000.0L) - 364919.0L/1743565824000.0L) + 238420331.0L/266765571072000.0L) + 514639.0L/1543782240000.0L) - 106924511.0L/82129215168000.0L) - 1.0L/9237800.0L) + 1.0L/3527160.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/115852476579840000.0L)*x - 1.0L/6082255020441600.0L) - 41.0L/25609494822912000.0L) + 1.0L/22230464256000.0L) + 59.0L/1255367393280000.0L) - 19.0L/3923023104000.0L) + 59.0L/7173527961600.0L) + 1789.0L/6725182464000.0L) - 455633.0L/579400335360000.0L) - 19447.0L/2414168064000.0L) + 102191.0L/3511517184000.0L) + 32699.0L/241416806400.0L) - 112017667.0L/209227898880000.0L) - 3558293.0L/2942267328000.0L) + 66422087.0L/13450364928000.0L) + 5040143.0L/980755776000.0L) - 306556247.0L/14820309504000.0L) - 11419.0L/1389404016.0L) + 790297.0L/26072766720.0L) + 10.0L/3741309.0L) - 1.0L/151164.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/11585247657984000.0L*x + 1.0L/640237370572800.0L) + 233.0L/12804747411456000.0L) - 107.0L/237124952064000.0L) - 37.0L/41845579776000.0L) + 401.0L/7846046208000.0L) - 1429.0L/25107347865600.0L) - 78713.0L/26900729856000.0L) + 426961.0L/57940033536000.0L) + 147211.0L/1609445376000.0L) - 173941.0L/585252864000.0L) - 3039931.0L/1931334451200.0L) + 3416723.0L/597793996800.0L) + 336140003.0L/23538138624000.0L) - 363897701.0L/6725182464000.0L) - 53447083.0L/871782912000.0L) + 1023220943.0L/4446092851200.0L) + 487121.0L/4940103168.0L) - 5318641.0L/15643660032.0L) - 5.0L/155584.0L) + 5.0L/67184.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/1829249630208000.0L)*x - 1.0L/106706228428800.0L) - 703.0L/5487748890624000.0L) + 1.0L/352864512000.0L) + 1.0L/118244966400.0L) - 1.0L/2965248000.0L) + 10993.0L/75322043596800.0L) + 45439.0L/2241727488000.0L) - 144587.0L/3547348992000.0L) - 25313.0L/38320128000.0L) + 201319.0L/107495424000.0L) + 6427.0L/547430400.0L) - 2409537919.0L/62768369664000.0L) - 106900847.0L/980755776000.0L) + 1087177561.0L/2882221056000.0L) + 2464771.0L/5189184000.0L) - 34334629.0L/20939212800.0L) - 809.0L/1050192.0L) + 3026437.0L/1235025792.0L) + 30.0L/119119.0L) - 5.0L/9282.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/406499917824000.0L*x + 1.0L/25107347865600.0L) + 5377.0L/8536498274304000.0L) - 349.0L/27897053184000.0L) - 359.0L/6974263296000.0L) + 8147.0L/5230697472000.0L) + 9059.0L/16738231910400.0L) - 1767109.0L/17933819904000.0L) + 1077763.0L/7725337804800.0L) + 10896041.0L/3218890752000.0L) - 9330647.0L/1170505728000.0L) - 81091903.0L/1287556300800.0L) + 5021638757.0L/27897053184000.0L) + 4749355073.0L/7846046208000.0L) - 524300089.0L/280215936000.0L) - 14119093201.0L/5230697472000.0L) + 149510878211.0L/17784371404800.0L) + 1933049.0L/435891456.0L) - 21051859.0L/1646701056.0L) - 5.0L/3432.0L) + 5.0L/1768.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/119558799360000.0L)*x - 1.0L/7846046208000.0L) - 1159.0L/502146957312000.0L) + 1.0L/24216192000.0L) + 92497.0L/418455797760000.0L) - 8741.0L/1634592960000.0L) - 109829.0L/16738231910400.0L) + 199141.0L/560431872000.0L) - 49745219.0L/193133445120000.0L) - 1447093.0L/111767040000.0L) + 5418317.0L/234101145600.0L) + 5165621.0L/20118067200.0L) - 42621719501.0L/69742632960000.0L) - 3194891431.0L/1225944720000.0L) + 31196765993.0L/4483454976000.0L) + 109639993.0L/9081072000.0L) - 28770379499.0L/871782912000.0L) - 9587629.0L/472972500.0L) + 104193839.0L/2018016000.0L) + 24.0L/3575.0L) - 3.0L/260.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/44834549760000.0L*x + 1.0L/3138418483200.0L) + 19.0L/2897001676800.0L) - 41.0L/387459072000.0L) - 111367.0L/156920924160000.0L) + 9257.0L/653837184000.0L) + 39229.0L/1255367393280.0L) - 2202649.0L/2241727488000.0L) - 4562501.0L/72425041920000.0L) + 1695689.0L/44706816000.0L) - 747037.0L/17557585920.0L) - 130451323.0L/160944537600.0L) + 2397003491.0L/1634592960000.0L) + 17611561711.0L/1961511552000.0L) - 253178371.0L/12933043200.0L) - 3240137519.0L/72648576000.0L) + 8379111271.0L/81729648000.0L) + 1888949.0L/24216192.0L) - 20460919.0L/121080960.0L) - 15.0L/572.0L) + 1.0L/26.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/20922789888000.0L)*x - 1.0L/1569209241600.0L) - 19.0L/1280987136000.0L) + 47.0L/217945728000.0L) + 18479.0L/10461394944000.0L) - 9677.0L/326918592000.0L) - 1427683.0L/14645952921600.0L) + 1192853.0L/560431872000.0L) + 1397573.0L/689762304000.0L) - 17379821.0L/201180672000.0L) + 499573.0L/16257024000.0L) + 39926233.0L/20118067200.0L) - 5487440311.0L/2440992153600.0L) - 5986965079.0L/245188944000.0L) + 3098878547.0L/80061696000.0L) + 11431199701.0L/81729648000.0L) - 16397134673.0L/65383718400.0L) - 1827209.0L/6810804.0L) + 19675939.0L/42378336.0L) + 40.0L/429.0L) - 10.0L/91.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/11955879936000.0L*x + 1.0L/965667225600.0L) + 6821.0L/251073478656000.0L) - 127.0L/357654528000.0L) - 14603.0L/4184557977600.0L) + 3329.0L/67060224000.0L) + 266857.0L/1195587993600.0L) - 2527141.0L/689762304000.0L) - 137469049.0L/19313344512000.0L) + 82887751.0L/536481792000.0L) + 46068893.0L/585252864000.0L) - 269158459.0L/71530905600.0L) + 18550682911.0L/13948526592000.0L) + 15347344853.0L/301771008000.0L) - 49953999287.0L/1120863744000.0L) - 7656977201.0L/22353408000.0L) + 69369468211.0L/174356582400.0L) + 1650809.0L/1862784.0L) - 17523859.0L/16144128.0L) - 15.0L/44.0L) + 15.0L/52.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/8277147648000.0L)*x - 1.0L/724250419200.0L) - 7087.0L/173820100608000.0L) + 1.0L/2095632000.0L) + 161041.0L/28970016768000.0L) - 10177.0L/150885504000.0L) - 2280613.0L/5794003353600.0L) + 1308227.0L/258660864000.0L) + 535822261.0L/34764020121600.0L) - 87882491.0L/402361344000.0L) - 1699387243.0L/5267275776000.0L) + 666523661.0L/120708403200.0L) + 1995302329.0L/689762304000.0L) - 8990599279.0L/113164128000.0L) + 8279706833.0L/1551965184000.0L) + 2517135701.0L/4191264000.0L) - 15120010711.0L/60354201600.0L) - 698249.0L/349272.0L) + 6410659.0L/5588352.0L) + 20.0L/11.0L) - 5.0L/6.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/6897623040000.0L*x + 1.0L/658409472000.0L) + 19.0L/376233984000.0L) - 11.0L/20901888000.0L) - 323.0L/44789760000.0L) + 209.0L/2799360000.0L) + 48127.0L/87787929600.0L) - 529397.0L/94058496000.0L) - 45395389.0L/1881169920000.0L) + 38411483.0L/156764160000.0L) + 11240723.0L/17915904000.0L) - 11240723.0L/1791590400.0L) - 3451088009.0L/365783040000.0L) + 37961968099.0L/411505920000.0L) + 258720739.0L/3359232000.0L) - 2845928129.0L/3919104000.0L) - 27988159.0L/93312000.0L) + 307869749.0L/116640000.0L) + 178939.0L/423360.0L) - 1968329.0L/635040.0L) - 1.0L/11.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/6897623040000.0L)*x - 1.0L/724250419200.0L) - 1501.0L/28970016768000.0L) + 1.0L/2095632000.0L) + 6851.0L/894136320000.0L) - 10177.0L/150885504000.0L) - 590459.0L/965667225600.0L) + 1308227.0L/258660864000.0L) + 4175722993.0L/144850083840000.0L) - 87882491.0L/402361344000.0L) - 242186803.0L/292626432000.0L) + 666523661.0L/120708403200.0L) + 57957677929.0L/4023613440000.0L) - 8990599279.0L/113164128000.0L) - 37902695461.0L/258660864000.0L) + 2517135701.0L/4191264000.0L) + 40256974711.0L/50295168000.0L) - 698249.0L/349272.0L) - 8950819.0L/4656960.0L) + 20.0L/11.0L) + 1;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/8277147648000.0L*x + 1.0L/965667225600.0L) + 7657.0L/173820100608000.0L) - 127.0L/357654528000.0L) - 24191.0L/3621252096000.0L) + 3329.0L/67060224000.0L) + 3186283.0L/5794003353600.0L) - 2527141.0L/689762304000.0L) - 4678146941.0L/173820100608000.0L) + 82887751.0L/536481792000.0L) + 4245956653.0L/5267275776000.0L) - 269158459.0L/71530905600.0L) - 28265888347.0L/1931334451200.0L) + 15347344853.0L/301771008000.0L) + 7429174631.0L/48498912000.0L) - 7656977201.0L/22353408000.0L) - 99084030211.0L/120708403200.0L) + 1650809.0L/1862784.0L) + 18793939.0L/11176704.0L) - 15.0L/44.0L) - 5.0L/12.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/11955879936000.0L)*x - 1.0L/1569209241600.0L) - 7771.0L/251073478656000.0L) + 47.0L/217945728000.0L) + 493.0L/103322419200.0L) - 9677.0L/326918592000.0L) - 3343729.0L/8369115955200.0L) + 1192853.0L/560431872000.0L) + 383394269.0L/19313344512000.0L) - 17379821.0L/201180672000.0L) - 350882963.0L/585252864000.0L) + 39926233.0L/20118067200.0L) + 75332922187.0L/6974263296000.0L) - 5986965079.0L/245188944000.0L) - 243294646411.0L/2241727488000.0L) + 11431199701.0L/81729648000.0L) + 136706450711.0L/261534873600.0L) - 1827209.0L/6810804.0L) - 20522659.0L/24216192.0L) + 40.0L/429.0L) + 5.0L/26.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/20922789888000.0L*x + 1.0L/3138418483200.0L) + 1121.0L/62768369664000.0L) - 41.0L/387459072000.0L) - 29053.0L/10461394944000.0L) + 9257.0L/653837184000.0L) + 3424573.0L/14645952921600.0L) - 2202649.0L/2241727488000.0L) - 2241307.0L/193133445120.0L) + 1695689.0L/44706816000.0L) + 50611753.0L/146313216000.0L) - 130451323.0L/160944537600.0L) - 36787589639.0L/6102480384000.0L) + 17611561711.0L/1961511552000.0L) + 7960300589.0L/140107968000.0L) - 3240137519.0L/72648576000.0L) - 2697612881.0L/10897286400.0L) + 1888949.0L/24216192.0L) + 21095959.0L/56504448.0L) - 15.0L/572.0L) - 15.0L/182.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/44834549760000.0L)*x - 1.0L/7846046208000.0L) - 1577.0L/188305108992000.0L) + 1.0L/24216192000.0L) + 204697.0L/156920924160000.0L) - 8741.0L/1634592960000.0L) - 2803.0L/25619742720.0L) + 199141.0L/560431872000.0L) + 388364981.0L/72425041920000.0L) - 1447093.0L/111767040000.0L) - 68416553.0L/438939648000.0L) + 5165621.0L/20118067200.0L) + 68180850949.0L/26153487360000.0L) - 3194891431.0L/1225944720000.0L) - 39090845489.0L/1681295616000.0L) + 109639993.0L/9081072000.0L) + 31531616651.0L/326918592000.0L) - 9587629.0L/472972500.0L) - 106733999.0L/756756000.0L) + 24.0L/3575.0L) + 2.0L/65.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/119558799360000.0L*x + 1.0L/25107347865600.0L) + 1577.0L/502146957312000.0L) - 349.0L/27897053184000.0L) - 7837.0L/16094453760000.0L) + 8147.0L/5230697472000.0L) + 676043.0L/16738231910400.0L) - 1767109.0L/17933819904000.0L) - 374906921.0L/193133445120000.0L) + 10896041.0L/3218890752000.0L) + 21386987.0L/390168576000.0L) - 81091903.0L/1287556300800.0L) - 17623242779.0L/19926466560000.0L) + 4749355073.0L/7846046208000.0L) + 17084781061.0L/2241727488000.0L) - 14119093201.0L/5230697472000.0L) - 12393013247.0L/402361344000.0L) + 1933049.0L/435891456.0L) + 21475219.0L/484323840.0L) - 5.0L/3432.0L) - 1.0L/104.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/406499917824000.0L)*x - 1.0L/106706228428800.0L) - 1121.0L/1219499753472000.0L) + 1.0L/352864512000.0L) + 241.0L/1707982848000.0L) - 1.0L/2965248000.0L) - 192749.0L/16738231910400.0L) + 45439.0L/2241727488000.0L) + 2986523.0L/5518098432000.0L) - 25313.0L/38320128000.0L) - 355567.0L/23887872000.0L) + 6427.0L/547430400.0L) + 652948939.0L/2789705318400.0L) - 106900847.0L/980755776000.0L) - 1264641073.0L/640493568000.0L) + 2464771.0L/5189184000.0L) + 475474177.0L/60491059200.0L) - 809.0L/1050192.0L) - 3078277.0L/274450176.0L) + 30.0L/119119.0L) + 15.0L/6188.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1829249630208000.0L*x + 1.0L/640237370572800.0L) + 7771.0L/38414242234368000.0L) - 107.0L/237124952064000.0L) - 461.0L/15064408719360.0L) + 401.0L/7846046208000.0L) + 184577.0L/75322043596800.0L) - 78713.0L/26900729856000.0L) - 19594717.0L/173820100608000.0L) + 147211.0L/1609445376000.0L) + 15994499.0L/5267275776000.0L) - 3039931.0L/1931334451200.0L) - 2944400801.0L/62768369664000.0L) + 336140003.0L/23538138624000.0L) + 7876103813.0L/20175547392000.0L) - 53447083.0L/871782912000.0L) - 20537220167.0L/13338278553600.0L) + 487121.0L/4940103168.0L) + 5398021.0L/2470051584.0L) - 5.0L/155584.0L) - 5.0L/10608.0L;
-        poly_val[19] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/11585247657984000.0L)*x - 1.0L/6082255020441600.0L) - 31.0L/984980570112000.0L) + 1.0L/22230464256000.0L) + 587.0L/125536739328000.0L) - 19.0L/3923023104000.0L) - 9221.0L/25107347865600.0L) + 1789.0L/6725182464000.0L) + 192251.0L/11588006707200.0L) - 19447.0L/2414168064000.0L) - 772547.0L/1755758592000.0L) + 32699.0L/241416806400.0L) + 140484011.0L/20922789888000.0L) - 3558293.0L/2942267328000.0L) - 28648583.0L/517321728000.0L) + 5040143.0L/980755776000.0L) + 965344741.0L/4446092851200.0L) - 11419.0L/1389404016.0L) - 2402251.0L/7821830016.0L) + 10.0L/3741309.0L) + 5.0L/75582.0L;
-        poly_val[20] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/115852476579840000.0L*x + 1.0L/121645100408832000.0L) + 79.0L/25609494822912000.0L) - 1.0L/474249904128000.0L) - 47.0L/104613949440000.0L) + 17.0L/78460462080000.0L) + 1741.0L/50214695731200.0L) - 619.0L/53801459712000.0L) - 894347.0L/579400335360000.0L) + 5473.0L/16094453760000.0L) + 15791.0L/390168576000.0L) - 21713.0L/3862668902400.0L) - 256228801.0L/418455797760000.0L) + 5839219.0L/117690693120000.0L) + 421973.0L/84064780800.0L) - 364919.0L/1743565824000.0L) - 1743050333.0L/88921857024000.0L) + 514639.0L/1543782240000.0L) + 108194591.0L/3910915008000.0L) - 1.0L/9237800.0L) - 1.0L/167960.0L;
-        poly_val[21] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/2432902008176640000.0L)*pow(x, 2) - 1.0L/6984407678976000.0L) + 1.0L/48910417920000.0L) - 149.0L/95864419123200.0L) + 10811.0L/158018273280000.0L) - 2677.0L/1504935936000.0L) + 10684483.0L/399435079680000.0L) - 800993.0L/3668281344000.0L) + 1473061.0L/1732243968000.0L) - 178939.0L/149325845760.0L) + 1.0L/3879876.0L;
+        evaluate_beta_polynomials<Lagrange_polynomials<10, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/121645100408832000.0L*x + 1.0L/6402373705728000.0L) + 1.0L/853649827430400.0L) - 1.0L/27897053184000.0L) - 1.0L/117690693120000.0L) + 17.0L/5230697472000.0L) - 503.0L/75322043596800.0L) - 619.0L/4138573824000.0L) + 66779.0L/144850083840000.0L) + 5473.0L/1463132160000.0L) - 14099.0L/1053455155200.0L) - 21713.0L/429185433600.0L) + 209515049.0L/1098446469120000.0L) + 5839219.0L/16812956160000.0L) - 4353367.0L/3362591232000.0L) - 364919.0L/348713164800.0L) + 238420331.0L/66691392768000.0L) + 514639.0L/514594080000.0L) - 106924511.0L/41064607584000.0L) - 1.0L/9237800.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/5792623828992000.0L)*x - 1.0L/320118685286400.0L) - 41.0L/1422749712384000.0L) + 1.0L/1307674368000.0L) + 59.0L/78460462080000.0L) - 19.0L/261534873600.0L) + 59.0L/512394854400.0L) + 1789.0L/517321728000.0L) - 455633.0L/48283361280000.0L) - 19447.0L/219469824000.0L) + 102191.0L/351151718400.0L) + 32699.0L/26824089600.0L) - 112017667.0L/26153487360000.0L) - 3558293.0L/420323904000.0L) + 66422087.0L/2241727488000.0L) + 5040143.0L/196151155200.0L) - 306556247.0L/3705077376000.0L) - 11419.0L/463134672.0L) + 790297.0L/13036383360.0L) + 10.0L/3741309.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/579262382899200.0L*x + 19.0L/640237370572800.0L) + 233.0L/711374856192000.0L) - 107.0L/13948526592000.0L) - 37.0L/2615348736000.0L) + 401.0L/523069747200.0L) - 1429.0L/1793381990400.0L) - 78713.0L/2069286912000.0L) + 426961.0L/4828336128000.0L) + 147211.0L/146313216000.0L) - 173941.0L/58525286400.0L) - 3039931.0L/214592716800.0L) + 3416723.0L/74724249600.0L) + 336140003.0L/3362591232000.0L) - 363897701.0L/1120863744000.0L) - 53447083.0L/174356582400.0L) + 1023220943.0L/1111523212800.0L) + 487121.0L/1646701056.0L) - 5318641.0L/7821830016.0L) - 5.0L/155584.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/91462481510400.0L)*x - 19.0L/106706228428800.0L) - 703.0L/304874938368000.0L) + 1.0L/20756736000.0L) + 1.0L/7390310400.0L) - 1.0L/197683200.0L) + 10993.0L/5380145971200.0L) + 45439.0L/172440576000.0L) - 144587.0L/295612416000.0L) - 25313.0L/3483648000.0L) + 201319.0L/10749542400.0L) + 6427.0L/60825600.0L) - 2409537919.0L/7846046208000.0L) - 106900847.0L/140107968000.0L) + 1087177561.0L/480370176000.0L) + 2464771.0L/1037836800.0L) - 34334629.0L/5234803200.0L) - 809.0L/350064.0L) + 3026437.0L/617512896.0L) + 30.0L/119119.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/20324995891200.0L*x + 19.0L/25107347865600.0L) + 5377.0L/474249904128000.0L) - 5933.0L/27897053184000.0L) - 359.0L/435891456000.0L) + 8147.0L/348713164800.0L) + 9059.0L/1195587993600.0L) - 1767109.0L/1379524608000.0L) + 1077763.0L/643778150400.0L) + 10896041.0L/292626432000.0L) - 9330647.0L/117050572800.0L) - 81091903.0L/143061811200.0L) + 5021638757.0L/3487131648000.0L) + 4749355073.0L/1120863744000.0L) - 524300089.0L/46702656000.0L) - 14119093201.0L/1046139494400.0L) + 149510878211.0L/4446092851200.0L) + 1933049.0L/145297152.0L) - 21051859.0L/823350528.0L) - 5.0L/3432.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/5977939968000.0L)*x - 19.0L/7846046208000.0L) - 1159.0L/27897053184000.0L) + 17.0L/24216192000.0L) + 92497.0L/26153487360000.0L) - 8741.0L/108972864000.0L) - 109829.0L/1195587993600.0L) + 199141.0L/43110144000.0L) - 49745219.0L/16094453760000.0L) - 1447093.0L/10160640000.0L) + 5418317.0L/23410114560.0L) + 5165621.0L/2235340800.0L) - 42621719501.0L/8717829120000.0L) - 3194891431.0L/175134960000.0L) + 31196765993.0L/747242496000.0L) + 109639993.0L/1816214400.0L) - 28770379499.0L/217945728000.0L) - 9587629.0L/157657500.0L) + 104193839.0L/1009008000.0L) + 24.0L/3575.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/2241727488000.0L*x + 19.0L/3138418483200.0L) + 19.0L/160944537600.0L) - 697.0L/387459072000.0L) - 111367.0L/9807557760000.0L) + 9257.0L/43589145600.0L) + 39229.0L/89669099520.0L) - 2202649.0L/172440576000.0L) - 4562501.0L/6035420160000.0L) + 1695689.0L/4064256000.0L) - 747037.0L/1755758592.0L) - 130451323.0L/17882726400.0L) + 2397003491.0L/204324120000.0L) + 17611561711.0L/280215936000.0L) - 253178371.0L/2155507200.0L) - 3240137519.0L/14529715200.0L) + 8379111271.0L/20432412000.0L) + 1888949.0L/8072064.0L) - 20460919.0L/60540480.0L) - 15.0L/572.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/1046139494400.0L)*x - 19.0L/1569209241600.0L) - 19.0L/71165952000.0L) + 799.0L/217945728000.0L) + 18479.0L/653837184000.0L) - 9677.0L/21794572800.0L) - 1427683.0L/1046139494400.0L) + 1192853.0L/43110144000.0L) + 1397573.0L/57480192000.0L) - 17379821.0L/18289152000.0L) + 499573.0L/1625702400.0L) + 39926233.0L/2235340800.0L) - 5487440311.0L/305124019200.0L) - 5986965079.0L/35026992000.0L) + 3098878547.0L/13343616000.0L) + 11431199701.0L/16345929600.0L) - 16397134673.0L/16345929600.0L) - 1827209.0L/2270268.0L) + 19675939.0L/21189168.0L) + 40.0L/429.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/597793996800.0L*x + 19.0L/965667225600.0L) + 6821.0L/13948526592000.0L) - 2159.0L/357654528000.0L) - 14603.0L/261534873600.0L) + 3329.0L/4470681600.0L) + 266857.0L/85399142400.0L) - 32852833.0L/689762304000.0L) - 137469049.0L/1609445376000.0L) + 82887751.0L/48771072000.0L) + 46068893.0L/58525286400.0L) - 269158459.0L/7947878400.0L) + 18550682911.0L/1743565824000.0L) + 15347344853.0L/43110144000.0L) - 49953999287.0L/186810624000.0L) - 7656977201.0L/4470681600.0L) + 69369468211.0L/43589145600.0L) + 1650809.0L/620928.0L) - 17523859.0L/8072064.0L) - 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/413857382400.0L)*x - 19.0L/724250419200.0L) - 7087.0L/9656672256000.0L) + 17.0L/2095632000.0L) + 161041.0L/1810626048000.0L) - 10177.0L/10059033600.0L) - 2280613.0L/413857382400.0L) + 17006951.0L/258660864000.0L) + 535822261.0L/2897001676800.0L) - 87882491.0L/36578304000.0L) - 1699387243.0L/526727577600.0L) + 666523661.0L/13412044800.0L) + 1995302329.0L/86220288000.0L) - 8990599279.0L/16166304000.0L) + 8279706833.0L/258660864000.0L) + 2517135701.0L/838252800.0L) - 15120010711.0L/15088550400.0L) - 698249.0L/116424.0L) + 6410659.0L/2794176.0L) + 20.0L/11.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/344881152000.0L*x + 19.0L/658409472000.0L) + 19.0L/20901888000.0L) - 187.0L/20901888000.0L) - 323.0L/2799360000.0L) + 209.0L/186624000.0L) + 48127.0L/6270566400.0L) - 6882161.0L/94058496000.0L) - 45395389.0L/156764160000.0L) + 422526313.0L/156764160000.0L) + 11240723.0L/1791590400.0L) - 11240723.0L/199065600.0L) - 3451088009.0L/45722880000.0L) + 37961968099.0L/58786560000.0L) + 258720739.0L/559872000.0L) - 2845928129.0L/783820800.0L) - 27988159.0L/23328000.0L) + 307869749.0L/38880000.0L) + 178939.0L/211680.0L) - 1968329.0L/635040.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/344881152000.0L)*x - 19.0L/724250419200.0L) - 1501.0L/1609445376000.0L) + 17.0L/2095632000.0L) + 6851.0L/55883520000.0L) - 10177.0L/10059033600.0L) - 590459.0L/68976230400.0L) + 17006951.0L/258660864000.0L) + 4175722993.0L/12070840320000.0L) - 87882491.0L/36578304000.0L) - 242186803.0L/29262643200.0L) + 666523661.0L/13412044800.0L) + 57957677929.0L/502951680000.0L) - 8990599279.0L/16166304000.0L) - 37902695461.0L/43110144000.0L) + 2517135701.0L/838252800.0L) + 40256974711.0L/12573792000.0L) - 698249.0L/116424.0L) - 8950819.0L/2328480.0L) + 20.0L/11.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/413857382400.0L*x + 19.0L/965667225600.0L) + 7657.0L/9656672256000.0L) - 2159.0L/357654528000.0L) - 24191.0L/226328256000.0L) + 3329.0L/4470681600.0L) + 3186283.0L/413857382400.0L) - 32852833.0L/689762304000.0L) - 4678146941.0L/14485008384000.0L) + 82887751.0L/48771072000.0L) + 4245956653.0L/526727577600.0L) - 269158459.0L/7947878400.0L) - 28265888347.0L/241416806400.0L) + 15347344853.0L/43110144000.0L) + 7429174631.0L/8083152000.0L) - 7656977201.0L/4470681600.0L) - 99084030211.0L/30177100800.0L) + 1650809.0L/620928.0L) + 18793939.0L/5588352.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/597793996800.0L)*x - 19.0L/1569209241600.0L) - 7771.0L/13948526592000.0L) + 799.0L/217945728000.0L) + 493.0L/6457651200.0L) - 9677.0L/21794572800.0L) - 3343729.0L/597793996800.0L) + 1192853.0L/43110144000.0L) + 383394269.0L/1609445376000.0L) - 17379821.0L/18289152000.0L) - 350882963.0L/58525286400.0L) + 39926233.0L/2235340800.0L) + 75332922187.0L/871782912000.0L) - 5986965079.0L/35026992000.0L) - 243294646411.0L/373621248000.0L) + 11431199701.0L/16345929600.0L) + 136706450711.0L/65383718400.0L) - 1827209.0L/2270268.0L) - 20522659.0L/12108096.0L) + 40.0L/429.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/1046139494400.0L*x + 19.0L/3138418483200.0L) + 1121.0L/3487131648000.0L) - 697.0L/387459072000.0L) - 29053.0L/653837184000.0L) + 9257.0L/43589145600.0L) + 3424573.0L/1046139494400.0L) - 2202649.0L/172440576000.0L) - 2241307.0L/16094453760.0L) + 1695689.0L/4064256000.0L) + 50611753.0L/14631321600.0L) - 130451323.0L/17882726400.0L) - 36787589639.0L/762810048000.0L) + 17611561711.0L/280215936000.0L) + 7960300589.0L/23351328000.0L) - 3240137519.0L/14529715200.0L) - 2697612881.0L/2724321600.0L) + 1888949.0L/8072064.0L) + 21095959.0L/28252224.0L) - 15.0L/572.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/2241727488000.0L)*x - 19.0L/7846046208000.0L) - 1577.0L/10461394944000.0L) + 17.0L/24216192000.0L) + 204697.0L/9807557760000.0L) - 8741.0L/108972864000.0L) - 19621.0L/12809871360.0L) + 199141.0L/43110144000.0L) + 388364981.0L/6035420160000.0L) - 1447093.0L/10160640000.0L) - 68416553.0L/43893964800.0L) + 5165621.0L/2235340800.0L) + 68180850949.0L/3269185920000.0L) - 3194891431.0L/175134960000.0L) - 39090845489.0L/280215936000.0L) + 109639993.0L/1816214400.0L) + 31531616651.0L/81729648000.0L) - 9587629.0L/157657500.0L) - 106733999.0L/378378000.0L) + 24.0L/3575.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/5977939968000.0L*x + 19.0L/25107347865600.0L) + 1577.0L/27897053184000.0L) - 5933.0L/27897053184000.0L) - 7837.0L/1005903360000.0L) + 8147.0L/348713164800.0L) + 676043.0L/1195587993600.0L) - 1767109.0L/1379524608000.0L) - 374906921.0L/16094453760000.0L) + 10896041.0L/292626432000.0L) + 21386987.0L/39016857600.0L) - 81091903.0L/143061811200.0L) - 17623242779.0L/2490808320000.0L) + 4749355073.0L/1120863744000.0L) + 17084781061.0L/373621248000.0L) - 14119093201.0L/1046139494400.0L) - 12393013247.0L/100590336000.0L) + 1933049.0L/145297152.0L) + 21475219.0L/242161920.0L) - 5.0L/3432.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/20324995891200.0L)*x - 19.0L/106706228428800.0L) - 1121.0L/67749986304000.0L) + 1.0L/20756736000.0L) + 241.0L/106748928000.0L) - 1.0L/197683200.0L) - 192749.0L/1195587993600.0L) + 45439.0L/172440576000.0L) + 2986523.0L/459841536000.0L) - 25313.0L/3483648000.0L) - 355567.0L/2388787200.0L) + 6427.0L/60825600.0L) + 652948939.0L/348713164800.0L) - 106900847.0L/140107968000.0L) - 1264641073.0L/106748928000.0L) + 2464771.0L/1037836800.0L) + 475474177.0L/15122764800.0L) - 809.0L/350064.0L) - 3078277.0L/137225088.0L) + 30.0L/119119.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/91462481510400.0L*x + 19.0L/640237370572800.0L) + 7771.0L/2134124568576000.0L) - 107.0L/13948526592000.0L) - 461.0L/941525544960.0L) + 401.0L/523069747200.0L) + 184577.0L/5380145971200.0L) - 78713.0L/2069286912000.0L) - 19594717.0L/14485008384000.0L) + 147211.0L/146313216000.0L) + 15994499.0L/526727577600.0L) - 3039931.0L/214592716800.0L) - 2944400801.0L/7846046208000.0L) + 336140003.0L/3362591232000.0L) + 7876103813.0L/3362591232000.0L) - 53447083.0L/174356582400.0L) - 20537220167.0L/3334569638400.0L) + 487121.0L/1646701056.0L) + 5398021.0L/1235025792.0L) - 5.0L/155584.0L;
-        poly_val[19] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1.0L/579262382899200.0L)*x - 1.0L/320118685286400.0L) - 31.0L/54721142784000.0L) + 1.0L/1307674368000.0L) + 587.0L/7846046208000.0L) - 19.0L/261534873600.0L) - 9221.0L/1793381990400.0L) + 1789.0L/517321728000.0L) + 192251.0L/965667225600.0L) - 19447.0L/219469824000.0L) - 772547.0L/175575859200.0L) + 32699.0L/26824089600.0L) + 140484011.0L/2615348736000.0L) - 3558293.0L/420323904000.0L) - 28648583.0L/86220288000.0L) + 5040143.0L/196151155200.0L) + 965344741.0L/1111523212800.0L) - 11419.0L/463134672.0L) - 2402251.0L/3910915008.0L) + 10.0L/3741309.0L;
-        poly_val[20] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1.0L/5792623828992000.0L*x + 1.0L/6402373705728000.0L) + 79.0L/1422749712384000.0L) - 1.0L/27897053184000.0L) - 47.0L/6538371840000.0L) + 17.0L/5230697472000.0L) + 1741.0L/3586763980800.0L) - 619.0L/4138573824000.0L) - 894347.0L/48283361280000.0L) + 5473.0L/1463132160000.0L) + 15791.0L/39016857600.0L) - 21713.0L/429185433600.0L) - 256228801.0L/52306974720000.0L) + 5839219.0L/16812956160000.0L) + 421973.0L/14010796800.0L) - 364919.0L/348713164800.0L) - 1743050333.0L/22230464256000.0L) + 514639.0L/514594080000.0L) + 108194591.0L/1955457504000.0L) - 1.0L/9237800.0L;
-        poly_val[21] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*((1.0L/121645100408832000.0L)*pow(x, 2) - 1.0L/388022648832000.0L) + 1.0L/3056901120000.0L) - 149.0L/6847458508800.0L) + 10811.0L/13168189440000.0L) - 2677.0L/150493593600.0L) + 10684483.0L/49929384960000.0L) - 800993.0L/611380224000.0L) + 1473061.0L/433060992000.0L) - 178939.0L/74662922880.0L);
+        evaluate_beta_polynomials<Lagrange_polynomials<10, 2>>(x, poly_val);
         break;
     }
 }
 
+template void beta_Lagrange_n10<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_Lagrange_n10<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
@@ -28,16 +28,26 @@
 
 #define LAGRANGE_POLYS
 
-void beta_Lagrange_n1(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n2(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n3(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n4(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n5(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n6(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n7(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n8(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n9(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_Lagrange_n10(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n5(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n6(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n7(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n8(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n9(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_Lagrange_n10(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//LAGRANGE_POLYS
 
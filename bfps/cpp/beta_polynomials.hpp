@@ -0,0 +1,68 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+#ifndef BETA_POLYNOMIALS
+
+#define BETA_POLYNOMIALS
+
+/** \brief Coefficient tables of the interpolation kernels.
+ *
+ *  The specializations are generated in `spline_nX.cpp` and
+ *  `Lagrange_polys.cpp`. `coefficients[k][i]` multiplies
+ *  \f$(x - 1/2)^{degree - k}\f$ in the i-th kernel value. Expanding around
+ *  the middle of the cell keeps the coefficients small enough for double
+ *  precision Horner evaluation, also for the smoothest splines.
+ */
+template <int neighbours, int smoothness, int derivative>
+struct spline_polynomials;
+
+template <int neighbours, int derivative>
+struct Lagrange_polynomials;
+
+/** \brief Horner evaluation of all the values of one kernel at once.
+ *
+ *  The inner loop runs over contiguous table entries, so it vectorizes
+ *  across the values of the kernel. With `real_number = float` the whole
+ *  evaluation is done in single precision, from the rounded coefficients.
+ */
+template <class polynomials, class real_number>
+inline void evaluate_beta_polynomials(
+        const real_number x,
+        real_number *__restrict__ poly_val)
+{
+    const real_number t = x - real_number(0.5);
+    for (int i = 0; i < polynomials::nb_values; i++)
+        poly_val[i] = real_number(polynomials::coefficients[0][i]);
+    for (int k = 1; k <= polynomials::degree; k++)
+    {
+        #pragma omp simd
+        for (int i = 0; i < polynomials::nb_values; i++)
+            poly_val[i] = poly_val[i]*t + real_number(polynomials::coefficients[k][i]);
+    }
+}
+
+#endif//BETA_POLYNOMIALS
+
@@ -25,6 +25,9 @@
 #ifndef FFTW_INTERFACE_HPP
 #define FFTW_INTERFACE_HPP
 
+#include <map>
+#include <tuple>
+#include <utility>
 #include <fftw3-mpi.h>
 
 #ifdef USE_FFTWESTIMATE
@@ -62,6 +65,30 @@ public:
         fftwf_execute(in_plan);
     }
 
+    static void mpi_execute_dft_r2c(plan in_plan, real* in, complex* out){
+        fftwf_mpi_execute_dft_r2c(in_plan, in, out);
+    }
+
+    static void mpi_execute_dft_c2r(plan in_plan, complex* in, real* out){
+        fftwf_mpi_execute_dft_c2r(in_plan, in, out);
+    }
+
+    static int alignment_of(real* ptr){
+        return fftwf_alignment_of(ptr);
+    }
+
+    static void execute_dft(plan in_plan, complex* in, complex* out){
+        fftwf_execute_dft(in_plan, in, out);
+    }
+
+    static void execute_dft_r2c(plan in_plan, real* in, complex* out){
+        fftwf_execute_dft_r2c(in_plan, in, out);
+    }
+
+    static void execute_dft_c2r(plan in_plan, complex* in, real* out){
+        fftwf_execute_dft_c2r(in_plan, in, out);
+    }
+
     static void destroy_plan(plan in_plan){
         fftwf_destroy_plan(in_plan);
     }
@@ -86,6 +113,16 @@ public:
         return fftwf_plan_guru_dft(params...);
     }
 
+    template <class ... Params>
+    static plan plan_guru_dft_r2c(Params ... params){
+        return fftwf_plan_guru_dft_r2c(params...);
+    }
+
+    template <class ... Params>
+    static plan plan_guru_dft_c2r(Params ... params){
+        return fftwf_plan_guru_dft_c2r(params...);
+    }
+
     template <class ... Params>
     static plan mpi_plan_many_dft_c2r(Params ... params){
         return fftwf_mpi_plan_many_dft_c2r(params...);
@@ -127,6 +164,30 @@ public:
         fftw_execute(in_plan);
     }
 
+    static void mpi_execute_dft_r2c(plan in_plan, real* in, complex* out){
+        fftw_mpi_execute_dft_r2c(in_plan, in, out);
+    }
+
+    static void mpi_execute_dft_c2r(plan in_plan, complex* in, real* out){
+        fftw_mpi_execute_dft_c2r(in_plan, in, out);
+    }
+
+    static int alignment_of(real* ptr){
+        return fftw_alignment_of(ptr);
+    }
+
+    static void execute_dft(plan in_plan, complex* in, complex* out){
+        fftw_execute_dft(in_plan, in, out);
+    }
+
+    static void execute_dft_r2c(plan in_plan, real* in, complex* out){
+        fftw_execute_dft_r2c(in_plan, in, out);
+    }
+
+    static void execute_dft_c2r(plan in_plan, complex* in, real* out){
+        fftw_execute_dft_c2r(in_plan, in, out);
+    }
+
     static void destroy_plan(plan in_plan){
         fftw_destroy_plan(in_plan);
     }
@@ -151,6 +212,16 @@ public:
         return fftw_plan_guru_dft(params...);
     }
 
+    template <class ... Params>
+    static plan plan_guru_dft_r2c(Params ... params){
+        return fftw_plan_guru_dft_r2c(params...);
+    }
+
+    template <class ... Params>
+    static plan plan_guru_dft_c2r(Params ... params){
+        return fftw_plan_guru_dft_c2r(params...);
+    }
+
     template <class ... Params>
     static plan mpi_plan_many_dft_c2r(Params ... params){
         return fftw_mpi_plan_many_dft_c2r(params...);
@@ -168,6 +239,99 @@ public:
 };
 
 
+/** \class fftw_plan_registry
+ *  \brief Process-wide cache of distributed in-place r2c/c2r plans.
+ *
+ *  Planning with `FFTW_PATIENT` is expensive, and fields that share a grid,
+ *  a number of components, a communicator and planner flags can use the
+ *  same plan through the new-array execute interface
+ *  (`fftw_mpi_execute_dft_r2c/c2r`), as long as the buffers they pass have
+ *  the same alignment as the buffer used for planning.
+ *  Plans are created on first request, using the array passed by the caller
+ *  (whose contents are therefore undefined after a cache miss), and are kept
+ *  until `clear` is called.
+ *  Fields keep the plans they were given, so they must not be transformed
+ *  after `clear`, which must be called before `fftw_mpi_cleanup`.
+ */
+
+template <class realtype>
+class fftw_plan_registry
+{
+    private:
+        using plan = typename fftw_interface<realtype>::plan;
+        using complex = typename fftw_interface<realtype>::complex;
+        /* key: direction, n0, n1, n2, howmany, communicator, flags, alignment */
+        using key_type = std::tuple<int,
+                                    ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
+                                    MPI_Comm,
+                                    unsigned,
+                                    int>;
+
+        static std::map<key_type, plan> &get_plans()
+        {
+            static std::map<key_type, plan> plans;
+            return plans;
+        }
+
+    public:
+        static plan get_r2c(
+                const ptrdiff_t *n,
+                const ptrdiff_t howmany,
+                realtype *data,
+                const MPI_Comm comm,
+                const unsigned flags)
+        {
+            const key_type key(FFTW_FORWARD, n[0], n[1], n[2], howmany, comm, flags,
+                               fftw_interface<realtype>::alignment_of(data));
+            auto found = get_plans().find(key);
+            if (found != get_plans().end())
+                return found->second;
+            plan new_plan = fftw_interface<realtype>::mpi_plan_many_dft_r2c(
+                    3, n, howmany,
+                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+                    data,
+                    (complex*)data,
+                    comm,
+                    flags);
+            get_plans()[key] = new_plan;
+            return new_plan;
+        }
+
+        static plan get_c2r(
+                const ptrdiff_t *n,
+                const ptrdiff_t howmany,
+                realtype *data,
+                const MPI_Comm comm,
+                const unsigned flags)
+        {
+            const key_type key(FFTW_BACKWARD, n[0], n[1], n[2], howmany, comm, flags,
+                               fftw_interface<realtype>::alignment_of(data));
+            auto found = get_plans().find(key);
+            if (found != get_plans().end())
+                return found->second;
+            plan new_plan = fftw_interface<realtype>::mpi_plan_many_dft_c2r(
+                    3, n, howmany,
+                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+                    (complex*)data,
+                    data,
+                    comm,
+                    flags);
+            get_plans()[key] = new_plan;
+            return new_plan;
+        }
+
+        static int size()
+        {
+            return int(get_plans().size());
+        }
+
+        static void clear()
+        {
+            for (auto kv : get_plans())
+                fftw_interface<realtype>::destroy_plan(kv.second);
+            get_plans().clear();
+        }
+};
 
 #endif // FFTW_INTERFACE_HPP
 
@@ -27,13 +27,38 @@
 #include <cmath>
 #include <cstdlib>
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <map>
+#include <vector>
 #include "field.hpp"
+#include "field_pool.hpp"
+#include "rspace_stats.hpp"
 #include "scope_timer.hpp"
-#include "shared_array.hpp"
 
 
 
+/* set a real space array to zero with the same thread partition as `RLOOP`.
+ * with the usual first-touch page placement, memory then ends up on the
+ * NUMA domain of the threads that work on it in `RLOOP` and `CLOOP` */
+template <typename rnumber,
+          field_components fc>
+static void first_touch_zero(
+        rnumber *__restrict__ data,
+        const field_layout<fc> *rmemlayout)
+{
+    const ptrdiff_t row_size = rmemlayout->subsizes[2]*ncomp(fc);
+    #pragma omp parallel
+    {
+        const hsize_t start = OmpUtils::ForIntervalStart(rmemlayout->subsizes[1]);
+        const hsize_t end = OmpUtils::ForIntervalEnd(rmemlayout->subsizes[1]);
+        for (hsize_t zindex = 0; zindex < rmemlayout->subsizes[0]; zindex++)
+            std::fill_n(data + (zindex*rmemlayout->subsizes[1] + start)*row_size,
+                        (end - start)*row_size,
+                        rnumber(0));
+    }
+}
+
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -51,6 +76,15 @@ field<rnumber, be, fc>::field(
 
     this->fftw_plan_rigor = FFTW_PLAN_RIGOR;
     this->real_space_representation = true;
+    this->pencil = nullptr;
+    this->truncation = nullptr;
+    this->io_chunk_planes = -1;
+    this->io_deflate_level = 0;
+    std::fill_n(this->io_band, 3, 0);
+    if (getenv("BFPS_IO_CHUNK_PLANES") != nullptr)
+        this->io_chunk_planes = atoi(getenv("BFPS_IO_CHUNK_PLANES"));
+    if (getenv("BFPS_IO_DEFLATE_LEVEL") != nullptr)
+        this->io_deflate_level = atoi(getenv("BFPS_IO_DEFLATE_LEVEL"));
 
     /* generate HDF5 data types */
     if (typeid(rnumber) == typeid(float))
@@ -101,25 +135,94 @@ field<rnumber, be, fc>::field(
                     sizes, subsizes, starts, this->comm);
             this->data = fftw_interface<rnumber>::alloc_real(
                     this->rmemlayout->local_size);
-            memset(this->data, 0, sizeof(rnumber)*this->rmemlayout->local_size);
-            this->c2r_plan = fftw_interface<rnumber>::mpi_plan_many_dft_c2r(
-                    3, nfftw, ncomp(fc),
-                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
-                    (typename fftw_interface<rnumber>::complex*)this->data,
+            /* plans are shared between all fields with the same shape,
+             * communicator and rigor, see `fftw_plan_registry` */
+            this->c2r_plan = fftw_plan_registry<rnumber>::get_c2r(
+                    nfftw, ncomp(fc),
                     this->data,
                     this->comm,
                     this->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_IN);
-            this->r2c_plan = fftw_interface<rnumber>::mpi_plan_many_dft_r2c(
-                    3, nfftw, ncomp(fc),
-                    FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK,
+            this->r2c_plan = fftw_plan_registry<rnumber>::get_r2c(
+                    nfftw, ncomp(fc),
                     this->data,
-                    (typename fftw_interface<rnumber>::complex*)this->data,
                     this->comm,
                     this->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_OUT);
+            /* first touch happens after planning, which overwrites the array.
+             * plans found in the registry never touch it, so only the first
+             * field of each shape has its pages placed by the planner */
+            first_touch_zero(this->data, this->rmemlayout);
+            break;
+        case PENCIL:
+            {
+                /* transforms are shared between all fields with the same shape,
+                 * communicator and rigor, see `pencil_fft` */
+                this->pencil = pencil_fft<rnumber>::get(
+                        nx, ny, nz, ncomp(fc),
+                        this->comm,
+                        this->fftw_plan_rigor);
+                hsize_t sizes[3], subsizes[3], starts[3];
+                sizes[0] = nz; sizes[1] = ny; sizes[2] = nx;
+                subsizes[0] = this->pencil->local_nz; subsizes[1] = this->pencil->local_ny; subsizes[2] = nx;
+                starts[0] = this->pencil->local_z_start; starts[1] = this->pencil->local_y_start; starts[2] = 0;
+                this->rlayout = new field_layout<fc>(
+                        sizes, subsizes, starts, this->comm);
+                this->npoints = this->rlayout->full_size / ncomp(fc);
+                sizes[2] = this->pencil->rmem_nx;
+                subsizes[2] = this->pencil->rmem_nx;
+                this->rmemlayout = new field_layout<fc>(
+                        sizes, subsizes, starts, this->comm);
+                sizes[0] = ny; sizes[1] = nz; sizes[2] = nx/2+1;
+                subsizes[0] = this->pencil->local_nky; subsizes[1] = nz; subsizes[2] = this->pencil->local_nkx;
+                starts[0] = this->pencil->local_ky_start; starts[1] = 0; starts[2] = this->pencil->local_kx_start;
+                this->clayout = new field_layout<fc>(
+                        sizes, subsizes, starts, this->comm);
+                this->data = fftw_interface<rnumber>::alloc_real(
+                        this->rmemlayout->local_size);
+                first_touch_zero(this->data, this->rmemlayout);
+            }
             break;
     }
 }
 
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+field<rnumber, be, fc>::field(
+                const field<rnumber, be, fc> &src,
+                const MPI_Comm COMM_TO_USE)
+{
+    TIMEZONE("field::field");
+    this->comm = COMM_TO_USE;
+    MPI_Comm_rank(this->comm, &this->myrank);
+    MPI_Comm_size(this->comm, &this->nprocs);
+
+    this->fftw_plan_rigor = src.fftw_plan_rigor;
+    this->real_space_representation = src.real_space_representation;
+    this->pencil = nullptr;
+    this->truncation = nullptr;
+    this->c2r_plan = nullptr;
+    this->r2c_plan = nullptr;
+    this->io_chunk_planes = src.io_chunk_planes;
+    this->io_deflate_level = src.io_deflate_level;
+    std::copy(src.io_band, src.io_band + 3, this->io_band);
+    this->rnumber_H5T = H5Tcopy(src.rnumber_H5T);
+    this->cnumber_H5T = H5Tcopy(src.cnumber_H5T);
+
+    this->rlayout = new field_layout<fc>(
+            src.rlayout->sizes, src.rlayout->subsizes, src.rlayout->starts,
+            this->comm);
+    this->npoints = src.npoints;
+    this->rmemlayout = new field_layout<fc>(
+            src.rmemlayout->sizes, src.rmemlayout->subsizes, src.rmemlayout->starts,
+            this->comm);
+    this->clayout = new field_layout<fc>(
+            src.clayout->sizes, src.clayout->subsizes, src.clayout->starts,
+            this->comm);
+    this->data = fftw_interface<rnumber>::alloc_real(
+            this->rmemlayout->local_size);
+    first_touch_zero(this->data, this->rmemlayout);
+}
+
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -131,12 +234,12 @@ field<rnumber, be, fc>::~field()
     switch(be)
     {
         case FFTW:
+        case PENCIL:
             delete this->rlayout;
             delete this->rmemlayout;
             delete this->clayout;
             fftw_interface<rnumber>::free(this->data);
-            fftw_interface<rnumber>::destroy_plan(this->c2r_plan);
-            fftw_interface<rnumber>::destroy_plan(this->r2c_plan);
+            /* plans belong to `fftw_plan_registry` or `pencil_fft` */
             break;
     }
 }
@@ -147,7 +250,23 @@ template <typename rnumber,
 void field<rnumber, be, fc>::ift()
 {
     TIMEZONE("field::ift");
-    fftw_interface<rnumber>::execute(this->c2r_plan);
+    switch(be)
+    {
+        case FFTW:
+            assert(this->c2r_plan != nullptr || this->truncation != nullptr);
+            if (this->truncation != nullptr)
+                this->truncation->c2r(this->get_cdata());
+            else
+                fftw_interface<rnumber>::mpi_execute_dft_c2r(
+                        this->c2r_plan,
+                        this->get_cdata(),
+                        this->data);
+            break;
+        case PENCIL:
+            assert(this->pencil != nullptr);
+            this->pencil->c2r(this->get_cdata());
+            break;
+    }
     this->real_space_representation = true;
 }
 
@@ -157,10 +276,387 @@ template <typename rnumber,
 void field<rnumber, be, fc>::dft()
 {
     TIMEZONE("field::dft");
-    fftw_interface<rnumber>::execute(this->r2c_plan);
+    switch(be)
+    {
+        case FFTW:
+            assert(this->r2c_plan != nullptr || this->truncation != nullptr);
+            if (this->truncation != nullptr)
+                this->truncation->r2c(this->data);
+            else
+                fftw_interface<rnumber>::mpi_execute_dft_r2c(
+                        this->r2c_plan,
+                        this->data,
+                        this->get_cdata());
+            break;
+        case PENCIL:
+            assert(this->pencil != nullptr);
+            this->pencil->r2c(this->data);
+            break;
+    }
     this->real_space_representation = false;
 }
 
+/* copy `block` numbers per grid point from each of the `src` arrays into
+ * `dst`, such that the blocks of all arrays are contiguous for every point */
+template <typename rnumber>
+static void interleave_arrays(
+        const std::vector<rnumber*> &src,
+        rnumber *__restrict__ dst,
+        const ptrdiff_t npoints,
+        const ptrdiff_t block)
+{
+    const ptrdiff_t narrays = src.size();
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(npoints);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(npoints);
+        for (ptrdiff_t ii = start; ii < end; ii++)
+            for (ptrdiff_t aa = 0; aa < narrays; aa++)
+                std::copy(src[aa] + ii*block,
+                          src[aa] + (ii+1)*block,
+                          dst + (ii*narrays + aa)*block);
+    }
+}
+
+/* inverse of `interleave_arrays` */
+template <typename rnumber>
+static void deinterleave_arrays(
+        const rnumber *__restrict__ src,
+        const std::vector<rnumber*> &dst,
+        const ptrdiff_t npoints,
+        const ptrdiff_t block)
+{
+    const ptrdiff_t narrays = dst.size();
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(npoints);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(npoints);
+        for (ptrdiff_t ii = start; ii < end; ii++)
+            for (ptrdiff_t aa = 0; aa < narrays; aa++)
+                std::copy(src + (ii*narrays + aa)*block,
+                          src + (ii*narrays + aa + 1)*block,
+                          dst[aa] + ii*block);
+    }
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field<rnumber, be, fc>::dft_many(
+        const std::vector<field<rnumber, be, fc>*> &fields,
+        field_pool<rnumber, be> *pool)
+{
+    TIMEZONE("field::dft_many");
+    field<rnumber, be, fc> *f0 = fields[0];
+    /* truncated transforms skip most of the transposed data already, so
+     * fields are transformed one by one, in place */
+    if (fields.size() == 1 || f0->truncation != nullptr)
+    {
+        for (auto ff : fields)
+            ff->dft();
+        return;
+    }
+    std::vector<rnumber*> arrays;
+    for (auto ff : fields)
+    {
+        assert(ff->real_space_representation);
+        assert(ff->rmemlayout->local_size == f0->rmemlayout->local_size);
+        arrays.push_back((rnumber*)(ff->data));
+    }
+    const ptrdiff_t howmany = fields.size()*ncomp(fc);
+    assert(howmany <= ptrdiff_t(ncomp(THREExTHREE)));
+    auto staging = pool->template get<THREExTHREE>();
+    rnumber *buffer = staging->get_rdata();
+    /* planning may overwrite the buffer, so it comes before packing */
+    typename fftw_interface<rnumber>::plan r2c_plan;
+    pencil_fft<rnumber> *pencil;
+    switch(be)
+    {
+        case FFTW:
+            ptrdiff_t nfftw[3];
+            nfftw[0] = f0->rlayout->sizes[0];
+            nfftw[1] = f0->rlayout->sizes[1];
+            nfftw[2] = f0->rlayout->sizes[2];
+            r2c_plan = fftw_plan_registry<rnumber>::get_r2c(
+                    nfftw, howmany,
+                    buffer,
+                    f0->comm,
+                    f0->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_OUT);
+            break;
+        case PENCIL:
+            pencil = pencil_fft<rnumber>::get(
+                    f0->rlayout->sizes[2], f0->rlayout->sizes[1], f0->rlayout->sizes[0],
+                    howmany,
+                    f0->comm,
+                    f0->fftw_plan_rigor);
+            break;
+    }
+    interleave_arrays<rnumber>(
+            arrays, buffer,
+            f0->rmemlayout->local_size / ncomp(fc),
+            ncomp(fc));
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::mpi_execute_dft_r2c(
+                    r2c_plan,
+                    buffer,
+                    (typename fftw_interface<rnumber>::complex*)buffer);
+            break;
+        case PENCIL:
+            pencil->r2c(buffer);
+            break;
+    }
+    deinterleave_arrays<rnumber>(
+            buffer, arrays,
+            f0->clayout->local_size / ncomp(fc),
+            2*ncomp(fc));
+    for (auto ff : fields)
+        ff->real_space_representation = false;
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field<rnumber, be, fc>::ift_many(
+        const std::vector<field<rnumber, be, fc>*> &fields,
+        field_pool<rnumber, be> *pool)
+{
+    TIMEZONE("field::ift_many");
+    field<rnumber, be, fc> *f0 = fields[0];
+    if (fields.size() == 1 || f0->truncation != nullptr)
+    {
+        for (auto ff : fields)
+            ff->ift();
+        return;
+    }
+    std::vector<rnumber*> arrays;
+    for (auto ff : fields)
+    {
+        assert(!ff->real_space_representation);
+        assert(ff->rmemlayout->local_size == f0->rmemlayout->local_size);
+        arrays.push_back((rnumber*)(ff->data));
+    }
+    const ptrdiff_t howmany = fields.size()*ncomp(fc);
+    assert(howmany <= ptrdiff_t(ncomp(THREExTHREE)));
+    auto staging = pool->template get<THREExTHREE>();
+    rnumber *buffer = staging->get_rdata();
+    /* planning may overwrite the buffer, so it comes before packing */
+    typename fftw_interface<rnumber>::plan c2r_plan;
+    pencil_fft<rnumber> *pencil;
+    switch(be)
+    {
+        case FFTW:
+            ptrdiff_t nfftw[3];
+            nfftw[0] = f0->rlayout->sizes[0];
+            nfftw[1] = f0->rlayout->sizes[1];
+            nfftw[2] = f0->rlayout->sizes[2];
+            c2r_plan = fftw_plan_registry<rnumber>::get_c2r(
+                    nfftw, howmany,
+                    buffer,
+                    f0->comm,
+                    f0->fftw_plan_rigor | FFTW_MPI_TRANSPOSED_IN);
+            break;
+        case PENCIL:
+            pencil = pencil_fft<rnumber>::get(
+                    f0->rlayout->sizes[2], f0->rlayout->sizes[1], f0->rlayout->sizes[0],
+                    howmany,
+                    f0->comm,
+                    f0->fftw_plan_rigor);
+            break;
+    }
+    interleave_arrays<rnumber>(
+            arrays, buffer,
+            f0->clayout->local_size / ncomp(fc),
+            2*ncomp(fc));
+    switch(be)
+    {
+        case FFTW:
+            fftw_interface<rnumber>::mpi_execute_dft_c2r(
+                    c2r_plan,
+                    (typename fftw_interface<rnumber>::complex*)buffer,
+                    buffer);
+            break;
+        case PENCIL:
+            pencil->c2r((typename fftw_interface<rnumber>::complex*)buffer);
+            break;
+    }
+    deinterleave_arrays<rnumber>(
+            buffer, arrays,
+            f0->rmemlayout->local_size / ncomp(fc),
+            ncomp(fc));
+    for (auto ff : fields)
+        ff->real_space_representation = true;
+}
+
+/* dataset creation property list for `io` and `io_database`.
+ * the dataset has ndims dimensions of sizes dims, and it is distributed
+ * along dimension dist_dim, where this rank holds local_planes planes.
+ * chunks span all other dimensions (with a single entry along any leading
+ * time dimension), see `field::io_chunk_planes` for their thickness.
+ * must be called by all ranks of comm */
+static hid_t create_field_dcpl(
+        const int ndims,
+        const hsize_t *dims,
+        const int dist_dim,
+        const hsize_t local_planes,
+        const size_t element_size,
+        int chunk_planes,
+        const int deflate_level,
+        const bool need_chunks,
+        const MPI_Comm comm)
+{
+    hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    if (chunk_planes < 0 && (need_chunks || deflate_level > 0))
+        chunk_planes = 0;
+    if (chunk_planes < 0)
+        return dcpl;
+    hsize_t plane_bytes = element_size;
+    std::vector<hsize_t> chunk(dims, dims + ndims);
+    for (int i = 0; i < dist_dim; i++)
+        chunk[i] = 1;
+    for (int i = dist_dim+1; i < ndims; i++)
+        plane_bytes *= dims[i];
+    if (chunk_planes == 0)
+    {
+        /* one slab per chunk, or the largest divisor of the slab that
+         * keeps chunks well below the 4GB limit of HDF5 */
+        hsize_t slab_planes = local_planes;
+        MPI_Allreduce(MPI_IN_PLACE, &slab_planes, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+        const hsize_t max_chunk_bytes = hsize_t(1) << 30;
+        hsize_t planes = std::max(slab_planes, hsize_t(1));
+        while (planes > 1 && planes*plane_bytes > max_chunk_bytes)
+        {
+            planes--;
+            while (slab_planes % planes != 0)
+                planes--;
+        }
+        chunk[dist_dim] = planes;
+    }
+    else
+        chunk[dist_dim] = std::min(hsize_t(chunk_planes), dims[dist_dim]);
+    chunk[dist_dim] = std::max(chunk[dist_dim], hsize_t(1));
+    H5Pset_chunk(dcpl, ndims, &chunk.front());
+    if (deflate_level > 0)
+    {
+        if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+        {
+            H5Pset_shuffle(dcpl);
+            H5Pset_deflate(dcpl, std::min(deflate_level, 9));
+        }
+        else
+            DEBUG_MSG("deflate filter not available, field is stored uncompressed\n");
+    }
+    return dcpl;
+}
+
+/* collective MPI-IO transfers for `io` and `io_database` */
+static hid_t create_collective_dxpl()
+{
+    hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    return dxpl;
+}
+
+/* ranks without data still take part in collective transfers, with empty
+ * selections */
+static void select_local_hyperslab(
+        const hid_t space,
+        const hsize_t *offset,
+        const hsize_t *count,
+        const int ndims)
+{
+    if (std::find(count, count + ndims, hsize_t(0)) != count + ndims)
+        H5Sselect_none(space);
+    else
+        H5Sselect_hyperslab(space, H5S_SELECT_SET, offset, NULL, count, NULL);
+}
+
+/* select the local modes of a Fourier space array that lie inside the band
+ * of a truncated dataset (see `field::use_truncated_io`), in both the memory
+ * space (the local array) and the file space (the band).
+ * along the first two axes the band holds the indices 0..M and n-M..n-1,
+ * along the third one the indices 0..band-1, and the other axes are
+ * complete */
+static void select_band_hyperslabs(
+        const hid_t mspace,
+        const hid_t fspace,
+        const int ndims,
+        const hsize_t *sizes,
+        const hsize_t *band,
+        const hsize_t *starts,
+        const hsize_t *counts)
+{
+    /* for each axis, blocks of {memory offset, file offset, count} */
+    std::vector<std::vector<std::array<hsize_t, 3>>> blocks(ndims);
+    for (int i = 0; i < ndims; i++)
+    {
+        /* segments of {global offset, file offset, count} */
+        std::vector<std::array<hsize_t, 3>> segments;
+        if (band[i] == sizes[i] || i == 2)
+            segments.push_back({0, 0, band[i]});
+        else
+        {
+            const hsize_t M = (band[i] - 1) / 2;
+            segments.push_back({0, 0, M+1});
+            segments.push_back({sizes[i] - M, M+1, M});
+        }
+        for (auto &segment : segments)
+        {
+            const hsize_t lo = std::max(segment[0], starts[i]);
+            const hsize_t hi = std::min(segment[0] + segment[2], starts[i] + counts[i]);
+            if (lo < hi)
+                blocks[i].push_back({lo - starts[i], segment[1] + lo - segment[0], hi - lo});
+        }
+    }
+    hsize_t nblocks = 1;
+    for (int i = 0; i < ndims; i++)
+        nblocks *= blocks[i].size();
+    if (nblocks == 0)
+    {
+        H5Sselect_none(mspace);
+        H5Sselect_none(fspace);
+        return;
+    }
+    std::vector<hsize_t> moffset(ndims), foffset(ndims), count(ndims);
+    for (hsize_t bb = 0; bb < nblocks; bb++)
+    {
+        hsize_t index = bb;
+        for (int i = ndims-1; i >= 0; i--)
+        {
+            const auto &block = blocks[i][index % blocks[i].size()];
+            index /= blocks[i].size();
+            moffset[i] = block[0];
+            foffset[i] = block[1];
+            count[i] = block[2];
+        }
+        const H5S_seloper_t op = (bb == 0) ? H5S_SELECT_SET : H5S_SELECT_OR;
+        H5Sselect_hyperslab(mspace, op, &moffset.front(), NULL, &count.front(), NULL);
+        H5Sselect_hyperslab(fspace, op, &foffset.front(), NULL, &count.front(), NULL);
+    }
+}
+
+template <typename rnumber,
+          field_backend be,
+          field_components fc>
+void field<rnumber, be, fc>::set_io_band(
+        const double kM,
+        const double dkx,
+        const double dky,
+        const double dkz)
+{
+    /* the ky and kz bands hold 2M+1 indices, unless that covers the axis */
+    const double dk[2] = {dky, dkz};
+    for (int i = 0; i < 2; i++)
+    {
+        const hsize_t M = hsize_t(kM / dk[i] + 1e-10);
+        this->io_band[i] = std::min(2*M+1, hsize_t(this->clayout->sizes[i]));
+    }
+    this->io_band[2] = std::min(
+            hsize_t(kM / dkx + 1e-10) + 1,
+            hsize_t(this->clayout->sizes[2]));
+}
+
 template <typename rnumber,
           field_backend be,
           field_components fc>
@@ -256,7 +752,12 @@ int field<rnumber, be, fc>::io(
         }
     }
     mspace = H5Screate_simple(ndim(fc), memshape, NULL);
-    H5Sselect_hyperslab(mspace, H5S_SELECT_SET, memoffset, NULL, count, NULL);
+    select_local_hyperslab(mspace, memoffset, count, ndim(fc));
+
+    /* the Fourier representation may be restricted to a band of modes */
+    const bool write_band = (!read &&
+                             !this->real_space_representation &&
+                             this->io_band[0] > 0);
 
     /* open/create data set */
     if (read)
@@ -285,22 +786,48 @@ int field<rnumber, be, fc>::io(
         }
         else
         {
+            if (write_band)
+                std::copy(this->io_band, this->io_band + 3, dims);
             fspace = H5Screate_simple(
                     ndim(fc),
                     dims,
                     NULL);
-            /* chunking needs to go in here */
+            const hid_t dset_type = (this->real_space_representation ?
+                                     this->rnumber_H5T : this->cnumber_H5T);
+            hid_t dcpl = create_field_dcpl(
+                    ndim(fc), dims, 0, count[0],
+                    H5Tget_size(dset_type),
+                    this->io_chunk_planes,
+                    this->io_deflate_level,
+                    false,
+                    this->comm);
             dset_id = H5Dcreate(
                     file_id,
                     dset_name.c_str(),
-                    (this->real_space_representation ? this->rnumber_H5T : this->cnumber_H5T),
+                    dset_type,
                     fspace,
                     H5P_DEFAULT,
-                    H5P_DEFAULT,
+                    dcpl,
                     H5P_DEFAULT);
+            H5Pclose(dcpl);
+            if (write_band)
+            {
+                const int truncated = 1;
+                hid_t aspace = H5Screate(H5S_SCALAR);
+                hid_t attr = H5Acreate(
+                        dset_id, "truncated", H5T_NATIVE_INT, aspace,
+                        H5P_DEFAULT, H5P_DEFAULT);
+                H5Awrite(attr, H5T_NATIVE_INT, &truncated);
+                H5Aclose(attr);
+                H5Sclose(aspace);
+            }
         }
     }
     /* both dset_id and fspace should now have sane values */
+    const bool band = (!this->real_space_representation &&
+                       H5Aexists(dset_id, "truncated") > 0);
+
+    hid_t dxpl = create_collective_dxpl();
 
     /* check file space */
     int ndims_fspace = H5Sget_simple_extent_dims(fspace, dims, NULL);
@@ -312,41 +839,49 @@ int field<rnumber, be, fc>::io(
             offset[i] = this->rlayout->starts[i];
             assert(dims[i] == this->rlayout->sizes[i]);
         }
-        H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        select_local_hyperslab(fspace, offset, count, ndim(fc));
         if (read)
         {
             std::fill_n(this->data, this->rmemlayout->local_size, 0);
-            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, dxpl, this->data);
         }
         else
         {
             assert(this->real_space_representation);
-            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, dxpl, this->data);
         }
         H5Sclose(mspace);
     }
     else
     {
+        hsize_t sizes[ndim(fc)];
         for (unsigned int i=0; i<ndim(fc); i++)
         {
             offset[i] = this->clayout->starts[i];
-            assert(dims[i] == this->clayout->sizes[i]);
+            sizes[i] = this->clayout->sizes[i];
+            assert(band ? dims[i] <= sizes[i] : dims[i] == sizes[i]);
         }
-        H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        if (band)
+            select_band_hyperslabs(
+                    mspace, fspace, ndim(fc),
+                    sizes, dims, offset, count);
+        else
+            select_local_hyperslab(fspace, offset, count, ndim(fc));
         if (read)
         {
             std::fill_n(this->data, this->clayout->local_size*2, 0);
-            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, dxpl, this->data);
             this->symmetrize();
         }
         else
         {
             assert(!this->real_space_representation);
-            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, dxpl, this->data);
         }
         H5Sclose(mspace);
     }
 
+    H5Pclose(dxpl);
     H5Sclose(fspace);
     /* close data set */
     H5Dclose(dset_id);
@@ -439,7 +974,7 @@ int field<rnumber, be, fc>::io_database(
             memoffset[i+dim_counter_offset] = 0;
         }
         mspace = H5Screate_simple(dim_counter_offset + ndim(fc), memshape, NULL);
-        H5Sselect_hyperslab(mspace, H5S_SELECT_SET, memoffset, NULL, count, NULL);
+        select_local_hyperslab(mspace, memoffset, count, dim_counter_offset + ndim(fc));
     }
     else
     {
@@ -452,7 +987,7 @@ int field<rnumber, be, fc>::io_database(
             memoffset[i+dim_counter_offset] = 0;
         }
         mspace = H5Screate_simple(dim_counter_offset + ndim(fc), memshape, NULL);
-        H5Sselect_hyperslab(mspace, H5S_SELECT_SET, memoffset, NULL, count, NULL);
+        select_local_hyperslab(mspace, memoffset, count, dim_counter_offset + ndim(fc));
     }
 
     /* open/create data set */
@@ -468,30 +1003,70 @@ int field<rnumber, be, fc>::io_database(
         {
             dset_id = H5Dopen(file_id, dset_name.c_str(), H5P_DEFAULT);
             fspace = H5Dget_space(dset_id);
+            /* extendable databases grow as needed */
+            hsize_t old_dims[ndim(fc)+1], max_dims[ndim(fc)+1];
+            H5Sget_simple_extent_dims(fspace, old_dims, max_dims);
+            if (H5Sget_simple_extent_ndims(fspace) == int(ndim(fc)+1) &&
+                hsize_t(toffset) >= old_dims[0] &&
+                max_dims[0] == H5S_UNLIMITED)
+            {
+                old_dims[0] = toffset + 1;
+                H5Sclose(fspace);
+                H5Dset_extent(dset_id, old_dims);
+                fspace = H5Dget_space(dset_id);
+            }
         }
         else
         {
+            /* the time dimension is extendable, which requires chunks */
+            dims[0] = toffset + 1;
+            hsize_t max_dims[ndim(fc)+1];
+            std::copy(dims, dims + ndim(fc)+1, max_dims);
+            max_dims[0] = H5S_UNLIMITED;
             fspace = H5Screate_simple(
-                    ndim(fc),
+                    ndim(fc)+1,
                     dims,
-                    NULL);
-            /* chunking needs to go in here */
+                    max_dims);
+            const hid_t dset_type = (this->real_space_representation ?
+                                     this->rnumber_H5T : this->cnumber_H5T);
+            hid_t dcpl = create_field_dcpl(
+                    ndim(fc)+1, dims, 1, count[1],
+                    H5Tget_size(dset_type),
+                    this->io_chunk_planes,
+                    this->io_deflate_level,
+                    true,
+                    this->comm);
             dset_id = H5Dcreate(
                     file_id,
                     dset_name.c_str(),
-                    (this->real_space_representation ? this->rnumber_H5T : this->cnumber_H5T),
+                    dset_type,
                     fspace,
                     H5P_DEFAULT,
-                    H5P_DEFAULT,
+                    dcpl,
                     H5P_DEFAULT);
+            H5Pclose(dcpl);
         }
     }
     /* both dset_id and fspace should now have sane values */
 
-    /* check file space */
-    int ndims_fspace = H5Sget_simple_extent_dims(fspace, dims, NULL);
-    assert(ndims_fspace == int(ndim(fc) + 1));
+    hid_t dxpl = create_collective_dxpl();
+
+    /* check file space.
+     * datasets created here have a time dimension, but older databases
+     * may hold a single field without it, and may not be extendable */
+    const int ndims_fspace = H5Sget_simple_extent_ndims(fspace);
+    const int time_skip = (ndims_fspace == int(ndim(fc))) ? 1 : 0;
+    assert(ndims_fspace == int(ndim(fc) + 1 - time_skip));
+    assert(time_skip == 0 || toffset == 0);
+    dims[0] = 1;
+    H5Sget_simple_extent_dims(fspace, dims + time_skip, NULL);
     offset[0] = toffset;
+    if (hsize_t(toffset) >= dims[0])
+    {
+        DEBUG_MSG("field::io_database: %s has %d entries, cannot access entry %d\n",
+                  dset_name.c_str(), int(dims[0]), toffset);
+        assert(false);
+    }
     if (this->real_space_representation)
     {
         for (unsigned int i=0; i<ndim(fc); i++)
@@ -499,17 +1074,17 @@ int field<rnumber, be, fc>::io_database(
             offset[i+dim_counter_offset] = this->rlayout->starts[i];
             assert(dims[i+dim_counter_offset] == this->rlayout->sizes[i]);
         }
-        H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        select_local_hyperslab(fspace, offset + time_skip, count + time_skip, ndims_fspace);
         if (read)
         {
             std::fill_n(this->data, this->rmemlayout->local_size, 0);
-            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->rnumber_H5T, mspace, fspace, dxpl, this->data);
             this->real_space_representation = true;
         }
         else
         {
             assert(this->real_space_representation);
-            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->rnumber_H5T, mspace, fspace, dxpl, this->data);
         }
         H5Sclose(mspace);
     }
@@ -520,21 +1095,22 @@ int field<rnumber, be, fc>::io_database(
             offset[i+dim_counter_offset] = this->clayout->starts[i];
             assert(dims[i+dim_counter_offset] == this->clayout->sizes[i]);
         }
-        H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        select_local_hyperslab(fspace, offset + time_skip, count + time_skip, ndims_fspace);
         if (read)
         {
-            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dread(dset_id, this->cnumber_H5T, mspace, fspace, dxpl, this->data);
             this->real_space_representation = false;
             this->symmetrize();
         }
         else
         {
             assert(!this->real_space_representation);
-            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, H5P_DEFAULT, this->data);
+            H5Dwrite(dset_id, this->cnumber_H5T, mspace, fspace, dxpl, this->data);
         }
         H5Sclose(mspace);
     }
 
+    H5Pclose(dxpl);
     H5Sclose(fspace);
     /* close data set */
     H5Dclose(dset_id);
@@ -555,6 +1131,12 @@ int field<rnumber, be, fc>::write_0slice(
     // this should in principle work for any fc
     TIMEZONE("field::write_0slice");
     assert(this->real_space_representation);
+    // rank 0 only holds the whole z = 0 slice for slabs
+    if (be != FFTW)
+    {
+        DEBUG_MSG("field::write_0slice is only implemented for the FFTW backend\n");
+        return EXIT_FAILURE;
+    }
     if (this->myrank == 0)
     {
         hid_t dset, wspace, mspace;
@@ -618,6 +1200,7 @@ template <typename rnumber,
           field_components fc>
 void field<rnumber, be, fc>::compute_rspace_xincrement_stats(
                 const int xcells,
+                field_pool<rnumber, be> *pool,
                 const hid_t group,
                 const std::string dset_name,
                 const hsize_t toffset,
@@ -626,11 +1209,8 @@ void field<rnumber, be, fc>::compute_rspace_xincrement_stats(
     TIMEZONE("field::compute_rspace_xincrement_stats");
     assert(this->real_space_representation);
     assert(fc == ONE || fc == THREE);
-    field<rnumber, be, fc> *tmp_field = new field<rnumber, be, fc>(
-            this->rlayout->sizes[2],
-            this->rlayout->sizes[1],
-            this->rlayout->sizes[0],
-            this->rlayout->comm);
+    auto tmp_field = pool->template get<fc>();
+    assert(tmp_field->rmemlayout->local_size == this->rmemlayout->local_size);
     tmp_field->real_space_representation = true;
     this->RLOOP(
                 [&](ptrdiff_t rindex,
@@ -650,7 +1230,6 @@ void field<rnumber, be, fc>::compute_rspace_xincrement_stats(
             dset_name,
             toffset,
             max_estimate);
-    delete tmp_field;
 }
 
 
@@ -665,227 +1244,9 @@ void field<rnumber, be, fc>::compute_rspace_stats(
                 const std::vector<double> max_estimate)
 {
     TIMEZONE("field::compute_rspace_stats");
-    assert(this->real_space_representation);
-    const unsigned int nmoments = 10;
-    int nvals, nbins;
-    if (this->myrank == 0)
-    {
-        hid_t dset, wspace;
-        hsize_t dims[ndim(fc)-1];
-        int ndims;
-        dset = H5Dopen(group, ("moments/" + dset_name).c_str(), H5P_DEFAULT);
-        wspace = H5Dget_space(dset);
-        ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
-        assert(ndims == int(ndim(fc))-1);
-        assert(dims[1] == nmoments);
-        switch(ndims)
-        {
-            case 2:
-                nvals = 1;
-                break;
-            case 3:
-                nvals = dims[2];
-                break;
-            case 4:
-                nvals = dims[2]*dims[3];
-                break;
-        }
-        H5Sclose(wspace);
-        H5Dclose(dset);
-        dset = H5Dopen(group, ("histograms/" + dset_name).c_str(), H5P_DEFAULT);
-        wspace = H5Dget_space(dset);
-        ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
-        assert(ndims == int(ndim(fc))-1);
-        nbins = dims[1];
-        if (ndims == 3)
-            assert(nvals == int(dims[2]));
-        else if (ndims == 4)
-            assert(nvals == int(dims[2]*dims[3]));
-        H5Sclose(wspace);
-        H5Dclose(dset);
-    }
-    {
-        TIMEZONE("MPI_Bcast");
-        MPI_Bcast(&nvals, 1, MPI_INT, 0, this->comm);
-        MPI_Bcast(&nbins, 1, MPI_INT, 0, this->comm);
-    }
-    assert(nvals == int(max_estimate.size()));
-
-    shared_array<double> local_moments_threaded(nmoments*nvals, [&](double* local_moments){
-        std::fill_n(local_moments, nmoments*nvals, 0);
-        if (nvals == 4) local_moments[3] = max_estimate[3];
-    });
-
-    shared_array<double> val_tmp_threaded(nvals,[&](double *val_tmp){
-        std::fill_n(val_tmp, nvals, 0);
-    });
-
-    shared_array<ptrdiff_t> local_hist_threaded(nbins*nvals,[&](ptrdiff_t* local_hist){
-        std::fill_n(local_hist, nbins*nvals, 0);
-    });
-
-    shared_array<double> local_pow_tmp(nvals);
-
-    double *binsize = new double[nvals];
-    for (int i=0; i<nvals; i++)
-        binsize[i] = 2*max_estimate[i] / nbins;
-
-    {
-        TIMEZONE("field::RLOOP");
-        this->RLOOP(
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-            double* pow_tmp = local_pow_tmp.getMine();
-            std::fill_n(pow_tmp, nvals, 1);
-
-            double *local_moments = local_moments_threaded.getMine();
-            double *val_tmp = val_tmp_threaded.getMine();
-            ptrdiff_t *local_hist = local_hist_threaded.getMine();
-
-            if (nvals == int(4)) val_tmp[3] = 0.0;
-            for (unsigned int i=0; i<ncomp(fc); i++)
-            {
-                val_tmp[i] = this->data[rindex*ncomp(fc)+i];
-                if (nvals == int(4)) val_tmp[3] += val_tmp[i]*val_tmp[i];
-            }
-            if (nvals == int(4))
-            {
-                val_tmp[3] = sqrt(val_tmp[3]);
-                if (val_tmp[3] < local_moments[0*nvals+3])
-                    local_moments[0*nvals+3] = val_tmp[3];
-                if (val_tmp[3] > local_moments[9*nvals+3])
-                    local_moments[9*nvals+3] = val_tmp[3];
-                int bin = int(floor(val_tmp[3]*2/binsize[3]));
-                if (bin >= 0 && bin < nbins){
-                    local_hist[bin*nvals+3]++;
-                }
-            }
-            for (unsigned int i=0; i<ncomp(fc); i++)
-            {
-                if (val_tmp[i] < local_moments[0*nvals+i])
-                    local_moments[0*nvals+i] = val_tmp[i];
-                if (val_tmp[i] > local_moments[(nmoments-1)*nvals+i])
-                    local_moments[(nmoments-1)*nvals+i] = val_tmp[i];
-                int bin = int(floor((val_tmp[i] + max_estimate[i]) / binsize[i]));
-                if (bin >= 0 && bin < nbins)
-                    local_hist[bin*nvals+i]++;
-            }
-            for (int n=1; n < int(nmoments)-1; n++){
-                for (int i=0; i<nvals; i++){
-                    local_moments[n*nvals + i] += (pow_tmp[i] = val_tmp[i]*pow_tmp[i]);
-                }
-            }
-                });
-
-          TIMEZONE("FIELD_RLOOP::Merge");
-          local_moments_threaded.mergeParallel([&](const int idx, const double& v1, const double& v2) -> double {
-              if(nvals == int(4) && idx == 0*nvals+3){
-                  return std::min(v1, v2);
-              }
-              if(nvals == int(4) && idx == 9*nvals+3){
-                  return std::max(v1, v2);
-              }
-              if(idx < int(ncomp(fc))){
-                  return std::min(v1, v2);
-              }
-              if(int(nmoments-1)*nvals <= idx && idx < int(int(nmoments-1)*nvals+ncomp(fc))){
-                  return std::max(v1, v2);
-              }
-              return v1 + v2;
-          });
-
-        local_hist_threaded.mergeParallel();
-    }
-    ptrdiff_t *hist = new ptrdiff_t[nbins*nvals];
-    double *moments = new double[nmoments*nvals];
-    {
-        TIMEZONE("MPI_Allreduce");
-        MPI_Allreduce(
-                (void*)local_moments_threaded.getMasterData(),
-                (void*)moments,
-                nvals,
-                MPI_DOUBLE, MPI_MIN, this->comm);
-        MPI_Allreduce(
-                (void*)(local_moments_threaded.getMasterData() + nvals),
-                (void*)(moments+nvals),
-                (nmoments-2)*nvals,
-                MPI_DOUBLE, MPI_SUM, this->comm);
-        MPI_Allreduce(
-                (void*)(local_moments_threaded.getMasterData() + (nmoments-1)*nvals),
-                (void*)(moments+(nmoments-1)*nvals),
-                nvals,
-                MPI_DOUBLE, MPI_MAX, this->comm);
-        MPI_Allreduce(
-                (void*)local_hist_threaded.getMasterData(),
-                (void*)hist,
-                nbins*nvals,
-                MPI_INT64_T, MPI_SUM, this->comm);
-    }
-    for (int n=1; n < int(nmoments)-1; n++)
-        for (int i=0; i<nvals; i++)
-            moments[n*nvals + i] /= this->npoints;
-
-    delete[] binsize;
-    if (this->myrank == 0)
-    {
-        TIMEZONE("root-work");
-        hid_t dset, wspace, mspace;
-        hsize_t count[ndim(fc)-1], offset[ndim(fc)-1], dims[ndim(fc)-1];
-        dset = H5Dopen(group, ("moments/" + dset_name).c_str(), H5P_DEFAULT);
-        assert(dset>0);
-        wspace = H5Dget_space(dset);
-        H5Sget_simple_extent_dims(wspace, dims, NULL);
-        offset[0] = toffset;
-        offset[1] = 0;
-        count[0] = 1;
-        count[1] = nmoments;
-        if (fc == THREE)
-        {
-            offset[2] = 0;
-            count[2] = nvals;
-        }
-        if (fc == THREExTHREE)
-        {
-            offset[2] = 0;
-            count[2] = 3;
-            offset[3] = 0;
-            count[3] = 3;
-        }
-        mspace = H5Screate_simple(ndim(fc)-1, count, NULL);
-        H5Sselect_hyperslab(wspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-        H5Dwrite(dset, H5T_NATIVE_DOUBLE, mspace, wspace, H5P_DEFAULT, moments);
-        H5Sclose(wspace);
-        H5Sclose(mspace);
-        H5Dclose(dset);
-        dset = H5Dopen(group, ("histograms/" + dset_name).c_str(), H5P_DEFAULT);
-        assert(dset > 0);
-        wspace = H5Dget_space(dset);
-        count[1] = nbins;
-        mspace = H5Screate_simple(ndim(fc)-1, count, NULL);
-        H5Sselect_hyperslab(wspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-        H5Dwrite(dset, H5T_NATIVE_INT64, mspace, wspace, H5P_DEFAULT, hist);
-        H5Sclose(wspace);
-        H5Sclose(mspace);
-        H5Dclose(dset);
-        if (H5Lexists(
-                    group,
-                    "0slices",
-                    H5P_DEFAULT))
-        {
-            if (H5Lexists(
-                        group,
-                        (std::string("0slices/") + dset_name).c_str(),
-                        H5P_DEFAULT))
-            this->write_0slice(
-                    group,
-                    dset_name,
-                    toffset);
-        }
-    }
-    delete[] moments;
-    delete[] hist;
+    rspace_stats<rnumber, be> stats;
+    stats.add_field(this, dset_name, max_estimate);
+    stats.compute(group, toffset);
 }
 
 template <typename rnumber,
@@ -893,8 +1254,15 @@ template <typename rnumber,
           field_components fc>
 void field<rnumber, be, fc>::normalize()
 {
-        for (hsize_t tmp_index=0; tmp_index<this->rmemlayout->local_size; tmp_index++)
-            this->data[tmp_index] /= this->npoints;
+    const rnumber npoints = this->npoints;
+    #pragma omp parallel
+    {
+        const hsize_t start = OmpUtils::ForIntervalStart(this->rmemlayout->local_size);
+        const hsize_t end = OmpUtils::ForIntervalEnd(this->rmemlayout->local_size);
+        #pragma omp simd
+        for (hsize_t tmp_index = start; tmp_index < end; tmp_index++)
+            this->data[tmp_index] /= npoints;
+    }
 }
 
 template <typename rnumber,
@@ -904,65 +1272,113 @@ void field<rnumber, be, fc>::symmetrize()
 {
     TIMEZONE("field::symmetrize");
     assert(!this->real_space_representation);
-    ptrdiff_t ii, cc;
-    typename fftw_interface<rnumber>::complex *data = this->get_cdata();
-    MPI_Status *mpistatus = new MPI_Status;
-    if (this->myrank == this->clayout->rank[0][0])
+    /* only the kx = 0 plane needs to be symmetrized; with slabs every
+     * process holds a part of it, with pencils only the first column of
+     * the process grid does */
+    if (this->clayout->starts[2] != 0)
+        return;
+    typedef typename fftw_interface<rnumber>::complex cnumber;
+    cnumber *data = this->get_cdata();
+    const ptrdiff_t ny = this->clayout->sizes[0];
+    const ptrdiff_t nz = this->clayout->sizes[1];
+    const ptrdiff_t line_size = ncomp(fc)*nz;
+    /* kx = 0 line of local ky plane yy, component cc of element kz */
+    auto line_element = [&](ptrdiff_t yy, ptrdiff_t kz, ptrdiff_t cc) -> cnumber*
+    {
+        return data + ncomp(fc)*((yy - ptrdiff_t(this->clayout->starts[0]))*nz + kz)*this->clayout->subsizes[2] + cc;
+    };
+    /* line(-ky, -kz) = conjugate of line(ky, kz) */
+    auto mirror_line = [&](cnumber *dst, const ptrdiff_t dst_stride,
+                           const cnumber *src, const ptrdiff_t src_stride)
     {
-        for (cc = 0; cc < ncomp(fc); cc++)
-            data[cc][1] = 0.0;
-        for (ii = 1; ii < ptrdiff_t(this->clayout->sizes[1]/2); ii++)
-            for (cc = 0; cc < ncomp(fc); cc++) {
-                ( *(data + cc + ncomp(fc)*(this->clayout->sizes[1] - ii)*this->clayout->sizes[2]))[0] =
-                 (*(data + cc + ncomp(fc)*(                          ii)*this->clayout->sizes[2]))[0];
-                ( *(data + cc + ncomp(fc)*(this->clayout->sizes[1] - ii)*this->clayout->sizes[2]))[1] =
-                -(*(data + cc + ncomp(fc)*(                          ii)*this->clayout->sizes[2]))[1];
+        for (ptrdiff_t kz = 0; kz < nz; kz++)
+            for (ptrdiff_t cc = 0; cc < ncomp(fc); cc++)
+            {
+                const ptrdiff_t mkz = (nz - kz) % nz;
+                (*(dst + kz*dst_stride + cc))[0] =  (*(src + mkz*src_stride + cc))[0];
+                (*(dst + kz*dst_stride + cc))[1] = -(*(src + mkz*src_stride + cc))[1];
             }
+    };
+
+    /* plane ny - yy is obtained from plane yy, for 0 < yy < ny/2.
+     * all planes that go from one process to another are packed into a
+     * single message, and messages are exchanged while the local planes
+     * are mirrored. */
+    std::map<int, std::vector<ptrdiff_t>> send_planes, recv_planes;
+    std::vector<ptrdiff_t> local_planes;
+    for (ptrdiff_t yy = 1; yy < ny/2; yy++)
+    {
+        const int ranksrc = this->clayout->rank[0][yy];
+        const int rankdst = this->clayout->rank[0][ny - yy];
+        if (ranksrc == this->clayout->myrank && rankdst == this->clayout->myrank)
+            local_planes.push_back(yy);
+        else if (ranksrc == this->clayout->myrank)
+            send_planes[rankdst].push_back(yy);
+        else if (rankdst == this->clayout->myrank)
+            recv_planes[ranksrc].push_back(yy);
     }
-    typename fftw_interface<rnumber>::complex *buffer;
-    buffer = fftw_interface<rnumber>::alloc_complex(ncomp(fc)*this->clayout->sizes[1]);
-    ptrdiff_t yy;
-    /*ptrdiff_t tindex;*/
-    int ranksrc, rankdst;
-    for (yy = 1; yy < ptrdiff_t(this->clayout->sizes[0]/2); yy++) {
-        ranksrc = this->clayout->rank[0][yy];
-        rankdst = this->clayout->rank[0][this->clayout->sizes[0] - yy];
-        if (this->clayout->myrank == ranksrc)
-            for (ii = 0; ii < ptrdiff_t(this->clayout->sizes[1]); ii++)
-                for (cc = 0; cc < ncomp(fc); cc++)
-                    for (int imag_comp=0; imag_comp<2; imag_comp++)
-                        (*(buffer + ncomp(fc)*ii+cc))[imag_comp] =
-                            (*(data + ncomp(fc)*((yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[imag_comp];
-        if (ranksrc != rankdst)
-        {
-            if (this->clayout->myrank == ranksrc)
-                MPI_Send((void*)buffer,
-                         ncomp(fc)*this->clayout->sizes[1], mpi_real_type<rnumber>::complex(), rankdst, yy,
-                        this->clayout->comm);
-            if (this->clayout->myrank == rankdst)
-                MPI_Recv((void*)buffer,
-                         ncomp(fc)*this->clayout->sizes[1], mpi_real_type<rnumber>::complex(), ranksrc, yy,
-                        this->clayout->comm, mpistatus);
-        }
-        if (this->clayout->myrank == rankdst)
+    std::vector<MPI_Request> requests;
+    std::vector<std::vector<cnumber>> recv_buffers, send_buffers;
+    for (auto &partner : recv_planes)
+    {
+        recv_buffers.emplace_back(partner.second.size()*line_size);
+        requests.emplace_back();
+        MPI_Irecv((void*)&recv_buffers.back().front(),
+                  recv_buffers.back().size(), mpi_real_type<rnumber>::complex(),
+                  partner.first, 0,
+                  this->clayout->comm, &requests.back());
+    }
+    for (auto &partner : send_planes)
+    {
+        send_buffers.emplace_back(partner.second.size()*line_size);
+        cnumber *buffer = &send_buffers.back().front();
+        for (ptrdiff_t yy : partner.second)
         {
-            for (ii = 1; ii < ptrdiff_t(this->clayout->sizes[1]); ii++)
-                for (cc = 0; cc < ncomp(fc); cc++)
+            for (ptrdiff_t kz = 0; kz < nz; kz++)
+                for (ptrdiff_t cc = 0; cc < ncomp(fc); cc++)
                 {
-                    (*(data + ncomp(fc)*((this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[0] =
-                            (*(buffer + ncomp(fc)*(this->clayout->sizes[1]-ii)+cc))[0];
-                    (*(data + ncomp(fc)*((this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1] + ii)*this->clayout->sizes[2] + cc))[1] =
-                            -(*(buffer + ncomp(fc)*(this->clayout->sizes[1]-ii)+cc))[1];
+                    (*(buffer + kz*ncomp(fc) + cc))[0] = (*line_element(yy, kz, cc))[0];
+                    (*(buffer + kz*ncomp(fc) + cc))[1] = (*line_element(yy, kz, cc))[1];
                 }
-            for (cc = 0; cc < ncomp(fc); cc++)
+            buffer += line_size;
+        }
+        requests.emplace_back();
+        MPI_Isend((void*)&send_buffers.back().front(),
+                  send_buffers.back().size(), mpi_real_type<rnumber>::complex(),
+                  partner.first, 0,
+                  this->clayout->comm, &requests.back());
+    }
+
+    /* local work, overlapping the exchange */
+    const ptrdiff_t kz_stride = ncomp(fc)*this->clayout->subsizes[2];
+    if (this->myrank == this->clayout->rank[0][0])
+    {
+        for (ptrdiff_t cc = 0; cc < ncomp(fc); cc++)
+            (*line_element(0, 0, cc))[1] = 0.0;
+        for (ptrdiff_t kz = 1; kz < nz/2; kz++)
+            for (ptrdiff_t cc = 0; cc < ncomp(fc); cc++)
             {
-                (*((data + cc + ncomp(fc)*(this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1]*this->clayout->sizes[2])))[0] =  (*(buffer + cc))[0];
-                (*((data + cc + ncomp(fc)*(this->clayout->sizes[0] - yy - this->clayout->starts[0])*this->clayout->sizes[1]*this->clayout->sizes[2])))[1] = -(*(buffer + cc))[1];
+                (*line_element(0, nz - kz, cc))[0] =  (*line_element(0, kz, cc))[0];
+                (*line_element(0, nz - kz, cc))[1] = -(*line_element(0, kz, cc))[1];
             }
+    }
+    for (ptrdiff_t yy : local_planes)
+        mirror_line(line_element(ny - yy, 0, 0), kz_stride,
+                    line_element(yy, 0, 0), kz_stride);
+
+    if (!requests.empty())
+        MPI_Waitall(requests.size(), &requests.front(), MPI_STATUSES_IGNORE);
+    ptrdiff_t buffer_index = 0;
+    for (auto &partner : recv_planes)
+    {
+        const cnumber *buffer = &recv_buffers[buffer_index++].front();
+        for (ptrdiff_t yy : partner.second)
+        {
+            mirror_line(line_element(ny - yy, 0, 0), kz_stride,
+                        buffer, ncomp(fc));
+            buffer += line_size;
         }
     }
-    fftw_interface<rnumber>::free(buffer);
-    delete mpistatus;
     /* put asymmetric data to 0 */
     /*if (this->clayout->myrank == this->clayout->rank[0][this->clayout->sizes[0]/2])
     {
@@ -1016,8 +1432,7 @@ void field<rnumber, be, fc>::compute_stats(
         this->dft();
         // normalize
         TIMEZONE("field::normalize");
-        for (hsize_t tmp_index=0; tmp_index<this->rmemlayout->local_size; tmp_index++)
-            this->data[tmp_index] /= this->npoints;
+        this->normalize();
     }
     // what follows gave me a headache until I found this link:
     // http://stackoverflow.com/questions/8256636/expected-primary-expression-error-on-template-method-using
@@ -1148,8 +1563,6 @@ int joint_rspace_PDF(
         const std::vector<double> max_f2_estimate)
 {
     TIMEZONE("joint_rspace_PDF");
-    assert(f1->real_space_representation);
-    assert(f2->real_space_representation);
     if (fc == THREE)
     {
         assert(max_f1_estimate.size() == 4);
@@ -1160,204 +1573,9 @@ int joint_rspace_PDF(
         assert(max_f1_estimate.size() == 1);
         assert(max_f2_estimate.size() == 1);
     }
-    int nbins;
-    std::string dsetc, dsetm;
-    dsetc = "histograms/" + dset_name + "_components";
-    if (fc == THREE)
-        dsetm = "histograms/" + dset_name + "_magnitudes";
-    else
-        dsetm = "histograms/" + dset_name;
-    if (f1->myrank == 0)
-    {
-        hid_t dset, wspace;
-        hsize_t dims[5];
-        int ndims;
-        if (fc == THREE)
-        {
-            dset = H5Dopen(
-                    group,
-                    dsetc.c_str(),
-                    H5P_DEFAULT);
-            wspace = H5Dget_space(dset);
-            ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
-            DEBUG_MSG("number of dimensions is %d\n", ndims);
-            assert(ndims == 5);
-            assert(dims[3] == 3);
-            assert(dims[4] == 3);
-            H5Sclose(wspace);
-            H5Dclose(dset);
-        }
-        dset = H5Dopen(
-                group,
-                dsetm.c_str(),
-                H5P_DEFAULT);
-        wspace = H5Dget_space(dset);
-        ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
-        assert(ndims == 3);
-        H5Sclose(wspace);
-        H5Dclose(dset);
-        nbins = dims[1];
-    }
-    {
-        TIMEZONE("MPI_Bcast");
-        MPI_Bcast(&nbins, 1, MPI_INT, 0, f1->comm);
-    }
-
-        /// histogram components
-        shared_array<ptrdiff_t> local_histc_threaded(
-                nbins*nbins*9,
-                [&](ptrdiff_t* local_hist){
-                    std::fill_n(local_hist, nbins*nbins*9, 0);
-                    });
-
-    /// histogram magnitudes
-    shared_array<ptrdiff_t> local_histm_threaded(
-            nbins*nbins,
-            [&](ptrdiff_t* local_hist){
-                std::fill_n(local_hist, nbins*nbins, 0);
-                });
-
-    /// set up bin sizes
-    std::vector<double> bin1size, bin2size;
-    bin1size.resize(4);
-    bin2size.resize(4);
-    if (fc == THREE)
-    {
-        for (unsigned int i=0; i<3; i++)
-        {
-            bin1size[i] = 2*max_f1_estimate[i] / nbins;
-            bin2size[i] = 2*max_f2_estimate[i] / nbins;
-        }
-        bin1size[3] = max_f1_estimate[3] / nbins;
-        bin2size[3] = max_f2_estimate[3] / nbins;
-    }
-    else if (fc == ONE)
-    {
-        for (unsigned int i=0; i<4; i++)
-        {
-            bin1size[i] = max_f1_estimate[0] / nbins;
-            bin2size[i] = max_f2_estimate[0] / nbins;
-        }
-    }
-
-
-    {
-        TIMEZONE("field::RLOOP");
-        f1->RLOOP(
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-            ptrdiff_t *local_histm = local_histm_threaded.getMine();
-            int bin1 = 0;
-            int bin2 = 0;
-            if (fc == THREE)
-            {
-                ptrdiff_t *local_histc = local_histc_threaded.getMine();
-
-                double mag1, mag2;
-                mag1 = 0.0;
-                mag2 = 0.0;
-                for (unsigned int i=0; i<3; i++)
-                {
-                    double val1 = f1->rval(rindex, i);
-                    mag1 += val1*val1;
-                    int bin1 = int(floor((val1 + max_f1_estimate[i])/bin1size[i]));
-                    mag2 = 0.0;
-                    for (unsigned int j=0; j<3; j++)
-                    {
-                        double val2 = f2->rval(rindex, j);
-                        mag2 += val2*val2;
-                        int bin2 = int(floor((val2 + max_f2_estimate[j])/bin2size[j]));
-                        if ((bin1 >= 0 && bin1 < nbins) &&
-                            (bin2 >= 0 && bin2 < nbins))
-                            local_histc[(bin1*nbins + bin2)*9 + i*3 + j]++;
-                    }
-                }
-                bin1 = int(floor(sqrt(mag1)/bin1size[3]));
-                bin2 = int(floor(sqrt(mag2)/bin2size[3]));
-            }
-            else if (fc == ONE)
-            {
-                bin1 = int(floor(f1->rval(rindex)/bin1size[3]));
-                bin2 = int(floor(f2->rval(rindex)/bin2size[3]));
-            }
-            if ((bin1 >= 0 && bin1 < nbins) &&
-                (bin2 >= 0 && bin2 < nbins))
-                local_histm[bin1*nbins + bin2]++;
-            });
-    }
-    local_histm_threaded.mergeParallel();
-    ptrdiff_t *histm = new ptrdiff_t[nbins*nbins];
-    ptrdiff_t *histc = NULL;
-    if (fc == THREE)
-    {
-        local_histc_threaded.mergeParallel();
-        histc = new ptrdiff_t[nbins*nbins*9];
-    }
-    {
-        MPI_Allreduce(
-                (void*)local_histm_threaded.getMasterData(),
-                (void*)histm,
-                nbins*nbins,
-                MPI_INT64_T, MPI_SUM, f1->comm);
-        if (fc == THREE)
-            MPI_Allreduce(
-                    (void*)local_histc_threaded.getMasterData(),
-                    (void*)histc,
-                    nbins*nbins*9,
-                    MPI_INT64_T, MPI_SUM, f1->comm);
-    }
-
-    if (f1->myrank == 0)
-    {
-        TIMEZONE("root-work");
-        hid_t dset, wspace, mspace;
-        hsize_t count[5], offset[5];
-        if (fc == THREE)
-        {
-            dset = H5Dopen(group, dsetc.c_str(), H5P_DEFAULT);
-            assert(dset > 0);
-            wspace = H5Dget_space(dset);
-            offset[0] = toffset;
-            offset[1] = 0;
-            offset[2] = 0;
-            offset[3] = 0;
-            offset[4] = 0;
-            count[0] = 1;
-            count[1] = nbins;
-            count[2] = nbins;
-            count[3] = 3;
-            count[4] = 3;
-            mspace = H5Screate_simple(5, count, NULL);
-            H5Sselect_hyperslab(wspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-            H5Dwrite(dset, H5T_NATIVE_INT64, mspace, wspace, H5P_DEFAULT, histc);
-            H5Sclose(wspace);
-            H5Sclose(mspace);
-            H5Dclose(dset);
-        }
-        dset = H5Dopen(group, dsetm.c_str(), H5P_DEFAULT);
-        assert(dset > 0);
-        offset[0] = toffset;
-        offset[1] = 0;
-        offset[2] = 0;
-        count[0] = 1;
-        count[1] = nbins;
-        count[2] = nbins;
-        mspace = H5Screate_simple(3, count, NULL);
-        wspace = H5Dget_space(dset);
-        H5Sselect_hyperslab(wspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-        H5Dwrite(dset, H5T_NATIVE_INT64, mspace, wspace, H5P_DEFAULT, histm);
-        H5Sclose(wspace);
-        H5Sclose(mspace);
-        H5Dclose(dset);
-    }
-
-    delete[] histm;
-    if (fc == THREE)
-        delete[] histc;
-
-    return EXIT_SUCCESS;
+    rspace_stats<rnumber, be> stats;
+    stats.add_joint_PDF(f1, f2, dset_name, max_f1_estimate, max_f2_estimate);
+    return stats.compute(group, toffset);
 }
 
 template class field<float, FFTW, ONE>;
@@ -1468,3 +1686,111 @@ template int joint_rspace_PDF<double, FFTW, ONE>(
         const std::vector<double>,
         const std::vector<double>);
 
+template class field<float, PENCIL, ONE>;
+template class field<float, PENCIL, THREE>;
+template class field<float, PENCIL, THREExTHREE>;
+template class field<double, PENCIL, ONE>;
+template class field<double, PENCIL, THREE>;
+template class field<double, PENCIL, THREExTHREE>;
+
+template void field<float, PENCIL, ONE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREExTHREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<double, PENCIL, ONE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREExTHREE>::compute_stats<TWO_THIRDS>(
+        kspace<PENCIL, TWO_THIRDS> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<float, PENCIL, ONE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<float, PENCIL, THREExTHREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template void field<double, PENCIL, ONE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+template void field<double, PENCIL, THREExTHREE>::compute_stats<SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        const hid_t, const std::string, const hsize_t, const double);
+
+template int compute_gradient<float, PENCIL, THREE, THREExTHREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREExTHREE> *);
+template int compute_gradient<double, PENCIL, THREE, THREExTHREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREExTHREE> *);
+
+template int compute_gradient<float, PENCIL, ONE, THREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, ONE> *,
+        field<float, PENCIL, THREE> *);
+template int compute_gradient<double, PENCIL, ONE, THREE, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, ONE> *,
+        field<double, PENCIL, THREE> *);
+
+template int invert_curl<float, PENCIL, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREE> *);
+template int invert_curl<double, PENCIL, SMOOTH>(
+        kspace<PENCIL, SMOOTH> *,
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREE> *);
+
+template int joint_rspace_PDF<float, PENCIL, THREE>(
+        field<float, PENCIL, THREE> *,
+        field<float, PENCIL, THREE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+template int joint_rspace_PDF<double, PENCIL, THREE>(
+        field<double, PENCIL, THREE> *,
+        field<double, PENCIL, THREE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+
+template int joint_rspace_PDF<float, PENCIL, ONE>(
+        field<float, PENCIL, ONE> *,
+        field<float, PENCIL, ONE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+template int joint_rspace_PDF<double, PENCIL, ONE>(
+        field<double, PENCIL, ONE> *,
+        field<double, PENCIL, ONE> *,
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const std::vector<double>,
+        const std::vector<double>);
+
@@ -29,24 +29,40 @@
 #include <vector>
 #include <string>
 #include "kspace.hpp"
+#include "pencil_fft.hpp"
+#include "truncated_fft.hpp"
 #include "omputils.hpp"
 
 #ifndef FIELD_HPP
 
 #define FIELD_HPP
 
+template <typename rnumber,
+          field_backend be>
+class field_pool;
+
 /** \class field
  *  \brief Holds field data, performs FFTs and HDF5 I/O operations.
  *
  *  The purpose of this class is to manage memory for field data, create/destroy
  *  FFT plans for them, and compute HDF5 input/output operations.
  *
- *  FFTW recommendations are to create different plans for different arrays,
- *  hence the plans are member variables.
+ *  Plans are obtained from `fftw_plan_registry`, so that fields with the same
+ *  shape share them, and they are executed on each field's own array through
+ *  the FFTW new-array execute interface.
  *  All plans are for in-place transforms, since even with out-of-place transforms
  *  there are no guarantees that input data is not messed up by an inverse FFT, so
  *  there's no point in wasting the memory.
  *
+ *  With the `PENCIL` backend, transforms are computed by a `pencil_fft` object
+ *  instead, and the field is distributed over a 2D grid of processes.
+ *  The global array layouts, and therefore the HDF5 files, are the same for
+ *  both backends.
+ *
+ *  With the `FFTW` backend, `use_truncated_transforms` switches a field to
+ *  `truncated_fft` transforms, which skip the modes outside the dealiasing
+ *  sphere.
+ *
  *
  */
 
@@ -74,11 +90,29 @@ class field
         /* FFT plans */
         typename fftw_interface<rnumber>::plan c2r_plan;
         typename fftw_interface<rnumber>::plan r2c_plan;
+        pencil_fft<rnumber> *pencil;
+        truncated_fft<rnumber> *truncation;
         unsigned fftw_plan_rigor;
 
         /* HDF5 data types for arrays */
         hid_t rnumber_H5T, cnumber_H5T;
 
+        /* storage of the datasets created by `io` and `io_database`.
+         * io_chunk_planes < 0 means contiguous storage (unless chunks are
+         * needed), 0 means chunks of one slab of the distribution, and a
+         * positive value gives the number of planes per chunk.
+         * chunks are compressed with shuffle and deflate if
+         * io_deflate_level > 0.
+         * the defaults are taken from the environment variables
+         * BFPS_IO_CHUNK_PLANES and BFPS_IO_DEFLATE_LEVEL */
+        int io_chunk_planes;
+        int io_deflate_level;
+
+        /* sizes of the band of modes that `io` writes for the Fourier
+         * representation, see `use_truncated_io`. all zero means the
+         * complete array. */
+        hsize_t io_band[3];
+
         /* methods */
         field(
                 const int nx,
@@ -86,6 +120,12 @@ class field
                 const int nz,
                 const MPI_Comm COMM_TO_USE,
                 const unsigned FFTW_PLAN_RIGOR = DEFAULT_FFTW_FLAG);
+        /* buffer with the layouts and I/O settings of `src`, living on
+         * another communicator. it has no transforms, so it is only meant
+         * for I/O (see `vorticity_equation::use_async_checkpoints`) */
+        field(
+                const field<rnumber, be, fc> &src,
+                const MPI_Comm COMM_TO_USE);
         ~field();
 
         int io(
@@ -93,6 +133,12 @@ class field
                 const std::string field_name,
                 const int iteration,
                 const bool read = true);
+        /* entry `toffset` of the database "field_name/real" or
+         * "field_name/complex". new databases are chunked and grow along
+         * their first (time) dimension as needed. existing ones are used
+         * as they are, so databases written by older versions (contiguous,
+         * with a fixed number of entries, or a single field without time
+         * dimension) can still be read and written */
         int io_database(
                 const std::string fname,
                 const std::string field_name,
@@ -112,17 +158,72 @@ class field
         /* essential FFT stuff */
         void dft();
         void ift();
+        /* batched transforms: the components of all fields are interleaved
+         * in a single array and transformed at once, so that the MPI
+         * transposes send one large message instead of several small ones.
+         * the interleaved array is a THREExTHREE field leased from `pool`
+         * for the duration of the transform, so at most 9 components can
+         * be batched.
+         * fields with truncated transforms are transformed one by one */
+        static void dft_many(
+                const std::vector<field<rnumber, be, fc>*> &fields,
+                field_pool<rnumber, be> *pool);
+        static void ift_many(
+                const std::vector<field<rnumber, be, fc>*> &fields,
+                field_pool<rnumber, be> *pool);
         void normalize();
         void symmetrize();
 
+        /* transforms only the kz lines with kx^2 + ky^2 <= kM2 from now on.
+         * only valid for fields whose modes vanish outside the dealiasing
+         * sphere of `kk` in Fourier space, and whose Fourier representation
+         * is only needed inside that sphere.
+         * the `PENCIL` backend always uses complete transforms */
+        template <kspace_dealias_type dt>
+        void use_truncated_transforms(const kspace<be, dt> *kk)
+        {
+            if (be != FFTW)
+                return;
+            this->truncation = truncated_fft<rnumber>::get(
+                    this->rlayout->sizes[2],
+                    this->rlayout->sizes[1],
+                    this->rlayout->sizes[0],
+                    ncomp(fc),
+                    this->comm,
+                    this->fftw_plan_rigor,
+                    kk->dkx, kk->dky, kk->kM2);
+        }
+
+        /* from now on, `io` writes the Fourier representation restricted to
+         * the modes with |kx|, |ky|, |kz| <= kM, i.e. the ky and kz indices
+         * 0..M followed by n-M..n-1, and the kx indices 0..M.
+         * the dataset gets a "truncated" attribute, and `io` reads such
+         * datasets back into the complete array, with zeros elsewhere.
+         * only valid for fields whose modes vanish outside the dealiasing
+         * sphere of `kk` */
+        template <kspace_dealias_type dt>
+        void use_truncated_io(const kspace<be, dt> *kk)
+        {
+            this->set_io_band(kk->kM, kk->dkx, kk->dky, kk->dkz);
+        }
+        void set_io_band(
+                const double kM,
+                const double dkx,
+                const double dky,
+                const double dkz);
+
         /* stats */
+        /* the increments are stored in a scratch field leased from `pool` */
         void compute_rspace_xincrement_stats(
                 const int xcells,
+                field_pool<rnumber, be> *pool,
                 const hid_t group,
                 const std::string dset_name,
                 const hsize_t toffset,
                 const std::vector<double> max_estimate);
 
+        /* single field shortcut for `rspace_stats`, which should be used
+         * directly when statistics of several fields are needed */
         void compute_rspace_stats(
                 const hid_t group,
                 const std::string dset_name,
@@ -237,6 +338,7 @@ class field
             switch(be)
             {
                 case FFTW:
+                case PENCIL:
                     #pragma omp parallel
                     {
                         const hsize_t start = OmpUtils::ForIntervalStart(this->rlayout->subsizes[1]);
@@ -258,6 +360,34 @@ class field
                     break;
             }
         }
+        /* same loop as RLOOP, but `expression(rindex, nx, yindex, zindex)` is
+         * called once per x row, with `rindex` the index of the first point
+         * of the row. the `nx` points of a row are contiguous in every field
+         * with the same layout, so kernels can vectorize over them */
+        template <class func_type>
+        void RLOOP_ROWS(func_type expression)
+        {
+            switch(be)
+            {
+                case FFTW:
+                case PENCIL:
+                    #pragma omp parallel
+                    {
+                        const hsize_t start = OmpUtils::ForIntervalStart(this->rlayout->subsizes[1]);
+                        const hsize_t end = OmpUtils::ForIntervalEnd(this->rlayout->subsizes[1]);
+
+                        for (hsize_t zindex = 0; zindex < this->rlayout->subsizes[0]; zindex++)
+                        for (hsize_t yindex = start; yindex < end; yindex++)
+                        {
+                            ptrdiff_t rindex = (
+                                    zindex * this->rlayout->subsizes[1] + yindex)*(
+                                        this->rmemlayout->subsizes[2]);
+                            expression(rindex, ptrdiff_t(this->rlayout->subsizes[2]), yindex, zindex);
+                        }
+                    }
+                    break;
+            }
+        }
         ptrdiff_t get_cindex(
                 ptrdiff_t xindex,
                 ptrdiff_t yindex,
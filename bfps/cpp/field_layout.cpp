@@ -63,6 +63,10 @@ field_layout<fc>::field_layout(
     }
 
     /*field will at most be distributed in 2D*/
+    /* rank[i][ii] is the process holding index ii along dimension i, and
+     * index 0 along the other two dimensions; for slabs this is the only
+     * process holding ii, for pencils it is the one in the first row
+     * or column of the process grid */
     this->rank.resize(2);
     this->all_start.resize(2);
     this->all_size.resize(2);
@@ -71,8 +75,13 @@ field_layout<fc>::field_layout(
         this->rank[i].resize(this->sizes[i]);
         std::vector<int> local_rank;
         local_rank.resize(this->sizes[i], 0);
-        for (unsigned int ii=this->starts[i]; ii<this->starts[i]+this->subsizes[i]; ii++)
-            local_rank[ii] = this->myrank;
+        bool holds_origin = true;
+        for (int j=0; j<3; j++)
+            if (j != i && this->starts[j] != 0)
+                holds_origin = false;
+        if (holds_origin)
+            for (unsigned int ii=this->starts[i]; ii<this->starts[i]+this->subsizes[i]; ii++)
+                local_rank[ii] = this->myrank;
         MPI_Allreduce(
                 &local_rank.front(),
                 &this->rank[i].front(),
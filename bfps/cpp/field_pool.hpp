@@ -0,0 +1,251 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+#include <vector>
+#include <stdexcept>
+#include <cassert>
+#include "field.hpp"
+
+#ifndef FIELD_POOL_HPP
+
+#define FIELD_POOL_HPP
+
+/** \class field_pool
+ *  \brief Hands out scratch fields.
+ *
+ *  Temporary fields needed by the solver or by postprocessing codes (pressure,
+ *  increments, velocity for statistics etc) are leased from the pool.
+ *  All fields in a pool share the grid, communicator and FFTW rigor given to
+ *  the constructor, and they are sorted by number of components.
+ *  A lease is an RAII handle: the field goes back to the pool when the lease
+ *  is destroyed.
+ *  By default a returned field is deleted, so scratch space only costs memory
+ *  while it is in use.
+ *  Codes that lease the same fields over and over (postprocessing loops etc)
+ *  call `reserve`, and the pool then keeps that many fields of the given kind
+ *  alive between leases, so that allocation and FFTW planning happen once.
+ *  The number of fields alive at any time is capped by `max_fields`, which
+ *  puts an upper bound on the memory used for scratch space; a request beyond
+ *  the cap is a programming error.
+ *
+ *  Leased fields are handed out as they were left by the previous user, so
+ *  callers must not rely on their contents or on `real_space_representation`.
+ */
+
+template <typename rnumber,
+          field_backend be>
+class field_pool
+{
+    private:
+        int nx, ny, nz;
+        MPI_Comm comm;
+        unsigned fftw_plan_rigor;
+        int max_fields;
+        int nfields;
+        int nleased;
+        int reserved_ONE;
+        int reserved_THREE;
+        int reserved_THREExTHREE;
+
+        std::vector<field<rnumber, be, ONE> *> available_ONE;
+        std::vector<field<rnumber, be, THREE> *> available_THREE;
+        std::vector<field<rnumber, be, THREExTHREE> *> available_THREExTHREE;
+
+        std::vector<field<rnumber, be, ONE> *> &available(field<rnumber, be, ONE> *)
+        {
+            return this->available_ONE;
+        }
+        std::vector<field<rnumber, be, THREE> *> &available(field<rnumber, be, THREE> *)
+        {
+            return this->available_THREE;
+        }
+        std::vector<field<rnumber, be, THREExTHREE> *> &available(field<rnumber, be, THREExTHREE> *)
+        {
+            return this->available_THREExTHREE;
+        }
+
+        int &reserved(field<rnumber, be, ONE> *)
+        {
+            return this->reserved_ONE;
+        }
+        int &reserved(field<rnumber, be, THREE> *)
+        {
+            return this->reserved_THREE;
+        }
+        int &reserved(field<rnumber, be, THREExTHREE> *)
+        {
+            return this->reserved_THREExTHREE;
+        }
+
+        template <field_components fc>
+        field<rnumber, be, fc> *acquire()
+        {
+            std::vector<field<rnumber, be, fc> *> &free_fields = this->available(
+                    (field<rnumber, be, fc> *)(nullptr));
+            if (!free_fields.empty())
+            {
+                field<rnumber, be, fc> *result = free_fields.back();
+                free_fields.pop_back();
+                this->nleased++;
+                return result;
+            }
+            if (this->nfields >= this->max_fields)
+            {
+                DEBUG_MSG("field_pool: cannot allocate more than %d scratch fields\n",
+                          this->max_fields);
+                throw std::runtime_error("field_pool: scratch field limit reached");
+            }
+            this->nfields++;
+            this->nleased++;
+            return new field<rnumber, be, fc>(
+                    this->nx, this->ny, this->nz,
+                    this->comm,
+                    this->fftw_plan_rigor);
+        }
+
+        template <field_components fc>
+        void release(field<rnumber, be, fc> *src)
+        {
+            std::vector<field<rnumber, be, fc> *> &free_fields = this->available(src);
+            this->nleased--;
+            if (int(free_fields.size()) < this->reserved(src))
+                free_fields.push_back(src);
+            else
+            {
+                delete src;
+                this->nfields--;
+            }
+        }
+
+        template <class field_type>
+        void delete_all(std::vector<field_type *> &fields)
+        {
+            for (auto ff : fields)
+                delete ff;
+            fields.clear();
+        }
+
+    public:
+        template <field_components fc>
+        class lease
+        {
+            private:
+                field_pool<rnumber, be> *pool;
+                field<rnumber, be, fc> *ff;
+            public:
+                lease(field_pool<rnumber, be> *POOL):
+                    pool(POOL),
+                    ff(POOL->template acquire<fc>()){}
+                lease(lease &&other):
+                    pool(other.pool),
+                    ff(other.ff)
+                {
+                    other.ff = nullptr;
+                }
+                lease(const lease &) = delete;
+                lease &operator=(const lease &) = delete;
+                ~lease()
+                {
+                    if (this->ff != nullptr)
+                        this->pool->release(this->ff);
+                }
+
+                inline field<rnumber, be, fc> *get()
+                {
+                    return this->ff;
+                }
+                inline field<rnumber, be, fc> *operator->()
+                {
+                    return this->ff;
+                }
+                inline field<rnumber, be, fc> &operator*()
+                {
+                    return *this->ff;
+                }
+        };
+
+        field_pool(
+                const int NX,
+                const int NY,
+                const int NZ,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR = DEFAULT_FFTW_FLAG,
+                const int MAX_FIELDS = 4):
+            nx(NX), ny(NY), nz(NZ),
+            comm(COMM_TO_USE),
+            fftw_plan_rigor(FFTW_PLAN_RIGOR),
+            max_fields(MAX_FIELDS),
+            nfields(0),
+            nleased(0),
+            reserved_ONE(0),
+            reserved_THREE(0),
+            reserved_THREExTHREE(0){}
+
+        /* leases must not outlive the pool */
+        ~field_pool()
+        {
+            assert(this->nleased == 0);
+            this->delete_all(this->available_ONE);
+            this->delete_all(this->available_THREE);
+            this->delete_all(this->available_THREExTHREE);
+        }
+
+        /* lease a scratch field */
+        template <field_components fc>
+        lease<fc> get()
+        {
+            return lease<fc>(this);
+        }
+
+        /* keep `count` scratch fields of the given kind alive between
+         * leases, and allocate (and plan) them ahead of time, so that no
+         * allocation happens in the main loop */
+        template <field_components fc>
+        void reserve(const int count)
+        {
+            this->reserved((field<rnumber, be, fc> *)(nullptr)) = count;
+            std::vector<field<rnumber, be, fc> *> tmp;
+            for (int i=0; i<count; i++)
+                tmp.push_back(this->template acquire<fc>());
+            for (auto ff : tmp)
+                this->release(ff);
+        }
+
+        /* number of fields currently allocated, leased or not */
+        inline int get_nfields() const
+        {
+            return this->nfields;
+        }
+
+        /* number of fields currently leased */
+        inline int get_nleased() const
+        {
+            return this->nleased;
+        }
+};
+
+#endif//FIELD_POOL_HPP
+
@@ -1,7 +1,10 @@
 #include <string>
+#include <cstring>
 #include <cmath>
 #include "NSVE.hpp"
+#include "rspace_stats.hpp"
 #include "scope_timer.hpp"
+#include "hdf5_tools.hpp"
 
 
 template <typename rnumber>
@@ -32,18 +35,28 @@ int NSVE<rnumber>::initialize(void)
             std::endl;
         return EXIT_FAILURE;
     }
+    /* statistics are written in blocks covering niter_stat_flush
+     * iterations, and at every checkpoint (see write_iteration) */
+    hdf5_tools::set_stats_flush_interval(this->niter_stat_flush / this->niter_stat);
+    if (strcmp(this->time_stepper, "RK3") != 0 &&
+        strcmp(this->time_stepper, "low_storage_RK3") != 0)
+    {
+        std::cerr <<
+            "unknown time_stepper " << this->time_stepper <<
+            ", expected RK3 or low_storage_RK3.\ntrying to exit now." <<
+            std::endl;
+        return EXIT_FAILURE;
+    }
     this->fs = new vorticity_equation<rnumber, FFTW>(
             simname.c_str(),
             nx, ny, nz,
             dkx, dky, dkz,
-            DEFAULT_FFTW_FLAG);
-    this->tmp_vec_field = new field<rnumber, FFTW, THREE>(
-            nx, ny, nz,
-            this->comm,
-            DEFAULT_FFTW_FLAG);
+            DEFAULT_FFTW_FLAG,
+            this->time_stepper);
 
 
     this->fs->checkpoints_per_file = checkpoints_per_file;
+    this->fs->CFL_number = CFL_number;
     this->fs->nu = nu;
     this->fs->fmode = fmode;
     this->fs->famplitude = famplitude;
@@ -53,8 +66,18 @@ int NSVE<rnumber>::initialize(void)
     this->fs->iteration = this->iteration;
     this->fs->checkpoint = this->checkpoint;
 
+    if (this->truncated_transforms)
+        this->fs->use_truncated_transforms();
+    if (this->truncated_checkpoints)
+        this->fs->cvorticity->use_truncated_io(this->fs->kk);
+    this->checkpoint_pending = false;
+    if ((getenv("BFPS_ASYNC_CHECKPOINTS") != nullptr) &&
+        (getenv("BFPS_ASYNC_CHECKPOINTS") == std::string("TRUE")))
+        this->fs->use_async_checkpoints();
+
     this->fs->cvorticity->real_space_representation = false;
     this->fs->io_checkpoint();
+    this->read_time();
 
     if (this->myrank == 0 && this->iteration == 0)
         this->fs->kk->store(stat_file);
@@ -65,6 +88,7 @@ template <typename rnumber>
 int NSVE<rnumber>::step(void)
 {
     this->fs->step(this->dt);
+    this->time += this->fs->step_dt;
     this->iteration = this->fs->iteration;
     return EXIT_SUCCESS;
 }
@@ -72,28 +96,100 @@ int NSVE<rnumber>::step(void)
 template <typename rnumber>
 int NSVE<rnumber>::write_checkpoint(void)
 {
+    this->finish_checkpoint();
     this->fs->io_checkpoint(false);
     this->checkpoint = this->fs->checkpoint;
+    if (this->fs->checkpoint_buffer != nullptr)
+    {
+        this->checkpoint_pending = true;
+        this->pending_iteration = this->iteration;
+        this->pending_time = this->time;
+        return EXIT_SUCCESS;
+    }
+    this->write_time();
     this->write_iteration();
     return EXIT_SUCCESS;
 }
 
+/** \brief Wait for the asynchronous checkpoint, and record it.
+ *
+ *  The stat file only points to an asynchronous checkpoint once it is
+ *  completely written, so that a run that dies in the meantime restarts
+ *  from the previous checkpoint.
+ */
+
+template <typename rnumber>
+int NSVE<rnumber>::finish_checkpoint(void)
+{
+    if (!this->checkpoint_pending)
+        return EXIT_SUCCESS;
+    this->fs->wait_for_checkpoint();
+    const int current_iteration = this->iteration;
+    const double current_time = this->time;
+    this->iteration = this->pending_iteration;
+    this->time = this->pending_time;
+    this->write_time();
+    this->write_iteration();
+    this->iteration = current_iteration;
+    this->time = current_time;
+    this->checkpoint_pending = false;
+    return EXIT_SUCCESS;
+}
+
+/** \brief Read the physical time of the current iteration.
+ *
+ *  With adaptive time stepping the time is not proportional to the
+ *  iteration, so it is stored next to the iteration.
+ *  Files without it are assumed to have been run with the fixed `dt`.
+ */
+
+template <typename rnumber>
+int NSVE<rnumber>::read_time(void)
+{
+    if (this->myrank == 0)
+    {
+        if (H5Lexists(this->stat_file, "time", H5P_DEFAULT))
+        {
+            hid_t dset = H5Dopen(this->stat_file, "time", H5P_DEFAULT);
+            H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->time);
+            H5Dclose(dset);
+        }
+        else
+            this->time = this->iteration*this->dt;
+    }
+    MPI_Bcast(&this->time, 1, MPI_DOUBLE, 0, this->comm);
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int NSVE<rnumber>::write_time(void)
+{
+    if (this->myrank == 0 &&
+        H5Lexists(this->stat_file, "time", H5P_DEFAULT))
+    {
+        hid_t dset = hdf5_tools::open_cached_dataset(this->stat_file, "time");
+        H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &this->time);
+    }
+    return EXIT_SUCCESS;
+}
+
 template <typename rnumber>
 int NSVE<rnumber>::finalize(void)
 {
+    this->finish_checkpoint();
     if (this->myrank == 0)
+    {
+        hdf5_tools::close_cached_datasets(this->stat_file);
         H5Fclose(this->stat_file);
+    }
     delete this->fs;
-    delete this->tmp_vec_field;
     return EXIT_SUCCESS;
 }
 
 /** \brief Compute standard statistics for velocity and vorticity fields.
  *
  *  IMPORTANT: at the end of this subroutine, `this->fs->cvelocity` contains
- *  the Fourier space representation of the velocity field, and
- *  `this->tmp_vec_field` contains the real space representation of the
- *  velocity field.
+ *  the real space representation of the velocity field.
  *  This behavior is relied upon in the `NSVEparticles` class, so please
  *  don't break it.
  */
@@ -112,22 +208,65 @@ int NSVE<rnumber>::do_stats()
     else
         stat_group = 0;
 
-    *tmp_vec_field = fs->cvorticity->get_cdata();
-    tmp_vec_field->compute_stats(
-            fs->kk,
-            stat_group,
-            "vorticity",
-            fs->iteration / niter_stat,
-            max_vorticity_estimate/sqrt(3));
+    /* spectra are computed on the Fourier representations, then both
+     * fields are brought to real space, and their real space statistics
+     * are computed together */
+    const hsize_t toffset = fs->iteration / niter_stat;
+    std::vector<double> max_vorticity_estimate_vector(4, max_vorticity_estimate/sqrt(3));
+    std::vector<double> max_velocity_estimate_vector(4, max_velocity_estimate/sqrt(3));
+    max_vorticity_estimate_vector[3] *= sqrt(3);
+    max_velocity_estimate_vector[3] *= sqrt(3);
 
     fs->compute_velocity(fs->cvorticity);
-    *tmp_vec_field = fs->cvelocity->get_cdata();
-    tmp_vec_field->compute_stats(
-            fs->kk,
+    const rnumber (*cvorticity)[2] = fs->cvorticity->get_cdata();
+    const rnumber (*cvelocity)[2] = fs->cvelocity->get_cdata();
+    std::vector<const rnumber(*)[2]> spec_a = {cvorticity, cvelocity};
+    std::vector<const rnumber(*)[2]> spec_b = spec_a;
+    std::vector<std::string> spec_names = {
+        "vorticity_vorticity",
+        "velocity_velocity"};
+    /* the cross spectrum is only stored by files that have room for it */
+    int cross_spectrum = 0;
+    if (this->myrank == 0)
+        cross_spectrum = H5Lexists(stat_group, "spectra/velocity_vorticity", H5P_DEFAULT);
+    MPI_Bcast(&cross_spectrum, 1, MPI_INT, 0, this->comm);
+    if (cross_spectrum)
+    {
+        spec_a.push_back(cvelocity);
+        spec_b.push_back(cvorticity);
+        spec_names.push_back("velocity_vorticity");
+    }
+    fs->kk->template cospectra<rnumber, THREE>(
+            spec_a,
+            spec_b,
             stat_group,
-            "velocity",
-            fs->iteration / niter_stat,
-            max_velocity_estimate/sqrt(3));
+            spec_names,
+            toffset);
+
+    /* the solver register v[1] is free between steps (for both time
+     * steppers), so it holds the real space vorticity */
+    field<rnumber, FFTW, THREE> *vorticity = fs->v[1];
+    *vorticity = fs->cvorticity->get_cdata();
+    vorticity->ift();
+    /* the next step computes the velocity again, so it is transformed in
+     * place */
+    fs->cvelocity->ift();
+
+    rspace_stats<rnumber, FFTW> stats;
+    stats.add_field(vorticity, "vorticity", max_vorticity_estimate_vector);
+    stats.add_field(fs->cvelocity, "velocity", max_velocity_estimate_vector);
+    stats.compute(stat_group, toffset);
+
+    /* time stamps, needed with adaptive time stepping */
+    if (this->myrank == 0 &&
+        H5Lexists(stat_group, "time", H5P_DEFAULT))
+    {
+        hdf5_tools::write_stats_row(
+                stat_group,
+                "time",
+                toffset,
+                &this->time);
+    }
 
     if (this->myrank == 0)
         H5Gclose(stat_group);
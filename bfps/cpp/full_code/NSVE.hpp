@@ -40,6 +40,7 @@ class NSVE: public direct_numerical_simulation
     public:
 
         /* parameters that are read in read_parameters */
+        double CFL_number;
         double dt;
         double famplitude;
         double fk0;
@@ -50,11 +51,21 @@ class NSVE: public direct_numerical_simulation
         double max_velocity_estimate;
         double max_vorticity_estimate;
         double nu;
+        char time_stepper[512];
+        int truncated_checkpoints;
+        int truncated_transforms;
 
         /* other stuff */
+        double time;
+        /* asynchronous checkpoint that is not yet recorded in the stat
+         * file, see finish_checkpoint */
+        bool checkpoint_pending;
+        int pending_iteration;
+        double pending_time;
+        /* with low_storage_RK3 the solver holds 3 vector fields, and
+         * statistics are computed in those fields, so no other field is
+         * allocated. RK3 needs 5 vector fields */
         vorticity_equation<rnumber, FFTW> *fs;
-        field<rnumber, FFTW, THREE> *tmp_vec_field;
-        field<rnumber, FFTW, ONE> *tmp_scal_field;
 
 
         NSVE(
@@ -71,6 +82,9 @@ class NSVE: public direct_numerical_simulation
 
         virtual int read_parameters(void);
         int write_checkpoint(void);
+        int finish_checkpoint(void);
+        int read_time(void);
+        int write_time(void);
         int do_stats(void);
 };
 
@@ -13,6 +13,12 @@ int NSVE_field_stats<rnumber>::initialize(void)
             this->comm,
             DEFAULT_FFTW_FLAG);
     this->vorticity->real_space_representation = false;
+    this->pool = new field_pool<rnumber, FFTW>(
+            nx, ny, nz,
+            this->comm,
+            DEFAULT_FFTW_FLAG);
+    /* derived codes lease a vector field for each iteration */
+    this->pool->template reserve<THREE>(1);
     hid_t parameter_file = H5Fopen(
             (this->simname + std::string(".h5")).c_str(),
             H5F_ACC_RDONLY,
@@ -78,6 +84,7 @@ int NSVE_field_stats<rnumber>::finalize(void)
 {
     if (this->bin_IO != NULL)
         delete this->bin_IO;
+    delete this->pool;
     delete this->vorticity;
     return EXIT_SUCCESS;
 }
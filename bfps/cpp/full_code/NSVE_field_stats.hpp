@@ -33,6 +33,7 @@
 #include <vector>
 #include "base.hpp"
 #include "field.hpp"
+#include "field_pool.hpp"
 #include "field_binary_IO.hpp"
 #include "full_code/postprocess.hpp"
 
@@ -43,6 +44,7 @@ class NSVE_field_stats: public postprocess
         field_binary_IO<rnumber, COMPLEX, THREE> *bin_IO;
     public:
         field<rnumber, FFTW, THREE> *vorticity;
+        field_pool<rnumber, FFTW> *pool;
 
         NSVE_field_stats(
                 const MPI_Comm COMMUNICATOR,
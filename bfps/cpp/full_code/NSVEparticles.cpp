@@ -2,6 +2,7 @@
 #include <cmath>
 #include "NSVEparticles.hpp"
 #include "scope_timer.hpp"
+#include "hdf5_tools.hpp"
 #include "particles/particles_sampling.hpp"
 
 template <typename rnumber>
@@ -9,7 +10,8 @@ int NSVEparticles<rnumber>::initialize(void)
 {
     this->NSVE<rnumber>::initialize();
 
-    this->ps = particles_system_builder(
+    this->ps = particles_system_builder<
+        long long int, rnumber, FFTW, THREE, particles_rnumber>(
                 this->fs->cvelocity,              // (field object)
                 this->fs->kk,                     // (kspace object, contains dkx, dky, dkz)
                 tracers0_integration_steps, // to check coherency between parameters and hdf input file (nb rhs)
@@ -21,8 +23,14 @@ int NSVEparticles<rnumber>::initialize(void)
                 tracers0_smoothness,        // parameter
                 this->comm,
                 this->fs->iteration+1);
+    this->ps->enable_cell_sorting(tracers0_sort_threshold);
+    this->read_previous_dts();
+    /* the acceleration is sampled regularly, keep its scratch fields
+     * (the acceleration itself, the pressure and the velocity products) */
+    this->fs->pool->template reserve<ONE>(1);
+    this->fs->pool->template reserve<THREE>(2);
     this->particles_output_writer_mpi = new particles_output_hdf5<
-        long long int, double, 3, 3>(
+        long long int, particles_rnumber, 3, 3>(
                 MPI_COMM_WORLD,
                 "tracers0",
                 nparticles,
@@ -35,8 +43,14 @@ int NSVEparticles<rnumber>::step(void)
 {
     this->fs->compute_velocity(this->fs->cvorticity);
     this->fs->cvelocity->ift();
-    this->ps->completeLoop(this->dt);
+    /* same as `completeLoop`, except that the particles are moved once the
+     * fluid solver has chosen the time step */
+    this->ps->compute();
     this->NSVE<rnumber>::step();
+    this->ps->move(this->fs->step_dt);
+    this->ps->redistribute();
+    this->ps->inc_step_idx();
+    this->ps->shift_rhs_vectors();
     return EXIT_SUCCESS;
 }
 
@@ -44,6 +58,8 @@ template <typename rnumber>
 int NSVEparticles<rnumber>::write_checkpoint(void)
 {
     this->NSVE<rnumber>::write_checkpoint();
+    /* the particles go to the same file as the field */
+    this->fs->wait_for_checkpoint();
     this->particles_output_writer_mpi->open_file(this->fs->get_current_fname());
     this->particles_output_writer_mpi->save(
             this->ps->getParticlesPositions(),
@@ -52,6 +68,79 @@ int NSVEparticles<rnumber>::write_checkpoint(void)
             this->ps->getLocalNbParticles(),
             this->fs->iteration);
     this->particles_output_writer_mpi->close_file();
+    this->write_previous_dts();
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber>
+int NSVEparticles<rnumber>::write_previous_dts(void)
+{
+    const std::vector<particles_rnumber> previous_dts = this->ps->getPreviousDts();
+    if (this->myrank != 0 || previous_dts.size() == 0)
+        return EXIT_SUCCESS;
+    const std::vector<double> data(previous_dts.begin(), previous_dts.end());
+    hid_t file_id = H5Fopen(
+            this->fs->get_current_fname().c_str(),
+            H5F_ACC_RDWR,
+            H5P_DEFAULT);
+    hid_t gg = H5Gopen(file_id, "tracers0", H5P_DEFAULT);
+    if (!H5Lexists(gg, "dt", H5P_DEFAULT))
+    {
+        hid_t ggg = H5Gcreate(gg, "dt", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Gclose(ggg);
+    }
+    const std::string dset_name = "dt/" + std::to_string(this->fs->iteration);
+    if (H5Lexists(gg, dset_name.c_str(), H5P_DEFAULT))
+        H5Ldelete(gg, dset_name.c_str(), H5P_DEFAULT);
+    const hsize_t count = data.size();
+    hid_t space = H5Screate_simple(1, &count, NULL);
+    hid_t dset = H5Dcreate(
+            gg,
+            dset_name.c_str(),
+            H5T_NATIVE_DOUBLE,
+            space,
+            H5P_DEFAULT,
+            H5P_DEFAULT,
+            H5P_DEFAULT);
+    H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data.front());
+    H5Dclose(dset);
+    H5Sclose(space);
+    H5Gclose(gg);
+    H5Fclose(file_id);
+    return EXIT_SUCCESS;
+}
+
+/** \brief Restore the lengths of the steps that produced the tracer rhs.
+ *
+ *  Checkpoints written before the step lengths were stored don't have
+ *  them; the tracers then assume that all previous steps were as long as
+ *  the first one after the restart, which is exact for a fixed `dt`.
+ */
+
+template <typename rnumber>
+int NSVEparticles<rnumber>::read_previous_dts(void)
+{
+    std::vector<double> data;
+    if (this->myrank == 0)
+    {
+        hid_t file_id = H5Fopen(
+                this->fs->get_current_fname().c_str(),
+                H5F_ACC_RDONLY,
+                H5P_DEFAULT);
+        const std::string dset_name = "tracers0/dt/" + std::to_string(this->fs->iteration);
+        if (H5Lexists(file_id, "tracers0/dt", H5P_DEFAULT) &&
+            H5Lexists(file_id, dset_name.c_str(), H5P_DEFAULT))
+            data = hdf5_tools::read_vector<double>(file_id, dset_name);
+        H5Fclose(file_id);
+    }
+    int nb_values = int(data.size());
+    MPI_Bcast(&nb_values, 1, MPI_INT, 0, this->comm);
+    if (nb_values == 0)
+        return EXIT_SUCCESS;
+    data.resize(nb_values);
+    MPI_Bcast(&data.front(), nb_values, MPI_DOUBLE, 0, this->comm);
+    this->ps->setPreviousDts(
+            std::vector<particles_rnumber>(data.begin(), data.end()));
     return EXIT_SUCCESS;
 }
 
@@ -78,7 +167,7 @@ int NSVEparticles<rnumber>::do_stats()
         return EXIT_SUCCESS;
 
     /// sample velocity
-    sample_from_particles_system(*this->tmp_vec_field,              // field to save
+    sample_from_particles_system(*this->fs->cvelocity,              // field to save
                                  this->ps,
                                  (this->simname + "_particles.h5"), // filename
                                  "tracers0",                        // hdf5 parent group
@@ -86,9 +175,10 @@ int NSVEparticles<rnumber>::do_stats()
                                  );
 
     /// compute acceleration and sample it
-    this->fs->compute_Lagrangian_acceleration(this->tmp_vec_field);
-    this->tmp_vec_field->ift();
-    sample_from_particles_system(*this->tmp_vec_field,
+    auto acceleration = this->fs->pool->template get<THREE>();
+    this->fs->compute_Lagrangian_acceleration(acceleration.get());
+    acceleration->ift();
+    sample_from_particles_system(*acceleration,
                                  this->ps,
                                  (this->simname + "_particles.h5"),
                                  "tracers0",
@@ -48,16 +48,25 @@ class NSVEparticles: public NSVE<rnumber>
 {
     public:
 
+        /* precision of the tracer state and rhs; single precision halves the
+         * memory traffic and the volume of the particle exchanges */
+#ifdef BFPS_SINGLE_PRECISION_PARTICLES
+        typedef float particles_rnumber;
+#else
+        typedef double particles_rnumber;
+#endif
+
         /* parameters that are read in read_parameters */
         int niter_part;
         int nparticles;
         int tracers0_integration_steps;
         int tracers0_neighbours;
         int tracers0_smoothness;
+        double tracers0_sort_threshold;
 
         /* other stuff */
-        std::unique_ptr<abstract_particles_system<long long int, double>> ps;
-        particles_output_hdf5<long long int, double,3,3> *particles_output_writer_mpi;
+        std::unique_ptr<abstract_particles_system<long long int, particles_rnumber>> ps;
+        particles_output_hdf5<long long int, particles_rnumber,3,3> *particles_output_writer_mpi;
 
 
         NSVEparticles(
@@ -74,6 +83,10 @@ class NSVEparticles: public NSVE<rnumber>
 
         int read_parameters(void);
         int write_checkpoint(void);
+        /* lengths of the previous steps of the tracers, stored in
+         * "tracers0/dt/<iteration>" of the checkpoint file */
+        int write_previous_dts(void);
+        int read_previous_dts(void);
         int do_stats(void);
 };
 
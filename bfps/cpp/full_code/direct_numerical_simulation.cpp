@@ -58,10 +58,9 @@ int direct_numerical_simulation::write_iteration(void)
 {
     if (this->myrank == 0)
     {
-        hid_t dset = H5Dopen(
+        hid_t dset = hdf5_tools::open_cached_dataset(
                 this->stat_file,
-                "iteration",
-                H5P_DEFAULT);
+                "iteration");
         H5Dwrite(
                 dset,
                 H5T_NATIVE_INT,
@@ -69,11 +68,9 @@ int direct_numerical_simulation::write_iteration(void)
                 H5S_ALL,
                 H5P_DEFAULT,
                 &this->iteration);
-        H5Dclose(dset);
-        dset = H5Dopen(
+        dset = hdf5_tools::open_cached_dataset(
                 this->stat_file,
-                "checkpoint",
-                H5P_DEFAULT);
+                "checkpoint");
         H5Dwrite(
                 dset,
                 H5T_NATIVE_INT,
@@ -81,7 +78,10 @@ int direct_numerical_simulation::write_iteration(void)
                 H5S_ALL,
                 H5P_DEFAULT,
                 &this->checkpoint);
-        H5Dclose(dset);
+        /* the stat file should be consistent with the checkpoints even
+         * if the run is killed later on */
+        hdf5_tools::flush_stats(this->stat_file);
+        H5Fflush(this->stat_file, H5F_SCOPE_GLOBAL);
     }
     return EXIT_SUCCESS;
 }
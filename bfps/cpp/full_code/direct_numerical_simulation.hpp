@@ -40,6 +40,7 @@ class direct_numerical_simulation: public code_base
         int checkpoints_per_file;
         int niter_out;
         int niter_stat;
+        int niter_stat_flush;
         int niter_todo;
         hid_t stat_file;
 
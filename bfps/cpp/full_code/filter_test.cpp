@@ -2,6 +2,7 @@
 #include <cmath>
 #include "filter_test.hpp"
 #include "scope_timer.hpp"
+#include "hdf5_tools.hpp"
 
 
 template <typename rnumber>
@@ -22,6 +23,7 @@ int filter_test<rnumber>::initialize(void)
                 H5F_ACC_RDWR,
                 H5P_DEFAULT);
         this->kk->store(stat_file);
+        hdf5_tools::close_cached_datasets(stat_file);
         H5Fclose(stat_file);
     }
     return EXIT_SUCCESS;
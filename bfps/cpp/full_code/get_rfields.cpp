@@ -37,10 +37,7 @@ int get_rfields<rnumber>::work_on_current_iteration(void)
 {
     DEBUG_MSG("entered get_rfields::work_on_current_iteration\n");
     this->read_current_cvorticity();
-    field<rnumber, FFTW, THREE> *vel = new field<rnumber, FFTW, THREE>(
-            this->nx, this->ny, this->nz,
-            this->comm,
-            this->vorticity->fftw_plan_rigor);
+    auto vel = this->pool->template get<THREE>();
 
     vel->real_space_representation = false;
     this->kk->CLOOP_K2(
@@ -76,7 +73,6 @@ int get_rfields<rnumber>::work_on_current_iteration(void)
             this->iteration,
             false);
 
-    delete vel;
     return EXIT_SUCCESS;
 }
 
@@ -1,7 +1,9 @@
 #include <string>
 #include <cmath>
 #include "joint_acc_vel_stats.hpp"
+#include "rspace_stats.hpp"
 #include "scope_timer.hpp"
+#include "hdf5_tools.hpp"
 
 
 template <typename rnumber>
@@ -19,6 +21,9 @@ int joint_acc_vel_stats<rnumber>::initialize(void)
             this->dky,
             this->dkz,
             this->vorticity->fftw_plan_rigor);
+    /* scratch fields of compute_Lagrangian_acceleration */
+    this->ve->pool->template reserve<ONE>(1);
+    this->ve->pool->template reserve<THREE>(1);
     hid_t parameter_file = H5Fopen(
             (this->simname + std::string(".h5")).c_str(),
             H5F_ACC_RDONLY,
@@ -106,10 +111,9 @@ int joint_acc_vel_stats<rnumber>::work_on_current_iteration(void)
     field<rnumber, FFTW, THREE> *acc;
 
     /// compute velocity
-    vel = new field<rnumber, FFTW, THREE>(
-            this->nx, this->ny, this->nz,
-            this->comm,
-            DEFAULT_FFTW_FLAG);
+    /// velocity lives in a scratch field leased for the current iteration
+    auto vel_lease = this->pool->template get<THREE>();
+    vel = vel_lease.get();
     invert_curl(kk, this->ve->cvorticity, vel);
     vel->ift();
 
@@ -128,27 +132,18 @@ int joint_acc_vel_stats<rnumber>::work_on_current_iteration(void)
     max_acc_estimate[3] = max_acceleration_estimate;
     max_vel_estimate[3] = max_velocity_estimate;
 
-    acc->compute_rspace_stats(
-            stat_group,
-            "acceleration",
-            this->iteration / this->niter_out,
-            max_acc_estimate);
-    vel->compute_rspace_stats(
-            stat_group,
-            "velocity",
-            this->iteration / this->niter_out,
-            max_vel_estimate);
-
-    /// compute joint PDF
-    joint_rspace_PDF(
+    /// single field statistics and joint PDF, in one pass over the grid
+    rspace_stats<rnumber, FFTW> stats;
+    stats.add_field(acc, "acceleration", max_acc_estimate);
+    stats.add_field(vel, "velocity", max_vel_estimate);
+    stats.add_joint_PDF(
             acc, vel,
-            stat_group,
             "acceleration_and_velocity",
-            this->iteration / this->niter_out,
             max_acc_estimate,
             max_vel_estimate);
-
-    delete vel;
+    stats.compute(
+            stat_group,
+            this->iteration / this->niter_out);
 
     return EXIT_SUCCESS;
 }
@@ -159,7 +154,10 @@ int joint_acc_vel_stats<rnumber>::finalize(void)
     delete this->ve;
     delete this->kk;
     if (this->myrank == 0)
+    {
+        hdf5_tools::close_cached_datasets(this->stat_file);
         H5Fclose(this->stat_file);
+    }
     this->NSVE_field_stats<rnumber>::finalize();
     return EXIT_SUCCESS;
 }
@@ -35,6 +35,7 @@
 #include "base.hpp"
 #include "field.hpp"
 #include "scope_timer.hpp"
+#include "numa_tools.hpp"
 
 int myrank, nprocs;
 
@@ -44,6 +45,17 @@ int main_code(
         char *argv[],
         const bool floating_point_exceptions)
 {
+    /* NUMA placement switch */
+    const bool numa_pinning = (
+            (getenv("BFPS_NUMA_PIN") != nullptr) &&
+            (getenv("BFPS_NUMA_PIN") == std::string("TRUE")));
+
+    /* asynchronous checkpoints are written by a second thread, which
+     * needs full MPI thread support */
+    const bool async_checkpoints = (
+            (getenv("BFPS_ASYNC_CHECKPOINTS") != nullptr) &&
+            (getenv("BFPS_ASYNC_CHECKPOINTS") == std::string("TRUE")));
+
     /* floating point exception switch */
     if (floating_point_exceptions)
         feenableexcept(FE_INVALID | FE_OVERFLOW);
@@ -65,18 +77,39 @@ int main_code(
 
     /* initialize MPI environment */
 #ifdef NO_FFTWOMP
-    MPI_Init(&argc, &argv);
+    if (async_checkpoints)
+    {
+        int mpiprovided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &mpiprovided);
+    }
+    else
+        MPI_Init(&argc, &argv);
     MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
     MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    if (numa_pinning)
+    {
+        numa_tools::pin_to_numa_domain(MPI_COMM_WORLD);
+        numa_tools::report_placement(MPI_COMM_WORLD);
+    }
     fftw_mpi_init();
     fftwf_mpi_init();
     DEBUG_MSG("There are %d processes\n", nprocs);
 #else
     int mpiprovided;
-    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Init_thread(
+            &argc, &argv,
+            async_checkpoints ? MPI_THREAD_MULTIPLE : MPI_THREAD_FUNNELED,
+            &mpiprovided);
     assert(mpiprovided >= MPI_THREAD_FUNNELED);
     MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
     MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    /* pin before the first parallel region, so that threads inherit the
+     * affinity and first touch places fields in the local domain */
+    if (numa_pinning)
+    {
+        numa_tools::pin_to_numa_domain(MPI_COMM_WORLD);
+        numa_tools::report_placement(MPI_COMM_WORLD);
+    }
     const int nThreads = omp_get_max_threads();
     DEBUG_MSG("Number of threads for the FFTW = %d\n",
               nThreads);
@@ -151,6 +184,12 @@ int main_code(
 
 
     /* clean up */
+    fftw_plan_registry<float>::clear();
+    fftw_plan_registry<double>::clear();
+    pencil_fft<float>::clear();
+    pencil_fft<double>::clear();
+    truncated_fft<float>::clear();
+    truncated_fft<double>::clear();
     fftwf_mpi_cleanup();
     fftw_mpi_cleanup();
 #ifndef NO_FFTWOMP
@@ -1,3 +1,6 @@
+#include <map>
+#include <algorithm>
+#include <cstdint>
 #include "hdf5_tools.hpp"
 
 int hdf5_tools::require_size_single_dataset(hid_t dset, int tsize)
@@ -188,6 +191,216 @@ std::string hdf5_tools::read_string(
     return std_string_data;
 }
 
+/* cached datasets, with keys "<file name>:<group path>/<dataset name>" */
+static std::map<std::string, hid_t> dataset_cache;
+
+static std::string cache_file_key(const hid_t loc)
+{
+    std::string fname(H5Fget_name(loc, NULL, 0), '\0');
+    H5Fget_name(loc, &fname.front(), fname.size()+1);
+    return fname + ":";
+}
+
+static std::string cache_dataset_key(
+        const hid_t group,
+        const std::string dset_name)
+{
+    std::string gname(H5Iget_name(group, NULL, 0), '\0');
+    H5Iget_name(group, &gname.front(), gname.size()+1);
+    return cache_file_key(group) + gname + "/" + dset_name;
+}
+
+/* rows of a statistics dataset that haven't been written yet, for the
+ * consecutive time offsets first_toffset, ..., first_toffset + nrows - 1 */
+struct stats_buffer
+{
+    hid_t dset;
+    hid_t mem_type;
+    size_t row_bytes;
+    hsize_t first_toffset;
+    hsize_t nrows;
+    std::vector<char> rows;
+};
+
+static std::map<std::string, stats_buffer> stats_buffers;
+
+hid_t hdf5_tools::open_cached_dataset(
+        const hid_t group,
+        const std::string dset_name)
+{
+    const std::string key = cache_dataset_key(group, dset_name);
+    auto cached = dataset_cache.find(key);
+    if (cached != dataset_cache.end())
+        return cached->second;
+    hid_t dset = H5Dopen(group, dset_name.c_str(), H5P_DEFAULT);
+    if (dset >= 0)
+        dataset_cache[key] = dset;
+    return dset;
+}
+
+int hdf5_tools::close_cached_datasets(
+        const hid_t file)
+{
+    flush_stats(file);
+    const std::string file_key = cache_file_key(file);
+    auto buffer = stats_buffers.begin();
+    while (buffer != stats_buffers.end())
+    {
+        if (buffer->first.compare(0, file_key.size(), file_key) == 0)
+            buffer = stats_buffers.erase(buffer);
+        else
+            ++buffer;
+    }
+    auto cached = dataset_cache.begin();
+    while (cached != dataset_cache.end())
+    {
+        if (cached->first.compare(0, file_key.size(), file_key) == 0)
+        {
+            H5Dclose(cached->second);
+            cached = dataset_cache.erase(cached);
+        }
+        else
+            ++cached;
+    }
+    return EXIT_SUCCESS;
+}
+
+static hsize_t stats_flush_interval = 64;
+
+int hdf5_tools::set_stats_flush_interval(
+        const hsize_t nrows)
+{
+    stats_flush_interval = std::max(hsize_t(1), nrows);
+    return EXIT_SUCCESS;
+}
+
+static hsize_t get_max_buffered_rows()
+{
+    if (getenv("BFPS_STATS_BUFFER_ROWS") != nullptr)
+        return std::max(1, atoi(getenv("BFPS_STATS_BUFFER_ROWS")));
+    return stats_flush_interval;
+}
+
+static int flush_stats_buffer(stats_buffer &buffer)
+{
+    if (buffer.nrows == 0)
+        return EXIT_SUCCESS;
+    hdf5_tools::require_size_single_dataset(
+            buffer.dset,
+            buffer.first_toffset + buffer.nrows);
+    hid_t wspace = H5Dget_space(buffer.dset);
+    int ndims = H5Sget_simple_extent_ndims(wspace);
+    std::vector<hsize_t> offset(ndims, 0), count(ndims);
+    H5Sget_simple_extent_dims(wspace, &count.front(), NULL);
+    offset[0] = buffer.first_toffset;
+    count[0] = buffer.nrows;
+    hid_t mspace = H5Screate_simple(ndims, &count.front(), NULL);
+    H5Sselect_hyperslab(wspace, H5S_SELECT_SET, &offset.front(), NULL, &count.front(), NULL);
+    herr_t status = H5Dwrite(
+            buffer.dset,
+            buffer.mem_type,
+            mspace,
+            wspace,
+            H5P_DEFAULT,
+            &buffer.rows.front());
+    H5Sclose(mspace);
+    H5Sclose(wspace);
+    buffer.nrows = 0;
+    buffer.rows.clear();
+    return (status < 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+template <typename number>
+static hid_t native_type();
+template <>
+hid_t native_type<double>()
+{
+    return H5T_NATIVE_DOUBLE;
+}
+template <>
+hid_t native_type<int64_t>()
+{
+    return H5T_NATIVE_INT64;
+}
+
+template <typename number>
+int hdf5_tools::write_stats_row(
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset,
+        const number *data)
+{
+    const std::string key = cache_dataset_key(group, dset_name);
+    auto found = stats_buffers.find(key);
+    if (found == stats_buffers.end())
+    {
+        stats_buffer buffer;
+        buffer.dset = open_cached_dataset(group, dset_name);
+        if (buffer.dset < 0)
+            return EXIT_FAILURE;
+        buffer.mem_type = native_type<number>();
+        hid_t space = H5Dget_space(buffer.dset);
+        int ndims = H5Sget_simple_extent_ndims(space);
+        std::vector<hsize_t> dims(ndims);
+        H5Sget_simple_extent_dims(space, &dims.front(), NULL);
+        H5Sclose(space);
+        buffer.row_bytes = sizeof(number);
+        for (int i = 1; i < ndims; i++)
+            buffer.row_bytes *= dims[i];
+        buffer.first_toffset = toffset;
+        buffer.nrows = 0;
+        found = stats_buffers.insert(std::make_pair(key, buffer)).first;
+    }
+    stats_buffer &buffer = found->second;
+    /* rows that are still buffered can be overwritten, anything else that
+     * isn't the next row means that the buffer must be written first */
+    if (buffer.nrows > 0 &&
+        (toffset < buffer.first_toffset ||
+         toffset > buffer.first_toffset + buffer.nrows))
+        flush_stats_buffer(buffer);
+    if (buffer.nrows == 0)
+        buffer.first_toffset = toffset;
+    if (toffset == buffer.first_toffset + buffer.nrows)
+    {
+        buffer.nrows++;
+        buffer.rows.resize(buffer.nrows*buffer.row_bytes);
+    }
+    std::copy((const char*)data,
+              (const char*)data + buffer.row_bytes,
+              &buffer.rows[(toffset - buffer.first_toffset)*buffer.row_bytes]);
+    if (buffer.nrows >= get_max_buffered_rows())
+        return flush_stats_buffer(buffer);
+    return EXIT_SUCCESS;
+}
+
+int hdf5_tools::flush_stats(
+        const hid_t file)
+{
+    const std::string file_key = cache_file_key(file);
+    int status = EXIT_SUCCESS;
+    for (auto &buffer : stats_buffers)
+        if (buffer.first.compare(0, file_key.size(), file_key) == 0)
+        {
+            if (flush_stats_buffer(buffer.second) != EXIT_SUCCESS)
+                status = EXIT_FAILURE;
+        }
+    return status;
+}
+
+template
+int hdf5_tools::write_stats_row<double>(
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const double *);
+
+template
+int hdf5_tools::write_stats_row<int64_t>(
+        const hid_t,
+        const std::string,
+        const hsize_t,
+        const int64_t *);
+
 template
 std::vector<int> hdf5_tools::read_vector<int>(
         const hid_t,
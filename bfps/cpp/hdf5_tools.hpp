@@ -28,6 +28,7 @@
 #define HDF5_TOOLS_HPP
 
 #include <vector>
+#include <string>
 #include <hdf5.h>
 #include "base.hpp"
 
@@ -79,6 +80,45 @@ namespace hdf5_tools
     std::string read_string(
             const hid_t group,
             const std::string dset_name);
+
+    /* datasets that are written repeatedly (statistics, iteration
+     * counters) stay open until close_cached_datasets is called for their
+     * file, so that each write doesn't pay for the metadata lookups of
+     * H5Dopen.
+     * the returned dataset must not be closed by the caller. */
+    hid_t open_cached_dataset(
+            const hid_t group,
+            const std::string dset_name);
+
+    /* writes the buffered statistics of the file that `file` belongs to,
+     * then closes its cached datasets.
+     * needs to be called before the file itself is closed */
+    int close_cached_datasets(
+            const hid_t file);
+
+    /* statistics are written one row, i.e. one time offset, at a time.
+     * rows are buffered per dataset, and written as a single hyperslab of
+     * consecutive time offsets when the buffer holds as many rows as set
+     * by set_stats_flush_interval (64 by default, BFPS_STATS_BUFFER_ROWS
+     * overrides it), or when flush_stats is called.
+     * the dataset is grown if it is too small for the rows.
+     * `data` is the complete row, i.e. the product of all dimensions but
+     * the first one. */
+    template <typename number>
+    int write_stats_row(
+            const hid_t group,
+            const std::string dset_name,
+            const hsize_t toffset,
+            const number *data);
+
+    /* writes the buffered statistics of the file that `file` belongs to */
+    int flush_stats(
+            const hid_t file);
+
+    /* number of rows that write_stats_row buffers before writing them,
+     * at least 1 */
+    int set_stats_flush_interval(
+            const hsize_t nrows);
 }
 
 #endif//HDF5_TOOLS_HPP
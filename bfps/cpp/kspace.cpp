@@ -27,9 +27,11 @@
 #include <cstdlib>
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include "kspace.hpp"
 #include "scope_timer.hpp"
 #include "shared_array.hpp"
+#include "hdf5_tools.hpp"
 
 template <field_backend be,
           kspace_dealias_type dt>
@@ -57,12 +59,14 @@ kspace<be, dt>::kspace(
     switch(be)
     {
         case FFTW:
-            this->kx.resize(this->layout->sizes[2]);
+        case PENCIL:
+            /* ky and, for pencils, kx are distributed; kz is always local */
+            this->kx.resize(this->layout->subsizes[2]);
             this->ky.resize(this->layout->subsizes[0]);
             this->kz.resize(this->layout->sizes[1]);
             int i, ii;
-            for (i = 0; i<int(this->layout->sizes[2]); i++)
-                this->kx[i] = i*this->dkx;
+            for (i = 0; i<int(this->layout->subsizes[2]); i++)
+                this->kx[i] = (i + this->layout->starts[2])*this->dkx;
             for (i = 0; i<int(this->layout->subsizes[0]); i++)
             {
                 ii = i + this->layout->starts[0];
@@ -108,6 +112,9 @@ kspace<be, dt>::kspace(
     this->nshells = int(this->kM / this->dk) + 2;
     this->kshell.resize(this->nshells, 0);
     this->nshell.resize(this->nshells, 0);
+    assert(this->nshells <= std::numeric_limits<uint16_t>::max());
+    this->knorm.resize(this->layout->local_size);
+    this->shell_index.resize(this->layout->local_size);
 
     shared_array<double> kshell_local_thread(this->nshells,[&](double* kshell_local){
         std::fill_n(kshell_local, this->nshells, 0);
@@ -116,8 +123,6 @@ kspace<be, dt>::kspace(
         std::fill_n(nshell_local, this->nshells, 0);
     });
 
-    std::vector<std::unordered_map<int, double>> dealias_filter_threaded(omp_get_max_threads());
-
     this->CLOOP_K2_NXMODES(
             [&](ptrdiff_t cindex,
                 ptrdiff_t xindex,
@@ -125,15 +130,15 @@ kspace<be, dt>::kspace(
                 ptrdiff_t zindex,
                 double k2,
                 int nxmodes){
+            const double knorm = sqrt(k2);
+            this->knorm[cindex] = float(knorm);
+            this->shell_index[cindex] = (
+                    (k2 <= this->kM2) ? int(knorm/this->dk) : this->nshells);
             if (k2 < this->kM2)
             {
-                double knorm = sqrt(k2);
                 kshell_local_thread.getMine()[int(knorm/this->dk)] += nxmodes*knorm;
                 nshell_local_thread.getMine()[int(knorm/this->dk)] += nxmodes;
             }
-            if (dt == SMOOTH){
-                dealias_filter_threaded[omp_get_thread_num()][int(round(k2 / this->dk2))] = exp(-36.0 * pow(k2/this->kM2, 18.));
-            }
     });
 
     // Merge results
@@ -141,11 +146,27 @@ kspace<be, dt>::kspace(
     kshell_local_thread.mergeParallel();
     nshell_local_thread.mergeParallel();
 
+    /* the smooth filter rounds to one up to about k = kM/3, and underflows
+     * to zero shortly beyond kM, so the table only holds the shells between
+     * these two, up to the largest shell of the local modes */
+    this->dealias_shell0 = 0;
     if (dt == SMOOTH){
-        for(int idxMerge = 0 ; idxMerge < int(dealias_filter_threaded.size()) ; ++idxMerge){
-            for(const auto kv : dealias_filter_threaded[idxMerge]){
-                this->dealias_filter[kv.first] = kv.second;
-            }
+        double local_k2max = 0;
+        for (auto k : this->ky)
+            local_k2max = std::max(local_k2max, k*k);
+        for (auto k : this->kz)
+            local_k2max = std::max(local_k2max, k*k);
+        if (!this->kx.empty())
+            local_k2max += this->kx.back()*this->kx.back();
+        const size_t local_shell_max = size_t(local_k2max / this->dk2 + 0.5);
+        for (size_t n = 0; n <= local_shell_max; n++){
+            const double tval = exp(-36.0 * pow(n*this->dk2/this->kM2, 18.));
+            if (tval == 0)
+                break;
+            if (tval == 1)
+                this->dealias_shell0 = n+1;
+            else
+                this->dealias_filter.push_back(tval);
         }
     }
 
@@ -275,22 +296,28 @@ void kspace<be, dt>::ball_filter(
         const double ell)
 {
     const double prefactor0 = double(3) / pow(ell/2, 3);
-    this->CLOOP_K2(
-            [&](ptrdiff_t cindex,
-                ptrdiff_t xindex,
+    this->CLOOP_ROWS(
+            [&](ptrdiff_t row_cindex,
+                ptrdiff_t nx,
                 ptrdiff_t yindex,
-                ptrdiff_t zindex,
-                double k2){
-                if (k2 > 0)
-                {
-                    double argument = sqrt(k2)*ell / 2;
-                    double prefactor = prefactor0 / pow(k2, 1.5);
-                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
-                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= (
-                            prefactor *
-                            (sin(argument) - argument * cos(argument)));
-                }
-                });
+                ptrdiff_t zindex){
+            const float *__restrict__ knorm = &this->knorm[row_cindex];
+            rnumber *__restrict__ row = ((rnumber*)a) + 2*ncomp(fc)*row_cindex;
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+            {
+                /* the k = 0 mode is left as it is */
+                if (knorm[xindex] == 0)
+                    continue;
+                const double kk = knorm[xindex];
+                const double argument = kk*ell / 2;
+                const double prefactor = prefactor0 / (kk*kk*kk);
+                const double tval = (
+                        prefactor *
+                        (sin(argument) - argument * cos(argument)));
+                for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
+                    row[2*ncomp(fc)*xindex + tcounter] *= tval;
+            }
+            });
 }
 
 /** \brief Filter a field using a Gaussian kernel.
@@ -309,17 +336,21 @@ void kspace<be, dt>::Gauss_filter(
         const double sigma)
 {
     const double prefactor = - sigma*sigma/2;
-    this->CLOOP_K2(
-            [&](ptrdiff_t cindex,
-                ptrdiff_t xindex,
+    this->CLOOP_ROWS(
+            [&](ptrdiff_t row_cindex,
+                ptrdiff_t nx,
                 ptrdiff_t yindex,
-                ptrdiff_t zindex,
-                double k2){
-                {
-                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
-                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= exp(prefactor*k2);
-                }
-                });
+                ptrdiff_t zindex){
+            const float *__restrict__ knorm = &this->knorm[row_cindex];
+            rnumber *__restrict__ row = ((rnumber*)a) + 2*ncomp(fc)*row_cindex;
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+            {
+                const double kk = knorm[xindex];
+                const double tval = exp(prefactor*kk*kk);
+                for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
+                    row[2*ncomp(fc)*xindex + tcounter] *= tval;
+            }
+            });
 }
 
 /** \brief Filter a field.
@@ -470,15 +501,26 @@ void kspace<be, dt>::dealias(typename fftw_interface<rnumber>::complex *__restri
             this->low_pass<rnumber, fc>(a, this->kM);
             break;
         case SMOOTH:
-            this->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
+            this->CLOOP_ROWS(
+                [&](ptrdiff_t row_cindex,
+                    ptrdiff_t nx,
                     ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-                    double tval = this->dealias_filter[int(round(k2 / this->dk2))];
-                    for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
-                        ((rnumber*)a)[2*ncomp(fc)*cindex + tcounter] *= tval;
+                    ptrdiff_t zindex){
+                    const double kyz2 = (this->ky[yindex]*this->ky[yindex] +
+                                         this->kz[zindex]*this->kz[zindex]);
+                    /* kx grows along the row, so the rows below the
+                     * first tabulated shell are left as they are */
+                    if (size_t((kyz2 + this->kx[nx-1]*this->kx[nx-1])/this->dk2 + 0.5) <
+                            this->dealias_shell0)
+                        return;
+                    rnumber *__restrict__ row = ((rnumber*)a) + 2*ncomp(fc)*row_cindex;
+                    for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+                    {
+                        const double tval = this->dealias_factor(
+                                kyz2 + this->kx[xindex]*this->kx[xindex]);
+                        for (unsigned int tcounter=0; tcounter<2*ncomp(fc); tcounter++)
+                            row[2*ncomp(fc)*xindex + tcounter] *= tval;
+                    }
                 });
             break;
     }
@@ -497,21 +539,8 @@ void kspace<be, dt>::force_divfree(typename fftw_interface<rnumber>::complex *__
                     ptrdiff_t zindex,
                     double k2){
                 if (k2 > 0)
-        {
-                    typename fftw_interface<rnumber>::complex tval;
-                    tval[0] = (this->kx[xindex]*((*(a + cindex*3  ))[0]) +
-                               this->ky[yindex]*((*(a + cindex*3+1))[0]) +
-                               this->kz[zindex]*((*(a + cindex*3+2))[0]) ) / k2;
-                    tval[1] = (this->kx[xindex]*((*(a + cindex*3  ))[1]) +
-                               this->ky[yindex]*((*(a + cindex*3+1))[1]) +
-                               this->kz[zindex]*((*(a + cindex*3+2))[1]) ) / k2;
-                    for (int imag_part=0; imag_part<2; imag_part++)
-                    {
-                        a[cindex*3  ][imag_part] -= tval[imag_part]*this->kx[xindex];
-                        a[cindex*3+1][imag_part] -= tval[imag_part]*this->ky[yindex];
-                        a[cindex*3+2][imag_part] -= tval[imag_part]*this->kz[zindex];
-                    }
-           }
+                    this->template project_divfree<rnumber>(
+                            a + cindex*3, xindex, yindex, zindex, k2);
         }
     );
     if (this->layout->myrank == this->layout->rank[0][0])
@@ -529,27 +558,59 @@ void kspace<be, dt>::cospectrum(
         const std::string dset_name,
         const hsize_t toffset)
 {
-    TIMEZONE("field::cospectrum");
-    shared_array<double> spec_local_thread(this->nshells*ncomp(fc)*ncomp(fc),[&](double* spec_local){
-        std::fill_n(spec_local, this->nshells*ncomp(fc)*ncomp(fc), 0);
+    this->template cospectra<rnumber, fc>(
+            std::vector<const rnumber(*)[2]>(1, (const rnumber(*)[2])a),
+            std::vector<const rnumber(*)[2]>(1, (const rnumber(*)[2])b),
+            group,
+            std::vector<std::string>(1, dset_name),
+            toffset);
+}
+
+template <field_backend be,
+          kspace_dealias_type dt>
+template <typename rnumber,
+          field_components fc>
+void kspace<be, dt>::cospectra(
+        const std::vector<const rnumber(*)[2]> &a,
+        const std::vector<const rnumber(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset)
+{
+    TIMEZONE("kspace::cospectra");
+    const int npairs = a.size();
+    assert(int(b.size()) == npairs);
+    assert(int(dset_name.size()) == npairs);
+    const int spec_size = this->nshells*ncomp(fc)*ncomp(fc);
+    shared_array<double> spec_local_thread(npairs*spec_size,[&](double* spec_local){
+        std::fill_n(spec_local, npairs*spec_size, 0);
     });
 
-    this->CLOOP_K2_NXMODES(
-            [&](ptrdiff_t cindex,
-                ptrdiff_t xindex,
+    this->CLOOP_ROWS(
+            [&](ptrdiff_t row_cindex,
+                ptrdiff_t nx,
                 ptrdiff_t yindex,
-                ptrdiff_t zindex,
-                double k2,
-                int nxmodes){
-            if (k2 <= this->kM2)
+                ptrdiff_t zindex){
+            double* spec_local = spec_local_thread.getMine();
+            const uint16_t *__restrict__ shells = &this->shell_index[row_cindex];
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
             {
-                double* spec_local = spec_local_thread.getMine();
-                int tmp_int = int(sqrt(k2) / this->dk)*ncomp(fc)*ncomp(fc);
-                for (hsize_t i=0; i<ncomp(fc); i++)
-                for (hsize_t j=0; j<ncomp(fc); j++){
-                    spec_local[tmp_int + i*ncomp(fc)+j] += nxmodes * (
-                        (a[ncomp(fc)*cindex + i][0] * b[ncomp(fc)*cindex + j][0]) +
-                        (a[ncomp(fc)*cindex + i][1] * b[ncomp(fc)*cindex + j][1]));
+                if (shells[xindex] >= this->nshells)
+                    continue;
+                /* only the kx = 0 modes have no conjugate partner */
+                const int nxmodes = (xindex == 0 && this->layout->starts[2] == 0) ? 1 : 2;
+                const ptrdiff_t cindex = row_cindex + xindex;
+                for (int pp = 0; pp < npairs; pp++)
+                {
+                    double *__restrict__ spec_shell = (
+                            spec_local + pp*spec_size +
+                            shells[xindex]*ncomp(fc)*ncomp(fc));
+                    for (hsize_t i=0; i<ncomp(fc); i++)
+                    for (hsize_t j=0; j<ncomp(fc); j++){
+                        spec_shell[i*ncomp(fc)+j] += nxmodes * (
+                            (a[pp][ncomp(fc)*cindex + i][0] * b[pp][ncomp(fc)*cindex + j][0]) +
+                            (a[pp][ncomp(fc)*cindex + i][1] * b[pp][ncomp(fc)*cindex + j][1]));
+                    }
                 }
             }
             });
@@ -557,7 +618,7 @@ void kspace<be, dt>::cospectrum(
     spec_local_thread.mergeParallel();
 
     std::vector<double> spec;
-    spec.resize(this->nshells*ncomp(fc)*ncomp(fc), 0);
+    spec.resize(npairs*spec_size, 0);
     MPI_Allreduce(
             spec_local_thread.getMasterData(),
             &spec.front(),
@@ -565,35 +626,12 @@ void kspace<be, dt>::cospectrum(
             MPI_DOUBLE, MPI_SUM, this->layout->comm);
     if (this->layout->myrank == 0)
     {
-        hid_t dset, wspace, mspace;
-        hsize_t count[(ndim(fc)-2)*2], offset[(ndim(fc)-2)*2], dims[(ndim(fc)-2)*2];
-        dset = H5Dopen(group, ("spectra/" + dset_name).c_str(), H5P_DEFAULT);
-        wspace = H5Dget_space(dset);
-        H5Sget_simple_extent_dims(wspace, dims, NULL);
-        switch (fc)
-        {
-            case THREExTHREE:
-                offset[4] = 0;
-                offset[5] = 0;
-                count[4] = ncomp(fc);
-                count[5] = ncomp(fc);
-            case THREE:
-                offset[2] = 0;
-                offset[3] = 0;
-                count[2] = ncomp(fc);
-                count[3] = ncomp(fc);
-            default:
-                offset[0] = toffset;
-                offset[1] = 0;
-                count[0] = 1;
-                count[1] = this->nshells;
-        }
-        mspace = H5Screate_simple((ndim(fc)-2)*2, count, NULL);
-        H5Sselect_hyperslab(wspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-        H5Dwrite(dset, H5T_NATIVE_DOUBLE, mspace, wspace, H5P_DEFAULT, &spec.front());
-        H5Sclose(wspace);
-        H5Sclose(mspace);
-        H5Dclose(dset);
+        for (int pp = 0; pp < npairs; pp++)
+            hdf5_tools::write_stats_row(
+                    group,
+                    "spectra/" + dset_name[pp],
+                    toffset,
+                    &spec[pp*spec_size]);
     }
 }
 
@@ -806,3 +844,355 @@ template void kspace<FFTW, SMOOTH>::force_divfree<float>(
 template void kspace<FFTW, SMOOTH>::force_divfree<double>(
        typename fftw_interface<double>::complex *__restrict__ a);
 
+template class kspace<PENCIL, TWO_THIRDS>;
+template class kspace<PENCIL, SMOOTH>;
+
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<ONE> *,
+        const double, const double, const double);
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<THREE> *,
+        const double, const double, const double);
+template kspace<PENCIL, TWO_THIRDS>::kspace<>(
+        const field_layout<THREExTHREE> *,
+        const double, const double, const double);
+
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<ONE> *,
+        const double, const double, const double);
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<THREE> *,
+        const double, const double, const double);
+template kspace<PENCIL, SMOOTH>::kspace<>(
+        const field_layout<THREExTHREE> *,
+        const double, const double, const double);
+
+template void kspace<PENCIL, SMOOTH>::low_pass<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::low_pass<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::low_pass<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax);
+
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+template void kspace<PENCIL, SMOOTH>::Gauss_filter<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax);
+
+template int kspace<PENCIL, SMOOTH>::filter<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+template int kspace<PENCIL, SMOOTH>::filter_calibrated_ell<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a,
+        const double kmax,
+        std::string filter_type);
+
+template void kspace<PENCIL, SMOOTH>::dealias<float, ONE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<float, THREE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<float, THREExTHREE>(
+        typename fftw_interface<float>::complex *__restrict__ a);
+
+template void kspace<PENCIL, SMOOTH>::dealias<double, ONE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<double, THREE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::dealias<double, THREExTHREE>(
+        typename fftw_interface<double>::complex *__restrict__ a);
+
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, ONE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, THREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<float, THREExTHREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, ONE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, THREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectrum<double, THREExTHREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, ONE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, THREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<float, THREExTHREE>(
+        const typename fftw_interface<float>::complex *__restrict__ a,
+        const typename fftw_interface<float>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, ONE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, THREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectrum<double, THREExTHREE>(
+        const typename fftw_interface<double>::complex *__restrict__ a,
+        const typename fftw_interface<double>::complex *__restrict__ b,
+        const hid_t group,
+        const std::string dset_name,
+        const hsize_t toffset);
+
+template void kspace<PENCIL, SMOOTH>::force_divfree<float>(
+       typename fftw_interface<float>::complex *__restrict__ a);
+template void kspace<PENCIL, SMOOTH>::force_divfree<double>(
+       typename fftw_interface<double>::complex *__restrict__ a);
+
+template void kspace<FFTW, TWO_THIRDS>::cospectra<float, ONE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, TWO_THIRDS>::cospectra<float, THREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, TWO_THIRDS>::cospectra<float, THREExTHREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, TWO_THIRDS>::cospectra<double, ONE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, TWO_THIRDS>::cospectra<double, THREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, TWO_THIRDS>::cospectra<double, THREExTHREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<float, ONE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<float, THREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<float, THREExTHREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<double, ONE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<double, THREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<FFTW, SMOOTH>::cospectra<double, THREExTHREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<float, ONE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<float, THREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<float, THREExTHREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<double, ONE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<double, THREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, TWO_THIRDS>::cospectra<double, THREExTHREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<float, ONE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<float, THREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<float, THREExTHREE>(
+        const std::vector<const float(*)[2]> &a,
+        const std::vector<const float(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<double, ONE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<double, THREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
+template void kspace<PENCIL, SMOOTH>::cospectra<double, THREExTHREE>(
+        const std::vector<const double(*)[2]> &a,
+        const std::vector<const double(*)[2]> &b,
+        const hid_t group,
+        const std::vector<std::string> &dset_name,
+        const hsize_t toffset);
@@ -25,7 +25,7 @@
 
 
 #include <hdf5.h>
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include "omputils.hpp"
@@ -36,7 +36,9 @@
 
 #define KSPACE_HPP
 
-enum field_backend {FFTW};
+/* FFTW:   slabs, distributed 3D FFTs computed by FFTW-MPI.
+ * PENCIL: pencils on a 2D process grid, see `pencil_fft`. */
+enum field_backend {FFTW, PENCIL};
 enum kspace_dealias_type {TWO_THIRDS, SMOOTH};
 
 
@@ -54,10 +56,22 @@ class kspace
         /* mode and dealiasing information */
         double kMx, kMy, kMz, kM, kM2;
         std::vector<double> kx, ky, kz;
-        std::unordered_map<int, double> dealias_filter;
+        /* values of the smooth filter on the shells k2 = n*dk2, indexed by
+         * n - dealias_shell0; only the shells of local modes where the
+         * filter is neither 1 (below dealias_shell0) nor 0 (beyond the end
+         * of the table) are stored */
+        std::vector<double> dealias_filter;
+        size_t dealias_shell0;
         std::vector<double> kshell;
         std::vector<int64_t> nshell;
         int nshells;
+        /* per mode tables, in the order of the local complex layout:
+         * |k| in single precision (relative error below 6e-8, so that the
+         * isotropic filters change by less than 1e-7), and the spectrum
+         * shell int(|k|/dk) of modes with k2 <= kM2 (nshells for the
+         * other modes) */
+        std::vector<float> knorm;
+        std::vector<uint16_t> shell_index;
 
         /* methods */
         template <field_components fc>
@@ -114,6 +128,18 @@ class kspace
                 const hid_t group,
                 const std::string dset_name,
                 const hsize_t toffset);
+
+        /* cospectra of several pairs of fields, computed in one pass;
+         * the cospectrum of a[i] and b[i] is stored in dset_name[i] */
+        template <typename rnumber,
+                  field_components fc>
+        void cospectra(
+                const std::vector<const rnumber(*)[2]> &a,
+                const std::vector<const rnumber(*)[2]> &b,
+                const hid_t group,
+                const std::vector<std::string> &dset_name,
+                const hsize_t toffset);
+
         template <class func_type>
         void CLOOP(func_type expression)
         {
@@ -135,6 +161,26 @@ class kspace
                 }
             }
         }
+        /* same loop as CLOOP, but `expression(cindex, nx, yindex, zindex)`
+         * is called once per kx row, with `cindex` the index of the first
+         * mode of the row, so that kernels can run over the mode tables */
+        template <class func_type>
+        void CLOOP_ROWS(func_type expression)
+        {
+            #pragma omp parallel
+            {
+                const hsize_t start = OmpUtils::ForIntervalStart(this->layout->subsizes[1]);
+                const hsize_t end = OmpUtils::ForIntervalEnd(this->layout->subsizes[1]);
+
+                for (hsize_t yindex = 0; yindex < this->layout->subsizes[0]; yindex++){
+                    for (hsize_t zindex = start; zindex < end; zindex++){
+                        ptrdiff_t cindex = yindex*this->layout->subsizes[1]*this->layout->subsizes[2]
+                                            + zindex*this->layout->subsizes[2];
+                        expression(cindex, ptrdiff_t(this->layout->subsizes[2]), yindex, zindex);
+                    }
+                }
+            }
+        }
         template <class func_type>
         void CLOOP_K2(func_type expression)
         {
@@ -176,7 +222,9 @@ class kspace
                                 this->kx[xindex]*this->kx[xindex] +
                                 this->ky[yindex]*this->ky[yindex] +
                                 this->kz[zindex]*this->kz[zindex]);
-                        expression(cindex, xindex, yindex, zindex, k2, 1);
+                        /* only the kx = 0 modes have no conjugate partner */
+                        expression(cindex, xindex, yindex, zindex, k2,
+                                   (this->layout->starts[2] == 0) ? 1 : 2);
                         cindex++;
                         for (xindex = 1; xindex < this->layout->subsizes[2]; xindex++)
                         {
@@ -192,6 +240,51 @@ class kspace
         }
         template <typename rnumber>
         void force_divfree(typename fftw_interface<rnumber>::complex *__restrict__ a);
+
+        /* per mode versions of `dealias` and `force_divfree`,
+         * for kernels that fuse several operations in one sweep */
+        inline double dealias_factor(const double k2) const
+        {
+            switch(dt)
+            {
+                case TWO_THIRDS:
+                    return (k2 < this->kM2) ? 1.0 : 0.0;
+                case SMOOTH:
+                    {
+                        /* k2 >= 0, so truncation rounds to the nearest shell */
+                        const size_t shell = size_t(k2 / this->dk2 + 0.5);
+                        if (shell < this->dealias_shell0)
+                            return 1.0;
+                        return ((shell - this->dealias_shell0 < this->dealias_filter.size()) ?
+                                this->dealias_filter[shell - this->dealias_shell0] : 0.0);
+                    }
+            }
+            return 0.0;
+        }
+        /* remove the component of the vector `a` along the wavevector;
+         * k2 must be positive */
+        template <typename rnumber>
+        inline void project_divfree(
+                typename fftw_interface<rnumber>::complex *__restrict__ a,
+                const ptrdiff_t xindex,
+                const ptrdiff_t yindex,
+                const ptrdiff_t zindex,
+                const double k2) const
+        {
+            typename fftw_interface<rnumber>::complex tval;
+            tval[0] = (this->kx[xindex]*a[0][0] +
+                       this->ky[yindex]*a[1][0] +
+                       this->kz[zindex]*a[2][0] ) / k2;
+            tval[1] = (this->kx[xindex]*a[0][1] +
+                       this->ky[yindex]*a[1][1] +
+                       this->kz[zindex]*a[2][1] ) / k2;
+            for (int imag_part=0; imag_part<2; imag_part++)
+            {
+                a[0][imag_part] -= tval[imag_part]*this->kx[xindex];
+                a[1][imag_part] -= tval[imag_part]*this->ky[yindex];
+                a[2][imag_part] -= tval[imag_part]*this->kz[zindex];
+            }
+        }
 };
 
 #endif//KSPACE_HPP
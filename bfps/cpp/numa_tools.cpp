@@ -0,0 +1,174 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <sched.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include "numa_tools.hpp"
+
+/* parse lists such as "0-7,16-23" */
+static std::vector<int> parse_cpulist(const std::string &cpulist)
+{
+    std::vector<int> cpus;
+    std::stringstream ss(cpulist);
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        int first, last;
+        int nread = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (nread < 1)
+            continue;
+        if (nread == 1)
+            last = first;
+        for (int cpu = first; cpu <= last; cpu++)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+std::vector<std::string> numa_tools::get_domain_cpulists()
+{
+    std::vector<std::string> cpulists;
+    DIR *node_dir = opendir("/sys/devices/system/node");
+    if (node_dir == NULL)
+        return cpulists;
+    std::vector<int> domains;
+    struct dirent *entry;
+    while ((entry = readdir(node_dir)) != NULL)
+    {
+        int domain;
+        if (sscanf(entry->d_name, "node%d", &domain) == 1)
+            domains.push_back(domain);
+    }
+    closedir(node_dir);
+    std::sort(domains.begin(), domains.end());
+    for (int domain : domains)
+    {
+        std::ifstream cpulist_file(
+                "/sys/devices/system/node/node" +
+                std::to_string(domain) +
+                "/cpulist");
+        std::string cpulist;
+        std::getline(cpulist_file, cpulist);
+        /* domains without cpus hold memory only */
+        if (!parse_cpulist(cpulist).empty())
+            cpulists.push_back(cpulist);
+    }
+    return cpulists;
+}
+
+int numa_tools::pin_to_numa_domain(
+        const MPI_Comm comm)
+{
+    MPI_Comm node_comm;
+    int node_rank, node_size;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_size(node_comm, &node_size);
+    MPI_Comm_free(&node_comm);
+
+    std::vector<std::string> cpulists = get_domain_cpulists();
+    if (cpulists.empty())
+    {
+        DEBUG_MSG("numa_tools::pin_to_numa_domain: no NUMA information available\n");
+        return EXIT_FAILURE;
+    }
+    if (node_rank == 0 && node_size % int(cpulists.size()) != 0)
+        std::cerr << "numa_tools::pin_to_numa_domain: " << node_size <<
+                     " processes on a node with " << cpulists.size() <<
+                     " NUMA domains, domains will be unevenly loaded" << std::endl;
+    const int domain = node_rank % int(cpulists.size());
+
+    cpu_set_t cpu_mask;
+    CPU_ZERO(&cpu_mask);
+    for (int cpu : parse_cpulist(cpulists[domain]))
+        CPU_SET(cpu, &cpu_mask);
+    if (sched_setaffinity(0, sizeof(cpu_mask), &cpu_mask) != 0)
+    {
+        DEBUG_MSG("numa_tools::pin_to_numa_domain: sched_setaffinity failed\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int numa_tools::report_placement(
+        const MPI_Comm comm)
+{
+    int myrank, nprocs;
+    MPI_Comm_rank(comm, &myrank);
+    MPI_Comm_size(comm, &nprocs);
+
+    /* NUMA domains whose cpus include all of the allowed cpus */
+    cpu_set_t cpu_mask;
+    CPU_ZERO(&cpu_mask);
+    sched_getaffinity(0, sizeof(cpu_mask), &cpu_mask);
+    std::vector<int> allowed;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        if (CPU_ISSET(cpu, &cpu_mask))
+            allowed.push_back(cpu);
+    std::vector<std::string> cpulists = get_domain_cpulists();
+    std::string domains;
+    for (int domain = 0; domain < int(cpulists.size()); domain++)
+    {
+        std::vector<int> domain_cpus = parse_cpulist(cpulists[domain]);
+        bool contained = true;
+        for (int cpu : allowed)
+            if (std::find(domain_cpus.begin(), domain_cpus.end(), cpu) == domain_cpus.end())
+                contained = false;
+        if (contained)
+            domains += std::to_string(domain) + " ";
+    }
+    if (domains.empty())
+        domains = "none ";
+
+    char hostname[64];
+    gethostname(hostname, sizeof(hostname));
+    hostname[sizeof(hostname)-1] = '\0';
+    const int line_size = 256;
+    char line[line_size];
+    snprintf(line, line_size,
+             "rank %d on %s, NUMA domain %s(%d cpus allowed, %d to %d)",
+             myrank, hostname, domains.c_str(), int(allowed.size()),
+             allowed.empty() ? -1 : allowed.front(),
+             allowed.empty() ? -1 : allowed.back());
+    std::vector<char> all_lines;
+    if (myrank == 0)
+        all_lines.resize(line_size*nprocs);
+    MPI_Gather(line, line_size, MPI_CHAR,
+               &all_lines.front(), line_size, MPI_CHAR,
+               0, comm);
+    if (myrank == 0)
+        for (int rank = 0; rank < nprocs; rank++)
+            std::cout << &all_lines[rank*line_size] << std::endl;
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,56 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#ifndef NUMA_TOOLS_HPP
+#define NUMA_TOOLS_HPP
+
+#include <mpi.h>
+#include <string>
+#include <vector>
+#include "base.hpp"
+
+/* NUMA placement of MPI processes, for Linux systems.
+ * NUMA domains are read from /sys/devices/system/node, and the processes of
+ * every compute node are distributed over them in round-robin fashion.
+ * both functions must be called by all processes of `comm`, before any
+ * OpenMP threads are started, so that threads inherit the affinity. */
+namespace numa_tools
+{
+    /* cpu lists of all NUMA domains, as given in the cpulist files */
+    std::vector<std::string> get_domain_cpulists();
+
+    /* bind each process to the cpus of one NUMA domain */
+    int pin_to_numa_domain(
+            const MPI_Comm comm);
+
+    /* rank 0 prints host, NUMA domain and allowed cpus of every process */
+    int report_placement(
+            const MPI_Comm comm);
+}
+
+#endif//NUMA_TOOLS_HPP
+
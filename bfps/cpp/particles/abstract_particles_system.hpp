@@ -2,6 +2,7 @@
 #define ABSTRACT_PARTICLES_SYSTEM_HPP
 
 #include <memory>
+#include <vector>
 
 //- Not generic to enable sampling begin
 #include "field.hpp"
@@ -18,6 +19,10 @@ public:
 
     virtual void redistribute() = 0;
 
+    // Sort the particles by cell after redistribute when more than
+    // in_sorting_threshold of them are out of order (0 to disable)
+    virtual void enable_cell_sorting(const real_number in_sorting_threshold) = 0;
+
     virtual void inc_step_idx() = 0;
 
     virtual void shift_rhs_vectors() = 0;
@@ -38,6 +43,12 @@ public:
 
     virtual int get_step_idx() const = 0;
 
+    // Lengths of the previous steps, most recent first (empty before the
+    // first move). They go in the checkpoints along with the rhs, since the
+    // Adams-Bashforth coefficients depend on them
+    virtual std::vector<real_number> getPreviousDts() const = 0;
+    virtual void setPreviousDts(const std::vector<real_number>& in_previous_dts) = 0;
+
     //- Not generic to enable sampling begin
     virtual void sample_compute_field(const field<float, FFTW, ONE>& sample_field,
                                 real_number sample_rhs[]) = 0;
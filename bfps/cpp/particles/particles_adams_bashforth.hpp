@@ -2,6 +2,7 @@
 #define PARTICLES_ADAMS_BASHFORTH_HPP
 
 #include <stdexcept>
+#include <cmath>
 #include <omp.h>
 
 #include "scope_timer.hpp"
@@ -131,6 +132,75 @@ public:
             }
         }
     }
+
+    // Variable step version: dts[0] is the current step, dts[idx] (idx > 0)
+    // the step between the positions at which rhs[idx] and rhs[idx-1] were
+    // computed.
+    // The coefficients are the integrals over the current step of the
+    // Lagrange polynomials through the previous times.
+    void move_particles(real_number*__restrict__ particles_positions,
+                        const partsize_t nb_particles,
+                        const std::unique_ptr<real_number[]> particles_rhs[],
+                        const int nb_rhs, const real_number dts[]) const{
+        if(Max_steps < nb_rhs){
+            throw std::runtime_error("Error, in bfps particles_adams_bashforth.\n"
+                                     "Step in particles_adams_bashforth is too large,"
+                                     "you must add formulation up this number or limit the number of steps.");
+        }
+
+        bool constant_dt = true;
+        for(int idx_rhs = 1 ; idx_rhs < nb_rhs ; ++idx_rhs){
+            constant_dt &= (dts[idx_rhs] == dts[0]);
+        }
+        if(constant_dt){
+            move_particles(particles_positions, nb_particles, particles_rhs, nb_rhs, dts[0]);
+            return;
+        }
+
+        TIMEZONE("particles_adams_bashforth::move_particles_variable_dt");
+        // times of the rhs relative to the current time
+        double times[Max_steps];
+        times[0] = 0;
+        for(int idx_rhs = 1 ; idx_rhs < nb_rhs ; ++idx_rhs){
+            times[idx_rhs] = times[idx_rhs-1] - dts[idx_rhs];
+        }
+        // 3 points Gauss-Legendre quadrature, exact up to degree 5 = Max_steps-1
+        const double gauss_nodes[3] = {0.5*(1-sqrt(0.6)), 0.5, 0.5*(1+sqrt(0.6))};
+        const double gauss_weights[3] = {5./18, 8./18, 5./18};
+        real_number coefficients[Max_steps];
+        for(int idx_rhs = 0 ; idx_rhs < nb_rhs ; ++idx_rhs){
+            double integral = 0;
+            for(int idx_node = 0 ; idx_node < 3 ; ++idx_node){
+                const double tt = gauss_nodes[idx_node]*dts[0];
+                double lagrange = 1;
+                for(int idx_other = 0 ; idx_other < nb_rhs ; ++idx_other){
+                    if(idx_other != idx_rhs){
+                        lagrange *= (tt - times[idx_other])/(times[idx_rhs] - times[idx_other]);
+                    }
+                }
+                integral += gauss_weights[idx_node]*lagrange;
+            }
+            coefficients[idx_rhs] = real_number(integral*dts[0]);
+        }
+
+#pragma omp parallel default(shared)
+        {
+            particles_utils::IntervalSplitter<partsize_t> interval(nb_particles,
+                                                            omp_get_num_threads(),
+                                                            omp_get_thread_num());
+
+            const partsize_t value_start = interval.getMyOffset()*size_particle_positions;
+            const partsize_t value_end = (interval.getMyOffset()+interval.getMySize())*size_particle_positions;
+
+            for(int idx_rhs = 0 ; idx_rhs < nb_rhs ; ++idx_rhs){
+                const real_number* __restrict__ rhs = particles_rhs[idx_rhs].get();
+                const real_number coefficient = coefficients[idx_rhs];
+                for(partsize_t idx_value = value_start ; idx_value < value_end ; ++idx_value){
+                    particles_positions[idx_value] += coefficient * rhs[idx_value];
+                }
+            }
+        }
+    }
 };
 
 
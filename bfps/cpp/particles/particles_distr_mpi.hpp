@@ -3,15 +3,20 @@
 
 #include <mpi.h>
 
+#include <array>
+#include <map>
+#include <tuple>
 #include <vector>
 #include <memory>
 #include <cassert>
+#include <algorithm>
 
 #include <type_traits>
 #include <omp.h>
 
 #include "scope_timer.hpp"
 #include "particles_utils.hpp"
+#include "env_utils.hpp"
 
 
 template <class partsize_t, class real_number>
@@ -40,6 +45,19 @@ protected:
 
         TAG_UP_LOW_MOVED_PARTICLES_RHS = TAG_LOW_UP_MOVED_PARTICLES_RHS_MAX,
         TAG_UP_LOW_MOVED_PARTICLES_RHS_MAX = TAG_UP_LOW_MOVED_PARTICLES_RHS+MaxNbRhs,
+
+        TAG_GHOST_PLANES = TAG_UP_LOW_MOVED_PARTICLES_RHS_MAX,
+    };
+
+    // How compute_distr deals with the stencils that cross the partitions:
+    // either the particles are sent to the neighbors, which compute partial
+    // results and send them back, or the neighbors send the field planes
+    // needed by the stencils (the ghost planes) and all the particles are
+    // computed locally
+    enum GhostPlanesMode{
+        GHOST_PLANES_AUTO,
+        GHOST_PLANES_ALWAYS,
+        GHOST_PLANES_NEVER
     };
 
     struct NeighborDescriptor{
@@ -89,6 +107,13 @@ protected:
     std::vector<MPI_Request> mpiRequests;
     std::vector<NeighborDescriptor> neigDescriptors;
 
+    GhostPlanesMode ghost_planes_mode;
+
+    // The choices of use_ghost_planes, which only depend on the particles per
+    // partition and so hold until the next redistribute.
+    // Key: interpolation size, size of the rhs, size of the field values
+    std::map<std::tuple<int,int,int>, bool> ghost_planes_choices;
+
 public:
     ////////////////////////////////////////////////////////////////////////////
 
@@ -99,7 +124,8 @@ public:
             my_rank(-1), nb_processes(-1),nb_processes_involved(-1),
             current_partition_interval(in_current_partitions),
             current_partition_size(current_partition_interval.second-current_partition_interval.first),
-            field_grid_dim(in_field_grid_dim){
+            field_grid_dim(in_field_grid_dim),
+            ghost_planes_mode(GHOST_PLANES_AUTO){
 
         AssertMpi(MPI_Comm_rank(current_com, &my_rank));
         AssertMpi(MPI_Comm_size(current_com, &nb_processes));
@@ -128,6 +154,10 @@ public:
         }
 
         assert(int(field_grid_dim[IDX_Z]) == partition_interval_offset_per_proc[nb_processes_involved]);
+
+        // BFPS_PARTICLES_GHOST_PLANES=TRUE/FALSE forces the choice made in compute_distr
+        const char* const ghostPlanesValues[] = {"AUTO", "TRUE", "FALSE"};
+        ghost_planes_mode = GhostPlanesMode(env_utils::GetStrInArray("BFPS_PARTICLES_GHOST_PLANES", ghostPlanesValues, 3, 0));
     }
 
     virtual ~particles_distr_mpi(){}
@@ -143,6 +173,12 @@ public:
                        const int interpolation_size){
         TIMEZONE("compute_distr");
 
+        if(use_ghost_planes<field_class, size_particle_positions, size_particle_rhs>(in_field, current_my_nb_particles_per_partition, interpolation_size)){
+            compute_with_ghost_planes<computer_class, field_class, size_particle_positions, size_particle_rhs>(
+                        in_computer, in_field, current_my_nb_particles_per_partition, particles_positions, particles_current_rhs, interpolation_size);
+            return;
+        }
+
         // Some processes might not be involved
         if(nb_processes_involved <= my_rank){
             return;
@@ -212,8 +248,18 @@ public:
                 const int destProc = nextDestProc;
                 const int upperRankDiff = (nextDestProc > my_rank ? nextDestProc - my_rank: nb_processes_involved-my_rank+nextDestProc);
 
-                const int nbPartitionsToSend = std::min(current_partition_size, (interpolation_size+1)-(idxUpper-1));
+                int nbPartitionsToSend = std::min(current_partition_size, (interpolation_size+1)-(idxUpper-1));
                 assert(nbPartitionsToSend > 0);
+                // With few planes per process the stencils wrap around, and the
+                // upper neighbor can also be a lower neighbor. It computes all the
+                // planes it owns for each particle it receives, so the partitions
+                // already sent to it as a lower neighbor are not sent again.
+                for(int idxDescr = 0 ; idxDescr < nbProcToRecvLower ; ++idxDescr){
+                    if(neigDescriptors[idxDescr].destProc == destProc){
+                        nbPartitionsToSend = std::min(nbPartitionsToSend, current_partition_size-neigDescriptors[idxDescr].nbPartitionsToSend);
+                    }
+                }
+                assert(nbPartitionsToSend >= 0);
                 const partsize_t nbParticlesToSend = current_offset_particles_for_partition[current_partition_size] - current_offset_particles_for_partition[current_partition_size-nbPartitionsToSend];
 
                 const int nbPartitionsToRecv = std::min(partition_interval_size_per_proc[destProc], interpolation_size-(idxUpper-1));
@@ -273,7 +319,8 @@ public:
                           current_com, &mpiRequests.back()));
             }
             else{
-                assert(descriptor.nbPartitionsToSend);
+                // The number of particles is sent even if it is zero, the lower
+                // neighbor always waits for it
                 whatNext.emplace_back(std::pair<Action,int>{NOTHING_TODO, -1});
                 mpiRequests.emplace_back();
                 AssertMpi(MPI_Isend(const_cast<partsize_t*>(&descriptor.nbParticlesToSend), 1, particles_utils::GetMpiType(partsize_t()),
@@ -501,6 +548,185 @@ public:
     }
 
 
+    ////////////////////////////////////////////////////////////////////////////
+
+    // The global z planes used by the stencils of the particles of a process that are not in its partition
+    std::vector<int> get_ghost_planes(const int idxProc, const int interpolation_size) const {
+        const int nz = int(field_grid_dim[IDX_Z]);
+        const int first_z = partition_interval_offset_per_proc[idxProc];
+        const int last_z = partition_interval_offset_per_proc[idxProc+1];
+        std::vector<int> ghost_planes;
+        for(int idx_z = first_z-interpolation_size ; idx_z < last_z+interpolation_size+1 ; ++idx_z){
+            const int idx_z_pbc = ((idx_z%nz)+nz)%nz;
+            if(idx_z_pbc < first_z || last_z <= idx_z_pbc){
+                ghost_planes.push_back(idx_z_pbc);
+            }
+        }
+        std::sort(ghost_planes.begin(), ghost_planes.end());
+        ghost_planes.erase(std::unique(ghost_planes.begin(), ghost_planes.end()), ghost_planes.end());
+        return ghost_planes;
+    }
+
+    int get_plane_owner(const int idx_z_pbc) const {
+        const int* owner_offset = std::upper_bound(partition_interval_offset_per_proc.get(),
+                                                   partition_interval_offset_per_proc.get()+nb_processes_involved+1,
+                                                   idx_z_pbc);
+        return int(owner_offset-partition_interval_offset_per_proc.get())-1;
+    }
+
+    // Choose between sending the particles of the border partitions to the
+    // neighbors (and receiving their results) or receiving the ghost planes,
+    // by comparing the total volumes of the two exchanges. All the processes
+    // must call it since the choice has to be the same everywhere.
+    // The choice is made on the first call after each redistribute, the
+    // following calls reuse it.
+    template <class field_class, int size_particle_positions, int size_particle_rhs>
+    bool use_ghost_planes(field_class& in_field,
+                          const partsize_t current_my_nb_particles_per_partition[],
+                          const int interpolation_size) {
+        if(ghost_planes_mode != GHOST_PLANES_AUTO){
+            return ghost_planes_mode == GHOST_PLANES_ALWAYS;
+        }
+        if(nb_processes_involved == 1){
+            return false;
+        }
+
+        using field_rnumber = typename std::decay<decltype(in_field.rval(0,0))>::type;
+
+        const std::tuple<int,int,int> choice_key(interpolation_size, size_particle_rhs, int(sizeof(field_rnumber)));
+        const auto found_choice = ghost_planes_choices.find(choice_key);
+        if(found_choice != ghost_planes_choices.end()){
+            return found_choice->second;
+        }
+
+        double volumes[2] = {0, 0};
+        if(my_rank < nb_processes_involved){
+            const int nbLowerPartitions = std::min(current_partition_size, interpolation_size);
+            const int nbUpperPartitions = std::min(current_partition_size, interpolation_size+1);
+            partsize_t nbParticlesToSend = 0;
+            for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
+                if(idxPartition < nbLowerPartitions || current_partition_size-nbUpperPartitions <= idxPartition){
+                    nbParticlesToSend += current_my_nb_particles_per_partition[idxPartition];
+                }
+            }
+            const double plane_size = double(in_field.rmemlayout->subsizes[1])*double(in_field.rmemlayout->subsizes[2])*size_particle_rhs;
+            volumes[0] = double(nbParticlesToSend)*double((size_particle_positions+size_particle_rhs)*sizeof(real_number));
+            volumes[1] = double(get_ghost_planes(my_rank, interpolation_size).size())*plane_size*double(sizeof(field_rnumber));
+        }
+        AssertMpi(MPI_Allreduce(MPI_IN_PLACE, volumes, 2, MPI_DOUBLE, MPI_SUM, current_com));
+        const bool choice = (volumes[1] < volumes[0]);
+        ghost_planes_choices[choice_key] = choice;
+        return choice;
+    }
+
+    template <class computer_class, class field_class, int size_particle_positions, int size_particle_rhs>
+    void compute_with_ghost_planes(computer_class& in_computer,
+                                   field_class& in_field,
+                                   const partsize_t current_my_nb_particles_per_partition[],
+                                   const real_number particles_positions[],
+                                   real_number particles_current_rhs[],
+                                   const int interpolation_size){
+        TIMEZONE("compute_with_ghost_planes");
+
+        // Some processes might not be involved
+        if(nb_processes_involved <= my_rank){
+            return;
+        }
+
+        using field_rnumber = typename std::decay<decltype(in_field.rval(0,0))>::type;
+        assert(&in_field.rval(1,0) - &in_field.rval(0,0) == size_particle_rhs);
+        const ptrdiff_t row_size = ptrdiff_t(in_field.rmemlayout->subsizes[2])*size_particle_rhs;
+        const ptrdiff_t plane_size = ptrdiff_t(in_field.rmemlayout->subsizes[1])*row_size;
+        const int nz = int(field_grid_dim[IDX_Z]);
+
+        // Pointers to the first value of each global z plane available locally
+        std::vector<const field_rnumber*> planes_per_z(nz, nullptr);
+        for(int idx_z = current_partition_interval.first ; idx_z < current_partition_interval.second ; ++idx_z){
+            planes_per_z[idx_z] = &in_field.rval(in_field.get_rindex_from_global(0, 0, idx_z), 0);
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        /// Exchange the ghost planes, with one message per pair of processes
+        //////////////////////////////////////////////////////////////////////
+        const std::vector<int> my_ghost_planes = get_ghost_planes(my_rank, interpolation_size);
+        std::vector<std::unique_ptr<field_rnumber[]>> buffers;
+
+        {
+            TIMEZONE("exchange_ghost_planes");
+            assert(mpiRequests.size() == 0);
+
+            for(int idx_ghost = 0 ; idx_ghost < int(my_ghost_planes.size()) ; ){
+                const int srcProc = get_plane_owner(my_ghost_planes[idx_ghost]);
+                int nbPlanesFromProc = 0;
+                while(idx_ghost+nbPlanesFromProc < int(my_ghost_planes.size())
+                      && get_plane_owner(my_ghost_planes[idx_ghost+nbPlanesFromProc]) == srcProc){
+                    nbPlanesFromProc += 1;
+                }
+                assert(srcProc != my_rank);
+
+                buffers.emplace_back(new field_rnumber[nbPlanesFromProc*plane_size]);
+                for(int idx_plane = 0 ; idx_plane < nbPlanesFromProc ; ++idx_plane){
+                    planes_per_z[my_ghost_planes[idx_ghost+idx_plane]] = &buffers.back()[idx_plane*plane_size];
+                }
+                mpiRequests.emplace_back();
+                assert(nbPlanesFromProc*plane_size < std::numeric_limits<int>::max());
+                AssertMpi(MPI_Irecv(buffers.back().get(), int(nbPlanesFromProc*plane_size), particles_utils::GetMpiType(field_rnumber()),
+                                    srcProc, TAG_GHOST_PLANES, current_com, &mpiRequests.back()));
+                idx_ghost += nbPlanesFromProc;
+            }
+
+            for(int destProc = 0 ; destProc < nb_processes_involved ; ++destProc){
+                if(destProc == my_rank){
+                    continue;
+                }
+                std::vector<int> planes_to_send;
+                for(const int idx_z : get_ghost_planes(destProc, interpolation_size)){
+                    if(current_partition_interval.first <= idx_z && idx_z < current_partition_interval.second){
+                        planes_to_send.push_back(idx_z);
+                    }
+                }
+                if(planes_to_send.size()){
+                    buffers.emplace_back(new field_rnumber[planes_to_send.size()*plane_size]);
+                    for(int idx_plane = 0 ; idx_plane < int(planes_to_send.size()) ; ++idx_plane){
+                        std::copy(planes_per_z[planes_to_send[idx_plane]], planes_per_z[planes_to_send[idx_plane]]+plane_size,
+                                  &buffers.back()[idx_plane*plane_size]);
+                    }
+                    mpiRequests.emplace_back();
+                    assert(planes_to_send.size()*plane_size < std::numeric_limits<int>::max());
+                    AssertMpi(MPI_Isend(buffers.back().get(), int(planes_to_send.size()*plane_size), particles_utils::GetMpiType(field_rnumber()),
+                                        destProc, TAG_GHOST_PLANES, current_com, &mpiRequests.back()));
+                }
+            }
+
+            AssertMpi(MPI_Waitall(int(mpiRequests.size()), mpiRequests.data(), MPI_STATUSES_IGNORE));
+            mpiRequests.clear();
+        }
+
+        //////////////////////////////////////////////////////////////////////
+        /// Compute all my particles
+        //////////////////////////////////////////////////////////////////////
+        std::vector<const field_rnumber*> planes(current_partition_size+2*interpolation_size+1);
+        for(int idx_plane = 0 ; idx_plane < int(planes.size()) ; ++idx_plane){
+            const int idx_z = current_partition_interval.first-interpolation_size+idx_plane;
+            planes[idx_plane] = planes_per_z[((idx_z%nz)+nz)%nz];
+            assert(planes[idx_plane] != nullptr);
+        }
+
+        partsize_t myTotalNbParticles = 0;
+        for(int idxPartition = 0 ; idxPartition < current_partition_size ; ++idxPartition){
+            myTotalNbParticles += current_my_nb_particles_per_partition[idxPartition];
+        }
+
+        #pragma omp parallel for schedule(dynamic)
+        for(partsize_t idxPart = 0 ; idxPart < myTotalNbParticles ; idxPart += 300){
+            const partsize_t sizeToDo = std::min(partsize_t(300), myTotalNbParticles-idxPart);
+            in_computer.template apply_computation_with_ghosts<field_rnumber, size_particle_rhs>(planes.data(), row_size,
+                                                                                              &particles_positions[idxPart*size_particle_positions],
+                                                                                              &particles_current_rhs[idxPart*size_particle_rhs],
+                                                                                              sizeToDo);
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////
 
     template <class computer_class, int size_particle_positions, int size_particle_rhs, int size_particle_index>
@@ -512,6 +738,9 @@ public:
                       std::unique_ptr<partsize_t[]>* inout_index_particles){
         TIMEZONE("redistribute");
 
+        // The particles per partition change, so the exchanges have to be chosen again
+        ghost_planes_choices.clear();
+
         // Some latest processes might not be involved
         if(nb_processes_involved <= my_rank){
             return;
@@ -3,6 +3,7 @@
 
 #include <array>
 #include <utility>
+#include <algorithm>
 
 #include "scope_timer.hpp"
 #include "particles_utils.hpp"
@@ -69,31 +70,13 @@ public:
                                    const partsize_t nb_particles) const {
         TIMEZONE("particles_field_computer::apply_computation");
         //DEBUG_MSG("just entered particles_field_computer::apply_computation\n");
-        for(partsize_t idxPart = 0 ; idxPart < nb_particles ; ++idxPart){
-            const real_number reltv_x = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_X], IDX_X);
-            const real_number reltv_y = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_Y], IDX_Y);
-            const real_number reltv_z = get_norm_pos_in_cell(particles_positions[idxPart*3+IDX_Z], IDX_Z);
-
-            typename interpolator_class::real_number
-                bx[interp_neighbours*2+2],
-                by[interp_neighbours*2+2],
-                bz[interp_neighbours*2+2];
-            interpolator.compute_beta(deriv[IDX_X], reltv_x, bx);
-            interpolator.compute_beta(deriv[IDX_Y], reltv_y, by);
-            interpolator.compute_beta(deriv[IDX_Z], reltv_z, bz);
-
-            const int partGridIdx_x = pbc_field_layer(particles_positions[idxPart*3+IDX_X], IDX_X);
-            const int partGridIdx_y = pbc_field_layer(particles_positions[idxPart*3+IDX_Y], IDX_Y);
-            const int partGridIdx_z = pbc_field_layer(particles_positions[idxPart*3+IDX_Z], IDX_Z);
-
-            assert(0 <= partGridIdx_x && partGridIdx_x < int(field_grid_dim[IDX_X]));
-            assert(0 <= partGridIdx_y && partGridIdx_y < int(field_grid_dim[IDX_Y]));
-            assert(0 <= partGridIdx_z && partGridIdx_z < int(field_grid_dim[IDX_Z]));
-
-            const int interp_limit_mx = partGridIdx_x-interp_neighbours;
-            const int interp_limit_x = partGridIdx_x+interp_neighbours+1;
-            const int interp_limit_my = partGridIdx_y-interp_neighbours;
-            const int interp_limit_y = partGridIdx_y+interp_neighbours+1;
+        // The stencil of a particle uses the x points stencil_x[0..nb_stencil-1] of each row,
+        // these are contiguous in memory (as are their components) unless the stencil wraps around
+        assert(&field.rval(1,0) - &field.rval(0,0) == size_particle_rhs);
+
+        // Only the z planes of the current partition are used, the other planes
+        // of the stencil are computed by the processes that own them
+        const auto local_z_planes = [&](const int partGridIdx_z, int z_planes[], int z_stencils[]) -> int {
             const int interp_limit_mz_bz = partGridIdx_z-interp_neighbours;
 
             int interp_limit_mz[2];
@@ -125,37 +108,156 @@ public:
                 nb_z_intervals = 1;
             }
 
+            int nb_z_planes = 0;
             for(int idx_inter = 0 ; idx_inter < nb_z_intervals ; ++idx_inter){
                 for(int idx_z = interp_limit_mz[idx_inter] ; idx_z <= interp_limit_z[idx_inter] ; ++idx_z ){
                     const int idx_z_pbc = (idx_z + field_grid_dim[IDX_Z])%field_grid_dim[IDX_Z];
                     assert(current_partition_interval.first <= idx_z_pbc && idx_z_pbc < current_partition_interval.second);
                     assert(((idx_z+field_grid_dim[IDX_Z]-interp_limit_mz_bz)%field_grid_dim[IDX_Z]) < interp_neighbours*2+2);
+                    assert(nb_z_planes < interp_neighbours*2+2);
+                    z_planes[nb_z_planes] = idx_z_pbc;
+                    z_stencils[nb_z_planes] = ((idx_z+field_grid_dim[IDX_Z]-interp_limit_mz_bz)%field_grid_dim[IDX_Z]);
+                    nb_z_planes += 1;
+                }
+            }
+            return nb_z_planes;
+        };
+
+        const auto field_row = [&](const int idx_y, const int idx_z_pbc) {
+            // getValue does not necessary return real_number
+            return &field.rval(field.get_rindex_from_global(0, idx_y, idx_z_pbc), 0);
+        };
+
+        apply_stencils<size_particle_rhs>(particles_positions, particles_current_rhs, nb_particles,
+                                          local_z_planes, field_row);
+    }
+
+    // Same as apply_computation, except that the field is given as z planes
+    // that cover the complete stencils of the particles of the current partition
+    // (planes[idx] is the global plane current_partition_interval.first-interp_neighbours+idx
+    // and row_size is the number of values of one of its y rows), so that
+    // each particle is computed entirely by the current process
+    template <class field_rnumber, int size_particle_rhs>
+    void apply_computation_with_ghosts(const field_rnumber* const planes[],
+                                       const ptrdiff_t row_size,
+                                       const real_number particles_positions[],
+                                       real_number particles_current_rhs[],
+                                       const partsize_t nb_particles) const {
+        TIMEZONE("particles_field_computer::apply_computation_with_ghosts");
+
+        const auto ghost_z_planes = [&](const int partGridIdx_z, int z_planes[], int z_stencils[]) -> int {
+            assert(current_partition_interval.first <= partGridIdx_z && partGridIdx_z < current_partition_interval.second);
+            for(int idx_stencil = 0 ; idx_stencil < interp_neighbours*2+2 ; ++idx_stencil){
+                z_planes[idx_stencil] = partGridIdx_z - current_partition_interval.first + idx_stencil;
+                z_stencils[idx_stencil] = idx_stencil;
+            }
+            return interp_neighbours*2+2;
+        };
 
-                    for(int idx_x = interp_limit_mx ; idx_x <= interp_limit_x ; ++idx_x ){
-                        const int idx_x_pbc = (idx_x + field_grid_dim[IDX_X])%field_grid_dim[IDX_X];
-                        assert(idx_x-interp_limit_mx < interp_neighbours*2+2);
+        const auto ghost_row = [&](const int idx_y, const int idx_plane) {
+            return planes[idx_plane] + idx_y*row_size;
+        };
 
-                        for(int idx_y = interp_limit_my ; idx_y <= interp_limit_y ; ++idx_y ){
-                            const int idx_y_pbc = (idx_y + field_grid_dim[IDX_Y])%field_grid_dim[IDX_Y];
-                            assert(idx_y-interp_limit_my < interp_neighbours*2+2);
+        apply_stencils<size_particle_rhs>(particles_positions, particles_current_rhs, nb_particles,
+                                          ghost_z_planes, ghost_row);
+    }
 
-                            const real_number coef = (bz[((idx_z+field_grid_dim[IDX_Z]-interp_limit_mz_bz)%field_grid_dim[IDX_Z])]
-                                                    * by[idx_y-interp_limit_my]
-                                                    * bx[idx_x-interp_limit_mx]);
+private:
+    // Interpolation of the particles, the z planes of the stencil of a particle
+    // are given by get_z_planes (with their index in the z stencil) and
+    // get_row(idx_y, z_plane) returns the first value of a y row of one of these planes
+    template <int size_particle_rhs, class z_planes_functor, class row_functor>
+    void apply_stencils(const real_number particles_positions[],
+                        real_number particles_current_rhs[],
+                        const partsize_t nb_particles,
+                        const z_planes_functor& get_z_planes,
+                        const row_functor& get_row) const {
+        constexpr int nb_stencil = interp_neighbours*2+2;
+        // The particles are processed by blocks: first the coefficients and the
+        // periodic x/y indexes of the stencils of the whole block are computed,
+        // so that no modulo is left in the stencil loops, then the stencils are
+        // applied one particle after the other
+        constexpr partsize_t block_size = 16;
+
+        typename interpolator_class::real_number
+            bx[block_size][nb_stencil],
+            by[block_size][nb_stencil],
+            bz[block_size][nb_stencil];
+        int stencil_x[block_size][nb_stencil];
+        int stencil_y[block_size][nb_stencil];
+        int grid_z[block_size];
+
+        for(partsize_t idxBlock = 0 ; idxBlock < nb_particles ; idxBlock += block_size){
+            const partsize_t nb_in_block = std::min(block_size, nb_particles-idxBlock);
+
+            for(partsize_t idxInBlock = 0 ; idxInBlock < nb_in_block ; ++idxInBlock){
+                const real_number* part_pos = &particles_positions[(idxBlock+idxInBlock)*3];
+                interpolator.compute_beta(deriv[IDX_X], get_norm_pos_in_cell(part_pos[IDX_X], IDX_X), bx[idxInBlock]);
+                interpolator.compute_beta(deriv[IDX_Y], get_norm_pos_in_cell(part_pos[IDX_Y], IDX_Y), by[idxInBlock]);
+                interpolator.compute_beta(deriv[IDX_Z], get_norm_pos_in_cell(part_pos[IDX_Z], IDX_Z), bz[idxInBlock]);
+
+                const int partGridIdx_x = pbc_field_layer(part_pos[IDX_X], IDX_X);
+                const int partGridIdx_y = pbc_field_layer(part_pos[IDX_Y], IDX_Y);
+                grid_z[idxInBlock] = pbc_field_layer(part_pos[IDX_Z], IDX_Z);
+
+                assert(0 <= partGridIdx_x && partGridIdx_x < int(field_grid_dim[IDX_X]));
+                assert(0 <= partGridIdx_y && partGridIdx_y < int(field_grid_dim[IDX_Y]));
+                assert(0 <= grid_z[idxInBlock] && grid_z[idxInBlock] < int(field_grid_dim[IDX_Z]));
+
+                for(int idx_stencil = 0 ; idx_stencil < nb_stencil ; ++idx_stencil){
+                    stencil_x[idxInBlock][idx_stencil] = (partGridIdx_x-interp_neighbours+idx_stencil+field_grid_dim[IDX_X])%field_grid_dim[IDX_X];
+                    stencil_y[idxInBlock][idx_stencil] = (partGridIdx_y-interp_neighbours+idx_stencil+field_grid_dim[IDX_Y])%field_grid_dim[IDX_Y];
+                }
+            }
 
-                            const ptrdiff_t tindex = field.get_rindex_from_global(idx_x_pbc, idx_y_pbc, idx_z_pbc);
+            for(partsize_t idxInBlock = 0 ; idxInBlock < nb_in_block ; ++idxInBlock){
+                const partsize_t idxPart = idxBlock + idxInBlock;
 
-                            // getValue does not necessary return real_number
-                            for(int idx_rhs_val = 0 ; idx_rhs_val < size_particle_rhs ; ++idx_rhs_val){
-                                particles_current_rhs[idxPart*size_particle_rhs+idx_rhs_val] += real_number(field.rval(tindex,idx_rhs_val))*coef;
+                int z_planes[nb_stencil];
+                int z_stencils[nb_stencil];
+                const int nb_z_planes = get_z_planes(grid_z[idxInBlock], z_planes, z_stencils);
+
+                const int* part_stencil_x = stencil_x[idxInBlock];
+                const bool x_is_contiguous = (part_stencil_x[nb_stencil-1] == part_stencil_x[0]+nb_stencil-1);
+
+                // Sum of the y/z weighted values for each x point of the stencil and each component
+                real_number sum_yz[nb_stencil*size_particle_rhs];
+                std::fill_n(sum_yz, nb_stencil*size_particle_rhs, real_number(0));
+
+                for(int idx_plane = 0 ; idx_plane < nb_z_planes ; ++idx_plane){
+                    const real_number coef_z = bz[idxInBlock][z_stencils[idx_plane]];
+
+                    for(int idx_y = 0 ; idx_y < nb_stencil ; ++idx_y ){
+                        const real_number coef_yz = coef_z * by[idxInBlock][idx_y];
+                        const auto* row_values = get_row(stencil_y[idxInBlock][idx_y], z_planes[idx_plane]);
+
+                        if(x_is_contiguous){
+                            const auto* stencil_values = &row_values[part_stencil_x[0]*size_particle_rhs];
+                            #pragma omp simd
+                            for(int idx_val = 0 ; idx_val < nb_stencil*size_particle_rhs ; ++idx_val){
+                                sum_yz[idx_val] += real_number(stencil_values[idx_val])*coef_yz;
+                            }
+                        }
+                        else{
+                            for(int idx_x = 0 ; idx_x < nb_stencil ; ++idx_x ){
+                                for(int idx_rhs_val = 0 ; idx_rhs_val < size_particle_rhs ; ++idx_rhs_val){
+                                    sum_yz[idx_x*size_particle_rhs+idx_rhs_val] += real_number(row_values[part_stencil_x[idx_x]*size_particle_rhs+idx_rhs_val])*coef_yz;
+                                }
                             }
                         }
                     }
                 }
+
+                for(int idx_x = 0 ; idx_x < nb_stencil ; ++idx_x ){
+                    for(int idx_rhs_val = 0 ; idx_rhs_val < size_particle_rhs ; ++idx_rhs_val){
+                        particles_current_rhs[idxPart*size_particle_rhs+idx_rhs_val] += sum_yz[idx_x*size_particle_rhs+idx_rhs_val]*bx[idxInBlock][idx_x];
+                    }
+                }
             }
         }
     }
 
+public:
     template <int size_particle_rhs>
     void reduce_particles_rhs(real_number particles_current_rhs[],
                                   const real_number extra_particles_current_rhs[],
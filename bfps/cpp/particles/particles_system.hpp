@@ -2,6 +2,9 @@
 #define PARTICLES_SYSTEM_HPP
 
 #include <array>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
 
 #include "abstract_particles_system.hpp"
 #include "particles_distr_mpi.hpp"
@@ -47,6 +50,92 @@ class particles_system : public abstract_particles_system<partsize_t, real_numbe
 
     int step_idx;
 
+    // dt of the current and previous steps, for the Adams-Bashforth formulas
+    std::vector<real_number> my_previous_dts;
+
+    // The particles of each z partition are sorted by cell (in Morton order of x/y)
+    // when more than this fraction of them is out of order, 0 to never sort them
+    real_number sorting_threshold;
+    // (cell key, current position) of each particle, kept between the sorts
+    std::vector<std::pair<uint64_t,partsize_t>> sorting_keys;
+
+    // Interleave the bits of the x and y cell indexes
+    static uint64_t morton_key(const uint32_t idx_x, const uint32_t idx_y){
+        uint64_t key = 0;
+        for(int idx_bit = 0 ; idx_bit < 32 ; ++idx_bit){
+            key |= (uint64_t((idx_x >> idx_bit) & 1U) << (2*idx_bit))
+                 | (uint64_t((idx_y >> idx_bit) & 1U) << (2*idx_bit+1));
+        }
+        return key;
+    }
+
+    uint64_t cell_key(const partsize_t idx_part) const {
+        return morton_key(uint32_t(computer.pbc_field_layer(my_particles_positions[idx_part*3+IDX_X], IDX_X)),
+                          uint32_t(computer.pbc_field_layer(my_particles_positions[idx_part*3+IDX_Y], IDX_Y)));
+    }
+
+    void sort_particles_by_cell(){
+        TIMEZONE("particles_system::sort_particles_by_cell");
+        // Only the keys of consecutive particles are compared to decide whether to sort
+        partsize_t nb_unsorted = 0;
+        {
+            partsize_t idx_part = 0;
+            for(int idxPartition = 0 ; idxPartition < partition_interval_size ; ++idxPartition){
+                uint64_t previous_key = 0;
+                for(partsize_t idx_in_partition = 0 ; idx_in_partition < current_my_nb_particles_per_partition[idxPartition] ; ++idx_in_partition){
+                    const uint64_t key = cell_key(idx_part);
+                    if(idx_in_partition != 0 && key < previous_key){
+                        nb_unsorted += 1;
+                    }
+                    previous_key = key;
+                    idx_part += 1;
+                }
+            }
+            assert(idx_part == my_nb_particles);
+        }
+
+        if(nb_unsorted <= sorting_threshold*real_number(my_nb_particles)){
+            return;
+        }
+
+        sorting_keys.resize(my_nb_particles);
+        for(partsize_t idx_part = 0 ; idx_part < my_nb_particles ; ++idx_part){
+            sorting_keys[idx_part].first = cell_key(idx_part);
+            sorting_keys[idx_part].second = idx_part;
+        }
+        {
+            partsize_t offset_partition = 0;
+            for(int idxPartition = 0 ; idxPartition < partition_interval_size ; ++idxPartition){
+                std::sort(sorting_keys.begin() + offset_partition,
+                          sorting_keys.begin() + offset_partition + current_my_nb_particles_per_partition[idxPartition]);
+                offset_partition += current_my_nb_particles_per_partition[idxPartition];
+            }
+        }
+
+        std::unique_ptr<real_number[]> sorted_positions(new real_number[my_nb_particles*3]);
+        std::unique_ptr<partsize_t[]> sorted_indexes(new partsize_t[my_nb_particles]);
+        for(partsize_t idx_part = 0 ; idx_part < my_nb_particles ; ++idx_part){
+            const partsize_t idx_src = sorting_keys[idx_part].second;
+            for(int idx_pos = 0 ; idx_pos < 3 ; ++idx_pos){
+                sorted_positions[idx_part*3+idx_pos] = my_particles_positions[idx_src*3+idx_pos];
+            }
+            sorted_indexes[idx_part] = my_particles_positions_indexes[idx_src];
+        }
+        my_particles_positions = std::move(sorted_positions);
+        my_particles_positions_indexes = std::move(sorted_indexes);
+
+        for(int idx_rhs = 0 ; idx_rhs < int(my_particles_rhs.size()) ; ++idx_rhs){
+            std::unique_ptr<real_number[]> sorted_rhs(new real_number[my_nb_particles*size_particle_rhs]);
+            for(partsize_t idx_part = 0 ; idx_part < my_nb_particles ; ++idx_part){
+                const partsize_t idx_src = sorting_keys[idx_part].second;
+                for(int idx_val = 0 ; idx_val < size_particle_rhs ; ++idx_val){
+                    sorted_rhs[idx_part*size_particle_rhs+idx_val] = my_particles_rhs[idx_rhs][idx_src*size_particle_rhs+idx_val];
+                }
+            }
+            my_particles_rhs[idx_rhs] = std::move(sorted_rhs);
+        }
+    }
+
 public:
     particles_system(const std::array<size_t,3>& field_grid_dim, const std::array<real_number,3>& in_spatial_box_width,
                      const std::array<real_number,3>& in_spatial_box_offset,
@@ -69,7 +158,8 @@ public:
           default_field(in_field),
           spatial_box_width(in_spatial_box_width), spatial_partition_width(in_spatial_partition_width),
           my_spatial_low_limit(in_my_spatial_low_limit), my_spatial_up_limit(in_my_spatial_up_limit),
-          my_nb_particles(0), total_nb_particles(in_total_nb_particles), step_idx(in_current_iteration){
+          my_nb_particles(0), total_nb_particles(in_total_nb_particles), step_idx(in_current_iteration),
+          sorting_threshold(0){
 
         current_my_nb_particles_per_partition.reset(new partsize_t[partition_interval_size]);
         current_offset_particles_for_partition.reset(new partsize_t[partition_interval_size+1]);
@@ -172,9 +262,19 @@ public:
 
     void move(const real_number dt) final {
         TIMEZONE("particles_system::move");
+        if(my_previous_dts.size() == 0){
+            // The steps before the start (or before a restart from a
+            // checkpoint without step lengths) are assumed to be as long as
+            // the first one
+            my_previous_dts.resize(std::max(int(my_particles_rhs.size()), 1), dt);
+        }
+        else{
+            std::rotate(my_previous_dts.rbegin(), my_previous_dts.rbegin() + 1, my_previous_dts.rend());
+            my_previous_dts[0] = dt;
+        }
         positions_updater.move_particles(my_particles_positions.get(), my_nb_particles,
                                 my_particles_rhs.data(), std::min(step_idx,int(my_particles_rhs.size())),
-                                dt);
+                                my_previous_dts.data());
     }
 
     void redistribute() final {
@@ -186,6 +286,13 @@ public:
                               &my_particles_positions,
                               my_particles_rhs.data(), int(my_particles_rhs.size()),
                               &my_particles_positions_indexes);
+        if(sorting_threshold > 0){
+            sort_particles_by_cell();
+        }
+    }
+
+    void enable_cell_sorting(const real_number in_sorting_threshold) final {
+        sorting_threshold = in_sorting_threshold;
     }
 
     void inc_step_idx() final {
@@ -196,6 +303,16 @@ public:
         return step_idx;
     }
 
+    std::vector<real_number> getPreviousDts() const final {
+        return my_previous_dts;
+    }
+
+    void setPreviousDts(const std::vector<real_number>& in_previous_dts) final {
+        assert(in_previous_dts.size() == 0
+               || in_previous_dts.size() == size_t(std::max(int(my_particles_rhs.size()), 1)));
+        my_previous_dts = in_previous_dts;
+    }
+
     void shift_rhs_vectors() final {
         if(my_particles_rhs.size()){
             std::unique_ptr<real_number[]> next_current(std::move(my_particles_rhs.back()));
@@ -0,0 +1,448 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <algorithm>
+#include <cassert>
+#include "base.hpp"
+#include "omputils.hpp"
+#include "pencil_fft.hpp"
+#include "scope_timer.hpp"
+
+/* block distribution of n points over p processes,
+ * the first n%p processes get one extra point */
+static inline void pencil_split(
+        const ptrdiff_t n,
+        const int p,
+        const int i,
+        ptrdiff_t &size,
+        ptrdiff_t &start)
+{
+    size = n/p + ((i < n%p) ? 1 : 0);
+    start = i*(n/p) + std::min(ptrdiff_t(i), n%p);
+}
+
+template <typename rnumber>
+pencil_fft<rnumber>::pencil_fft(
+        const int NX,
+        const int NY,
+        const int NZ,
+        const int howmany,
+        const MPI_Comm COMM_TO_USE,
+        const unsigned FFTW_PLAN_RIGOR)
+{
+    TIMEZONE("pencil_fft::pencil_fft");
+    this->nx = NX;
+    this->ny = NY;
+    this->nz = NZ;
+    this->nxc = NX/2+1;
+    this->ncomp = howmany;
+
+    /* process grid; ranks are not reordered, so that the Cartesian
+     * communicator can be used interchangeably with COMM_TO_USE */
+    int nprocs, myrank;
+    MPI_Comm_size(COMM_TO_USE, &nprocs);
+    this->pgrid[0] = 0;
+    this->pgrid[1] = 0;
+    MPI_Dims_create(nprocs, 2, this->pgrid);
+    int periods[2] = {0, 0};
+    MPI_Cart_create(COMM_TO_USE, 2, this->pgrid, periods, 0, &this->comm);
+    MPI_Comm_rank(this->comm, &myrank);
+    MPI_Cart_coords(this->comm, myrank, 2, this->pcoord);
+    int remain_dims[2];
+    remain_dims[0] = 0;
+    remain_dims[1] = 1;
+    MPI_Cart_sub(this->comm, remain_dims, &this->row_comm);
+    remain_dims[0] = 1;
+    remain_dims[1] = 0;
+    MPI_Cart_sub(this->comm, remain_dims, &this->col_comm);
+    /* every process must hold some data in every stage */
+    assert(this->pgrid[0] <= this->nz && this->pgrid[0] <= this->ny);
+    assert(this->pgrid[1] <= this->ny && this->pgrid[1] <= this->nxc);
+
+    /* distribution of all dimensions */
+    this->z_size.resize(this->pgrid[0]);
+    this->z_start.resize(this->pgrid[0]);
+    this->ky_size.resize(this->pgrid[0]);
+    this->ky_start.resize(this->pgrid[0]);
+    for (int i=0; i<this->pgrid[0]; i++)
+    {
+        pencil_split(this->nz, this->pgrid[0], i, this->z_size[i], this->z_start[i]);
+        pencil_split(this->ny, this->pgrid[0], i, this->ky_size[i], this->ky_start[i]);
+    }
+    this->y_size.resize(this->pgrid[1]);
+    this->y_start.resize(this->pgrid[1]);
+    this->kx_size.resize(this->pgrid[1]);
+    this->kx_start.resize(this->pgrid[1]);
+    for (int i=0; i<this->pgrid[1]; i++)
+    {
+        pencil_split(this->ny, this->pgrid[1], i, this->y_size[i], this->y_start[i]);
+        pencil_split(this->nxc, this->pgrid[1], i, this->kx_size[i], this->kx_start[i]);
+    }
+    this->local_nz = this->z_size[this->pcoord[0]];
+    this->local_z_start = this->z_start[this->pcoord[0]];
+    this->local_nky = this->ky_size[this->pcoord[0]];
+    this->local_ky_start = this->ky_start[this->pcoord[0]];
+    this->local_ny = this->y_size[this->pcoord[1]];
+    this->local_y_start = this->y_start[this->pcoord[1]];
+    this->local_nkx = this->kx_size[this->pcoord[1]];
+    this->local_kx_start = this->kx_start[this->pcoord[1]];
+
+    /* pad x such that the Fourier representation fits in the real array */
+    const ptrdiff_t clocal_size = this->local_nky*this->nz*this->local_nkx;
+    int tmp_rmem_nx = this->nx + 2;
+    while (this->local_nz*this->local_ny*tmp_rmem_nx < 2*clocal_size)
+        tmp_rmem_nx += 2;
+    int rmem_nx_int;
+    MPI_Allreduce(&tmp_rmem_nx, &rmem_nx_int, 1, MPI_INT, MPI_MAX, this->comm);
+    this->rmem_nx = rmem_nx_int;
+
+    /* work buffers */
+    this->buffer_size = std::max(
+            std::max(this->local_nz*this->local_ny*this->nxc,
+                     this->local_nz*this->local_nkx*this->ny),
+            clocal_size)*this->ncomp;
+    this->buffer0 = fftw_interface<rnumber>::alloc_complex(this->buffer_size);
+    this->buffer1 = fftw_interface<rnumber>::alloc_complex(this->buffer_size);
+
+    /* exchange patterns */
+    this->row_send_count.resize(this->pgrid[1]);
+    this->row_send_displ.resize(this->pgrid[1]);
+    this->row_recv_count.resize(this->pgrid[1]);
+    this->row_recv_displ.resize(this->pgrid[1]);
+    for (int q=0; q<this->pgrid[1]; q++)
+    {
+        this->row_send_count[q] = this->local_nz*this->local_ny*this->kx_size[q]*this->ncomp;
+        this->row_recv_count[q] = this->local_nz*this->y_size[q]*this->local_nkx*this->ncomp;
+        this->row_send_displ[q] = (q == 0) ? 0 : this->row_send_displ[q-1] + this->row_send_count[q-1];
+        this->row_recv_displ[q] = (q == 0) ? 0 : this->row_recv_displ[q-1] + this->row_recv_count[q-1];
+    }
+    this->col_send_count.resize(this->pgrid[0]);
+    this->col_send_displ.resize(this->pgrid[0]);
+    this->col_recv_count.resize(this->pgrid[0]);
+    this->col_recv_displ.resize(this->pgrid[0]);
+    for (int r=0; r<this->pgrid[0]; r++)
+    {
+        this->col_send_count[r] = this->local_nz*this->local_nkx*this->ky_size[r]*this->ncomp;
+        this->col_recv_count[r] = this->z_size[r]*this->local_nkx*this->local_nky*this->ncomp;
+        this->col_send_displ[r] = (r == 0) ? 0 : this->col_send_displ[r-1] + this->col_send_count[r-1];
+        this->col_recv_displ[r] = (r == 0) ? 0 : this->col_recv_displ[r-1] + this->col_recv_count[r-1];
+    }
+
+    /* 1D plans, components are always the fastest index.
+     * planning may overwrite arrays, so a temporary array stands in for
+     * field arrays, which have the same alignment */
+    rnumber *rtmp = fftw_interface<rnumber>::alloc_real(this->get_local_alloc_size());
+    complex *ctmp = (complex*)rtmp;
+    typename fftw_interface<rnumber>::iodim dims[1], howmany_dims[2];
+    howmany_dims[1].n = this->ncomp;
+    howmany_dims[1].is = 1;
+    howmany_dims[1].os = 1;
+
+    /* x: (z, y) rows of the real array <-> (z, y, kx) in buffers */
+    dims[0].n = this->nx;
+    dims[0].is = this->ncomp;
+    dims[0].os = this->ncomp;
+    howmany_dims[0].n = this->local_nz*this->local_ny;
+    howmany_dims[0].is = this->rmem_nx*this->ncomp;
+    howmany_dims[0].os = this->nxc*this->ncomp;
+    this->x_r2c = fftw_interface<rnumber>::plan_guru_dft_r2c(
+            1, dims, 2, howmany_dims,
+            rtmp, this->buffer0,
+            FFTW_PLAN_RIGOR);
+    howmany_dims[0].is = this->nxc*this->ncomp;
+    howmany_dims[0].os = this->rmem_nx*this->ncomp;
+    this->x_c2r = fftw_interface<rnumber>::plan_guru_dft_c2r(
+            1, dims, 2, howmany_dims,
+            this->buffer1, rtmp,
+            FFTW_PLAN_RIGOR);
+
+    /* y: in-place on (z, kx, y) in buffers */
+    dims[0].n = this->ny;
+    howmany_dims[0].n = this->local_nz*this->local_nkx;
+    howmany_dims[0].is = this->ny*this->ncomp;
+    howmany_dims[0].os = this->ny*this->ncomp;
+    this->y_forward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            this->buffer1, this->buffer1,
+            FFTW_FORWARD, FFTW_PLAN_RIGOR);
+    this->y_backward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            this->buffer0, this->buffer0,
+            FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+
+    /* z: in-place on (ky, kz, kx) in the field array */
+    dims[0].n = this->nz;
+    dims[0].is = this->local_nkx*this->ncomp;
+    dims[0].os = this->local_nkx*this->ncomp;
+    howmany_dims[0].n = this->local_nky;
+    howmany_dims[0].is = this->nz*this->local_nkx*this->ncomp;
+    howmany_dims[0].os = this->nz*this->local_nkx*this->ncomp;
+    howmany_dims[1].n = this->local_nkx*this->ncomp;
+    this->z_forward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            ctmp, ctmp,
+            FFTW_FORWARD, FFTW_PLAN_RIGOR);
+    this->z_backward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            ctmp, ctmp,
+            FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+    fftw_interface<rnumber>::free(rtmp);
+}
+
+template <typename rnumber>
+pencil_fft<rnumber>::~pencil_fft()
+{
+    fftw_interface<rnumber>::destroy_plan(this->x_r2c);
+    fftw_interface<rnumber>::destroy_plan(this->x_c2r);
+    fftw_interface<rnumber>::destroy_plan(this->y_forward);
+    fftw_interface<rnumber>::destroy_plan(this->y_backward);
+    fftw_interface<rnumber>::destroy_plan(this->z_forward);
+    fftw_interface<rnumber>::destroy_plan(this->z_backward);
+    fftw_interface<rnumber>::free(this->buffer0);
+    fftw_interface<rnumber>::free(this->buffer1);
+    MPI_Comm_free(&this->row_comm);
+    MPI_Comm_free(&this->col_comm);
+    MPI_Comm_free(&this->comm);
+}
+
+/* (z, y, kx) in buffer0 -> (z, kx, y) in buffer1 */
+template <typename rnumber>
+void pencil_fft<rnumber>::transpose_rows_forward()
+{
+    TIMEZONE("pencil_fft::transpose_rows_forward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int q=0; q<this->pgrid[1]; q++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t yy = 0; yy < this->local_ny; yy++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer0) + nc2*(
+                    (zz*this->local_ny + yy)*this->nxc + this->kx_start[q]);
+            std::copy(src, src + nc2*this->kx_size[q],
+                      (rnumber*)(this->buffer1) + 2*this->row_send_displ[q] + nc2*(
+                        (zz*this->local_ny + yy)*this->kx_size[q]));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer1, &this->row_send_count.front(), &this->row_send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer0, &this->row_recv_count.front(), &this->row_recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->row_comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int q=0; q<this->pgrid[1]; q++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t yy = 0; yy < this->y_size[q]; yy++)
+        for (ptrdiff_t xx = 0; xx < this->local_nkx; xx++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer0) + 2*this->row_recv_displ[q] + nc2*(
+                    (zz*this->y_size[q] + yy)*this->local_nkx + xx);
+            std::copy(src, src + nc2,
+                      (rnumber*)(this->buffer1) + nc2*(
+                        (zz*this->local_nkx + xx)*this->ny + this->y_start[q] + yy));
+        }
+    }
+}
+
+/* (z, kx, y) in buffer1 -> (ky, kz, kx) in cdata */
+template <typename rnumber>
+void pencil_fft<rnumber>::transpose_columns_forward(complex *cdata)
+{
+    TIMEZONE("pencil_fft::transpose_columns_forward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int r=0; r<this->pgrid[0]; r++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t xx = 0; xx < this->local_nkx; xx++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer1) + nc2*(
+                    (zz*this->local_nkx + xx)*this->ny + this->ky_start[r]);
+            std::copy(src, src + nc2*this->ky_size[r],
+                      (rnumber*)(this->buffer0) + 2*this->col_send_displ[r] + nc2*(
+                        (zz*this->local_nkx + xx)*this->ky_size[r]));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer0, &this->col_send_count.front(), &this->col_send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer1, &this->col_recv_count.front(), &this->col_recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->col_comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nky);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nky);
+        for (int r=0; r<this->pgrid[0]; r++)
+        for (ptrdiff_t zz = 0; zz < this->z_size[r]; zz++)
+        for (ptrdiff_t xx = 0; xx < this->local_nkx; xx++)
+        for (ptrdiff_t yy = start; yy < end; yy++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer1) + 2*this->col_recv_displ[r] + nc2*(
+                    (zz*this->local_nkx + xx)*this->local_nky + yy);
+            std::copy(src, src + nc2,
+                      (rnumber*)(cdata) + nc2*(
+                        (yy*this->nz + this->z_start[r] + zz)*this->local_nkx + xx));
+        }
+    }
+}
+
+/* (ky, kz, kx) in cdata -> (z, kx, y) in buffer0 */
+template <typename rnumber>
+void pencil_fft<rnumber>::transpose_columns_backward(const complex *cdata)
+{
+    TIMEZONE("pencil_fft::transpose_columns_backward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nky);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nky);
+        for (int r=0; r<this->pgrid[0]; r++)
+        for (ptrdiff_t yy = start; yy < end; yy++)
+        for (ptrdiff_t zz = 0; zz < this->z_size[r]; zz++)
+        {
+            const rnumber *src = (const rnumber*)(cdata) + nc2*(
+                    (yy*this->nz + this->z_start[r] + zz)*this->local_nkx);
+            std::copy(src, src + nc2*this->local_nkx,
+                      (rnumber*)(this->buffer0) + 2*this->col_recv_displ[r] + nc2*(
+                        (yy*this->z_size[r] + zz)*this->local_nkx));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer0, &this->col_recv_count.front(), &this->col_recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer1, &this->col_send_count.front(), &this->col_send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->col_comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int r=0; r<this->pgrid[0]; r++)
+        for (ptrdiff_t yy = 0; yy < this->ky_size[r]; yy++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t xx = 0; xx < this->local_nkx; xx++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer1) + 2*this->col_send_displ[r] + nc2*(
+                    (yy*this->local_nz + zz)*this->local_nkx + xx);
+            std::copy(src, src + nc2,
+                      (rnumber*)(this->buffer0) + nc2*(
+                        (zz*this->local_nkx + xx)*this->ny + this->ky_start[r] + yy));
+        }
+    }
+}
+
+/* (z, kx, y) in buffer0 -> (z, y, kx) in buffer1 */
+template <typename rnumber>
+void pencil_fft<rnumber>::transpose_rows_backward()
+{
+    TIMEZONE("pencil_fft::transpose_rows_backward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int q=0; q<this->pgrid[1]; q++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t xx = 0; xx < this->local_nkx; xx++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer0) + nc2*(
+                    (zz*this->local_nkx + xx)*this->ny + this->y_start[q]);
+            std::copy(src, src + nc2*this->y_size[q],
+                      (rnumber*)(this->buffer1) + 2*this->row_recv_displ[q] + nc2*(
+                        (zz*this->local_nkx + xx)*this->y_size[q]));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer1, &this->row_recv_count.front(), &this->row_recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer0, &this->row_send_count.front(), &this->row_send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->row_comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(this->local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(this->local_nz);
+        for (int q=0; q<this->pgrid[1]; q++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t xx = 0; xx < this->kx_size[q]; xx++)
+        for (ptrdiff_t yy = 0; yy < this->local_ny; yy++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer0) + 2*this->row_send_displ[q] + nc2*(
+                    (zz*this->kx_size[q] + xx)*this->local_ny + yy);
+            std::copy(src, src + nc2,
+                      (rnumber*)(this->buffer1) + nc2*(
+                        (zz*this->local_ny + yy)*this->nxc + this->kx_start[q] + xx));
+        }
+    }
+}
+
+template <typename rnumber>
+void pencil_fft<rnumber>::r2c(rnumber *data)
+{
+    TIMEZONE("pencil_fft::r2c");
+    fftw_interface<rnumber>::execute_dft_r2c(this->x_r2c, data, this->buffer0);
+    this->transpose_rows_forward();
+    fftw_interface<rnumber>::execute_dft(this->y_forward, this->buffer1, this->buffer1);
+    this->transpose_columns_forward((complex*)data);
+    fftw_interface<rnumber>::execute_dft(this->z_forward, (complex*)data, (complex*)data);
+}
+
+template <typename rnumber>
+void pencil_fft<rnumber>::c2r(complex *cdata)
+{
+    TIMEZONE("pencil_fft::c2r");
+    fftw_interface<rnumber>::execute_dft(this->z_backward, cdata, cdata);
+    this->transpose_columns_backward(cdata);
+    fftw_interface<rnumber>::execute_dft(this->y_backward, this->buffer0, this->buffer0);
+    this->transpose_rows_backward();
+    fftw_interface<rnumber>::execute_dft_c2r(this->x_c2r, this->buffer1, (rnumber*)cdata);
+}
+
+template class pencil_fft<float>;
+template class pencil_fft<double>;
+
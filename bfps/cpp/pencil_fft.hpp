@@ -0,0 +1,176 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <mpi.h>
+#include <map>
+#include <tuple>
+#include <vector>
+#include "fftw_interface.hpp"
+
+#ifndef PENCIL_FFT_HPP
+
+#define PENCIL_FFT_HPP
+
+/** \class pencil_fft
+ *  \brief Distributed 3D r2c/c2r transforms on a 2D grid of processes.
+ *
+ *  FFTW-MPI distributes arrays along a single dimension, so a run can use at
+ *  most as many MPI processes as there are z planes.
+ *  This class distributes arrays over a `pgrid[0]` x `pgrid[1]` Cartesian
+ *  grid of processes ("pencil" decomposition), using the same global array
+ *  layouts as the `FFTW` backend of `field`:
+ *
+ *   - real space (z, y, x): z is split over `pgrid[0]`, y over `pgrid[1]`,
+ *     and x is local, padded to `rmem_nx` >= nx+2 points;
+ *   - Fourier space (ky, kz, kx): ky is split over `pgrid[0]`, kx over
+ *     `pgrid[1]`, and kz is local.
+ *
+ *  A transform consists of serial 1D FFTs along x, y and z, separated by two
+ *  all-to-all exchanges, within rows and within columns of the process grid.
+ *  Intermediate stages live in two work buffers owned by this object, so the
+ *  field array only ever holds the real or the Fourier representation.
+ *  `rmem_nx` is chosen such that the real space array is large enough to
+ *  also hold the Fourier representation.
+ *  As for `fftw_plan_registry`, objects are shared between fields with the
+ *  same shape, number of components, communicator and planner flags, and
+ *  `clear` must be called before `fftw_mpi_cleanup`.
+ */
+
+template <typename rnumber>
+class pencil_fft
+{
+    private:
+        using complex = typename fftw_interface<rnumber>::complex;
+        using plan = typename fftw_interface<rnumber>::plan;
+        /* key: nz, ny, nx, howmany, communicator, flags */
+        using key_type = std::tuple<int, int, int, int, MPI_Comm, unsigned>;
+
+        static std::map<key_type, pencil_fft<rnumber>*> &get_registry()
+        {
+            static std::map<key_type, pencil_fft<rnumber>*> registry;
+            return registry;
+        }
+
+        /* serial 1D plans */
+        plan x_r2c, x_c2r;
+        plan y_forward, y_backward;
+        plan z_forward, z_backward;
+
+        /* work buffers, large enough for any stage of the transform */
+        complex *buffer0, *buffer1;
+        ptrdiff_t buffer_size;
+
+        /* all-to-all counts and displacements for the forward transform,
+         * in units of complex numbers; the backward transform swaps the
+         * send and receive lists */
+        std::vector<int> row_send_count, row_send_displ;
+        std::vector<int> row_recv_count, row_recv_displ;
+        std::vector<int> col_send_count, col_send_displ;
+        std::vector<int> col_recv_count, col_recv_displ;
+
+        pencil_fft(
+                const int nx,
+                const int ny,
+                const int nz,
+                const int howmany,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR);
+        ~pencil_fft();
+
+        void transpose_rows_forward();
+        void transpose_columns_forward(complex *cdata);
+        void transpose_columns_backward(const complex *cdata);
+        void transpose_rows_backward();
+
+    public:
+        /* global sizes and number of components */
+        int nx, ny, nz, nxc, ncomp;
+        /* real space arrays have `rmem_nx` points along x */
+        ptrdiff_t rmem_nx;
+
+        /* process grid */
+        MPI_Comm comm;     /**< Cartesian communicator, same ranks as the original one. */
+        MPI_Comm row_comm; /**< processes holding the same z slab in real space. */
+        MPI_Comm col_comm; /**< processes holding the same kx slab in Fourier space. */
+        int pgrid[2], pcoord[2];
+
+        /* extents held by every process of a row or column:
+         * real space z and ky over columns, real space y and kx over rows */
+        std::vector<ptrdiff_t> z_size, z_start;
+        std::vector<ptrdiff_t> ky_size, ky_start;
+        std::vector<ptrdiff_t> y_size, y_start;
+        std::vector<ptrdiff_t> kx_size, kx_start;
+
+        /* local extents */
+        ptrdiff_t local_nz, local_z_start;
+        ptrdiff_t local_ny, local_y_start;
+        ptrdiff_t local_nky, local_ky_start;
+        ptrdiff_t local_nkx, local_kx_start;
+
+        static pencil_fft<rnumber> *get(
+                const int nx,
+                const int ny,
+                const int nz,
+                const int howmany,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR)
+        {
+            const key_type key(nz, ny, nx, howmany, COMM_TO_USE, FFTW_PLAN_RIGOR);
+            auto found = get_registry().find(key);
+            if (found != get_registry().end())
+                return found->second;
+            pencil_fft<rnumber> *new_pfft = new pencil_fft<rnumber>(
+                    nx, ny, nz, howmany, COMM_TO_USE, FFTW_PLAN_RIGOR);
+            get_registry()[key] = new_pfft;
+            return new_pfft;
+        }
+
+        static int size()
+        {
+            return int(get_registry().size());
+        }
+
+        static void clear()
+        {
+            for (auto kv : get_registry())
+                delete kv.second;
+            get_registry().clear();
+        }
+
+        /* number of real numbers to allocate for a field array */
+        inline ptrdiff_t get_local_alloc_size() const
+        {
+            return this->local_nz*this->local_ny*this->rmem_nx*this->ncomp;
+        }
+
+        /* unnormalized transforms, in-place on a field array */
+        void r2c(rnumber *data);
+        void c2r(complex *cdata);
+};
+
+#endif//PENCIL_FFT_HPP
+
@@ -0,0 +1,399 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <cmath>
+#include <algorithm>
+#include <cassert>
+#include "rspace_stats.hpp"
+#include "scope_timer.hpp"
+#include "shared_array.hpp"
+#include "hdf5_tools.hpp"
+
+/* moments are stored as in `field::compute_rspace_stats`:
+ * minimum, the averages of the first 8 powers, maximum */
+static const int nmoments = 10;
+
+template <typename rnumber,
+          field_backend be>
+int rspace_stats<rnumber, be>::read_sizes(
+        const hid_t group)
+{
+    std::vector<int> sizes(2*this->field_requests.size() + this->joint_PDF_requests.size());
+    if (this->myrank == 0)
+    {
+        hid_t dset, wspace;
+        hsize_t dims[5];
+        int ndims;
+        for (size_t ff = 0; ff < this->field_requests.size(); ff++)
+        {
+            const field_request &request = this->field_requests[ff];
+            dset = hdf5_tools::open_cached_dataset(group, "moments/" + request.dset_name);
+            wspace = H5Dget_space(dset);
+            ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
+            assert(ndims == int(ndim(request.fc))-1);
+            assert(dims[1] == hsize_t(nmoments));
+            switch(ndims)
+            {
+                case 2:
+                    sizes[2*ff] = 1;
+                    break;
+                case 3:
+                    sizes[2*ff] = dims[2];
+                    break;
+                case 4:
+                    sizes[2*ff] = dims[2]*dims[3];
+                    break;
+            }
+            H5Sclose(wspace);
+            dset = hdf5_tools::open_cached_dataset(group, "histograms/" + request.dset_name);
+            wspace = H5Dget_space(dset);
+            ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
+            assert(ndims == int(ndim(request.fc))-1);
+            sizes[2*ff+1] = dims[1];
+            H5Sclose(wspace);
+        }
+        for (size_t pp = 0; pp < this->joint_PDF_requests.size(); pp++)
+        {
+            const joint_PDF_request &request = this->joint_PDF_requests[pp];
+            std::string dsetm = "histograms/" + request.dset_name;
+            if (request.fc == THREE)
+            {
+                dset = hdf5_tools::open_cached_dataset(group, dsetm + "_components");
+                wspace = H5Dget_space(dset);
+                ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
+                assert(ndims == 5);
+                assert(dims[3] == 3);
+                assert(dims[4] == 3);
+                H5Sclose(wspace);
+                dsetm += "_magnitudes";
+            }
+            dset = hdf5_tools::open_cached_dataset(group, dsetm);
+            wspace = H5Dget_space(dset);
+            ndims = H5Sget_simple_extent_dims(wspace, dims, NULL);
+            assert(ndims == 3);
+            sizes[2*this->field_requests.size() + pp] = dims[1];
+            H5Sclose(wspace);
+        }
+    }
+    {
+        TIMEZONE("MPI_Bcast");
+        MPI_Bcast(&sizes.front(), sizes.size(), MPI_INT, 0, this->comm);
+    }
+    for (size_t ff = 0; ff < this->field_requests.size(); ff++)
+    {
+        this->field_requests[ff].nvals = sizes[2*ff];
+        this->field_requests[ff].nbins = sizes[2*ff+1];
+        assert(this->field_requests[ff].nvals == int(this->field_requests[ff].max_estimate.size()));
+    }
+    for (size_t pp = 0; pp < this->joint_PDF_requests.size(); pp++)
+        this->joint_PDF_requests[pp].nbins = sizes[2*this->field_requests.size() + pp];
+    return EXIT_SUCCESS;
+}
+
+template <typename rnumber,
+          field_backend be>
+int rspace_stats<rnumber, be>::compute(
+        const hid_t group,
+        const hsize_t toffset)
+{
+    TIMEZONE("rspace_stats::compute");
+    if (this->field_requests.empty() && this->joint_PDF_requests.empty())
+        return EXIT_SUCCESS;
+    for (auto &request : this->field_requests)
+        assert(*request.real_space_representation);
+    for (auto &request : this->joint_PDF_requests)
+    {
+        assert(*request.real_space_representation1);
+        assert(*request.real_space_representation2);
+    }
+    this->read_sizes(group);
+
+    /* extrema: for every field, the minima followed by the negated maxima,
+     * so that a single MPI_MIN reduction takes care of both.
+     * sums: for every field, the sums of powers followed by the histogram,
+     * then the histograms of the joint PDFs. counts are accumulated as
+     * doubles, which is exact up to 2^53 points. */
+    size_t nextrema = 0, nsums = 0;
+    for (auto &request : this->field_requests)
+    {
+        request.extrema_offset = nextrema;
+        nextrema += 2*request.nvals;
+        request.sums_offset = nsums;
+        nsums += (nmoments-2 + request.nbins)*request.nvals;
+    }
+    for (auto &request : this->joint_PDF_requests)
+    {
+        request.sums_offset = nsums;
+        nsums += request.nbins*request.nbins*((request.fc == THREE) ? 10 : 1);
+    }
+
+    shared_array<double> local_extrema_threaded(
+            nextrema,
+            [&](double *local_extrema){
+        std::fill_n(local_extrema, nextrema, 0);
+        for (auto &request : this->field_requests)
+            if (request.nvals == 4)
+                local_extrema[request.extrema_offset + 3] = request.max_estimate[3];
+    });
+    shared_array<double> local_sums_threaded(
+            nsums,
+            [&](double *local_sums){
+        std::fill_n(local_sums, nsums, 0);
+    });
+
+    std::vector<std::vector<double>> binsize(this->field_requests.size());
+    for (size_t ff = 0; ff < this->field_requests.size(); ff++)
+    {
+        binsize[ff].resize(this->field_requests[ff].nvals);
+        for (int i=0; i<this->field_requests[ff].nvals; i++)
+            binsize[ff][i] = 2*this->field_requests[ff].max_estimate[i] / this->field_requests[ff].nbins;
+    }
+    std::vector<std::vector<double>> bin1size(this->joint_PDF_requests.size());
+    std::vector<std::vector<double>> bin2size(this->joint_PDF_requests.size());
+    for (size_t pp = 0; pp < this->joint_PDF_requests.size(); pp++)
+    {
+        const joint_PDF_request &request = this->joint_PDF_requests[pp];
+        bin1size[pp].resize(4);
+        bin2size[pp].resize(4);
+        if (request.fc == THREE)
+        {
+            for (unsigned int i=0; i<3; i++)
+            {
+                bin1size[pp][i] = 2*request.max_f1_estimate[i] / request.nbins;
+                bin2size[pp][i] = 2*request.max_f2_estimate[i] / request.nbins;
+            }
+            bin1size[pp][3] = request.max_f1_estimate[3] / request.nbins;
+            bin2size[pp][3] = request.max_f2_estimate[3] / request.nbins;
+        }
+        else
+            for (unsigned int i=0; i<4; i++)
+            {
+                bin1size[pp][i] = request.max_f1_estimate[0] / request.nbins;
+                bin2size[pp][i] = request.max_f2_estimate[0] / request.nbins;
+            }
+    }
+
+    {
+        TIMEZONE("rspace_stats::RLOOP");
+        this->row_loop(
+                [&](ptrdiff_t row_rindex,
+                    ptrdiff_t nx){
+        double *local_extrema = local_extrema_threaded.getMine();
+        double *local_sums = local_sums_threaded.getMine();
+        for (size_t ff = 0; ff < this->field_requests.size(); ff++)
+        {
+            const field_request &request = this->field_requests[ff];
+            const int nc = request.ncomp;
+            const int nvals = request.nvals;
+            const int nbins = request.nbins;
+            const rnumber *__restrict__ row = request.data + row_rindex*nc;
+            double *__restrict__ fmin = local_extrema + request.extrema_offset;
+            double *__restrict__ fmax = fmin + nvals;
+            double *__restrict__ fsum = local_sums + request.sums_offset;
+            double *__restrict__ fhist = fsum + (nmoments-2)*nvals;
+            double val_tmp[9], pow_tmp[9];
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+            {
+                for (int i=0; i<nc; i++)
+                    val_tmp[i] = row[nc*xindex+i];
+                if (nvals == 4)
+                {
+                    double norm2 = 0.0;
+                    for (int i=0; i<nc; i++)
+                        norm2 += val_tmp[i]*val_tmp[i];
+                    val_tmp[3] = sqrt(norm2);
+                    if (val_tmp[3] < fmin[3])
+                        fmin[3] = val_tmp[3];
+                    if (-val_tmp[3] < fmax[3])
+                        fmax[3] = -val_tmp[3];
+                    int bin = int(floor(val_tmp[3]*2/binsize[ff][3]));
+                    if (bin >= 0 && bin < nbins)
+                        fhist[bin*nvals+3]++;
+                }
+                for (int i=0; i<nc; i++)
+                {
+                    if (val_tmp[i] < fmin[i])
+                        fmin[i] = val_tmp[i];
+                    if (-val_tmp[i] < fmax[i])
+                        fmax[i] = -val_tmp[i];
+                    int bin = int(floor((val_tmp[i] + request.max_estimate[i]) / binsize[ff][i]));
+                    if (bin >= 0 && bin < nbins)
+                        fhist[bin*nvals+i]++;
+                }
+                std::fill_n(pow_tmp, nvals, 1);
+                for (int n=0; n < nmoments-2; n++)
+                    for (int i=0; i<nvals; i++)
+                        fsum[n*nvals + i] += (pow_tmp[i] = val_tmp[i]*pow_tmp[i]);
+            }
+        }
+        for (size_t pp = 0; pp < this->joint_PDF_requests.size(); pp++)
+        {
+            const joint_PDF_request &request = this->joint_PDF_requests[pp];
+            const int nbins = request.nbins;
+            double *__restrict__ histm = local_sums + request.sums_offset;
+            double *__restrict__ histc = histm + nbins*nbins;
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+            {
+                int bin1 = 0;
+                int bin2 = 0;
+                if (request.fc == THREE)
+                {
+                    const rnumber *__restrict__ val1 = request.data1 + (row_rindex + xindex)*3;
+                    const rnumber *__restrict__ val2 = request.data2 + (row_rindex + xindex)*3;
+                    double mag1 = 0.0, mag2 = 0.0;
+                    for (unsigned int j=0; j<3; j++)
+                        mag2 += double(val2[j])*double(val2[j]);
+                    for (unsigned int i=0; i<3; i++)
+                    {
+                        mag1 += double(val1[i])*double(val1[i]);
+                        int cbin1 = int(floor((val1[i] + request.max_f1_estimate[i])/bin1size[pp][i]));
+                        for (unsigned int j=0; j<3; j++)
+                        {
+                            int cbin2 = int(floor((val2[j] + request.max_f2_estimate[j])/bin2size[pp][j]));
+                            if ((cbin1 >= 0 && cbin1 < nbins) &&
+                                (cbin2 >= 0 && cbin2 < nbins))
+                                histc[(cbin1*nbins + cbin2)*9 + i*3 + j]++;
+                        }
+                    }
+                    bin1 = int(floor(sqrt(mag1)/bin1size[pp][3]));
+                    bin2 = int(floor(sqrt(mag2)/bin2size[pp][3]));
+                }
+                else
+                {
+                    bin1 = int(floor(request.data1[row_rindex + xindex]/bin1size[pp][3]));
+                    bin2 = int(floor(request.data2[row_rindex + xindex]/bin2size[pp][3]));
+                }
+                if ((bin1 >= 0 && bin1 < nbins) &&
+                    (bin2 >= 0 && bin2 < nbins))
+                    histm[bin1*nbins + bin2]++;
+            }
+        }
+                });
+
+        TIMEZONE("rspace_stats::Merge");
+        local_extrema_threaded.mergeParallel([&](const int idx, const double& v1, const double& v2) -> double {
+            return std::min(v1, v2);
+        });
+        local_sums_threaded.mergeParallel();
+    }
+
+    std::vector<double> extrema(nextrema), sums(nsums);
+    {
+        TIMEZONE("MPI_Allreduce");
+        MPI_Request requests[2];
+        MPI_Iallreduce(
+                (void*)local_extrema_threaded.getMasterData(),
+                (void*)&extrema.front(),
+                nextrema,
+                MPI_DOUBLE, MPI_MIN, this->comm, requests + 0);
+        MPI_Iallreduce(
+                (void*)local_sums_threaded.getMasterData(),
+                (void*)&sums.front(),
+                nsums,
+                MPI_DOUBLE, MPI_SUM, this->comm, requests + 1);
+        MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+    }
+
+    if (this->myrank == 0)
+    {
+        TIMEZONE("root-work");
+        for (auto &request : this->field_requests)
+        {
+            const int nvals = request.nvals;
+            const int nbins = request.nbins;
+            std::vector<double> moments(nmoments*nvals);
+            std::vector<int64_t> hist(nbins*nvals);
+            for (int i=0; i<nvals; i++)
+            {
+                moments[i] = extrema[request.extrema_offset + i];
+                moments[(nmoments-1)*nvals + i] = -extrema[request.extrema_offset + nvals + i];
+            }
+            for (int n=1; n < nmoments-1; n++)
+                for (int i=0; i<nvals; i++)
+                    moments[n*nvals + i] = sums[request.sums_offset + (n-1)*nvals + i] / this->npoints;
+            for (int i=0; i<nbins*nvals; i++)
+                hist[i] = int64_t(sums[request.sums_offset + (nmoments-2)*nvals + i]);
+
+            hdf5_tools::write_stats_row(
+                    group,
+                    "moments/" + request.dset_name,
+                    toffset,
+                    &moments.front());
+            hdf5_tools::write_stats_row(
+                    group,
+                    "histograms/" + request.dset_name,
+                    toffset,
+                    &hist.front());
+            if (H5Lexists(
+                        group,
+                        "0slices",
+                        H5P_DEFAULT))
+            {
+                if (H5Lexists(
+                            group,
+                            (std::string("0slices/") + request.dset_name).c_str(),
+                            H5P_DEFAULT))
+                request.write_0slice(
+                        group,
+                        request.dset_name,
+                        toffset);
+            }
+        }
+        for (auto &request : this->joint_PDF_requests)
+        {
+            const int nbins = request.nbins;
+            std::vector<int64_t> histm(nbins*nbins);
+            for (int i=0; i<nbins*nbins; i++)
+                histm[i] = int64_t(sums[request.sums_offset + i]);
+            std::string dsetm = "histograms/" + request.dset_name;
+            if (request.fc == THREE)
+            {
+                std::vector<int64_t> histc(nbins*nbins*9);
+                for (int i=0; i<nbins*nbins*9; i++)
+                    histc[i] = int64_t(sums[request.sums_offset + nbins*nbins + i]);
+                hdf5_tools::write_stats_row(
+                        group,
+                        dsetm + "_components",
+                        toffset,
+                        &histc.front());
+                dsetm += "_magnitudes";
+            }
+            hdf5_tools::write_stats_row(
+                    group,
+                    dsetm,
+                    toffset,
+                    &histm.front());
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+template class rspace_stats<float, FFTW>;
+template class rspace_stats<double, FFTW>;
+template class rspace_stats<float, PENCIL>;
+template class rspace_stats<double, PENCIL>;
+
@@ -0,0 +1,187 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <vector>
+#include <string>
+#include <functional>
+#include "field.hpp"
+
+#ifndef RSPACE_STATS_HPP
+
+#define RSPACE_STATS_HPP
+
+/** \class rspace_stats
+ *  \brief Real space statistics of several fields, computed together.
+ *
+ *  Fields are registered with `add_field` (moments and histograms, same
+ *  datasets as `field::compute_rspace_stats`) and pairs of fields with
+ *  `add_joint_PDF` (same datasets as `joint_rspace_PDF`).
+ *  `compute` then goes once over the real space grid, accumulating all
+ *  requested quantities, and reduces them with one MPI_MIN and one MPI_SUM
+ *  reduction in total, independently of the number of fields.
+ *
+ *  All fields must share the real space layout, and they must be in real
+ *  space representation when `compute` is called.
+ *  Fields are not owned by the object, and the list of requests is kept
+ *  between calls to `compute`, so the same object can be reused for every
+ *  statistics iteration.
+ */
+
+template <typename rnumber,
+          field_backend be>
+class rspace_stats
+{
+    private:
+        struct field_request
+        {
+            const rnumber *data;
+            const bool *real_space_representation;
+            field_components fc;
+            int ncomp;
+            std::string dset_name;
+            std::vector<double> max_estimate;
+            std::function<int(const hid_t, const std::string, const int)> write_0slice;
+            /* read from the output file */
+            int nvals, nbins;
+            /* position of the data in the reduction buffers */
+            size_t extrema_offset, sums_offset;
+        };
+        struct joint_PDF_request
+        {
+            const rnumber *data1;
+            const rnumber *data2;
+            const bool *real_space_representation1;
+            const bool *real_space_representation2;
+            field_components fc;
+            std::string dset_name;
+            std::vector<double> max_f1_estimate, max_f2_estimate;
+            /* read from the output file */
+            int nbins;
+            /* position of the data in the reduction buffer */
+            size_t sums_offset;
+        };
+
+        std::vector<field_request> field_requests;
+        std::vector<joint_PDF_request> joint_PDF_requests;
+
+        /* real space grid, taken from the first registered field */
+        MPI_Comm comm;
+        int myrank;
+        hsize_t npoints;
+        std::function<void(std::function<void(ptrdiff_t, ptrdiff_t)>)> row_loop;
+
+        template <field_components fc>
+        void set_grid(field<rnumber, be, fc> *f)
+        {
+            if (!this->row_loop)
+            {
+                this->comm = f->comm;
+                this->myrank = f->myrank;
+                this->npoints = f->npoints;
+                this->row_loop = [f](std::function<void(ptrdiff_t, ptrdiff_t)> row_expression)
+                {
+                    f->RLOOP_ROWS(
+                            [&](ptrdiff_t rindex,
+                                ptrdiff_t nx,
+                                ptrdiff_t yindex,
+                                ptrdiff_t zindex){
+                        row_expression(rindex, nx);
+                    });
+                };
+            }
+            assert(this->npoints == f->npoints);
+        }
+
+        int read_sizes(const hid_t group);
+
+    public:
+        rspace_stats():
+            comm(MPI_COMM_NULL),
+            myrank(0),
+            npoints(0){}
+        ~rspace_stats(){}
+
+        /* moments and histograms of one field;
+         * `max_estimate` has 4 entries for vector fields (the last one for
+         * the magnitude), 9 for tensor fields and 1 for scalar fields */
+        template <field_components fc>
+        void add_field(
+                field<rnumber, be, fc> *f,
+                const std::string dset_name,
+                const std::vector<double> max_estimate)
+        {
+            this->set_grid(f);
+            field_request request;
+            request.data = f->get_rdata();
+            request.real_space_representation = &f->real_space_representation;
+            request.fc = fc;
+            request.ncomp = ncomp(fc);
+            request.dset_name = dset_name;
+            request.max_estimate = max_estimate;
+            request.write_0slice = [f](const hid_t group, const std::string name, const int toffset)
+            {
+                return f->write_0slice(group, name, toffset);
+            };
+            request.nvals = 0;
+            request.nbins = 0;
+            this->field_requests.push_back(request);
+        }
+
+        /* joint PDF of two scalar or two vector fields */
+        template <field_components fc>
+        void add_joint_PDF(
+                field<rnumber, be, fc> *f1,
+                field<rnumber, be, fc> *f2,
+                const std::string dset_name,
+                const std::vector<double> max_f1_estimate,
+                const std::vector<double> max_f2_estimate)
+        {
+            assert(fc == ONE || fc == THREE);
+            this->set_grid(f1);
+            this->set_grid(f2);
+            joint_PDF_request request;
+            request.data1 = f1->get_rdata();
+            request.data2 = f2->get_rdata();
+            request.real_space_representation1 = &f1->real_space_representation;
+            request.real_space_representation2 = &f2->real_space_representation;
+            request.fc = fc;
+            request.dset_name = dset_name;
+            request.max_f1_estimate = max_f1_estimate;
+            request.max_f2_estimate = max_f2_estimate;
+            request.nbins = 0;
+            this->joint_PDF_requests.push_back(request);
+        }
+
+        /* compute everything, and write it at `toffset` in `group`
+         * (only meaningful on rank 0) */
+        int compute(
+                const hid_t group,
+                const hsize_t toffset);
+};
+
+#endif//RSPACE_STATS_HPP
+
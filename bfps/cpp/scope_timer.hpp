@@ -255,6 +255,16 @@ public:
         }
     }
 
+    /** Threads that are not started by OpenMP (such as background I/O
+     * threads) also see omp_get_thread_num() == 0, so their events would
+     * be mixed with the ones of the master thread. Such threads must set
+     * this to true before starting any event; their events are ignored.
+     */
+    static bool& currentThreadIsMuted() {
+      static thread_local bool muted = false;
+      return muted;
+    }
+
     void startParallelRegion(const int inNbThreads) {
       m_currentEventsStackPerThread.resize(1);
       m_currentEventsStackPerThread.resize(inNbThreads,
@@ -745,7 +755,8 @@ public:
     ScopeEvent(const std::string& inName, EventManager& inManager,
                const std::string& inUniqueKey)
         : m_manager(inManager),
-          m_event(inManager.getEvent(inName, inUniqueKey)),
+          m_event(EventManager::currentThreadIsMuted() ?
+                      nullptr : inManager.getEvent(inName, inUniqueKey)),
           m_isTask(false) {
       m_timer.start();
     }
@@ -761,6 +772,9 @@ public:
     }
 
     ~ScopeEvent() {
+      if (m_event == nullptr) {
+        return;
+      }
       m_event->addRecord(m_timer.stopAndGetElapsed(), m_isTask);
       if (m_isTask == false) {
         m_manager.popEvent(m_event);
@@ -25,80 +25,174 @@
 
 
 #include "spline_n1.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n1_m0(int deriv, double x, double *poly_val)
+template <>
+struct spline_polynomials<1, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, -1.0, 1.0, 0},
+        {0, 0.5, 0.5, 0}};
+};
+constexpr double spline_polynomials<1, 0, 0>::coefficients[2][4];
+
+template <>
+struct spline_polynomials<1, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, -1.0, 1.0, 0}};
+};
+constexpr double spline_polynomials<1, 0, 1>::coefficients[1][4];
+
+template <>
+struct spline_polynomials<1, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<1, 0, 2>::coefficients[1][4];
+
+template <class real_number>
+void beta_n1_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = -x + 1;
-        poly_val[2] = x;
-        poly_val[3] = 0;
+        evaluate_beta_polynomials<spline_polynomials<1, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = -1;
-        poly_val[2] = 1;
-        poly_val[3] = 0;
+        evaluate_beta_polynomials<spline_polynomials<1, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
+        evaluate_beta_polynomials<spline_polynomials<1, 0, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n1_m1(int deriv, double x, double *poly_val)
+template void beta_n1_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n1_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<1, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.5, 1.5, -1.5, 0.5},
+        {0.25, -0.25, -0.25, 0.25},
+        {0.125, -1.375, 1.375, -0.125},
+        {-0.0625, 0.5625, 0.5625, -0.0625}};
+};
+constexpr double spline_polynomials<1, 1, 0>::coefficients[4][4];
+
+template <>
+struct spline_polynomials<1, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.5, 4.5, -4.5, 1.5},
+        {0.5, -0.5, -0.5, 0.5},
+        {0.125, -1.375, 1.375, -0.125}};
+};
+constexpr double spline_polynomials<1, 1, 1>::coefficients[3][4];
+
+template <>
+struct spline_polynomials<1, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-3.0, 9.0, -9.0, 3.0},
+        {0.5, -0.5, -0.5, 0.5}};
+};
+constexpr double spline_polynomials<1, 1, 2>::coefficients[2][4];
+
+template <class real_number>
+void beta_n1_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(-1.0L/2.0L*x + 1) - 1.0L/2.0L);
-        poly_val[1] = pow(x, 2)*((3.0L/2.0L)*x - 5.0L/2.0L) + 1;
-        poly_val[2] = x*(x*(-3.0L/2.0L*x + 2) + 1.0L/2.0L);
-        poly_val[3] = pow(x, 2)*((1.0L/2.0L)*x - 1.0L/2.0L);
+        evaluate_beta_polynomials<spline_polynomials<1, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(-3.0L/2.0L*x + 2) - 1.0L/2.0L;
-        poly_val[1] = x*((9.0L/2.0L)*x - 5);
-        poly_val[2] = x*(-9.0L/2.0L*x + 4) + 1.0L/2.0L;
-        poly_val[3] = x*((3.0L/2.0L)*x - 1);
+        evaluate_beta_polynomials<spline_polynomials<1, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = -3*x + 2;
-        poly_val[1] = 9*x - 5;
-        poly_val[2] = -9*x + 4;
-        poly_val[3] = 3*x - 1;
+        evaluate_beta_polynomials<spline_polynomials<1, 1, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n1_m2(int deriv, double x, double *poly_val)
+template void beta_n1_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n1_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<1, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {1.0, -3.0, 3.0, -1.0},
+        {0, 0, 0, 0},
+        {-1.0, 3.0, -3.0, 1.0},
+        {0.25, -0.25, -0.25, 0.25},
+        {0.1875, -1.5625, 1.5625, -0.1875},
+        {-0.0625, 0.5625, 0.5625, -0.0625}};
+};
+constexpr double spline_polynomials<1, 2, 0>::coefficients[6][4];
+
+template <>
+struct spline_polynomials<1, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {5.0, -15.0, 15.0, -5.0},
+        {0, 0, 0, 0},
+        {-3.0, 9.0, -9.0, 3.0},
+        {0.5, -0.5, -0.5, 0.5},
+        {0.1875, -1.5625, 1.5625, -0.1875}};
+};
+constexpr double spline_polynomials<1, 2, 1>::coefficients[5][4];
+
+template <>
+struct spline_polynomials<1, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 4;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {20.0, -60.0, 60.0, -20.0},
+        {0, 0, 0, 0},
+        {-6.0, 18.0, -18.0, 6.0},
+        {0.5, -0.5, -0.5, 0.5}};
+};
+constexpr double spline_polynomials<1, 2, 2>::coefficients[4][4];
+
+template <class real_number>
+void beta_n1_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x - 5.0L/2.0L) + 3.0L/2.0L) + 1.0L/2.0L) - 1.0L/2.0L);
-        poly_val[1] = pow(x, 2)*(x*(x*(-3*x + 15.0L/2.0L) - 9.0L/2.0L) - 1) + 1;
-        poly_val[2] = x*(x*(x*(x*(3*x - 15.0L/2.0L) + 9.0L/2.0L) + 1.0L/2.0L) + 1.0L/2.0L);
-        poly_val[3] = pow(x, 3)*(x*(-x + 5.0L/2.0L) - 3.0L/2.0L);
+        evaluate_beta_polynomials<spline_polynomials<1, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(5*x - 10) + 9.0L/2.0L) + 1) - 1.0L/2.0L;
-        poly_val[1] = x*(x*(x*(-15*x + 30) - 27.0L/2.0L) - 2);
-        poly_val[2] = x*(x*(x*(15*x - 30) + 27.0L/2.0L) + 1) + 1.0L/2.0L;
-        poly_val[3] = pow(x, 2)*(x*(-5*x + 10) - 9.0L/2.0L);
+        evaluate_beta_polynomials<spline_polynomials<1, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(20*x - 30) + 9) + 1;
-        poly_val[1] = x*(x*(-60*x + 90) - 27) - 2;
-        poly_val[2] = x*(x*(60*x - 90) + 27) + 1;
-        poly_val[3] = x*(x*(-20*x + 30) - 9);
+        evaluate_beta_polynomials<spline_polynomials<1, 2, 2>>(x, poly_val);
         break;
     }
 }
 
+template void beta_n1_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n1_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
@@ -28,9 +28,12 @@
 
 #define SPLINE_N1
 
-void beta_n1_m0(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n1_m1(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n1_m2(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n1_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n1_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n1_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N1
 
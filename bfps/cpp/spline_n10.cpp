@@ -25,390 +25,696 @@
 
 
 #include "spline_n10.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n10_m0(int deriv, double x, double *poly_val) {
+template <>
+struct spline_polynomials<10, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, -1.0, 1.0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0.5, 0.5,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<10, 0, 0>::coefficients[2][22];
+
+template <>
+struct spline_polynomials<10, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, -1.0, 1.0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<10, 0, 1>::coefficients[1][22];
+
+template <>
+struct spline_polynomials<10, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<10, 0, 2>::coefficients[1][22];
+
+template <class real_number>
+void beta_n10_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = -x + 1;
-        poly_val[11] = x;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
-        poly_val[20] = 0;
-        poly_val[21] = 0;
+        evaluate_beta_polynomials<spline_polynomials<10, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = -1;
-        poly_val[11] = 1;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
-        poly_val[20] = 0;
-        poly_val[21] = 0;
+        evaluate_beta_polynomials<spline_polynomials<10, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
-        poly_val[20] = 0;
-        poly_val[21] = 0;
+        evaluate_beta_polynomials<spline_polynomials<10, 0, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n10_m1(int deriv, double x, double *poly_val) {
+
+template void beta_n10_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n10_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<10, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {5.412544112234514e-07, -1.1486621393742138e-05, 0.00011652004686060413, -0.0007529235470411941,
+         0.0034891579009226066, -0.012412587412587413, 0.03566433566433566, -0.08741258741258741,
+         0.20104895104895104, -0.5681818181818182, 1.0909090909090908, -1.0909090909090908,
+         0.5681818181818182, -0.20104895104895104, 0.08741258741258741, -0.03566433566433566,
+         0.012412587412587413, -0.0034891579009226066, 0.0007529235470411941, -0.00011652004686060413,
+         1.1486621393742138e-05, -5.412544112234514e-07},
+        {-2.706272056117257e-07, 6.2845651080945196e-06, -7.028789923526766e-05, 0.0005050096961861668,
+         -0.0026260504201680674, 0.010576923076923078, -0.03461538461538462, 0.09615384615384616,
+         -0.2403846153846154, 0.625, -0.45454545454545453, -0.45454545454545453,
+         0.625, -0.2403846153846154, 0.09615384615384616, -0.03461538461538462,
+         0.010576923076923078, -0.0026260504201680674, 0.0005050096961861668, -7.028789923526766e-05,
+         6.2845651080945196e-06, -2.706272056117257e-07},
+        {-1.3531360280586286e-07, 2.8716553484355344e-06, -2.9130011715151033e-05, 0.00018823088676029852,
+         -0.0008722894752306516, 0.0031031468531468533, -0.008916083916083915, 0.021853146853146852,
+         -0.05026223776223776, 0.14204545454545456, -1.2727272727272727, 1.2727272727272727,
+         -0.14204545454545456, 0.05026223776223776, -0.021853146853146852, 0.008916083916083915,
+         -0.0031031468531468533, 0.0008722894752306516, -0.00018823088676029852, 2.9130011715151033e-05,
+         -2.8716553484355344e-06, 1.3531360280586286e-07},
+        {6.765680140293143e-08, -1.5711412770236299e-06, 1.7571974808816914e-05, -0.0001262524240465417,
+         0.0006565126050420169, -0.0026442307692307694, 0.008653846153846154, -0.02403846153846154,
+         0.06009615384615385, -0.15625, 0.6136363636363636, 0.6136363636363636,
+         -0.15625, 0.06009615384615385, -0.02403846153846154, 0.008653846153846154,
+         -0.0026442307692307694, 0.0006565126050420169, -0.0001262524240465417, 1.7571974808816914e-05,
+         -1.5711412770236299e-06, 6.765680140293143e-08}};
+};
+constexpr double spline_polynomials<10, 1, 0>::coefficients[4][22];
+
+template <>
+struct spline_polynomials<10, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {1.6237632336703543e-06, -3.445986418122641e-05, 0.0003495601405818124, -0.0022587706411235824,
+         0.010467473702767821, -0.03723776223776224, 0.106993006993007, -0.26223776223776224,
+         0.6031468531468531, -1.7045454545454546, 3.272727272727273, -3.272727272727273,
+         1.7045454545454546, -0.6031468531468531, 0.26223776223776224, -0.106993006993007,
+         0.03723776223776224, -0.010467473702767821, 0.0022587706411235824, -0.0003495601405818124,
+         3.445986418122641e-05, -1.6237632336703543e-06},
+        {-5.412544112234514e-07, 1.2569130216189039e-05, -0.0001405757984705353, 0.0010100193923723336,
+         -0.005252100840336135, 0.021153846153846155, -0.06923076923076923, 0.19230769230769232,
+         -0.4807692307692308, 1.25, -0.9090909090909091, -0.9090909090909091,
+         1.25, -0.4807692307692308, 0.19230769230769232, -0.06923076923076923,
+         0.021153846153846155, -0.005252100840336135, 0.0010100193923723336, -0.0001405757984705353,
+         1.2569130216189039e-05, -5.412544112234514e-07},
+        {-1.3531360280586286e-07, 2.8716553484355344e-06, -2.9130011715151033e-05, 0.00018823088676029852,
+         -0.0008722894752306516, 0.0031031468531468533, -0.008916083916083915, 0.021853146853146852,
+         -0.05026223776223776, 0.14204545454545456, -1.2727272727272727, 1.2727272727272727,
+         -0.14204545454545456, 0.05026223776223776, -0.021853146853146852, 0.008916083916083915,
+         -0.0031031468531468533, 0.0008722894752306516, -0.00018823088676029852, 2.9130011715151033e-05,
+         -2.8716553484355344e-06, 1.3531360280586286e-07}};
+};
+constexpr double spline_polynomials<10, 1, 1>::coefficients[3][22];
+
+template <>
+struct spline_polynomials<10, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.2475264673407086e-06, -6.891972836245283e-05, 0.0006991202811636248, -0.004517541282247165,
+         0.020934947405535642, -0.07447552447552448, 0.213986013986014, -0.5244755244755245,
+         1.2062937062937062, -3.409090909090909, 6.545454545454546, -6.545454545454546,
+         3.409090909090909, -1.2062937062937062, 0.5244755244755245, -0.213986013986014,
+         0.07447552447552448, -0.020934947405535642, 0.004517541282247165, -0.0006991202811636248,
+         6.891972836245283e-05, -3.2475264673407086e-06},
+        {-5.412544112234514e-07, 1.2569130216189039e-05, -0.0001405757984705353, 0.0010100193923723336,
+         -0.005252100840336135, 0.021153846153846155, -0.06923076923076923, 0.19230769230769232,
+         -0.4807692307692308, 1.25, -0.9090909090909091, -0.9090909090909091,
+         1.25, -0.4807692307692308, 0.19230769230769232, -0.06923076923076923,
+         0.021153846153846155, -0.005252100840336135, 0.0010100193923723336, -0.0001405757984705353,
+         1.2569130216189039e-05, -5.412544112234514e-07}};
+};
+constexpr double spline_polynomials<10, 1, 2>::coefficients[2][22];
+
+template <class real_number>
+void beta_n10_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*((1.0L/1847560.0L)*x - 1.0L/923780.0L) + 1.0L/1847560.0L);
-        poly_val[1] = x*(x*(-191.0L/16628040.0L*x + 23.0L/978120.0L) - 5.0L/415701.0L);
-        poly_val[2] = x*(x*((775.0L/6651216.0L)*x - 815.0L/3325608.0L) + 5.0L/38896.0L);
-        poly_val[3] = x*(x*(-205.0L/272272.0L*x + 445.0L/272272.0L) - 15.0L/17017.0L);
-        poly_val[4] = x*(x*((475.0L/136136.0L)*x - 535.0L/68068.0L) + 5.0L/1144.0L);
-        poly_val[5] = x*(x*(-71.0L/5720.0L*x + 167.0L/5720.0L) - 12.0L/715.0L);
-        poly_val[6] = x*(x*((51.0L/1430.0L)*x - 63.0L/715.0L) + 15.0L/286.0L);
-        poly_val[7] = x*(x*(-25.0L/286.0L*x + 5.0L/22.0L) - 20.0L/143.0L);
-        poly_val[8] = x*(x*((115.0L/572.0L)*x - 155.0L/286.0L) + 15.0L/44.0L);
-        poly_val[9] = x*(x*(-25.0L/44.0L*x + 65.0L/44.0L) - 10.0L/11.0L);
-        poly_val[10] = pow(x, 2)*((12.0L/11.0L)*x - 23.0L/11.0L) + 1;
-        poly_val[11] = x*(x*(-12.0L/11.0L*x + 13.0L/11.0L) + 10.0L/11.0L);
-        poly_val[12] = x*(x*((25.0L/44.0L)*x - 5.0L/22.0L) - 15.0L/44.0L);
-        poly_val[13] = x*(x*(-115.0L/572.0L*x + 35.0L/572.0L) + 20.0L/143.0L);
-        poly_val[14] = x*(x*((25.0L/286.0L)*x - 5.0L/143.0L) - 15.0L/286.0L);
-        poly_val[15] = x*(x*(-51.0L/1430.0L*x + 27.0L/1430.0L) + 12.0L/715.0L);
-        poly_val[16] = x*(x*((71.0L/5720.0L)*x - 23.0L/2860.0L) - 5.0L/1144.0L);
-        poly_val[17] = x*(x*(-475.0L/136136.0L*x + 355.0L/136136.0L) + 15.0L/17017.0L);
-        poly_val[18] = x*(x*((205.0L/272272.0L)*x - 5.0L/8008.0L) - 5.0L/38896.0L);
-        poly_val[19] = x*(x*(-775.0L/6651216.0L*x + 695.0L/6651216.0L) + 5.0L/415701.0L);
-        poly_val[20] = x*(x*((191.0L/16628040.0L)*x - 7.0L/639540.0L) - 1.0L/1847560.0L);
-        poly_val[21] = pow(x, 2)*(-1.0L/1847560.0L*x + 1.0L/1847560.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*((3.0L/1847560.0L)*x - 1.0L/461890.0L) + 1.0L/1847560.0L;
-        poly_val[1] = x*(-191.0L/5542680.0L*x + 23.0L/489060.0L) - 5.0L/415701.0L;
-        poly_val[2] = x*((775.0L/2217072.0L)*x - 815.0L/1662804.0L) + 5.0L/38896.0L;
-        poly_val[3] = x*(-615.0L/272272.0L*x + 445.0L/136136.0L) - 15.0L/17017.0L;
-        poly_val[4] = x*((1425.0L/136136.0L)*x - 535.0L/34034.0L) + 5.0L/1144.0L;
-        poly_val[5] = x*(-213.0L/5720.0L*x + 167.0L/2860.0L) - 12.0L/715.0L;
-        poly_val[6] = x*((153.0L/1430.0L)*x - 126.0L/715.0L) + 15.0L/286.0L;
-        poly_val[7] = x*(-75.0L/286.0L*x + 5.0L/11.0L) - 20.0L/143.0L;
-        poly_val[8] = x*((345.0L/572.0L)*x - 155.0L/143.0L) + 15.0L/44.0L;
-        poly_val[9] = x*(-75.0L/44.0L*x + 65.0L/22.0L) - 10.0L/11.0L;
-        poly_val[10] = x*((36.0L/11.0L)*x - 46.0L/11.0L);
-        poly_val[11] = x*(-36.0L/11.0L*x + 26.0L/11.0L) + 10.0L/11.0L;
-        poly_val[12] = x*((75.0L/44.0L)*x - 5.0L/11.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(-345.0L/572.0L*x + 35.0L/286.0L) + 20.0L/143.0L;
-        poly_val[14] = x*((75.0L/286.0L)*x - 10.0L/143.0L) - 15.0L/286.0L;
-        poly_val[15] = x*(-153.0L/1430.0L*x + 27.0L/715.0L) + 12.0L/715.0L;
-        poly_val[16] = x*((213.0L/5720.0L)*x - 23.0L/1430.0L) - 5.0L/1144.0L;
-        poly_val[17] = x*(-1425.0L/136136.0L*x + 355.0L/68068.0L) + 15.0L/17017.0L;
-        poly_val[18] = x*((615.0L/272272.0L)*x - 5.0L/4004.0L) - 5.0L/38896.0L;
-        poly_val[19] = x*(-775.0L/2217072.0L*x + 695.0L/3325608.0L) + 5.0L/415701.0L;
-        poly_val[20] = x*((191.0L/5542680.0L)*x - 7.0L/319770.0L) - 1.0L/1847560.0L;
-        poly_val[21] = x*(-3.0L/1847560.0L*x + 1.0L/923780.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = (3.0L/923780.0L)*x - 1.0L/461890.0L;
-        poly_val[1] = -191.0L/2771340.0L*x + 23.0L/489060.0L;
-        poly_val[2] = (775.0L/1108536.0L)*x - 815.0L/1662804.0L;
-        poly_val[3] = -615.0L/136136.0L*x + 445.0L/136136.0L;
-        poly_val[4] = (1425.0L/68068.0L)*x - 535.0L/34034.0L;
-        poly_val[5] = -213.0L/2860.0L*x + 167.0L/2860.0L;
-        poly_val[6] = (153.0L/715.0L)*x - 126.0L/715.0L;
-        poly_val[7] = -75.0L/143.0L*x + 5.0L/11.0L;
-        poly_val[8] = (345.0L/286.0L)*x - 155.0L/143.0L;
-        poly_val[9] = -75.0L/22.0L*x + 65.0L/22.0L;
-        poly_val[10] = (72.0L/11.0L)*x - 46.0L/11.0L;
-        poly_val[11] = -72.0L/11.0L*x + 26.0L/11.0L;
-        poly_val[12] = (75.0L/22.0L)*x - 5.0L/11.0L;
-        poly_val[13] = -345.0L/286.0L*x + 35.0L/286.0L;
-        poly_val[14] = (75.0L/143.0L)*x - 10.0L/143.0L;
-        poly_val[15] = -153.0L/715.0L*x + 27.0L/715.0L;
-        poly_val[16] = (213.0L/2860.0L)*x - 23.0L/1430.0L;
-        poly_val[17] = -1425.0L/68068.0L*x + 355.0L/68068.0L;
-        poly_val[18] = (615.0L/136136.0L)*x - 5.0L/4004.0L;
-        poly_val[19] = -775.0L/1108536.0L*x + 695.0L/3325608.0L;
-        poly_val[20] = (191.0L/2771340.0L)*x - 7.0L/319770.0L;
-        poly_val[21] = -3.0L/923780.0L*x + 1.0L/923780.0L;
+        evaluate_beta_polynomials<spline_polynomials<10, 1, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n10_m2(int deriv, double x, double *poly_val) {
+
+template void beta_n10_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n10_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<10, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.5696377925480092e-06, 3.306930809510789e-05, -0.00033215521960362, 0.0021167776551179913,
+         -0.009613110978657196, 0.03315268065268065, -0.09052447552447553, 0.20250582750582752,
+         -0.38607226107226106, 0.625, -0.813868632469823, 0.813868632469823,
+         -0.625, 0.38607226107226106, -0.20250582750582752, 0.09052447552447553,
+         -0.03315268065268065, 0.009613110978657196, -0.0021167776551179913, 0.00033215521960362,
+         -3.306930809510789e-05, 1.5696377925480092e-06},
+        {2.4356448505055316e-07, -5.643412506157604e-06, 6.292186939116763e-05, -0.0004500816935165675,
+         0.0023247935537851505, -0.009262820512820513, 0.029737762237762238, -0.0793997668997669,
+         0.17846736596736595, -0.2556818181818182, 0.13420704350763873, 0.13420704350763873,
+         -0.2556818181818182, 0.17846736596736595, -0.0793997668997669, 0.029737762237762238,
+         -0.009262820512820513, 0.0023247935537851505, -0.0004500816935165675, 6.292186939116763e-05,
+         -5.643412506157604e-06, 2.4356448505055316e-07},
+        {1.326073307497456e-06, -2.8021275441296082e-05, 0.00028259765666241416, -0.0018113123746001897,
+         0.008295713390251206, -0.02898892773892774, 0.08092657342657343, -0.18866550116550115,
+         0.3940850815850816, -0.8806818181818182, 1.4978434071440023, -1.4978434071440023,
+         0.8806818181818182, -0.3940850815850816, 0.18866550116550115, -0.08092657342657343,
+         0.02898892773892774, -0.008295713390251206, 0.0018113123746001897, -0.00028259765666241416,
+         2.8021275441296082e-05, -1.326073307497456e-06},
+        {-3.924094481370023e-07, 9.106271361173323e-06, -0.00010174883393085147, 0.0007300505429444505,
+         -0.0037884471970606425, 0.015208333333333334, -0.04948426573426573, 0.1358537296037296,
+         -0.32961829836829837, 0.7528409090909091, -0.5216489762992739, -0.5216489762992739,
+         0.7528409090909091, -0.32961829836829837, 0.1358537296037296, -0.04948426573426573,
+         0.015208333333333334, -0.0037884471970606425, 0.0007300505429444505, -0.00010174883393085147,
+         9.106271361173323e-06, -3.924094481370023e-07},
+        {-2.3341596484011343e-07, 4.9384871043797774e-06, -4.988971294037728e-05, 0.00032052949020517296,
+         -0.0014731089113967264, 0.005175189393939394, -0.014573863636363637, 0.03450976107226107,
+         -0.07439175407925408, 0.18110795454545456, -1.3235940622566367, 1.3235940622566367,
+         -0.18110795454545456, 0.07439175407925408, -0.03450976107226107, 0.014573863636363637,
+         -0.005175189393939394, 0.0014731089113967264, -0.00032052949020517296, 4.988971294037728e-05,
+         -4.9384871043797774e-06, 2.3341596484011343e-07},
+        {8.2879581718591e-08, -1.92385455865848e-06, 2.150459164576489e-05, -0.00015438252989132716,
+         0.0008018122021535887, -0.0032231570512820515, 0.010512456293706294, -0.029000946969696968,
+         0.07125036421911422, -0.17223011363636365, 0.622024303855591, 0.622024303855591,
+         -0.17223011363636365, 0.07125036421911422, -0.029000946969696968, 0.010512456293706294,
+         -0.0032231570512820515, 0.0008018122021535887, -0.00015438252989132716, 2.150459164576489e-05,
+         -1.92385455865848e-06, 8.2879581718591e-08}};
+};
+constexpr double spline_polynomials<10, 2, 0>::coefficients[6][22];
+
+template <>
+struct spline_polynomials<10, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-7.848188962740046e-06, 0.00016534654047553943, -0.0016607760980181, 0.010583888275589957,
+         -0.04806555489328598, 0.16576340326340328, -0.4526223776223776, 1.0125291375291374,
+         -1.9303613053613053, 3.125, -4.0693431623491145, 4.0693431623491145,
+         -3.125, 1.9303613053613053, -1.0125291375291374, 0.4526223776223776,
+         -0.16576340326340328, 0.04806555489328598, -0.010583888275589957, 0.0016607760980181,
+         -0.00016534654047553943, 7.848188962740046e-06},
+        {9.742579402022126e-07, -2.2573650024630417e-05, 0.00025168747756467054, -0.00180032677406627,
+         0.009299174215140602, -0.03705128205128205, 0.11895104895104895, -0.3175990675990676,
+         0.7138694638694638, -1.0227272727272727, 0.5368281740305549, 0.5368281740305549,
+         -1.0227272727272727, 0.7138694638694638, -0.3175990675990676, 0.11895104895104895,
+         -0.03705128205128205, 0.009299174215140602, -0.00180032677406627, 0.00025168747756467054,
+         -2.2573650024630417e-05, 9.742579402022126e-07},
+        {3.978219922492368e-06, -8.406382632388825e-05, 0.0008477929699872424, -0.005433937123800569,
+         0.024887140170753615, -0.08696678321678322, 0.24277972027972028, -0.5659965034965035,
+         1.1822552447552448, -2.6420454545454546, 4.493530221432007, -4.493530221432007,
+         2.6420454545454546, -1.1822552447552448, 0.5659965034965035, -0.24277972027972028,
+         0.08696678321678322, -0.024887140170753615, 0.005433937123800569, -0.0008477929699872424,
+         8.406382632388825e-05, -3.978219922492368e-06},
+        {-7.848188962740046e-07, 1.8212542722346645e-05, -0.00020349766786170295, 0.001460101085888901,
+         -0.007576894394121285, 0.030416666666666668, -0.09896853146853146, 0.2717074592074592,
+         -0.6592365967365967, 1.5056818181818181, -1.0432979525985477, -1.0432979525985477,
+         1.5056818181818181, -0.6592365967365967, 0.2717074592074592, -0.09896853146853146,
+         0.030416666666666668, -0.007576894394121285, 0.001460101085888901, -0.00020349766786170295,
+         1.8212542722346645e-05, -7.848188962740046e-07},
+        {-2.3341596484011343e-07, 4.9384871043797774e-06, -4.988971294037728e-05, 0.00032052949020517296,
+         -0.0014731089113967264, 0.005175189393939394, -0.014573863636363637, 0.03450976107226107,
+         -0.07439175407925408, 0.18110795454545456, -1.3235940622566367, 1.3235940622566367,
+         -0.18110795454545456, 0.07439175407925408, -0.03450976107226107, 0.014573863636363637,
+         -0.005175189393939394, 0.0014731089113967264, -0.00032052949020517296, 4.988971294037728e-05,
+         -4.9384871043797774e-06, 2.3341596484011343e-07}};
+};
+constexpr double spline_polynomials<10, 2, 1>::coefficients[5][22];
+
+template <>
+struct spline_polynomials<10, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-3.1392755850960184e-05, 0.0006613861619021577, -0.0066431043920724, 0.04233555310235983,
+         -0.19226221957314393, 0.6630536130536131, -1.8104895104895105, 4.05011655011655,
+         -7.721445221445221, 12.5, -16.277372649396458, 16.277372649396458,
+         -12.5, 7.721445221445221, -4.05011655011655, 1.8104895104895105,
+         -0.6630536130536131, 0.19226221957314393, -0.04233555310235983, 0.0066431043920724,
+         -0.0006613861619021577, 3.1392755850960184e-05},
+        {2.922773820606638e-06, -6.772095007389125e-05, 0.0007550624326940116, -0.00540098032219881,
+         0.027897522645421804, -0.11115384615384616, 0.35685314685314684, -0.9527972027972028,
+         2.1416083916083917, -3.0681818181818183, 1.610484522091665, 1.610484522091665,
+         -3.0681818181818183, 2.1416083916083917, -0.9527972027972028, 0.35685314685314684,
+         -0.11115384615384616, 0.027897522645421804, -0.00540098032219881, 0.0007550624326940116,
+         -6.772095007389125e-05, 2.922773820606638e-06},
+        {7.956439844984736e-06, -0.0001681276526477765, 0.0016955859399744849, -0.010867874247601139,
+         0.04977428034150723, -0.17393356643356644, 0.48555944055944056, -1.131993006993007,
+         2.3645104895104896, -5.284090909090909, 8.987060442864014, -8.987060442864014,
+         5.284090909090909, -2.3645104895104896, 1.131993006993007, -0.48555944055944056,
+         0.17393356643356644, -0.04977428034150723, 0.010867874247601139, -0.0016955859399744849,
+         0.0001681276526477765, -7.956439844984736e-06},
+        {-7.848188962740046e-07, 1.8212542722346645e-05, -0.00020349766786170295, 0.001460101085888901,
+         -0.007576894394121285, 0.030416666666666668, -0.09896853146853146, 0.2717074592074592,
+         -0.6592365967365967, 1.5056818181818181, -1.0432979525985477, -1.0432979525985477,
+         1.5056818181818181, -0.6592365967365967, 0.2717074592074592, -0.09896853146853146,
+         0.030416666666666668, -0.007576894394121285, 0.001460101085888901, -0.00020349766786170295,
+         1.8212542722346645e-05, -7.848188962740046e-07}};
+};
+constexpr double spline_polynomials<10, 2, 2>::coefficients[4][22];
+
+template <class real_number>
+void beta_n10_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(-29.0L/18475600.0L*x + 7.0L/1679600.0L) - 3.0L/972400.0L) - 1.0L/18475600.0L) + 1.0L/1847560.0L);
-        poly_val[1] = x*(x*(x*(x*((4499.0L/136047600.0L)*x - 5507.0L/62355150.0L) + 32893.0L/498841200.0L) + 5.0L/3741309.0L) - 5.0L/415701.0L);
-        poly_val[2] = x*(x*(x*(x*(-159065.0L/478887552.0L*x + 427795.0L/478887552.0L) - 24815.0L/36837504.0L) - 5.0L/311168.0L) + 5.0L/38896.0L);
-        poly_val[3] = x*(x*(x*(x*((32275.0L/15247232.0L)*x - 2575.0L/448448.0L) + 66795.0L/15247232.0L) + 15.0L/119119.0L) - 15.0L/17017.0L);
-        poly_val[4] = x*(x*(x*(x*(-54965.0L/5717712.0L*x + 2955.0L/112112.0L) - 38855.0L/1905904.0L) - 5.0L/6864.0L) + 5.0L/1144.0L);
-        poly_val[5] = x*(x*(x*(x*((5689.0L/171600.0L)*x - 3953.0L/42900.0L) + 12427.0L/171600.0L) + 12.0L/3575.0L) - 12.0L/715.0L);
-        poly_val[6] = x*(x*(x*(x*(-2589.0L/28600.0L*x + 7323.0L/28600.0L) - 5859.0L/28600.0L) - 15.0L/1144.0L) + 15.0L/286.0L);
-        poly_val[7] = x*(x*(x*(x*((695.0L/3432.0L)*x - 335.0L/572.0L) + 545.0L/1144.0L) + 20.0L/429.0L) - 20.0L/143.0L);
-        poly_val[8] = x*(x*(x*(x*(-1325.0L/3432.0L*x + 3925.0L/3432.0L) - 245.0L/264.0L) - 15.0L/88.0L) + 15.0L/44.0L);
-        poly_val[9] = x*(x*(x*(x*((5.0L/8.0L)*x - 20.0L/11.0L) + 105.0L/88.0L) + 10.0L/11.0L) - 10.0L/11.0L);
-        poly_val[10] = pow(x, 2)*(x*(x*(-11370461.0L/13970880.0L*x + 10100381.0L/4656960.0L) - 3749981.0L/4656960.0L) - 1968329.0L/1270080.0L) + 1;
-        poly_val[11] = x*(x*(x*(x*((11370461.0L/13970880.0L)*x - 1206871.0L/635040.0L) + 3749981.0L/13970880.0L) + 10.0L/11.0L) + 10.0L/11.0L);
-        poly_val[12] = x*(x*(x*(x*(-5.0L/8.0L*x + 115.0L/88.0L) - 15.0L/88.0L) - 15.0L/88.0L) - 15.0L/44.0L);
-        poly_val[13] = x*(x*(x*(x*((1325.0L/3432.0L)*x - 225.0L/286.0L) + 245.0L/1144.0L) + 20.0L/429.0L) + 20.0L/143.0L);
-        poly_val[14] = x*(x*(x*(x*(-695.0L/3432.0L*x + 1465.0L/3432.0L) - 545.0L/3432.0L) - 15.0L/1144.0L) - 15.0L/286.0L);
-        poly_val[15] = x*(x*(x*(x*((2589.0L/28600.0L)*x - 2811.0L/14300.0L) + 189.0L/2200.0L) + 12.0L/3575.0L) + 12.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*(-5689.0L/171600.0L*x + 4211.0L/57200.0L) - 2023.0L/57200.0L) - 5.0L/6864.0L) - 5.0L/1144.0L);
-        poly_val[17] = x*(x*(x*(x*((54965.0L/5717712.0L)*x - 15515.0L/714714.0L) + 63395.0L/5717712.0L) + 15.0L/119119.0L) + 15.0L/17017.0L);
-        poly_val[18] = x*(x*(x*(x*(-32275.0L/15247232.0L*x + 73825.0L/15247232.0L) - 39345.0L/15247232.0L) - 5.0L/311168.0L) - 5.0L/38896.0L);
-        poly_val[19] = x*(x*(x*(x*((159065.0L/478887552.0L)*x - 61255.0L/79814592.0L) + 3545.0L/8401536.0L) + 5.0L/3741309.0L) + 5.0L/415701.0L);
-        poly_val[20] = x*(x*(x*(x*(-4499.0L/136047600.0L*x + 6781.0L/88030800.0L) - 64897.0L/1496523600.0L) - 1.0L/18475600.0L) - 1.0L/1847560.0L);
-        poly_val[21] = pow(x, 3)*(x*((29.0L/18475600.0L)*x - 1.0L/271700.0L) + 3.0L/1421200.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(-29.0L/3695120.0L*x + 7.0L/419900.0L) - 9.0L/972400.0L) - 1.0L/9237800.0L) + 1.0L/1847560.0L;
-        poly_val[1] = x*(x*(x*((4499.0L/27209520.0L)*x - 11014.0L/31177575.0L) + 32893.0L/166280400.0L) + 10.0L/3741309.0L) - 5.0L/415701.0L;
-        poly_val[2] = x*(x*(x*(-795325.0L/478887552.0L*x + 427795.0L/119721888.0L) - 24815.0L/12279168.0L) - 5.0L/155584.0L) + 5.0L/38896.0L;
-        poly_val[3] = x*(x*(x*((161375.0L/15247232.0L)*x - 2575.0L/112112.0L) + 200385.0L/15247232.0L) + 30.0L/119119.0L) - 15.0L/17017.0L;
-        poly_val[4] = x*(x*(x*(-274825.0L/5717712.0L*x + 2955.0L/28028.0L) - 116565.0L/1905904.0L) - 5.0L/3432.0L) + 5.0L/1144.0L;
-        poly_val[5] = x*(x*(x*((5689.0L/34320.0L)*x - 3953.0L/10725.0L) + 12427.0L/57200.0L) + 24.0L/3575.0L) - 12.0L/715.0L;
-        poly_val[6] = x*(x*(x*(-2589.0L/5720.0L*x + 7323.0L/7150.0L) - 17577.0L/28600.0L) - 15.0L/572.0L) + 15.0L/286.0L;
-        poly_val[7] = x*(x*(x*((3475.0L/3432.0L)*x - 335.0L/143.0L) + 1635.0L/1144.0L) + 40.0L/429.0L) - 20.0L/143.0L;
-        poly_val[8] = x*(x*(x*(-6625.0L/3432.0L*x + 3925.0L/858.0L) - 245.0L/88.0L) - 15.0L/44.0L) + 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*((25.0L/8.0L)*x - 80.0L/11.0L) + 315.0L/88.0L) + 20.0L/11.0L) - 10.0L/11.0L;
-        poly_val[10] = x*(x*(x*(-11370461.0L/2794176.0L*x + 10100381.0L/1164240.0L) - 3749981.0L/1552320.0L) - 1968329.0L/635040.0L);
-        poly_val[11] = x*(x*(x*((11370461.0L/2794176.0L)*x - 1206871.0L/158760.0L) + 3749981.0L/4656960.0L) + 20.0L/11.0L) + 10.0L/11.0L;
-        poly_val[12] = x*(x*(x*(-25.0L/8.0L*x + 115.0L/22.0L) - 45.0L/88.0L) - 15.0L/44.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*((6625.0L/3432.0L)*x - 450.0L/143.0L) + 735.0L/1144.0L) + 40.0L/429.0L) + 20.0L/143.0L;
-        poly_val[14] = x*(x*(x*(-3475.0L/3432.0L*x + 1465.0L/858.0L) - 545.0L/1144.0L) - 15.0L/572.0L) - 15.0L/286.0L;
-        poly_val[15] = x*(x*(x*((2589.0L/5720.0L)*x - 2811.0L/3575.0L) + 567.0L/2200.0L) + 24.0L/3575.0L) + 12.0L/715.0L;
-        poly_val[16] = x*(x*(x*(-5689.0L/34320.0L*x + 4211.0L/14300.0L) - 6069.0L/57200.0L) - 5.0L/3432.0L) - 5.0L/1144.0L;
-        poly_val[17] = x*(x*(x*((274825.0L/5717712.0L)*x - 31030.0L/357357.0L) + 63395.0L/1905904.0L) + 30.0L/119119.0L) + 15.0L/17017.0L;
-        poly_val[18] = x*(x*(x*(-161375.0L/15247232.0L*x + 73825.0L/3811808.0L) - 118035.0L/15247232.0L) - 5.0L/155584.0L) - 5.0L/38896.0L;
-        poly_val[19] = x*(x*(x*((795325.0L/478887552.0L)*x - 61255.0L/19953648.0L) + 3545.0L/2800512.0L) + 10.0L/3741309.0L) + 5.0L/415701.0L;
-        poly_val[20] = x*(x*(x*(-4499.0L/27209520.0L*x + 6781.0L/22007700.0L) - 64897.0L/498841200.0L) - 1.0L/9237800.0L) - 1.0L/1847560.0L;
-        poly_val[21] = pow(x, 2)*(x*((29.0L/3695120.0L)*x - 1.0L/67925.0L) + 9.0L/1421200.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(-29.0L/923780.0L*x + 21.0L/419900.0L) - 9.0L/486200.0L) - 1.0L/9237800.0L;
-        poly_val[1] = x*(x*((4499.0L/6802380.0L)*x - 11014.0L/10392525.0L) + 32893.0L/83140200.0L) + 10.0L/3741309.0L;
-        poly_val[2] = x*(x*(-795325.0L/119721888.0L*x + 427795.0L/39907296.0L) - 24815.0L/6139584.0L) - 5.0L/155584.0L;
-        poly_val[3] = x*(x*((161375.0L/3811808.0L)*x - 7725.0L/112112.0L) + 200385.0L/7623616.0L) + 30.0L/119119.0L;
-        poly_val[4] = x*(x*(-274825.0L/1429428.0L*x + 8865.0L/28028.0L) - 116565.0L/952952.0L) - 5.0L/3432.0L;
-        poly_val[5] = x*(x*((5689.0L/8580.0L)*x - 3953.0L/3575.0L) + 12427.0L/28600.0L) + 24.0L/3575.0L;
-        poly_val[6] = x*(x*(-2589.0L/1430.0L*x + 21969.0L/7150.0L) - 17577.0L/14300.0L) - 15.0L/572.0L;
-        poly_val[7] = x*(x*((3475.0L/858.0L)*x - 1005.0L/143.0L) + 1635.0L/572.0L) + 40.0L/429.0L;
-        poly_val[8] = x*(x*(-6625.0L/858.0L*x + 3925.0L/286.0L) - 245.0L/44.0L) - 15.0L/44.0L;
-        poly_val[9] = x*(x*((25.0L/2.0L)*x - 240.0L/11.0L) + 315.0L/44.0L) + 20.0L/11.0L;
-        poly_val[10] = x*(x*(-11370461.0L/698544.0L*x + 10100381.0L/388080.0L) - 3749981.0L/776160.0L) - 1968329.0L/635040.0L;
-        poly_val[11] = x*(x*((11370461.0L/698544.0L)*x - 1206871.0L/52920.0L) + 3749981.0L/2328480.0L) + 20.0L/11.0L;
-        poly_val[12] = x*(x*(-25.0L/2.0L*x + 345.0L/22.0L) - 45.0L/44.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*((6625.0L/858.0L)*x - 1350.0L/143.0L) + 735.0L/572.0L) + 40.0L/429.0L;
-        poly_val[14] = x*(x*(-3475.0L/858.0L*x + 1465.0L/286.0L) - 545.0L/572.0L) - 15.0L/572.0L;
-        poly_val[15] = x*(x*((2589.0L/1430.0L)*x - 8433.0L/3575.0L) + 567.0L/1100.0L) + 24.0L/3575.0L;
-        poly_val[16] = x*(x*(-5689.0L/8580.0L*x + 12633.0L/14300.0L) - 6069.0L/28600.0L) - 5.0L/3432.0L;
-        poly_val[17] = x*(x*((274825.0L/1429428.0L)*x - 31030.0L/119119.0L) + 63395.0L/952952.0L) + 30.0L/119119.0L;
-        poly_val[18] = x*(x*(-161375.0L/3811808.0L*x + 221475.0L/3811808.0L) - 118035.0L/7623616.0L) - 5.0L/155584.0L;
-        poly_val[19] = x*(x*((795325.0L/119721888.0L)*x - 61255.0L/6651216.0L) + 3545.0L/1400256.0L) + 10.0L/3741309.0L;
-        poly_val[20] = x*(x*(-4499.0L/6802380.0L*x + 6781.0L/7335900.0L) - 64897.0L/249420600.0L) - 1.0L/9237800.0L;
-        poly_val[21] = x*(x*((29.0L/923780.0L)*x - 3.0L/67925.0L) + 9.0L/710600.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 2, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n10_m3(int deriv, double x, double *poly_val) {
+
+template void beta_n10_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n10_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<10, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {4.362636270991718e-06, -9.164547416657472e-05, 0.0009168618450324554, -0.005810387561525516,
+         0.026170160946727822, -0.08909884265315814, 0.2381044375597947, -0.5119909714403762,
+         0.9002992226578536, -1.3069501527462837, 1.573445194576147, -1.573445194576147,
+         1.3069501527462837, -0.9002992226578536, 0.5119909714403762, -0.2381044375597947,
+         0.08909884265315814, -0.026170160946727822, 0.005810387561525516, -0.0009168618450324554,
+         9.164547416657472e-05, -4.362636270991718e-06},
+        {-7.042593172439848e-08, 1.6241612223755081e-06, -1.7992347448801084e-05, 0.0001275145434371625,
+         -0.0006495166985144226, 0.0025302344673624436, -0.007804368746333032, 0.019192399586744825,
+         -0.03477805607641917, 0.039917895293639344, -0.018519663757758997, -0.018519663757758997,
+         0.039917895293639344, -0.03477805607641917, 0.019192399586744825, -0.007804368746333032,
+         0.0025302344673624436, -0.0006495166985144226, 0.0001275145434371625, -1.7992347448801084e-05,
+         1.6241612223755081e-06, -7.042593172439848e-08},
+        {-4.841614995791798e-06, 0.00010180341372003893, -0.0010198016033779616, 0.006474568326262128,
+         -0.029240731688703066, 0.09997681264254925, -0.26910280369432155, 0.5864990560861096,
+         -1.0612966780656512, 1.6052126145597128, -1.9939525284019333, 1.9939525284019333,
+         -1.6052126145597128, 1.0612966780656512, -0.5864990560861096, 0.26910280369432155,
+         -0.09997681264254925, 0.029240731688703066, -0.006474568326262128, 0.0010198016033779616,
+         -0.00010180341372003893, 4.841614995791798e-06},
+        {2.96383933843852e-07, -6.861533422939236e-06, 7.641612997776845e-05, -0.0005457176010944393,
+         0.0028119310776709675, -0.011160496363342345, 0.03559103879751201, -0.09379406658982552,
+         0.20455090802468034, -0.2856202396520477, 0.148096791325958, 0.148096791325958,
+         -0.2856202396520477, 0.20455090802468034, -0.09379406658982552, 0.03559103879751201,
+         -0.011160496363342345, 0.0028119310776709675, -0.0005457176010944393, 7.641612997776845e-05,
+         -6.861533422939236e-06, 2.96383933843852e-07},
+        {2.144067608308403e-06, -4.520480184752884e-05, 0.0004545092526059995, -0.002900760042386224,
+         0.013202618567762673, -0.04569496073639489, 0.12557115546903494, -0.2846638083105717,
+         0.5628911858334291, -1.1257349718217464, 1.79286438112703, -1.79286438112703,
+         1.1257349718217464, -0.5628911858334291, 0.2846638083105717, -0.12557115546903494,
+         0.04569496073639489, -0.013202618567762673, 0.002900760042386224, -0.0004545092526059995,
+         4.520480184752884e-05, -2.144067608308403e-06},
+        {-4.05614310335327e-07, 9.41080159036873e-06, -0.00010512239907750168, 0.0007539595198389184,
+         -0.003910231578032096, 0.015682752295963793, -0.05094758487420318, 0.13945230452624427,
+         -0.336139183882627, 0.7603255144584665, -0.5251214132538538, -0.5251214132538538,
+         0.7603255144584665, -0.336139183882627, 0.13945230452624427, -0.05094758487420318,
+         0.015682752295963793, -0.003910231578032096, 0.0007539595198389184, -0.00010512239907750168,
+         9.41080159036873e-06, -4.05614310335327e-07},
+        {-3.0158215657435903e-07, 6.370447638232507e-06, -6.42156792690094e-05, 0.00041131679585400916,
+         -0.0018820176761893488, 0.0065673588103949895, -0.018294245473235427, 0.04250962000101695,
+         -0.08845892943328304, 0.20152905068211524, -1.348179143421889, 1.348179143421889,
+         -0.20152905068211524, 0.08845892943328304, -0.04250962000101695, 0.018294245473235427,
+         -0.0065673588103949895, 0.0018820176761893488, -0.00041131679585400916, 6.42156792690094e-05,
+         -6.370447638232507e-06, 3.0158215657435903e-07},
+        {8.397998690178474e-08, -1.9492320777580976e-06, 2.178572207465241e-05, -0.00015637494463253282,
+         0.0008119609005678766, -0.0032626919648345892, 0.010634399555367748, -0.029300828213239857,
+         0.07179377134530827, -0.17285383075032676, 0.622313673601806, 0.622313673601806,
+         -0.17285383075032676, 0.07179377134530827, -0.029300828213239857, 0.010634399555367748,
+         -0.0032626919648345892, 0.0008119609005678766, -0.00015637494463253282, 2.178572207465241e-05,
+         -1.9492320777580976e-06, 8.397998690178474e-08}};
+};
+constexpr double spline_polynomials<10, 3, 0>::coefficients[8][22];
+
+template <>
+struct spline_polynomials<10, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.053845389694203e-05, -0.000641518319166023, 0.006418032915227188, -0.04067271293067862,
+         0.18319112662709477, -0.6236918985721069, 1.666731062918563, -3.5839368000826335,
+         6.302094558604975, -9.148651069223986, 11.014116362033029, -11.014116362033029,
+         9.148651069223986, -6.302094558604975, 3.5839368000826335, -1.666731062918563,
+         0.6236918985721069, -0.18319112662709477, 0.04067271293067862, -0.006418032915227188,
+         0.000641518319166023, -3.053845389694203e-05},
+        {-4.225555903463909e-07, 9.744967334253049e-06, -0.0001079540846928065, 0.0007650872606229749,
+         -0.0038971001910865356, 0.01518140680417466, -0.046826212477998196, 0.11515439752046895,
+         -0.20866833645851504, 0.23950737176183604, -0.11111798254655397, -0.11111798254655397,
+         0.23950737176183604, -0.20866833645851504, 0.11515439752046895, -0.046826212477998196,
+         0.01518140680417466, -0.0038971001910865356, 0.0007650872606229749, -0.0001079540846928065,
+         9.744967334253049e-06, -4.225555903463909e-07},
+        {-2.420807497895899e-05, 0.0005090170686001946, -0.005099008016889808, 0.03237284163131064,
+         -0.14620365844351532, 0.49988406321274625, -1.3455140184716077, 2.9324952804305484,
+         -5.306483390328256, 8.026063072798564, -9.969762642009666, 9.969762642009666,
+         -8.026063072798564, 5.306483390328256, -2.9324952804305484, 1.3455140184716077,
+         -0.49988406321274625, 0.14620365844351532, -0.03237284163131064, 0.005099008016889808,
+         -0.0005090170686001946, 2.420807497895899e-05},
+        {1.185535735375408e-06, -2.7446133691756943e-05, 0.0003056645199110738, -0.0021828704043777574,
+         0.01124772431068387, -0.04464198545336938, 0.14236415519004805, -0.37517626635930207,
+         0.8182036320987214, -1.1424809586081908, 0.592387165303832, 0.592387165303832,
+         -1.1424809586081908, 0.8182036320987214, -0.37517626635930207, 0.14236415519004805,
+         -0.04464198545336938, 0.01124772431068387, -0.0021828704043777574, 0.0003056645199110738,
+         -2.7446133691756943e-05, 1.185535735375408e-06},
+        {6.43220282492521e-06, -0.0001356144055425865, 0.0013635277578179987, -0.008702280127158672,
+         0.039607855703288015, -0.13708488220918466, 0.3767134664071048, -0.8539914249317151,
+         1.6886735575002874, -3.377204915465239, 5.37859314338109, -5.37859314338109,
+         3.377204915465239, -1.6886735575002874, 0.8539914249317151, -0.3767134664071048,
+         0.13708488220918466, -0.039607855703288015, 0.008702280127158672, -0.0013635277578179987,
+         0.0001356144055425865, -6.43220282492521e-06},
+        {-8.11228620670654e-07, 1.882160318073746e-05, -0.00021024479815500335, 0.001507919039677837,
+         -0.007820463156064193, 0.031365504591927586, -0.10189516974840636, 0.27890460905248854,
+         -0.672278367765254, 1.520651028916933, -1.0502428265077075, -1.0502428265077075,
+         1.520651028916933, -0.672278367765254, 0.27890460905248854, -0.10189516974840636,
+         0.031365504591927586, -0.007820463156064193, 0.001507919039677837, -0.00021024479815500335,
+         1.882160318073746e-05, -8.11228620670654e-07},
+        {-3.0158215657435903e-07, 6.370447638232507e-06, -6.42156792690094e-05, 0.00041131679585400916,
+         -0.0018820176761893488, 0.0065673588103949895, -0.018294245473235427, 0.04250962000101695,
+         -0.08845892943328304, 0.20152905068211524, -1.348179143421889, 1.348179143421889,
+         -0.20152905068211524, 0.08845892943328304, -0.04250962000101695, 0.018294245473235427,
+         -0.0065673588103949895, 0.0018820176761893488, -0.00041131679585400916, 6.42156792690094e-05,
+         -6.370447638232507e-06, 3.0158215657435903e-07}};
+};
+constexpr double spline_polynomials<10, 3, 1>::coefficients[7][22];
+
+template <>
+struct spline_polynomials<10, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.00018323072338165218, -0.0038491099149961377, 0.038508197491363125, -0.2440362775840717,
+         1.0991467597625686, -3.7421513914326416, 10.000386377511377, -21.5036208004958,
+         37.81256735162985, -54.89190641534392, 66.08469817219817, -66.08469817219817,
+         54.89190641534392, -37.81256735162985, 21.5036208004958, -10.000386377511377,
+         3.7421513914326416, -1.0991467597625686, 0.2440362775840717, -0.038508197491363125,
+         0.0038491099149961377, -0.00018323072338165218},
+        {-2.1127779517319543e-06, 4.8724836671265245e-05, -0.0005397704234640325, 0.0038254363031148745,
+         -0.019485500955432677, 0.0759070340208733, -0.23413106238999096, 0.5757719876023447,
+         -1.0433416822925752, 1.1975368588091801, -0.5555899127327699, -0.5555899127327699,
+         1.1975368588091801, -1.0433416822925752, 0.5757719876023447, -0.23413106238999096,
+         0.0759070340208733, -0.019485500955432677, 0.0038254363031148745, -0.0005397704234640325,
+         4.8724836671265245e-05, -2.1127779517319543e-06},
+        {-9.683229991583596e-05, 0.0020360682744007784, -0.02039603206755923, 0.12949136652524257,
+         -0.5848146337740613, 1.999536252850985, -5.382056073886431, 11.729981121722194,
+         -21.225933561313024, 32.10425229119426, -39.879050568038664, 39.879050568038664,
+         -32.10425229119426, 21.225933561313024, -11.729981121722194, 5.382056073886431,
+         -1.999536252850985, 0.5848146337740613, -0.12949136652524257, 0.02039603206755923,
+         -0.0020360682744007784, 9.683229991583596e-05},
+        {3.556607206126224e-06, -8.233840107527082e-05, 0.0009169935597332214, -0.006548611213133272,
+         0.03374317293205161, -0.13392595636010815, 0.42709246557014413, -1.1255287990779062,
+         2.454610896296164, -3.427442875824572, 1.7771614959114959, 1.7771614959114959,
+         -3.427442875824572, 2.454610896296164, -1.1255287990779062, 0.42709246557014413,
+         -0.13392595636010815, 0.03374317293205161, -0.006548611213133272, 0.0009169935597332214,
+         -8.233840107527082e-05, 3.556607206126224e-06},
+        {1.286440564985042e-05, -0.000271228811085173, 0.0027270555156359974, -0.017404560254317344,
+         0.07921571140657603, -0.2741697644183693, 0.7534269328142096, -1.7079828498634302,
+         3.3773471150005747, -6.754409830930478, 10.75718628676218, -10.75718628676218,
+         6.754409830930478, -3.3773471150005747, 1.7079828498634302, -0.7534269328142096,
+         0.2741697644183693, -0.07921571140657603, 0.017404560254317344, -0.0027270555156359974,
+         0.000271228811085173, -1.286440564985042e-05},
+        {-8.11228620670654e-07, 1.882160318073746e-05, -0.00021024479815500335, 0.001507919039677837,
+         -0.007820463156064193, 0.031365504591927586, -0.10189516974840636, 0.27890460905248854,
+         -0.672278367765254, 1.520651028916933, -1.0502428265077075, -1.0502428265077075,
+         1.520651028916933, -0.672278367765254, 0.27890460905248854, -0.10189516974840636,
+         0.031365504591927586, -0.007820463156064193, 0.001507919039677837, -0.00021024479815500335,
+         1.882160318073746e-05, -8.11228620670654e-07}};
+};
+constexpr double spline_polynomials<10, 3, 2>::coefficients[6][22];
+
+template <class real_number>
+void beta_n10_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*((51185699.0L/11732745024000.0L)*x - 4090369.0L/266653296000.0L) + 35733059.0L/1955457504000.0L) - 1072961.0L/154378224000.0L) - 514639.0L/617512896000.0L) - 1.0L/18475600.0L) + 1.0L/1847560.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-97750271.0L/1066613184000.0L*x + 3782441303.0L/11732745024000.0L) - 237253277.0L/617512896000.0L) + 18781351.0L/128931264000.0L) + 11419.0L/617512896.0L) + 5.0L/3741309.0L) - 5.0L/415701.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*((531225.0L/579394816.0L)*x - 75723343.0L/23465490048.0L) + 90288169.0L/23465490048.0L) - 1311199.0L/902518848.0L) - 487121.0L/2470051584.0L) - 5.0L/311168.0L) + 5.0L/38896.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(-14351957.0L/2470051584.0L*x + 5616313.0L/274450176.0L) - 20100053.0L/823350528.0L) + 22641695.0L/2470051584.0L) + 5663.0L/4200768.0L) + 15.0L/119119.0L) - 15.0L/17017.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*((129283295.0L/4940103168.0L)*x - 10356823.0L/112275072.0L) + 90651851.0L/823350528.0L) - 50656289.0L/1235025792.0L) - 1933049.0L/290594304.0L) - 5.0L/6864.0L) + 5.0L/1144.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(-294222911.0L/3302208000.0L*x + 346045183.0L/1100736000.0L) - 4545171157.0L/12108096000.0L) + 5019772789.0L/36324288000.0L) + 9587629.0L/378378000.0L) + 12.0L/3575.0L) - 12.0L/715.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*((720747847.0L/3027024000.0L)*x - 636560369.0L/756756000.0L) + 24128711.0L/24024000.0L) - 21109141.0L/58212000.0L) - 1888949.0L/24216192.0L) - 15.0L/1144.0L) + 15.0L/286.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(-37195415.0L/72648576.0L*x + 131578253.0L/72648576.0L) - 52283503.0L/24216192.0L) + 54623759.0L/72648576.0L) + 1827209.0L/9081072.0L) + 20.0L/429.0L) - 20.0L/143.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*((130810913.0L/145297152.0L)*x - 1428677.0L/448448.0L) + 91285561.0L/24216192.0L) - 6286355.0L/5189184.0L) - 1650809.0L/3725568.0L) - 15.0L/88.0L) + 15.0L/44.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(-1327945.0L/1016064.0L*x + 51572033.0L/11176704.0L) - 20028763.0L/3725568.0L) + 17535659.0L/11176704.0L) + 698249.0L/1397088.0L) + 10.0L/11.0L) - 10.0L/11.0L);
-        poly_val[10] = pow(x, 2)*(pow(x, 2)*(x*(x*((10991207.0L/6985440.0L)*x - 571831.0L/103488.0L) + 8832661.0L/1397088.0L) - 1271555.0L/698544.0L) - 1968329.0L/1270080.0L) + 1;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(-10991207.0L/6985440.0L*x + 6970883.0L/1270080.0L) - 43387097.0L/6985440.0L) + 1841911.0L/931392.0L) - 698249.0L/1397088.0L) + 10.0L/11.0L) + 10.0L/11.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*((1327945.0L/1016064.0L)*x - 4223311.0L/931392.0L) + 9568231.0L/1862784.0L) - 5143529.0L/2794176.0L) + 1650809.0L/3725568.0L) - 15.0L/88.0L) - 15.0L/44.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(-130810913.0L/145297152.0L*x + 452785043.0L/145297152.0L) - 24637831.0L/6918912.0L) + 197560625.0L/145297152.0L) - 1827209.0L/9081072.0L) + 20.0L/429.0L) + 20.0L/143.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*((37195415.0L/72648576.0L)*x - 10732471.0L/6054048.0L) + 24747451.0L/12108096.0L) - 1111433.0L/1397088.0L) + 1888949.0L/24216192.0L) - 15.0L/1144.0L) - 15.0L/286.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(-720747847.0L/3027024000.0L*x + 227181223.0L/275184000.0L) - 107350871.0L/112112000.0L) + 12483133.0L/33264000.0L) - 9587629.0L/378378000.0L) + 12.0L/3575.0L) + 12.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*((294222911.0L/3302208000.0L)*x - 255356207.0L/825552000.0L) + 2180676613.0L/6054048000.0L) - 1285312429.0L/9081072000.0L) + 1933049.0L/290594304.0L) - 5.0L/6864.0L) - 5.0L/1144.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*(-129283295.0L/4940103168.0L*x + 49920317.0L/548900352.0L) - 174886343.0L/1646701056.0L) + 206342519.0L/4940103168.0L) - 5663.0L/4200768.0L) + 15.0L/119119.0L) + 15.0L/17017.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*((14351957.0L/2470051584.0L)*x - 24958441.0L/1235025792.0L) + 9735059.0L/411675264.0L) - 5743835.0L/617512896.0L) + 487121.0L/2470051584.0L) - 5.0L/311168.0L) - 5.0L/38896.0L);
-        poly_val[19] = x*(x*(x*(x*(x*(x*(-531225.0L/579394816.0L*x + 149757889.0L/46930980096.0L) - 175509947.0L/46930980096.0L) + 31049.0L/21111552.0L) - 11419.0L/617512896.0L) + 5.0L/3741309.0L) + 5.0L/415701.0L);
-        poly_val[20] = x*(x*(x*(x*(x*(x*((97750271.0L/1066613184000.0L)*x - 936082391.0L/2933186256000.0L) + 16516831.0L/44108064000.0L) - 431798291.0L/2933186256000.0L) + 514639.0L/617512896000.0L) - 1.0L/18475600.0L) - 1.0L/1847560.0L);
-        poly_val[21] = pow(x, 4)*(x*(x*(-51185699.0L/11732745024000.0L*x + 59441219.0L/3910915008000.0L) - 69813539.0L/3910915008000.0L) + 82302659.0L/11732745024000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*((51185699.0L/1676106432000.0L)*x - 4090369.0L/44442216000.0L) + 35733059.0L/391091500800.0L) - 1072961.0L/38594556000.0L) - 514639.0L/205837632000.0L) - 1.0L/9237800.0L) + 1.0L/1847560.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(-97750271.0L/152373312000.0L*x + 3782441303.0L/1955457504000.0L) - 237253277.0L/123502579200.0L) + 18781351.0L/32232816000.0L) + 11419.0L/205837632.0L) + 10.0L/3741309.0L) - 5.0L/415701.0L;
-        poly_val[2] = x*(x*(x*(x*(x*((531225.0L/82770688.0L)*x - 75723343.0L/3910915008.0L) + 451440845.0L/23465490048.0L) - 1311199.0L/225629712.0L) - 487121.0L/823350528.0L) - 5.0L/155584.0L) + 5.0L/38896.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(-14351957.0L/352864512.0L*x + 5616313.0L/45741696.0L) - 100500265.0L/823350528.0L) + 22641695.0L/617512896.0L) + 5663.0L/1400256.0L) + 30.0L/119119.0L) - 15.0L/17017.0L;
-        poly_val[4] = x*(x*(x*(x*(x*((129283295.0L/705729024.0L)*x - 10356823.0L/18712512.0L) + 453259255.0L/823350528.0L) - 50656289.0L/308756448.0L) - 1933049.0L/96864768.0L) - 5.0L/3432.0L) + 5.0L/1144.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(-294222911.0L/471744000.0L*x + 346045183.0L/183456000.0L) - 4545171157.0L/2421619200.0L) + 5019772789.0L/9081072000.0L) + 9587629.0L/126126000.0L) + 24.0L/3575.0L) - 12.0L/715.0L;
-        poly_val[6] = x*(x*(x*(x*(x*((720747847.0L/432432000.0L)*x - 636560369.0L/126126000.0L) + 24128711.0L/4804800.0L) - 21109141.0L/14553000.0L) - 1888949.0L/8072064.0L) - 15.0L/572.0L) + 15.0L/286.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(-37195415.0L/10378368.0L*x + 131578253.0L/12108096.0L) - 261417515.0L/24216192.0L) + 54623759.0L/18162144.0L) + 1827209.0L/3027024.0L) + 40.0L/429.0L) - 20.0L/143.0L;
-        poly_val[8] = x*(x*(x*(x*(x*((130810913.0L/20756736.0L)*x - 4286031.0L/224224.0L) + 456427805.0L/24216192.0L) - 6286355.0L/1297296.0L) - 1650809.0L/1241856.0L) - 15.0L/44.0L) + 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(-1327945.0L/145152.0L*x + 51572033.0L/1862784.0L) - 100143815.0L/3725568.0L) + 17535659.0L/2794176.0L) + 698249.0L/465696.0L) + 20.0L/11.0L) - 10.0L/11.0L;
-        poly_val[10] = x*(pow(x, 2)*(x*(x*((10991207.0L/997920.0L)*x - 571831.0L/17248.0L) + 44163305.0L/1397088.0L) - 1271555.0L/174636.0L) - 1968329.0L/635040.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(-10991207.0L/997920.0L*x + 6970883.0L/211680.0L) - 43387097.0L/1397088.0L) + 1841911.0L/232848.0L) - 698249.0L/465696.0L) + 20.0L/11.0L) + 10.0L/11.0L;
-        poly_val[12] = x*(x*(x*(x*(x*((1327945.0L/145152.0L)*x - 4223311.0L/155232.0L) + 47841155.0L/1862784.0L) - 5143529.0L/698544.0L) + 1650809.0L/1241856.0L) - 15.0L/44.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(-130810913.0L/20756736.0L*x + 452785043.0L/24216192.0L) - 123189155.0L/6918912.0L) + 197560625.0L/36324288.0L) - 1827209.0L/3027024.0L) + 40.0L/429.0L) + 20.0L/143.0L;
-        poly_val[14] = x*(x*(x*(x*(x*((37195415.0L/10378368.0L)*x - 10732471.0L/1009008.0L) + 123737255.0L/12108096.0L) - 1111433.0L/349272.0L) + 1888949.0L/8072064.0L) - 15.0L/572.0L) - 15.0L/286.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(-720747847.0L/432432000.0L*x + 227181223.0L/45864000.0L) - 107350871.0L/22422400.0L) + 12483133.0L/8316000.0L) - 9587629.0L/126126000.0L) + 24.0L/3575.0L) + 12.0L/715.0L;
-        poly_val[16] = x*(x*(x*(x*(x*((294222911.0L/471744000.0L)*x - 255356207.0L/137592000.0L) + 2180676613.0L/1210809600.0L) - 1285312429.0L/2270268000.0L) + 1933049.0L/96864768.0L) - 5.0L/3432.0L) - 5.0L/1144.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(-129283295.0L/705729024.0L*x + 49920317.0L/91483392.0L) - 874431715.0L/1646701056.0L) + 206342519.0L/1235025792.0L) - 5663.0L/1400256.0L) + 30.0L/119119.0L) + 15.0L/17017.0L;
-        poly_val[18] = x*(x*(x*(x*(x*((14351957.0L/352864512.0L)*x - 24958441.0L/205837632.0L) + 48675295.0L/411675264.0L) - 5743835.0L/154378224.0L) + 487121.0L/823350528.0L) - 5.0L/155584.0L) - 5.0L/38896.0L;
-        poly_val[19] = x*(x*(x*(x*(x*(-531225.0L/82770688.0L*x + 149757889.0L/7821830016.0L) - 877549735.0L/46930980096.0L) + 31049.0L/5277888.0L) - 11419.0L/205837632.0L) + 10.0L/3741309.0L) + 5.0L/415701.0L;
-        poly_val[20] = x*(x*(x*(x*(x*((97750271.0L/152373312000.0L)*x - 936082391.0L/488864376000.0L) + 16516831.0L/8821612800.0L) - 431798291.0L/733296564000.0L) + 514639.0L/205837632000.0L) - 1.0L/9237800.0L) - 1.0L/1847560.0L;
-        poly_val[21] = pow(x, 3)*(x*(x*(-51185699.0L/1676106432000.0L*x + 59441219.0L/651819168000.0L) - 69813539.0L/782183001600.0L) + 82302659.0L/2933186256000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*((51185699.0L/279351072000.0L)*x - 4090369.0L/8888443200.0L) + 35733059.0L/97772875200.0L) - 1072961.0L/12864852000.0L) - 514639.0L/102918816000.0L) - 1.0L/9237800.0L;
-        poly_val[1] = x*(x*(x*(x*(-97750271.0L/25395552000.0L*x + 3782441303.0L/391091500800.0L) - 237253277.0L/30875644800.0L) + 18781351.0L/10744272000.0L) + 11419.0L/102918816.0L) + 10.0L/3741309.0L;
-        poly_val[2] = x*(x*(x*(x*((1593675.0L/41385344.0L)*x - 378616715.0L/3910915008.0L) + 451440845.0L/5866372512.0L) - 1311199.0L/75209904.0L) - 487121.0L/411675264.0L) - 5.0L/155584.0L;
-        poly_val[3] = x*(x*(x*(x*(-14351957.0L/58810752.0L*x + 28081565.0L/45741696.0L) - 100500265.0L/205837632.0L) + 22641695.0L/205837632.0L) + 5663.0L/700128.0L) + 30.0L/119119.0L;
-        poly_val[4] = x*(x*(x*(x*((129283295.0L/117621504.0L)*x - 51784115.0L/18712512.0L) + 453259255.0L/205837632.0L) - 50656289.0L/102918816.0L) - 1933049.0L/48432384.0L) - 5.0L/3432.0L;
-        poly_val[5] = x*(x*(x*(x*(-294222911.0L/78624000.0L*x + 346045183.0L/36691200.0L) - 4545171157.0L/605404800.0L) + 5019772789.0L/3027024000.0L) + 9587629.0L/63063000.0L) + 24.0L/3575.0L;
-        poly_val[6] = x*(x*(x*(x*((720747847.0L/72072000.0L)*x - 636560369.0L/25225200.0L) + 24128711.0L/1201200.0L) - 21109141.0L/4851000.0L) - 1888949.0L/4036032.0L) - 15.0L/572.0L;
-        poly_val[7] = x*(x*(x*(x*(-37195415.0L/1729728.0L*x + 657891265.0L/12108096.0L) - 261417515.0L/6054048.0L) + 54623759.0L/6054048.0L) + 1827209.0L/1513512.0L) + 40.0L/429.0L;
-        poly_val[8] = x*(x*(x*(x*((130810913.0L/3459456.0L)*x - 21430155.0L/224224.0L) + 456427805.0L/6054048.0L) - 6286355.0L/432432.0L) - 1650809.0L/620928.0L) - 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*(x*(-1327945.0L/24192.0L*x + 257860165.0L/1862784.0L) - 100143815.0L/931392.0L) + 17535659.0L/931392.0L) + 698249.0L/232848.0L) + 20.0L/11.0L;
-        poly_val[10] = pow(x, 2)*(x*(x*((10991207.0L/166320.0L)*x - 2859155.0L/17248.0L) + 44163305.0L/349272.0L) - 1271555.0L/58212.0L) - 1968329.0L/635040.0L;
-        poly_val[11] = x*(x*(x*(x*(-10991207.0L/166320.0L*x + 6970883.0L/42336.0L) - 43387097.0L/349272.0L) + 1841911.0L/77616.0L) - 698249.0L/232848.0L) + 20.0L/11.0L;
-        poly_val[12] = x*(x*(x*(x*((1327945.0L/24192.0L)*x - 21116555.0L/155232.0L) + 47841155.0L/465696.0L) - 5143529.0L/232848.0L) + 1650809.0L/620928.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*(x*(-130810913.0L/3459456.0L*x + 2263925215.0L/24216192.0L) - 123189155.0L/1729728.0L) + 197560625.0L/12108096.0L) - 1827209.0L/1513512.0L) + 40.0L/429.0L;
-        poly_val[14] = x*(x*(x*(x*((37195415.0L/1729728.0L)*x - 53662355.0L/1009008.0L) + 123737255.0L/3027024.0L) - 1111433.0L/116424.0L) + 1888949.0L/4036032.0L) - 15.0L/572.0L;
-        poly_val[15] = x*(x*(x*(x*(-720747847.0L/72072000.0L*x + 227181223.0L/9172800.0L) - 107350871.0L/5605600.0L) + 12483133.0L/2772000.0L) - 9587629.0L/63063000.0L) + 24.0L/3575.0L;
-        poly_val[16] = x*(x*(x*(x*((294222911.0L/78624000.0L)*x - 255356207.0L/27518400.0L) + 2180676613.0L/302702400.0L) - 1285312429.0L/756756000.0L) + 1933049.0L/48432384.0L) - 5.0L/3432.0L;
-        poly_val[17] = x*(x*(x*(x*(-129283295.0L/117621504.0L*x + 249601585.0L/91483392.0L) - 874431715.0L/411675264.0L) + 206342519.0L/411675264.0L) - 5663.0L/700128.0L) + 30.0L/119119.0L;
-        poly_val[18] = x*(x*(x*(x*((14351957.0L/58810752.0L)*x - 124792205.0L/205837632.0L) + 48675295.0L/102918816.0L) - 5743835.0L/51459408.0L) + 487121.0L/411675264.0L) - 5.0L/155584.0L;
-        poly_val[19] = x*(x*(x*(x*(-1593675.0L/41385344.0L*x + 748789445.0L/7821830016.0L) - 877549735.0L/11732745024.0L) + 31049.0L/1759296.0L) - 11419.0L/102918816.0L) + 10.0L/3741309.0L;
-        poly_val[20] = x*(x*(x*(x*((97750271.0L/25395552000.0L)*x - 936082391.0L/97772875200.0L) + 16516831.0L/2205403200.0L) - 431798291.0L/244432188000.0L) + 514639.0L/102918816000.0L) - 1.0L/9237800.0L;
-        poly_val[21] = pow(x, 2)*(x*(x*(-51185699.0L/279351072000.0L*x + 59441219.0L/130363833600.0L) - 69813539.0L/195545750400.0L) + 82302659.0L/977728752000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 3, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n10_m4(int deriv, double x, double *poly_val) {
+
+template void beta_n10_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n10_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<10, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.4048332999893888e-05, 0.00029501882890980123, -0.0029502391427344613, 0.018685284721972836,
+         -0.08408650933799014, 0.28590723749262936, -0.762468450084968, 1.6339968464534438,
+         -2.859756364437664, 4.131090928058934, -4.957543375582322, 4.957543375582322,
+         -4.131090928058934, 2.859756364437664, -1.6339968464534438, 0.762468450084968,
+         -0.28590723749262936, 0.08408650933799014, -0.018685284721972836, 0.0029502391427344613,
+         -0.00029501882890980123, 1.4048332999893888e-05},
+        {9.383613960313061e-09, -2.1472982952713733e-07, 2.3535228055861235e-06, -1.642817411703091e-05,
+         8.180245828690623e-05, -0.0003074209690405127, 0.000891912130528202, -0.0019621071673403025,
+         0.003107341819519399, -0.0031906320503790743, 0.0013933837759523937, 0.0013933837759523937,
+         -0.0031906320503790743, 0.003107341819519399, -0.0019621071673403025, 0.000891912130528202,
+         -0.0003074209690405127, 8.180245828690623e-05, -1.642817411703091e-05, 2.3535228055861235e-06,
+         -2.1472982952713733e-07, 9.383613960313061e-09},
+        {1.8410969270885604e-05, -0.00038666430307637595, 0.003867100987766917, -0.024495672283498353,
+         0.11025667028471796, -0.3750060801457875, 1.0005728876447626, -2.14598781789382,
+         3.7600555870955175, -5.438041080805218, 6.53098857015847, -6.53098857015847,
+         5.438041080805218, -3.7600555870955175, 2.14598781789382, -1.0005728876447626,
+         0.3750060801457875, -0.11025667028471796, 0.024495672283498353, -0.003867100987766917,
+         0.00038666430307637595, -1.8410969270885604e-05},
+        {-7.980954568471154e-08, 1.8388910519026454e-06, -2.0345870254387205e-05, 0.0001439427175541934,
+         -0.0007313191568013289, 0.0028376554364029564, -0.008696280876861234, 0.021154506754085128,
+         -0.03788539789593857, 0.04310852734401842, -0.01991304753371139, -0.01991304753371139,
+         0.04310852734401842, -0.03788539789593857, 0.021154506754085128, -0.008696280876861234,
+         0.0028376554364029564, -0.0007313191568013289, 0.0001439427175541934, -2.0345870254387205e-05,
+         1.8388910519026454e-06, -7.980954568471154e-08},
+        {-1.0109739870752005e-05, 0.00021243547456121438, -0.0021261412819033845, 0.013481550097001941,
+         -0.060773172690449365, 0.20719202670228526, -0.5550284724761845, 1.1992478735061511,
+         -2.133705314729775, 3.154371712581813, -3.853031294245304, 3.853031294245304,
+         -3.154371712581813, 2.133705314729775, -1.1992478735061511, 0.5550284724761845,
+         -0.20719202670228526, 0.060773172690449365, -0.013481550097001941, 0.0021261412819033845,
+         -0.00021243547456121438, 1.0109739870752005e-05},
+        {2.999027890789694e-07, -6.942057109011912e-06, 7.729870102986325e-05, -0.000551878166388326,
+         0.0028426069995285573, -0.011275779226732537, 0.035925505846460086, -0.09452985677757814,
+         0.20571616120700012, -0.2868167266709398, 0.14861931024194014, 0.14861931024194014,
+         -0.2868167266709398, 0.20571616120700012, -0.09452985677757814, 0.035925505846460086,
+         -0.011275779226732537, 0.0028426069995285573, -0.000551878166388326, 7.729870102986325e-05,
+         -6.942057109011912e-06, 2.999027890789694e-07},
+        {3.022088420801771e-06, -6.364347865439142e-05, 0.0006388991990269033, -0.004068590337509526,
+         0.018458025401387055, -0.06356416307968422, 0.17322543359934542, -0.38678861121391195,
+         0.7416259586107832, -1.3839281548254299, 2.102710842100925, -2.102710842100925,
+         1.3839281548254299, -0.7416259586107832, 0.38678861121391195, -0.17322543359934542,
+         0.06356416307968422, -0.018458025401387055, 0.004068590337509526, -0.0006388991990269033,
+         6.364347865439142e-05, -3.022088420801771e-06},
+        {-4.062007862078466e-07, 9.424222204714176e-06, -0.00010526949425285082, 0.0007549862807212329,
+         -0.003915344231675028, 0.015701966106528825, -0.05100332938236119, 0.13957493622420303,
+         -0.33633339274634694, 0.7605249289616152, -0.5252084997398507, -0.5252084997398507,
+         0.7605249289616152, -0.33633339274634694, 0.13957493622420303, -0.05100332938236119,
+         0.015701966106528825, -0.003915344231675028, 0.0007549862807212329, -0.00010526949425285082,
+         9.424222204714176e-06, -4.062007862078466e-07},
+        {-3.5645845735519455e-07, 7.5228649386614185e-06, -7.574005092031589e-05, 0.00048430618929921557,
+         -0.002210480603290873, 0.007684183956850573, -0.021272637856379836, 0.048892420182475714,
+         -0.09962985273186767, 0.21766612461984544, -1.3675445472327574, 1.3675445472327574,
+         -0.21766612461984544, 0.09962985273186767, -0.048892420182475714, 0.021272637856379836,
+         -0.007684183956850573, 0.002210480603290873, -0.00048430618929921557, 7.574005092031589e-05,
+         -7.5228649386614185e-06, 3.5645845735519455e-07},
+        {8.401664164381721e-08, -1.950070866154688e-06, 2.179491552311173e-05, -0.00015643911718767747,
+         0.0008122804414205598, -0.003263892827994904, 0.010637883587127623, -0.02930849269436228,
+         0.07180590939929077, -0.17286629415677354, 0.6223191165071809, 0.6223191165071809,
+         -0.17286629415677354, 0.07180590939929077, -0.02930849269436228, 0.010637883587127623,
+         -0.003263892827994904, 0.0008122804414205598, -0.00015643911718767747, 2.179491552311173e-05,
+         -1.950070866154688e-06, 8.401664164381721e-08}};
+};
+constexpr double spline_polynomials<10, 4, 0>::coefficients[10][22];
+
+template <>
+struct spline_polynomials<10, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00012643499699904498, 0.002655169460188211, -0.026552152284610154, 0.16816756249775552,
+         -0.7567785840419112, 2.5731651374336644, -6.862216050764712, 14.705971618080993,
+         -25.737807279938977, 37.179818352530404, -44.6178903802409, 44.6178903802409,
+         -37.179818352530404, 25.737807279938977, -14.705971618080993, 6.862216050764712,
+         -2.5731651374336644, 0.7567785840419112, -0.16816756249775552, 0.026552152284610154,
+         -0.002655169460188211, 0.00012643499699904498},
+        {7.506891168250449e-08, -1.7178386362170986e-06, 1.8828182444688988e-05, -0.00013142539293624727,
+         0.0006544196662952498, -0.0024593677523241015, 0.007135297044225616, -0.01569685733872242,
+         0.02485873455615519, -0.025525056403032594, 0.01114707020761915, 0.01114707020761915,
+         -0.025525056403032594, 0.02485873455615519, -0.01569685733872242, 0.007135297044225616,
+         -0.0024593677523241015, 0.0006544196662952498, -0.00013142539293624727, 1.8828182444688988e-05,
+         -1.7178386362170986e-06, 7.506891168250449e-08},
+        {0.00012887678489619924, -0.0027066501215346314, 0.027069706914368417, -0.17146970598448846,
+         0.7717966919930257, -2.6250425610205124, 7.004010213513339, -15.021914725256739,
+         26.320389109668625, -38.06628756563652, 45.716919991109286, -45.716919991109286,
+         38.06628756563652, -26.320389109668625, 15.021914725256739, -7.004010213513339,
+         2.6250425610205124, -0.7717966919930257, 0.17146970598448846, -0.027069706914368417,
+         0.0027066501215346314, -0.00012887678489619924},
+        {-4.788572741082692e-07, 1.1033346311415872e-05, -0.00012207522152632324, 0.0008636563053251604,
+         -0.004387914940807973, 0.017025932618417738, -0.0521776852611674, 0.12692704052451076,
+         -0.22731238737563142, 0.2586511640641105, -0.11947828520226833, -0.11947828520226833,
+         0.2586511640641105, -0.22731238737563142, 0.12692704052451076, -0.0521776852611674,
+         0.017025932618417738, -0.004387914940807973, 0.0008636563053251604, -0.00012207522152632324,
+         1.1033346311415872e-05, -4.788572741082692e-07},
+        {-5.054869935376003e-05, 0.001062177372806072, -0.010630706409516922, 0.06740775048500972,
+         -0.3038658634522468, 1.0359601335114264, -2.775142362380923, 5.996239367530755,
+         -10.668526573648876, 15.771858562909065, -19.265156471226522, 19.265156471226522,
+         -15.771858562909065, 10.668526573648876, -5.996239367530755, 2.775142362380923,
+         -1.0359601335114264, 0.3038658634522468, -0.06740775048500972, 0.010630706409516922,
+         -0.001062177372806072, 5.054869935376003e-05},
+        {1.1996111563158776e-06, -2.7768228436047648e-05, 0.000309194804119453, -0.002207512665553304,
+         0.011370427998114229, -0.04510311690693015, 0.14370202338584034, -0.37811942711031254,
+         0.8228646448280005, -1.1472669066837593, 0.5944772409677606, 0.5944772409677606,
+         -1.1472669066837593, 0.8228646448280005, -0.37811942711031254, 0.14370202338584034,
+         -0.04510311690693015, 0.011370427998114229, -0.002207512665553304, 0.000309194804119453,
+         -2.7768228436047648e-05, 1.1996111563158776e-06},
+        {9.066265262405314e-06, -0.00019093043596317424, 0.0019166975970807102, -0.01220577101252858,
+         0.05537407620416117, -0.19069248923905266, 0.5196763007980363, -1.1603658336417357,
+         2.2248778758323495, -4.15178446447629, 6.308132526302775, -6.308132526302775,
+         4.15178446447629, -2.2248778758323495, 1.1603658336417357, -0.5196763007980363,
+         0.19069248923905266, -0.05537407620416117, 0.01220577101252858, -0.0019166975970807102,
+         0.00019093043596317424, -9.066265262405314e-06},
+        {-8.124015724156932e-07, 1.884844440942835e-05, -0.00021053898850570163, 0.0015099725614424657,
+         -0.007830688463350057, 0.03140393221305765, -0.10200665876472238, 0.27914987244840606,
+         -0.6726667854926939, 1.5210498579232303, -1.0504169994797015, -1.0504169994797015,
+         1.5210498579232303, -0.6726667854926939, 0.27914987244840606, -0.10200665876472238,
+         0.03140393221305765, -0.007830688463350057, 0.0015099725614424657, -0.00021053898850570163,
+         1.884844440942835e-05, -8.124015724156932e-07},
+        {-3.5645845735519455e-07, 7.5228649386614185e-06, -7.574005092031589e-05, 0.00048430618929921557,
+         -0.002210480603290873, 0.007684183956850573, -0.021272637856379836, 0.048892420182475714,
+         -0.09962985273186767, 0.21766612461984544, -1.3675445472327574, 1.3675445472327574,
+         -0.21766612461984544, 0.09962985273186767, -0.048892420182475714, 0.021272637856379836,
+         -0.007684183956850573, 0.002210480603290873, -0.00048430618929921557, 7.574005092031589e-05,
+         -7.5228649386614185e-06, 3.5645845735519455e-07}};
+};
+constexpr double spline_polynomials<10, 4, 1>::coefficients[9][22];
+
+template <>
+struct spline_polynomials<10, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 22;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0010114799759923599, 0.02124135568150569, -0.21241721827688123, 1.3453404999820442,
+         -6.05422867233529, 20.585321099469315, -54.89772840611769, 117.64777294464794,
+         -205.90245823951182, 297.43854682024323, -356.9431230419272, 356.9431230419272,
+         -297.43854682024323, 205.90245823951182, -117.64777294464794, 54.89772840611769,
+         -20.585321099469315, 6.05422867233529, -1.3453404999820442, 0.21241721827688123,
+         -0.02124135568150569, 0.0010114799759923599},
+        {5.254823817775314e-07, -1.202487045351969e-05, 0.00013179727711282294, -0.0009199777505537309,
+         0.004580937664066749, -0.01721557426626871, 0.04994707930957931, -0.10987800137105692,
+         0.17401114189308634, -0.17867539482122816, 0.07802949145333404, 0.07802949145333404,
+         -0.17867539482122816, 0.17401114189308634, -0.10987800137105692, 0.04994707930957931,
+         -0.01721557426626871, 0.004580937664066749, -0.0009199777505537309, 0.00013179727711282294,
+         -1.202487045351969e-05, 5.254823817775314e-07},
+        {0.0007732607093771954, -0.01623990072920779, 0.1624182414862105, -1.0288182359069307,
+         4.630780151958154, -15.750255366123074, 42.02406128108003, -90.13148835154044,
+         157.92233465801175, -228.39772539381914, 274.30151994665573, -274.30151994665573,
+         228.39772539381914, -157.92233465801175, 90.13148835154044, -42.02406128108003,
+         15.750255366123074, -4.630780151958154, 1.0288182359069307, -0.1624182414862105,
+         0.01623990072920779, -0.0007732607093771954},
+        {-2.3942863705413464e-06, 5.5166731557079366e-05, -0.0006103761076316162, 0.004318281526625802,
+         -0.021939574704039864, 0.08512966309208869, -0.26088842630583703, 0.6346352026225538,
+         -1.1365619368781572, 1.2932558203205524, -0.5973914260113417, -0.5973914260113417,
+         1.2932558203205524, -1.1365619368781572, 0.6346352026225538, -0.26088842630583703,
+         0.08512966309208869, -0.021939574704039864, 0.004318281526625802, -0.0006103761076316162,
+         5.5166731557079366e-05, -2.3942863705413464e-06},
+        {-0.0002021947974150401, 0.004248709491224288, -0.04252282563806769, 0.26963100194003886,
+         -1.2154634538089872, 4.143840534045705, -11.100569449523691, 23.98495747012302,
+         -42.674106294595504, 63.08743425163626, -77.06062588490609, 77.06062588490609,
+         -63.08743425163626, 42.674106294595504, -23.98495747012302, 11.100569449523691,
+         -4.143840534045705, 1.2154634538089872, -0.26963100194003886, 0.04252282563806769,
+         -0.004248709491224288, 0.0002021947974150401},
+        {3.598833468947633e-06, -8.330468530814294e-05, 0.0009275844123583589, -0.006622537996659911,
+         0.034111283994342684, -0.13530935072079045, 0.43110607015752106, -1.1343582813309376,
+         2.4685939344840016, -3.441800720051278, 1.7834317229032817, 1.7834317229032817,
+         -3.441800720051278, 2.4685939344840016, -1.1343582813309376, 0.43110607015752106,
+         -0.13530935072079045, 0.034111283994342684, -0.006622537996659911, 0.0009275844123583589,
+         -8.330468530814294e-05, 3.598833468947633e-06},
+        {1.8132530524810628e-05, -0.0003818608719263485, 0.0038333951941614203, -0.02441154202505716,
+         0.11074815240832234, -0.3813849784781053, 1.0393526015960726, -2.3207316672834715,
+         4.449755751664699, -8.30356892895258, 12.61626505260555, -12.61626505260555,
+         8.30356892895258, -4.449755751664699, 2.3207316672834715, -1.0393526015960726,
+         0.3813849784781053, -0.11074815240832234, 0.02441154202505716, -0.0038333951941614203,
+         0.0003818608719263485, -1.8132530524810628e-05},
+        {-8.124015724156932e-07, 1.884844440942835e-05, -0.00021053898850570163, 0.0015099725614424657,
+         -0.007830688463350057, 0.03140393221305765, -0.10200665876472238, 0.27914987244840606,
+         -0.6726667854926939, 1.5210498579232303, -1.0504169994797015, -1.0504169994797015,
+         1.5210498579232303, -0.6726667854926939, 0.27914987244840606, -0.10200665876472238,
+         0.03140393221305765, -0.007830688463350057, 0.0015099725614424657, -0.00021053898850570163,
+         1.884844440942835e-05, -8.124015724156932e-07}};
+};
+constexpr double spline_polynomials<10, 4, 2>::coefficients[8][22];
+
+template <class real_number>
+void beta_n10_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-33637859.0L/2394437760000.0L*x + 1483649773.0L/23465490048000.0L) - 316964689.0L/2933186256000.0L) + 324820967.0L/3910915008000.0L) - 1736957.0L/72648576000.0L) + 514639.0L/6175128960000.0L) - 514639.0L/617512896000.0L) - 1.0L/18475600.0L) + 1.0L/1847560.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((311524262719.0L/1055947052160000.0L)*x - 701042962783.0L/527973526080000.0L) + 74885259587.0L/32998345380000.0L) - 70831176221.0L/40613348160000.0L) + 75682379687.0L/150849578880000.0L) - 11419.0L/5557616064.0L) + 11419.0L/617512896.0L) + 5.0L/3741309.0L) - 5.0L/415701.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-9968948243.0L/3379030566912.0L*x + 44868219719.0L/3379030566912.0L) - 12780882041.0L/563171761152.0L) + 29463096031.0L/1689515283456.0L) - 16937158895.0L/3379030566912.0L) + 487121.0L/19760412672.0L) - 487121.0L/2470051584.0L) - 5.0L/311168.0L) + 5.0L/38896.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((4795181.0L/256628736.0L)*x - 31958747.0L/380007936.0L) + 473385725.0L/3293402112.0L) - 41964919.0L/380007936.0L) + 6885539.0L/217147392.0L) - 809.0L/4200768.0L) + 5663.0L/4200768.0L) + 15.0L/119119.0L) - 15.0L/17017.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-356053741.0L/4234374144.0L*x + 11218117517.0L/29640619008.0L) - 684750301.0L/1058593536.0L) + 7363490045.0L/14820309504.0L) - 4223360627.0L/29640619008.0L) + 1933049.0L/1743565824.0L) - 1933049.0L/290594304.0L) - 5.0L/6864.0L) + 5.0L/1144.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((311561305079.0L/1089728640000.0L)*x - 140236087829.0L/108972864000.0L) + 39945615029.0L/18162144000.0L) - 184035443699.0L/108972864000.0L) + 105391706569.0L/217945728000.0L) - 9587629.0L/1891890000.0L) + 9587629.0L/378378000.0L) + 12.0L/3575.0L) - 12.0L/715.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-46160205953.0L/60540480000.0L*x + 5327562143.0L/1552320000.0L) - 3623292631.0L/617760000.0L) + 136260296441.0L/30270240000.0L) - 25964084431.0L/20180160000.0L) + 1888949.0L/96864768.0L) - 1888949.0L/24216192.0L) - 15.0L/1144.0L) + 15.0L/286.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((18499877.0L/11321856.0L)*x - 801489739.0L/108972864.0L) + 782601527.0L/62270208.0L) - 262586183.0L/27243216.0L) + 2398107605.0L/871782912.0L) - 1827209.0L/27243216.0L) + 1827209.0L/9081072.0L) + 20.0L/429.0L) - 20.0L/143.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-2493086731.0L/871782912.0L*x + 11221599217.0L/871782912.0L) - 399388835.0L/18162144.0L) + 7345256297.0L/435891456.0L) - 46195777.0L/9580032.0L) + 1650809.0L/7451136.0L) - 1650809.0L/3725568.0L) - 15.0L/88.0L) + 15.0L/44.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*((92343961.0L/22353408.0L)*x - 207809573.0L/11176704.0L) + 88727773.0L/2794176.0L) - 90615265.0L/3725568.0L) + 157144591.0L/22353408.0L) - 698249.0L/1397088.0L) + 698249.0L/1397088.0L) + 10.0L/11.0L) - 10.0L/11.0L);
-        poly_val[10] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-178100340673.0L/35925120000.0L*x + 1122102226711.0L/50295168000.0L) - 957933723511.0L/25147584000.0L) + 733946977711.0L/25147584000.0L) - 61475136673.0L/7185024000.0L) + 307869749.0L/466560000.0L) - 1968329.0L/1270080.0L) + 1;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*((178100340673.0L/35925120000.0L)*x - 1402452582211.0L/62868960000.0L) + 228012714673.0L/5987520000.0L) - 1836144861211.0L/62868960000.0L) + 2176770052711.0L/251475840000.0L) - 698249.0L/1397088.0L) - 698249.0L/1397088.0L) + 10.0L/11.0L) + 10.0L/11.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(-92343961.0L/22353408.0L*x + 415476503.0L/22353408.0L) - 59104301.0L/1862784.0L) + 272310167.0L/11176704.0L) - 161927825.0L/22353408.0L) + 1650809.0L/7451136.0L) + 1650809.0L/3725568.0L) - 15.0L/88.0L) - 15.0L/44.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*((2493086731.0L/871782912.0L)*x - 5608090681.0L/435891456.0L) + 683892595.0L/31135104.0L) - 7359321647.0L/435891456.0L) + 4364057777.0L/871782912.0L) - 1827209.0L/27243216.0L) - 1827209.0L/9081072.0L) + 20.0L/429.0L) + 20.0L/143.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(-18499877.0L/11321856.0L*x + 6408496849.0L/871782912.0L) - 1823789521.0L/145297152.0L) + 323680565.0L/33530112.0L) - 2484812989.0L/871782912.0L) + 1888949.0L/96864768.0L) + 1888949.0L/24216192.0L) - 15.0L/1144.0L) - 15.0L/286.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*((46160205953.0L/60540480000.0L)*x - 6922231.0L/2018016.0L) + 35465070353.0L/6054048000.0L) - 6820439797.0L/1513512000.0L) + 254905271.0L/192192000.0L) - 9587629.0L/1891890000.0L) - 9587629.0L/378378000.0L) + 12.0L/3575.0L) + 12.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(-311561305079.0L/1089728640000.0L*x + 107822374417.0L/83825280000.0L) - 299257107283.0L/136216080000.0L) + 70840342681.0L/41912640000.0L) - 41601700243.0L/83825280000.0L) + 1933049.0L/1743565824.0L) + 1933049.0L/290594304.0L) - 5.0L/6864.0L) - 5.0L/1144.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*((356053741.0L/4234374144.0L)*x - 5606634083.0L/14820309504.0L) + 399033563.0L/617512896.0L) - 7368194069.0L/14820309504.0L) + 5185445.0L/35582976.0L) - 809.0L/4200768.0L) - 5663.0L/4200768.0L) + 15.0L/119119.0L) + 15.0L/17017.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*(-4795181.0L/256628736.0L*x + 1661205589.0L/19760412672.0L) - 202694095.0L/1411458048.0L) + 40431847.0L/365933568.0L) - 639105469.0L/19760412672.0L) + 487121.0L/19760412672.0L) + 487121.0L/2470051584.0L) - 5.0L/311168.0L) - 5.0L/38896.0L);
-        poly_val[19] = x*(x*(x*(x*(x*(x*(x*(x*((9968948243.0L/3379030566912.0L)*x - 862544509.0L/64981357056.0L) + 38310835621.0L/1689515283456.0L) - 14738088485.0L/844757641728.0L) + 907279897.0L/177843714048.0L) - 11419.0L/5557616064.0L) - 11419.0L/617512896.0L) + 5.0L/3741309.0L) + 5.0L/415701.0L);
-        poly_val[20] = x*(x*(x*(x*(x*(x*(x*(x*(-311524262719.0L/1055947052160000.0L*x + 280326487781.0L/211189410432000.0L) - 5701224667.0L/2514159648000.0L) + 184231971829.0L/105594705216000.0L) - 107650576139.0L/211189410432000.0L) + 514639.0L/6175128960000.0L) + 514639.0L/617512896000.0L) - 1.0L/18475600.0L) - 1.0L/1847560.0L);
-        poly_val[21] = pow(x, 5)*(x*(x*(x*((33637859.0L/2394437760000.0L)*x - 3708023477.0L/58663725120000.0L) + 39104259.0L/362121760000.0L) - 4873971667.0L/58663725120000.0L) + 218919637.0L/9025188480000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-33637859.0L/266048640000.0L*x + 1483649773.0L/2933186256000.0L) - 316964689.0L/419026608000.0L) + 324820967.0L/651819168000.0L) - 1736957.0L/14529715200.0L) + 514639.0L/1543782240000.0L) - 514639.0L/205837632000.0L) - 1.0L/9237800.0L) + 1.0L/1847560.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*((311524262719.0L/117327450240000.0L)*x - 701042962783.0L/65996690760000.0L) + 74885259587.0L/4714049340000.0L) - 70831176221.0L/6768891360000.0L) + 75682379687.0L/30169915776000.0L) - 11419.0L/1389404016.0L) + 11419.0L/205837632.0L) + 10.0L/3741309.0L) - 5.0L/415701.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(-9968948243.0L/375447840768.0L*x + 44868219719.0L/422378820864.0L) - 12780882041.0L/80453108736.0L) + 29463096031.0L/281585880576.0L) - 84685794475.0L/3379030566912.0L) + 487121.0L/4940103168.0L) - 487121.0L/823350528.0L) - 5.0L/155584.0L) + 5.0L/38896.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*((4795181.0L/28514304.0L)*x - 31958747.0L/47500992.0L) + 473385725.0L/470486016.0L) - 41964919.0L/63334656.0L) + 34427695.0L/217147392.0L) - 809.0L/1050192.0L) + 5663.0L/1400256.0L) + 30.0L/119119.0L) - 15.0L/17017.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(-356053741.0L/470486016.0L*x + 11218117517.0L/3705077376.0L) - 684750301.0L/151227648.0L) + 7363490045.0L/2470051584.0L) - 21116803135.0L/29640619008.0L) + 1933049.0L/435891456.0L) - 1933049.0L/96864768.0L) - 5.0L/3432.0L) + 5.0L/1144.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*((311561305079.0L/121080960000.0L)*x - 140236087829.0L/13621608000.0L) + 39945615029.0L/2594592000.0L) - 184035443699.0L/18162144000.0L) + 105391706569.0L/43589145600.0L) - 9587629.0L/472972500.0L) + 9587629.0L/126126000.0L) + 24.0L/3575.0L) - 12.0L/715.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(-46160205953.0L/6726720000.0L*x + 5327562143.0L/194040000.0L) - 25363048417.0L/617760000.0L) + 136260296441.0L/5045040000.0L) - 25964084431.0L/4036032000.0L) + 1888949.0L/24216192.0L) - 1888949.0L/8072064.0L) - 15.0L/572.0L) + 15.0L/286.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*((18499877.0L/1257984.0L)*x - 801489739.0L/13621608.0L) + 782601527.0L/8895744.0L) - 262586183.0L/4540536.0L) + 11990538025.0L/871782912.0L) - 1827209.0L/6810804.0L) + 1827209.0L/3027024.0L) + 40.0L/429.0L) - 20.0L/143.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(-2493086731.0L/96864768.0L*x + 11221599217.0L/108972864.0L) - 399388835.0L/2594592.0L) + 7345256297.0L/72648576.0L) - 230978885.0L/9580032.0L) + 1650809.0L/1862784.0L) - 1650809.0L/1241856.0L) - 15.0L/44.0L) + 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*((92343961.0L/2483712.0L)*x - 207809573.0L/1397088.0L) + 88727773.0L/399168.0L) - 90615265.0L/620928.0L) + 785722955.0L/22353408.0L) - 698249.0L/349272.0L) + 698249.0L/465696.0L) + 20.0L/11.0L) - 10.0L/11.0L;
-        poly_val[10] = x*(pow(x, 2)*(x*(x*(x*(x*(-178100340673.0L/3991680000.0L*x + 1122102226711.0L/6286896000.0L) - 957933723511.0L/3592512000.0L) + 733946977711.0L/4191264000.0L) - 61475136673.0L/1437004800.0L) + 307869749.0L/116640000.0L) - 1968329.0L/635040.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*((178100340673.0L/3991680000.0L)*x - 1402452582211.0L/7858620000.0L) + 228012714673.0L/855360000.0L) - 1836144861211.0L/10478160000.0L) + 2176770052711.0L/50295168000.0L) - 698249.0L/349272.0L) - 698249.0L/465696.0L) + 20.0L/11.0L) + 10.0L/11.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(-92343961.0L/2483712.0L*x + 415476503.0L/2794176.0L) - 59104301.0L/266112.0L) + 272310167.0L/1862784.0L) - 809639125.0L/22353408.0L) + 1650809.0L/1862784.0L) + 1650809.0L/1241856.0L) - 15.0L/44.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*((2493086731.0L/96864768.0L)*x - 5608090681.0L/54486432.0L) + 683892595.0L/4447872.0L) - 7359321647.0L/72648576.0L) + 21820288885.0L/871782912.0L) - 1827209.0L/6810804.0L) - 1827209.0L/3027024.0L) + 40.0L/429.0L) + 20.0L/143.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(-18499877.0L/1257984.0L*x + 6408496849.0L/108972864.0L) - 1823789521.0L/20756736.0L) + 323680565.0L/5588352.0L) - 12424064945.0L/871782912.0L) + 1888949.0L/24216192.0L) + 1888949.0L/8072064.0L) - 15.0L/572.0L) - 15.0L/286.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*((46160205953.0L/6726720000.0L)*x - 6922231.0L/252252.0L) + 35465070353.0L/864864000.0L) - 6820439797.0L/252252000.0L) + 254905271.0L/38438400.0L) - 9587629.0L/472972500.0L) - 9587629.0L/126126000.0L) + 24.0L/3575.0L) + 12.0L/715.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(-311561305079.0L/121080960000.0L*x + 107822374417.0L/10478160000.0L) - 299257107283.0L/19459440000.0L) + 70840342681.0L/6985440000.0L) - 41601700243.0L/16765056000.0L) + 1933049.0L/435891456.0L) + 1933049.0L/96864768.0L) - 5.0L/3432.0L) - 5.0L/1144.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*((356053741.0L/470486016.0L)*x - 5606634083.0L/1852538688.0L) + 399033563.0L/88216128.0L) - 7368194069.0L/2470051584.0L) + 25927225.0L/35582976.0L) - 809.0L/1050192.0L) - 5663.0L/1400256.0L) + 30.0L/119119.0L) + 15.0L/17017.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(-4795181.0L/28514304.0L*x + 1661205589.0L/2470051584.0L) - 202694095.0L/201636864.0L) + 40431847.0L/60988928.0L) - 3195527345.0L/19760412672.0L) + 487121.0L/4940103168.0L) + 487121.0L/823350528.0L) - 5.0L/155584.0L) - 5.0L/38896.0L;
-        poly_val[19] = x*(x*(x*(x*(x*(x*(x*((9968948243.0L/375447840768.0L)*x - 862544509.0L/8122669632.0L) + 38310835621.0L/241359326208.0L) - 14738088485.0L/140792940288.0L) + 4536399485.0L/177843714048.0L) - 11419.0L/1389404016.0L) - 11419.0L/205837632.0L) + 10.0L/3741309.0L) + 5.0L/415701.0L;
-        poly_val[20] = x*(x*(x*(x*(x*(x*(x*(-311524262719.0L/117327450240000.0L*x + 280326487781.0L/26398676304000.0L) - 5701224667.0L/359165664000.0L) + 184231971829.0L/17599117536000.0L) - 107650576139.0L/42237882086400.0L) + 514639.0L/1543782240000.0L) + 514639.0L/205837632000.0L) - 1.0L/9237800.0L) - 1.0L/1847560.0L;
-        poly_val[21] = pow(x, 4)*(x*(x*(x*((33637859.0L/266048640000.0L)*x - 3708023477.0L/7332965640000.0L) + 39104259.0L/51731680000.0L) - 4873971667.0L/9777287520000.0L) + 218919637.0L/1805037696000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-33637859.0L/33256080000.0L*x + 1483649773.0L/419026608000.0L) - 316964689.0L/69837768000.0L) + 324820967.0L/130363833600.0L) - 1736957.0L/3632428800.0L) + 514639.0L/514594080000.0L) - 514639.0L/102918816000.0L) - 1.0L/9237800.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*((311524262719.0L/14665931280000.0L)*x - 701042962783.0L/9428098680000.0L) + 74885259587.0L/785674890000.0L) - 70831176221.0L/1353778272000.0L) + 75682379687.0L/7542478944000.0L) - 11419.0L/463134672.0L) + 11419.0L/102918816.0L) + 10.0L/3741309.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-9968948243.0L/46930980096.0L*x + 44868219719.0L/60339831552.0L) - 12780882041.0L/13408851456.0L) + 147315480155.0L/281585880576.0L) - 84685794475.0L/844757641728.0L) + 487121.0L/1646701056.0L) - 487121.0L/411675264.0L) - 5.0L/155584.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*((4795181.0L/3564288.0L)*x - 31958747.0L/6785856.0L) + 473385725.0L/78414336.0L) - 209824595.0L/63334656.0L) + 34427695.0L/54286848.0L) - 809.0L/350064.0L) + 5663.0L/700128.0L) + 30.0L/119119.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-356053741.0L/58810752.0L*x + 11218117517.0L/529296768.0L) - 684750301.0L/25204608.0L) + 36817450225.0L/2470051584.0L) - 21116803135.0L/7410154752.0L) + 1933049.0L/145297152.0L) - 1933049.0L/48432384.0L) - 5.0L/3432.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*((311561305079.0L/15135120000.0L)*x - 140236087829.0L/1945944000.0L) + 39945615029.0L/432432000.0L) - 184035443699.0L/3632428800.0L) + 105391706569.0L/10897286400.0L) - 9587629.0L/157657500.0L) + 9587629.0L/63063000.0L) + 24.0L/3575.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-46160205953.0L/840840000.0L*x + 5327562143.0L/27720000.0L) - 25363048417.0L/102960000.0L) + 136260296441.0L/1009008000.0L) - 25964084431.0L/1009008000.0L) + 1888949.0L/8072064.0L) - 1888949.0L/4036032.0L) - 15.0L/572.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*((18499877.0L/157248.0L)*x - 801489739.0L/1945944.0L) + 782601527.0L/1482624.0L) - 1312930915.0L/4540536.0L) + 11990538025.0L/217945728.0L) - 1827209.0L/2270268.0L) + 1827209.0L/1513512.0L) + 40.0L/429.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(-2493086731.0L/12108096.0L*x + 11221599217.0L/15567552.0L) - 399388835.0L/432432.0L) + 36726281485.0L/72648576.0L) - 230978885.0L/2395008.0L) + 1650809.0L/620928.0L) - 1650809.0L/620928.0L) - 15.0L/44.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*((92343961.0L/310464.0L)*x - 207809573.0L/199584.0L) + 88727773.0L/66528.0L) - 453076325.0L/620928.0L) + 785722955.0L/5588352.0L) - 698249.0L/116424.0L) + 698249.0L/232848.0L) + 20.0L/11.0L;
-        poly_val[10] = pow(x, 2)*(x*(x*(x*(x*(-178100340673.0L/498960000.0L*x + 1122102226711.0L/898128000.0L) - 957933723511.0L/598752000.0L) + 733946977711.0L/838252800.0L) - 61475136673.0L/359251200.0L) + 307869749.0L/38880000.0L) - 1968329.0L/635040.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*((178100340673.0L/498960000.0L)*x - 1402452582211.0L/1122660000.0L) + 228012714673.0L/142560000.0L) - 1836144861211.0L/2095632000.0L) + 2176770052711.0L/12573792000.0L) - 698249.0L/116424.0L) - 698249.0L/232848.0L) + 20.0L/11.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(-92343961.0L/310464.0L*x + 415476503.0L/399168.0L) - 59104301.0L/44352.0L) + 1361550835.0L/1862784.0L) - 809639125.0L/5588352.0L) + 1650809.0L/620928.0L) + 1650809.0L/620928.0L) - 15.0L/44.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*((2493086731.0L/12108096.0L)*x - 5608090681.0L/7783776.0L) + 683892595.0L/741312.0L) - 36796608235.0L/72648576.0L) + 21820288885.0L/217945728.0L) - 1827209.0L/2270268.0L) - 1827209.0L/1513512.0L) + 40.0L/429.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(-18499877.0L/157248.0L*x + 6408496849.0L/15567552.0L) - 1823789521.0L/3459456.0L) + 1618402825.0L/5588352.0L) - 12424064945.0L/217945728.0L) + 1888949.0L/8072064.0L) + 1888949.0L/4036032.0L) - 15.0L/572.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*((46160205953.0L/840840000.0L)*x - 6922231.0L/36036.0L) + 35465070353.0L/144144000.0L) - 6820439797.0L/50450400.0L) + 254905271.0L/9609600.0L) - 9587629.0L/157657500.0L) - 9587629.0L/63063000.0L) + 24.0L/3575.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(-311561305079.0L/15135120000.0L*x + 107822374417.0L/1496880000.0L) - 299257107283.0L/3243240000.0L) + 70840342681.0L/1397088000.0L) - 41601700243.0L/4191264000.0L) + 1933049.0L/145297152.0L) + 1933049.0L/48432384.0L) - 5.0L/3432.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*((356053741.0L/58810752.0L)*x - 5606634083.0L/264648384.0L) + 399033563.0L/14702688.0L) - 36840970345.0L/2470051584.0L) + 25927225.0L/8895744.0L) - 809.0L/350064.0L) - 5663.0L/700128.0L) + 30.0L/119119.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(-4795181.0L/3564288.0L*x + 1661205589.0L/352864512.0L) - 202694095.0L/33606144.0L) + 202159235.0L/60988928.0L) - 3195527345.0L/4940103168.0L) + 487121.0L/1646701056.0L) + 487121.0L/411675264.0L) - 5.0L/155584.0L;
-        poly_val[19] = x*(x*(x*(x*(x*(x*((9968948243.0L/46930980096.0L)*x - 862544509.0L/1160381376.0L) + 38310835621.0L/40226554368.0L) - 73690442425.0L/140792940288.0L) + 4536399485.0L/44460928512.0L) - 11419.0L/463134672.0L) - 11419.0L/102918816.0L) + 10.0L/3741309.0L;
-        poly_val[20] = x*(x*(x*(x*(x*(x*(-311524262719.0L/14665931280000.0L*x + 280326487781.0L/3771239472000.0L) - 5701224667.0L/59860944000.0L) + 184231971829.0L/3519823507200.0L) - 107650576139.0L/10559470521600.0L) + 514639.0L/514594080000.0L) + 514639.0L/102918816000.0L) - 1.0L/9237800.0L;
-        poly_val[21] = pow(x, 3)*(x*(x*(x*((33637859.0L/33256080000.0L)*x - 3708023477.0L/1047566520000.0L) + 117312777.0L/25865840000.0L) - 4873971667.0L/1955457504000.0L) + 218919637.0L/451259424000.0L);
+        evaluate_beta_polynomials<spline_polynomials<10, 4, 2>>(x, poly_val);
         break;
     }
 }
+
+template void beta_n10_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n10_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
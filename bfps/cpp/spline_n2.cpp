@@ -25,160 +25,392 @@
 
 
 #include "spline_n2.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n2_m0(int deriv, double x, double *poly_val)
+template <>
+struct spline_polynomials<2, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, -1.0, 1.0,
+         0, 0},
+        {0, 0, 0.5, 0.5,
+         0, 0}};
+};
+constexpr double spline_polynomials<2, 0, 0>::coefficients[2][6];
+
+template <>
+struct spline_polynomials<2, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, -1.0, 1.0,
+         0, 0}};
+};
+constexpr double spline_polynomials<2, 0, 1>::coefficients[1][6];
+
+template <>
+struct spline_polynomials<2, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<2, 0, 2>::coefficients[1][6];
+
+template <class real_number>
+void beta_n2_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = -x + 1;
-        poly_val[3] = x;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
+        evaluate_beta_polynomials<spline_polynomials<2, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = -1;
-        poly_val[3] = 1;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
+        evaluate_beta_polynomials<spline_polynomials<2, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
+        evaluate_beta_polynomials<spline_polynomials<2, 0, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n2_m1(int deriv, double x, double *poly_val)
+template void beta_n2_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n2_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<2, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.08333333333333333, -0.5833333333333334, 1.3333333333333333, -1.3333333333333333,
+         0.5833333333333334, -0.08333333333333333},
+        {-0.041666666666666664, 0.375, -0.3333333333333333, -0.3333333333333333,
+         0.375, -0.041666666666666664},
+        {-0.020833333333333332, 0.14583333333333334, -1.3333333333333333, 1.3333333333333333,
+         -0.14583333333333334, 0.020833333333333332},
+        {0.010416666666666666, -0.09375, 0.5833333333333334, 0.5833333333333334,
+         -0.09375, 0.010416666666666666}};
+};
+constexpr double spline_polynomials<2, 1, 0>::coefficients[4][6];
+
+template <>
+struct spline_polynomials<2, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.25, -1.75, 4.0, -4.0,
+         1.75, -0.25},
+        {-0.08333333333333333, 0.75, -0.6666666666666666, -0.6666666666666666,
+         0.75, -0.08333333333333333},
+        {-0.020833333333333332, 0.14583333333333334, -1.3333333333333333, 1.3333333333333333,
+         -0.14583333333333334, 0.020833333333333332}};
+};
+constexpr double spline_polynomials<2, 1, 1>::coefficients[3][6];
+
+template <>
+struct spline_polynomials<2, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.5, -3.5, 8.0, -8.0,
+         3.5, -0.5},
+        {-0.08333333333333333, 0.75, -0.6666666666666666, -0.6666666666666666,
+         0.75, -0.08333333333333333}};
+};
+constexpr double spline_polynomials<2, 1, 2>::coefficients[2][6];
+
+template <class real_number>
+void beta_n2_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*((1.0L/12.0L)*x - 1.0L/6.0L) + 1.0L/12.0L);
-        poly_val[1] = x*(x*(-7.0L/12.0L*x + 5.0L/4.0L) - 2.0L/3.0L);
-        poly_val[2] = pow(x, 2)*((4.0L/3.0L)*x - 7.0L/3.0L) + 1;
-        poly_val[3] = x*(x*(-4.0L/3.0L*x + 5.0L/3.0L) + 2.0L/3.0L);
-        poly_val[4] = x*(x*((7.0L/12.0L)*x - 1.0L/2.0L) - 1.0L/12.0L);
-        poly_val[5] = pow(x, 2)*(-1.0L/12.0L*x + 1.0L/12.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*((1.0L/4.0L)*x - 1.0L/3.0L) + 1.0L/12.0L;
-        poly_val[1] = x*(-7.0L/4.0L*x + 5.0L/2.0L) - 2.0L/3.0L;
-        poly_val[2] = x*(4*x - 14.0L/3.0L);
-        poly_val[3] = x*(-4*x + 10.0L/3.0L) + 2.0L/3.0L;
-        poly_val[4] = x*((7.0L/4.0L)*x - 1) - 1.0L/12.0L;
-        poly_val[5] = x*(-1.0L/4.0L*x + 1.0L/6.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = (1.0L/2.0L)*x - 1.0L/3.0L;
-        poly_val[1] = -7.0L/2.0L*x + 5.0L/2.0L;
-        poly_val[2] = 8*x - 14.0L/3.0L;
-        poly_val[3] = -8*x + 10.0L/3.0L;
-        poly_val[4] = (7.0L/2.0L)*x - 1;
-        poly_val[5] = -1.0L/2.0L*x + 1.0L/6.0L;
+        evaluate_beta_polynomials<spline_polynomials<2, 1, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n2_m2(int deriv, double x, double *poly_val)
+template void beta_n2_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n2_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<2, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.20833333333333334, 1.0416666666666667, -2.0833333333333335, 2.0833333333333335,
+         -1.0416666666666667, 0.20833333333333334},
+        {0.020833333333333332, -0.0625, 0.041666666666666664, 0.041666666666666664,
+         -0.0625, 0.020833333333333332},
+        {0.1875, -1.1041666666666667, 2.375, -2.375,
+         1.1041666666666667, -0.1875},
+        {-0.052083333333333336, 0.40625, -0.3541666666666667, -0.3541666666666667,
+         0.40625, -0.052083333333333336},
+        {-0.033854166666666664, 0.2109375, -1.4635416666666667, 1.4635416666666667,
+         -0.2109375, 0.033854166666666664},
+        {0.01171875, -0.09765625, 0.5859375, 0.5859375,
+         -0.09765625, 0.01171875}};
+};
+constexpr double spline_polynomials<2, 2, 0>::coefficients[6][6];
+
+template <>
+struct spline_polynomials<2, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.0416666666666667, 5.208333333333333, -10.416666666666666, 10.416666666666666,
+         -5.208333333333333, 1.0416666666666667},
+        {0.08333333333333333, -0.25, 0.16666666666666666, 0.16666666666666666,
+         -0.25, 0.08333333333333333},
+        {0.5625, -3.3125, 7.125, -7.125,
+         3.3125, -0.5625},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667},
+        {-0.033854166666666664, 0.2109375, -1.4635416666666667, 1.4635416666666667,
+         -0.2109375, 0.033854166666666664}};
+};
+constexpr double spline_polynomials<2, 2, 1>::coefficients[5][6];
+
+template <>
+struct spline_polynomials<2, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4.166666666666667, 20.833333333333332, -41.666666666666664, 41.666666666666664,
+         -20.833333333333332, 4.166666666666667},
+        {0.25, -0.75, 0.5, 0.5,
+         -0.75, 0.25},
+        {1.125, -6.625, 14.25, -14.25,
+         6.625, -1.125},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667}};
+};
+constexpr double spline_polynomials<2, 2, 2>::coefficients[4][6];
+
+template <class real_number>
+void beta_n2_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(-5.0L/24.0L*x + 13.0L/24.0L) - 3.0L/8.0L) - 1.0L/24.0L) + 1.0L/12.0L);
-        poly_val[1] = x*(x*(x*(x*((25.0L/24.0L)*x - 8.0L/3.0L) + 13.0L/8.0L) + 2.0L/3.0L) - 2.0L/3.0L);
-        poly_val[2] = pow(x, 2)*(x*(x*(-25.0L/12.0L*x + 21.0L/4.0L) - 35.0L/12.0L) - 5.0L/4.0L) + 1;
-        poly_val[3] = x*(x*(x*(x*((25.0L/12.0L)*x - 31.0L/6.0L) + 11.0L/4.0L) + 2.0L/3.0L) + 2.0L/3.0L);
-        poly_val[4] = x*(x*(x*(x*(-25.0L/24.0L*x + 61.0L/24.0L) - 11.0L/8.0L) - 1.0L/24.0L) - 1.0L/12.0L);
-        poly_val[5] = pow(x, 3)*(x*((5.0L/24.0L)*x - 1.0L/2.0L) + 7.0L/24.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(-25.0L/24.0L*x + 13.0L/6.0L) - 9.0L/8.0L) - 1.0L/12.0L) + 1.0L/12.0L;
-        poly_val[1] = x*(x*(x*((125.0L/24.0L)*x - 32.0L/3.0L) + 39.0L/8.0L) + 4.0L/3.0L) - 2.0L/3.0L;
-        poly_val[2] = x*(x*(x*(-125.0L/12.0L*x + 21) - 35.0L/4.0L) - 5.0L/2.0L);
-        poly_val[3] = x*(x*(x*((125.0L/12.0L)*x - 62.0L/3.0L) + 33.0L/4.0L) + 4.0L/3.0L) + 2.0L/3.0L;
-        poly_val[4] = x*(x*(x*(-125.0L/24.0L*x + 61.0L/6.0L) - 33.0L/8.0L) - 1.0L/12.0L) - 1.0L/12.0L;
-        poly_val[5] = pow(x, 2)*(x*((25.0L/24.0L)*x - 2) + 7.0L/8.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(-25.0L/6.0L*x + 13.0L/2.0L) - 9.0L/4.0L) - 1.0L/12.0L;
-        poly_val[1] = x*(x*((125.0L/6.0L)*x - 32) + 39.0L/4.0L) + 4.0L/3.0L;
-        poly_val[2] = x*(x*(-125.0L/3.0L*x + 63) - 35.0L/2.0L) - 5.0L/2.0L;
-        poly_val[3] = x*(x*((125.0L/3.0L)*x - 62) + 33.0L/2.0L) + 4.0L/3.0L;
-        poly_val[4] = x*(x*(-125.0L/6.0L*x + 61.0L/2.0L) - 33.0L/4.0L) - 1.0L/12.0L;
-        poly_val[5] = x*(x*((25.0L/6.0L)*x - 6) + 7.0L/4.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 2, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n2_m3(int deriv, double x, double *poly_val)
+template void beta_n2_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n2_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<2, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.5833333333333334, -2.9166666666666665, 5.833333333333333, -5.833333333333333,
+         2.9166666666666665, -0.5833333333333334},
+        {0, 0, 0, 0,
+         0, 0},
+        {-0.6458333333333334, 3.2291666666666665, -6.458333333333333, 6.458333333333333,
+         -3.2291666666666665, 0.6458333333333334},
+        {0.020833333333333332, -0.0625, 0.041666666666666664, 0.041666666666666664,
+         -0.0625, 0.020833333333333332},
+        {0.296875, -1.6510416666666667, 3.46875, -3.46875,
+         1.6510416666666667, -0.296875},
+        {-0.052083333333333336, 0.40625, -0.3541666666666667, -0.3541666666666667,
+         0.40625, -0.052083333333333336},
+        {-0.04296875, 0.2565104166666667, -1.5546875, 1.5546875,
+         -0.2565104166666667, 0.04296875},
+        {0.01171875, -0.09765625, 0.5859375, 0.5859375,
+         -0.09765625, 0.01171875}};
+};
+constexpr double spline_polynomials<2, 3, 0>::coefficients[8][6];
+
+template <>
+struct spline_polynomials<2, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {4.083333333333333, -20.416666666666668, 40.833333333333336, -40.833333333333336,
+         20.416666666666668, -4.083333333333333},
+        {0, 0, 0, 0,
+         0, 0},
+        {-3.2291666666666665, 16.145833333333332, -32.291666666666664, 32.291666666666664,
+         -16.145833333333332, 3.2291666666666665},
+        {0.08333333333333333, -0.25, 0.16666666666666666, 0.16666666666666666,
+         -0.25, 0.08333333333333333},
+        {0.890625, -4.953125, 10.40625, -10.40625,
+         4.953125, -0.890625},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667},
+        {-0.04296875, 0.2565104166666667, -1.5546875, 1.5546875,
+         -0.2565104166666667, 0.04296875}};
+};
+constexpr double spline_polynomials<2, 3, 1>::coefficients[7][6];
+
+template <>
+struct spline_polynomials<2, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {24.5, -122.5, 245.0, -245.0,
+         122.5, -24.5},
+        {0, 0, 0, 0,
+         0, 0},
+        {-12.916666666666666, 64.58333333333333, -129.16666666666666, 129.16666666666666,
+         -64.58333333333333, 12.916666666666666},
+        {0.25, -0.75, 0.5, 0.5,
+         -0.75, 0.25},
+        {1.78125, -9.90625, 20.8125, -20.8125,
+         9.90625, -1.78125},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667}};
+};
+constexpr double spline_polynomials<2, 3, 2>::coefficients[6][6];
+
+template <class real_number>
+void beta_n2_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*((7.0L/12.0L)*x - 49.0L/24.0L) + 29.0L/12.0L) - 11.0L/12.0L) - 1.0L/12.0L) - 1.0L/24.0L) + 1.0L/12.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-35.0L/12.0L*x + 245.0L/24.0L) - 145.0L/12.0L) + 37.0L/8.0L) + 1.0L/6.0L) + 2.0L/3.0L) - 2.0L/3.0L);
-        poly_val[2] = pow(x, 2)*(pow(x, 2)*(x*(x*((35.0L/6.0L)*x - 245.0L/12.0L) + 145.0L/6.0L) - 28.0L/3.0L) - 5.0L/4.0L) + 1;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(-35.0L/6.0L*x + 245.0L/12.0L) - 145.0L/6.0L) + 113.0L/12.0L) - 1.0L/6.0L) + 2.0L/3.0L) + 2.0L/3.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*((35.0L/12.0L)*x - 245.0L/24.0L) + 145.0L/12.0L) - 19.0L/4.0L) + 1.0L/12.0L) - 1.0L/24.0L) - 1.0L/12.0L);
-        poly_val[5] = pow(x, 4)*(x*(x*(-7.0L/12.0L*x + 49.0L/24.0L) - 29.0L/12.0L) + 23.0L/24.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*((49.0L/12.0L)*x - 49.0L/4.0L) + 145.0L/12.0L) - 11.0L/3.0L) - 1.0L/4.0L) - 1.0L/12.0L) + 1.0L/12.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(-245.0L/12.0L*x + 245.0L/4.0L) - 725.0L/12.0L) + 37.0L/2.0L) + 1.0L/2.0L) + 4.0L/3.0L) - 2.0L/3.0L;
-        poly_val[2] = x*(pow(x, 2)*(x*(x*((245.0L/6.0L)*x - 245.0L/2.0L) + 725.0L/6.0L) - 112.0L/3.0L) - 5.0L/2.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(-245.0L/6.0L*x + 245.0L/2.0L) - 725.0L/6.0L) + 113.0L/3.0L) - 1.0L/2.0L) + 4.0L/3.0L) + 2.0L/3.0L;
-        poly_val[4] = x*(x*(x*(x*(x*((245.0L/12.0L)*x - 245.0L/4.0L) + 725.0L/12.0L) - 19) + 1.0L/4.0L) - 1.0L/12.0L) - 1.0L/12.0L;
-        poly_val[5] = pow(x, 3)*(x*(x*(-49.0L/12.0L*x + 49.0L/4.0L) - 145.0L/12.0L) + 23.0L/6.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*((49.0L/2.0L)*x - 245.0L/4.0L) + 145.0L/3.0L) - 11) - 1.0L/2.0L) - 1.0L/12.0L;
-        poly_val[1] = x*(x*(x*(x*(-245.0L/2.0L*x + 1225.0L/4.0L) - 725.0L/3.0L) + 111.0L/2.0L) + 1) + 4.0L/3.0L;
-        poly_val[2] = pow(x, 2)*(x*(x*(245*x - 1225.0L/2.0L) + 1450.0L/3.0L) - 112) - 5.0L/2.0L;
-        poly_val[3] = x*(x*(x*(x*(-245*x + 1225.0L/2.0L) - 1450.0L/3.0L) + 113) - 1) + 4.0L/3.0L;
-        poly_val[4] = x*(x*(x*(x*((245.0L/2.0L)*x - 1225.0L/4.0L) + 725.0L/3.0L) - 57) + 1.0L/2.0L) - 1.0L/12.0L;
-        poly_val[5] = pow(x, 2)*(x*(x*(-49.0L/2.0L*x + 245.0L/4.0L) - 145.0L/3.0L) + 23.0L/2.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 3, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n2_m4(int deriv, double x, double *poly_val)
+template void beta_n2_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n2_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<2, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.9166666666666667, 9.583333333333334, -19.166666666666668, 19.166666666666668,
+         -9.583333333333334, 1.9166666666666667},
+        {0, 0, 0, 0,
+         0, 0},
+        {2.5, -12.5, 25.0, -25.0,
+         12.5, -2.5},
+        {0, 0, 0, 0,
+         0, 0},
+        {-1.3645833333333333, 6.822916666666667, -13.645833333333334, 13.645833333333334,
+         -6.822916666666667, 1.3645833333333333},
+        {0.020833333333333332, -0.0625, 0.041666666666666664, 0.041666666666666664,
+         -0.0625, 0.020833333333333332},
+        {0.4166666666666667, -2.25, 4.666666666666667, -4.666666666666667,
+         2.25, -0.4166666666666667},
+        {-0.052083333333333336, 0.40625, -0.3541666666666667, -0.3541666666666667,
+         0.40625, -0.052083333333333336},
+        {-0.050455729166666664, 0.2939453125, -1.6295572916666667, 1.6295572916666667,
+         -0.2939453125, 0.050455729166666664},
+        {0.01171875, -0.09765625, 0.5859375, 0.5859375,
+         -0.09765625, 0.01171875}};
+};
+constexpr double spline_polynomials<2, 4, 0>::coefficients[10][6];
+
+template <>
+struct spline_polynomials<2, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-17.25, 86.25, -172.5, 172.5,
+         -86.25, 17.25},
+        {0, 0, 0, 0,
+         0, 0},
+        {17.5, -87.5, 175.0, -175.0,
+         87.5, -17.5},
+        {0, 0, 0, 0,
+         0, 0},
+        {-6.822916666666667, 34.114583333333336, -68.22916666666667, 68.22916666666667,
+         -34.114583333333336, 6.822916666666667},
+        {0.08333333333333333, -0.25, 0.16666666666666666, 0.16666666666666666,
+         -0.25, 0.08333333333333333},
+        {1.25, -6.75, 14.0, -14.0,
+         6.75, -1.25},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667},
+        {-0.050455729166666664, 0.2939453125, -1.6295572916666667, 1.6295572916666667,
+         -0.2939453125, 0.050455729166666664}};
+};
+constexpr double spline_polynomials<2, 4, 1>::coefficients[9][6];
+
+template <>
+struct spline_polynomials<2, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 6;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-138.0, 690.0, -1380.0, 1380.0,
+         -690.0, 138.0},
+        {0, 0, 0, 0,
+         0, 0},
+        {105.0, -525.0, 1050.0, -1050.0,
+         525.0, -105.0},
+        {0, 0, 0, 0,
+         0, 0},
+        {-27.291666666666668, 136.45833333333334, -272.9166666666667, 272.9166666666667,
+         -136.45833333333334, 27.291666666666668},
+        {0.25, -0.75, 0.5, 0.5,
+         -0.75, 0.25},
+        {2.5, -13.5, 28.0, -28.0,
+         13.5, -2.5},
+        {-0.10416666666666667, 0.8125, -0.7083333333333334, -0.7083333333333334,
+         0.8125, -0.10416666666666667}};
+};
+constexpr double spline_polynomials<2, 4, 2>::coefficients[8][6];
+
+template <class real_number>
+void beta_n2_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-23.0L/12.0L*x + 69.0L/8.0L) - 59.0L/4.0L) + 91.0L/8.0L) - 10.0L/3.0L) + 1.0L/24.0L) - 1.0L/12.0L) - 1.0L/24.0L) + 1.0L/12.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((115.0L/12.0L)*x - 345.0L/8.0L) + 295.0L/4.0L) - 455.0L/8.0L) + 50.0L/3.0L) - 1.0L/6.0L) + 1.0L/6.0L) + 2.0L/3.0L) - 2.0L/3.0L);
-        poly_val[2] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-115.0L/6.0L*x + 345.0L/4.0L) - 295.0L/2.0L) + 455.0L/4.0L) - 100.0L/3.0L) + 1.0L/4.0L) - 5.0L/4.0L) + 1;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((115.0L/6.0L)*x - 345.0L/4.0L) + 295.0L/2.0L) - 455.0L/4.0L) + 100.0L/3.0L) - 1.0L/6.0L) - 1.0L/6.0L) + 2.0L/3.0L) + 2.0L/3.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-115.0L/12.0L*x + 345.0L/8.0L) - 295.0L/4.0L) + 455.0L/8.0L) - 50.0L/3.0L) + 1.0L/24.0L) + 1.0L/12.0L) - 1.0L/24.0L) - 1.0L/12.0L);
-        poly_val[5] = pow(x, 5)*(x*(x*(x*((23.0L/12.0L)*x - 69.0L/8.0L) + 59.0L/4.0L) - 91.0L/8.0L) + 10.0L/3.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-69.0L/4.0L*x + 69) - 413.0L/4.0L) + 273.0L/4.0L) - 50.0L/3.0L) + 1.0L/6.0L) - 1.0L/4.0L) - 1.0L/12.0L) + 1.0L/12.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*((345.0L/4.0L)*x - 345) + 2065.0L/4.0L) - 1365.0L/4.0L) + 250.0L/3.0L) - 2.0L/3.0L) + 1.0L/2.0L) + 4.0L/3.0L) - 2.0L/3.0L;
-        poly_val[2] = x*(pow(x, 2)*(x*(x*(x*(x*(-345.0L/2.0L*x + 690) - 2065.0L/2.0L) + 1365.0L/2.0L) - 500.0L/3.0L) + 1) - 5.0L/2.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*((345.0L/2.0L)*x - 690) + 2065.0L/2.0L) - 1365.0L/2.0L) + 500.0L/3.0L) - 2.0L/3.0L) - 1.0L/2.0L) + 4.0L/3.0L) + 2.0L/3.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(-345.0L/4.0L*x + 345) - 2065.0L/4.0L) + 1365.0L/4.0L) - 250.0L/3.0L) + 1.0L/6.0L) + 1.0L/4.0L) - 1.0L/12.0L) - 1.0L/12.0L;
-        poly_val[5] = pow(x, 4)*(x*(x*(x*((69.0L/4.0L)*x - 69) + 413.0L/4.0L) - 273.0L/4.0L) + 50.0L/3.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-138*x + 483) - 1239.0L/2.0L) + 1365.0L/4.0L) - 200.0L/3.0L) + 1.0L/2.0L) - 1.0L/2.0L) - 1.0L/12.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(690*x - 2415) + 6195.0L/2.0L) - 6825.0L/4.0L) + 1000.0L/3.0L) - 2) + 1) + 4.0L/3.0L;
-        poly_val[2] = pow(x, 2)*(x*(x*(x*(x*(-1380*x + 4830) - 6195) + 6825.0L/2.0L) - 2000.0L/3.0L) + 3) - 5.0L/2.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(1380*x - 4830) + 6195) - 6825.0L/2.0L) + 2000.0L/3.0L) - 2) - 1) + 4.0L/3.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-690*x + 2415) - 6195.0L/2.0L) + 6825.0L/4.0L) - 1000.0L/3.0L) + 1.0L/2.0L) + 1.0L/2.0L) - 1.0L/12.0L;
-        poly_val[5] = pow(x, 3)*(x*(x*(x*(138*x - 483) + 1239.0L/2.0L) - 1365.0L/4.0L) + 200.0L/3.0L);
+        evaluate_beta_polynomials<spline_polynomials<2, 4, 2>>(x, poly_val);
         break;
     }
 }
 
+template void beta_n2_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n2_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
@@ -28,11 +28,16 @@
 
 #define SPLINE_N2
 
-void beta_n2_m0(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n2_m1(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n2_m2(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n2_m3(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n2_m4(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n2_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n2_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n2_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n2_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n2_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N2
 
@@ -25,264 +25,630 @@
 
 
 #include "spline_n3.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n3_m0(int deriv, double x, double *poly_val)
+template <>
+struct spline_polynomials<3, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, -1.0,
+         1.0, 0, 0, 0},
+        {0, 0, 0, 0.5,
+         0.5, 0, 0, 0}};
+};
+constexpr double spline_polynomials<3, 0, 0>::coefficients[2][8];
+
+template <>
+struct spline_polynomials<3, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, -1.0,
+         1.0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<3, 0, 1>::coefficients[1][8];
+
+template <>
+struct spline_polynomials<3, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<3, 0, 2>::coefficients[1][8];
+
+template <class real_number>
+void beta_n3_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = -x + 1;
-        poly_val[4] = x;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
+        evaluate_beta_polynomials<spline_polynomials<3, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = -1;
-        poly_val[4] = 1;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
+        evaluate_beta_polynomials<spline_polynomials<3, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
+        evaluate_beta_polynomials<spline_polynomials<3, 0, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m1(int deriv, double x, double *poly_val)
+template void beta_n3_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.016666666666666666, 0.13333333333333333, -0.6, 1.25,
+         -1.25, 0.6, -0.13333333333333333, 0.016666666666666666},
+        {0.008333333333333333, -0.08333333333333333, 0.45, -0.375,
+         -0.375, 0.45, -0.08333333333333333, 0.008333333333333333},
+        {0.004166666666666667, -0.03333333333333333, 0.15, -1.3125,
+         1.3125, -0.15, 0.03333333333333333, -0.004166666666666667},
+        {-0.0020833333333333333, 0.020833333333333332, -0.1125, 0.59375,
+         0.59375, -0.1125, 0.020833333333333332, -0.0020833333333333333}};
+};
+constexpr double spline_polynomials<3, 1, 0>::coefficients[4][8];
+
+template <>
+struct spline_polynomials<3, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.05, 0.4, -1.8, 3.75,
+         -3.75, 1.8, -0.4, 0.05},
+        {0.016666666666666666, -0.16666666666666666, 0.9, -0.75,
+         -0.75, 0.9, -0.16666666666666666, 0.016666666666666666},
+        {0.004166666666666667, -0.03333333333333333, 0.15, -1.3125,
+         1.3125, -0.15, 0.03333333333333333, -0.004166666666666667}};
+};
+constexpr double spline_polynomials<3, 1, 1>::coefficients[3][8];
+
+template <>
+struct spline_polynomials<3, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.1, 0.8, -3.6, 7.5,
+         -7.5, 3.6, -0.8, 0.1},
+        {0.016666666666666666, -0.16666666666666666, 0.9, -0.75,
+         -0.75, 0.9, -0.16666666666666666, 0.016666666666666666}};
+};
+constexpr double spline_polynomials<3, 1, 2>::coefficients[2][8];
+
+template <class real_number>
+void beta_n3_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(-1.0L/60.0L*x + 1.0L/30.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*((2.0L/15.0L)*x - 17.0L/60.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(-3.0L/5.0L*x + 27.0L/20.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*((5.0L/4.0L)*x - 9.0L/4.0L) + 1;
-        poly_val[4] = x*(x*(-5.0L/4.0L*x + 3.0L/2.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*((3.0L/5.0L)*x - 9.0L/20.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(-2.0L/15.0L*x + 7.0L/60.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 2)*((1.0L/60.0L)*x - 1.0L/60.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(-1.0L/20.0L*x + 1.0L/15.0L) - 1.0L/60.0L;
-        poly_val[1] = x*((2.0L/5.0L)*x - 17.0L/30.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(-9.0L/5.0L*x + 27.0L/10.0L) - 3.0L/4.0L;
-        poly_val[3] = x*((15.0L/4.0L)*x - 9.0L/2.0L);
-        poly_val[4] = x*(-15.0L/4.0L*x + 3) + 3.0L/4.0L;
-        poly_val[5] = x*((9.0L/5.0L)*x - 9.0L/10.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(-2.0L/5.0L*x + 7.0L/30.0L) + 1.0L/60.0L;
-        poly_val[7] = x*((1.0L/20.0L)*x - 1.0L/30.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = -1.0L/10.0L*x + 1.0L/15.0L;
-        poly_val[1] = (4.0L/5.0L)*x - 17.0L/30.0L;
-        poly_val[2] = -18.0L/5.0L*x + 27.0L/10.0L;
-        poly_val[3] = (15.0L/2.0L)*x - 9.0L/2.0L;
-        poly_val[4] = -15.0L/2.0L*x + 3;
-        poly_val[5] = (18.0L/5.0L)*x - 9.0L/10.0L;
-        poly_val[6] = -4.0L/5.0L*x + 7.0L/30.0L;
-        poly_val[7] = (1.0L/10.0L)*x - 1.0L/30.0L;
+        evaluate_beta_polynomials<spline_polynomials<3, 1, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m2(int deriv, double x, double *poly_val)
+template void beta_n3_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.044444444444444446, -0.3194444444444444, 0.975, -1.6388888888888888,
+         1.6388888888888888, -0.975, 0.3194444444444444, -0.044444444444444446},
+        {-0.005555555555555556, 0.04861111111111111, -0.1125, 0.06944444444444445,
+         0.06944444444444445, -0.1125, 0.04861111111111111, -0.005555555555555556},
+        {-0.03888888888888889, 0.29305555555555557, -1.0875, 2.0694444444444446,
+         -2.0694444444444446, 1.0875, -0.29305555555555557, 0.03888888888888889},
+        {0.011111111111111112, -0.1076388888888889, 0.50625, -0.4097222222222222,
+         -0.4097222222222222, 0.50625, -0.1076388888888889, 0.011111111111111112},
+        {0.006944444444444444, -0.05329861111111111, 0.2109375, -1.4149305555555556,
+         1.4149305555555556, -0.2109375, 0.05329861111111111, -0.006944444444444444},
+        {-0.0024305555555555556, 0.023871527777777776, -0.11953125, 0.5980902777777778,
+         0.5980902777777778, -0.11953125, 0.023871527777777776, -0.0024305555555555556}};
+};
+constexpr double spline_polynomials<3, 2, 0>::coefficients[6][8];
+
+template <>
+struct spline_polynomials<3, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.2222222222222222, -1.5972222222222223, 4.875, -8.194444444444445,
+         8.194444444444445, -4.875, 1.5972222222222223, -0.2222222222222222},
+        {-0.022222222222222223, 0.19444444444444445, -0.45, 0.2777777777777778,
+         0.2777777777777778, -0.45, 0.19444444444444445, -0.022222222222222223},
+        {-0.11666666666666667, 0.8791666666666667, -3.2625, 6.208333333333333,
+         -6.208333333333333, 3.2625, -0.8791666666666667, 0.11666666666666667},
+        {0.022222222222222223, -0.2152777777777778, 1.0125, -0.8194444444444444,
+         -0.8194444444444444, 1.0125, -0.2152777777777778, 0.022222222222222223},
+        {0.006944444444444444, -0.05329861111111111, 0.2109375, -1.4149305555555556,
+         1.4149305555555556, -0.2109375, 0.05329861111111111, -0.006944444444444444}};
+};
+constexpr double spline_polynomials<3, 2, 1>::coefficients[5][8];
+
+template <>
+struct spline_polynomials<3, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.8888888888888888, -6.388888888888889, 19.5, -32.77777777777778,
+         32.77777777777778, -19.5, 6.388888888888889, -0.8888888888888888},
+        {-0.06666666666666667, 0.5833333333333334, -1.35, 0.8333333333333334,
+         0.8333333333333334, -1.35, 0.5833333333333334, -0.06666666666666667},
+        {-0.23333333333333334, 1.7583333333333333, -6.525, 12.416666666666666,
+         -12.416666666666666, 6.525, -1.7583333333333333, 0.23333333333333334},
+        {0.022222222222222223, -0.2152777777777778, 1.0125, -0.8194444444444444,
+         -0.8194444444444444, 1.0125, -0.2152777777777778, 0.022222222222222223}};
+};
+constexpr double spline_polynomials<3, 2, 2>::coefficients[4][8];
+
+template <class real_number>
+void beta_n3_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*((2.0L/45.0L)*x - 7.0L/60.0L) + 1.0L/12.0L) + 1.0L/180.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*(x*(x*(-23.0L/72.0L*x + 61.0L/72.0L) - 217.0L/360.0L) - 3.0L/40.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(x*(x*((39.0L/40.0L)*x - 51.0L/20.0L) + 63.0L/40.0L) + 3.0L/4.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*(x*(x*(-59.0L/36.0L*x + 25.0L/6.0L) - 13.0L/6.0L) - 49.0L/36.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*((59.0L/36.0L)*x - 145.0L/36.0L) + 17.0L/9.0L) + 3.0L/4.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*(x*(x*(-39.0L/40.0L*x + 93.0L/40.0L) - 9.0L/8.0L) - 3.0L/40.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(x*(x*((23.0L/72.0L)*x - 3.0L/4.0L) + 49.0L/120.0L) + 1.0L/180.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 3)*(x*(-2.0L/45.0L*x + 19.0L/180.0L) - 11.0L/180.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*((2.0L/9.0L)*x - 7.0L/15.0L) + 1.0L/4.0L) + 1.0L/90.0L) - 1.0L/60.0L;
-        poly_val[1] = x*(x*(x*(-115.0L/72.0L*x + 61.0L/18.0L) - 217.0L/120.0L) - 3.0L/20.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*((39.0L/8.0L)*x - 51.0L/5.0L) + 189.0L/40.0L) + 3.0L/2.0L) - 3.0L/4.0L;
-        poly_val[3] = x*(x*(x*(-295.0L/36.0L*x + 50.0L/3.0L) - 13.0L/2.0L) - 49.0L/18.0L);
-        poly_val[4] = x*(x*(x*((295.0L/36.0L)*x - 145.0L/9.0L) + 17.0L/3.0L) + 3.0L/2.0L) + 3.0L/4.0L;
-        poly_val[5] = x*(x*(x*(-39.0L/8.0L*x + 93.0L/10.0L) - 27.0L/8.0L) - 3.0L/20.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*((115.0L/72.0L)*x - 3) + 49.0L/40.0L) + 1.0L/90.0L) + 1.0L/60.0L;
-        poly_val[7] = pow(x, 2)*(x*(-2.0L/9.0L*x + 19.0L/45.0L) - 11.0L/60.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*((8.0L/9.0L)*x - 7.0L/5.0L) + 1.0L/2.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(-115.0L/18.0L*x + 61.0L/6.0L) - 217.0L/60.0L) - 3.0L/20.0L;
-        poly_val[2] = x*(x*((39.0L/2.0L)*x - 153.0L/5.0L) + 189.0L/20.0L) + 3.0L/2.0L;
-        poly_val[3] = x*(x*(-295.0L/9.0L*x + 50) - 13) - 49.0L/18.0L;
-        poly_val[4] = x*(x*((295.0L/9.0L)*x - 145.0L/3.0L) + 34.0L/3.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(-39.0L/2.0L*x + 279.0L/10.0L) - 27.0L/4.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*((115.0L/18.0L)*x - 9) + 49.0L/20.0L) + 1.0L/90.0L;
-        poly_val[7] = x*(x*(-8.0L/9.0L*x + 19.0L/15.0L) - 11.0L/30.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 2, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m3(int deriv, double x, double *poly_val)
+template void beta_n3_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.12361111111111112, 0.8652777777777778, -2.595833333333333, 4.326388888888889,
+         -4.326388888888889, 2.595833333333333, -0.8652777777777778, 0.12361111111111112},
+        {0.0006944444444444445, -0.003472222222222222, 0.00625, -0.003472222222222222,
+         -0.003472222222222222, 0.00625, -0.003472222222222222, 0.0006944444444444445},
+        {0.1371527777777778, -0.9684027777777777, 2.921875, -4.883680555555555,
+         4.883680555555555, -2.921875, 0.9684027777777777, -0.1371527777777778},
+        {-0.006076388888888889, 0.051215277777777776, -0.1171875, 0.0720486111111111,
+         0.0720486111111111, -0.1171875, 0.051215277777777776, -0.006076388888888889},
+        {-0.062065972222222224, 0.4552951388888889, -1.57421875, 2.880642361111111,
+         -2.880642361111111, 1.57421875, -0.4552951388888889, 0.062065972222222224},
+        {0.011241319444444444, -0.10828993055555555, 0.507421875, -0.4103732638888889,
+         -0.4103732638888889, 0.507421875, -0.10828993055555555, 0.011241319444444444},
+        {0.008875868055555555, -0.06681857638888888, 0.25149739583333336, -1.4825303819444444,
+         1.4825303819444444, -0.25149739583333336, 0.06681857638888888, -0.008875868055555555},
+        {-0.00244140625, 0.02392578125, -0.11962890625, 0.59814453125,
+         0.59814453125, -0.11962890625, 0.02392578125, -0.00244140625}};
+};
+constexpr double spline_polynomials<3, 3, 0>::coefficients[8][8];
+
+template <>
+struct spline_polynomials<3, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.8652777777777778, 6.0569444444444445, -18.170833333333334, 30.28472222222222,
+         -30.28472222222222, 18.170833333333334, -6.0569444444444445, 0.8652777777777778},
+        {0.004166666666666667, -0.020833333333333332, 0.0375, -0.020833333333333332,
+         -0.020833333333333332, 0.0375, -0.020833333333333332, 0.004166666666666667},
+        {0.6857638888888888, -4.842013888888889, 14.609375, -24.41840277777778,
+         24.41840277777778, -14.609375, 4.842013888888889, -0.6857638888888888},
+        {-0.024305555555555556, 0.2048611111111111, -0.46875, 0.2881944444444444,
+         0.2881944444444444, -0.46875, 0.2048611111111111, -0.024305555555555556},
+        {-0.18619791666666666, 1.3658854166666667, -4.72265625, 8.641927083333334,
+         -8.641927083333334, 4.72265625, -1.3658854166666667, 0.18619791666666666},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889},
+        {0.008875868055555555, -0.06681857638888888, 0.25149739583333336, -1.4825303819444444,
+         1.4825303819444444, -0.25149739583333336, 0.06681857638888888, -0.008875868055555555}};
+};
+constexpr double spline_polynomials<3, 3, 1>::coefficients[7][8];
+
+template <>
+struct spline_polynomials<3, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-5.191666666666666, 36.34166666666667, -109.025, 181.70833333333334,
+         -181.70833333333334, 109.025, -36.34166666666667, 5.191666666666666},
+        {0.020833333333333332, -0.10416666666666667, 0.1875, -0.10416666666666667,
+         -0.10416666666666667, 0.1875, -0.10416666666666667, 0.020833333333333332},
+        {2.7430555555555554, -19.368055555555557, 58.4375, -97.67361111111111,
+         97.67361111111111, -58.4375, 19.368055555555557, -2.7430555555555554},
+        {-0.07291666666666667, 0.6145833333333334, -1.40625, 0.8645833333333334,
+         0.8645833333333334, -1.40625, 0.6145833333333334, -0.07291666666666667},
+        {-0.3723958333333333, 2.7317708333333335, -9.4453125, 17.283854166666668,
+         -17.283854166666668, 9.4453125, -2.7317708333333335, 0.3723958333333333},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889}};
+};
+constexpr double spline_polynomials<3, 3, 2>::coefficients[6][8];
+
+template <class real_number>
+void beta_n3_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-89.0L/720.0L*x + 13.0L/30.0L) - 37.0L/72.0L) + 7.0L/36.0L) + 1.0L/48.0L) + 1.0L/180.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*((623.0L/720.0L)*x - 2183.0L/720.0L) + 2581.0L/720.0L) - 191.0L/144.0L) - 1.0L/6.0L) - 3.0L/40.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-623.0L/240.0L*x + 1091.0L/120.0L) - 429.0L/40.0L) + 95.0L/24.0L) + 13.0L/48.0L) + 3.0L/4.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(x*(x*((623.0L/144.0L)*x - 727.0L/48.0L) + 2569.0L/144.0L) - 959.0L/144.0L) - 49.0L/36.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-623.0L/144.0L*x + 545.0L/36.0L) - 1283.0L/72.0L) + 61.0L/9.0L) - 13.0L/48.0L) + 3.0L/4.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*((623.0L/240.0L)*x - 2179.0L/240.0L) + 171.0L/16.0L) - 199.0L/48.0L) + 1.0L/6.0L) - 3.0L/40.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-623.0L/720.0L*x + 121.0L/40.0L) - 1283.0L/360.0L) + 101.0L/72.0L) - 1.0L/48.0L) + 1.0L/180.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 4)*(x*(x*((89.0L/720.0L)*x - 311.0L/720.0L) + 367.0L/720.0L) - 29.0L/144.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(-623.0L/720.0L*x + 13.0L/5.0L) - 185.0L/72.0L) + 7.0L/9.0L) + 1.0L/16.0L) + 1.0L/90.0L) - 1.0L/60.0L;
-        poly_val[1] = x*(x*(x*(x*(x*((4361.0L/720.0L)*x - 2183.0L/120.0L) + 2581.0L/144.0L) - 191.0L/36.0L) - 1.0L/2.0L) - 3.0L/20.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(-4361.0L/240.0L*x + 1091.0L/20.0L) - 429.0L/8.0L) + 95.0L/6.0L) + 13.0L/16.0L) + 3.0L/2.0L) - 3.0L/4.0L;
-        poly_val[3] = x*(pow(x, 2)*(x*(x*((4361.0L/144.0L)*x - 727.0L/8.0L) + 12845.0L/144.0L) - 959.0L/36.0L) - 49.0L/18.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(-4361.0L/144.0L*x + 545.0L/6.0L) - 6415.0L/72.0L) + 244.0L/9.0L) - 13.0L/16.0L) + 3.0L/2.0L) + 3.0L/4.0L;
-        poly_val[5] = x*(x*(x*(x*(x*((4361.0L/240.0L)*x - 2179.0L/40.0L) + 855.0L/16.0L) - 199.0L/12.0L) + 1.0L/2.0L) - 3.0L/20.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(-4361.0L/720.0L*x + 363.0L/20.0L) - 1283.0L/72.0L) + 101.0L/18.0L) - 1.0L/16.0L) + 1.0L/90.0L) + 1.0L/60.0L;
-        poly_val[7] = pow(x, 3)*(x*(x*((623.0L/720.0L)*x - 311.0L/120.0L) + 367.0L/144.0L) - 29.0L/36.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(-623.0L/120.0L*x + 13) - 185.0L/18.0L) + 7.0L/3.0L) + 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(x*(x*((4361.0L/120.0L)*x - 2183.0L/24.0L) + 2581.0L/36.0L) - 191.0L/12.0L) - 1) - 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(-4361.0L/40.0L*x + 1091.0L/4.0L) - 429.0L/2.0L) + 95.0L/2.0L) + 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[3] = pow(x, 2)*(x*(x*((4361.0L/24.0L)*x - 3635.0L/8.0L) + 12845.0L/36.0L) - 959.0L/12.0L) - 49.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(-4361.0L/24.0L*x + 2725.0L/6.0L) - 6415.0L/18.0L) + 244.0L/3.0L) - 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(x*(x*((4361.0L/40.0L)*x - 2179.0L/8.0L) + 855.0L/4.0L) - 199.0L/4.0L) + 1) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(-4361.0L/120.0L*x + 363.0L/4.0L) - 1283.0L/18.0L) + 101.0L/6.0L) - 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[7] = pow(x, 2)*(x*(x*((623.0L/120.0L)*x - 311.0L/24.0L) + 367.0L/36.0L) - 29.0L/12.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 3, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m4(int deriv, double x, double *poly_val)
+template void beta_n3_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.4027777777777778, -2.8194444444444446, 8.458333333333334, -14.097222222222221,
+         14.097222222222221, -8.458333333333334, 2.8194444444444446, -0.4027777777777778},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-0.5263888888888889, 3.6847222222222222, -11.054166666666667, 18.42361111111111,
+         -18.42361111111111, 11.054166666666667, -3.6847222222222222, 0.5263888888888889},
+        {0.0006944444444444445, -0.003472222222222222, 0.00625, -0.003472222222222222,
+         -0.003472222222222222, 0.00625, -0.003472222222222222, 0.0006944444444444445},
+        {0.2881944444444444, -2.0256944444444445, 6.09375, -10.17013888888889,
+         10.17013888888889, -6.09375, 2.0256944444444445, -0.2881944444444444},
+        {-0.006076388888888889, 0.051215277777777776, -0.1171875, 0.0720486111111111,
+         0.0720486111111111, -0.1171875, 0.051215277777777776, -0.006076388888888889},
+        {-0.08723958333333333, 0.6315104166666666, -2.1028645833333335, 3.76171875,
+         -3.76171875, 2.1028645833333335, -0.6315104166666666, 0.08723958333333333},
+        {0.011241319444444444, -0.10828993055555555, 0.507421875, -0.4103732638888889,
+         -0.4103732638888889, 0.507421875, -0.10828993055555555, 0.011241319444444444},
+        {0.01044921875, -0.07783203125, 0.2845377604166667, -1.53759765625,
+         1.53759765625, -0.2845377604166667, 0.07783203125, -0.01044921875},
+        {-0.00244140625, 0.02392578125, -0.11962890625, 0.59814453125,
+         0.59814453125, -0.11962890625, 0.02392578125, -0.00244140625}};
+};
+constexpr double spline_polynomials<3, 4, 0>::coefficients[10][8];
+
+template <>
+struct spline_polynomials<3, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.625, -25.375, 76.125, -126.875,
+         126.875, -76.125, 25.375, -3.625},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-3.6847222222222222, 25.793055555555554, -77.37916666666666, 128.96527777777777,
+         -128.96527777777777, 77.37916666666666, -25.793055555555554, 3.6847222222222222},
+        {0.004166666666666667, -0.020833333333333332, 0.0375, -0.020833333333333332,
+         -0.020833333333333332, 0.0375, -0.020833333333333332, 0.004166666666666667},
+        {1.4409722222222223, -10.128472222222221, 30.46875, -50.85069444444444,
+         50.85069444444444, -30.46875, 10.128472222222221, -1.4409722222222223},
+        {-0.024305555555555556, 0.2048611111111111, -0.46875, 0.2881944444444444,
+         0.2881944444444444, -0.46875, 0.2048611111111111, -0.024305555555555556},
+        {-0.26171875, 1.89453125, -6.30859375, 11.28515625,
+         -11.28515625, 6.30859375, -1.89453125, 0.26171875},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889},
+        {0.01044921875, -0.07783203125, 0.2845377604166667, -1.53759765625,
+         1.53759765625, -0.2845377604166667, 0.07783203125, -0.01044921875}};
+};
+constexpr double spline_polynomials<3, 4, 1>::coefficients[9][8];
+
+template <>
+struct spline_polynomials<3, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {29.0, -203.0, 609.0, -1015.0,
+         1015.0, -609.0, 203.0, -29.0},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-22.108333333333334, 154.75833333333333, -464.275, 773.7916666666666,
+         -773.7916666666666, 464.275, -154.75833333333333, 22.108333333333334},
+        {0.020833333333333332, -0.10416666666666667, 0.1875, -0.10416666666666667,
+         -0.10416666666666667, 0.1875, -0.10416666666666667, 0.020833333333333332},
+        {5.763888888888889, -40.513888888888886, 121.875, -203.40277777777777,
+         203.40277777777777, -121.875, 40.513888888888886, -5.763888888888889},
+        {-0.07291666666666667, 0.6145833333333334, -1.40625, 0.8645833333333334,
+         0.8645833333333334, -1.40625, 0.6145833333333334, -0.07291666666666667},
+        {-0.5234375, 3.7890625, -12.6171875, 22.5703125,
+         -22.5703125, 12.6171875, -3.7890625, 0.5234375},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889}};
+};
+constexpr double spline_polynomials<3, 4, 2>::coefficients[8][8];
+
+template <class real_number>
+void beta_n3_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((29.0L/72.0L)*x - 29.0L/16.0L) + 2231.0L/720.0L) - 859.0L/360.0L) + 25.0L/36.0L) - 1.0L/144.0L) + 1.0L/48.0L) + 1.0L/180.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-203.0L/72.0L*x + 203.0L/16.0L) - 15617.0L/720.0L) + 4009.0L/240.0L) - 3509.0L/720.0L) + 1.0L/12.0L) - 1.0L/6.0L) - 3.0L/40.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((203.0L/24.0L)*x - 609.0L/16.0L) + 15617.0L/240.0L) - 3007.0L/60.0L) + 293.0L/20.0L) - 13.0L/48.0L) + 13.0L/48.0L) + 3.0L/4.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-1015.0L/72.0L*x + 1015.0L/16.0L) - 15617.0L/144.0L) + 12029.0L/144.0L) - 3521.0L/144.0L) + 7.0L/18.0L) - 49.0L/36.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*((1015.0L/72.0L)*x - 1015.0L/16.0L) + 15617.0L/144.0L) - 2005.0L/24.0L) + 881.0L/36.0L) - 13.0L/48.0L) - 13.0L/48.0L) + 3.0L/4.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(-203.0L/24.0L*x + 609.0L/16.0L) - 15617.0L/240.0L) + 12031.0L/240.0L) - 235.0L/16.0L) + 1.0L/12.0L) + 1.0L/6.0L) - 3.0L/40.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*((203.0L/72.0L)*x - 203.0L/16.0L) + 15617.0L/720.0L) - 752.0L/45.0L) + 881.0L/180.0L) - 1.0L/144.0L) - 1.0L/48.0L) + 1.0L/180.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 5)*(x*(x*(x*(-29.0L/72.0L*x + 29.0L/16.0L) - 2231.0L/720.0L) + 191.0L/80.0L) - 503.0L/720.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*((29.0L/8.0L)*x - 29.0L/2.0L) + 15617.0L/720.0L) - 859.0L/60.0L) + 125.0L/36.0L) - 1.0L/36.0L) + 1.0L/16.0L) + 1.0L/90.0L) - 1.0L/60.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(-203.0L/8.0L*x + 203.0L/2.0L) - 109319.0L/720.0L) + 4009.0L/40.0L) - 3509.0L/144.0L) + 1.0L/3.0L) - 1.0L/2.0L) - 3.0L/20.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*((609.0L/8.0L)*x - 609.0L/2.0L) + 109319.0L/240.0L) - 3007.0L/10.0L) + 293.0L/4.0L) - 13.0L/12.0L) + 13.0L/16.0L) + 3.0L/2.0L) - 3.0L/4.0L;
-        poly_val[3] = x*(pow(x, 2)*(x*(x*(x*(x*(-1015.0L/8.0L*x + 1015.0L/2.0L) - 109319.0L/144.0L) + 12029.0L/24.0L) - 17605.0L/144.0L) + 14.0L/9.0L) - 49.0L/18.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*((1015.0L/8.0L)*x - 1015.0L/2.0L) + 109319.0L/144.0L) - 2005.0L/4.0L) + 4405.0L/36.0L) - 13.0L/12.0L) - 13.0L/16.0L) + 3.0L/2.0L) + 3.0L/4.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(-609.0L/8.0L*x + 609.0L/2.0L) - 109319.0L/240.0L) + 12031.0L/40.0L) - 1175.0L/16.0L) + 1.0L/3.0L) + 1.0L/2.0L) - 3.0L/20.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*((203.0L/8.0L)*x - 203.0L/2.0L) + 109319.0L/720.0L) - 1504.0L/15.0L) + 881.0L/36.0L) - 1.0L/36.0L) - 1.0L/16.0L) + 1.0L/90.0L) + 1.0L/60.0L;
-        poly_val[7] = pow(x, 4)*(x*(x*(x*(-29.0L/8.0L*x + 29.0L/2.0L) - 15617.0L/720.0L) + 573.0L/40.0L) - 503.0L/144.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(29*x - 203.0L/2.0L) + 15617.0L/120.0L) - 859.0L/12.0L) + 125.0L/9.0L) - 1.0L/12.0L) + 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-203*x + 1421.0L/2.0L) - 109319.0L/120.0L) + 4009.0L/8.0L) - 3509.0L/36.0L) + 1) - 1) - 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(609*x - 4263.0L/2.0L) + 109319.0L/40.0L) - 3007.0L/2.0L) + 293) - 13.0L/4.0L) + 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[3] = pow(x, 2)*(x*(x*(x*(x*(-1015*x + 7105.0L/2.0L) - 109319.0L/24.0L) + 60145.0L/24.0L) - 17605.0L/36.0L) + 14.0L/3.0L) - 49.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(1015*x - 7105.0L/2.0L) + 109319.0L/24.0L) - 10025.0L/4.0L) + 4405.0L/9.0L) - 13.0L/4.0L) - 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(-609*x + 4263.0L/2.0L) - 109319.0L/40.0L) + 12031.0L/8.0L) - 1175.0L/4.0L) + 1) + 1) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(203*x - 1421.0L/2.0L) + 109319.0L/120.0L) - 1504.0L/3.0L) + 881.0L/9.0L) - 1.0L/12.0L) - 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[7] = pow(x, 3)*(x*(x*(x*(-29*x + 203.0L/2.0L) - 15617.0L/120.0L) + 573.0L/8.0L) - 503.0L/36.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 4, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m5(int deriv, double x, double *poly_val)
+template void beta_n3_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 5, 0>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.3972222222222221, 9.780555555555555, -29.341666666666665, 48.90277777777778,
+         -48.90277777777778, 29.341666666666665, -9.780555555555555, 1.3972222222222221},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {2.1493055555555554, -15.04513888888889, 45.135416666666664, -75.22569444444444,
+         75.22569444444444, -45.135416666666664, 15.04513888888889, -2.1493055555555554},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-1.3996527777777779, 9.797569444444445, -29.392708333333335, 48.98784722222222,
+         -48.98784722222222, 29.392708333333335, -9.797569444444445, 1.3996527777777779},
+        {0.0006944444444444445, -0.003472222222222222, 0.00625, -0.003472222222222222,
+         -0.003472222222222222, 0.00625, -0.003472222222222222, 0.0006944444444444445},
+        {0.5065104166666666, -3.55390625, 10.678385416666666, -17.811197916666668,
+         17.811197916666668, -10.678385416666666, 3.55390625, -0.5065104166666666},
+        {-0.006076388888888889, 0.051215277777777776, -0.1171875, 0.0720486111111111,
+         0.0720486111111111, -0.1171875, 0.051215277777777776, -0.006076388888888889},
+        {-0.1145290798611111, 0.8225368923611112, -2.6759440104166665, 4.716851128472222,
+         -4.716851128472222, 2.6759440104166665, -0.8225368923611112, 0.1145290798611111},
+        {0.011241319444444444, -0.10828993055555555, 0.507421875, -0.4103732638888889,
+         -0.4103732638888889, 0.507421875, -0.10828993055555555, 0.011241319444444444},
+        {0.011813693576388888, -0.08738335503472222, 0.3131917317708333, -1.5853542751736112,
+         1.5853542751736112, -0.3131917317708333, 0.08738335503472222, -0.011813693576388888},
+        {-0.00244140625, 0.02392578125, -0.11962890625, 0.59814453125,
+         0.59814453125, -0.11962890625, 0.02392578125, -0.00244140625}};
+};
+constexpr double spline_polynomials<3, 5, 0>::coefficients[12][8];
+
+template <>
+struct spline_polynomials<3, 5, 1>
+{
+    static constexpr int degree = 10;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-15.369444444444444, 107.58611111111111, -322.7583333333333, 537.9305555555555,
+         -537.9305555555555, 322.7583333333333, -107.58611111111111, 15.369444444444444},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {19.34375, -135.40625, 406.21875, -677.03125,
+         677.03125, -406.21875, 135.40625, -19.34375},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-9.797569444444445, 68.58298611111111, -205.74895833333332, 342.91493055555554,
+         -342.91493055555554, 205.74895833333332, -68.58298611111111, 9.797569444444445},
+        {0.004166666666666667, -0.020833333333333332, 0.0375, -0.020833333333333332,
+         -0.020833333333333332, 0.0375, -0.020833333333333332, 0.004166666666666667},
+        {2.5325520833333335, -17.76953125, 53.391927083333336, -89.05598958333333,
+         89.05598958333333, -53.391927083333336, 17.76953125, -2.5325520833333335},
+        {-0.024305555555555556, 0.2048611111111111, -0.46875, 0.2881944444444444,
+         0.2881944444444444, -0.46875, 0.2048611111111111, -0.024305555555555556},
+        {-0.3435872395833333, 2.4676106770833335, -8.02783203125, 14.150553385416666,
+         -14.150553385416666, 8.02783203125, -2.4676106770833335, 0.3435872395833333},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889},
+        {0.011813693576388888, -0.08738335503472222, 0.3131917317708333, -1.5853542751736112,
+         1.5853542751736112, -0.3131917317708333, 0.08738335503472222, -0.011813693576388888}};
+};
+constexpr double spline_polynomials<3, 5, 1>::coefficients[11][8];
+
+template <>
+struct spline_polynomials<3, 5, 2>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-153.69444444444446, 1075.861111111111, -3227.5833333333335, 5379.305555555556,
+         -5379.305555555556, 3227.5833333333335, -1075.861111111111, 153.69444444444446},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {154.75, -1083.25, 3249.75, -5416.25,
+         5416.25, -3249.75, 1083.25, -154.75},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-58.78541666666667, 411.49791666666664, -1234.49375, 2057.4895833333335,
+         -2057.4895833333335, 1234.49375, -411.49791666666664, 58.78541666666667},
+        {0.020833333333333332, -0.10416666666666667, 0.1875, -0.10416666666666667,
+         -0.10416666666666667, 0.1875, -0.10416666666666667, 0.020833333333333332},
+        {10.130208333333334, -71.078125, 213.56770833333334, -356.2239583333333,
+         356.2239583333333, -213.56770833333334, 71.078125, -10.130208333333334},
+        {-0.07291666666666667, 0.6145833333333334, -1.40625, 0.8645833333333334,
+         0.8645833333333334, -1.40625, 0.6145833333333334, -0.07291666666666667},
+        {-0.6871744791666666, 4.935221354166667, -16.0556640625, 28.301106770833332,
+         -28.301106770833332, 16.0556640625, -4.935221354166667, 0.6871744791666666},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889}};
+};
+constexpr double spline_polynomials<3, 5, 2>::coefficients[10][8];
+
+template <class real_number>
+void beta_n3_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-503.0L/360.0L*x + 5533.0L/720.0L) - 273.0L/16.0L) + 919.0L/48.0L) - 7829.0L/720.0L) + 601.0L/240.0L) - 1.0L/240.0L) - 1.0L/144.0L) + 1.0L/48.0L) + 1.0L/180.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((3521.0L/360.0L)*x - 38731.0L/720.0L) + 1911.0L/16.0L) - 6433.0L/48.0L) + 54803.0L/720.0L) - 631.0L/36.0L) + 1.0L/60.0L) + 1.0L/12.0L) - 1.0L/6.0L) - 3.0L/40.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3521.0L/120.0L*x + 38731.0L/240.0L) - 5733.0L/16.0L) + 6433.0L/16.0L) - 54803.0L/240.0L) + 12619.0L/240.0L) - 1.0L/48.0L) - 13.0L/48.0L) + 13.0L/48.0L) + 3.0L/4.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((3521.0L/72.0L)*x - 38731.0L/144.0L) + 9555.0L/16.0L) - 32165.0L/48.0L) + 54803.0L/144.0L) - 701.0L/8.0L) + 7.0L/18.0L) - 49.0L/36.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3521.0L/72.0L*x + 38731.0L/144.0L) - 9555.0L/16.0L) + 32165.0L/48.0L) - 54803.0L/144.0L) + 12617.0L/144.0L) + 1.0L/48.0L) - 13.0L/48.0L) - 13.0L/48.0L) + 3.0L/4.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((3521.0L/120.0L)*x - 38731.0L/240.0L) + 5733.0L/16.0L) - 6433.0L/16.0L) + 54803.0L/240.0L) - 1577.0L/30.0L) - 1.0L/60.0L) + 1.0L/12.0L) + 1.0L/6.0L) - 3.0L/40.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3521.0L/360.0L*x + 38731.0L/720.0L) - 1911.0L/16.0L) + 6433.0L/48.0L) - 54803.0L/720.0L) + 841.0L/48.0L) + 1.0L/240.0L) - 1.0L/144.0L) - 1.0L/48.0L) + 1.0L/180.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 6)*(x*(x*(x*(x*((503.0L/360.0L)*x - 5533.0L/720.0L) + 273.0L/16.0L) - 919.0L/48.0L) + 7829.0L/720.0L) - 901.0L/360.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 5, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-5533.0L/360.0L*x + 5533.0L/72.0L) - 2457.0L/16.0L) + 919.0L/6.0L) - 54803.0L/720.0L) + 601.0L/40.0L) - 1.0L/48.0L) - 1.0L/36.0L) + 1.0L/16.0L) + 1.0L/90.0L) - 1.0L/60.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*((38731.0L/360.0L)*x - 38731.0L/72.0L) + 17199.0L/16.0L) - 6433.0L/6.0L) + 383621.0L/720.0L) - 631.0L/6.0L) + 1.0L/12.0L) + 1.0L/3.0L) - 1.0L/2.0L) - 3.0L/20.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-38731.0L/120.0L*x + 38731.0L/24.0L) - 51597.0L/16.0L) + 6433.0L/2.0L) - 383621.0L/240.0L) + 12619.0L/40.0L) - 5.0L/48.0L) - 13.0L/12.0L) + 13.0L/16.0L) + 3.0L/2.0L) - 3.0L/4.0L;
-        poly_val[3] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((38731.0L/72.0L)*x - 193655.0L/72.0L) + 85995.0L/16.0L) - 32165.0L/6.0L) + 383621.0L/144.0L) - 2103.0L/4.0L) + 14.0L/9.0L) - 49.0L/18.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-38731.0L/72.0L*x + 193655.0L/72.0L) - 85995.0L/16.0L) + 32165.0L/6.0L) - 383621.0L/144.0L) + 12617.0L/24.0L) + 5.0L/48.0L) - 13.0L/12.0L) - 13.0L/16.0L) + 3.0L/2.0L) + 3.0L/4.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*((38731.0L/120.0L)*x - 38731.0L/24.0L) + 51597.0L/16.0L) - 6433.0L/2.0L) + 383621.0L/240.0L) - 1577.0L/5.0L) - 1.0L/12.0L) + 1.0L/3.0L) + 1.0L/2.0L) - 3.0L/20.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-38731.0L/360.0L*x + 38731.0L/72.0L) - 17199.0L/16.0L) + 6433.0L/6.0L) - 383621.0L/720.0L) + 841.0L/8.0L) + 1.0L/48.0L) - 1.0L/36.0L) - 1.0L/16.0L) + 1.0L/90.0L) + 1.0L/60.0L;
-        poly_val[7] = pow(x, 5)*(x*(x*(x*(x*((5533.0L/360.0L)*x - 5533.0L/72.0L) + 2457.0L/16.0L) - 919.0L/6.0L) + 54803.0L/720.0L) - 901.0L/60.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 5, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-5533.0L/36.0L*x + 5533.0L/8.0L) - 2457.0L/2.0L) + 6433.0L/6.0L) - 54803.0L/120.0L) + 601.0L/8.0L) - 1.0L/12.0L) - 1.0L/12.0L) + 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((38731.0L/36.0L)*x - 38731.0L/8.0L) + 17199.0L/2.0L) - 45031.0L/6.0L) + 383621.0L/120.0L) - 3155.0L/6.0L) + 1.0L/3.0L) + 1) - 1) - 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-38731.0L/12.0L*x + 116193.0L/8.0L) - 51597.0L/2.0L) + 45031.0L/2.0L) - 383621.0L/40.0L) + 12619.0L/8.0L) - 5.0L/12.0L) - 13.0L/4.0L) + 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((193655.0L/36.0L)*x - 193655.0L/8.0L) + 85995.0L/2.0L) - 225155.0L/6.0L) + 383621.0L/24.0L) - 10515.0L/4.0L) + 14.0L/3.0L) - 49.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-193655.0L/36.0L*x + 193655.0L/8.0L) - 85995.0L/2.0L) + 225155.0L/6.0L) - 383621.0L/24.0L) + 63085.0L/24.0L) + 5.0L/12.0L) - 13.0L/4.0L) - 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((38731.0L/12.0L)*x - 116193.0L/8.0L) + 51597.0L/2.0L) - 45031.0L/2.0L) + 383621.0L/40.0L) - 1577) - 1.0L/3.0L) + 1) + 1) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-38731.0L/36.0L*x + 38731.0L/8.0L) - 17199.0L/2.0L) + 45031.0L/6.0L) - 383621.0L/120.0L) + 4205.0L/8.0L) + 1.0L/12.0L) - 1.0L/12.0L) - 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[7] = pow(x, 4)*(x*(x*(x*(x*((5533.0L/36.0L)*x - 5533.0L/8.0L) + 2457.0L/2.0L) - 6433.0L/6.0L) + 54803.0L/120.0L) - 901.0L/12.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 5, 2>>(x, poly_val);
         break;
     }
 }
 
-void beta_n3_m6(int deriv, double x, double *poly_val)
+template void beta_n3_m5<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m5<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<3, 6, 0>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {5.0055555555555555, -35.03888888888889, 105.11666666666666, -175.19444444444446,
+         175.19444444444446, -105.11666666666666, 35.03888888888889, -5.0055555555555555},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-8.905555555555555, 62.33888888888889, -187.01666666666668, 311.69444444444446,
+         -311.69444444444446, 187.01666666666668, -62.33888888888889, 8.905555555555555},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {6.842013888888889, -47.89409722222222, 143.68229166666666, -239.47048611111111,
+         239.47048611111111, -143.68229166666666, 47.89409722222222, -6.842013888888889},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-2.963888888888889, 20.747222222222224, -62.24166666666667, 103.73611111111111,
+         -103.73611111111111, 62.24166666666667, -20.747222222222224, 2.963888888888889},
+        {0.0006944444444444445, -0.003472222222222222, 0.00625, -0.003472222222222222,
+         -0.003472222222222222, 0.00625, -0.003472222222222222, 0.0006944444444444445},
+        {0.7998046875, -5.606966145833334, 16.837565104166668, -28.076497395833332,
+         28.076497395833332, -16.837565104166668, 5.606966145833334, -0.7998046875},
+        {-0.006076388888888889, 0.051215277777777776, -0.1171875, 0.0720486111111111,
+         0.0720486111111111, -0.1171875, 0.051215277777777776, -0.006076388888888889},
+        {-0.14385850694444444, 1.0278428819444445, -3.291861979166667, 5.743381076388889,
+         -5.743381076388889, 3.291861979166667, -1.0278428819444445, 0.14385850694444444},
+        {0.011241319444444444, -0.10828993055555555, 0.507421875, -0.4103732638888889,
+         -0.4103732638888889, 0.507421875, -0.10828993055555555, 0.011241319444444444},
+        {0.013035753038194445, -0.09593777126736111, 0.33885498046875, -1.6281263563368056,
+         1.6281263563368056, -0.33885498046875, 0.09593777126736111, -0.013035753038194445},
+        {-0.00244140625, 0.02392578125, -0.11962890625, 0.59814453125,
+         0.59814453125, -0.11962890625, 0.02392578125, -0.00244140625}};
+};
+constexpr double spline_polynomials<3, 6, 0>::coefficients[14][8];
+
+template <>
+struct spline_polynomials<3, 6, 1>
+{
+    static constexpr int degree = 12;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {65.07222222222222, -455.50555555555553, 1366.5166666666667, -2277.527777777778,
+         2277.527777777778, -1366.5166666666667, 455.50555555555553, -65.07222222222222},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-97.96111111111111, 685.7277777777778, -2057.1833333333334, 3428.6388888888887,
+         -3428.6388888888887, 2057.1833333333334, -685.7277777777778, 97.96111111111111},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {61.578125, -431.046875, 1293.140625, -2155.234375,
+         2155.234375, -1293.140625, 431.046875, -61.578125},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-20.747222222222224, 145.23055555555555, -435.69166666666666, 726.1527777777778,
+         -726.1527777777778, 435.69166666666666, -145.23055555555555, 20.747222222222224},
+        {0.004166666666666667, -0.020833333333333332, 0.0375, -0.020833333333333332,
+         -0.020833333333333332, 0.0375, -0.020833333333333332, 0.004166666666666667},
+        {3.9990234375, -28.034830729166668, 84.18782552083333, -140.38248697916666,
+         140.38248697916666, -84.18782552083333, 28.034830729166668, -3.9990234375},
+        {-0.024305555555555556, 0.2048611111111111, -0.46875, 0.2881944444444444,
+         0.2881944444444444, -0.46875, 0.2048611111111111, -0.024305555555555556},
+        {-0.43157552083333334, 3.0835286458333333, -9.8755859375, 17.230143229166668,
+         -17.230143229166668, 9.8755859375, -3.0835286458333333, 0.43157552083333334},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889},
+        {0.013035753038194445, -0.09593777126736111, 0.33885498046875, -1.6281263563368056,
+         1.6281263563368056, -0.33885498046875, 0.09593777126736111, -0.013035753038194445}};
+};
+constexpr double spline_polynomials<3, 6, 1>::coefficients[13][8];
+
+template <>
+struct spline_polynomials<3, 6, 2>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 8;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {780.8666666666667, -5466.066666666667, 16398.2, -27330.333333333332,
+         27330.333333333332, -16398.2, 5466.066666666667, -780.8666666666667},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-979.6111111111111, 6857.277777777777, -20571.833333333332, 34286.38888888889,
+         -34286.38888888889, 20571.833333333332, -6857.277777777777, 979.6111111111111},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {492.625, -3448.375, 10345.125, -17241.875,
+         17241.875, -10345.125, 3448.375, -492.625},
+        {0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-124.48333333333333, 871.3833333333333, -2614.15, 4356.916666666667,
+         -4356.916666666667, 2614.15, -871.3833333333333, 124.48333333333333},
+        {0.020833333333333332, -0.10416666666666667, 0.1875, -0.10416666666666667,
+         -0.10416666666666667, 0.1875, -0.10416666666666667, 0.020833333333333332},
+        {15.99609375, -112.13932291666667, 336.7513020833333, -561.5299479166666,
+         561.5299479166666, -336.7513020833333, 112.13932291666667, -15.99609375},
+        {-0.07291666666666667, 0.6145833333333334, -1.40625, 0.8645833333333334,
+         0.8645833333333334, -1.40625, 0.6145833333333334, -0.07291666666666667},
+        {-0.8631510416666667, 6.167057291666667, -19.751171875, 34.460286458333336,
+         -34.460286458333336, 19.751171875, -6.167057291666667, 0.8631510416666667},
+        {0.02248263888888889, -0.2165798611111111, 1.01484375, -0.8207465277777778,
+         -0.8207465277777778, 1.01484375, -0.2165798611111111, 0.02248263888888889}};
+};
+constexpr double spline_polynomials<3, 6, 2>::coefficients[12][8];
+
+template <class real_number>
+void beta_n3_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val)
 {
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((901.0L/180.0L)*x - 11713.0L/360.0L) + 31933.0L/360.0L) - 93577.0L/720.0L) + 15563.0L/144.0L) - 11623.0L/240.0L) + 6587.0L/720.0L) + 1.0L/720.0L) - 1.0L/240.0L) - 1.0L/144.0L) + 1.0L/48.0L) + 1.0L/180.0L) - 1.0L/60.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6307.0L/180.0L*x + 81991.0L/360.0L) - 223531.0L/360.0L) + 655039.0L/720.0L) - 108941.0L/144.0L) + 81361.0L/240.0L) - 46109.0L/720.0L) - 1.0L/120.0L) + 1.0L/60.0L) + 1.0L/12.0L) - 1.0L/6.0L) - 3.0L/40.0L) + 3.0L/20.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6307.0L/60.0L)*x - 81991.0L/120.0L) + 223531.0L/120.0L) - 655039.0L/240.0L) + 108941.0L/48.0L) - 81361.0L/80.0L) + 46109.0L/240.0L) + 1.0L/48.0L) - 1.0L/48.0L) - 13.0L/48.0L) + 13.0L/48.0L) + 3.0L/4.0L) - 3.0L/4.0L);
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-6307.0L/36.0L*x + 81991.0L/72.0L) - 223531.0L/72.0L) + 655039.0L/144.0L) - 544705.0L/144.0L) + 81361.0L/48.0L) - 46109.0L/144.0L) - 1.0L/36.0L) + 7.0L/18.0L) - 49.0L/36.0L) + 1;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6307.0L/36.0L)*x - 81991.0L/72.0L) + 223531.0L/72.0L) - 655039.0L/144.0L) + 544705.0L/144.0L) - 81361.0L/48.0L) + 46109.0L/144.0L) + 1.0L/48.0L) + 1.0L/48.0L) - 13.0L/48.0L) - 13.0L/48.0L) + 3.0L/4.0L) + 3.0L/4.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6307.0L/60.0L*x + 81991.0L/120.0L) - 223531.0L/120.0L) + 655039.0L/240.0L) - 108941.0L/48.0L) + 81361.0L/80.0L) - 46109.0L/240.0L) - 1.0L/120.0L) - 1.0L/60.0L) + 1.0L/12.0L) + 1.0L/6.0L) - 3.0L/40.0L) - 3.0L/20.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6307.0L/180.0L)*x - 81991.0L/360.0L) + 223531.0L/360.0L) - 655039.0L/720.0L) + 108941.0L/144.0L) - 81361.0L/240.0L) + 46109.0L/720.0L) + 1.0L/720.0L) + 1.0L/240.0L) - 1.0L/144.0L) - 1.0L/48.0L) + 1.0L/180.0L) + 1.0L/60.0L);
-        poly_val[7] = pow(x, 7)*(x*(x*(x*(x*(x*(-901.0L/180.0L*x + 11713.0L/360.0L) - 31933.0L/360.0L) + 93577.0L/720.0L) - 15563.0L/144.0L) + 11623.0L/240.0L) - 6587.0L/720.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 6, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11713.0L/180.0L)*x - 11713.0L/30.0L) + 351263.0L/360.0L) - 93577.0L/72.0L) + 15563.0L/16.0L) - 11623.0L/30.0L) + 46109.0L/720.0L) + 1.0L/120.0L) - 1.0L/48.0L) - 1.0L/36.0L) + 1.0L/16.0L) + 1.0L/90.0L) - 1.0L/60.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-81991.0L/180.0L*x + 81991.0L/30.0L) - 2458841.0L/360.0L) + 655039.0L/72.0L) - 108941.0L/16.0L) + 81361.0L/30.0L) - 322763.0L/720.0L) - 1.0L/20.0L) + 1.0L/12.0L) + 1.0L/3.0L) - 1.0L/2.0L) - 3.0L/20.0L) + 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/60.0L)*x - 81991.0L/10.0L) + 2458841.0L/120.0L) - 655039.0L/24.0L) + 326823.0L/16.0L) - 81361.0L/10.0L) + 322763.0L/240.0L) + 1.0L/8.0L) - 5.0L/48.0L) - 13.0L/12.0L) + 13.0L/16.0L) + 3.0L/2.0L) - 3.0L/4.0L;
-        poly_val[3] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-81991.0L/36.0L*x + 81991.0L/6.0L) - 2458841.0L/72.0L) + 3275195.0L/72.0L) - 544705.0L/16.0L) + 81361.0L/6.0L) - 322763.0L/144.0L) - 1.0L/6.0L) + 14.0L/9.0L) - 49.0L/18.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/36.0L)*x - 81991.0L/6.0L) + 2458841.0L/72.0L) - 3275195.0L/72.0L) + 544705.0L/16.0L) - 81361.0L/6.0L) + 322763.0L/144.0L) + 1.0L/8.0L) + 5.0L/48.0L) - 13.0L/12.0L) - 13.0L/16.0L) + 3.0L/2.0L) + 3.0L/4.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-81991.0L/60.0L*x + 81991.0L/10.0L) - 2458841.0L/120.0L) + 655039.0L/24.0L) - 326823.0L/16.0L) + 81361.0L/10.0L) - 322763.0L/240.0L) - 1.0L/20.0L) - 1.0L/12.0L) + 1.0L/3.0L) + 1.0L/2.0L) - 3.0L/20.0L) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/180.0L)*x - 81991.0L/30.0L) + 2458841.0L/360.0L) - 655039.0L/72.0L) + 108941.0L/16.0L) - 81361.0L/30.0L) + 322763.0L/720.0L) + 1.0L/120.0L) + 1.0L/48.0L) - 1.0L/36.0L) - 1.0L/16.0L) + 1.0L/90.0L) + 1.0L/60.0L;
-        poly_val[7] = pow(x, 6)*(x*(x*(x*(x*(x*(-11713.0L/180.0L*x + 11713.0L/30.0L) - 351263.0L/360.0L) + 93577.0L/72.0L) - 15563.0L/16.0L) + 11623.0L/30.0L) - 46109.0L/720.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 6, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11713.0L/15.0L)*x - 128843.0L/30.0L) + 351263.0L/36.0L) - 93577.0L/8.0L) + 15563.0L/2.0L) - 81361.0L/30.0L) + 46109.0L/120.0L) + 1.0L/24.0L) - 1.0L/12.0L) - 1.0L/12.0L) + 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-81991.0L/15.0L*x + 901901.0L/30.0L) - 2458841.0L/36.0L) + 655039.0L/8.0L) - 108941.0L/2.0L) + 569527.0L/30.0L) - 322763.0L/120.0L) - 1.0L/4.0L) + 1.0L/3.0L) + 1) - 1) - 3.0L/20.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/5.0L)*x - 901901.0L/10.0L) + 2458841.0L/12.0L) - 1965117.0L/8.0L) + 326823.0L/2.0L) - 569527.0L/10.0L) + 322763.0L/40.0L) + 5.0L/8.0L) - 5.0L/12.0L) - 13.0L/4.0L) + 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[3] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-81991.0L/3.0L*x + 901901.0L/6.0L) - 12294205.0L/36.0L) + 3275195.0L/8.0L) - 544705.0L/2.0L) + 569527.0L/6.0L) - 322763.0L/24.0L) - 5.0L/6.0L) + 14.0L/3.0L) - 49.0L/18.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/3.0L)*x - 901901.0L/6.0L) + 12294205.0L/36.0L) - 3275195.0L/8.0L) + 544705.0L/2.0L) - 569527.0L/6.0L) + 322763.0L/24.0L) + 5.0L/8.0L) + 5.0L/12.0L) - 13.0L/4.0L) - 13.0L/8.0L) + 3.0L/2.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-81991.0L/5.0L*x + 901901.0L/10.0L) - 2458841.0L/12.0L) + 1965117.0L/8.0L) - 326823.0L/2.0L) + 569527.0L/10.0L) - 322763.0L/40.0L) - 1.0L/4.0L) - 1.0L/3.0L) + 1) + 1) - 3.0L/20.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((81991.0L/15.0L)*x - 901901.0L/30.0L) + 2458841.0L/36.0L) - 655039.0L/8.0L) + 108941.0L/2.0L) - 569527.0L/30.0L) + 322763.0L/120.0L) + 1.0L/24.0L) + 1.0L/12.0L) - 1.0L/12.0L) - 1.0L/8.0L) + 1.0L/90.0L;
-        poly_val[7] = pow(x, 5)*(x*(x*(x*(x*(x*(-11713.0L/15.0L*x + 128843.0L/30.0L) - 351263.0L/36.0L) + 93577.0L/8.0L) - 15563.0L/2.0L) + 81361.0L/30.0L) - 46109.0L/120.0L);
+        evaluate_beta_polynomials<spline_polynomials<3, 6, 2>>(x, poly_val);
         break;
     }
 }
 
+template void beta_n3_m6<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n3_m6<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
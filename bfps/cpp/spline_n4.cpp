@@ -25,373 +25,1160 @@
 
 
 #include "spline_n4.hpp"
-#include <cmath>
-void beta_n4_m0(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = -x + 1;
-poly_val[5] = x;
-poly_val[6] = 0;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-break;
-case 1:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = -1;
-poly_val[5] = 1;
-poly_val[6] = 0;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-break;
-case 2:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = 0;
-poly_val[6] = 0;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-break;
-}
-}
-void beta_n4_m1(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*((1.0L/280.0L)*x - 1.0L/140.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(-29.0L/840.0L*x + 61.0L/840.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*((17.0L/105.0L)*x - 38.0L/105.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(-3.0L/5.0L*x + 7.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*((6.0L/5.0L)*x - 11.0L/5.0L) + 1;
-poly_val[5] = x*(x*(-6.0L/5.0L*x + 7.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*((3.0L/5.0L)*x - 2.0L/5.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(-17.0L/105.0L*x + 13.0L/105.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*((29.0L/840.0L)*x - 13.0L/420.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 2)*(-1.0L/280.0L*x + 1.0L/280.0L);
-break;
-case 1:
-poly_val[0] = x*((3.0L/280.0L)*x - 1.0L/70.0L) + 1.0L/280.0L;
-poly_val[1] = x*(-29.0L/280.0L*x + 61.0L/420.0L) - 4.0L/105.0L;
-poly_val[2] = x*((17.0L/35.0L)*x - 76.0L/105.0L) + 1.0L/5.0L;
-poly_val[3] = x*(-9.0L/5.0L*x + 14.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*((18.0L/5.0L)*x - 22.0L/5.0L);
-poly_val[5] = x*(-18.0L/5.0L*x + 14.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*((9.0L/5.0L)*x - 4.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(-17.0L/35.0L*x + 26.0L/105.0L) + 4.0L/105.0L;
-poly_val[8] = x*((29.0L/280.0L)*x - 13.0L/210.0L) - 1.0L/280.0L;
-poly_val[9] = x*(-3.0L/280.0L*x + 1.0L/140.0L);
-break;
-case 2:
-poly_val[0] = (3.0L/140.0L)*x - 1.0L/70.0L;
-poly_val[1] = -29.0L/140.0L*x + 61.0L/420.0L;
-poly_val[2] = (34.0L/35.0L)*x - 76.0L/105.0L;
-poly_val[3] = -18.0L/5.0L*x + 14.0L/5.0L;
-poly_val[4] = (36.0L/5.0L)*x - 22.0L/5.0L;
-poly_val[5] = -36.0L/5.0L*x + 14.0L/5.0L;
-poly_val[6] = (18.0L/5.0L)*x - 4.0L/5.0L;
-poly_val[7] = -34.0L/35.0L*x + 26.0L/105.0L;
-poly_val[8] = (29.0L/140.0L)*x - 13.0L/210.0L;
-poly_val[9] = -3.0L/140.0L*x + 1.0L/140.0L;
-break;
-}
-}
-void beta_n4_m2(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(-11.0L/1120.0L*x + 29.0L/1120.0L) - 3.0L/160.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*((907.0L/10080.0L)*x - 403.0L/1680.0L) + 589.0L/3360.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(-47.0L/126.0L*x + 127.0L/126.0L) - 463.0L/630.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*((9.0L/10.0L)*x - 12.0L/5.0L) + 3.0L/2.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(x*(x*(-991.0L/720.0L*x + 847.0L/240.0L) - 83.0L/48.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*((991.0L/720.0L)*x - 1207.0L/360.0L) + 991.0L/720.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(-9.0L/10.0L*x + 21.0L/10.0L) - 9.0L/10.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*((47.0L/126.0L)*x - 6.0L/7.0L) + 13.0L/30.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(-907.0L/10080.0L*x + 2117.0L/10080.0L) - 233.0L/2016.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 3)*(x*((11.0L/1120.0L)*x - 13.0L/560.0L) + 3.0L/224.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(-11.0L/224.0L*x + 29.0L/280.0L) - 9.0L/160.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*((907.0L/2016.0L)*x - 403.0L/420.0L) + 589.0L/1120.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(-235.0L/126.0L*x + 254.0L/63.0L) - 463.0L/210.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*((9.0L/2.0L)*x - 48.0L/5.0L) + 9.0L/2.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(x*(x*(-991.0L/144.0L*x + 847.0L/60.0L) - 83.0L/16.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*((991.0L/144.0L)*x - 1207.0L/90.0L) + 991.0L/240.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(-9.0L/2.0L*x + 42.0L/5.0L) - 27.0L/10.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*((235.0L/126.0L)*x - 24.0L/7.0L) + 13.0L/10.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(-907.0L/2016.0L*x + 2117.0L/2520.0L) - 233.0L/672.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 2)*(x*((11.0L/224.0L)*x - 13.0L/140.0L) + 9.0L/224.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(-11.0L/56.0L*x + 87.0L/280.0L) - 9.0L/80.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*((907.0L/504.0L)*x - 403.0L/140.0L) + 589.0L/560.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(-470.0L/63.0L*x + 254.0L/21.0L) - 463.0L/105.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(18*x - 144.0L/5.0L) + 9) + 8.0L/5.0L;
-poly_val[4] = x*(x*(-991.0L/36.0L*x + 847.0L/20.0L) - 83.0L/8.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*((991.0L/36.0L)*x - 1207.0L/30.0L) + 991.0L/120.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(-18*x + 126.0L/5.0L) - 27.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*((470.0L/63.0L)*x - 72.0L/7.0L) + 13.0L/5.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(-907.0L/504.0L*x + 2117.0L/840.0L) - 233.0L/336.0L) - 1.0L/560.0L;
-poly_val[9] = x*(x*((11.0L/56.0L)*x - 39.0L/140.0L) + 9.0L/112.0L);
-break;
-}
-}
-void beta_n4_m3(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*((55.0L/2016.0L)*x - 193.0L/2016.0L) + 191.0L/1680.0L) - 31.0L/720.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(-2477.0L/10080.0L*x + 69.0L/80.0L) - 10313.0L/10080.0L) + 481.0L/1260.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*((4957.0L/5040.0L)*x - 1087.0L/315.0L) + 10277.0L/2520.0L) - 31.0L/21.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(-551.0L/240.0L*x + 1159.0L/144.0L) - 2273.0L/240.0L) + 811.0L/240.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(x*(x*((31.0L/9.0L)*x - 193.0L/16.0L) + 1273.0L/90.0L) - 1837.0L/360.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(-31.0L/9.0L*x + 1735.0L/144.0L) - 5077.0L/360.0L) + 419.0L/80.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*((551.0L/240.0L)*x - 361.0L/45.0L) + 1127.0L/120.0L) - 18.0L/5.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(-4957.0L/5040.0L*x + 1923.0L/560.0L) - 20299.0L/5040.0L) + 227.0L/144.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*((2477.0L/10080.0L)*x - 247.0L/288.0L) + 5083.0L/5040.0L) - 667.0L/1680.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 4)*(x*(x*(-55.0L/2016.0L*x + 2.0L/21.0L) - 377.0L/3360.0L) + 223.0L/5040.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*((55.0L/288.0L)*x - 193.0L/336.0L) + 191.0L/336.0L) - 31.0L/180.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(-2477.0L/1440.0L*x + 207.0L/40.0L) - 10313.0L/2016.0L) + 481.0L/315.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*((4957.0L/720.0L)*x - 2174.0L/105.0L) + 10277.0L/504.0L) - 124.0L/21.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(-3857.0L/240.0L*x + 1159.0L/24.0L) - 2273.0L/48.0L) + 811.0L/60.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(x*(x*((217.0L/9.0L)*x - 579.0L/8.0L) + 1273.0L/18.0L) - 1837.0L/90.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(-217.0L/9.0L*x + 1735.0L/24.0L) - 5077.0L/72.0L) + 419.0L/20.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*((3857.0L/240.0L)*x - 722.0L/15.0L) + 1127.0L/24.0L) - 72.0L/5.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(-4957.0L/720.0L*x + 5769.0L/280.0L) - 20299.0L/1008.0L) + 227.0L/36.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*((2477.0L/1440.0L)*x - 247.0L/48.0L) + 5083.0L/1008.0L) - 667.0L/420.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 3)*(x*(x*(-55.0L/288.0L*x + 4.0L/7.0L) - 377.0L/672.0L) + 223.0L/1260.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*((55.0L/48.0L)*x - 965.0L/336.0L) + 191.0L/84.0L) - 31.0L/60.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(-2477.0L/240.0L*x + 207.0L/8.0L) - 10313.0L/504.0L) + 481.0L/105.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*((4957.0L/120.0L)*x - 2174.0L/21.0L) + 10277.0L/126.0L) - 124.0L/7.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(-3857.0L/40.0L*x + 5795.0L/24.0L) - 2273.0L/12.0L) + 811.0L/20.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(x*(x*((434.0L/3.0L)*x - 2895.0L/8.0L) + 2546.0L/9.0L) - 1837.0L/30.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(-434.0L/3.0L*x + 8675.0L/24.0L) - 5077.0L/18.0L) + 1257.0L/20.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*((3857.0L/40.0L)*x - 722.0L/3.0L) + 1127.0L/6.0L) - 216.0L/5.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(-4957.0L/120.0L*x + 5769.0L/56.0L) - 20299.0L/252.0L) + 227.0L/12.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*((2477.0L/240.0L)*x - 1235.0L/48.0L) + 5083.0L/252.0L) - 667.0L/140.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 2)*(x*(x*(-55.0L/48.0L*x + 20.0L/7.0L) - 377.0L/168.0L) + 223.0L/420.0L);
-break;
-}
-}
-void beta_n4_m4(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-3569.0L/40320.0L*x + 16061.0L/40320.0L) - 1961.0L/2880.0L) + 503.0L/960.0L) - 175.0L/1152.0L) + 7.0L/5760.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((3569.0L/4480.0L)*x - 36137.0L/10080.0L) + 41179.0L/6720.0L) - 2263.0L/480.0L) + 175.0L/128.0L) - 1.0L/60.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-3569.0L/1120.0L*x + 144547.0L/10080.0L) - 30883.0L/1260.0L) + 13577.0L/720.0L) - 1579.0L/288.0L) + 169.0L/1440.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((3569.0L/480.0L)*x - 24091.0L/720.0L) + 5147.0L/90.0L) - 31681.0L/720.0L) + 3697.0L/288.0L) - 61.0L/180.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-3569.0L/320.0L*x + 28909.0L/576.0L) - 2745.0L/32.0L) + 6337.0L/96.0L) - 6181.0L/320.0L) + 91.0L/192.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((3569.0L/320.0L)*x - 4517.0L/90.0L) + 123523.0L/1440.0L) - 2971.0L/45.0L) + 11149.0L/576.0L) - 61.0L/180.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-3569.0L/480.0L*x + 48181.0L/1440.0L) - 20587.0L/360.0L) + 31697.0L/720.0L) - 3719.0L/288.0L) + 169.0L/1440.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((3569.0L/1120.0L)*x - 72271.0L/5040.0L) + 2941.0L/120.0L) - 4529.0L/240.0L) + 177.0L/32.0L) - 1.0L/60.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-3569.0L/4480.0L*x + 144541.0L/40320.0L) - 123523.0L/20160.0L) + 13589.0L/2880.0L) - 1591.0L/1152.0L) + 7.0L/5760.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 5)*(x*(x*(x*((3569.0L/40320.0L)*x - 803.0L/2016.0L) + 305.0L/448.0L) - 151.0L/288.0L) + 883.0L/5760.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-3569.0L/4480.0L*x + 16061.0L/5040.0L) - 13727.0L/2880.0L) + 503.0L/160.0L) - 875.0L/1152.0L) + 7.0L/1440.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*((32121.0L/4480.0L)*x - 36137.0L/1260.0L) + 41179.0L/960.0L) - 2263.0L/80.0L) + 875.0L/128.0L) - 1.0L/15.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(-32121.0L/1120.0L*x + 144547.0L/1260.0L) - 30883.0L/180.0L) + 13577.0L/120.0L) - 7895.0L/288.0L) + 169.0L/360.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*((10707.0L/160.0L)*x - 24091.0L/90.0L) + 36029.0L/90.0L) - 31681.0L/120.0L) + 18485.0L/288.0L) - 61.0L/45.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(x*(x*(x*(x*(-32121.0L/320.0L*x + 28909.0L/72.0L) - 19215.0L/32.0L) + 6337.0L/16.0L) - 6181.0L/64.0L) + 91.0L/48.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*((32121.0L/320.0L)*x - 18068.0L/45.0L) + 864661.0L/1440.0L) - 5942.0L/15.0L) + 55745.0L/576.0L) - 61.0L/45.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(-10707.0L/160.0L*x + 48181.0L/180.0L) - 144109.0L/360.0L) + 31697.0L/120.0L) - 18595.0L/288.0L) + 169.0L/360.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*((32121.0L/1120.0L)*x - 72271.0L/630.0L) + 20587.0L/120.0L) - 4529.0L/40.0L) + 885.0L/32.0L) - 1.0L/15.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(-32121.0L/4480.0L*x + 144541.0L/5040.0L) - 123523.0L/2880.0L) + 13589.0L/480.0L) - 7955.0L/1152.0L) + 7.0L/1440.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 4)*(x*(x*(x*((3569.0L/4480.0L)*x - 803.0L/252.0L) + 305.0L/64.0L) - 151.0L/48.0L) + 883.0L/1152.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(-3569.0L/560.0L*x + 16061.0L/720.0L) - 13727.0L/480.0L) + 503.0L/32.0L) - 875.0L/288.0L) + 7.0L/480.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*((32121.0L/560.0L)*x - 36137.0L/180.0L) + 41179.0L/160.0L) - 2263.0L/16.0L) + 875.0L/32.0L) - 1.0L/5.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(-32121.0L/140.0L*x + 144547.0L/180.0L) - 30883.0L/30.0L) + 13577.0L/24.0L) - 7895.0L/72.0L) + 169.0L/120.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*((10707.0L/20.0L)*x - 168637.0L/90.0L) + 36029.0L/15.0L) - 31681.0L/24.0L) + 18485.0L/72.0L) - 61.0L/15.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(x*(x*(x*(x*(-32121.0L/40.0L*x + 202363.0L/72.0L) - 57645.0L/16.0L) + 31685.0L/16.0L) - 6181.0L/16.0L) + 91.0L/16.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*((32121.0L/40.0L)*x - 126476.0L/45.0L) + 864661.0L/240.0L) - 5942.0L/3.0L) + 55745.0L/144.0L) - 61.0L/15.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(-10707.0L/20.0L*x + 337267.0L/180.0L) - 144109.0L/60.0L) + 31697.0L/24.0L) - 18595.0L/72.0L) + 169.0L/120.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*((32121.0L/140.0L)*x - 72271.0L/90.0L) + 20587.0L/20.0L) - 4529.0L/8.0L) + 885.0L/8.0L) - 1.0L/5.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(-32121.0L/560.0L*x + 144541.0L/720.0L) - 123523.0L/480.0L) + 13589.0L/96.0L) - 7955.0L/288.0L) + 7.0L/480.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 3)*(x*(x*(x*((3569.0L/560.0L)*x - 803.0L/36.0L) + 915.0L/32.0L) - 755.0L/48.0L) + 883.0L/288.0L);
-break;
-}
+#include "beta_polynomials.hpp"
+
+template <>
+struct spline_polynomials<4, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         -1.0, 1.0, 0, 0,
+         0, 0},
+        {0, 0, 0, 0,
+         0.5, 0.5, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<4, 0, 0>::coefficients[2][10];
+
+template <>
+struct spline_polynomials<4, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         -1.0, 1.0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<4, 0, 1>::coefficients[1][10];
+
+template <>
+struct spline_polynomials<4, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<4, 0, 2>::coefficients[1][10];
+
+template <class real_number>
+void beta_n4_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 0, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 0, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 0, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n4_m5(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((883.0L/2880.0L)*x - 9713.0L/5760.0L) + 37739.0L/10080.0L) - 169369.0L/40320.0L) + 6869.0L/2880.0L) - 3163.0L/5760.0L) + 1.0L/720.0L) + 7.0L/5760.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-883.0L/320.0L*x + 9713.0L/640.0L) - 37739.0L/1120.0L) + 762161.0L/20160.0L) - 144251.0L/6720.0L) + 9491.0L/1920.0L) - 1.0L/80.0L) - 1.0L/60.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((883.0L/80.0L)*x - 9713.0L/160.0L) + 37739.0L/280.0L) - 1524323.0L/10080.0L) + 216379.0L/2520.0L) - 5695.0L/288.0L) + 13.0L/360.0L) + 169.0L/1440.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6181.0L/240.0L*x + 67991.0L/480.0L) - 37739.0L/120.0L) + 127027.0L/360.0L) - 72127.0L/360.0L) + 66439.0L/1440.0L) - 29.0L/720.0L) - 61.0L/180.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((6181.0L/160.0L)*x - 67991.0L/320.0L) + 37739.0L/80.0L) - 304865.0L/576.0L) + 9617.0L/32.0L) - 66431.0L/960.0L) + 91.0L/192.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6181.0L/160.0L*x + 67991.0L/320.0L) - 37739.0L/80.0L) + 762163.0L/1440.0L) - 432767.0L/1440.0L) + 199259.0L/2880.0L) + 29.0L/720.0L) - 61.0L/180.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6181.0L/240.0L)*x - 67991.0L/480.0L) + 37739.0L/120.0L) - 508109.0L/1440.0L) + 9016.0L/45.0L) - 66407.0L/1440.0L) - 13.0L/360.0L) + 169.0L/1440.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-883.0L/80.0L*x + 9713.0L/160.0L) - 37739.0L/280.0L) + 190541.0L/1260.0L) - 1288.0L/15.0L) + 1897.0L/96.0L) + 1.0L/80.0L) - 1.0L/60.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((883.0L/320.0L)*x - 9713.0L/640.0L) + 37739.0L/1120.0L) - 1524329.0L/40320.0L) + 432767.0L/20160.0L) - 28451.0L/5760.0L) - 1.0L/720.0L) + 7.0L/5760.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 6)*(x*(x*(x*(x*(-883.0L/2880.0L*x + 9713.0L/5760.0L) - 37739.0L/10080.0L) + 16937.0L/4032.0L) - 9617.0L/4032.0L) + 3161.0L/5760.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/2880.0L)*x - 9713.0L/576.0L) + 37739.0L/1120.0L) - 169369.0L/5040.0L) + 48083.0L/2880.0L) - 3163.0L/960.0L) + 1.0L/144.0L) + 7.0L/1440.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-9713.0L/320.0L*x + 9713.0L/64.0L) - 339651.0L/1120.0L) + 762161.0L/2520.0L) - 144251.0L/960.0L) + 9491.0L/320.0L) - 1.0L/16.0L) - 1.0L/15.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/80.0L)*x - 9713.0L/16.0L) + 339651.0L/280.0L) - 1524323.0L/1260.0L) + 216379.0L/360.0L) - 5695.0L/48.0L) + 13.0L/72.0L) + 169.0L/360.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-67991.0L/240.0L*x + 67991.0L/48.0L) - 113217.0L/40.0L) + 127027.0L/45.0L) - 504889.0L/360.0L) + 66439.0L/240.0L) - 29.0L/144.0L) - 61.0L/45.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((67991.0L/160.0L)*x - 67991.0L/32.0L) + 339651.0L/80.0L) - 304865.0L/72.0L) + 67319.0L/32.0L) - 66431.0L/160.0L) + 91.0L/48.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-67991.0L/160.0L*x + 67991.0L/32.0L) - 339651.0L/80.0L) + 762163.0L/180.0L) - 3029369.0L/1440.0L) + 199259.0L/480.0L) + 29.0L/144.0L) - 61.0L/45.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*((67991.0L/240.0L)*x - 67991.0L/48.0L) + 113217.0L/40.0L) - 508109.0L/180.0L) + 63112.0L/45.0L) - 66407.0L/240.0L) - 13.0L/72.0L) + 169.0L/360.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-9713.0L/80.0L*x + 9713.0L/16.0L) - 339651.0L/280.0L) + 381082.0L/315.0L) - 9016.0L/15.0L) + 1897.0L/16.0L) + 1.0L/16.0L) - 1.0L/15.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/320.0L)*x - 9713.0L/64.0L) + 339651.0L/1120.0L) - 1524329.0L/5040.0L) + 432767.0L/2880.0L) - 28451.0L/960.0L) - 1.0L/144.0L) + 7.0L/1440.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 5)*(x*(x*(x*(x*(-9713.0L/2880.0L*x + 9713.0L/576.0L) - 37739.0L/1120.0L) + 16937.0L/504.0L) - 9617.0L/576.0L) + 3161.0L/960.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/288.0L)*x - 9713.0L/64.0L) + 37739.0L/140.0L) - 169369.0L/720.0L) + 48083.0L/480.0L) - 3163.0L/192.0L) + 1.0L/36.0L) + 7.0L/480.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-9713.0L/32.0L*x + 87417.0L/64.0L) - 339651.0L/140.0L) + 762161.0L/360.0L) - 144251.0L/160.0L) + 9491.0L/64.0L) - 1.0L/4.0L) - 1.0L/5.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/8.0L)*x - 87417.0L/16.0L) + 339651.0L/35.0L) - 1524323.0L/180.0L) + 216379.0L/60.0L) - 28475.0L/48.0L) + 13.0L/18.0L) + 169.0L/120.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(-67991.0L/24.0L*x + 203973.0L/16.0L) - 113217.0L/5.0L) + 889189.0L/45.0L) - 504889.0L/60.0L) + 66439.0L/48.0L) - 29.0L/36.0L) - 61.0L/15.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((67991.0L/16.0L)*x - 611919.0L/32.0L) + 339651.0L/10.0L) - 2134055.0L/72.0L) + 201957.0L/16.0L) - 66431.0L/32.0L) + 91.0L/16.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(-67991.0L/16.0L*x + 611919.0L/32.0L) - 339651.0L/10.0L) + 5335141.0L/180.0L) - 3029369.0L/240.0L) + 199259.0L/96.0L) + 29.0L/36.0L) - 61.0L/15.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*((67991.0L/24.0L)*x - 203973.0L/16.0L) + 113217.0L/5.0L) - 3556763.0L/180.0L) + 126224.0L/15.0L) - 66407.0L/48.0L) - 13.0L/18.0L) + 169.0L/120.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(-9713.0L/8.0L*x + 87417.0L/16.0L) - 339651.0L/35.0L) + 381082.0L/45.0L) - 18032.0L/5.0L) + 9485.0L/16.0L) + 1.0L/4.0L) - 1.0L/5.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*((9713.0L/32.0L)*x - 87417.0L/64.0L) + 339651.0L/140.0L) - 1524329.0L/720.0L) + 432767.0L/480.0L) - 28451.0L/192.0L) - 1.0L/36.0L) + 7.0L/480.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 4)*(x*(x*(x*(x*(-9713.0L/288.0L*x + 9713.0L/64.0L) - 37739.0L/140.0L) + 16937.0L/72.0L) - 9617.0L/96.0L) + 3161.0L/192.0L);
-break;
+
+template void beta_n4_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0035714285714285713, -0.034523809523809526, 0.1619047619047619, -0.6,
+         1.2, -1.2, 0.6, -0.1619047619047619,
+         0.034523809523809526, -0.0035714285714285713},
+        {-0.0017857142857142857, 0.020833333333333332, -0.11904761904761904, 0.5,
+         -0.4, -0.4, 0.5, -0.11904761904761904,
+         0.020833333333333332, -0.0017857142857142857},
+        {-0.0008928571428571428, 0.008630952380952382, -0.04047619047619048, 0.15,
+         -1.3, 1.3, -0.15, 0.04047619047619048,
+         -0.008630952380952382, 0.0008928571428571428},
+        {0.0004464285714285714, -0.005208333333333333, 0.02976190476190476, -0.125,
+         0.6, 0.6, -0.125, 0.02976190476190476,
+         -0.005208333333333333, 0.0004464285714285714}};
+};
+constexpr double spline_polynomials<4, 1, 0>::coefficients[4][10];
+
+template <>
+struct spline_polynomials<4, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.010714285714285714, -0.10357142857142858, 0.4857142857142857, -1.8,
+         3.6, -3.6, 1.8, -0.4857142857142857,
+         0.10357142857142858, -0.010714285714285714},
+        {-0.0035714285714285713, 0.041666666666666664, -0.23809523809523808, 1.0,
+         -0.8, -0.8, 1.0, -0.23809523809523808,
+         0.041666666666666664, -0.0035714285714285713},
+        {-0.0008928571428571428, 0.008630952380952382, -0.04047619047619048, 0.15,
+         -1.3, 1.3, -0.15, 0.04047619047619048,
+         -0.008630952380952382, 0.0008928571428571428}};
+};
+constexpr double spline_polynomials<4, 1, 1>::coefficients[3][10];
+
+template <>
+struct spline_polynomials<4, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.02142857142857143, -0.20714285714285716, 0.9714285714285714, -3.6,
+         7.2, -7.2, 3.6, -0.9714285714285714,
+         0.20714285714285716, -0.02142857142857143},
+        {-0.0035714285714285713, 0.041666666666666664, -0.23809523809523808, 1.0,
+         -0.8, -0.8, 1.0, -0.23809523809523808,
+         0.041666666666666664, -0.0035714285714285713}};
+};
+constexpr double spline_polynomials<4, 1, 2>::coefficients[2][10];
+
+template <class real_number>
+void beta_n4_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 1, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 1, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 1, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n4_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.009821428571428571, 0.08998015873015873, -0.373015873015873, 0.9,
+         -1.3763888888888889, 1.3763888888888889, -0.9, 0.373015873015873,
+         -0.08998015873015873, 0.009821428571428571},
+        {0.0013392857142857143, -0.014930555555555556, 0.07539682539682539, -0.15,
+         0.08819444444444445, 0.08819444444444445, -0.15, 0.07539682539682539,
+         -0.014930555555555556, 0.0013392857142857143},
+        {0.008482142857142856, -0.07951388888888888, 0.3484126984126984, -1.05,
+         1.8881944444444445, -1.8881944444444445, 1.05, -0.3484126984126984,
+         0.07951388888888888, -0.008482142857142856},
+        {-0.002455357142857143, 0.02829861111111111, -0.15674603174603174, 0.575,
+         -0.4440972222222222, -0.4440972222222222, 0.575, -0.15674603174603174,
+         0.02829861111111111, -0.002455357142857143},
+        {-0.0015066964285714286, 0.014254712301587301, -0.06378968253968254, 0.20625,
+         -1.3860243055555554, 1.3860243055555554, -0.20625, 0.06378968253968254,
+         -0.014254712301587301, 0.0015066964285714286},
+        {0.0005301339285714285, -0.006141493055555555, 0.03447420634920635, -0.134375,
+         0.6055121527777778, 0.6055121527777778, -0.134375, 0.03447420634920635,
+         -0.006141493055555555, 0.0005301339285714285}};
+};
+constexpr double spline_polynomials<4, 2, 0>::coefficients[6][10];
+
+template <>
+struct spline_polynomials<4, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.049107142857142856, 0.44990079365079366, -1.8650793650793651, 4.5,
+         -6.881944444444445, 6.881944444444445, -4.5, 1.8650793650793651,
+         -0.44990079365079366, 0.049107142857142856},
+        {0.005357142857142857, -0.059722222222222225, 0.30158730158730157, -0.6,
+         0.3527777777777778, 0.3527777777777778, -0.6, 0.30158730158730157,
+         -0.059722222222222225, 0.005357142857142857},
+        {0.02544642857142857, -0.23854166666666668, 1.0452380952380953, -3.15,
+         5.664583333333334, -5.664583333333334, 3.15, -1.0452380952380953,
+         0.23854166666666668, -0.02544642857142857},
+        {-0.004910714285714286, 0.05659722222222222, -0.3134920634920635, 1.15,
+         -0.8881944444444444, -0.8881944444444444, 1.15, -0.3134920634920635,
+         0.05659722222222222, -0.004910714285714286},
+        {-0.0015066964285714286, 0.014254712301587301, -0.06378968253968254, 0.20625,
+         -1.3860243055555554, 1.3860243055555554, -0.20625, 0.06378968253968254,
+         -0.014254712301587301, 0.0015066964285714286}};
+};
+constexpr double spline_polynomials<4, 2, 1>::coefficients[5][10];
+
+template <>
+struct spline_polynomials<4, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.19642857142857142, 1.7996031746031746, -7.4603174603174605, 18.0,
+         -27.52777777777778, 27.52777777777778, -18.0, 7.4603174603174605,
+         -1.7996031746031746, 0.19642857142857142},
+        {0.01607142857142857, -0.17916666666666667, 0.9047619047619048, -1.8,
+         1.0583333333333333, 1.0583333333333333, -1.8, 0.9047619047619048,
+         -0.17916666666666667, 0.01607142857142857},
+        {0.05089285714285714, -0.47708333333333336, 2.0904761904761906, -6.3,
+         11.329166666666667, -11.329166666666667, 6.3, -2.0904761904761906,
+         0.47708333333333336, -0.05089285714285714},
+        {-0.004910714285714286, 0.05659722222222222, -0.3134920634920635, 1.15,
+         -0.8881944444444444, -0.8881944444444444, 1.15, -0.3134920634920635,
+         0.05659722222222222, -0.004910714285714286}};
+};
+constexpr double spline_polynomials<4, 2, 2>::coefficients[4][10];
+
+template <class real_number>
+void beta_n4_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 2, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 2, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 2, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n4_m6(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3161.0L/2880.0L*x + 41093.0L/5760.0L) - 11203.0L/576.0L) + 9119.0L/320.0L) - 477697.0L/20160.0L) + 21403.0L/2016.0L) - 385.0L/192.0L) - 1.0L/2880.0L) + 1.0L/720.0L) + 7.0L/5760.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((3161.0L/320.0L)*x - 41093.0L/640.0L) + 11203.0L/64.0L) - 82071.0L/320.0L) + 477697.0L/2240.0L) - 3852539.0L/40320.0L) + 121273.0L/6720.0L) + 1.0L/240.0L) - 1.0L/80.0L) - 1.0L/60.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3161.0L/80.0L*x + 41093.0L/160.0L) - 11203.0L/16.0L) + 82071.0L/80.0L) - 477697.0L/560.0L) + 1926269.0L/5040.0L) - 181907.0L/2520.0L) - 13.0L/720.0L) + 13.0L/360.0L) + 169.0L/1440.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((22127.0L/240.0L)*x - 287651.0L/480.0L) + 78421.0L/48.0L) - 191499.0L/80.0L) + 477697.0L/240.0L) - 1284179.0L/1440.0L) + 12127.0L/72.0L) + 29.0L/720.0L) - 29.0L/720.0L) - 61.0L/180.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-22127.0L/160.0L*x + 287651.0L/320.0L) - 78421.0L/32.0L) + 574497.0L/160.0L) - 477697.0L/160.0L) + 481567.0L/360.0L) - 40423.0L/160.0L) - 5.0L/96.0L) + 91.0L/192.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((22127.0L/160.0L)*x - 287651.0L/320.0L) + 78421.0L/32.0L) - 574497.0L/160.0L) + 477697.0L/160.0L) - 770507.0L/576.0L) + 72761.0L/288.0L) + 29.0L/720.0L) + 29.0L/720.0L) - 61.0L/180.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-22127.0L/240.0L*x + 287651.0L/480.0L) - 78421.0L/48.0L) + 191499.0L/80.0L) - 477697.0L/240.0L) + 642089.0L/720.0L) - 30317.0L/180.0L) - 13.0L/720.0L) - 13.0L/360.0L) + 169.0L/1440.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((3161.0L/80.0L)*x - 41093.0L/160.0L) + 11203.0L/16.0L) - 82071.0L/80.0L) + 477697.0L/560.0L) - 3852533.0L/10080.0L) + 4331.0L/60.0L) + 1.0L/240.0L) + 1.0L/80.0L) - 1.0L/60.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-3161.0L/320.0L*x + 41093.0L/640.0L) - 11203.0L/64.0L) + 82071.0L/320.0L) - 477697.0L/2240.0L) + 963133.0L/10080.0L) - 72761.0L/4032.0L) - 1.0L/2880.0L) - 1.0L/720.0L) + 7.0L/5760.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 7)*(x*(x*(x*(x*(x*((3161.0L/2880.0L)*x - 41093.0L/5760.0L) + 11203.0L/576.0L) - 9119.0L/320.0L) + 477697.0L/20160.0L) - 428059.0L/40320.0L) + 40423.0L/20160.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-41093.0L/2880.0L*x + 41093.0L/480.0L) - 123233.0L/576.0L) + 9119.0L/32.0L) - 477697.0L/2240.0L) + 21403.0L/252.0L) - 2695.0L/192.0L) - 1.0L/480.0L) + 1.0L/144.0L) + 7.0L/1440.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((41093.0L/320.0L)*x - 123279.0L/160.0L) + 123233.0L/64.0L) - 82071.0L/32.0L) + 4299273.0L/2240.0L) - 3852539.0L/5040.0L) + 121273.0L/960.0L) + 1.0L/40.0L) - 1.0L/16.0L) - 1.0L/15.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-41093.0L/80.0L*x + 123279.0L/40.0L) - 123233.0L/16.0L) + 82071.0L/8.0L) - 4299273.0L/560.0L) + 1926269.0L/630.0L) - 181907.0L/360.0L) - 13.0L/120.0L) + 13.0L/72.0L) + 169.0L/360.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((287651.0L/240.0L)*x - 287651.0L/40.0L) + 862631.0L/48.0L) - 191499.0L/8.0L) + 1433091.0L/80.0L) - 1284179.0L/180.0L) + 84889.0L/72.0L) + 29.0L/120.0L) - 29.0L/144.0L) - 61.0L/45.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-287651.0L/160.0L*x + 862953.0L/80.0L) - 862631.0L/32.0L) + 574497.0L/16.0L) - 4299273.0L/160.0L) + 481567.0L/45.0L) - 282961.0L/160.0L) - 5.0L/16.0L) + 91.0L/48.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((287651.0L/160.0L)*x - 862953.0L/80.0L) + 862631.0L/32.0L) - 574497.0L/16.0L) + 4299273.0L/160.0L) - 770507.0L/72.0L) + 509327.0L/288.0L) + 29.0L/120.0L) + 29.0L/144.0L) - 61.0L/45.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-287651.0L/240.0L*x + 287651.0L/40.0L) - 862631.0L/48.0L) + 191499.0L/8.0L) - 1433091.0L/80.0L) + 642089.0L/90.0L) - 212219.0L/180.0L) - 13.0L/120.0L) - 13.0L/72.0L) + 169.0L/360.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((41093.0L/80.0L)*x - 123279.0L/40.0L) + 123233.0L/16.0L) - 82071.0L/8.0L) + 4299273.0L/560.0L) - 3852533.0L/1260.0L) + 30317.0L/60.0L) + 1.0L/40.0L) + 1.0L/16.0L) - 1.0L/15.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-41093.0L/320.0L*x + 123279.0L/160.0L) - 123233.0L/64.0L) + 82071.0L/32.0L) - 4299273.0L/2240.0L) + 963133.0L/1260.0L) - 72761.0L/576.0L) - 1.0L/480.0L) - 1.0L/144.0L) + 7.0L/1440.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 6)*(x*(x*(x*(x*(x*((41093.0L/2880.0L)*x - 41093.0L/480.0L) + 123233.0L/576.0L) - 9119.0L/32.0L) + 477697.0L/2240.0L) - 428059.0L/5040.0L) + 40423.0L/2880.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-41093.0L/240.0L*x + 452023.0L/480.0L) - 616165.0L/288.0L) + 82071.0L/32.0L) - 477697.0L/280.0L) + 21403.0L/36.0L) - 2695.0L/32.0L) - 1.0L/96.0L) + 1.0L/36.0L) + 7.0L/480.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((123279.0L/80.0L)*x - 1356069.0L/160.0L) + 616165.0L/32.0L) - 738639.0L/32.0L) + 4299273.0L/280.0L) - 3852539.0L/720.0L) + 121273.0L/160.0L) + 1.0L/8.0L) - 1.0L/4.0L) - 1.0L/5.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-123279.0L/20.0L*x + 1356069.0L/40.0L) - 616165.0L/8.0L) + 738639.0L/8.0L) - 4299273.0L/70.0L) + 1926269.0L/90.0L) - 181907.0L/60.0L) - 13.0L/24.0L) + 13.0L/18.0L) + 169.0L/120.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((287651.0L/20.0L)*x - 3164161.0L/40.0L) + 4313155.0L/24.0L) - 1723491.0L/8.0L) + 1433091.0L/10.0L) - 8989253.0L/180.0L) + 84889.0L/12.0L) + 29.0L/24.0L) - 29.0L/36.0L) - 61.0L/15.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-862953.0L/40.0L*x + 9492483.0L/80.0L) - 4313155.0L/16.0L) + 5170473.0L/16.0L) - 4299273.0L/20.0L) + 3370969.0L/45.0L) - 848883.0L/80.0L) - 25.0L/16.0L) + 91.0L/16.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((862953.0L/40.0L)*x - 9492483.0L/80.0L) + 4313155.0L/16.0L) - 5170473.0L/16.0L) + 4299273.0L/20.0L) - 5393549.0L/72.0L) + 509327.0L/48.0L) + 29.0L/24.0L) + 29.0L/36.0L) - 61.0L/15.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-287651.0L/20.0L*x + 3164161.0L/40.0L) - 4313155.0L/24.0L) + 1723491.0L/8.0L) - 1433091.0L/10.0L) + 4494623.0L/90.0L) - 212219.0L/30.0L) - 13.0L/24.0L) - 13.0L/18.0L) + 169.0L/120.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((123279.0L/20.0L)*x - 1356069.0L/40.0L) + 616165.0L/8.0L) - 738639.0L/8.0L) + 4299273.0L/70.0L) - 3852533.0L/180.0L) + 30317.0L/10.0L) + 1.0L/8.0L) + 1.0L/4.0L) - 1.0L/5.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-123279.0L/80.0L*x + 1356069.0L/160.0L) - 616165.0L/32.0L) + 738639.0L/32.0L) - 4299273.0L/280.0L) + 963133.0L/180.0L) - 72761.0L/96.0L) - 1.0L/96.0L) - 1.0L/36.0L) + 7.0L/480.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 5)*(x*(x*(x*(x*(x*((41093.0L/240.0L)*x - 452023.0L/480.0L) + 616165.0L/288.0L) - 82071.0L/32.0L) + 477697.0L/280.0L) - 428059.0L/720.0L) + 40423.0L/480.0L);
-break;
+
+template void beta_n4_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.027281746031746032, -0.24573412698412697, 0.983531746031746, -2.2958333333333334,
+         3.4444444444444446, -3.4444444444444446, 2.2958333333333334, -0.983531746031746,
+         0.24573412698412697, -0.027281746031746032},
+        {-0.000248015873015873, 0.0024305555555555556, -0.008432539682539682, 0.013194444444444444,
+         -0.006944444444444444, -0.006944444444444444, 0.013194444444444444, -0.008432539682539682,
+         0.0024305555555555556, -0.000248015873015873},
+        {-0.030282738095238095, 0.27428075396825397, -1.1106646825396826, 2.621875,
+         -3.959722222222222, 3.959722222222222, -2.621875, 1.1106646825396826,
+         -0.27428075396825397, 0.030282738095238095},
+        {0.001525297619047619, -0.01675347222222222, 0.08172123015873016, -0.15989583333333332,
+         0.09340277777777778, 0.09340277777777778, -0.15989583333333332, 0.08172123015873016,
+         -0.01675347222222222, 0.001525297619047619},
+        {0.013597470238095238, -0.1255890376984127, 0.5328249007936507, -1.48046875,
+         2.5340277777777778, -2.5340277777777778, 1.48046875, -0.5328249007936507,
+         0.1255890376984127, -0.013597470238095238},
+        {-0.002501860119047619, 0.028754340277777776, -0.15832713293650794, 0.5774739583333334,
+         -0.44539930555555557, -0.44539930555555557, 0.5774739583333334, -0.15832713293650794,
+         0.028754340277777776, -0.002501860119047619},
+        {-0.0019329737103174604, 0.018094308035714286, -0.07915736607142858, 0.24212239583333334,
+         -1.43984375, 1.43984375, -0.24212239583333334, 0.07915736607142858,
+         -0.018094308035714286, 0.0019329737103174604},
+        {0.0005340091765873015, -0.006179470486111111, 0.03460596478174603, -0.13458116319444444,
+         0.6056206597222222, 0.6056206597222222, -0.13458116319444444, 0.03460596478174603,
+         -0.006179470486111111, 0.0005340091765873015}};
+};
+constexpr double spline_polynomials<4, 3, 0>::coefficients[8][10];
+
+template <>
+struct spline_polynomials<4, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.1909722222222222, -1.7201388888888889, 6.884722222222222, -16.070833333333333,
+         24.11111111111111, -24.11111111111111, 16.070833333333333, -6.884722222222222,
+         1.7201388888888889, -0.1909722222222222},
+        {-0.001488095238095238, 0.014583333333333334, -0.050595238095238096, 0.07916666666666666,
+         -0.041666666666666664, -0.041666666666666664, 0.07916666666666666, -0.050595238095238096,
+         0.014583333333333334, -0.001488095238095238},
+        {-0.15141369047619047, 1.3714037698412698, -5.553323412698413, 13.109375,
+         -19.79861111111111, 19.79861111111111, -13.109375, 5.553323412698413,
+         -1.3714037698412698, 0.15141369047619047},
+        {0.006101190476190476, -0.06701388888888889, 0.32688492063492064, -0.6395833333333333,
+         0.3736111111111111, 0.3736111111111111, -0.6395833333333333, 0.32688492063492064,
+         -0.06701388888888889, 0.006101190476190476},
+        {0.040792410714285715, -0.3767671130952381, 1.5984747023809525, -4.44140625,
+         7.602083333333334, -7.602083333333334, 4.44140625, -1.5984747023809525,
+         0.3767671130952381, -0.040792410714285715},
+        {-0.005003720238095238, 0.05750868055555555, -0.31665426587301587, 1.1549479166666667,
+         -0.8907986111111111, -0.8907986111111111, 1.1549479166666667, -0.31665426587301587,
+         0.05750868055555555, -0.005003720238095238},
+        {-0.0019329737103174604, 0.018094308035714286, -0.07915736607142858, 0.24212239583333334,
+         -1.43984375, 1.43984375, -0.24212239583333334, 0.07915736607142858,
+         -0.018094308035714286, 0.0019329737103174604}};
+};
+constexpr double spline_polynomials<4, 3, 1>::coefficients[7][10];
+
+template <>
+struct spline_polynomials<4, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {1.1458333333333333, -10.320833333333333, 41.30833333333333, -96.425,
+         144.66666666666666, -144.66666666666666, 96.425, -41.30833333333333,
+         10.320833333333333, -1.1458333333333333},
+        {-0.00744047619047619, 0.07291666666666667, -0.25297619047619047, 0.3958333333333333,
+         -0.20833333333333334, -0.20833333333333334, 0.3958333333333333, -0.25297619047619047,
+         0.07291666666666667, -0.00744047619047619},
+        {-0.6056547619047619, 5.485615079365079, -22.213293650793652, 52.4375,
+         -79.19444444444444, 79.19444444444444, -52.4375, 22.213293650793652,
+         -5.485615079365079, 0.6056547619047619},
+        {0.01830357142857143, -0.20104166666666667, 0.9806547619047619, -1.91875,
+         1.1208333333333333, 1.1208333333333333, -1.91875, 0.9806547619047619,
+         -0.20104166666666667, 0.01830357142857143},
+        {0.08158482142857143, -0.7535342261904762, 3.196949404761905, -8.8828125,
+         15.204166666666667, -15.204166666666667, 8.8828125, -3.196949404761905,
+         0.7535342261904762, -0.08158482142857143},
+        {-0.005003720238095238, 0.05750868055555555, -0.31665426587301587, 1.1549479166666667,
+         -0.8907986111111111, -0.8907986111111111, 1.1549479166666667, -0.31665426587301587,
+         0.05750868055555555, -0.005003720238095238}};
+};
+constexpr double spline_polynomials<4, 3, 2>::coefficients[6][10];
+
+template <class real_number>
+void beta_n4_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 3, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 3, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 3, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n4_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.08851686507936508, 0.7966517857142857, -3.186607142857143, 7.435416666666667,
+         -11.153125, 11.153125, -7.435416666666667, 3.186607142857143,
+         -0.7966517857142857, 0.08851686507936508},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {0.11579861111111112, -1.0423859126984127, 4.170138888888889, -9.73125,
+         14.597569444444444, -14.597569444444444, 9.73125, -4.170138888888889,
+         1.0423859126984127, -0.11579861111111112},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.0634765625, 0.5730251736111112, -2.305642361111111, 5.41015625,
+         -8.142144097222221, 8.142144097222221, -5.41015625, 2.305642361111111,
+         -0.5730251736111112, 0.0634765625},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.019129774305555555, -0.17537977430555557, 0.7319878472222222, -1.9451822916666666,
+         3.231098090277778, -3.231098090277778, 1.9451822916666666, -0.7319878472222222,
+         0.17537977430555557, -0.019129774305555555},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.00227874271453373, 0.021206229073660713, -0.09160505022321429, 0.2711669921875,
+         -1.48341064453125, 1.48341064453125, -0.2711669921875, 0.09160505022321429,
+         -0.021206229073660713, 0.00227874271453373},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double spline_polynomials<4, 4, 0>::coefficients[10][10];
+
+template <>
+struct spline_polynomials<4, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.7966517857142857, 7.169866071428571, -28.679464285714285, 66.91875,
+         -100.378125, 100.378125, -66.91875, 28.679464285714285,
+         -7.169866071428571, 0.7966517857142857},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {0.8105902777777778, -7.296701388888889, 29.19097222222222, -68.11875,
+         102.1829861111111, -102.1829861111111, 68.11875, -29.19097222222222,
+         7.296701388888889, -0.8105902777777778},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-0.3173828125, 2.8651258680555554, -11.528211805555555, 27.05078125,
+         -40.710720486111114, 40.710720486111114, -27.05078125, 11.528211805555555,
+         -2.8651258680555554, 0.3173828125},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.057389322916666666, -0.5261393229166667, 2.1959635416666665, -5.835546875,
+         9.693294270833333, -9.693294270833333, 5.835546875, -2.1959635416666665,
+         0.5261393229166667, -0.057389322916666666},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.00227874271453373, 0.021206229073660713, -0.09160505022321429, 0.2711669921875,
+         -1.48341064453125, 1.48341064453125, -0.2711669921875, 0.09160505022321429,
+         -0.021206229073660713, 0.00227874271453373}};
+};
+constexpr double spline_polynomials<4, 4, 1>::coefficients[9][10];
+
+template <>
+struct spline_polynomials<4, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-6.373214285714286, 57.35892857142857, -229.43571428571428, 535.35,
+         -803.025, 803.025, -535.35, 229.43571428571428,
+         -57.35892857142857, 6.373214285714286},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {4.863541666666666, -43.780208333333334, 175.14583333333334, -408.7125,
+         613.0979166666667, -613.0979166666667, 408.7125, -175.14583333333334,
+         43.780208333333334, -4.863541666666666},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-1.26953125, 11.460503472222221, -46.11284722222222, 108.203125,
+         -162.84288194444446, 162.84288194444446, -108.203125, 46.11284722222222,
+         -11.460503472222221, 1.26953125},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.11477864583333333, -1.0522786458333333, 4.391927083333333, -11.67109375,
+         19.386588541666665, -19.386588541666665, 11.67109375, -4.391927083333333,
+         1.0522786458333333, -0.11477864583333333},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double spline_polynomials<4, 4, 2>::coefficients[8][10];
+
+template <class real_number>
+void beta_n4_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 4, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 4, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 4, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n4_m7(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/10080.0L)*x - 40423.0L/1344.0L) + 6995.0L/72.0L) - 67327.0L/384.0L) + 55033.0L/288.0L) - 181291.0L/1440.0L) + 234277.0L/5040.0L) - 149777.0L/20160.0L) - 1.0L/10080.0L) - 1.0L/2880.0L) + 1.0L/720.0L) + 7.0L/5760.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-40423.0L/1120.0L*x + 121269.0L/448.0L) - 6995.0L/8.0L) + 201981.0L/128.0L) - 55033.0L/32.0L) + 181291.0L/160.0L) - 234277.0L/560.0L) + 385141.0L/5760.0L) + 1.0L/1680.0L) + 1.0L/240.0L) - 1.0L/80.0L) - 1.0L/60.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/280.0L)*x - 121269.0L/112.0L) + 6995.0L/2.0L) - 201981.0L/32.0L) + 55033.0L/8.0L) - 181291.0L/40.0L) + 234277.0L/140.0L) - 673997.0L/2520.0L) - 1.0L/720.0L) - 13.0L/720.0L) + 13.0L/360.0L) + 169.0L/1440.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-40423.0L/120.0L*x + 40423.0L/16.0L) - 48965.0L/6.0L) + 471289.0L/32.0L) - 385231.0L/24.0L) + 1269037.0L/120.0L) - 234277.0L/60.0L) + 898663.0L/1440.0L) + 1.0L/720.0L) + 29.0L/720.0L) - 29.0L/720.0L) - 61.0L/180.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((40423.0L/80.0L)*x - 121269.0L/32.0L) + 48965.0L/4.0L) - 1413867.0L/64.0L) + 385231.0L/16.0L) - 1269037.0L/80.0L) + 234277.0L/40.0L) - 269599.0L/288.0L) - 5.0L/96.0L) + 91.0L/192.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-40423.0L/80.0L*x + 121269.0L/32.0L) - 48965.0L/4.0L) + 1413867.0L/64.0L) - 385231.0L/16.0L) + 1269037.0L/80.0L) - 234277.0L/40.0L) + 2695991.0L/2880.0L) - 1.0L/720.0L) + 29.0L/720.0L) + 29.0L/720.0L) - 61.0L/180.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/120.0L)*x - 40423.0L/16.0L) + 48965.0L/6.0L) - 471289.0L/32.0L) + 385231.0L/24.0L) - 1269037.0L/120.0L) + 234277.0L/60.0L) - 112333.0L/180.0L) + 1.0L/720.0L) - 13.0L/720.0L) - 13.0L/360.0L) + 169.0L/1440.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-40423.0L/280.0L*x + 121269.0L/112.0L) - 6995.0L/2.0L) + 201981.0L/32.0L) - 55033.0L/8.0L) + 181291.0L/40.0L) - 234277.0L/140.0L) + 2695993.0L/10080.0L) - 1.0L/1680.0L) + 1.0L/240.0L) + 1.0L/80.0L) - 1.0L/60.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/1120.0L)*x - 121269.0L/448.0L) + 6995.0L/8.0L) - 201981.0L/128.0L) + 55033.0L/32.0L) - 181291.0L/160.0L) + 234277.0L/560.0L) - 192571.0L/2880.0L) + 1.0L/10080.0L) - 1.0L/2880.0L) - 1.0L/720.0L) + 7.0L/5760.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(-40423.0L/10080.0L*x + 40423.0L/1344.0L) - 6995.0L/72.0L) + 67327.0L/384.0L) - 55033.0L/288.0L) + 181291.0L/1440.0L) - 234277.0L/5040.0L) + 59911.0L/8064.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/672.0L)*x - 40423.0L/96.0L) + 90935.0L/72.0L) - 67327.0L/32.0L) + 605363.0L/288.0L) - 181291.0L/144.0L) + 234277.0L/560.0L) - 149777.0L/2520.0L) - 1.0L/1440.0L) - 1.0L/480.0L) + 1.0L/144.0L) + 7.0L/1440.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-121269.0L/224.0L*x + 121269.0L/32.0L) - 90935.0L/8.0L) + 605943.0L/32.0L) - 605363.0L/32.0L) + 181291.0L/16.0L) - 2108493.0L/560.0L) + 385141.0L/720.0L) + 1.0L/240.0L) + 1.0L/40.0L) - 1.0L/16.0L) - 1.0L/15.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((121269.0L/56.0L)*x - 121269.0L/8.0L) + 90935.0L/2.0L) - 605943.0L/8.0L) + 605363.0L/8.0L) - 181291.0L/4.0L) + 2108493.0L/140.0L) - 673997.0L/315.0L) - 7.0L/720.0L) - 13.0L/120.0L) + 13.0L/72.0L) + 169.0L/360.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-40423.0L/8.0L*x + 282961.0L/8.0L) - 636545.0L/6.0L) + 1413867.0L/8.0L) - 4237541.0L/24.0L) + 1269037.0L/12.0L) - 702831.0L/20.0L) + 898663.0L/180.0L) + 7.0L/720.0L) + 29.0L/120.0L) - 29.0L/144.0L) - 61.0L/45.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((121269.0L/16.0L)*x - 848883.0L/16.0L) + 636545.0L/4.0L) - 4241601.0L/16.0L) + 4237541.0L/16.0L) - 1269037.0L/8.0L) + 2108493.0L/40.0L) - 269599.0L/36.0L) - 5.0L/16.0L) + 91.0L/48.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-121269.0L/16.0L*x + 848883.0L/16.0L) - 636545.0L/4.0L) + 4241601.0L/16.0L) - 4237541.0L/16.0L) + 1269037.0L/8.0L) - 2108493.0L/40.0L) + 2695991.0L/360.0L) - 7.0L/720.0L) + 29.0L/120.0L) + 29.0L/144.0L) - 61.0L/45.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/8.0L)*x - 282961.0L/8.0L) + 636545.0L/6.0L) - 1413867.0L/8.0L) + 4237541.0L/24.0L) - 1269037.0L/12.0L) + 702831.0L/20.0L) - 224666.0L/45.0L) + 7.0L/720.0L) - 13.0L/120.0L) - 13.0L/72.0L) + 169.0L/360.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-121269.0L/56.0L*x + 121269.0L/8.0L) - 90935.0L/2.0L) + 605943.0L/8.0L) - 605363.0L/8.0L) + 181291.0L/4.0L) - 2108493.0L/140.0L) + 2695993.0L/1260.0L) - 1.0L/240.0L) + 1.0L/40.0L) + 1.0L/16.0L) - 1.0L/15.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((121269.0L/224.0L)*x - 121269.0L/32.0L) + 90935.0L/8.0L) - 605943.0L/32.0L) + 605363.0L/32.0L) - 181291.0L/16.0L) + 2108493.0L/560.0L) - 192571.0L/360.0L) + 1.0L/1440.0L) - 1.0L/480.0L) - 1.0L/144.0L) + 7.0L/1440.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 7)*(x*(x*(x*(x*(x*(x*(-40423.0L/672.0L*x + 40423.0L/96.0L) - 90935.0L/72.0L) + 67327.0L/32.0L) - 605363.0L/288.0L) + 181291.0L/144.0L) - 234277.0L/560.0L) + 59911.0L/1008.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((40423.0L/48.0L)*x - 525499.0L/96.0L) + 90935.0L/6.0L) - 740597.0L/32.0L) + 3026815.0L/144.0L) - 181291.0L/16.0L) + 234277.0L/70.0L) - 149777.0L/360.0L) - 1.0L/240.0L) - 1.0L/96.0L) + 1.0L/36.0L) + 7.0L/480.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-121269.0L/16.0L*x + 1576497.0L/32.0L) - 272805.0L/2.0L) + 6665373.0L/32.0L) - 3026815.0L/16.0L) + 1631619.0L/16.0L) - 2108493.0L/70.0L) + 2695987.0L/720.0L) + 1.0L/40.0L) + 1.0L/8.0L) - 1.0L/4.0L) - 1.0L/5.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((121269.0L/4.0L)*x - 1576497.0L/8.0L) + 545610) - 6665373.0L/8.0L) + 3026815.0L/4.0L) - 1631619.0L/4.0L) + 4216986.0L/35.0L) - 673997.0L/45.0L) - 7.0L/120.0L) - 13.0L/24.0L) + 13.0L/18.0L) + 169.0L/120.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-282961.0L/4.0L*x + 3678493.0L/8.0L) - 1273090) + 15552537.0L/8.0L) - 21187705.0L/12.0L) + 3807111.0L/4.0L) - 1405662.0L/5.0L) + 6290641.0L/180.0L) + 7.0L/120.0L) + 29.0L/24.0L) - 29.0L/36.0L) - 61.0L/15.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((848883.0L/8.0L)*x - 11035479.0L/16.0L) + 1909635) - 46657611.0L/16.0L) + 21187705.0L/8.0L) - 11421333.0L/8.0L) + 2108493.0L/5.0L) - 1887193.0L/36.0L) - 25.0L/16.0L) + 91.0L/16.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-848883.0L/8.0L*x + 11035479.0L/16.0L) - 1909635) + 46657611.0L/16.0L) - 21187705.0L/8.0L) + 11421333.0L/8.0L) - 2108493.0L/5.0L) + 18871937.0L/360.0L) - 7.0L/120.0L) + 29.0L/24.0L) + 29.0L/36.0L) - 61.0L/15.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((282961.0L/4.0L)*x - 3678493.0L/8.0L) + 1273090) - 15552537.0L/8.0L) + 21187705.0L/12.0L) - 3807111.0L/4.0L) + 1405662.0L/5.0L) - 1572662.0L/45.0L) + 7.0L/120.0L) - 13.0L/24.0L) - 13.0L/18.0L) + 169.0L/120.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-121269.0L/4.0L*x + 1576497.0L/8.0L) - 545610) + 6665373.0L/8.0L) - 3026815.0L/4.0L) + 1631619.0L/4.0L) - 4216986.0L/35.0L) + 2695993.0L/180.0L) - 1.0L/40.0L) + 1.0L/8.0L) + 1.0L/4.0L) - 1.0L/5.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((121269.0L/16.0L)*x - 1576497.0L/32.0L) + 272805.0L/2.0L) - 6665373.0L/32.0L) + 3026815.0L/16.0L) - 1631619.0L/16.0L) + 2108493.0L/70.0L) - 1347997.0L/360.0L) + 1.0L/240.0L) - 1.0L/96.0L) - 1.0L/36.0L) + 7.0L/480.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 6)*(x*(x*(x*(x*(x*(x*(-40423.0L/48.0L*x + 525499.0L/96.0L) - 90935.0L/6.0L) + 740597.0L/32.0L) - 3026815.0L/144.0L) + 181291.0L/16.0L) - 234277.0L/70.0L) + 59911.0L/144.0L);
-break;
+
+template void beta_n4_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 5, 0>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.30659722222222224, -2.759375, 11.0375, -25.754166666666666,
+         38.63125, -38.63125, 25.754166666666666, -11.0375,
+         2.759375, -0.30659722222222224},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-0.47176339285714286, 4.245870535714285, -16.98348214285714, 39.628125,
+         -59.4421875, 59.4421875, -39.628125, 16.98348214285714,
+         -4.245870535714285, 0.47176339285714286},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {0.307421875, -2.7669952876984127, 11.06857638888889, -25.827604166666667,
+         38.742100694444446, -38.742100694444446, 25.827604166666667, -11.06857638888889,
+         2.7669952876984127, -0.307421875},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.11138237847222222, 1.0041775173611112, -4.030251736111111, 9.434244791666666,
+         -14.178276909722221, 14.178276909722221, -9.434244791666666, 4.030251736111111,
+         -1.0041775173611112, 0.11138237847222222},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.025118001302083335, -0.22927381727430557, 0.9475640190972222, -2.448193359375,
+         3.985614691840278, -3.985614691840278, 2.448193359375, -0.9475640190972222,
+         0.22927381727430557, -0.025118001302083335},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.002578154064360119, 0.023900931222098215, -0.10238385881696428, 0.2963175455729167,
+         -1.521136474609375, 1.521136474609375, -0.2963175455729167, 0.10238385881696428,
+         -0.023900931222098215, 0.002578154064360119},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double spline_polynomials<4, 5, 0>::coefficients[12][10];
+
+template <>
+struct spline_polynomials<4, 5, 1>
+{
+    static constexpr int degree = 10;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.3725694444444443, -30.353125, 121.4125, -283.29583333333335,
+         424.94375, -424.94375, 283.29583333333335, -121.4125,
+         30.353125, -3.3725694444444443},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-4.245870535714285, 38.21283482142857, -152.8513392857143, 356.653125,
+         -534.9796875, 534.9796875, -356.653125, 152.8513392857143,
+         -38.21283482142857, 4.245870535714285},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {2.151953125, -19.368967013888888, 77.48003472222223, -180.79322916666666,
+         271.1947048611111, -271.1947048611111, 180.79322916666666, -77.48003472222223,
+         19.368967013888888, -2.151953125},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-0.5569118923611112, 5.020887586805555, -20.151258680555557, 47.171223958333336,
+         -70.89138454861111, 70.89138454861111, -47.171223958333336, 20.151258680555557,
+         -5.020887586805555, 0.5569118923611112},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.07535400390625, -0.6878214518229167, 2.8426920572916665, -7.344580078125,
+         11.956844075520833, -11.956844075520833, 7.344580078125, -2.8426920572916665,
+         0.6878214518229167, -0.07535400390625},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.002578154064360119, 0.023900931222098215, -0.10238385881696428, 0.2963175455729167,
+         -1.521136474609375, 1.521136474609375, -0.2963175455729167, 0.10238385881696428,
+         -0.023900931222098215, 0.002578154064360119}};
+};
+constexpr double spline_polynomials<4, 5, 1>::coefficients[11][10];
+
+template <>
+struct spline_polynomials<4, 5, 2>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {33.72569444444444, -303.53125, 1214.125, -2832.9583333333335,
+         4249.4375, -4249.4375, 2832.9583333333335, -1214.125,
+         303.53125, -33.72569444444444},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-33.96696428571428, 305.7026785714286, -1222.8107142857143, 2853.225,
+         -4279.8375, 4279.8375, -2853.225, 1222.8107142857143,
+         -305.7026785714286, 33.96696428571428},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {12.91171875, -116.21380208333333, 464.8802083333333, -1084.759375,
+         1627.1682291666666, -1627.1682291666666, 1084.759375, -464.8802083333333,
+         116.21380208333333, -12.91171875},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-2.2276475694444446, 20.08355034722222, -80.60503472222223, 188.68489583333334,
+         -283.56553819444446, 283.56553819444446, -188.68489583333334, 80.60503472222223,
+         -20.08355034722222, 2.2276475694444446},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.1507080078125, -1.3756429036458333, 5.685384114583333, -14.68916015625,
+         23.913688151041665, -23.913688151041665, 14.68916015625, -5.685384114583333,
+         1.3756429036458333, -0.1507080078125},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double spline_polynomials<4, 5, 2>::coefficients[10][10];
+
+template <class real_number>
+void beta_n4_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 5, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 5, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 5, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n4_m5<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m5<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 6, 0>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.0975694444444444, 9.878125, -39.5125, 92.19583333333334,
+         -138.29375, 138.29375, -92.19583333333334, 39.5125,
+         -9.878125, 1.0975694444444444},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {1.952951388888889, -17.5765625, 70.30625, -164.04791666666668,
+         246.071875, -246.071875, 164.04791666666668, -70.30625,
+         17.5765625, -1.952951388888889},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-1.5007347470238095, 13.506612723214285, -54.02645089285714, 126.06171875,
+         -189.092578125, 189.092578125, -126.06171875, 54.02645089285714,
+         -13.506612723214285, 1.5007347470238095},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {0.6504123263888889, -5.853909350198412, 23.41623263888889, -54.63880208333333,
+         81.95889756944445, -81.95889756944445, 54.63880208333333, -23.41623263888889,
+         5.853909350198412, -0.6504123263888889},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.1756930881076389, 1.5829739040798612, -6.345437282986111, 14.836344401041666,
+         -22.28142632378472, 22.28142632378472, -14.836344401041666, 6.345437282986111,
+         -1.5829739040798612, 0.1756930881076389},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.031549072265625, -0.2871534559461806, 1.1790825737847221, -2.9884033203125,
+         4.795929633246528, -4.795929633246528, 2.9884033203125, -1.1790825737847221,
+         0.2871534559461806, -0.031549072265625},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.0028461153545076886, 0.02631258283342634, -0.11203046526227678, 0.3188262939453125,
+         -1.5548995971679687, 1.5548995971679687, -0.3188262939453125, 0.11203046526227678,
+         -0.02631258283342634, 0.0028461153545076886},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double spline_polynomials<4, 6, 0>::coefficients[14][10];
+
+template <>
+struct spline_polynomials<4, 6, 1>
+{
+    static constexpr int degree = 12;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-14.268402777777778, 128.415625, -513.6625, 1198.5458333333333,
+         -1797.81875, 1797.81875, -1198.5458333333333, 513.6625,
+         -128.415625, 14.268402777777778},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {21.482465277777777, -193.3421875, 773.36875, -1804.5270833333334,
+         2706.790625, -2706.790625, 1804.5270833333334, -773.36875,
+         193.3421875, -21.482465277777777},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-13.506612723214285, 121.55951450892857, -486.2380580357143, 1134.55546875,
+         -1701.833203125, 1701.833203125, -1134.55546875, 486.2380580357143,
+         -121.55951450892857, 13.506612723214285},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {4.552886284722222, -40.97736545138889, 163.91362847222223, -382.47161458333335,
+         573.7122829861111, -573.7122829861111, 382.47161458333335, -163.91362847222223,
+         40.97736545138889, -4.552886284722222},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-0.8784654405381944, 7.914869520399305, -31.727186414930557, 74.18172200520833,
+         -111.40713161892361, 111.40713161892361, -74.18172200520833, 31.727186414930557,
+         -7.914869520399305, 0.8784654405381944},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.094647216796875, -0.8614603678385416, 3.537247721354167, -8.9652099609375,
+         14.387788899739583, -14.387788899739583, 8.9652099609375, -3.537247721354167,
+         0.8614603678385416, -0.094647216796875},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.0028461153545076886, 0.02631258283342634, -0.11203046526227678, 0.3188262939453125,
+         -1.5548995971679687, 1.5548995971679687, -0.3188262939453125, 0.11203046526227678,
+         -0.02631258283342634, 0.0028461153545076886}};
+};
+constexpr double spline_polynomials<4, 6, 1>::coefficients[13][10];
+
+template <>
+struct spline_polynomials<4, 6, 2>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-171.22083333333333, 1540.9875, -6163.95, 14382.55,
+         -21573.825, 21573.825, -14382.55, 6163.95,
+         -1540.9875, 171.22083333333333},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {214.82465277777777, -1933.421875, 7733.6875, -18045.270833333332,
+         27067.90625, -27067.90625, 18045.270833333332, -7733.6875,
+         1933.421875, -214.82465277777777},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-108.05290178571428, 972.4761160714286, -3889.9044642857143, 9076.44375,
+         -13614.665625, 13614.665625, -9076.44375, 3889.9044642857143,
+         -972.4761160714286, 108.05290178571428},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {27.317317708333334, -245.86419270833332, 983.4817708333334, -2294.8296875,
+         3442.2736979166666, -3442.2736979166666, 2294.8296875, -983.4817708333334,
+         245.86419270833332, -27.317317708333334},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-3.5138617621527777, 31.65947808159722, -126.90874565972223, 296.7268880208333,
+         -445.62852647569446, 445.62852647569446, -296.7268880208333, 126.90874565972223,
+         -31.65947808159722, 3.5138617621527777},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.18929443359375, -1.7229207356770833, 7.074495442708334, -17.930419921875,
+         28.775577799479166, -28.775577799479166, 17.930419921875, -7.074495442708334,
+         1.7229207356770833, -0.18929443359375},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double spline_polynomials<4, 6, 2>::coefficients[12][10];
+
+template <class real_number>
+void beta_n4_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 6, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 6, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 6, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n4_m8(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-59911.0L/4032.0L*x + 1018487.0L/8064.0L) - 4752457.0L/10080.0L) + 4072501.0L/4032.0L) - 391397.0L/288.0L) + 1355705.0L/1152.0L) - 61537.0L/96.0L) + 168839.0L/840.0L) - 186889.0L/6720.0L) + 1.0L/40320.0L) - 1.0L/10080.0L) - 1.0L/2880.0L) + 1.0L/720.0L) + 7.0L/5760.0L) - 7.0L/1440.0L) - 1.0L/1120.0L) + 1.0L/280.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((59911.0L/448.0L)*x - 1018487.0L/896.0L) + 4752457.0L/1120.0L) - 4072501.0L/448.0L) + 391397.0L/32.0L) - 1355705.0L/128.0L) + 184611.0L/32.0L) - 506517.0L/280.0L) + 560667.0L/2240.0L) - 1.0L/5040.0L) + 1.0L/1680.0L) + 1.0L/240.0L) - 1.0L/80.0L) - 1.0L/60.0L) + 1.0L/20.0L) + 4.0L/315.0L) - 4.0L/105.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-59911.0L/112.0L*x + 1018487.0L/224.0L) - 4752457.0L/280.0L) + 4072501.0L/112.0L) - 391397.0L/8.0L) + 1355705.0L/32.0L) - 184611.0L/8.0L) + 506517.0L/70.0L) - 560667.0L/560.0L) + 1.0L/1440.0L) - 1.0L/720.0L) - 13.0L/720.0L) + 13.0L/360.0L) + 169.0L/1440.0L) - 169.0L/720.0L) - 1.0L/10.0L) + 1.0L/5.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((59911.0L/48.0L)*x - 1018487.0L/96.0L) + 4752457.0L/120.0L) - 4072501.0L/48.0L) + 2739779.0L/24.0L) - 9489935.0L/96.0L) + 430759.0L/8.0L) - 168839.0L/10.0L) + 186889.0L/80.0L) - 1.0L/720.0L) + 1.0L/720.0L) + 29.0L/720.0L) - 29.0L/720.0L) - 61.0L/180.0L) + 61.0L/180.0L) + 4.0L/5.0L) - 4.0L/5.0L);
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-59911.0L/32.0L*x + 1018487.0L/64.0L) - 4752457.0L/80.0L) + 4072501.0L/32.0L) - 2739779.0L/16.0L) + 9489935.0L/64.0L) - 1292277.0L/16.0L) + 506517.0L/20.0L) - 560667.0L/160.0L) + 1.0L/576.0L) - 5.0L/96.0L) + 91.0L/192.0L) - 205.0L/144.0L) + 1;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((59911.0L/32.0L)*x - 1018487.0L/64.0L) + 4752457.0L/80.0L) - 4072501.0L/32.0L) + 2739779.0L/16.0L) - 9489935.0L/64.0L) + 1292277.0L/16.0L) - 506517.0L/20.0L) + 560667.0L/160.0L) - 1.0L/720.0L) - 1.0L/720.0L) + 29.0L/720.0L) + 29.0L/720.0L) - 61.0L/180.0L) - 61.0L/180.0L) + 4.0L/5.0L) + 4.0L/5.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-59911.0L/48.0L*x + 1018487.0L/96.0L) - 4752457.0L/120.0L) + 4072501.0L/48.0L) - 2739779.0L/24.0L) + 9489935.0L/96.0L) - 430759.0L/8.0L) + 168839.0L/10.0L) - 186889.0L/80.0L) + 1.0L/1440.0L) + 1.0L/720.0L) - 13.0L/720.0L) - 13.0L/360.0L) + 169.0L/1440.0L) + 169.0L/720.0L) - 1.0L/10.0L) - 1.0L/5.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((59911.0L/112.0L)*x - 1018487.0L/224.0L) + 4752457.0L/280.0L) - 4072501.0L/112.0L) + 391397.0L/8.0L) - 1355705.0L/32.0L) + 184611.0L/8.0L) - 506517.0L/70.0L) + 560667.0L/560.0L) - 1.0L/5040.0L) - 1.0L/1680.0L) + 1.0L/240.0L) + 1.0L/80.0L) - 1.0L/60.0L) - 1.0L/20.0L) + 4.0L/315.0L) + 4.0L/105.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-59911.0L/448.0L*x + 1018487.0L/896.0L) - 4752457.0L/1120.0L) + 4072501.0L/448.0L) - 391397.0L/32.0L) + 1355705.0L/128.0L) - 184611.0L/32.0L) + 506517.0L/280.0L) - 560667.0L/2240.0L) + 1.0L/40320.0L) + 1.0L/10080.0L) - 1.0L/2880.0L) - 1.0L/720.0L) + 7.0L/5760.0L) + 7.0L/1440.0L) - 1.0L/1120.0L) - 1.0L/280.0L);
-poly_val[9] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*((59911.0L/4032.0L)*x - 1018487.0L/8064.0L) + 4752457.0L/10080.0L) - 4072501.0L/4032.0L) + 391397.0L/288.0L) - 1355705.0L/1152.0L) + 61537.0L/96.0L) - 168839.0L/840.0L) + 186889.0L/6720.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/4032.0L*x + 1018487.0L/504.0L) - 4752457.0L/672.0L) + 4072501.0L/288.0L) - 5088161.0L/288.0L) + 1355705.0L/96.0L) - 676907.0L/96.0L) + 168839.0L/84.0L) - 560667.0L/2240.0L) + 1.0L/5040.0L) - 1.0L/1440.0L) - 1.0L/480.0L) + 1.0L/144.0L) + 7.0L/1440.0L) - 7.0L/480.0L) - 1.0L/560.0L) + 1.0L/280.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/448.0L)*x - 1018487.0L/56.0L) + 14257371.0L/224.0L) - 4072501.0L/32.0L) + 5088161.0L/32.0L) - 4067115.0L/32.0L) + 2030721.0L/32.0L) - 506517.0L/28.0L) + 5046003.0L/2240.0L) - 1.0L/630.0L) + 1.0L/240.0L) + 1.0L/40.0L) - 1.0L/16.0L) - 1.0L/15.0L) + 3.0L/20.0L) + 8.0L/315.0L) - 4.0L/105.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/112.0L*x + 1018487.0L/14.0L) - 14257371.0L/56.0L) + 4072501.0L/8.0L) - 5088161.0L/8.0L) + 4067115.0L/8.0L) - 2030721.0L/8.0L) + 506517.0L/7.0L) - 5046003.0L/560.0L) + 1.0L/180.0L) - 7.0L/720.0L) - 13.0L/120.0L) + 13.0L/72.0L) + 169.0L/360.0L) - 169.0L/240.0L) - 1.0L/5.0L) + 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/48.0L)*x - 1018487.0L/6.0L) + 4752457.0L/8.0L) - 28507507.0L/24.0L) + 35617127.0L/24.0L) - 9489935.0L/8.0L) + 4738349.0L/8.0L) - 168839) + 1682001.0L/80.0L) - 1.0L/90.0L) + 7.0L/720.0L) + 29.0L/120.0L) - 29.0L/144.0L) - 61.0L/45.0L) + 61.0L/60.0L) + 8.0L/5.0L) - 4.0L/5.0L;
-poly_val[4] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/32.0L*x + 1018487.0L/4.0L) - 14257371.0L/16.0L) + 28507507.0L/16.0L) - 35617127.0L/16.0L) + 28469805.0L/16.0L) - 14215047.0L/16.0L) + 506517.0L/2.0L) - 5046003.0L/160.0L) + 1.0L/72.0L) - 5.0L/16.0L) + 91.0L/48.0L) - 205.0L/72.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/32.0L)*x - 1018487.0L/4.0L) + 14257371.0L/16.0L) - 28507507.0L/16.0L) + 35617127.0L/16.0L) - 28469805.0L/16.0L) + 14215047.0L/16.0L) - 506517.0L/2.0L) + 5046003.0L/160.0L) - 1.0L/90.0L) - 7.0L/720.0L) + 29.0L/120.0L) + 29.0L/144.0L) - 61.0L/45.0L) - 61.0L/60.0L) + 8.0L/5.0L) + 4.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/48.0L*x + 1018487.0L/6.0L) - 4752457.0L/8.0L) + 28507507.0L/24.0L) - 35617127.0L/24.0L) + 9489935.0L/8.0L) - 4738349.0L/8.0L) + 168839) - 1682001.0L/80.0L) + 1.0L/180.0L) + 7.0L/720.0L) - 13.0L/120.0L) - 13.0L/72.0L) + 169.0L/360.0L) + 169.0L/240.0L) - 1.0L/5.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/112.0L)*x - 1018487.0L/14.0L) + 14257371.0L/56.0L) - 4072501.0L/8.0L) + 5088161.0L/8.0L) - 4067115.0L/8.0L) + 2030721.0L/8.0L) - 506517.0L/7.0L) + 5046003.0L/560.0L) - 1.0L/630.0L) - 1.0L/240.0L) + 1.0L/40.0L) + 1.0L/16.0L) - 1.0L/15.0L) - 3.0L/20.0L) + 8.0L/315.0L) + 4.0L/105.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/448.0L*x + 1018487.0L/56.0L) - 14257371.0L/224.0L) + 4072501.0L/32.0L) - 5088161.0L/32.0L) + 4067115.0L/32.0L) - 2030721.0L/32.0L) + 506517.0L/28.0L) - 5046003.0L/2240.0L) + 1.0L/5040.0L) + 1.0L/1440.0L) - 1.0L/480.0L) - 1.0L/144.0L) + 7.0L/1440.0L) + 7.0L/480.0L) - 1.0L/560.0L) - 1.0L/280.0L;
-poly_val[9] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/4032.0L)*x - 1018487.0L/504.0L) + 4752457.0L/672.0L) - 4072501.0L/288.0L) + 5088161.0L/288.0L) - 1355705.0L/96.0L) + 676907.0L/96.0L) - 168839.0L/84.0L) + 560667.0L/2240.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/252.0L*x + 5092435.0L/168.0L) - 4752457.0L/48.0L) + 52942513.0L/288.0L) - 5088161.0L/24.0L) + 14912755.0L/96.0L) - 3384535.0L/48.0L) + 506517.0L/28.0L) - 560667.0L/280.0L) + 1.0L/720.0L) - 1.0L/240.0L) - 1.0L/96.0L) + 1.0L/36.0L) + 7.0L/480.0L) - 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/28.0L)*x - 15277305.0L/56.0L) + 14257371.0L/16.0L) - 52942513.0L/32.0L) + 15264483.0L/8.0L) - 44738265.0L/32.0L) + 10153605.0L/16.0L) - 4558653.0L/28.0L) + 5046003.0L/280.0L) - 1.0L/90.0L) + 1.0L/40.0L) + 1.0L/8.0L) - 1.0L/4.0L) - 1.0L/5.0L) + 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/7.0L*x + 15277305.0L/14.0L) - 14257371.0L/4.0L) + 52942513.0L/8.0L) - 15264483.0L/2.0L) + 44738265.0L/8.0L) - 10153605.0L/4.0L) + 4558653.0L/7.0L) - 5046003.0L/70.0L) + 7.0L/180.0L) - 7.0L/120.0L) - 13.0L/24.0L) + 13.0L/18.0L) + 169.0L/120.0L) - 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/3.0L)*x - 5092435.0L/2.0L) + 33267199.0L/4.0L) - 370597591.0L/24.0L) + 35617127.0L/2.0L) - 104389285.0L/8.0L) + 23691745.0L/4.0L) - 1519551) + 1682001.0L/10.0L) - 7.0L/90.0L) + 7.0L/120.0L) + 29.0L/24.0L) - 29.0L/36.0L) - 61.0L/15.0L) + 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[4] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/2.0L*x + 15277305.0L/4.0L) - 99801597.0L/8.0L) + 370597591.0L/16.0L) - 106851381.0L/4.0L) + 313167855.0L/16.0L) - 71075235.0L/8.0L) + 4558653.0L/2.0L) - 5046003.0L/20.0L) + 7.0L/72.0L) - 25.0L/16.0L) + 91.0L/16.0L) - 205.0L/72.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/2.0L)*x - 15277305.0L/4.0L) + 99801597.0L/8.0L) - 370597591.0L/16.0L) + 106851381.0L/4.0L) - 313167855.0L/16.0L) + 71075235.0L/8.0L) - 4558653.0L/2.0L) + 5046003.0L/20.0L) - 7.0L/90.0L) - 7.0L/120.0L) + 29.0L/24.0L) + 29.0L/36.0L) - 61.0L/15.0L) - 61.0L/30.0L) + 8.0L/5.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/3.0L*x + 5092435.0L/2.0L) - 33267199.0L/4.0L) + 370597591.0L/24.0L) - 35617127.0L/2.0L) + 104389285.0L/8.0L) - 23691745.0L/4.0L) + 1519551) - 1682001.0L/10.0L) + 7.0L/180.0L) + 7.0L/120.0L) - 13.0L/24.0L) - 13.0L/18.0L) + 169.0L/120.0L) + 169.0L/120.0L) - 1.0L/5.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/7.0L)*x - 15277305.0L/14.0L) + 14257371.0L/4.0L) - 52942513.0L/8.0L) + 15264483.0L/2.0L) - 44738265.0L/8.0L) + 10153605.0L/4.0L) - 4558653.0L/7.0L) + 5046003.0L/70.0L) - 1.0L/90.0L) - 1.0L/40.0L) + 1.0L/8.0L) + 1.0L/4.0L) - 1.0L/5.0L) - 3.0L/10.0L) + 8.0L/315.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1018487.0L/28.0L*x + 15277305.0L/56.0L) - 14257371.0L/16.0L) + 52942513.0L/32.0L) - 15264483.0L/8.0L) + 44738265.0L/32.0L) - 10153605.0L/16.0L) + 4558653.0L/28.0L) - 5046003.0L/280.0L) + 1.0L/720.0L) + 1.0L/240.0L) - 1.0L/96.0L) - 1.0L/36.0L) + 7.0L/480.0L) + 7.0L/240.0L) - 1.0L/560.0L;
-poly_val[9] = pow(x, 7)*(x*(x*(x*(x*(x*(x*(x*((1018487.0L/252.0L)*x - 5092435.0L/168.0L) + 4752457.0L/48.0L) - 52942513.0L/288.0L) + 5088161.0L/24.0L) - 14912755.0L/96.0L) + 3384535.0L/48.0L) - 506517.0L/28.0L) + 560667.0L/280.0L);
-break;
+
+template void beta_n4_m6<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m6<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 7, 0>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {4.010218253968254, -36.09196428571428, 144.36785714285713, -336.85833333333335,
+         505.2875, -505.2875, 336.85833333333335, -144.36785714285713,
+         36.09196428571428, -4.010218253968254},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-8.11545138888889, 73.0390625, -292.15625, 681.6979166666666,
+         -1022.546875, 1022.546875, -681.6979166666666, 292.15625,
+         -73.0390625, 8.11545138888889},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {7.216362847222222, -64.947265625, 259.7890625, -606.1744791666666,
+         909.26171875, -909.26171875, 606.1744791666666, -259.7890625,
+         64.947265625, -7.216362847222222},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-3.6938228546626983, 33.24440569196429, -132.97762276785716, 310.28111979166664,
+         -465.4216796875, 465.4216796875, -310.28111979166664, 132.97762276785716,
+         -33.24440569196429, 3.6938228546626983},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {1.1986843532986111, -10.788357592385912, 43.154025607638886, -100.69365234375,
+         151.04117296006945, -151.04117296006945, 100.69365234375, -43.154025607638886,
+         10.788357592385912, -1.1986843532986111},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.25793389214409723, 2.3231411404079862, -9.306106228298612, 21.744571940104166,
+         -32.64376763237847, 32.64376763237847, -21.744571940104166, 9.306106228298612,
+         -2.3231411404079862, 0.25793389214409723},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.03840247260199653, -0.3488340589735243, 1.4258049858940973, -3.5640889485677083,
+         5.65945807562934, -5.65945807562934, 3.5640889485677083, -1.4258049858940973,
+         0.3488340589735243, -0.03840247260199653},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.003090879652235243, 0.028515461512974332, -0.12084197998046875, 0.3393864949544271,
+         -1.5857398986816407, 1.5857398986816407, -0.3393864949544271, 0.12084197998046875,
+         -0.028515461512974332, 0.003090879652235243},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double spline_polynomials<4, 7, 0>::coefficients[16][10];
+
+template <>
+struct spline_polynomials<4, 7, 1>
+{
+    static constexpr int degree = 14;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {60.15327380952381, -541.3794642857143, 2165.5178571428573, -5052.875,
+         7579.3125, -7579.3125, 5052.875, -2165.5178571428573,
+         541.3794642857143, -60.15327380952381},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-105.50086805555556, 949.5078125, -3798.03125, 8862.072916666666,
+         -13293.109375, 13293.109375, -8862.072916666666, 3798.03125,
+         -949.5078125, 105.50086805555556},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {79.37999131944444, -714.419921875, 2857.6796875, -6667.919270833333,
+         10001.87890625, -10001.87890625, 6667.919270833333, -2857.6796875,
+         714.419921875, -79.37999131944444},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-33.24440569196429, 299.19965122767854, -1196.7986049107142, 2792.530078125,
+         -4188.7951171875, 4188.7951171875, -2792.530078125, 1196.7986049107142,
+         -299.19965122767854, 33.24440569196429},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {8.390790473090277, -75.51850314670139, 302.07817925347223, -704.85556640625,
+         1057.2882107204862, -1057.2882107204862, 704.85556640625, -302.07817925347223,
+         75.51850314670139, -8.390790473090277},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-1.2896694607204862, 11.61570570203993, -46.53053114149306, 108.72285970052083,
+         -163.21883816189236, 163.21883816189236, -108.72285970052083, 46.53053114149306,
+         -11.61570570203993, 1.2896694607204862},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.11520741780598959, -1.046502176920573, 4.277414957682292, -10.692266845703125,
+         16.978374226888022, -16.978374226888022, 10.692266845703125, -4.277414957682292,
+         1.046502176920573, -0.11520741780598959},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.003090879652235243, 0.028515461512974332, -0.12084197998046875, 0.3393864949544271,
+         -1.5857398986816407, 1.5857398986816407, -0.3393864949544271, 0.12084197998046875,
+         -0.028515461512974332, 0.003090879652235243}};
+};
+constexpr double spline_polynomials<4, 7, 1>::coefficients[15][10];
+
+template <>
+struct spline_polynomials<4, 7, 2>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {842.1458333333334, -7579.3125, 30317.25, -70740.25,
+         106110.375, -106110.375, 70740.25, -30317.25,
+         7579.3125, -842.1458333333334},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-1266.0104166666667, 11394.09375, -45576.375, 106344.875,
+         -159517.3125, 159517.3125, -106344.875, 45576.375,
+         -11394.09375, 1266.0104166666667},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {793.7999131944445, -7144.19921875, 28576.796875, -66679.19270833333,
+         100018.7890625, -100018.7890625, 66679.19270833333, -28576.796875,
+         7144.19921875, -793.7999131944445},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-265.9552455357143, 2393.5972098214284, -9574.388839285713, 22340.240625,
+         -33510.3609375, 33510.3609375, -22340.240625, 9574.388839285713,
+         -2393.5972098214284, 265.9552455357143},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {50.34474283854167, -453.11101888020835, 1812.4690755208333, -4229.1333984375,
+         6343.729264322917, -6343.729264322917, 4229.1333984375, -1812.4690755208333,
+         453.11101888020835, -50.34474283854167},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-5.158677842881945, 46.46282280815972, -186.12212456597223, 434.8914388020833,
+         -652.8753526475695, 652.8753526475695, -434.8914388020833, 186.12212456597223,
+         -46.46282280815972, 5.158677842881945},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.23041483561197917, -2.093004353841146, 8.554829915364584, -21.38453369140625,
+         33.956748453776044, -33.956748453776044, 21.38453369140625, -8.554829915364584,
+         2.093004353841146, -0.23041483561197917},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double spline_polynomials<4, 7, 2>::coefficients[14][10];
+
+template <class real_number>
+void beta_n4_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 7, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 7, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 7, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n4_m7<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m7<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<4, 8, 0>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-14.858878968253968, 133.72991071428572, -534.9196428571429, 1248.1458333333333,
+         -1872.21875, 1872.21875, -1248.1458333333333, 534.9196428571429,
+         -133.72991071428572, 14.858878968253968},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {33.72797619047619, -303.5517857142857, 1214.2071428571428, -2833.15,
+         4249.725, -4249.725, 2833.15, -1214.2071428571428,
+         303.5517857142857, -33.72797619047619},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-34.118489583333336, 307.06640625, -1228.265625, 2865.953125,
+         -4298.9296875, 4298.9296875, -2865.953125, 1228.265625,
+         -307.06640625, 34.118489583333336},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {20.217881944444443, -181.9609375, 727.84375, -1698.3020833333333,
+         2547.453125, -2547.453125, 1698.3020833333333, -727.84375,
+         181.9609375, -20.217881944444443},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-7.7567975725446425, 69.81117815290179, -279.24471261160716, 651.57099609375,
+         -977.356494140625, 977.356494140625, -651.57099609375, 279.24471261160716,
+         -69.81117815290179, 7.7567975725446425},
+        {1.240079365079365e-05, -8.680555555555556e-05, 0.000248015873015873, -0.00034722222222222224,
+         0.00017361111111111112, 0.00017361111111111112, -0.00034722222222222224, 0.000248015873015873,
+         -8.680555555555556e-05, 1.240079365079365e-05},
+        {2.011279296875, -18.101712084573414, 72.40744357638889, -168.95162760416667,
+         253.42813585069445, -253.42813585069445, 168.95162760416667, -72.40744357638889,
+         18.101712084573414, -2.011279296875},
+        {-0.00026041666666666666, 0.0025173611111111113, -0.008680555555555556, 0.013541666666666667,
+         -0.007118055555555555, -0.007118055555555555, 0.013541666666666667, -0.008680555555555556,
+         0.0025173611111111113, -0.00026041666666666666},
+        {-0.35950826009114584, 3.2373104519314237, -12.962783474392362, 30.27681884765625,
+         -45.442137993706595, 45.442137993706595, -30.27681884765625, 12.962783474392362,
+         -3.2373104519314237, 0.35950826009114584},
+        {0.0015299479166666667, -0.016786024305555557, 0.0818142361111111, -0.16002604166666667,
+         0.09346788194444444, 0.09346788194444444, -0.16002604166666667, 0.0818142361111111,
+         -0.016786024305555557, 0.0015299479166666667},
+        {0.045657784598214284, -0.4141318669394841, 1.6869962177579365, -4.17353515625,
+         6.5736273871527775, -6.5736273871527775, 4.17353515625, -1.6869962177579365,
+         0.4141318669394841, -0.045657784598214284},
+        {-0.002502635168650794, 0.028759765625, -0.15834263392857142, 0.5774956597222223,
+         -0.44541015625, -0.44541015625, 0.5774956597222223, -0.15834263392857142,
+         0.028759765625, -0.002502635168650794},
+        {-0.003317608152117048, 0.030556018011910574, -0.12900420597621373, 0.35843168894449867,
+         -1.614307689666748, 1.614307689666748, -0.35843168894449867, 0.12900420597621373,
+         -0.030556018011910574, 0.003317608152117048},
+        {0.0005340576171875, -0.0061798095703125, 0.03460693359375, -0.13458251953125,
+         0.605621337890625, 0.605621337890625, -0.13458251953125, 0.03460693359375,
+         -0.0061798095703125, 0.0005340576171875}};
+};
+constexpr double spline_polynomials<4, 8, 0>::coefficients[18][10];
+
+template <>
+struct spline_polynomials<4, 8, 1>
+{
+    static constexpr int degree = 16;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-252.60094246031747, 2273.4084821428573, -9093.63392857143, 21218.479166666668,
+         -31827.71875, 31827.71875, -21218.479166666668, 9093.63392857143,
+         -2273.4084821428573, 252.60094246031747},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {505.91964285714283, -4553.276785714285, 18213.10714285714, -42497.25,
+         63745.875, -63745.875, 42497.25, -18213.10714285714,
+         4553.276785714285, -505.91964285714283},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-443.5403645833333, 3991.86328125, -15967.453125, 37257.390625,
+         -55886.0859375, 55886.0859375, -37257.390625, 15967.453125,
+         -3991.86328125, 443.5403645833333},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {222.39670138888889, -2001.5703125, 8006.28125, -18681.322916666668,
+         28021.984375, -28021.984375, 18681.322916666668, -8006.28125,
+         2001.5703125, -222.39670138888889},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-69.81117815290179, 628.3006033761161, -2513.2024135044644, 5864.13896484375,
+         -8796.208447265624, 8796.208447265624, -5864.13896484375, 2513.2024135044644,
+         -628.3006033761161, 69.81117815290179},
+        {9.92063492063492e-05, -0.0006944444444444445, 0.001984126984126984, -0.002777777777777778,
+         0.001388888888888889, 0.001388888888888889, -0.002777777777777778, 0.001984126984126984,
+         -0.0006944444444444445, 9.92063492063492e-05},
+        {14.078955078125, -126.71198459201389, 506.85210503472223, -1182.6613932291666,
+         1773.9969509548612, -1773.9969509548612, 1182.6613932291666, -506.85210503472223,
+         126.71198459201389, -14.078955078125},
+        {-0.0015625, 0.015104166666666667, -0.052083333333333336, 0.08125,
+         -0.042708333333333334, -0.042708333333333334, 0.08125, -0.052083333333333336,
+         0.015104166666666667, -0.0015625},
+        {-1.7975413004557292, 16.18655225965712, -64.81391737196181, 151.38409423828125,
+         -227.210689968533, 227.210689968533, -151.38409423828125, 64.81391737196181,
+         -16.18655225965712, 1.7975413004557292},
+        {0.006119791666666667, -0.06714409722222223, 0.3272569444444444, -0.6401041666666667,
+         0.37387152777777777, 0.37387152777777777, -0.6401041666666667, 0.3272569444444444,
+         -0.06714409722222223, 0.006119791666666667},
+        {0.13697335379464284, -1.2423956008184525, 5.060988653273809, -12.52060546875,
+         19.720882161458334, -19.720882161458334, 12.52060546875, -5.060988653273809,
+         1.2423956008184525, -0.13697335379464284},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588},
+        {-0.003317608152117048, 0.030556018011910574, -0.12900420597621373, 0.35843168894449867,
+         -1.614307689666748, 1.614307689666748, -0.35843168894449867, 0.12900420597621373,
+         -0.030556018011910574, 0.003317608152117048}};
+};
+constexpr double spline_polynomials<4, 8, 1>::coefficients[17][10];
+
+template <>
+struct spline_polynomials<4, 8, 2>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 10;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4041.6150793650795, 36374.53571428572, -145498.14285714287, 339495.6666666667,
+         -509243.5, 509243.5, -339495.6666666667, 145498.14285714287,
+         -36374.53571428572, 4041.6150793650795},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {7082.875, -63745.875, 254983.5, -594961.5,
+         892442.25, -892442.25, 594961.5, -254983.5,
+         63745.875, -7082.875},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-5322.484375, 47902.359375, -191609.4375, 447088.6875,
+         -670633.03125, 670633.03125, -447088.6875, 191609.4375,
+         -47902.359375, 5322.484375},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {2223.9670138888887, -20015.703125, 80062.8125, -186813.22916666666,
+         280219.84375, -280219.84375, 186813.22916666666, -80062.8125,
+         20015.703125, -2223.9670138888887},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-558.4894252232143, 5026.404827008929, -20105.619308035715, 46913.11171875,
+         -70369.667578125, 70369.667578125, -46913.11171875, 20105.619308035715,
+         -5026.404827008929, 558.4894252232143},
+        {0.0006944444444444445, -0.004861111111111111, 0.013888888888888888, -0.019444444444444445,
+         0.009722222222222222, 0.009722222222222222, -0.019444444444444445, 0.013888888888888888,
+         -0.004861111111111111, 0.0006944444444444445},
+        {84.47373046875, -760.2719075520833, 3041.1126302083335, -7095.968359375,
+         10643.981705729168, -10643.981705729168, 7095.968359375, -3041.1126302083335,
+         760.2719075520833, -84.47373046875},
+        {-0.0078125, 0.07552083333333333, -0.2604166666666667, 0.40625,
+         -0.21354166666666666, -0.21354166666666666, 0.40625, -0.2604166666666667,
+         0.07552083333333333, -0.0078125},
+        {-7.190165201822917, 64.74620903862848, -259.25566948784723, 605.536376953125,
+         -908.842759874132, 908.842759874132, -605.536376953125, 259.25566948784723,
+         -64.74620903862848, 7.190165201822917},
+        {0.018359375, -0.20143229166666668, 0.9817708333333334, -1.9203125,
+         1.1216145833333333, 1.1216145833333333, -1.9203125, 0.9817708333333334,
+         -0.20143229166666668, 0.018359375},
+        {0.2739467075892857, -2.484791201636905, 10.121977306547619, -25.0412109375,
+         39.44176432291667, -39.44176432291667, 25.0412109375, -10.121977306547619,
+         2.484791201636905, -0.2739467075892857},
+        {-0.005005270337301588, 0.05751953125, -0.31668526785714285, 1.1549913194444446,
+         -0.8908203125, -0.8908203125, 1.1549913194444446, -0.31668526785714285,
+         0.05751953125, -0.005005270337301588}};
+};
+constexpr double spline_polynomials<4, 8, 2>::coefficients[16][10];
+
+template <class real_number>
+void beta_n4_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<4, 8, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<4, 8, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<4, 8, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n4_m8<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n4_m8<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
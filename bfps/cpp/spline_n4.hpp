@@ -28,15 +28,24 @@
 
 #define SPLINE_N4
 
-void beta_n4_m0(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m1(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m2(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m3(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m4(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m5(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m6(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m7(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n4_m8(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n4_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N4
 
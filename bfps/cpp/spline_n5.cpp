@@ -25,521 +25,1614 @@
 
 
 #include "spline_n5.hpp"
-#include <cmath>
-void beta_n5_m0(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = -x + 1;
-poly_val[6] = x;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-break;
-case 1:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = -1;
-poly_val[6] = 1;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-break;
-case 2:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = 0;
-poly_val[6] = 0;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-break;
-}
-}
-void beta_n5_m1(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(-1.0L/1260.0L*x + 1.0L/630.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*((23.0L/2520.0L)*x - 2.0L/105.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(-25.0L/504.0L*x + 55.0L/504.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*((5.0L/28.0L)*x - 5.0L/12.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(-25.0L/42.0L*x + 10.0L/7.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*((7.0L/6.0L)*x - 13.0L/6.0L) + 1;
-poly_val[6] = x*(x*(-7.0L/6.0L*x + 4.0L/3.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*((25.0L/42.0L)*x - 5.0L/14.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(-5.0L/28.0L*x + 5.0L/42.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*((25.0L/504.0L)*x - 5.0L/126.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(-23.0L/2520.0L*x + 1.0L/120.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 2)*((1.0L/1260.0L)*x - 1.0L/1260.0L);
-break;
-case 1:
-poly_val[0] = x*(-1.0L/420.0L*x + 1.0L/315.0L) - 1.0L/1260.0L;
-poly_val[1] = x*((23.0L/840.0L)*x - 4.0L/105.0L) + 5.0L/504.0L;
-poly_val[2] = x*(-25.0L/168.0L*x + 55.0L/252.0L) - 5.0L/84.0L;
-poly_val[3] = x*((15.0L/28.0L)*x - 5.0L/6.0L) + 5.0L/21.0L;
-poly_val[4] = x*(-25.0L/14.0L*x + 20.0L/7.0L) - 5.0L/6.0L;
-poly_val[5] = x*((7.0L/2.0L)*x - 13.0L/3.0L);
-poly_val[6] = x*(-7.0L/2.0L*x + 8.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*((25.0L/14.0L)*x - 5.0L/7.0L) - 5.0L/21.0L;
-poly_val[8] = x*(-15.0L/28.0L*x + 5.0L/21.0L) + 5.0L/84.0L;
-poly_val[9] = x*((25.0L/168.0L)*x - 5.0L/63.0L) - 5.0L/504.0L;
-poly_val[10] = x*(-23.0L/840.0L*x + 1.0L/60.0L) + 1.0L/1260.0L;
-poly_val[11] = x*((1.0L/420.0L)*x - 1.0L/630.0L);
-break;
-case 2:
-poly_val[0] = -1.0L/210.0L*x + 1.0L/315.0L;
-poly_val[1] = (23.0L/420.0L)*x - 4.0L/105.0L;
-poly_val[2] = -25.0L/84.0L*x + 55.0L/252.0L;
-poly_val[3] = (15.0L/14.0L)*x - 5.0L/6.0L;
-poly_val[4] = -25.0L/7.0L*x + 20.0L/7.0L;
-poly_val[5] = 7*x - 13.0L/3.0L;
-poly_val[6] = -7*x + 8.0L/3.0L;
-poly_val[7] = (25.0L/7.0L)*x - 5.0L/7.0L;
-poly_val[8] = -15.0L/14.0L*x + 5.0L/21.0L;
-poly_val[9] = (25.0L/84.0L)*x - 5.0L/63.0L;
-poly_val[10] = -23.0L/420.0L*x + 1.0L/60.0L;
-poly_val[11] = (1.0L/210.0L)*x - 1.0L/630.0L;
-break;
-}
-}
-void beta_n5_m2(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*((1.0L/450.0L)*x - 37.0L/6300.0L) + 3.0L/700.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(-1247.0L/50400.0L*x + 3329.0L/50400.0L) - 39.0L/800.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*((85.0L/672.0L)*x - 115.0L/336.0L) + 515.0L/2016.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(-25.0L/63.0L*x + 275.0L/252.0L) - 205.0L/252.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*((5.0L/6.0L)*x - 95.0L/42.0L) + 10.0L/7.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(x*(x*(-4331.0L/3600.0L*x + 3731.0L/1200.0L) - 577.0L/400.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*((4331.0L/3600.0L)*x - 5231.0L/1800.0L) + 3731.0L/3600.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(-5.0L/6.0L*x + 40.0L/21.0L) - 5.0L/7.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*((25.0L/63.0L)*x - 25.0L/28.0L) + 5.0L/12.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(-85.0L/672.0L*x + 65.0L/224.0L) - 305.0L/2016.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*((1247.0L/50400.0L)*x - 1453.0L/25200.0L) + 179.0L/5600.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 3)*(x*(-1.0L/450.0L*x + 11.0L/2100.0L) - 19.0L/6300.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*((1.0L/90.0L)*x - 37.0L/1575.0L) + 9.0L/700.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(-1247.0L/10080.0L*x + 3329.0L/12600.0L) - 117.0L/800.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*((425.0L/672.0L)*x - 115.0L/84.0L) + 515.0L/672.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(-125.0L/63.0L*x + 275.0L/63.0L) - 205.0L/84.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*((25.0L/6.0L)*x - 190.0L/21.0L) + 30.0L/7.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(x*(x*(-4331.0L/720.0L*x + 3731.0L/300.0L) - 1731.0L/400.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*((4331.0L/720.0L)*x - 5231.0L/450.0L) + 3731.0L/1200.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(-25.0L/6.0L*x + 160.0L/21.0L) - 15.0L/7.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*((125.0L/63.0L)*x - 25.0L/7.0L) + 5.0L/4.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(-425.0L/672.0L*x + 65.0L/56.0L) - 305.0L/672.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*((1247.0L/10080.0L)*x - 1453.0L/6300.0L) + 537.0L/5600.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 2)*(x*(-1.0L/90.0L*x + 11.0L/525.0L) - 19.0L/2100.0L);
-break;
-case 2:
-poly_val[0] = x*(x*((2.0L/45.0L)*x - 37.0L/525.0L) + 9.0L/350.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(-1247.0L/2520.0L*x + 3329.0L/4200.0L) - 117.0L/400.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*((425.0L/168.0L)*x - 115.0L/28.0L) + 515.0L/336.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(-500.0L/63.0L*x + 275.0L/21.0L) - 205.0L/42.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*((50.0L/3.0L)*x - 190.0L/7.0L) + 60.0L/7.0L) + 5.0L/3.0L;
-poly_val[5] = x*(x*(-4331.0L/180.0L*x + 3731.0L/100.0L) - 1731.0L/200.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*((4331.0L/180.0L)*x - 5231.0L/150.0L) + 3731.0L/600.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(-50.0L/3.0L*x + 160.0L/7.0L) - 30.0L/7.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*((500.0L/63.0L)*x - 75.0L/7.0L) + 5.0L/2.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(-425.0L/168.0L*x + 195.0L/56.0L) - 305.0L/336.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*((1247.0L/2520.0L)*x - 1453.0L/2100.0L) + 537.0L/2800.0L) + 1.0L/3150.0L;
-poly_val[11] = x*(x*(-2.0L/45.0L*x + 11.0L/175.0L) - 19.0L/1050.0L);
-break;
-}
-}
-void beta_n5_m3(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(-5599.0L/907200.0L*x + 983.0L/45360.0L) - 779.0L/30240.0L) + 443.0L/45360.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*((61639.0L/907200.0L)*x - 216533.0L/907200.0L) + 28591.0L/100800.0L) - 2759.0L/25920.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(-12343.0L/36288.0L*x + 1291.0L/1080.0L) - 5363.0L/3780.0L) + 23711.0L/45360.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*((61793.0L/60480.0L)*x - 217103.0L/60480.0L) + 85517.0L/20160.0L) - 2599.0L/1728.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(-12371.0L/6048.0L*x + 108541.0L/15120.0L) - 7081.0L/840.0L) + 44003.0L/15120.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(x*(x*((61889.0L/21600.0L)*x - 2891.0L/288.0L) + 16877.0L/1440.0L) - 17641.0L/4320.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(-61889.0L/21600.0L*x + 108199.0L/10800.0L) - 13993.0L/1200.0L) + 9131.0L/2160.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*((12371.0L/6048.0L)*x - 215903.0L/30240.0L) + 27931.0L/3360.0L) - 95269.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(-61793.0L/60480.0L*x + 8977.0L/2520.0L) - 4659.0L/1120.0L) + 175.0L/108.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*((12343.0L/36288.0L)*x - 30731.0L/25920.0L) + 84037.0L/60480.0L) - 98981.0L/181440.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(-61639.0L/907200.0L*x + 10747.0L/45360.0L) - 1403.0L/5040.0L) + 71.0L/648.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 4)*(x*(x*((5599.0L/907200.0L)*x - 6511.0L/302400.0L) + 7663.0L/302400.0L) - 1811.0L/181440.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(-5599.0L/129600.0L*x + 983.0L/7560.0L) - 779.0L/6048.0L) + 443.0L/11340.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*((61639.0L/129600.0L)*x - 216533.0L/151200.0L) + 28591.0L/20160.0L) - 2759.0L/6480.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(-12343.0L/5184.0L*x + 1291.0L/180.0L) - 5363.0L/756.0L) + 23711.0L/11340.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*((61793.0L/8640.0L)*x - 217103.0L/10080.0L) + 85517.0L/4032.0L) - 2599.0L/432.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(-12371.0L/864.0L*x + 108541.0L/2520.0L) - 7081.0L/168.0L) + 44003.0L/3780.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(x*(x*((433223.0L/21600.0L)*x - 2891.0L/48.0L) + 16877.0L/288.0L) - 17641.0L/1080.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(-433223.0L/21600.0L*x + 108199.0L/1800.0L) - 13993.0L/240.0L) + 9131.0L/540.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*((12371.0L/864.0L)*x - 215903.0L/5040.0L) + 27931.0L/672.0L) - 95269.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(-61793.0L/8640.0L*x + 8977.0L/420.0L) - 4659.0L/224.0L) + 175.0L/27.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*((12343.0L/5184.0L)*x - 30731.0L/4320.0L) + 84037.0L/12096.0L) - 98981.0L/45360.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(-61639.0L/129600.0L*x + 10747.0L/7560.0L) - 1403.0L/1008.0L) + 71.0L/162.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 3)*(x*(x*((5599.0L/129600.0L)*x - 6511.0L/50400.0L) + 7663.0L/60480.0L) - 1811.0L/45360.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(-5599.0L/21600.0L*x + 983.0L/1512.0L) - 779.0L/1512.0L) + 443.0L/3780.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*((61639.0L/21600.0L)*x - 216533.0L/30240.0L) + 28591.0L/5040.0L) - 2759.0L/2160.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(-12343.0L/864.0L*x + 1291.0L/36.0L) - 5363.0L/189.0L) + 23711.0L/3780.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*((61793.0L/1440.0L)*x - 217103.0L/2016.0L) + 85517.0L/1008.0L) - 2599.0L/144.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(-12371.0L/144.0L*x + 108541.0L/504.0L) - 7081.0L/42.0L) + 44003.0L/1260.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(x*(x*((433223.0L/3600.0L)*x - 14455.0L/48.0L) + 16877.0L/72.0L) - 17641.0L/360.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(-433223.0L/3600.0L*x + 108199.0L/360.0L) - 13993.0L/60.0L) + 9131.0L/180.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*((12371.0L/144.0L)*x - 215903.0L/1008.0L) + 27931.0L/168.0L) - 95269.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(-61793.0L/1440.0L*x + 8977.0L/84.0L) - 4659.0L/56.0L) + 175.0L/9.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*((12343.0L/864.0L)*x - 30731.0L/864.0L) + 84037.0L/3024.0L) - 98981.0L/15120.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(-61639.0L/21600.0L*x + 10747.0L/1512.0L) - 1403.0L/252.0L) + 71.0L/54.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 2)*(x*(x*((5599.0L/21600.0L)*x - 6511.0L/10080.0L) + 7663.0L/15120.0L) - 1811.0L/15120.0L);
-break;
-}
-}
-void beta_n5_m4(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((151.0L/7560.0L)*x - 16309.0L/181440.0L) + 139381.0L/907200.0L) - 10721.0L/90720.0L) + 443.0L/12960.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-79729.0L/362880.0L*x + 13289.0L/13440.0L) - 766583.0L/453600.0L) + 589531.0L/453600.0L) - 227249.0L/604800.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((132883.0L/120960.0L)*x - 897011.0L/181440.0L) + 18251.0L/2160.0L) - 877.0L/135.0L) + 136301.0L/72576.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(-33221.0L/10080.0L*x + 897007.0L/60480.0L) - 306595.0L/12096.0L) + 1178419.0L/60480.0L) - 341587.0L/60480.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*((199327.0L/30240.0L)*x - 298999.0L/10080.0L) + 1532863.0L/30240.0L) - 29459.0L/756.0L) + 114389.0L/10080.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-2953.0L/320.0L*x + 358793.0L/8640.0L) - 255461.0L/3600.0L) + 9821.0L/180.0L) - 27589.0L/1728.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*((2953.0L/320.0L)*x - 179393.0L/4320.0L) + 191587.0L/2700.0L) - 589421.0L/10800.0L) + 692147.0L/43200.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(-199327.0L/30240.0L*x + 149491.0L/5040.0L) - 1532659.0L/30240.0L) + 1179233.0L/30240.0L) - 275.0L/24.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*((33221.0L/10080.0L)*x - 896927.0L/60480.0L) + 11353.0L/448.0L) - 65533.0L/3360.0L) + 43279.0L/7560.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(-132883.0L/120960.0L*x + 1793819.0L/362880.0L) - 109477.0L/12960.0L) + 16855.0L/2592.0L) - 691319.0L/362880.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*((79729.0L/362880.0L)*x - 19931.0L/20160.0L) + 383179.0L/226800.0L) - 58999.0L/45360.0L) + 46027.0L/120960.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 5)*(x*(x*(x*(-151.0L/7560.0L*x + 16307.0L/181440.0L) - 46447.0L/302400.0L) + 35759.0L/302400.0L) - 31351.0L/907200.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*((151.0L/840.0L)*x - 16309.0L/22680.0L) + 139381.0L/129600.0L) - 10721.0L/15120.0L) + 443.0L/2592.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(-79729.0L/40320.0L*x + 13289.0L/1680.0L) - 766583.0L/64800.0L) + 589531.0L/75600.0L) - 227249.0L/120960.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*((132883.0L/13440.0L)*x - 897011.0L/22680.0L) + 127757.0L/2160.0L) - 1754.0L/45.0L) + 681505.0L/72576.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(-33221.0L/1120.0L*x + 897007.0L/7560.0L) - 306595.0L/1728.0L) + 1178419.0L/10080.0L) - 341587.0L/12096.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*((199327.0L/3360.0L)*x - 298999.0L/1260.0L) + 1532863.0L/4320.0L) - 29459.0L/126.0L) + 114389.0L/2016.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(x*(x*(x*(x*(-26577.0L/320.0L*x + 358793.0L/1080.0L) - 1788227.0L/3600.0L) + 9821.0L/30.0L) - 137945.0L/1728.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*((26577.0L/320.0L)*x - 179393.0L/540.0L) + 1341109.0L/2700.0L) - 589421.0L/1800.0L) + 692147.0L/8640.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(-199327.0L/3360.0L*x + 149491.0L/630.0L) - 1532659.0L/4320.0L) + 1179233.0L/5040.0L) - 1375.0L/24.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*((33221.0L/1120.0L)*x - 896927.0L/7560.0L) + 11353.0L/64.0L) - 65533.0L/560.0L) + 43279.0L/1512.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(-132883.0L/13440.0L*x + 1793819.0L/45360.0L) - 766339.0L/12960.0L) + 16855.0L/432.0L) - 691319.0L/72576.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*((79729.0L/40320.0L)*x - 19931.0L/2520.0L) + 383179.0L/32400.0L) - 58999.0L/7560.0L) + 46027.0L/24192.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 4)*(x*(x*(x*(-151.0L/840.0L*x + 16307.0L/22680.0L) - 46447.0L/43200.0L) + 35759.0L/50400.0L) - 31351.0L/181440.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*((151.0L/105.0L)*x - 16309.0L/3240.0L) + 139381.0L/21600.0L) - 10721.0L/3024.0L) + 443.0L/648.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(-79729.0L/5040.0L*x + 13289.0L/240.0L) - 766583.0L/10800.0L) + 589531.0L/15120.0L) - 227249.0L/30240.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*((132883.0L/1680.0L)*x - 897011.0L/3240.0L) + 127757.0L/360.0L) - 1754.0L/9.0L) + 681505.0L/18144.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(-33221.0L/140.0L*x + 897007.0L/1080.0L) - 306595.0L/288.0L) + 1178419.0L/2016.0L) - 341587.0L/3024.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*((199327.0L/420.0L)*x - 298999.0L/180.0L) + 1532863.0L/720.0L) - 147295.0L/126.0L) + 114389.0L/504.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(x*(x*(x*(x*(-26577.0L/40.0L*x + 2511551.0L/1080.0L) - 1788227.0L/600.0L) + 9821.0L/6.0L) - 137945.0L/432.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*((26577.0L/40.0L)*x - 1255751.0L/540.0L) + 1341109.0L/450.0L) - 589421.0L/360.0L) + 692147.0L/2160.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(-199327.0L/420.0L*x + 149491.0L/90.0L) - 1532659.0L/720.0L) + 1179233.0L/1008.0L) - 1375.0L/6.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*((33221.0L/140.0L)*x - 896927.0L/1080.0L) + 34059.0L/32.0L) - 65533.0L/112.0L) + 43279.0L/378.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(-132883.0L/1680.0L*x + 1793819.0L/6480.0L) - 766339.0L/2160.0L) + 84275.0L/432.0L) - 691319.0L/18144.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*((79729.0L/5040.0L)*x - 19931.0L/360.0L) + 383179.0L/5400.0L) - 58999.0L/1512.0L) + 46027.0L/6048.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 3)*(x*(x*(x*(-151.0L/105.0L*x + 16307.0L/3240.0L) - 46447.0L/7200.0L) + 35759.0L/10080.0L) - 31351.0L/45360.0L);
-break;
-}
-}
-void beta_n5_m5(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-83603.0L/1209600.0L*x + 27589.0L/72576.0L) - 612527.0L/725760.0L) + 28633.0L/30240.0L) - 278653.0L/518400.0L) + 32071.0L/259200.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((919633.0L/1209600.0L)*x - 722569.0L/172800.0L) + 481271.0L/51840.0L) - 41995.0L/4032.0L) + 21456371.0L/3628800.0L) - 705703.0L/518400.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/241920.0L*x + 3793487.0L/181440.0L) - 33688957.0L/725760.0L) + 3149623.0L/60480.0L) - 21456689.0L/725760.0L) + 176479.0L/25920.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((919633.0L/80640.0L)*x - 15173947.0L/241920.0L) + 16844473.0L/120960.0L) - 2099749.0L/13440.0L) + 4291423.0L/48384.0L) - 706069.0L/34560.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/40320.0L*x + 280999.0L/2240.0L) - 33688937.0L/120960.0L) + 1574813.0L/5040.0L) - 21457553.0L/120960.0L) + 353051.0L/8640.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((919633.0L/28800.0L)*x - 3034789.0L/17280.0L) + 3368893.0L/8640.0L) - 314963.0L/720.0L) + 21457931.0L/86400.0L) - 4942069.0L/86400.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/28800.0L*x + 1896743.0L/10800.0L) - 1347557.0L/3456.0L) + 629927.0L/1440.0L) - 21458201.0L/86400.0L) + 617597.0L/10800.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((919633.0L/40320.0L)*x - 5057981.0L/40320.0L) + 16844461.0L/60480.0L) - 6299281.0L/20160.0L) + 3065477.0L/17280.0L) - 705601.0L/17280.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/80640.0L*x + 1083853.0L/17280.0L) - 4812703.0L/34560.0L) + 524941.0L/3360.0L) - 4291669.0L/48384.0L) + 352697.0L/17280.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((919633.0L/241920.0L)*x - 15173941.0L/725760.0L) + 16844461.0L/362880.0L) - 3149651.0L/60480.0L) + 21458243.0L/725760.0L) - 705247.0L/103680.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/1209600.0L*x + 252899.0L/60480.0L) - 1347557.0L/145152.0L) + 209977.0L/20160.0L) - 21458081.0L/3628800.0L) + 176293.0L/129600.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 6)*(x*(x*(x*(x*((83603.0L/1209600.0L)*x - 1379449.0L/3628800.0L) + 306263.0L/362880.0L) - 114533.0L/120960.0L) + 1950721.0L/3628800.0L) - 64103.0L/518400.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/1209600.0L*x + 137945.0L/36288.0L) - 612527.0L/80640.0L) + 28633.0L/3780.0L) - 1950571.0L/518400.0L) + 32071.0L/43200.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/1209600.0L)*x - 722569.0L/17280.0L) + 481271.0L/5760.0L) - 41995.0L/504.0L) + 21456371.0L/518400.0L) - 705703.0L/86400.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/241920.0L*x + 3793487.0L/18144.0L) - 33688957.0L/80640.0L) + 3149623.0L/7560.0L) - 21456689.0L/103680.0L) + 176479.0L/4320.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/80640.0L)*x - 15173947.0L/24192.0L) + 16844473.0L/13440.0L) - 2099749.0L/1680.0L) + 4291423.0L/6912.0L) - 706069.0L/5760.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/40320.0L*x + 280999.0L/224.0L) - 33688937.0L/13440.0L) + 1574813.0L/630.0L) - 21457553.0L/17280.0L) + 353051.0L/1440.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((10115963.0L/28800.0L)*x - 3034789.0L/1728.0L) + 3368893.0L/960.0L) - 314963.0L/90.0L) + 150205517.0L/86400.0L) - 4942069.0L/14400.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/28800.0L*x + 1896743.0L/1080.0L) - 1347557.0L/384.0L) + 629927.0L/180.0L) - 150207407.0L/86400.0L) + 617597.0L/1800.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/40320.0L)*x - 5057981.0L/4032.0L) + 16844461.0L/6720.0L) - 6299281.0L/2520.0L) + 21458339.0L/17280.0L) - 705601.0L/2880.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/80640.0L*x + 1083853.0L/1728.0L) - 4812703.0L/3840.0L) + 524941.0L/420.0L) - 4291669.0L/6912.0L) + 352697.0L/2880.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/241920.0L)*x - 15173941.0L/72576.0L) + 16844461.0L/40320.0L) - 3149651.0L/7560.0L) + 21458243.0L/103680.0L) - 705247.0L/17280.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/1209600.0L*x + 252899.0L/6048.0L) - 1347557.0L/16128.0L) + 209977.0L/2520.0L) - 21458081.0L/518400.0L) + 176293.0L/21600.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 5)*(x*(x*(x*(x*((919633.0L/1209600.0L)*x - 1379449.0L/362880.0L) + 306263.0L/40320.0L) - 114533.0L/15120.0L) + 1950721.0L/518400.0L) - 64103.0L/86400.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-919633.0L/120960.0L*x + 137945.0L/4032.0L) - 612527.0L/10080.0L) + 28633.0L/540.0L) - 1950571.0L/86400.0L) + 32071.0L/8640.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/120960.0L)*x - 722569.0L/1920.0L) + 481271.0L/720.0L) - 41995.0L/72.0L) + 21456371.0L/86400.0L) - 705703.0L/17280.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/24192.0L*x + 3793487.0L/2016.0L) - 33688957.0L/10080.0L) + 3149623.0L/1080.0L) - 21456689.0L/17280.0L) + 176479.0L/864.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/8064.0L)*x - 15173947.0L/2688.0L) + 16844473.0L/1680.0L) - 2099749.0L/240.0L) + 4291423.0L/1152.0L) - 706069.0L/1152.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/4032.0L*x + 2528991.0L/224.0L) - 33688937.0L/1680.0L) + 1574813.0L/90.0L) - 21457553.0L/2880.0L) + 353051.0L/288.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((10115963.0L/2880.0L)*x - 3034789.0L/192.0L) + 3368893.0L/120.0L) - 2204741.0L/90.0L) + 150205517.0L/14400.0L) - 4942069.0L/2880.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/2880.0L*x + 1896743.0L/120.0L) - 1347557.0L/48.0L) + 4409489.0L/180.0L) - 150207407.0L/14400.0L) + 617597.0L/360.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/4032.0L)*x - 5057981.0L/448.0L) + 16844461.0L/840.0L) - 6299281.0L/360.0L) + 21458339.0L/2880.0L) - 705601.0L/576.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/8064.0L*x + 1083853.0L/192.0L) - 4812703.0L/480.0L) + 524941.0L/60.0L) - 4291669.0L/1152.0L) + 352697.0L/576.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*((10115963.0L/24192.0L)*x - 15173941.0L/8064.0L) + 16844461.0L/5040.0L) - 3149651.0L/1080.0L) + 21458243.0L/17280.0L) - 705247.0L/3456.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(-10115963.0L/120960.0L*x + 252899.0L/672.0L) - 1347557.0L/2016.0L) + 209977.0L/360.0L) - 21458081.0L/86400.0L) + 176293.0L/4320.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 4)*(x*(x*(x*(x*((919633.0L/120960.0L)*x - 1379449.0L/40320.0L) + 306263.0L/5040.0L) - 114533.0L/2160.0L) + 1950721.0L/86400.0L) - 64103.0L/17280.0L);
-break;
-}
+#include "beta_polynomials.hpp"
+
+template <>
+struct spline_polynomials<5, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, -1.0, 1.0, 0,
+         0, 0, 0, 0},
+        {0, 0, 0, 0,
+         0, 0.5, 0.5, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<5, 0, 0>::coefficients[2][12];
+
+template <>
+struct spline_polynomials<5, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, -1.0, 1.0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<5, 0, 1>::coefficients[1][12];
+
+template <>
+struct spline_polynomials<5, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<5, 0, 2>::coefficients[1][12];
+
+template <class real_number>
+void beta_n5_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 0, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 0, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 0, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n5_m6(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((64103.0L/259200.0L)*x - 833339.0L/518400.0L) + 5301049.0L/1209600.0L) - 1553347.0L/241920.0L) + 1291561.0L/241920.0L) - 2893169.0L/1209600.0L) + 2891.0L/6400.0L) + 13.0L/172800.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-705133.0L/259200.0L*x + 9166729.0L/518400.0L) - 58311539.0L/1209600.0L) + 2288413.0L/32400.0L) - 169133.0L/2880.0L) + 10608293.0L/403200.0L) - 2003453.0L/403200.0L) - 19.0L/17280.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((705133.0L/51840.0L)*x - 9166729.0L/103680.0L) + 58311539.0L/241920.0L) - 256302257.0L/725760.0L) + 213107593.0L/725760.0L) - 31824887.0L/241920.0L) + 6010253.0L/241920.0L) + 29.0L/3840.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-705133.0L/17280.0L*x + 9166729.0L/34560.0L) - 58311539.0L/80640.0L) + 42717043.0L/40320.0L) - 17758967.0L/20160.0L) + 2121659.0L/5376.0L) - 6010111.0L/80640.0L) - 13.0L/480.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((705133.0L/8640.0L)*x - 9166729.0L/17280.0L) + 58311539.0L/40320.0L) - 256302259.0L/120960.0L) + 71035871.0L/40320.0L) - 6364975.0L/8064.0L) + 1201993.0L/8064.0L) + 323.0L/5760.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-4935931.0L/43200.0L*x + 64167103.0L/86400.0L) - 58311539.0L/28800.0L) + 12815113.0L/4320.0L) - 10655381.0L/4320.0L) + 31824859.0L/28800.0L) - 6009839.0L/28800.0L) - 341.0L/4800.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((4935931.0L/43200.0L)*x - 64167103.0L/86400.0L) + 58311539.0L/28800.0L) - 28478029.0L/9600.0L) + 315715.0L/128.0L) - 31824839.0L/28800.0L) + 6009749.0L/28800.0L) + 323.0L/5760.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-705133.0L/8640.0L*x + 9166729.0L/17280.0L) - 58311539.0L/40320.0L) + 128151131.0L/60480.0L) - 17758969.0L/10080.0L) + 31824817.0L/40320.0L) - 858529.0L/5760.0L) - 13.0L/480.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((705133.0L/17280.0L)*x - 9166729.0L/34560.0L) + 58311539.0L/80640.0L) - 36614609.0L/34560.0L) + 30443947.0L/34560.0L) - 2121653.0L/5376.0L) + 6009701.0L/80640.0L) + 29.0L/3840.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-705133.0L/51840.0L*x + 9166729.0L/103680.0L) - 58311539.0L/241920.0L) + 10679261.0L/30240.0L) - 17758969.0L/60480.0L) + 6364955.0L/48384.0L) - 400649.0L/16128.0L) - 19.0L/17280.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((705133.0L/259200.0L)*x - 9166729.0L/518400.0L) + 58311539.0L/1209600.0L) - 51260453.0L/725760.0L) + 315715.0L/5376.0L) - 10608253.0L/403200.0L) + 2003263.0L/403200.0L) + 13.0L/172800.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 7)*(x*(x*(x*(x*(x*(-64103.0L/259200.0L*x + 833339.0L/518400.0L) - 5301049.0L/1209600.0L) + 11650103.0L/1814400.0L) - 968671.0L/181440.0L) + 2893159.0L/1209600.0L) - 546349.0L/1209600.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((833339.0L/259200.0L)*x - 833339.0L/43200.0L) + 58311539.0L/1209600.0L) - 1553347.0L/24192.0L) + 1291561.0L/26880.0L) - 2893169.0L/151200.0L) + 20237.0L/6400.0L) + 13.0L/28800.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/259200.0L*x + 9166729.0L/43200.0L) - 641426929.0L/1209600.0L) + 2288413.0L/3240.0L) - 169133.0L/320.0L) + 10608293.0L/50400.0L) - 2003453.0L/57600.0L) - 19.0L/2880.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/51840.0L)*x - 9166729.0L/8640.0L) + 641426929.0L/241920.0L) - 256302257.0L/72576.0L) + 213107593.0L/80640.0L) - 31824887.0L/30240.0L) + 6010253.0L/34560.0L) + 29.0L/640.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/17280.0L*x + 9166729.0L/2880.0L) - 641426929.0L/80640.0L) + 42717043.0L/4032.0L) - 17758967.0L/2240.0L) + 2121659.0L/672.0L) - 6010111.0L/11520.0L) - 13.0L/80.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/8640.0L)*x - 9166729.0L/1440.0L) + 641426929.0L/40320.0L) - 256302259.0L/12096.0L) + 71035871.0L/4480.0L) - 6364975.0L/1008.0L) + 1201993.0L/1152.0L) + 323.0L/960.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-64167103.0L/43200.0L*x + 64167103.0L/7200.0L) - 641426929.0L/28800.0L) + 12815113.0L/432.0L) - 10655381.0L/480.0L) + 31824859.0L/3600.0L) - 42068873.0L/28800.0L) - 341.0L/800.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((64167103.0L/43200.0L)*x - 64167103.0L/7200.0L) + 641426929.0L/28800.0L) - 28478029.0L/960.0L) + 2841435.0L/128.0L) - 31824839.0L/3600.0L) + 42068243.0L/28800.0L) + 323.0L/960.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/8640.0L*x + 9166729.0L/1440.0L) - 641426929.0L/40320.0L) + 128151131.0L/6048.0L) - 17758969.0L/1120.0L) + 31824817.0L/5040.0L) - 6009703.0L/5760.0L) - 13.0L/80.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/17280.0L)*x - 9166729.0L/2880.0L) + 641426929.0L/80640.0L) - 36614609.0L/3456.0L) + 30443947.0L/3840.0L) - 2121653.0L/672.0L) + 6009701.0L/11520.0L) + 29.0L/640.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/51840.0L*x + 9166729.0L/8640.0L) - 641426929.0L/241920.0L) + 10679261.0L/3024.0L) - 17758969.0L/6720.0L) + 6364955.0L/6048.0L) - 400649.0L/2304.0L) - 19.0L/2880.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/259200.0L)*x - 9166729.0L/43200.0L) + 641426929.0L/1209600.0L) - 51260453.0L/72576.0L) + 947145.0L/1792.0L) - 10608253.0L/50400.0L) + 2003263.0L/57600.0L) + 13.0L/28800.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 6)*(x*(x*(x*(x*(x*(-833339.0L/259200.0L*x + 833339.0L/43200.0L) - 58311539.0L/1209600.0L) + 11650103.0L/181440.0L) - 968671.0L/20160.0L) + 2893159.0L/151200.0L) - 546349.0L/172800.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((833339.0L/21600.0L)*x - 9166729.0L/43200.0L) + 58311539.0L/120960.0L) - 1553347.0L/2688.0L) + 1291561.0L/3360.0L) - 2893169.0L/21600.0L) + 60711.0L/3200.0L) + 13.0L/5760.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/21600.0L*x + 100834019.0L/43200.0L) - 641426929.0L/120960.0L) + 2288413.0L/360.0L) - 169133.0L/40.0L) + 10608293.0L/7200.0L) - 2003453.0L/9600.0L) - 19.0L/576.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/4320.0L)*x - 100834019.0L/8640.0L) + 641426929.0L/24192.0L) - 256302257.0L/8064.0L) + 213107593.0L/10080.0L) - 31824887.0L/4320.0L) + 6010253.0L/5760.0L) + 29.0L/128.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/1440.0L*x + 100834019.0L/2880.0L) - 641426929.0L/8064.0L) + 42717043.0L/448.0L) - 17758967.0L/280.0L) + 2121659.0L/96.0L) - 6010111.0L/1920.0L) - 13.0L/16.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/720.0L)*x - 100834019.0L/1440.0L) + 641426929.0L/4032.0L) - 256302259.0L/1344.0L) + 71035871.0L/560.0L) - 6364975.0L/144.0L) + 1201993.0L/192.0L) + 323.0L/192.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-64167103.0L/3600.0L*x + 705838133.0L/7200.0L) - 641426929.0L/2880.0L) + 12815113.0L/48.0L) - 10655381.0L/60.0L) + 222774013.0L/3600.0L) - 42068873.0L/4800.0L) - 341.0L/160.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((64167103.0L/3600.0L)*x - 705838133.0L/7200.0L) + 641426929.0L/2880.0L) - 85434087.0L/320.0L) + 2841435.0L/16.0L) - 222773873.0L/3600.0L) + 42068243.0L/4800.0L) + 323.0L/192.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/720.0L*x + 100834019.0L/1440.0L) - 641426929.0L/4032.0L) + 128151131.0L/672.0L) - 17758969.0L/140.0L) + 31824817.0L/720.0L) - 6009703.0L/960.0L) - 13.0L/16.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/1440.0L)*x - 100834019.0L/2880.0L) + 641426929.0L/8064.0L) - 36614609.0L/384.0L) + 30443947.0L/480.0L) - 2121653.0L/96.0L) + 6009701.0L/1920.0L) + 29.0L/128.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9166729.0L/4320.0L*x + 100834019.0L/8640.0L) - 641426929.0L/24192.0L) + 10679261.0L/336.0L) - 17758969.0L/840.0L) + 6364955.0L/864.0L) - 400649.0L/384.0L) - 19.0L/576.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9166729.0L/21600.0L)*x - 100834019.0L/43200.0L) + 641426929.0L/120960.0L) - 51260453.0L/8064.0L) + 947145.0L/224.0L) - 10608253.0L/7200.0L) + 2003263.0L/9600.0L) + 13.0L/5760.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 5)*(x*(x*(x*(x*(x*(-833339.0L/21600.0L*x + 9166729.0L/43200.0L) - 58311539.0L/120960.0L) + 11650103.0L/20160.0L) - 968671.0L/2520.0L) + 2893159.0L/21600.0L) - 546349.0L/28800.0L);
-break;
+
+template void beta_n5_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0007936507936507937, 0.009126984126984128, -0.0496031746031746, 0.17857142857142858,
+         -0.5952380952380952, 1.1666666666666667, -1.1666666666666667, 0.5952380952380952,
+         -0.17857142857142858, 0.0496031746031746, -0.009126984126984128, 0.0007936507936507937},
+        {0.0003968253968253968, -0.005357142857142857, 0.034722222222222224, -0.1488095238095238,
+         0.5357142857142857, -0.4166666666666667, -0.4166666666666667, 0.5357142857142857,
+         -0.1488095238095238, 0.034722222222222224, -0.005357142857142857, 0.0003968253968253968},
+        {0.0001984126984126984, -0.002281746031746032, 0.01240079365079365, -0.044642857142857144,
+         0.1488095238095238, -1.2916666666666667, 1.2916666666666667, -0.1488095238095238,
+         0.044642857142857144, -0.01240079365079365, 0.002281746031746032, -0.0001984126984126984},
+        {-9.92063492063492e-05, 0.0013392857142857143, -0.008680555555555556, 0.03720238095238095,
+         -0.13392857142857142, 0.6041666666666666, 0.6041666666666666, -0.13392857142857142,
+         0.03720238095238095, -0.008680555555555556, 0.0013392857142857143, -9.92063492063492e-05}};
+};
+constexpr double spline_polynomials<5, 1, 0>::coefficients[4][12];
+
+template <>
+struct spline_polynomials<5, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.002380952380952381, 0.02738095238095238, -0.1488095238095238, 0.5357142857142857,
+         -1.7857142857142858, 3.5, -3.5, 1.7857142857142858,
+         -0.5357142857142857, 0.1488095238095238, -0.02738095238095238, 0.002380952380952381},
+        {0.0007936507936507937, -0.010714285714285714, 0.06944444444444445, -0.2976190476190476,
+         1.0714285714285714, -0.8333333333333334, -0.8333333333333334, 1.0714285714285714,
+         -0.2976190476190476, 0.06944444444444445, -0.010714285714285714, 0.0007936507936507937},
+        {0.0001984126984126984, -0.002281746031746032, 0.01240079365079365, -0.044642857142857144,
+         0.1488095238095238, -1.2916666666666667, 1.2916666666666667, -0.1488095238095238,
+         0.044642857142857144, -0.01240079365079365, 0.002281746031746032, -0.0001984126984126984}};
+};
+constexpr double spline_polynomials<5, 1, 1>::coefficients[3][12];
+
+template <>
+struct spline_polynomials<5, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.004761904761904762, 0.05476190476190476, -0.2976190476190476, 1.0714285714285714,
+         -3.5714285714285716, 7.0, -7.0, 3.5714285714285716,
+         -1.0714285714285714, 0.2976190476190476, -0.05476190476190476, 0.004761904761904762},
+        {0.0007936507936507937, -0.010714285714285714, 0.06944444444444445, -0.2976190476190476,
+         1.0714285714285714, -0.8333333333333334, -0.8333333333333334, 1.0714285714285714,
+         -0.2976190476190476, 0.06944444444444445, -0.010714285714285714, 0.0007936507936507937}};
+};
+constexpr double spline_polynomials<5, 1, 2>::coefficients[2][12];
+
+template <class real_number>
+void beta_n5_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 1, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 1, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 1, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0022222222222222222, -0.024742063492063492, 0.12648809523809523, -0.3968253968253968,
+         0.8333333333333334, -1.2030555555555555, 1.2030555555555555, -0.8333333333333334,
+         0.3968253968253968, -0.12648809523809523, 0.024742063492063492, -0.0022222222222222222},
+        {-0.00031746031746031746, 0.0041964285714285714, -0.026041666666666668, 0.0992063492063492,
+         -0.17857142857142858, 0.10152777777777777, 0.10152777777777777, -0.17857142857142858,
+         0.0992063492063492, -0.026041666666666668, 0.0041964285714285714, -0.00031746031746031746},
+        {-0.0019047619047619048, 0.021498015873015874, -0.11284722222222222, 0.376984126984127,
+         -1.0119047619047619, 1.7681944444444444, -1.7681944444444444, 1.0119047619047619,
+         -0.376984126984127, 0.11284722222222222, -0.021498015873015874, 0.0019047619047619048},
+        {0.0005555555555555556, -0.007455357142857143, 0.04774305555555555, -0.1984126984126984,
+         0.625, -0.46743055555555557, -0.46743055555555557, 0.625,
+         -0.1984126984126984, 0.04774305555555555, -0.007455357142857143, 0.0005555555555555556},
+        {0.00033730158730158733, -0.003828125, 0.020306299603174604, -0.06944444444444445,
+         0.20089285714285715, -1.366857638888889, 1.366857638888889, -0.20089285714285715,
+         0.06944444444444445, -0.020306299603174604, 0.003828125, -0.00033730158730158733},
+        {-0.00011904761904761905, 0.0016015625, -0.010308159722222222, 0.043402777777777776,
+         -0.14508928571428573, 0.6105121527777778, 0.6105121527777778, -0.14508928571428573,
+         0.043402777777777776, -0.010308159722222222, 0.0016015625, -0.00011904761904761905}};
+};
+constexpr double spline_polynomials<5, 2, 0>::coefficients[6][12];
+
+template <>
+struct spline_polynomials<5, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.011111111111111112, -0.12371031746031746, 0.6324404761904762, -1.9841269841269842,
+         4.166666666666667, -6.0152777777777775, 6.0152777777777775, -4.166666666666667,
+         1.9841269841269842, -0.6324404761904762, 0.12371031746031746, -0.011111111111111112},
+        {-0.0012698412698412698, 0.016785714285714286, -0.10416666666666667, 0.3968253968253968,
+         -0.7142857142857143, 0.4061111111111111, 0.4061111111111111, -0.7142857142857143,
+         0.3968253968253968, -0.10416666666666667, 0.016785714285714286, -0.0012698412698412698},
+        {-0.005714285714285714, 0.06449404761904762, -0.3385416666666667, 1.130952380952381,
+         -3.0357142857142856, 5.304583333333333, -5.304583333333333, 3.0357142857142856,
+         -1.130952380952381, 0.3385416666666667, -0.06449404761904762, 0.005714285714285714},
+        {0.0011111111111111111, -0.014910714285714286, 0.0954861111111111, -0.3968253968253968,
+         1.25, -0.9348611111111111, -0.9348611111111111, 1.25,
+         -0.3968253968253968, 0.0954861111111111, -0.014910714285714286, 0.0011111111111111111},
+        {0.00033730158730158733, -0.003828125, 0.020306299603174604, -0.06944444444444445,
+         0.20089285714285715, -1.366857638888889, 1.366857638888889, -0.20089285714285715,
+         0.06944444444444445, -0.020306299603174604, 0.003828125, -0.00033730158730158733}};
+};
+constexpr double spline_polynomials<5, 2, 1>::coefficients[5][12];
+
+template <>
+struct spline_polynomials<5, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.044444444444444446, -0.49484126984126986, 2.5297619047619047, -7.936507936507937,
+         16.666666666666668, -24.06111111111111, 24.06111111111111, -16.666666666666668,
+         7.936507936507937, -2.5297619047619047, 0.49484126984126986, -0.044444444444444446},
+        {-0.0038095238095238095, 0.05035714285714286, -0.3125, 1.1904761904761905,
+         -2.142857142857143, 1.2183333333333333, 1.2183333333333333, -2.142857142857143,
+         1.1904761904761905, -0.3125, 0.05035714285714286, -0.0038095238095238095},
+        {-0.011428571428571429, 0.12898809523809524, -0.6770833333333334, 2.261904761904762,
+         -6.071428571428571, 10.609166666666667, -10.609166666666667, 6.071428571428571,
+         -2.261904761904762, 0.6770833333333334, -0.12898809523809524, 0.011428571428571429},
+        {0.0011111111111111111, -0.014910714285714286, 0.0954861111111111, -0.3968253968253968,
+         1.25, -0.9348611111111111, -0.9348611111111111, 1.25,
+         -0.3968253968253968, 0.0954861111111111, -0.014910714285714286, 0.0011111111111111111}};
+};
+constexpr double spline_polynomials<5, 2, 2>::coefficients[4][12];
+
+template <class real_number>
+void beta_n5_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 2, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 2, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 2, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n5_m7(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-546349.0L/604800.0L*x + 546349.0L/80640.0L) - 11345123.0L/518400.0L) + 639821.0L/16200.0L) - 13016399.0L/302400.0L) + 5717023.0L/201600.0L) - 422147.0L/40320.0L) + 505993.0L/302400.0L) + 1.0L/24192.0L) + 13.0L/172800.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/604800.0L)*x - 6009839.0L/80640.0L) + 124796353.0L/518400.0L) - 7038031.0L/16200.0L) + 143180389.0L/302400.0L) - 161710079.0L/518400.0L) + 3980243.0L/34560.0L) - 927653.0L/50400.0L) - 13.0L/30240.0L) - 19.0L/17280.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/120960.0L*x + 6009839.0L/16128.0L) - 124796353.0L/103680.0L) + 7038031.0L/3240.0L) - 143180389.0L/60480.0L) + 141496319.0L/90720.0L) - 208962751.0L/362880.0L) + 1391479.0L/15120.0L) + 23.0L/13440.0L) + 29.0L/3840.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/40320.0L)*x - 6009839.0L/5376.0L) + 124796353.0L/34560.0L) - 7038031.0L/1080.0L) + 143180389.0L/20160.0L) - 377323517.0L/80640.0L) + 139308497.0L/80640.0L) - 3710611.0L/13440.0L) - 17.0L/5040.0L) - 13.0L/480.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/20160.0L*x + 6009839.0L/2688.0L) - 124796353.0L/17280.0L) + 7038031.0L/540.0L) - 143180389.0L/10080.0L) + 113197055.0L/12096.0L) - 69654247.0L/20160.0L) + 5565919.0L/10080.0L) + 1.0L/320.0L) + 323.0L/5760.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((6009839.0L/14400.0L)*x - 6009839.0L/1920.0L) + 873574471.0L/86400.0L) - 49266217.0L/2700.0L) + 143180389.0L/7200.0L) - 1131970549.0L/86400.0L) + 16717019.0L/3456.0L) - 5565923.0L/7200.0L) - 341.0L/4800.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/14400.0L*x + 6009839.0L/1920.0L) - 873574471.0L/86400.0L) + 49266217.0L/2700.0L) - 143180389.0L/7200.0L) + 94330879.0L/7200.0L) - 13930849.0L/2880.0L) + 695741.0L/900.0L) - 1.0L/320.0L) + 323.0L/5760.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/20160.0L)*x - 6009839.0L/2688.0L) + 124796353.0L/17280.0L) - 7038031.0L/540.0L) + 143180389.0L/10080.0L) - 1131970547.0L/120960.0L) + 15478721.0L/4480.0L) - 11131867.0L/20160.0L) + 17.0L/5040.0L) - 13.0L/480.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/40320.0L*x + 6009839.0L/5376.0L) - 124796353.0L/34560.0L) + 7038031.0L/1080.0L) - 143180389.0L/20160.0L) + 80855039.0L/17280.0L) - 29851819.0L/17280.0L) + 1855313.0L/6720.0L) - 23.0L/13440.0L) + 29.0L/3840.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/120960.0L)*x - 6009839.0L/16128.0L) + 124796353.0L/103680.0L) - 7038031.0L/3240.0L) + 143180389.0L/60480.0L) - 2794989.0L/1792.0L) + 15478721.0L/26880.0L) - 695743.0L/7560.0L) + 13.0L/30240.0L) - 19.0L/17280.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/604800.0L*x + 6009839.0L/80640.0L) - 124796353.0L/518400.0L) + 7038031.0L/16200.0L) - 143180389.0L/302400.0L) + 70748159.0L/226800.0L) - 13930849.0L/120960.0L) + 463829.0L/25200.0L) - 1.0L/24192.0L) + 13.0L/172800.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 8)*(x*(x*(x*(x*(x*(x*((546349.0L/604800.0L)*x - 546349.0L/80640.0L) + 11345123.0L/518400.0L) - 639821.0L/16200.0L) + 13016399.0L/302400.0L) - 102906413.0L/3628800.0L) + 1519729.0L/145152.0L) - 1011991.0L/604800.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-546349.0L/40320.0L*x + 546349.0L/5760.0L) - 147486599.0L/518400.0L) + 639821.0L/1350.0L) - 143180389.0L/302400.0L) + 5717023.0L/20160.0L) - 422147.0L/4480.0L) + 505993.0L/37800.0L) + 1.0L/3456.0L) + 13.0L/28800.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/40320.0L)*x - 6009839.0L/5760.0L) + 1622352589.0L/518400.0L) - 7038031.0L/1350.0L) + 1574984279.0L/302400.0L) - 161710079.0L/51840.0L) + 3980243.0L/3840.0L) - 927653.0L/6300.0L) - 13.0L/4320.0L) - 19.0L/2880.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/8064.0L*x + 6009839.0L/1152.0L) - 1622352589.0L/103680.0L) + 7038031.0L/270.0L) - 1574984279.0L/60480.0L) + 141496319.0L/9072.0L) - 208962751.0L/40320.0L) + 1391479.0L/1890.0L) + 23.0L/1920.0L) + 29.0L/640.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/2688.0L)*x - 6009839.0L/384.0L) + 1622352589.0L/34560.0L) - 7038031.0L/90.0L) + 1574984279.0L/20160.0L) - 377323517.0L/8064.0L) + 139308497.0L/8960.0L) - 3710611.0L/1680.0L) - 17.0L/720.0L) - 13.0L/80.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/1344.0L*x + 6009839.0L/192.0L) - 1622352589.0L/17280.0L) + 7038031.0L/45.0L) - 1574984279.0L/10080.0L) + 565985275.0L/6048.0L) - 69654247.0L/2240.0L) + 5565919.0L/1260.0L) + 7.0L/320.0L) + 323.0L/960.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((6009839.0L/960.0L)*x - 42068873.0L/960.0L) + 11356468123.0L/86400.0L) - 49266217.0L/225.0L) + 1574984279.0L/7200.0L) - 1131970549.0L/8640.0L) + 16717019.0L/384.0L) - 5565923.0L/900.0L) - 341.0L/800.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/960.0L*x + 42068873.0L/960.0L) - 11356468123.0L/86400.0L) + 49266217.0L/225.0L) - 1574984279.0L/7200.0L) + 94330879.0L/720.0L) - 13930849.0L/320.0L) + 1391482.0L/225.0L) - 7.0L/320.0L) + 323.0L/960.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/1344.0L)*x - 6009839.0L/192.0L) + 1622352589.0L/17280.0L) - 7038031.0L/45.0L) + 1574984279.0L/10080.0L) - 1131970547.0L/12096.0L) + 139308489.0L/4480.0L) - 11131867.0L/2520.0L) + 17.0L/720.0L) - 13.0L/80.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/2688.0L*x + 6009839.0L/384.0L) - 1622352589.0L/34560.0L) + 7038031.0L/90.0L) - 1574984279.0L/20160.0L) + 80855039.0L/1728.0L) - 29851819.0L/1920.0L) + 1855313.0L/840.0L) - 23.0L/1920.0L) + 29.0L/640.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/8064.0L)*x - 6009839.0L/1152.0L) + 1622352589.0L/103680.0L) - 7038031.0L/270.0L) + 1574984279.0L/60480.0L) - 13974945.0L/896.0L) + 46436163.0L/8960.0L) - 695743.0L/945.0L) + 13.0L/4320.0L) - 19.0L/2880.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/40320.0L*x + 6009839.0L/5760.0L) - 1622352589.0L/518400.0L) + 7038031.0L/1350.0L) - 1574984279.0L/302400.0L) + 70748159.0L/22680.0L) - 13930849.0L/13440.0L) + 463829.0L/3150.0L) - 1.0L/3456.0L) + 13.0L/28800.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 7)*(x*(x*(x*(x*(x*(x*((546349.0L/40320.0L)*x - 546349.0L/5760.0L) + 147486599.0L/518400.0L) - 639821.0L/1350.0L) + 143180389.0L/302400.0L) - 102906413.0L/362880.0L) + 1519729.0L/16128.0L) - 1011991.0L/75600.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-546349.0L/2880.0L*x + 7102537.0L/5760.0L) - 147486599.0L/43200.0L) + 7038031.0L/1350.0L) - 143180389.0L/30240.0L) + 5717023.0L/2240.0L) - 422147.0L/560.0L) + 505993.0L/5400.0L) + 1.0L/576.0L) + 13.0L/5760.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/2880.0L)*x - 78127907.0L/5760.0L) + 1622352589.0L/43200.0L) - 77418341.0L/1350.0L) + 1574984279.0L/30240.0L) - 161710079.0L/5760.0L) + 3980243.0L/480.0L) - 927653.0L/900.0L) - 13.0L/720.0L) - 19.0L/576.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/576.0L*x + 78127907.0L/1152.0L) - 1622352589.0L/8640.0L) + 77418341.0L/270.0L) - 1574984279.0L/6048.0L) + 141496319.0L/1008.0L) - 208962751.0L/5040.0L) + 1391479.0L/270.0L) + 23.0L/320.0L) + 29.0L/128.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/192.0L)*x - 78127907.0L/384.0L) + 1622352589.0L/2880.0L) - 77418341.0L/90.0L) + 1574984279.0L/2016.0L) - 377323517.0L/896.0L) + 139308497.0L/1120.0L) - 3710611.0L/240.0L) - 17.0L/120.0L) - 13.0L/16.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/96.0L*x + 78127907.0L/192.0L) - 1622352589.0L/1440.0L) + 77418341.0L/45.0L) - 1574984279.0L/1008.0L) + 565985275.0L/672.0L) - 69654247.0L/280.0L) + 5565919.0L/180.0L) + 21.0L/160.0L) + 323.0L/192.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((42068873.0L/480.0L)*x - 546895349.0L/960.0L) + 11356468123.0L/7200.0L) - 541928387.0L/225.0L) + 1574984279.0L/720.0L) - 1131970549.0L/960.0L) + 16717019.0L/48.0L) - 38961461.0L/900.0L) - 341.0L/160.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-42068873.0L/480.0L*x + 546895349.0L/960.0L) - 11356468123.0L/7200.0L) + 541928387.0L/225.0L) - 1574984279.0L/720.0L) + 94330879.0L/80.0L) - 13930849.0L/40.0L) + 9740374.0L/225.0L) - 21.0L/160.0L) + 323.0L/192.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/96.0L)*x - 78127907.0L/192.0L) + 1622352589.0L/1440.0L) - 77418341.0L/45.0L) + 1574984279.0L/1008.0L) - 1131970547.0L/1344.0L) + 139308489.0L/560.0L) - 11131867.0L/360.0L) + 17.0L/120.0L) - 13.0L/16.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/192.0L*x + 78127907.0L/384.0L) - 1622352589.0L/2880.0L) + 77418341.0L/90.0L) - 1574984279.0L/2016.0L) + 80855039.0L/192.0L) - 29851819.0L/240.0L) + 1855313.0L/120.0L) - 23.0L/320.0L) + 29.0L/128.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6009839.0L/576.0L)*x - 78127907.0L/1152.0L) + 1622352589.0L/8640.0L) - 77418341.0L/270.0L) + 1574984279.0L/6048.0L) - 125774505.0L/896.0L) + 46436163.0L/1120.0L) - 695743.0L/135.0L) + 13.0L/720.0L) - 19.0L/576.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6009839.0L/2880.0L*x + 78127907.0L/5760.0L) - 1622352589.0L/43200.0L) + 77418341.0L/1350.0L) - 1574984279.0L/30240.0L) + 70748159.0L/2520.0L) - 13930849.0L/1680.0L) + 463829.0L/450.0L) - 1.0L/576.0L) + 13.0L/5760.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 6)*(x*(x*(x*(x*(x*(x*((546349.0L/2880.0L)*x - 7102537.0L/5760.0L) + 147486599.0L/43200.0L) - 7038031.0L/1350.0L) + 143180389.0L/30240.0L) - 102906413.0L/40320.0L) + 1519729.0L/2016.0L) - 1011991.0L/10800.0L);
-break;
+
+template void beta_n5_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00617173721340388, 0.06794422398589066, -0.34013999118165783, 1.0217096560846561,
+         -2.0454695767195767, 2.8652314814814814, -2.8652314814814814, 2.0454695767195767,
+         -1.0217096560846561, 0.34013999118165783, -0.06794422398589066, 0.00617173721340388},
+        {6.999559082892417e-05, -0.0008779761904761905, 0.004880401234567901, -0.013682208994708995,
+         0.01949404761904762, -0.00988425925925926, -0.00988425925925926, 0.01949404761904762,
+         -0.013682208994708995, 0.004880401234567901, -0.0008779761904761905, 6.999559082892417e-05},
+        {0.006851025132275132, -0.07570023148148149, 0.3815930886243386, -1.1631076388888888,
+         2.367435515873016, -3.3519791666666667, 3.3519791666666667, -2.367435515873016,
+         1.1631076388888888, -0.3815930886243386, 0.07570023148148149, -0.006851025132275132},
+        {-0.0003699570105820106, 0.004854910714285714, -0.029701967592592592, 0.10946800595238096,
+         -0.19319196428571428, 0.10894097222222222, 0.10894097222222222, -0.19319196428571428,
+         0.10946800595238096, -0.029701967592592592, 0.004854910714285714, -0.0003699570105820106},
+        {-0.003061962632275132, 0.03423755787037037, -0.17662347056878308, 0.5685546875,
+         -1.3954303075396826, 2.305425347222222, -2.305425347222222, 1.3954303075396826,
+         -0.5685546875, 0.17662347056878308, -0.03423755787037037, 0.003061962632275132},
+        {0.0005686797288359789, -0.007619977678571428, 0.048658130787037034, -0.20097811259920634,
+         0.6286551339285714, -0.4692838541666667, -0.4692838541666667, 0.6286551339285714,
+         -0.20097811259920634, 0.048658130787037034, -0.007619977678571428, 0.0005686797288359789},
+        {0.0004337349812610229, -0.004889753499779542, 0.025620986965388007, -0.08540865782076719,
+         0.23285331927910052, -1.4116268807870371, 1.4116268807870371, -0.23285331927910052,
+         0.08540865782076719, -0.025620986965388007, 0.004889753499779542, -0.0004337349812610229},
+        {-0.00012014130015432098, 0.0016152808779761904, -0.010384415991512345, 0.04361656229332011,
+         -0.14539388020833333, 0.6106665943287037, 0.6106665943287037, -0.14539388020833333,
+         0.04361656229332011, -0.010384415991512345, 0.0016152808779761904, -0.00012014130015432098}};
+};
+constexpr double spline_polynomials<5, 3, 0>::coefficients[8][12];
+
+template <>
+struct spline_polynomials<5, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.04320216049382716, 0.47560956790123454, -2.380979938271605, 7.151967592592593,
+         -14.318287037037036, 20.05662037037037, -20.05662037037037, 14.318287037037036,
+         -7.151967592592593, 2.380979938271605, -0.47560956790123454, 0.04320216049382716},
+        {0.000419973544973545, -0.005267857142857143, 0.029282407407407406, -0.08209325396825397,
+         0.11696428571428572, -0.059305555555555556, -0.059305555555555556, 0.11696428571428572,
+         -0.08209325396825397, 0.029282407407407406, -0.005267857142857143, 0.000419973544973545},
+        {0.03425512566137566, -0.3785011574074074, 1.907965443121693, -5.815538194444445,
+         11.837177579365079, -16.759895833333335, 16.759895833333335, -11.837177579365079,
+         5.815538194444445, -1.907965443121693, 0.3785011574074074, -0.03425512566137566},
+        {-0.0014798280423280424, 0.019419642857142858, -0.11880787037037037, 0.43787202380952384,
+         -0.7727678571428571, 0.4357638888888889, 0.4357638888888889, -0.7727678571428571,
+         0.43787202380952384, -0.11880787037037037, 0.019419642857142858, -0.0014798280423280424},
+        {-0.009185887896825397, 0.10271267361111111, -0.5298704117063492, 1.7056640625,
+         -4.1862909226190474, 6.916276041666666, -6.916276041666666, 4.1862909226190474,
+         -1.7056640625, 0.5298704117063492, -0.10271267361111111, 0.009185887896825397},
+        {0.0011373594576719577, -0.015239955357142856, 0.09731626157407407, -0.4019562251984127,
+         1.2573102678571428, -0.9385677083333334, -0.9385677083333334, 1.2573102678571428,
+         -0.4019562251984127, 0.09731626157407407, -0.015239955357142856, 0.0011373594576719577},
+        {0.0004337349812610229, -0.004889753499779542, 0.025620986965388007, -0.08540865782076719,
+         0.23285331927910052, -1.4116268807870371, 1.4116268807870371, -0.23285331927910052,
+         0.08540865782076719, -0.025620986965388007, 0.004889753499779542, -0.0004337349812610229}};
+};
+constexpr double spline_polynomials<5, 3, 1>::coefficients[7][12];
+
+template <>
+struct spline_polynomials<5, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.259212962962963, 2.8536574074074075, -14.28587962962963, 42.91180555555555,
+         -85.90972222222223, 120.33972222222222, -120.33972222222222, 85.90972222222223,
+         -42.91180555555555, 14.28587962962963, -2.8536574074074075, 0.259212962962963},
+        {0.002099867724867725, -0.026339285714285714, 0.14641203703703703, -0.4104662698412698,
+         0.5848214285714286, -0.2965277777777778, -0.2965277777777778, 0.5848214285714286,
+         -0.4104662698412698, 0.14641203703703703, -0.026339285714285714, 0.002099867724867725},
+        {0.13702050264550264, -1.5140046296296297, 7.631861772486772, -23.26215277777778,
+         47.348710317460316, -67.03958333333334, 67.03958333333334, -47.348710317460316,
+         23.26215277777778, -7.631861772486772, 1.5140046296296297, -0.13702050264550264},
+        {-0.004439484126984127, 0.05825892857142857, -0.3564236111111111, 1.3136160714285714,
+         -2.3183035714285714, 1.3072916666666667, 1.3072916666666667, -2.3183035714285714,
+         1.3136160714285714, -0.3564236111111111, 0.05825892857142857, -0.004439484126984127},
+        {-0.018371775793650794, 0.20542534722222222, -1.0597408234126984, 3.411328125,
+         -8.372581845238095, 13.832552083333333, -13.832552083333333, 8.372581845238095,
+         -3.411328125, 1.0597408234126984, -0.20542534722222222, 0.018371775793650794},
+        {0.0011373594576719577, -0.015239955357142856, 0.09731626157407407, -0.4019562251984127,
+         1.2573102678571428, -0.9385677083333334, -0.9385677083333334, 1.2573102678571428,
+         -0.4019562251984127, 0.09731626157407407, -0.015239955357142856, 0.0011373594576719577}};
+};
+constexpr double spline_polynomials<5, 3, 2>::coefficients[6][12];
+
+template <class real_number>
+void beta_n5_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 3, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 3, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 3, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.019973544973544973, -0.21971175044091712, 1.0985697751322752, -3.295734126984127,
+         6.591501322751323, -9.228125, 9.228125, -6.591501322751323,
+         3.295734126984127, -1.0985697751322752, 0.21971175044091712, -0.019973544973544973},
+        {-5.5114638447971785e-06, 6.200396825396825e-05, -0.0002797067901234568, 0.0006613756613756613,
+         -0.0008432539682539683, 0.0004050925925925926, 0.0004050925925925926, -0.0008432539682539683,
+         0.0006613756613756613, -0.0002797067901234568, 6.200396825396825e-05, -5.5114638447971785e-06},
+        {-0.026145282186948855, 0.28765597442680774, -1.438709766313933, 4.317443783068783,
+         -8.6369708994709, 12.093356481481482, -12.093356481481482, 8.6369708994709,
+         -4.317443783068783, 1.438709766313933, -0.28765597442680774, 0.026145282186948855},
+        {7.550705467372134e-05, -0.0009399801587301588, 0.005160108024691358, -0.014343584656084657,
+         0.020337301587301588, -0.010289351851851852, -0.010289351851851852, 0.020337301587301588,
+         -0.014343584656084657, 0.005160108024691358, -0.0009399801587301588, 7.550705467372134e-05},
+        {0.014341104497354498, -0.15809213789682539, 0.7935567542989418, -2.3990079365079366,
+         4.839248511904762, -6.812526041666667, 6.812526041666667, -4.839248511904762,
+         2.3990079365079366, -0.7935567542989418, 0.15809213789682539, -0.014341104497354498},
+        {-0.0003720238095238095, 0.004878162202380952, -0.02980685763888889, 0.10971602182539683,
+         -0.19350818452380952, 0.10909288194444444, 0.10909288194444444, -0.19350818452380952,
+         0.10971602182539683, -0.02980685763888889, 0.004878162202380952, -0.0003720238095238095},
+        {-0.004310309193121693, 0.04796954227292769, -0.24528408151455028, 0.7745380704365079,
+         -1.8073991402116403, 2.882183159722222, -2.882183159722222, 1.8073991402116403,
+         -0.7745380704365079, 0.24528408151455028, -0.04796954227292769, 0.004310309193121693},
+        {0.0005690241953262787, -0.007623852926587301, 0.04867561246141975, -0.20101944857804233,
+         0.6287078373015873, -0.4693091724537037, -0.4693091724537037, 0.6287078373015873,
+         -0.20101944857804233, 0.04867561246141975, -0.007623852926587301, 0.0005690241953262787},
+        {0.000511756641313933, -0.0057480025249393735, 0.029912275149498457, -0.09828261925429894,
+         0.2586013713210979, -1.447674244068287, 1.447674244068287, -0.2586013713210979,
+         0.09828261925429894, -0.029912275149498457, 0.0057480025249393735, -0.000511756641313933},
+        {-0.00012016282930996473, 0.0016155230809771826, -0.010385508596161266, 0.043619145791997355,
+         -0.14539717416914683, 0.6106681767216435, 0.6106681767216435, -0.14539717416914683,
+         0.043619145791997355, -0.010385508596161266, 0.0016155230809771826, -0.00012016282930996473}};
+};
+constexpr double spline_polynomials<5, 4, 0>::coefficients[10][12];
+
+template <>
+struct spline_polynomials<5, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.17976190476190476, -1.977405753968254, 9.887127976190476, -29.661607142857143,
+         59.32351190476191, -83.053125, 83.053125, -59.32351190476191,
+         29.661607142857143, -9.887127976190476, 1.977405753968254, -0.17976190476190476},
+        {-4.409171075837743e-05, 0.000496031746031746, -0.0022376543209876544, 0.005291005291005291,
+         -0.006746031746031746, 0.0032407407407407406, 0.0032407407407407406, -0.006746031746031746,
+         0.005291005291005291, -0.0022376543209876544, 0.000496031746031746, -4.409171075837743e-05},
+        {-0.18301697530864197, 2.013591820987654, -10.070968364197531, 30.222106481481482,
+         -60.4587962962963, 84.65349537037036, -84.65349537037036, 60.4587962962963,
+         -30.222106481481482, 10.070968364197531, -2.013591820987654, 0.18301697530864197},
+        {0.000453042328042328, -0.005639880952380953, 0.030960648148148147, -0.08606150793650794,
+         0.12202380952380952, -0.06173611111111111, -0.06173611111111111, 0.12202380952380952,
+         -0.08606150793650794, 0.030960648148148147, -0.005639880952380953, 0.000453042328042328},
+        {0.07170552248677249, -0.790460689484127, 3.967783771494709, -11.995039682539682,
+         24.19624255952381, -34.06263020833333, 34.06263020833333, -24.19624255952381,
+         11.995039682539682, -3.967783771494709, 0.790460689484127, -0.07170552248677249},
+        {-0.001488095238095238, 0.01951264880952381, -0.11922743055555556, 0.4388640873015873,
+         -0.7740327380952381, 0.43637152777777777, 0.43637152777777777, -0.7740327380952381,
+         0.4388640873015873, -0.11922743055555556, 0.01951264880952381, -0.001488095238095238},
+        {-0.012930927579365079, 0.14390862681878308, -0.7358522445436508, 2.3236142113095237,
+         -5.42219742063492, 8.646549479166667, -8.646549479166667, 5.42219742063492,
+         -2.3236142113095237, 0.7358522445436508, -0.14390862681878308, 0.012930927579365079},
+        {0.0011380483906525574, -0.015247705853174602, 0.0973512249228395, -0.40203889715608465,
+         1.2574156746031746, -0.9386183449074074, -0.9386183449074074, 1.2574156746031746,
+         -0.40203889715608465, 0.0973512249228395, -0.015247705853174602, 0.0011380483906525574},
+        {0.000511756641313933, -0.0057480025249393735, 0.029912275149498457, -0.09828261925429894,
+         0.2586013713210979, -1.447674244068287, 1.447674244068287, -0.2586013713210979,
+         0.09828261925429894, -0.029912275149498457, 0.0057480025249393735, -0.000511756641313933}};
+};
+constexpr double spline_polynomials<5, 4, 1>::coefficients[9][12];
+
+template <>
+struct spline_polynomials<5, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {1.438095238095238, -15.819246031746031, 79.0970238095238, -237.29285714285714,
+         474.58809523809526, -664.425, 664.425, -474.58809523809526,
+         237.29285714285714, -79.0970238095238, 15.819246031746031, -1.438095238095238},
+        {-0.00030864197530864197, 0.003472222222222222, -0.01566358024691358, 0.037037037037037035,
+         -0.04722222222222222, 0.022685185185185187, 0.022685185185185187, -0.04722222222222222,
+         0.037037037037037035, -0.01566358024691358, 0.003472222222222222, -0.00030864197530864197},
+        {-1.098101851851852, 12.081550925925926, -60.425810185185185, 181.33263888888888,
+         -362.7527777777778, 507.92097222222225, -507.92097222222225, 362.7527777777778,
+         -181.33263888888888, 60.425810185185185, -12.081550925925926, 1.098101851851852},
+        {0.0022652116402116403, -0.028199404761904762, 0.15480324074074073, -0.4303075396825397,
+         0.6101190476190477, -0.30868055555555557, -0.30868055555555557, 0.6101190476190477,
+         -0.4303075396825397, 0.15480324074074073, -0.028199404761904762, 0.0022652116402116403},
+        {0.28682208994708996, -3.161842757936508, 15.871135085978835, -47.98015873015873,
+         96.78497023809524, -136.25052083333333, 136.25052083333333, -96.78497023809524,
+         47.98015873015873, -15.871135085978835, 3.161842757936508, -0.28682208994708996},
+        {-0.004464285714285714, 0.05853794642857143, -0.35768229166666665, 1.3165922619047619,
+         -2.3220982142857145, 1.3091145833333333, 1.3091145833333333, -2.3220982142857145,
+         1.3165922619047619, -0.35768229166666665, 0.05853794642857143, -0.004464285714285714},
+        {-0.025861855158730157, 0.28781725363756616, -1.4717044890873017, 4.6472284226190474,
+         -10.84439484126984, 17.293098958333335, -17.293098958333335, 10.84439484126984,
+         -4.6472284226190474, 1.4717044890873017, -0.28781725363756616, 0.025861855158730157},
+        {0.0011380483906525574, -0.015247705853174602, 0.0973512249228395, -0.40203889715608465,
+         1.2574156746031746, -0.9386183449074074, -0.9386183449074074, 1.2574156746031746,
+         -0.40203889715608465, 0.0973512249228395, -0.015247705853174602, 0.0011380483906525574}};
+};
+constexpr double spline_polynomials<5, 4, 2>::coefficients[8][12];
+
+template <class real_number>
+void beta_n5_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 4, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 4, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 4, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n5_m8(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1011991.0L/302400.0L)*x - 17203847.0L/604800.0L) + 285427.0L/2688.0L) - 55032449.0L/241920.0L) + 31733873.0L/103680.0L) - 34349081.0L/129600.0L) + 14551699.0L/100800.0L) - 5475307.0L/120960.0L) + 757541.0L/120960.0L) - 1.0L/120960.0L) + 1.0L/24192.0L) + 13.0L/172800.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11131901.0L/302400.0L*x + 189242317.0L/604800.0L) - 3139697.0L/2688.0L) + 605356939.0L/241920.0L) - 349072603.0L/103680.0L) + 377839891.0L/129600.0L) - 160068689.0L/100800.0L) + 1806851311.0L/3628800.0L) - 1851767.0L/26880.0L) + 13.0L/120960.0L) - 13.0L/30240.0L) - 19.0L/17280.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11131901.0L/60480.0L)*x - 189242317.0L/120960.0L) + 15698485.0L/2688.0L) - 605356939.0L/48384.0L) + 349072603.0L/20736.0L) - 377839891.0L/25920.0L) + 160068689.0L/20160.0L) - 16132601.0L/6480.0L) + 124994279.0L/362880.0L) - 23.0L/40320.0L) + 23.0L/13440.0L) + 29.0L/3840.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11131901.0L/20160.0L*x + 189242317.0L/40320.0L) - 15698485.0L/896.0L) + 605356939.0L/16128.0L) - 349072603.0L/6912.0L) + 377839891.0L/8640.0L) - 160068689.0L/6720.0L) + 66920419.0L/8960.0L) - 83329523.0L/80640.0L) + 17.0L/10080.0L) - 17.0L/5040.0L) - 13.0L/480.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11131901.0L/10080.0L)*x - 189242317.0L/20160.0L) + 15698485.0L/448.0L) - 605356939.0L/8064.0L) + 349072603.0L/3456.0L) - 377839891.0L/4320.0L) + 160068689.0L/3360.0L) - 903425657.0L/60480.0L) + 5952109.0L/2880.0L) - 1.0L/320.0L) + 1.0L/320.0L) + 323.0L/5760.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-11131901.0L/7200.0L*x + 189242317.0L/14400.0L) - 3139697.0L/64.0L) + 605356939.0L/5760.0L) - 2443508221.0L/17280.0L) + 2644879237.0L/21600.0L) - 160068689.0L/2400.0L) + 361370263.0L/17280.0L) - 49997717.0L/17280.0L) + 11.0L/2880.0L) - 341.0L/4800.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11131901.0L/7200.0L)*x - 189242317.0L/14400.0L) + 3139697.0L/64.0L) - 605356939.0L/5760.0L) + 2443508221.0L/17280.0L) - 2644879237.0L/21600.0L) + 160068689.0L/2400.0L) - 150570943.0L/7200.0L) + 2777651.0L/960.0L) - 1.0L/320.0L) - 1.0L/320.0L) + 323.0L/5760.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11131901.0L/10080.0L*x + 189242317.0L/20160.0L) - 15698485.0L/448.0L) + 605356939.0L/8064.0L) - 349072603.0L/3456.0L) + 377839891.0L/4320.0L) - 160068689.0L/3360.0L) + 1806851317.0L/120960.0L) - 83329531.0L/40320.0L) + 17.0L/10080.0L) + 17.0L/5040.0L) - 13.0L/480.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11131901.0L/20160.0L)*x - 189242317.0L/40320.0L) + 15698485.0L/896.0L) - 605356939.0L/16128.0L) + 349072603.0L/6912.0L) - 377839891.0L/8640.0L) + 160068689.0L/6720.0L) - 903425659.0L/120960.0L) + 124994297.0L/120960.0L) - 23.0L/40320.0L) - 23.0L/13440.0L) + 29.0L/3840.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11131901.0L/60480.0L*x + 189242317.0L/120960.0L) - 15698485.0L/2688.0L) + 605356939.0L/48384.0L) - 349072603.0L/20736.0L) + 377839891.0L/25920.0L) - 160068689.0L/20160.0L) + 86040539.0L/34560.0L) - 83329531.0L/241920.0L) + 13.0L/120960.0L) + 13.0L/30240.0L) - 19.0L/17280.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11131901.0L/302400.0L)*x - 189242317.0L/604800.0L) + 3139697.0L/2688.0L) - 605356939.0L/241920.0L) + 349072603.0L/103680.0L) - 377839891.0L/129600.0L) + 160068689.0L/100800.0L) - 45171283.0L/90720.0L) + 2777651.0L/40320.0L) - 1.0L/120960.0L) - 1.0L/24192.0L) + 13.0L/172800.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*(-1011991.0L/302400.0L*x + 17203847.0L/604800.0L) - 285427.0L/2688.0L) + 55032449.0L/241920.0L) - 31733873.0L/103680.0L) + 34349081.0L/129600.0L) - 14551699.0L/100800.0L) + 164259211.0L/3628800.0L) - 649321.0L/103680.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17203847.0L/302400.0L)*x - 17203847.0L/37800.0L) + 1427135.0L/896.0L) - 55032449.0L/17280.0L) + 412540349.0L/103680.0L) - 34349081.0L/10800.0L) + 160068689.0L/100800.0L) - 5475307.0L/12096.0L) + 757541.0L/13440.0L) - 1.0L/15120.0L) + 1.0L/3456.0L) + 13.0L/28800.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/302400.0L*x + 189242317.0L/37800.0L) - 15698485.0L/896.0L) + 605356939.0L/17280.0L) - 4537943839.0L/103680.0L) + 377839891.0L/10800.0L) - 1760755579.0L/100800.0L) + 1806851311.0L/362880.0L) - 5555301.0L/8960.0L) + 13.0L/15120.0L) - 13.0L/4320.0L) - 19.0L/2880.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/60480.0L)*x - 189242317.0L/7560.0L) + 78492425.0L/896.0L) - 605356939.0L/3456.0L) + 4537943839.0L/20736.0L) - 377839891.0L/2160.0L) + 1760755579.0L/20160.0L) - 16132601.0L/648.0L) + 124994279.0L/40320.0L) - 23.0L/5040.0L) + 23.0L/1920.0L) + 29.0L/640.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/20160.0L*x + 189242317.0L/2520.0L) - 235477275.0L/896.0L) + 605356939.0L/1152.0L) - 4537943839.0L/6912.0L) + 377839891.0L/720.0L) - 1760755579.0L/6720.0L) + 66920419.0L/896.0L) - 83329523.0L/8960.0L) + 17.0L/1260.0L) - 17.0L/720.0L) - 13.0L/80.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/10080.0L)*x - 189242317.0L/1260.0L) + 235477275.0L/448.0L) - 605356939.0L/576.0L) + 4537943839.0L/3456.0L) - 377839891.0L/360.0L) + 1760755579.0L/3360.0L) - 903425657.0L/6048.0L) + 5952109.0L/320.0L) - 1.0L/40.0L) + 7.0L/320.0L) + 323.0L/960.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/7200.0L*x + 189242317.0L/900.0L) - 47095455.0L/64.0L) + 4237498573.0L/2880.0L) - 31765606873.0L/17280.0L) + 2644879237.0L/1800.0L) - 1760755579.0L/2400.0L) + 361370263.0L/1728.0L) - 49997717.0L/1920.0L) + 11.0L/360.0L) - 341.0L/800.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/7200.0L)*x - 189242317.0L/900.0L) + 47095455.0L/64.0L) - 4237498573.0L/2880.0L) + 31765606873.0L/17280.0L) - 2644879237.0L/1800.0L) + 1760755579.0L/2400.0L) - 150570943.0L/720.0L) + 8332953.0L/320.0L) - 1.0L/40.0L) - 7.0L/320.0L) + 323.0L/960.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/10080.0L*x + 189242317.0L/1260.0L) - 235477275.0L/448.0L) + 605356939.0L/576.0L) - 4537943839.0L/3456.0L) + 377839891.0L/360.0L) - 1760755579.0L/3360.0L) + 1806851317.0L/12096.0L) - 83329531.0L/4480.0L) + 17.0L/1260.0L) + 17.0L/720.0L) - 13.0L/80.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/20160.0L)*x - 189242317.0L/2520.0L) + 235477275.0L/896.0L) - 605356939.0L/1152.0L) + 4537943839.0L/6912.0L) - 377839891.0L/720.0L) + 1760755579.0L/6720.0L) - 903425659.0L/12096.0L) + 124994297.0L/13440.0L) - 23.0L/5040.0L) - 23.0L/1920.0L) + 29.0L/640.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/60480.0L*x + 189242317.0L/7560.0L) - 78492425.0L/896.0L) + 605356939.0L/3456.0L) - 4537943839.0L/20736.0L) + 377839891.0L/2160.0L) - 1760755579.0L/20160.0L) + 86040539.0L/3456.0L) - 83329531.0L/26880.0L) + 13.0L/15120.0L) + 13.0L/4320.0L) - 19.0L/2880.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/302400.0L)*x - 189242317.0L/37800.0L) + 15698485.0L/896.0L) - 605356939.0L/17280.0L) + 4537943839.0L/103680.0L) - 377839891.0L/10800.0L) + 1760755579.0L/100800.0L) - 45171283.0L/9072.0L) + 2777651.0L/4480.0L) - 1.0L/15120.0L) - 1.0L/3456.0L) + 13.0L/28800.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(x*(-17203847.0L/302400.0L*x + 17203847.0L/37800.0L) - 1427135.0L/896.0L) + 55032449.0L/17280.0L) - 412540349.0L/103680.0L) + 34349081.0L/10800.0L) - 160068689.0L/100800.0L) + 164259211.0L/362880.0L) - 649321.0L/11520.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17203847.0L/18900.0L)*x - 17203847.0L/2520.0L) + 1427135.0L/64.0L) - 715421837.0L/17280.0L) + 412540349.0L/8640.0L) - 377839891.0L/10800.0L) + 160068689.0L/10080.0L) - 5475307.0L/1344.0L) + 757541.0L/1680.0L) - 1.0L/2160.0L) + 1.0L/576.0L) + 13.0L/5760.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/18900.0L*x + 189242317.0L/2520.0L) - 15698485.0L/64.0L) + 7869640207.0L/17280.0L) - 4537943839.0L/8640.0L) + 4156238801.0L/10800.0L) - 1760755579.0L/10080.0L) + 1806851311.0L/40320.0L) - 5555301.0L/1120.0L) + 13.0L/2160.0L) - 13.0L/720.0L) - 19.0L/576.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/3780.0L)*x - 189242317.0L/504.0L) + 78492425.0L/64.0L) - 7869640207.0L/3456.0L) + 4537943839.0L/1728.0L) - 4156238801.0L/2160.0L) + 1760755579.0L/2016.0L) - 16132601.0L/72.0L) + 124994279.0L/5040.0L) - 23.0L/720.0L) + 23.0L/320.0L) + 29.0L/128.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/1260.0L*x + 189242317.0L/168.0L) - 235477275.0L/64.0L) + 7869640207.0L/1152.0L) - 4537943839.0L/576.0L) + 4156238801.0L/720.0L) - 1760755579.0L/672.0L) + 602283771.0L/896.0L) - 83329523.0L/1120.0L) + 17.0L/180.0L) - 17.0L/120.0L) - 13.0L/16.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/630.0L)*x - 189242317.0L/84.0L) + 235477275.0L/32.0L) - 7869640207.0L/576.0L) + 4537943839.0L/288.0L) - 4156238801.0L/360.0L) + 1760755579.0L/336.0L) - 903425657.0L/672.0L) + 5952109.0L/40.0L) - 7.0L/40.0L) + 21.0L/160.0L) + 323.0L/192.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/450.0L*x + 189242317.0L/60.0L) - 329668185.0L/32.0L) + 55087481449.0L/2880.0L) - 31765606873.0L/1440.0L) + 29093671607.0L/1800.0L) - 1760755579.0L/240.0L) + 361370263.0L/192.0L) - 49997717.0L/240.0L) + 77.0L/360.0L) - 341.0L/160.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/450.0L)*x - 189242317.0L/60.0L) + 329668185.0L/32.0L) - 55087481449.0L/2880.0L) + 31765606873.0L/1440.0L) - 29093671607.0L/1800.0L) + 1760755579.0L/240.0L) - 150570943.0L/80.0L) + 8332953.0L/40.0L) - 7.0L/40.0L) - 21.0L/160.0L) + 323.0L/192.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/630.0L*x + 189242317.0L/84.0L) - 235477275.0L/32.0L) + 7869640207.0L/576.0L) - 4537943839.0L/288.0L) + 4156238801.0L/360.0L) - 1760755579.0L/336.0L) + 1806851317.0L/1344.0L) - 83329531.0L/560.0L) + 17.0L/180.0L) + 17.0L/120.0L) - 13.0L/16.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/1260.0L)*x - 189242317.0L/168.0L) + 235477275.0L/64.0L) - 7869640207.0L/1152.0L) + 4537943839.0L/576.0L) - 4156238801.0L/720.0L) + 1760755579.0L/672.0L) - 903425659.0L/1344.0L) + 124994297.0L/1680.0L) - 23.0L/720.0L) - 23.0L/320.0L) + 29.0L/128.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-189242317.0L/3780.0L*x + 189242317.0L/504.0L) - 78492425.0L/64.0L) + 7869640207.0L/3456.0L) - 4537943839.0L/1728.0L) + 4156238801.0L/2160.0L) - 1760755579.0L/2016.0L) + 86040539.0L/384.0L) - 83329531.0L/3360.0L) + 13.0L/2160.0L) + 13.0L/720.0L) - 19.0L/576.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((189242317.0L/18900.0L)*x - 189242317.0L/2520.0L) + 15698485.0L/64.0L) - 7869640207.0L/17280.0L) + 4537943839.0L/8640.0L) - 4156238801.0L/10800.0L) + 1760755579.0L/10080.0L) - 45171283.0L/1008.0L) + 2777651.0L/560.0L) - 1.0L/2160.0L) - 1.0L/576.0L) + 13.0L/5760.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 7)*(x*(x*(x*(x*(x*(x*(x*(-17203847.0L/18900.0L*x + 17203847.0L/2520.0L) - 1427135.0L/64.0L) + 715421837.0L/17280.0L) - 412540349.0L/8640.0L) + 377839891.0L/10800.0L) - 160068689.0L/10080.0L) + 164259211.0L/40320.0L) - 649321.0L/1440.0L);
-break;
+
+template void beta_n5_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 5, 0>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.06911623677248677, 0.7602786044973545, -3.8013930224867725, 11.404179067460317,
+         -22.808358134920635, 31.93170138888889, -31.93170138888889, 22.808358134920635,
+         -11.404179067460317, 3.8013930224867725, -0.7602786044973545, 0.06911623677248677},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {0.10636884093915344, -1.1700600060626103, 5.85031105324074, -17.550957961309525,
+         35.10194899140212, -49.14275173611111, 49.14275173611111, -35.10194899140212,
+         17.550957961309525, -5.85031105324074, 1.1700600060626103, -0.10636884093915344},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-0.06934293016975308, 0.7628301022376544, -3.814580405368166, 11.445055700231482,
+         -22.892194733796295, 32.05066984953704, -32.05066984953704, 22.892194733796295,
+         -11.445055700231482, 3.814580405368166, -0.7628301022376544, 0.06934293016975308},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.025140516493055556, -0.27688566984953705, 1.3875244140625, -4.180910915798611,
+         8.403054470486111, -11.801854383680556, 11.801854383680556, -8.403054470486111,
+         4.180910915798611, -1.3875244140625, 0.27688566984953705, -0.025140516493055556},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.005660235692584325, 0.06281873376701665, -0.31953003898499505, 0.9972759428478423,
+         -2.2528748850343088, 3.5058492024739585, -3.5058492024739585, 2.2528748850343088,
+         -0.9972759428478423, 0.31953003898499505, -0.06281873376701665, 0.005660235692584325},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0005792529662870646, -0.006490462099643822, 0.033624573023020694, -0.10941951287486566,
+         0.28087515856223133, -1.478857546205874, 1.478857546205874, -0.28087515856223133,
+         0.10941951287486566, -0.033624573023020694, 0.006490462099643822, -0.0005792529662870646},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 5, 0>::coefficients[12][12];
+
+template <>
+struct spline_polynomials<5, 5, 1>
+{
+    static constexpr int degree = 10;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.7602786044973545, 8.3630646494709, -41.8153232473545, 125.4459697420635,
+         -250.891939484127, 351.24871527777776, -351.24871527777776, 250.891939484127,
+         -125.4459697420635, 41.8153232473545, -8.3630646494709, 0.7602786044973545},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {0.957319568452381, -10.530540054563492, 52.65279947916667, -157.9586216517857,
+         315.917540922619, -442.284765625, 442.284765625, -315.917540922619,
+         157.9586216517857, -52.65279947916667, 10.530540054563492, -0.957319568452381},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-0.4854005111882716, 5.33981071566358, -26.70206283757716, 80.11538990162038,
+         -160.24536313657407, 224.35468894675927, -224.35468894675927, 160.24536313657407,
+         -80.11538990162038, 26.70206283757716, -5.33981071566358, 0.4854005111882716},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.12570258246527777, -1.3844283492476852, 6.9376220703125, -20.904554578993057,
+         42.01527235243056, -59.009271918402774, 59.009271918402774, -42.01527235243056,
+         20.904554578993057, -6.9376220703125, 1.3844283492476852, -0.12570258246527777},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.016980707077752975, 0.18845620130104992, -0.9585901169549851, 2.991827828543527,
+         -6.758624655102927, 10.517547607421875, -10.517547607421875, 6.758624655102927,
+         -2.991827828543527, 0.9585901169549851, -0.18845620130104992, 0.016980707077752975},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0005792529662870646, -0.006490462099643822, 0.033624573023020694, -0.10941951287486566,
+         0.28087515856223133, -1.478857546205874, 1.478857546205874, -0.28087515856223133,
+         0.10941951287486566, -0.033624573023020694, 0.006490462099643822, -0.0005792529662870646}};
+};
+constexpr double spline_polynomials<5, 5, 1>::coefficients[11][12];
+
+template <>
+struct spline_polynomials<5, 5, 2>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-7.602786044973545, 83.630646494709, -418.15323247354496, 1254.459697420635,
+         -2508.91939484127, 3512.4871527777777, -3512.4871527777777, 2508.91939484127,
+         -1254.459697420635, 418.15323247354496, -83.630646494709, 7.602786044973545},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {7.658556547619048, -84.24432043650793, 421.22239583333334, -1263.6689732142856,
+         2527.340327380952, -3538.278125, 3538.278125, -2527.340327380952,
+         1263.6689732142856, -421.22239583333334, 84.24432043650793, -7.658556547619048},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-2.9124030671296297, 32.03886429398148, -160.21237702546296, 480.6923394097222,
+         -961.4721788194445, 1346.1281336805555, -1346.1281336805555, 961.4721788194445,
+         -480.6923394097222, 160.21237702546296, -32.03886429398148, 2.9124030671296297},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {0.5028103298611111, -5.537713396990741, 27.75048828125, -83.61821831597223,
+         168.06108940972223, -236.0370876736111, 236.0370876736111, -168.06108940972223,
+         83.61821831597223, -27.75048828125, 5.537713396990741, -0.5028103298611111},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.03396141415550595, 0.37691240260209985, -1.9171802339099702, 5.983655657087054,
+         -13.517249310205854, 21.03509521484375, -21.03509521484375, 13.517249310205854,
+         -5.983655657087054, 1.9171802339099702, -0.37691240260209985, 0.03396141415550595},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 5, 2>::coefficients[10][12];
+
+template <class real_number>
+void beta_n5_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 5, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 5, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 5, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m5<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m5<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 6, 0>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.24731095679012347, -2.720420524691358, 13.60210262345679, -40.80630787037037,
+         81.61261574074074, -114.25766203703704, 114.25766203703704, -81.61261574074074,
+         40.80630787037037, -13.60210262345679, 2.720420524691358, -0.24731095679012347},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-0.440082671957672, 4.8409093915343915, -24.20454695767196, 72.61364087301587,
+         -145.22728174603174, 203.31819444444446, -203.31819444444446, 145.22728174603174,
+         -72.61364087301587, 24.20454695767196, -4.8409093915343915, 0.440082671957672},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {0.3382228629298942, -3.7204542479607583, 18.60228226273148, -55.80687158978174,
+         111.61377624834657, -156.25930989583333, 156.25930989583333, -111.61377624834657,
+         55.80687158978174, -18.60228226273148, 3.7204542479607583, -0.3382228629298942},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-0.14662760416666668, 1.6129615162037036, -8.065237475198412, 24.197026909722222,
+         -48.396137152777776, 67.75618923611111, -67.75618923611111, 48.396137152777776,
+         -24.197026909722222, 8.065237475198412, -1.6129615162037036, 0.14662760416666668},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.03963139286747685, -0.4362853099681713, 2.184522614655671, -6.571905517578125,
+         13.185043674045138, -18.496639268663195, 18.496639268663195, -13.185043674045138,
+         6.571905517578125, -2.184522614655671, 0.4362853099681713, -0.03963139286747685},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.007109323330026455, 0.07875869777888007, -0.3992298590443122, 1.2363754030257936,
+         -2.7310738053902117, 4.175327690972222, -4.175327690972222, 2.7310738053902117,
+         -1.2363754030257936, 0.3992298590443122, -0.07875869777888007, 0.007109323330026455},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0006396316178471533, -0.007154627266804798, 0.03694539885882558, -0.1193819903822803,
+         0.3008001135770606, -1.5067524832266348, 1.5067524832266348, -0.3008001135770606,
+         0.1193819903822803, -0.03694539885882558, 0.007154627266804798, -0.0006396316178471533},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 6, 0>::coefficients[14][12];
+
+template <>
+struct spline_polynomials<5, 6, 1>
+{
+    static constexpr int degree = 12;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.2150424382716047, -35.365466820987656, 176.82733410493827, -530.4820023148148,
+         1060.9640046296297, -1485.3496064814815, 1485.3496064814815, -1060.9640046296297,
+         530.4820023148148, -176.82733410493827, 35.365466820987656, -3.2150424382716047},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-4.8409093915343915, 53.250003306878305, -266.25001653439153, 798.7500496031746,
+         -1597.5000992063492, 2236.500138888889, -2236.500138888889, 1597.5000992063492,
+         -798.7500496031746, 266.25001653439153, -53.250003306878305, 4.8409093915343915},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {3.0440057663690476, -33.48408823164682, 167.42054036458333, -502.26184430803573,
+         1004.5239862351191, -1406.3337890625, 1406.3337890625, -1004.5239862351191,
+         502.26184430803573, -167.42054036458333, 33.48408823164682, -3.0440057663690476},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-1.0263932291666666, 11.290730613425925, -56.45666232638889, 169.37918836805557,
+         -338.7729600694444, 474.29332465277776, -474.29332465277776, 338.7729600694444,
+         -169.37918836805557, 56.45666232638889, -11.290730613425925, 1.0263932291666666},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.19815696433738425, -2.1814265498408565, 10.922613073278356, -32.859527587890625,
+         65.92521837022569, -92.48319634331597, 92.48319634331597, -65.92521837022569,
+         32.859527587890625, -10.922613073278356, 2.1814265498408565, -0.19815696433738425},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.021327969990079364, 0.2362760933366402, -1.1976895771329366, 3.709126209077381,
+         -8.193221416170635, 12.525983072916667, -12.525983072916667, 8.193221416170635,
+         -3.709126209077381, 1.1976895771329366, -0.2362760933366402, 0.021327969990079364},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0006396316178471533, -0.007154627266804798, 0.03694539885882558, -0.1193819903822803,
+         0.3008001135770606, -1.5067524832266348, 1.5067524832266348, -0.3008001135770606,
+         0.1193819903822803, -0.03694539885882558, 0.007154627266804798, -0.0006396316178471533}};
+};
+constexpr double spline_polynomials<5, 6, 1>::coefficients[13][12];
+
+template <>
+struct spline_polynomials<5, 6, 2>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {38.58050925925926, -424.38560185185185, 2121.9280092592594, -6365.784027777778,
+         12731.568055555555, -17824.195277777777, 17824.195277777777, -12731.568055555555,
+         6365.784027777778, -2121.9280092592594, 424.38560185185185, -38.58050925925926},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-48.40909391534392, 532.5000330687831, -2662.5001653439153, 7987.5004960317465,
+         -15975.000992063493, 22365.00138888889, -22365.00138888889, 15975.000992063493,
+         -7987.5004960317465, 2662.5001653439153, -532.5000330687831, 48.40909391534392},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {24.35204613095238, -267.8727058531746, 1339.3643229166667, -4018.094754464286,
+         8036.191889880953, -11250.6703125, 11250.6703125, -8036.191889880953,
+         4018.094754464286, -1339.3643229166667, 267.8727058531746, -24.35204613095238},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-6.158359375, 67.74438368055556, -338.73997395833334, 1016.2751302083333,
+         -2032.6377604166667, 2845.7599479166665, -2845.7599479166665, 2032.6377604166667,
+         -1016.2751302083333, 338.73997395833334, -67.74438368055556, 6.158359375},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {0.792627857349537, -8.725706199363426, 43.690452293113424, -131.4381103515625,
+         263.70087348090277, -369.93278537326387, 369.93278537326387, -263.70087348090277,
+         131.4381103515625, -43.690452293113424, 8.725706199363426, -0.792627857349537},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.04265593998015873, 0.4725521866732804, -2.395379154265873, 7.418252418154762,
+         -16.38644283234127, 25.051966145833333, -25.051966145833333, 16.38644283234127,
+         -7.418252418154762, 2.395379154265873, -0.4725521866732804, 0.04265593998015873},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 6, 2>::coefficients[12][12];
+
+template <class real_number>
+void beta_n5_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 6, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 6, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 6, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n5_m9(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-649321.0L/51840.0L*x + 12337099.0L/103680.0L) - 609560381.0L/1209600.0L) + 83943127.0L/67200.0L) - 241689617.0L/120960.0L) + 517668673.0L/241920.0L) - 159166501.0L/103680.0L) + 46134257.0L/64800.0L) - 39075307.0L/201600.0L) + 3429175.0L/145152.0L) - 1.0L/725760.0L) - 1.0L/120960.0L) + 1.0L/24192.0L) + 13.0L/172800.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7142531.0L/51840.0L)*x - 135708089.0L/103680.0L) + 6705164191.0L/1209600.0L) - 923374397.0L/67200.0L) + 2658585787.0L/120960.0L) - 5694355403.0L/241920.0L) + 1750831511.0L/103680.0L) - 507476827.0L/64800.0L) + 429828377.0L/201600.0L) - 235755781.0L/907200.0L) + 1.0L/90720.0L) + 13.0L/120960.0L) - 13.0L/30240.0L) - 19.0L/17280.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7142531.0L/10368.0L*x + 135708089.0L/20736.0L) - 6705164191.0L/241920.0L) + 923374397.0L/13440.0L) - 2658585787.0L/24192.0L) + 5694355403.0L/48384.0L) - 1750831511.0L/20736.0L) + 507476827.0L/12960.0L) - 429828377.0L/40320.0L) + 14968621.0L/11520.0L) - 1.0L/26880.0L) - 23.0L/40320.0L) + 23.0L/13440.0L) + 29.0L/3840.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7142531.0L/3456.0L)*x - 135708089.0L/6912.0L) + 6705164191.0L/80640.0L) - 923374397.0L/4480.0L) + 2658585787.0L/8064.0L) - 5694355403.0L/16128.0L) + 1750831511.0L/6912.0L) - 507476827.0L/4320.0L) + 429828377.0L/13440.0L) - 471511561.0L/120960.0L) + 1.0L/15120.0L) + 17.0L/10080.0L) - 17.0L/5040.0L) - 13.0L/480.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7142531.0L/1728.0L*x + 135708089.0L/3456.0L) - 6705164191.0L/40320.0L) + 923374397.0L/2240.0L) - 2658585787.0L/4032.0L) + 5694355403.0L/8064.0L) - 1750831511.0L/3456.0L) + 507476827.0L/2160.0L) - 429828377.0L/6720.0L) + 943023121.0L/120960.0L) - 1.0L/17280.0L) - 1.0L/320.0L) + 1.0L/320.0L) + 323.0L/5760.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((49997717.0L/8640.0L)*x - 949956623.0L/17280.0L) + 6705164191.0L/28800.0L) - 923374397.0L/1600.0L) + 2658585787.0L/2880.0L) - 5694355403.0L/5760.0L) + 12255820577.0L/17280.0L) - 3552337789.0L/10800.0L) + 429828377.0L/4800.0L) - 3929263.0L/360.0L) + 11.0L/2880.0L) - 341.0L/4800.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-49997717.0L/8640.0L*x + 949956623.0L/17280.0L) - 6705164191.0L/28800.0L) + 923374397.0L/1600.0L) - 2658585787.0L/2880.0L) + 5694355403.0L/5760.0L) - 12255820577.0L/17280.0L) + 3552337789.0L/10800.0L) - 429828377.0L/4800.0L) + 943023119.0L/86400.0L) + 1.0L/17280.0L) - 1.0L/320.0L) - 1.0L/320.0L) + 323.0L/5760.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7142531.0L/1728.0L)*x - 135708089.0L/3456.0L) + 6705164191.0L/40320.0L) - 923374397.0L/2240.0L) + 2658585787.0L/4032.0L) - 5694355403.0L/8064.0L) + 1750831511.0L/3456.0L) - 507476827.0L/2160.0L) + 429828377.0L/6720.0L) - 471511559.0L/60480.0L) - 1.0L/15120.0L) + 17.0L/10080.0L) + 17.0L/5040.0L) - 13.0L/480.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7142531.0L/3456.0L*x + 135708089.0L/6912.0L) - 6705164191.0L/80640.0L) + 923374397.0L/4480.0L) - 2658585787.0L/8064.0L) + 5694355403.0L/16128.0L) - 1750831511.0L/6912.0L) + 507476827.0L/4320.0L) - 429828377.0L/13440.0L) + 314341039.0L/80640.0L) + 1.0L/26880.0L) - 23.0L/40320.0L) - 23.0L/13440.0L) + 29.0L/3840.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7142531.0L/10368.0L)*x - 135708089.0L/20736.0L) + 6705164191.0L/241920.0L) - 923374397.0L/13440.0L) + 2658585787.0L/24192.0L) - 5694355403.0L/48384.0L) + 1750831511.0L/20736.0L) - 507476827.0L/12960.0L) + 429828377.0L/40320.0L) - 33679397.0L/25920.0L) - 1.0L/90720.0L) + 13.0L/120960.0L) + 13.0L/30240.0L) - 19.0L/17280.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7142531.0L/51840.0L*x + 135708089.0L/103680.0L) - 6705164191.0L/1209600.0L) + 923374397.0L/67200.0L) - 2658585787.0L/120960.0L) + 5694355403.0L/241920.0L) - 1750831511.0L/103680.0L) + 507476827.0L/64800.0L) - 429828377.0L/201600.0L) + 188604623.0L/725760.0L) + 1.0L/725760.0L) - 1.0L/120960.0L) - 1.0L/24192.0L) + 13.0L/172800.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 10)*(x*(x*(x*(x*(x*(x*(x*(x*((649321.0L/51840.0L)*x - 12337099.0L/103680.0L) + 609560381.0L/1209600.0L) - 83943127.0L/67200.0L) + 241689617.0L/120960.0L) - 517668673.0L/241920.0L) + 159166501.0L/103680.0L) - 46134257.0L/64800.0L) + 39075307.0L/201600.0L) - 1587581.0L/67200.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-12337099.0L/51840.0L*x + 12337099.0L/5760.0L) - 10362526477.0L/1209600.0L) + 83943127.0L/4200.0L) - 241689617.0L/8064.0L) + 517668673.0L/17280.0L) - 2069164513.0L/103680.0L) + 46134257.0L/5400.0L) - 429828377.0L/201600.0L) + 17145875.0L/72576.0L) - 1.0L/80640.0L) - 1.0L/15120.0L) + 1.0L/3456.0L) + 13.0L/28800.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/51840.0L)*x - 135708089.0L/5760.0L) + 113987791247.0L/1209600.0L) - 923374397.0L/4200.0L) + 2658585787.0L/8064.0L) - 5694355403.0L/17280.0L) + 22760809643.0L/103680.0L) - 507476827.0L/5400.0L) + 4728112147.0L/201600.0L) - 235755781.0L/90720.0L) + 1.0L/10080.0L) + 13.0L/15120.0L) - 13.0L/4320.0L) - 19.0L/2880.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/10368.0L*x + 135708089.0L/1152.0L) - 113987791247.0L/241920.0L) + 923374397.0L/840.0L) - 13292928935.0L/8064.0L) + 5694355403.0L/3456.0L) - 22760809643.0L/20736.0L) + 507476827.0L/1080.0L) - 4728112147.0L/40320.0L) + 14968621.0L/1152.0L) - 3.0L/8960.0L) - 23.0L/5040.0L) + 23.0L/1920.0L) + 29.0L/640.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/3456.0L)*x - 135708089.0L/384.0L) + 113987791247.0L/80640.0L) - 923374397.0L/280.0L) + 13292928935.0L/2688.0L) - 5694355403.0L/1152.0L) + 22760809643.0L/6912.0L) - 507476827.0L/360.0L) + 4728112147.0L/13440.0L) - 471511561.0L/12096.0L) + 1.0L/1680.0L) + 17.0L/1260.0L) - 17.0L/720.0L) - 13.0L/80.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/1728.0L*x + 135708089.0L/192.0L) - 113987791247.0L/40320.0L) + 923374397.0L/140.0L) - 13292928935.0L/1344.0L) + 5694355403.0L/576.0L) - 22760809643.0L/3456.0L) + 507476827.0L/180.0L) - 4728112147.0L/6720.0L) + 943023121.0L/12096.0L) - 1.0L/1920.0L) - 1.0L/40.0L) + 7.0L/320.0L) + 323.0L/960.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((949956623.0L/8640.0L)*x - 949956623.0L/960.0L) + 113987791247.0L/28800.0L) - 923374397.0L/100.0L) + 2658585787.0L/192.0L) - 39860487821.0L/2880.0L) + 159325667501.0L/17280.0L) - 3552337789.0L/900.0L) + 4728112147.0L/4800.0L) - 3929263.0L/36.0L) + 11.0L/360.0L) - 341.0L/800.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-949956623.0L/8640.0L*x + 949956623.0L/960.0L) - 113987791247.0L/28800.0L) + 923374397.0L/100.0L) - 2658585787.0L/192.0L) + 39860487821.0L/2880.0L) - 159325667501.0L/17280.0L) + 3552337789.0L/900.0L) - 4728112147.0L/4800.0L) + 943023119.0L/8640.0L) + 1.0L/1920.0L) - 1.0L/40.0L) - 7.0L/320.0L) + 323.0L/960.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/1728.0L)*x - 135708089.0L/192.0L) + 113987791247.0L/40320.0L) - 923374397.0L/140.0L) + 13292928935.0L/1344.0L) - 5694355403.0L/576.0L) + 22760809643.0L/3456.0L) - 507476827.0L/180.0L) + 4728112147.0L/6720.0L) - 471511559.0L/6048.0L) - 1.0L/1680.0L) + 17.0L/1260.0L) + 17.0L/720.0L) - 13.0L/80.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/3456.0L*x + 135708089.0L/384.0L) - 113987791247.0L/80640.0L) + 923374397.0L/280.0L) - 13292928935.0L/2688.0L) + 5694355403.0L/1152.0L) - 22760809643.0L/6912.0L) + 507476827.0L/360.0L) - 4728112147.0L/13440.0L) + 314341039.0L/8064.0L) + 3.0L/8960.0L) - 23.0L/5040.0L) - 23.0L/1920.0L) + 29.0L/640.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/10368.0L)*x - 135708089.0L/1152.0L) + 113987791247.0L/241920.0L) - 923374397.0L/840.0L) + 13292928935.0L/8064.0L) - 5694355403.0L/3456.0L) + 22760809643.0L/20736.0L) - 507476827.0L/1080.0L) + 4728112147.0L/40320.0L) - 33679397.0L/2592.0L) - 1.0L/10080.0L) + 13.0L/15120.0L) + 13.0L/4320.0L) - 19.0L/2880.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/51840.0L*x + 135708089.0L/5760.0L) - 113987791247.0L/1209600.0L) + 923374397.0L/4200.0L) - 2658585787.0L/8064.0L) + 5694355403.0L/17280.0L) - 22760809643.0L/103680.0L) + 507476827.0L/5400.0L) - 4728112147.0L/201600.0L) + 188604623.0L/72576.0L) + 1.0L/80640.0L) - 1.0L/15120.0L) - 1.0L/3456.0L) + 13.0L/28800.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*(x*((12337099.0L/51840.0L)*x - 12337099.0L/5760.0L) + 10362526477.0L/1209600.0L) - 83943127.0L/4200.0L) + 241689617.0L/8064.0L) - 517668673.0L/17280.0L) + 2069164513.0L/103680.0L) - 46134257.0L/5400.0L) + 429828377.0L/201600.0L) - 1587581.0L/6720.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-12337099.0L/2880.0L*x + 209730683.0L/5760.0L) - 10362526477.0L/75600.0L) + 83943127.0L/280.0L) - 241689617.0L/576.0L) + 6729692749.0L/17280.0L) - 2069164513.0L/8640.0L) + 507476827.0L/5400.0L) - 429828377.0L/20160.0L) + 17145875.0L/8064.0L) - 1.0L/10080.0L) - 1.0L/2160.0L) + 1.0L/576.0L) + 13.0L/5760.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/2880.0L)*x - 2307037513.0L/5760.0L) + 113987791247.0L/75600.0L) - 923374397.0L/280.0L) + 2658585787.0L/576.0L) - 74026620239.0L/17280.0L) + 22760809643.0L/8640.0L) - 5582245097.0L/5400.0L) + 4728112147.0L/20160.0L) - 235755781.0L/10080.0L) + 1.0L/1260.0L) + 13.0L/2160.0L) - 13.0L/720.0L) - 19.0L/576.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/576.0L*x + 2307037513.0L/1152.0L) - 113987791247.0L/15120.0L) + 923374397.0L/56.0L) - 13292928935.0L/576.0L) + 74026620239.0L/3456.0L) - 22760809643.0L/1728.0L) + 5582245097.0L/1080.0L) - 4728112147.0L/4032.0L) + 14968621.0L/128.0L) - 3.0L/1120.0L) - 23.0L/720.0L) + 23.0L/320.0L) + 29.0L/128.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/192.0L)*x - 2307037513.0L/384.0L) + 113987791247.0L/5040.0L) - 2770123191.0L/56.0L) + 13292928935.0L/192.0L) - 74026620239.0L/1152.0L) + 22760809643.0L/576.0L) - 5582245097.0L/360.0L) + 4728112147.0L/1344.0L) - 471511561.0L/1344.0L) + 1.0L/210.0L) + 17.0L/180.0L) - 17.0L/120.0L) - 13.0L/16.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/96.0L*x + 2307037513.0L/192.0L) - 113987791247.0L/2520.0L) + 2770123191.0L/28.0L) - 13292928935.0L/96.0L) + 74026620239.0L/576.0L) - 22760809643.0L/288.0L) + 5582245097.0L/180.0L) - 4728112147.0L/672.0L) + 943023121.0L/1344.0L) - 1.0L/240.0L) - 7.0L/40.0L) + 21.0L/160.0L) + 323.0L/192.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((949956623.0L/480.0L)*x - 16149262591.0L/960.0L) + 113987791247.0L/1800.0L) - 2770123191.0L/20.0L) + 18610100509.0L/96.0L) - 518186341673.0L/2880.0L) + 159325667501.0L/1440.0L) - 39075715679.0L/900.0L) + 4728112147.0L/480.0L) - 3929263.0L/4.0L) + 77.0L/360.0L) - 341.0L/160.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-949956623.0L/480.0L*x + 16149262591.0L/960.0L) - 113987791247.0L/1800.0L) + 2770123191.0L/20.0L) - 18610100509.0L/96.0L) + 518186341673.0L/2880.0L) - 159325667501.0L/1440.0L) + 39075715679.0L/900.0L) - 4728112147.0L/480.0L) + 943023119.0L/960.0L) + 1.0L/240.0L) - 7.0L/40.0L) - 21.0L/160.0L) + 323.0L/192.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/96.0L)*x - 2307037513.0L/192.0L) + 113987791247.0L/2520.0L) - 2770123191.0L/28.0L) + 13292928935.0L/96.0L) - 74026620239.0L/576.0L) + 22760809643.0L/288.0L) - 5582245097.0L/180.0L) + 4728112147.0L/672.0L) - 471511559.0L/672.0L) - 1.0L/210.0L) + 17.0L/180.0L) + 17.0L/120.0L) - 13.0L/16.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/192.0L*x + 2307037513.0L/384.0L) - 113987791247.0L/5040.0L) + 2770123191.0L/56.0L) - 13292928935.0L/192.0L) + 74026620239.0L/1152.0L) - 22760809643.0L/576.0L) + 5582245097.0L/360.0L) - 4728112147.0L/1344.0L) + 314341039.0L/896.0L) + 3.0L/1120.0L) - 23.0L/720.0L) - 23.0L/320.0L) + 29.0L/128.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((135708089.0L/576.0L)*x - 2307037513.0L/1152.0L) + 113987791247.0L/15120.0L) - 923374397.0L/56.0L) + 13292928935.0L/576.0L) - 74026620239.0L/3456.0L) + 22760809643.0L/1728.0L) - 5582245097.0L/1080.0L) + 4728112147.0L/4032.0L) - 33679397.0L/288.0L) - 1.0L/1260.0L) + 13.0L/2160.0L) + 13.0L/720.0L) - 19.0L/576.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-135708089.0L/2880.0L*x + 2307037513.0L/5760.0L) - 113987791247.0L/75600.0L) + 923374397.0L/280.0L) - 2658585787.0L/576.0L) + 74026620239.0L/17280.0L) - 22760809643.0L/8640.0L) + 5582245097.0L/5400.0L) - 4728112147.0L/20160.0L) + 188604623.0L/8064.0L) + 1.0L/10080.0L) - 1.0L/2160.0L) - 1.0L/576.0L) + 13.0L/5760.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(x*(x*((12337099.0L/2880.0L)*x - 209730683.0L/5760.0L) + 10362526477.0L/75600.0L) - 83943127.0L/280.0L) + 241689617.0L/576.0L) - 6729692749.0L/17280.0L) + 2069164513.0L/8640.0L) - 507476827.0L/5400.0L) + 429828377.0L/20160.0L) - 4762743.0L/2240.0L);
-break;
+
+template void beta_n5_m6<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m6<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 7, 0>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.903354828042328, 9.936903108465609, -49.68451554232804, 149.05354662698412,
+         -298.10709325396823, 417.34993055555555, -417.34993055555555, 298.10709325396823,
+         -149.05354662698412, 49.68451554232804, -9.936903108465609, 0.903354828042328},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {1.8281819058641975, -20.110000964506174, 100.55000482253087, -301.6500144675926,
+         603.3000289351852, -844.6200405092593, 844.6200405092593, -603.3000289351852,
+         301.6500144675926, -100.55000482253087, 20.110000964506174, -1.8281819058641975},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-1.6257358837632274, 17.8830947213955, -89.41547360697751, 268.24642082093254,
+         -536.4928416418651, 751.0899782986111, -751.0899782986111, 536.4928416418651,
+         -268.24642082093254, 89.41547360697751, -17.8830947213955, 1.6257358837632274},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {0.8322450345155423, -9.154698135402889, 45.77350169994213, -137.3205299014137,
+         274.64109287161045, -384.49755316840276, 384.49755316840276, -274.64109287161045,
+         137.3205299014137, -45.77350169994213, 9.154698135402889, -0.8322450345155423},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-0.2701331470630787, 2.971522488064236, -14.858042334501075, 44.57544148763021,
+         -89.15296630859375, 124.81575005425347, -124.81575005425347, 89.15296630859375,
+         -44.57544148763021, 14.858042334501075, -2.971522488064236, 0.2701331470630787},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.058157224301938655, -0.6400694557472512, 3.2034433435510707, -9.628667704264323,
+         19.298568047417536, -27.05557339138455, 27.05557339138455, -19.298568047417536,
+         9.628667704264323, -3.2034433435510707, 0.6400694557472512, -0.058157224301938655},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.008653142616231605, 0.09574070992713672, -0.48413991978559545, 1.4911055852496435,
+         -3.240534169837911, 4.888572201199001, -4.888572201199001, 3.240534169837911,
+         -1.4911055852496435, 0.48413991978559545, -0.09574070992713672, 0.008653142616231605},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0006947680209259087, -0.007761127700671107, 0.03997790102815712, -0.12847949689027494,
+         0.31899512659304985, -1.5322255014490198, 1.5322255014490198, -0.31899512659304985,
+         0.12847949689027494, -0.03997790102815712, 0.007761127700671107, -0.0006947680209259087},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 7, 0>::coefficients[16][12];
+
+template <>
+struct spline_polynomials<5, 7, 1>
+{
+    static constexpr int degree = 14;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-13.55032242063492, 149.05354662698412, -745.2677331349206, 2235.803199404762,
+         -4471.606398809524, 6260.248958333334, -6260.248958333334, 4471.606398809524,
+         -2235.803199404762, 745.2677331349206, -149.05354662698412, 13.55032242063492},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {23.766364776234568, -261.43001253858023, 1307.1500626929012, -3921.450188078704,
+         7842.900376157408, -10980.060526620371, 10980.060526620371, -7842.900376157408,
+         3921.450188078704, -1307.1500626929012, 261.43001253858023, -23.766364776234568},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-17.8830947213955, 196.71404193535054, -983.5702096767526, 2950.710629030258,
+         -5901.421258060516, 8261.989761284722, -8261.989761284722, 5901.421258060516,
+         -2950.710629030258, 983.5702096767526, -196.71404193535054, 17.8830947213955},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {7.490205310639881, -82.39228321862599, 411.9615152994792, -1235.8847691127232,
+         2471.769835844494, -3460.477978515625, 3460.477978515625, -2471.769835844494,
+         1235.8847691127232, -411.9615152994792, 82.39228321862599, -7.490205310639881},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-1.890932029441551, 20.800657416449653, -104.00629634150752, 312.02809041341146,
+         -624.0707641601563, 873.7102503797743, -873.7102503797743, 624.0707641601563,
+         -312.02809041341146, 104.00629634150752, -20.800657416449653, 1.890932029441551},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.2907861215096933, -3.2003472787362557, 16.017216717755353, -48.14333852132162,
+         96.49284023708768, -135.27786695692274, 135.27786695692274, -96.49284023708768,
+         48.14333852132162, -16.017216717755353, 3.2003472787362557, -0.2907861215096933},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.025959427848694816, 0.28722212978141015, -1.4524197593567862, 4.473316755748931,
+         -9.721602509513733, 14.665716603597005, -14.665716603597005, 9.721602509513733,
+         -4.473316755748931, 1.4524197593567862, -0.28722212978141015, 0.025959427848694816},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0006947680209259087, -0.007761127700671107, 0.03997790102815712, -0.12847949689027494,
+         0.31899512659304985, -1.5322255014490198, 1.5322255014490198, -0.31899512659304985,
+         0.12847949689027494, -0.03997790102815712, 0.007761127700671107, -0.0006947680209259087}};
+};
+constexpr double spline_polynomials<5, 7, 1>::coefficients[15][12];
+
+template <>
+struct spline_polynomials<5, 7, 2>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-189.7045138888889, 2086.7496527777776, -10433.748263888889, 31301.244791666668,
+         -62602.489583333336, 87643.48541666666, -87643.48541666666, 62602.489583333336,
+         -31301.244791666668, 10433.748263888889, -2086.7496527777776, 189.7045138888889},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {285.1963773148148, -3137.160150462963, 15685.800752314815, -47057.40225694444,
+         94114.80451388888, -131760.72631944445, 131760.72631944445, -94114.80451388888,
+         47057.40225694444, -15685.800752314815, 3137.160150462963, -285.1963773148148},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-178.83094721395503, 1967.1404193535052, -9835.702096767527, 29507.106290302578,
+         -59014.212580605155, 82619.89761284723, -82619.89761284723, 59014.212580605155,
+         -29507.106290302578, 9835.702096767527, -1967.1404193535052, 178.83094721395503},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {59.92164248511905, -659.1382657490079, 3295.6921223958334, -9887.078152901786,
+         19774.158686755953, -27683.823828125, 27683.823828125, -19774.158686755953,
+         9887.078152901786, -3295.6921223958334, 659.1382657490079, -59.92164248511905},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-11.345592176649305, 124.80394449869792, -624.0377780490452, 1872.1685424804687,
+         -3744.4245849609374, 5242.261502278646, -5242.261502278646, 3744.4245849609374,
+         -1872.1685424804687, 624.0377780490452, -124.80394449869792, 11.345592176649305},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {1.1631444860387732, -12.801389114945023, 64.06886687102141, -192.57335408528647,
+         385.9713609483507, -541.111467827691, 541.111467827691, -385.9713609483507,
+         192.57335408528647, -64.06886687102141, 12.801389114945023, -1.1631444860387732},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.05191885569738963, 0.5744442595628203, -2.9048395187135725, 8.946633511497861,
+         -19.443205019027467, 29.33143320719401, -29.33143320719401, 19.443205019027467,
+         -8.946633511497861, 2.9048395187135725, -0.5744442595628203, 0.05191885569738963},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 7, 2>::coefficients[14][12];
+
+template <class real_number>
+void beta_n5_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 7, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 7, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 7, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m7<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m7<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 8, 0>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.3465310846560845, -36.81184193121693, 184.05920965608465, -552.177628968254,
+         1104.355257936508, -1546.097361111111, 1546.097361111111, -1104.355257936508,
+         552.177628968254, -184.05920965608465, 36.81184193121693, -3.3465310846560845},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-7.596416997354497, 83.56058697089946, -417.8029348544974, 1253.4088045634921,
+         -2506.8176091269843, 3509.5446527777776, -3509.5446527777776, 2506.8176091269843,
+         -1253.4088045634921, 417.8029348544974, -83.56058697089946, 7.596416997354497},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {7.684611304012345, -84.5307243441358, 422.653621720679, -1267.960865162037,
+         2535.921730324074, -3550.2904224537037, 3550.2904224537037, -2535.921730324074,
+         1267.960865162037, -422.653621720679, 84.5307243441358, -7.684611304012345},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-4.5539505828373015, 50.09345641121032, -250.46728205605157, 751.4018461681547,
+         -1502.8036923363095, 2103.9251692708335, -2103.9251692708335, 1502.8036923363095,
+         -751.4018461681547, 250.46728205605157, -50.09345641121032, 4.5539505828373015},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {1.7473121279761905, -19.22043616347002, 96.10219184027778, -288.30660032242065,
+         576.6132337136244, -807.2585503472222, 807.2585503472222, -576.6132337136244,
+         288.30660032242065, -96.10219184027778, 19.22043616347002, -1.7473121279761905},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-0.45314656575520834, 4.9846700936776625, -24.923780362568206, 74.77265557183159,
+         -149.54739447699652, 209.36794949001737, -209.36794949001737, 149.54739447699652,
+         -74.77265557183159, 24.923780362568206, -4.9846700936776625, 0.45314656575520834},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.08103390163845486, -0.8917129064489294, 4.461660597059462, -13.403319464789497,
+         26.84787156846788, -37.624598320855036, 37.624598320855036, -26.84787156846788,
+         13.403319464789497, -4.461660597059462, 0.8917129064489294, -0.08103390163845486},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.010287190997411334, 0.11371524212011375, -0.5740125807504806, 1.7607235681442988,
+         -3.779770135627222, 5.643502553304036, -5.643502553304036, 3.779770135627222,
+         -1.7607235681442988, 0.5740125807504806, -0.11371524212011375, 0.010287190997411334},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0007458320328377752, -0.00832283183170164, 0.04278642168330978, -0.13690505885573293,
+         0.33584625052396583, -1.5558170749523021, 1.5558170749523021, -0.33584625052396583,
+         0.13690505885573293, -0.04278642168330978, 0.00832283183170164, -0.0007458320328377752},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 8, 0>::coefficients[18][12];
+
+template <>
+struct spline_polynomials<5, 8, 1>
+{
+    static constexpr int degree = 16;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {56.89102843915344, -625.8013128306878, 3129.0065641534393, -9387.019692460317,
+         18774.039384920634, -26283.655138888887, 26283.655138888887, -18774.039384920634,
+         9387.019692460317, -3129.0065641534393, 625.8013128306878, -56.89102843915344},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-113.94625496031746, 1253.4088045634921, -6267.04402281746, 18801.13206845238,
+         -37602.26413690476, 52643.16979166667, -52643.16979166667, 37602.26413690476,
+         -18801.13206845238, 6267.04402281746, -1253.4088045634921, 113.94625496031746},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {99.89994695216049, -1098.8994164737655, 5494.497082368827, -16483.49124710648,
+         32966.98249421296, -46153.775491898145, 46153.775491898145, -32966.98249421296,
+         16483.49124710648, -5494.497082368827, 1098.8994164737655, -99.89994695216049},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-50.09345641121032, 551.0280205233134, -2755.1401026165677, 8265.420307849703,
+         -16530.840615699406, 23143.176861979166, -23143.176861979166, 16530.840615699406,
+         -8265.420307849703, 2755.1401026165677, -551.0280205233134, 50.09345641121032},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {15.725809151785715, -172.98392547123015, 864.9197265625, -2594.7594029017855,
+         5189.519103422619, -7265.326953125, 7265.326953125, -5189.519103422619,
+         2594.7594029017855, -864.9197265625, 172.98392547123015, -15.725809151785715},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-3.1720259602864584, 34.892690655743635, -174.46646253797743, 523.4085890028211,
+         -1046.8317613389756, 1465.5756464301214, -1465.5756464301214, 1046.8317613389756,
+         -523.4085890028211, 174.46646253797743, -34.892690655743635, 3.1720259602864584},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.4051695081922743, -4.4585645322446465, 22.30830298529731, -67.01659732394748,
+         134.23935784233942, -188.12299160427517, 188.12299160427517, -134.23935784233942,
+         67.01659732394748, -22.30830298529731, 4.4585645322446465, -0.4051695081922743},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.030861572992234004, 0.34114572636034124, -1.7220377422514417, 5.282170704432896,
+         -11.339310406881665, 16.93050765991211, -16.93050765991211, 11.339310406881665,
+         -5.282170704432896, 1.7220377422514417, -0.34114572636034124, 0.030861572992234004},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0007458320328377752, -0.00832283183170164, 0.04278642168330978, -0.13690505885573293,
+         0.33584625052396583, -1.5558170749523021, 1.5558170749523021, -0.33584625052396583,
+         0.13690505885573293, -0.04278642168330978, 0.00832283183170164, -0.0007458320328377752}};
+};
+constexpr double spline_polynomials<5, 8, 1>::coefficients[17][12];
+
+template <>
+struct spline_polynomials<5, 8, 2>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {910.256455026455, -10012.821005291005, 50064.10502645503, -150192.31507936507,
+         300384.63015873014, -420538.4822222222, 420538.4822222222, -300384.63015873014,
+         150192.31507936507, -50064.10502645503, 10012.821005291005, -910.256455026455},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-1595.2475694444445, 17547.72326388889, -87738.61631944444, 263215.8489583333,
+         -526431.6979166666, 737004.3770833333, -737004.3770833333, 526431.6979166666,
+         -263215.8489583333, 87738.61631944444, -17547.72326388889, 1595.2475694444445},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {1198.799363425926, -13186.792997685185, 65933.96498842593, -197801.89496527778,
+         395603.78993055556, -553845.3059027778, 553845.3059027778, -395603.78993055556,
+         197801.89496527778, -65933.96498842593, 13186.792997685185, -1198.799363425926},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-500.93456411210315, 5510.280205233135, -27551.401026165673, 82654.20307849703,
+         -165308.40615699405, 231431.76861979166, -231431.76861979166, 165308.40615699405,
+         -82654.20307849703, 27551.401026165673, -5510.280205233135, 500.93456411210315},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {125.80647321428572, -1383.8714037698412, 6919.3578125, -20758.075223214284,
+         41516.15282738095, -58122.615625, 58122.615625, -41516.15282738095,
+         20758.075223214284, -6919.3578125, 1383.8714037698412, -125.80647321428572},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-19.03215576171875, 209.3561439344618, -1046.7987752278646, 3140.451534016927,
+         -6280.990568033854, 8793.453878580729, -8793.453878580729, 6280.990568033854,
+         -3140.451534016927, 1046.7987752278646, -209.3561439344618, 19.03215576171875},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {1.6206780327690973, -17.834258128978586, 89.23321194118924, -268.0663892957899,
+         536.9574313693577, -752.4919664171007, 752.4919664171007, -536.9574313693577,
+         268.0663892957899, -89.23321194118924, 17.834258128978586, -1.6206780327690973},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.06172314598446801, 0.6822914527206825, -3.4440754845028834, 10.564341408865792,
+         -22.67862081376333, 33.86101531982422, -33.86101531982422, 22.67862081376333,
+         -10.564341408865792, 3.4440754845028834, -0.6822914527206825, 0.06172314598446801},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 8, 2>::coefficients[16][12];
+
+template <class real_number>
+void beta_n5_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 8, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 8, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 8, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n5_m10(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1587581.0L/33600.0L)*x - 1587581.0L/3200.0L) + 852748493.0L/362880.0L) - 960042925.0L/145152.0L) + 14821726939.0L/1209600.0L) - 1049589707.0L/67200.0L) + 8393241803.0L/604800.0L) - 2054212547.0L/241920.0L) + 355209743.0L/103680.0L) - 1494445459.0L/1814400.0L) + 18077609.0L/201600.0L) + 1.0L/3628800.0L) - 1.0L/725760.0L) - 1.0L/120960.0L) + 1.0L/24192.0L) + 13.0L/172800.0L) - 13.0L/34560.0L) - 41.0L/181440.0L) + 41.0L/36288.0L) + 1.0L/6300.0L) - 1.0L/1260.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/33600.0L*x + 17463391.0L/3200.0L) - 9380233423.0L/362880.0L) + 10560472175.0L/145152.0L) - 163038996329.0L/1209600.0L) + 11545486777.0L/67200.0L) - 92325659833.0L/604800.0L) + 22596338017.0L/241920.0L) - 3907307173.0L/103680.0L) + 16438900049.0L/1814400.0L) - 198853699.0L/201600.0L) - 1.0L/362880.0L) + 1.0L/90720.0L) + 13.0L/120960.0L) - 13.0L/30240.0L) - 19.0L/17280.0L) + 19.0L/4320.0L) + 1261.0L/362880.0L) - 1261.0L/90720.0L) - 5.0L/2016.0L) + 5.0L/504.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/6720.0L)*x - 17463391.0L/640.0L) + 9380233423.0L/72576.0L) - 52802360875.0L/145152.0L) + 163038996329.0L/241920.0L) - 11545486777.0L/13440.0L) + 92325659833.0L/120960.0L) - 22596338017.0L/48384.0L) + 3907307173.0L/20736.0L) - 16438900049.0L/362880.0L) + 198853699.0L/40320.0L) + 1.0L/80640.0L) - 1.0L/26880.0L) - 23.0L/40320.0L) + 23.0L/13440.0L) + 29.0L/3840.0L) - 29.0L/1280.0L) - 541.0L/20160.0L) + 541.0L/6720.0L) + 5.0L/252.0L) - 5.0L/84.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/2240.0L*x + 52390173.0L/640.0L) - 9380233423.0L/24192.0L) + 52802360875.0L/48384.0L) - 163038996329.0L/80640.0L) + 11545486777.0L/4480.0L) - 92325659833.0L/40320.0L) + 22596338017.0L/16128.0L) - 3907307173.0L/6912.0L) + 16438900049.0L/120960.0L) - 198853699.0L/13440.0L) - 1.0L/30240.0L) + 1.0L/15120.0L) + 17.0L/10080.0L) - 17.0L/5040.0L) - 13.0L/480.0L) + 13.0L/240.0L) + 4369.0L/30240.0L) - 4369.0L/15120.0L) - 5.0L/42.0L) + 5.0L/21.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/1120.0L)*x - 52390173.0L/320.0L) + 9380233423.0L/12096.0L) - 52802360875.0L/24192.0L) + 163038996329.0L/40320.0L) - 11545486777.0L/2240.0L) + 92325659833.0L/20160.0L) - 22596338017.0L/8064.0L) + 3907307173.0L/3456.0L) - 16438900049.0L/60480.0L) + 198853699.0L/6720.0L) + 1.0L/17280.0L) - 1.0L/17280.0L) - 1.0L/320.0L) + 1.0L/320.0L) + 323.0L/5760.0L) - 323.0L/5760.0L) - 1669.0L/4320.0L) + 1669.0L/4320.0L) + 5.0L/6.0L) - 5.0L/6.0L);
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/800.0L*x + 366731211.0L/1600.0L) - 9380233423.0L/8640.0L) + 10560472175.0L/3456.0L) - 163038996329.0L/28800.0L) + 11545486777.0L/1600.0L) - 92325659833.0L/14400.0L) + 22596338017.0L/5760.0L) - 27351150211.0L/17280.0L) + 16438900049.0L/43200.0L) - 198853699.0L/4800.0L) - 1.0L/14400.0L) + 11.0L/2880.0L) - 341.0L/4800.0L) + 1529.0L/2880.0L) - 5269.0L/3600.0L) + 1;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/800.0L)*x - 366731211.0L/1600.0L) + 9380233423.0L/8640.0L) - 10560472175.0L/3456.0L) + 163038996329.0L/28800.0L) - 11545486777.0L/1600.0L) + 92325659833.0L/14400.0L) - 22596338017.0L/5760.0L) + 27351150211.0L/17280.0L) - 16438900049.0L/43200.0L) + 198853699.0L/4800.0L) + 1.0L/17280.0L) + 1.0L/17280.0L) - 1.0L/320.0L) - 1.0L/320.0L) + 323.0L/5760.0L) + 323.0L/5760.0L) - 1669.0L/4320.0L) - 1669.0L/4320.0L) + 5.0L/6.0L) + 5.0L/6.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/1120.0L*x + 52390173.0L/320.0L) - 9380233423.0L/12096.0L) + 52802360875.0L/24192.0L) - 163038996329.0L/40320.0L) + 11545486777.0L/2240.0L) - 92325659833.0L/20160.0L) + 22596338017.0L/8064.0L) - 3907307173.0L/3456.0L) + 16438900049.0L/60480.0L) - 198853699.0L/6720.0L) - 1.0L/30240.0L) - 1.0L/15120.0L) + 17.0L/10080.0L) + 17.0L/5040.0L) - 13.0L/480.0L) - 13.0L/240.0L) + 4369.0L/30240.0L) + 4369.0L/15120.0L) - 5.0L/42.0L) - 5.0L/21.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/2240.0L)*x - 52390173.0L/640.0L) + 9380233423.0L/24192.0L) - 52802360875.0L/48384.0L) + 163038996329.0L/80640.0L) - 11545486777.0L/4480.0L) + 92325659833.0L/40320.0L) - 22596338017.0L/16128.0L) + 3907307173.0L/6912.0L) - 16438900049.0L/120960.0L) + 198853699.0L/13440.0L) + 1.0L/80640.0L) + 1.0L/26880.0L) - 23.0L/40320.0L) - 23.0L/13440.0L) + 29.0L/3840.0L) + 29.0L/1280.0L) - 541.0L/20160.0L) - 541.0L/6720.0L) + 5.0L/252.0L) + 5.0L/84.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/6720.0L*x + 17463391.0L/640.0L) - 9380233423.0L/72576.0L) + 52802360875.0L/145152.0L) - 163038996329.0L/241920.0L) + 11545486777.0L/13440.0L) - 92325659833.0L/120960.0L) + 22596338017.0L/48384.0L) - 3907307173.0L/20736.0L) + 16438900049.0L/362880.0L) - 198853699.0L/40320.0L) - 1.0L/362880.0L) - 1.0L/90720.0L) + 13.0L/120960.0L) + 13.0L/30240.0L) - 19.0L/17280.0L) - 19.0L/4320.0L) + 1261.0L/362880.0L) + 1261.0L/90720.0L) - 5.0L/2016.0L) - 5.0L/504.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/33600.0L)*x - 17463391.0L/3200.0L) + 9380233423.0L/362880.0L) - 10560472175.0L/145152.0L) + 163038996329.0L/1209600.0L) - 11545486777.0L/67200.0L) + 92325659833.0L/604800.0L) - 22596338017.0L/241920.0L) + 3907307173.0L/103680.0L) - 16438900049.0L/1814400.0L) + 198853699.0L/201600.0L) + 1.0L/3628800.0L) + 1.0L/725760.0L) - 1.0L/120960.0L) - 1.0L/24192.0L) + 13.0L/172800.0L) + 13.0L/34560.0L) - 41.0L/181440.0L) - 41.0L/36288.0L) + 1.0L/6300.0L) + 1.0L/1260.0L);
-poly_val[11] = pow(x, 11)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1587581.0L/33600.0L*x + 1587581.0L/3200.0L) - 852748493.0L/362880.0L) + 960042925.0L/145152.0L) - 14821726939.0L/1209600.0L) + 1049589707.0L/67200.0L) - 8393241803.0L/604800.0L) + 2054212547.0L/241920.0L) - 355209743.0L/103680.0L) + 1494445459.0L/1814400.0L) - 18077609.0L/201600.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1587581.0L/1600.0L)*x - 1587581.0L/160.0L) + 16202221367.0L/362880.0L) - 960042925.0L/8064.0L) + 251969357963.0L/1209600.0L) - 1049589707.0L/4200.0L) + 8393241803.0L/40320.0L) - 2054212547.0L/17280.0L) + 4617726659.0L/103680.0L) - 1494445459.0L/151200.0L) + 198853699.0L/201600.0L) + 1.0L/362880.0L) - 1.0L/80640.0L) - 1.0L/15120.0L) + 1.0L/3456.0L) + 13.0L/28800.0L) - 13.0L/6912.0L) - 41.0L/45360.0L) + 41.0L/12096.0L) + 1.0L/3150.0L) - 1.0L/1260.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/1600.0L*x + 17463391.0L/160.0L) - 178224435037.0L/362880.0L) + 10560472175.0L/8064.0L) - 2771662937593.0L/1209600.0L) + 11545486777.0L/4200.0L) - 92325659833.0L/40320.0L) + 22596338017.0L/17280.0L) - 50794993249.0L/103680.0L) + 16438900049.0L/151200.0L) - 2187390689.0L/201600.0L) - 1.0L/36288.0L) + 1.0L/10080.0L) + 13.0L/15120.0L) - 13.0L/4320.0L) - 19.0L/2880.0L) + 19.0L/864.0L) + 1261.0L/90720.0L) - 1261.0L/30240.0L) - 5.0L/1008.0L) + 5.0L/504.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/320.0L)*x - 17463391.0L/32.0L) + 178224435037.0L/72576.0L) - 52802360875.0L/8064.0L) + 2771662937593.0L/241920.0L) - 11545486777.0L/840.0L) + 92325659833.0L/8064.0L) - 22596338017.0L/3456.0L) + 50794993249.0L/20736.0L) - 16438900049.0L/30240.0L) + 2187390689.0L/40320.0L) + 1.0L/8064.0L) - 3.0L/8960.0L) - 23.0L/5040.0L) + 23.0L/1920.0L) + 29.0L/640.0L) - 29.0L/256.0L) - 541.0L/5040.0L) + 541.0L/2240.0L) + 5.0L/126.0L) - 5.0L/84.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-52390173.0L/320.0L*x + 52390173.0L/32.0L) - 178224435037.0L/24192.0L) + 52802360875.0L/2688.0L) - 2771662937593.0L/80640.0L) + 11545486777.0L/280.0L) - 92325659833.0L/2688.0L) + 22596338017.0L/1152.0L) - 50794993249.0L/6912.0L) + 16438900049.0L/10080.0L) - 2187390689.0L/13440.0L) - 1.0L/3024.0L) + 1.0L/1680.0L) + 17.0L/1260.0L) - 17.0L/720.0L) - 13.0L/80.0L) + 13.0L/48.0L) + 4369.0L/7560.0L) - 4369.0L/5040.0L) - 5.0L/21.0L) + 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((52390173.0L/160.0L)*x - 52390173.0L/16.0L) + 178224435037.0L/12096.0L) - 52802360875.0L/1344.0L) + 2771662937593.0L/40320.0L) - 11545486777.0L/140.0L) + 92325659833.0L/1344.0L) - 22596338017.0L/576.0L) + 50794993249.0L/3456.0L) - 16438900049.0L/5040.0L) + 2187390689.0L/6720.0L) + 1.0L/1728.0L) - 1.0L/1920.0L) - 1.0L/40.0L) + 7.0L/320.0L) + 323.0L/960.0L) - 323.0L/1152.0L) - 1669.0L/1080.0L) + 1669.0L/1440.0L) + 5.0L/3.0L) - 5.0L/6.0L;
-poly_val[5] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-366731211.0L/800.0L*x + 366731211.0L/80.0L) - 178224435037.0L/8640.0L) + 10560472175.0L/192.0L) - 2771662937593.0L/28800.0L) + 11545486777.0L/100.0L) - 92325659833.0L/960.0L) + 158174366119.0L/2880.0L) - 355564952743.0L/17280.0L) + 16438900049.0L/3600.0L) - 2187390689.0L/4800.0L) - 1.0L/1440.0L) + 11.0L/360.0L) - 341.0L/800.0L) + 1529.0L/720.0L) - 5269.0L/1800.0L);
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((366731211.0L/800.0L)*x - 366731211.0L/80.0L) + 178224435037.0L/8640.0L) - 10560472175.0L/192.0L) + 2771662937593.0L/28800.0L) - 11545486777.0L/100.0L) + 92325659833.0L/960.0L) - 158174366119.0L/2880.0L) + 355564952743.0L/17280.0L) - 16438900049.0L/3600.0L) + 2187390689.0L/4800.0L) + 1.0L/1728.0L) + 1.0L/1920.0L) - 1.0L/40.0L) - 7.0L/320.0L) + 323.0L/960.0L) + 323.0L/1152.0L) - 1669.0L/1080.0L) - 1669.0L/1440.0L) + 5.0L/3.0L) + 5.0L/6.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-52390173.0L/160.0L*x + 52390173.0L/16.0L) - 178224435037.0L/12096.0L) + 52802360875.0L/1344.0L) - 2771662937593.0L/40320.0L) + 11545486777.0L/140.0L) - 92325659833.0L/1344.0L) + 22596338017.0L/576.0L) - 50794993249.0L/3456.0L) + 16438900049.0L/5040.0L) - 2187390689.0L/6720.0L) - 1.0L/3024.0L) - 1.0L/1680.0L) + 17.0L/1260.0L) + 17.0L/720.0L) - 13.0L/80.0L) - 13.0L/48.0L) + 4369.0L/7560.0L) + 4369.0L/5040.0L) - 5.0L/21.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((52390173.0L/320.0L)*x - 52390173.0L/32.0L) + 178224435037.0L/24192.0L) - 52802360875.0L/2688.0L) + 2771662937593.0L/80640.0L) - 11545486777.0L/280.0L) + 92325659833.0L/2688.0L) - 22596338017.0L/1152.0L) + 50794993249.0L/6912.0L) - 16438900049.0L/10080.0L) + 2187390689.0L/13440.0L) + 1.0L/8064.0L) + 3.0L/8960.0L) - 23.0L/5040.0L) - 23.0L/1920.0L) + 29.0L/640.0L) + 29.0L/256.0L) - 541.0L/5040.0L) - 541.0L/2240.0L) + 5.0L/126.0L) + 5.0L/84.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/320.0L*x + 17463391.0L/32.0L) - 178224435037.0L/72576.0L) + 52802360875.0L/8064.0L) - 2771662937593.0L/241920.0L) + 11545486777.0L/840.0L) - 92325659833.0L/8064.0L) + 22596338017.0L/3456.0L) - 50794993249.0L/20736.0L) + 16438900049.0L/30240.0L) - 2187390689.0L/40320.0L) - 1.0L/36288.0L) - 1.0L/10080.0L) + 13.0L/15120.0L) + 13.0L/4320.0L) - 19.0L/2880.0L) - 19.0L/864.0L) + 1261.0L/90720.0L) + 1261.0L/30240.0L) - 5.0L/1008.0L) - 5.0L/504.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/1600.0L)*x - 17463391.0L/160.0L) + 178224435037.0L/362880.0L) - 10560472175.0L/8064.0L) + 2771662937593.0L/1209600.0L) - 11545486777.0L/4200.0L) + 92325659833.0L/40320.0L) - 22596338017.0L/17280.0L) + 50794993249.0L/103680.0L) - 16438900049.0L/151200.0L) + 2187390689.0L/201600.0L) + 1.0L/362880.0L) + 1.0L/80640.0L) - 1.0L/15120.0L) - 1.0L/3456.0L) + 13.0L/28800.0L) + 13.0L/6912.0L) - 41.0L/45360.0L) - 41.0L/12096.0L) + 1.0L/3150.0L) + 1.0L/1260.0L;
-poly_val[11] = pow(x, 10)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1587581.0L/1600.0L*x + 1587581.0L/160.0L) - 16202221367.0L/362880.0L) + 960042925.0L/8064.0L) - 251969357963.0L/1209600.0L) + 1049589707.0L/4200.0L) - 8393241803.0L/40320.0L) + 2054212547.0L/17280.0L) - 4617726659.0L/103680.0L) + 1494445459.0L/151200.0L) - 198853699.0L/201600.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1587581.0L/80.0L)*x - 30164039.0L/160.0L) + 16202221367.0L/20160.0L) - 16320729725.0L/8064.0L) + 251969357963.0L/75600.0L) - 1049589707.0L/280.0L) + 8393241803.0L/2880.0L) - 26704763111.0L/17280.0L) + 4617726659.0L/8640.0L) - 16438900049.0L/151200.0L) + 198853699.0L/20160.0L) + 1.0L/40320.0L) - 1.0L/10080.0L) - 1.0L/2160.0L) + 1.0L/576.0L) + 13.0L/5760.0L) - 13.0L/1728.0L) - 41.0L/15120.0L) + 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/80.0L*x + 331804429.0L/160.0L) - 178224435037.0L/20160.0L) + 179528026975.0L/8064.0L) - 2771662937593.0L/75600.0L) + 11545486777.0L/280.0L) - 92325659833.0L/2880.0L) + 293752394221.0L/17280.0L) - 50794993249.0L/8640.0L) + 180827900539.0L/151200.0L) - 2187390689.0L/20160.0L) - 1.0L/4032.0L) + 1.0L/1260.0L) + 13.0L/2160.0L) - 13.0L/720.0L) - 19.0L/576.0L) + 19.0L/216.0L) + 1261.0L/30240.0L) - 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/16.0L)*x - 331804429.0L/32.0L) + 178224435037.0L/4032.0L) - 897640134875.0L/8064.0L) + 2771662937593.0L/15120.0L) - 11545486777.0L/56.0L) + 92325659833.0L/576.0L) - 293752394221.0L/3456.0L) + 50794993249.0L/1728.0L) - 180827900539.0L/30240.0L) + 2187390689.0L/4032.0L) + 1.0L/896.0L) - 3.0L/1120.0L) - 23.0L/720.0L) + 23.0L/320.0L) + 29.0L/128.0L) - 29.0L/64.0L) - 541.0L/1680.0L) + 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-52390173.0L/16.0L*x + 995413287.0L/32.0L) - 178224435037.0L/1344.0L) + 897640134875.0L/2688.0L) - 2771662937593.0L/5040.0L) + 34636460331.0L/56.0L) - 92325659833.0L/192.0L) + 293752394221.0L/1152.0L) - 50794993249.0L/576.0L) + 180827900539.0L/10080.0L) - 2187390689.0L/1344.0L) - 1.0L/336.0L) + 1.0L/210.0L) + 17.0L/180.0L) - 17.0L/120.0L) - 13.0L/16.0L) + 13.0L/12.0L) + 4369.0L/2520.0L) - 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((52390173.0L/8.0L)*x - 995413287.0L/16.0L) + 178224435037.0L/672.0L) - 897640134875.0L/1344.0L) + 2771662937593.0L/2520.0L) - 34636460331.0L/28.0L) + 92325659833.0L/96.0L) - 293752394221.0L/576.0L) + 50794993249.0L/288.0L) - 180827900539.0L/5040.0L) + 2187390689.0L/672.0L) + 1.0L/192.0L) - 1.0L/240.0L) - 7.0L/40.0L) + 21.0L/160.0L) + 323.0L/192.0L) - 323.0L/288.0L) - 1669.0L/360.0L) + 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[5] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-366731211.0L/40.0L*x + 6967893009.0L/80.0L) - 178224435037.0L/480.0L) + 179528026975.0L/192.0L) - 2771662937593.0L/1800.0L) + 34636460331.0L/20.0L) - 646279618831.0L/480.0L) + 2056266759547.0L/2880.0L) - 355564952743.0L/1440.0L) + 180827900539.0L/3600.0L) - 2187390689.0L/480.0L) - 1.0L/160.0L) + 77.0L/360.0L) - 341.0L/160.0L) + 1529.0L/240.0L) - 5269.0L/1800.0L;
-poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((366731211.0L/40.0L)*x - 6967893009.0L/80.0L) + 178224435037.0L/480.0L) - 179528026975.0L/192.0L) + 2771662937593.0L/1800.0L) - 34636460331.0L/20.0L) + 646279618831.0L/480.0L) - 2056266759547.0L/2880.0L) + 355564952743.0L/1440.0L) - 180827900539.0L/3600.0L) + 2187390689.0L/480.0L) + 1.0L/192.0L) + 1.0L/240.0L) - 7.0L/40.0L) - 21.0L/160.0L) + 323.0L/192.0L) + 323.0L/288.0L) - 1669.0L/360.0L) - 1669.0L/720.0L) + 5.0L/3.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-52390173.0L/8.0L*x + 995413287.0L/16.0L) - 178224435037.0L/672.0L) + 897640134875.0L/1344.0L) - 2771662937593.0L/2520.0L) + 34636460331.0L/28.0L) - 92325659833.0L/96.0L) + 293752394221.0L/576.0L) - 50794993249.0L/288.0L) + 180827900539.0L/5040.0L) - 2187390689.0L/672.0L) - 1.0L/336.0L) - 1.0L/210.0L) + 17.0L/180.0L) + 17.0L/120.0L) - 13.0L/16.0L) - 13.0L/12.0L) + 4369.0L/2520.0L) + 4369.0L/2520.0L) - 5.0L/21.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((52390173.0L/16.0L)*x - 995413287.0L/32.0L) + 178224435037.0L/1344.0L) - 897640134875.0L/2688.0L) + 2771662937593.0L/5040.0L) - 34636460331.0L/56.0L) + 92325659833.0L/192.0L) - 293752394221.0L/1152.0L) + 50794993249.0L/576.0L) - 180827900539.0L/10080.0L) + 2187390689.0L/1344.0L) + 1.0L/896.0L) + 3.0L/1120.0L) - 23.0L/720.0L) - 23.0L/320.0L) + 29.0L/128.0L) + 29.0L/64.0L) - 541.0L/1680.0L) - 541.0L/1120.0L) + 5.0L/126.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-17463391.0L/16.0L*x + 331804429.0L/32.0L) - 178224435037.0L/4032.0L) + 897640134875.0L/8064.0L) - 2771662937593.0L/15120.0L) + 11545486777.0L/56.0L) - 92325659833.0L/576.0L) + 293752394221.0L/3456.0L) - 50794993249.0L/1728.0L) + 180827900539.0L/30240.0L) - 2187390689.0L/4032.0L) - 1.0L/4032.0L) - 1.0L/1260.0L) + 13.0L/2160.0L) + 13.0L/720.0L) - 19.0L/576.0L) - 19.0L/216.0L) + 1261.0L/30240.0L) + 1261.0L/15120.0L) - 5.0L/1008.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((17463391.0L/80.0L)*x - 331804429.0L/160.0L) + 178224435037.0L/20160.0L) - 179528026975.0L/8064.0L) + 2771662937593.0L/75600.0L) - 11545486777.0L/280.0L) + 92325659833.0L/2880.0L) - 293752394221.0L/17280.0L) + 50794993249.0L/8640.0L) - 180827900539.0L/151200.0L) + 2187390689.0L/20160.0L) + 1.0L/40320.0L) + 1.0L/10080.0L) - 1.0L/2160.0L) - 1.0L/576.0L) + 13.0L/5760.0L) + 13.0L/1728.0L) - 41.0L/15120.0L) - 41.0L/6048.0L) + 1.0L/3150.0L;
-poly_val[11] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1587581.0L/80.0L*x + 30164039.0L/160.0L) - 16202221367.0L/20160.0L) + 16320729725.0L/8064.0L) - 251969357963.0L/75600.0L) + 1049589707.0L/280.0L) - 8393241803.0L/2880.0L) + 26704763111.0L/17280.0L) - 4617726659.0L/8640.0L) + 16438900049.0L/151200.0L) - 198853699.0L/20160.0L);
-break;
+
+template void beta_n5_m8<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m8<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 9, 0>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-12.52548225308642, 137.7803047839506, -688.9015239197531, 2066.704571759259,
+         -4133.409143518518, 5786.772800925926, -5786.772800925926, 4133.409143518518,
+         -2066.704571759259, 688.9015239197531, -137.7803047839506, 12.52548225308642},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {31.52886615410053, -346.8175276951058, 1734.087638475529, -5202.262915426587,
+         10404.525830853174, -14566.336163194444, 14566.336163194444, -10404.525830853174,
+         5202.262915426587, -1734.087638475529, 346.8175276951058, -31.52886615410053},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-35.778752066798944, 393.56627273478836, -1967.8313636739417, 5903.494091021826,
+         -11806.988182043651, 16529.78345486111, -16529.78345486111, 11806.988182043651,
+         -5903.494091021826, 1967.8313636739417, -393.56627273478836, 35.778752066798944},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {24.124306761188272, -265.367374373071, 1326.8368718653549, -3980.510615596065,
+         7961.02123119213, -11145.429723668982, 11145.429723668982, -7961.02123119213,
+         3980.510615596065, -1326.8368718653549, 265.367374373071, -24.124306761188272},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-10.718836379278274, 117.90720017206101, -589.5360008603051, 1768.6080025809151,
+         -3537.2160051618303, 4952.102407226563, -4952.102407226563, 3537.2160051618303,
+         -1768.6080025809151, 589.5360008603051, -117.90720017206101, 10.718836379278274},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {3.2885335770864335, -36.17387210368269, 180.86937154134114, -542.6081394256107,
+         1085.2163119200045, -1519.3028598361545, 1519.3028598361545, -1085.2163119200045,
+         542.6081394256107, -180.86937154134114, 36.17387210368269, -3.2885335770864335},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-0.7100168072735822, 7.810242750379774, -39.051643646078766, 117.15624542236328,
+         -234.3145741780599, 328.0420010715061, -328.0420010715061, 234.3145741780599,
+         -117.15624542236328, 39.051643646078766, -7.810242750379774, 0.7100168072735822},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.10855571322970921, -1.1944528339527272, 5.97536023457845, -17.944418377346462,
+         35.93006939358182, -50.33967527601454, 50.33967527601454, -35.93006939358182,
+         17.944418377346462, -5.97536023457845, 1.1944528339527272, -0.10855571322970921},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.012007304221864731, 0.1326364875891011, -0.6686188080954173, 2.0445422501791093,
+         -4.347407499696843, 6.438194863001505, -6.438194863001505, 4.347407499696843,
+         -2.0445422501791093, 0.6686188080954173, -0.1326364875891011, 0.012007304221864731},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0007936129557392584, -0.008848421983617955, 0.04541437244289136, -0.14478891113447764,
+         0.35161395508145527, -1.5778918613327875, 1.5778918613327875, -0.35161395508145527,
+         0.14478891113447764, -0.04541437244289136, 0.008848421983617955, -0.0007936129557392584},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 9, 0>::coefficients[20][12];
+
+template <>
+struct spline_polynomials<5, 9, 1>
+{
+    static constexpr int degree = 18;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-237.98416280864197, 2617.825790895062, -13089.128954475309, 39267.38686342593,
+         -78534.77372685185, 109948.6832175926, -109948.6832175926, 78534.77372685185,
+         -39267.38686342593, 13089.128954475309, -2617.825790895062, 237.98416280864197},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {535.990724619709, -5895.897970816799, 29479.489854083993, -88438.46956225198,
+         176876.93912450396, -247627.71477430555, 247627.71477430555, -176876.93912450396,
+         88438.46956225198, -29479.489854083993, 5895.897970816799, -535.990724619709},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-536.6812810019841, 5903.494091021826, -29517.470455109127, 88552.41136532738,
+         -177104.82273065476, 247946.75182291667, -247946.75182291667, 177104.82273065476,
+         -88552.41136532738, 29517.470455109127, -5903.494091021826, 536.6812810019841},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {313.6159878954475, -3449.7758668499227, 17248.879334249614, -51746.63800274884,
+         103493.27600549768, -144890.58640769677, 144890.58640769677, -103493.27600549768,
+         51746.63800274884, -17248.879334249614, 3449.7758668499227, -313.6159878954475},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-117.90720017206101, 1296.9792018926712, -6484.896009463356, 19454.68802839007,
+         -38909.37605678014, 54473.12647949219, -54473.12647949219, 38909.37605678014,
+         -19454.68802839007, 6484.896009463356, -1296.9792018926712, 117.90720017206101},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {29.5968021937779, -325.5648489331442, 1627.8243438720704, -4883.473254830496,
+         9766.946807280041, -13673.72573852539, 13673.72573852539, -9766.946807280041,
+         4883.473254830496, -1627.8243438720704, 325.5648489331442, -29.5968021937779},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-4.970117650915075, 54.67169925265842, -273.36150552255134, 820.093717956543,
+         -1640.2020192464192, 2296.2940075005426, -2296.2940075005426, 1640.2020192464192,
+         -820.093717956543, 273.36150552255134, -54.67169925265842, 4.970117650915075},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.542778566148546, -5.972264169763636, 29.876801172892254, -89.72209188673231,
+         179.65034696790906, -251.6983763800727, 251.6983763800727, -179.65034696790906,
+         89.72209188673231, -29.876801172892254, 5.972264169763636, -0.542778566148546},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.036021912665594194, 0.3979094627673033, -2.005856424286252, 6.133626750537327,
+         -13.042222499090528, 19.314584589004518, -19.314584589004518, 13.042222499090528,
+         -6.133626750537327, 2.005856424286252, -0.3979094627673033, 0.036021912665594194},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0007936129557392584, -0.008848421983617955, 0.04541437244289136, -0.14478891113447764,
+         0.35161395508145527, -1.5778918613327875, 1.5778918613327875, -0.35161395508145527,
+         0.14478891113447764, -0.04541437244289136, 0.008848421983617955, -0.0007936129557392584}};
+};
+constexpr double spline_polynomials<5, 9, 1>::coefficients[19][12];
+
+template <>
+struct spline_polynomials<5, 9, 2>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4283.714930555556, 47120.86423611111, -235604.32118055556, 706812.9635416666,
+         -1413625.9270833333, 1979076.2979166666, -1979076.2979166666, 1413625.9270833333,
+         -706812.9635416666, 235604.32118055556, -47120.86423611111, 4283.714930555556},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {8575.851593915344, -94334.36753306878, 471671.8376653439, -1415015.5129960317,
+         2830031.0259920633, -3962043.436388889, 3962043.436388889, -2830031.0259920633,
+         1415015.5129960317, -471671.8376653439, 94334.36753306878, -8575.851593915344},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-7513.537934027778, 82648.91727430555, -413244.58637152775, 1239733.7591145833,
+         -2479467.5182291665, 3471254.525520833, -3471254.525520833, 2479467.5182291665,
+         -1239733.7591145833, 413244.58637152775, -82648.91727430555, 7513.537934027778},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {3763.3918547453704, -41397.31040219907, 206986.55201099536, -620959.6560329861,
+         1241919.3120659722, -1738687.036892361, 1738687.036892361, -1241919.3120659722,
+         620959.6560329861, -206986.55201099536, 41397.31040219907, -3763.3918547453704},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-1179.0720017206102, 12969.792018926712, -64848.960094633556, 194546.88028390068,
+         -389093.76056780136, 544731.2647949219, -544731.2647949219, 389093.76056780136,
+         -194546.88028390068, 64848.960094633556, -12969.792018926712, 1179.0720017206102},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {236.7744175502232, -2604.5187914651538, 13022.594750976563, -39067.78603864397,
+         78135.57445824033, -109389.80590820312, 109389.80590820312, -78135.57445824033,
+         39067.78603864397, -13022.594750976563, 2604.5187914651538, -236.7744175502232},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-29.820705905490453, 328.03019551595054, -1640.1690331353082, 4920.562307739257,
+         -9841.212115478516, 13777.764045003256, -13777.764045003256, 9841.212115478516,
+         -4920.562307739257, 1640.1690331353082, -328.03019551595054, 29.820705905490453},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {2.171114264594184, -23.889056679054544, 119.50720469156902, -358.88836754692926,
+         718.6013878716362, -1006.7935055202908, 1006.7935055202908, -718.6013878716362,
+         358.88836754692926, -119.50720469156902, 23.889056679054544, -2.171114264594184},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.07204382533118839, 0.7958189255346066, -4.011712848572504, 12.267253501074654,
+         -26.084444998181056, 38.629169178009036, -38.629169178009036, 26.084444998181056,
+         -12.267253501074654, 4.011712848572504, -0.7958189255346066, 0.07204382533118839},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 9, 2>::coefficients[18][12];
+
+template <class real_number>
+void beta_n5_m9(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 9, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 9, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 9, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m9<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m9<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<5, 10, 0>
+{
+    static constexpr int degree = 21;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {47.249434523809526, -519.7437797619048, 2598.718898809524, -7796.156696428571,
+         15592.313392857142, -21829.23875, 21829.23875, -15592.313392857142,
+         7796.156696428571, -2598.718898809524, 519.7437797619048, -47.249434523809526},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-130.64906856261024, 1437.1397541887125, -7185.6987709435625, 21557.096312830687,
+         -43114.19262566137, 60359.869675925926, -60359.869675925926, 43114.19262566137,
+         -21557.096312830687, 7185.6987709435625, -1437.1397541887125, 130.64906856261024},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {164.4179007523148, -1808.596908275463, 9042.984541377315, -27128.953624131944,
+         54257.90724826389, -75961.07014756945, 75961.07014756945, -54257.90724826389,
+         27128.953624131944, -9042.984541377315, 1808.596908275463, -164.4179007523148},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-124.3714417989418, 1368.0858597883598, -6840.429298941799, 20521.287896825397,
+         -41042.575793650794, 57459.60611111111, -57459.60611111111, 41042.575793650794,
+         -20521.287896825397, 6840.429298941799, -1368.0858597883598, 124.3714417989418},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {62.883608519000774, -691.7196937090085, 3458.5984685450426, -10375.795405635128,
+         20751.590811270256, -29052.227135778357, 29052.227135778357, -20751.590811270256,
+         10375.795405635128, -3458.5984685450426, 691.7196937090085, -62.883608519000774},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-22.346626906622024, 245.81289597284226, -1229.0644798642113, 3687.193439592634,
+         -7374.386879185268, 10324.141630859374, -10324.141630859374, 7374.386879185268,
+         -3687.193439592634, 1229.0644798642113, -245.81289597284226, 22.346626906622024},
+        {1.3778659611992944e-07, -1.240079365079365e-06, 4.822530864197531e-06, -1.0333994708994708e-05,
+         1.240079365079365e-05, -5.787037037037037e-06, -5.787037037037037e-06, 1.240079365079365e-05,
+         -1.0333994708994708e-05, 4.822530864197531e-06, -1.240079365079365e-06, 1.3778659611992944e-07},
+        {5.710989936949715, -62.820892062178785, 314.1044713338216, -942.3134388030521,
+         1884.6269106748873, -2638.4776980929905, 2638.4776980929905, -1884.6269106748873,
+         942.3134388030521, -314.1044713338216, 62.820892062178785, -5.710989936949715},
+        {-5.68369708994709e-06, 6.355406746031746e-05, -0.0002857349537037037, 0.0006742931547619048,
+         -0.0008587549603174603, 0.0004123263888888889, 0.0004123263888888889, -0.0008587549603174603,
+         0.0006742931547619048, -0.0002857349537037037, 6.355406746031746e-05, -5.68369708994709e-06},
+        {-1.0560820015397652, 11.616959887307788, -58.08522933071883, 174.25700247628347,
+         -348.5160882859003, 487.9241208224826, -487.9241208224826, 348.5160882859003,
+         -174.25700247628347, 58.08522933071883, -11.616959887307788, 1.0560820015397652},
+        {7.55931712962963e-05, -0.0009407552083333334, 0.005163122106481482, -0.014350043402777778,
+         0.020345052083333332, -0.01029296875, -0.01029296875, 0.020345052083333332,
+         -0.014350043402777778, 0.005163122106481482, -0.0009407552083333334, 7.55931712962963e-05},
+        {0.14099932519216385, -1.5513325655397283, 7.759758892513457, -23.29761435115148,
+         46.636461341191854, -65.32862400266859, 65.32862400266859, -46.636461341191854,
+         23.29761435115148, -7.759758892513457, 1.5513325655397283, -0.14099932519216385},
+        {-0.00037204533867945324, 0.004878355964781746, -0.02980761115933642, 0.1097176365120701,
+         -0.19351012214781746, 0.10909378616898148, 0.10909378616898148, -0.19351012214781746,
+         0.1097176365120701, -0.02980761115933642, 0.004878355964781746, -0.00037204533867945324},
+        {-0.013809727108667767, 0.15246313934393452, -0.7677520668695843, 2.34194202650161,
+         -4.942207052341844, 7.270914236704509, -7.270914236704509, 4.942207052341844,
+         -2.34194202650161, 0.7677520668695843, -0.15246313934393452, 0.013809727108667767},
+        {0.0005690268864707341, -0.007623877146887401, 0.04867570665147569, -0.20101965041387648,
+         0.6287080795045883, -0.4693092854817708, -0.4693092854817708, 0.6287080795045883,
+         -0.20101965041387648, 0.04867570665147569, -0.007623877146887401, 0.0005690268864707341},
+        {0.0008386735279093344, -0.00934408827748879, 0.04789270391224553, -0.15222390554254017,
+         0.3664839438975803, -1.5987098456753626, 1.5987098456753626, -0.3664839438975803,
+         0.15222390554254017, -0.04789270391224553, 0.00934408827748879, -0.0008386735279093344},
+        {-0.0001201629638671875, 0.0016155242919921875, -0.010385513305664062, 0.04361915588378906,
+         -0.14539718627929688, 0.6106681823730469, 0.6106681823730469, -0.14539718627929688,
+         0.04361915588378906, -0.010385513305664062, 0.0016155242919921875, -0.0001201629638671875}};
+};
+constexpr double spline_polynomials<5, 10, 0>::coefficients[22][12];
+
+template <>
+struct spline_polynomials<5, 10, 1>
+{
+    static constexpr int degree = 20;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {992.238125, -10914.619375, 54573.096875, -163719.290625,
+         327438.58125, -458414.01375, 458414.01375, -327438.58125,
+         163719.290625, -54573.096875, 10914.619375, -992.238125},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-2482.332302689594, 27305.655329585537, -136528.27664792768, 409584.82994378306,
+         -819169.6598875661, 1146837.5238425925, -1146837.5238425925, 819169.6598875661,
+         -409584.82994378306, 136528.27664792768, -27305.655329585537, 2482.332302689594},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {2795.1043127893518, -30746.14744068287, 153730.73720341435, -461192.2116102431,
+         922384.4232204861, -1291338.1925086805, 1291338.1925086805, -922384.4232204861,
+         461192.2116102431, -153730.73720341435, 30746.14744068287, -2795.1043127893518},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-1865.571626984127, 20521.287896825397, -102606.43948412698, 307819.31845238095,
+         -615638.6369047619, 861894.0916666667, -861894.0916666667, 615638.6369047619,
+         -307819.31845238095, 102606.43948412698, -20521.287896825397, 1865.571626984127},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {817.48691074701, -8992.35601821711, 44961.78009108555, -134885.34027325665,
+         269770.6805465133, -377678.9527651186, 377678.9527651186, -269770.6805465133,
+         134885.34027325665, -44961.78009108555, 8992.35601821711, -817.48691074701},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-245.81289597284226, 2703.941855701265, -13519.709278506325, 40559.12783551897,
+         -81118.25567103794, 113565.55793945312, -113565.55793945312, 81118.25567103794,
+         -40559.12783551897, 13519.709278506325, -2703.941855701265, 245.81289597284226},
+        {1.3778659611992946e-06, -1.240079365079365e-05, 4.8225308641975306e-05, -0.00010333994708994708,
+         0.0001240079365079365, -5.787037037037037e-05, -5.787037037037037e-05, 0.0001240079365079365,
+         -0.00010333994708994708, 4.8225308641975306e-05, -1.240079365079365e-05, 1.3778659611992946e-06},
+        {51.398909432547434, -565.3880285596091, 2826.9402420043943, -8480.82094922747,
+         16961.642196073986, -23746.299282836913, 23746.299282836913, -16961.642196073986,
+         8480.82094922747, -2826.9402420043943, 565.3880285596091, -51.398909432547434},
+        {-4.546957671957672e-05, 0.0005084325396825397, -0.0022858796296296295, 0.005394345238095238,
+         -0.006870039682539682, 0.003298611111111111, 0.003298611111111111, -0.006870039682539682,
+         0.005394345238095238, -0.0022858796296296295, 0.0005084325396825397, -4.546957671957672e-05},
+        {-7.392574010778357, 81.31871921115452, -406.5966053150318, 1219.7990173339845,
+         -2439.612618001302, 3415.4688457573784, -3415.4688457573784, 2439.612618001302,
+         -1219.7990173339845, 406.5966053150318, -81.31871921115452, 7.392574010778357},
+        {0.00045355902777777777, -0.00564453125, 0.030978732638888888, -0.08610026041666667,
+         0.1220703125, -0.0617578125, -0.0617578125, 0.1220703125,
+         -0.08610026041666667, 0.030978732638888888, -0.00564453125, 0.00045355902777777777},
+        {0.7049966259608194, -7.756662827698642, 38.79879446256729, -116.4880717557574,
+         233.18230670595926, -326.643120013343, 326.643120013343, -233.18230670595926,
+         116.4880717557574, -38.79879446256729, 7.756662827698642, -0.7049966259608194},
+        {-0.001488181354717813, 0.019513423859126983, -0.11923044463734568, 0.4388705460482804,
+         -0.7740404885912698, 0.4363751446759259, 0.4363751446759259, -0.7740404885912698,
+         0.4388705460482804, -0.11923044463734568, 0.019513423859126983, -0.001488181354717813},
+        {-0.0414291813260033, 0.4573894180318035, -2.303256200608753, 7.025826079504831,
+         -14.826621157025533, 21.812742710113525, -21.812742710113525, 14.826621157025533,
+         -7.025826079504831, 2.303256200608753, -0.4573894180318035, 0.0414291813260033},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682},
+        {0.0008386735279093344, -0.00934408827748879, 0.04789270391224553, -0.15222390554254017,
+         0.3664839438975803, -1.5987098456753626, 1.5987098456753626, -0.3664839438975803,
+         0.15222390554254017, -0.04789270391224553, 0.00934408827748879, -0.0008386735279093344}};
+};
+constexpr double spline_polynomials<5, 10, 1>::coefficients[21][12];
+
+template <>
+struct spline_polynomials<5, 10, 2>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 12;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {19844.7625, -218292.3875, 1091461.9375, -3274385.8125,
+         6548771.625, -9168280.275, 9168280.275, -6548771.625,
+         3274385.8125, -1091461.9375, 218292.3875, -19844.7625},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-44681.9814484127, 491501.7959325397, -2457508.979662698, 7372526.938988095,
+         -14745053.87797619, 20643075.429166667, -20643075.429166667, 14745053.87797619,
+         -7372526.938988095, 2457508.979662698, -491501.7959325397, 44681.9814484127},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {44721.66900462963, -491938.35905092594, 2459691.7952546296, -7379075.385763889,
+         14758150.771527778, -20661411.08013889, 20661411.08013889, -14758150.771527778,
+         7379075.385763889, -2459691.7952546296, 491938.35905092594, -44721.66900462963},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-26118.00277777778, 287298.03055555554, -1436490.1527777778, 4309470.458333333,
+         -8618940.916666666, 12066517.283333333, -12066517.283333333, 8618940.916666666,
+         -4309470.458333333, 1436490.1527777778, -287298.03055555554, 26118.00277777778},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {9809.84292896412, -107908.27221860533, 539541.3610930266, -1618624.0832790798,
+         3237248.1665581595, -4532147.433181424, 4532147.433181424, -3237248.1665581595,
+         1618624.0832790798, -539541.3610930266, 107908.27221860533, -9809.84292896412},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {-2458.1289597284226, 27039.41855701265, -135197.09278506326, 405591.2783551897,
+         -811182.5567103794, 1135655.5793945312, -1135655.5793945312, 811182.5567103794,
+         -405591.2783551897, 135197.09278506326, -27039.41855701265, 2458.1289597284226},
+        {1.240079365079365e-05, -0.00011160714285714285, 0.00043402777777777775, -0.0009300595238095238,
+         0.0011160714285714285, -0.0005208333333333333, -0.0005208333333333333, 0.0011160714285714285,
+         -0.0009300595238095238, 0.00043402777777777775, -0.00011160714285714285, 1.240079365079365e-05},
+        {411.1912754603795, -4523.104228476873, 22615.521936035155, -67846.56759381975,
+         135693.1375685919, -189970.3942626953, 189970.3942626953, -135693.1375685919,
+         67846.56759381975, -22615.521936035155, 4523.104228476873, -411.1912754603795},
+        {-0.00031828703703703706, 0.0035590277777777777, -0.01600115740740741, 0.037760416666666664,
+         -0.04809027777777778, 0.02309027777777778, 0.02309027777777778, -0.04809027777777778,
+         0.037760416666666664, -0.01600115740740741, 0.0035590277777777777, -0.00031828703703703706},
+        {-44.35544406467014, 487.91231526692707, -2439.579631890191, 7318.794104003906,
+         -14637.675708007813, 20492.813074544272, -20492.813074544272, 14637.675708007813,
+         -7318.794104003906, 2439.579631890191, -487.91231526692707, 44.35544406467014},
+        {0.002267795138888889, -0.02822265625, 0.15489366319444445, -0.4305013020833333,
+         0.6103515625, -0.3087890625, -0.3087890625, 0.6103515625,
+         -0.4305013020833333, 0.15489366319444445, -0.02822265625, 0.002267795138888889},
+        {2.8199865038432774, -31.026651310794566, 155.19517785026915, -465.9522870230296,
+         932.729226823837, -1306.572480053372, 1306.572480053372, -932.729226823837,
+         465.9522870230296, -155.19517785026915, 31.026651310794566, -2.8199865038432774},
+        {-0.0044645440641534395, 0.05854027157738095, -0.35769133391203706, 1.3166116381448412,
+         -2.3221214657738094, 1.3091254340277778, 1.3091254340277778, -2.3221214657738094,
+         1.3166116381448412, -0.35769133391203706, 0.05854027157738095, -0.0044645440641534395},
+        {-0.0828583626520066, 0.914778836063607, -4.606512401217506, 14.051652159009661,
+         -29.653242314051067, 43.62548542022705, -43.62548542022705, 29.653242314051067,
+         -14.051652159009661, 4.606512401217506, -0.914778836063607, 0.0828583626520066},
+        {0.0011380537729414682, -0.015247754293774802, 0.09735141330295138, -0.40203930082775297,
+         1.2574161590091766, -0.9386185709635416, -0.9386185709635416, 1.2574161590091766,
+         -0.40203930082775297, 0.09735141330295138, -0.015247754293774802, 0.0011380537729414682}};
+};
+constexpr double spline_polynomials<5, 10, 2>::coefficients[20][12];
+
+template <class real_number>
+void beta_n5_m10(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<5, 10, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<5, 10, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<5, 10, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n5_m10<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n5_m10<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
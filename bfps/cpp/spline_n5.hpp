@@ -28,17 +28,28 @@
 
 #define SPLINE_N5
 
-void beta_n5_m0( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m1( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m2( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m3( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m4( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m5( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m6( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m7( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m8( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m9( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n5_m10(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m9(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n5_m10(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N5
 
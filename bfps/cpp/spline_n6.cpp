@@ -25,693 +25,2648 @@
 
 
 #include "spline_n6.hpp"
-#include <cmath>
-void beta_n6_m0(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = 0;
-poly_val[6] = -x + 1;
-poly_val[7] = x;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-poly_val[12] = 0;
-poly_val[13] = 0;
-break;
-case 1:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = 0;
-poly_val[6] = -1;
-poly_val[7] = 1;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-poly_val[12] = 0;
-poly_val[13] = 0;
-break;
-case 2:
-poly_val[0] = 0;
-poly_val[1] = 0;
-poly_val[2] = 0;
-poly_val[3] = 0;
-poly_val[4] = 0;
-poly_val[5] = 0;
-poly_val[6] = 0;
-poly_val[7] = 0;
-poly_val[8] = 0;
-poly_val[9] = 0;
-poly_val[10] = 0;
-poly_val[11] = 0;
-poly_val[12] = 0;
-poly_val[13] = 0;
-break;
-}
-}
-void beta_n6_m1(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*((1.0L/5544.0L)*x - 1.0L/2772.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(-67.0L/27720.0L*x + 139.0L/27720.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*((47.0L/3080.0L)*x - 51.0L/1540.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(-31.0L/504.0L*x + 71.0L/504.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*((95.0L/504.0L)*x - 115.0L/252.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(-33.0L/56.0L*x + 81.0L/56.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*((8.0L/7.0L)*x - 15.0L/7.0L) + 1;
-poly_val[7] = x*(x*(-8.0L/7.0L*x + 9.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*((33.0L/56.0L)*x - 9.0L/28.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(-95.0L/504.0L*x + 55.0L/504.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*((31.0L/504.0L)*x - 11.0L/252.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(-47.0L/3080.0L*x + 39.0L/3080.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*((67.0L/27720.0L)*x - 31.0L/13860.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 2)*(-1.0L/5544.0L*x + 1.0L/5544.0L);
-break;
-case 1:
-poly_val[0] = x*((1.0L/1848.0L)*x - 1.0L/1386.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(-67.0L/9240.0L*x + 139.0L/13860.0L) - 1.0L/385.0L;
-poly_val[2] = x*((141.0L/3080.0L)*x - 51.0L/770.0L) + 1.0L/56.0L;
-poly_val[3] = x*(-31.0L/168.0L*x + 71.0L/252.0L) - 5.0L/63.0L;
-poly_val[4] = x*((95.0L/168.0L)*x - 115.0L/126.0L) + 15.0L/56.0L;
-poly_val[5] = x*(-99.0L/56.0L*x + 81.0L/28.0L) - 6.0L/7.0L;
-poly_val[6] = x*((24.0L/7.0L)*x - 30.0L/7.0L);
-poly_val[7] = x*(-24.0L/7.0L*x + 18.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*((99.0L/56.0L)*x - 9.0L/14.0L) - 15.0L/56.0L;
-poly_val[9] = x*(-95.0L/168.0L*x + 55.0L/252.0L) + 5.0L/63.0L;
-poly_val[10] = x*((31.0L/168.0L)*x - 11.0L/126.0L) - 1.0L/56.0L;
-poly_val[11] = x*(-141.0L/3080.0L*x + 39.0L/1540.0L) + 1.0L/385.0L;
-poly_val[12] = x*((67.0L/9240.0L)*x - 31.0L/6930.0L) - 1.0L/5544.0L;
-poly_val[13] = x*(-1.0L/1848.0L*x + 1.0L/2772.0L);
-break;
-case 2:
-poly_val[0] = (1.0L/924.0L)*x - 1.0L/1386.0L;
-poly_val[1] = -67.0L/4620.0L*x + 139.0L/13860.0L;
-poly_val[2] = (141.0L/1540.0L)*x - 51.0L/770.0L;
-poly_val[3] = -31.0L/84.0L*x + 71.0L/252.0L;
-poly_val[4] = (95.0L/84.0L)*x - 115.0L/126.0L;
-poly_val[5] = -99.0L/28.0L*x + 81.0L/28.0L;
-poly_val[6] = (48.0L/7.0L)*x - 30.0L/7.0L;
-poly_val[7] = -48.0L/7.0L*x + 18.0L/7.0L;
-poly_val[8] = (99.0L/28.0L)*x - 9.0L/14.0L;
-poly_val[9] = -95.0L/84.0L*x + 55.0L/252.0L;
-poly_val[10] = (31.0L/84.0L)*x - 11.0L/126.0L;
-poly_val[11] = -141.0L/1540.0L*x + 39.0L/1540.0L;
-poly_val[12] = (67.0L/4620.0L)*x - 31.0L/6930.0L;
-poly_val[13] = -1.0L/924.0L*x + 1.0L/2772.0L;
-break;
-}
-}
-void beta_n6_m2(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(-17.0L/33264.0L*x + 5.0L/3696.0L) - 1.0L/1008.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*((5573.0L/831600.0L)*x - 3721.0L/207900.0L) + 1577.0L/118800.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(-359.0L/8800.0L*x + 6791.0L/61600.0L) - 729.0L/8800.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*((929.0L/6048.0L)*x - 425.0L/1008.0L) + 647.0L/2016.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(-175.0L/432.0L*x + 3425.0L/3024.0L) - 2605.0L/3024.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*((87.0L/112.0L)*x - 15.0L/7.0L) + 153.0L/112.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(x*(x*(-27217.0L/25200.0L*x + 23617.0L/8400.0L) - 10417.0L/8400.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*((27217.0L/25200.0L)*x - 32617.0L/12600.0L) + 20017.0L/25200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(-87.0L/112.0L*x + 195.0L/112.0L) - 9.0L/16.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*((175.0L/432.0L)*x - 25.0L/28.0L) + 55.0L/144.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(-929.0L/6048.0L*x + 2095.0L/6048.0L) - 1031.0L/6048.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*((359.0L/8800.0L)*x - 2887.0L/30800.0L) + 279.0L/5600.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(-5573.0L/831600.0L*x + 4327.0L/277200.0L) - 2411.0L/277200.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 3)*(x*((17.0L/33264.0L)*x - 5.0L/4158.0L) + 23.0L/33264.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(-85.0L/33264.0L*x + 5.0L/924.0L) - 1.0L/336.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*((5573.0L/166320.0L)*x - 3721.0L/51975.0L) + 1577.0L/39600.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(-359.0L/1760.0L*x + 6791.0L/15400.0L) - 2187.0L/8800.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*((4645.0L/6048.0L)*x - 425.0L/252.0L) + 647.0L/672.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(-875.0L/432.0L*x + 3425.0L/756.0L) - 2605.0L/1008.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*((435.0L/112.0L)*x - 60.0L/7.0L) + 459.0L/112.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(x*(x*(-27217.0L/5040.0L*x + 23617.0L/2100.0L) - 10417.0L/2800.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*((27217.0L/5040.0L)*x - 32617.0L/3150.0L) + 20017.0L/8400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(-435.0L/112.0L*x + 195.0L/28.0L) - 27.0L/16.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*((875.0L/432.0L)*x - 25.0L/7.0L) + 55.0L/48.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(-4645.0L/6048.0L*x + 2095.0L/1512.0L) - 1031.0L/2016.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*((359.0L/1760.0L)*x - 2887.0L/7700.0L) + 837.0L/5600.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(-5573.0L/166320.0L*x + 4327.0L/69300.0L) - 2411.0L/92400.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 2)*(x*((85.0L/33264.0L)*x - 10.0L/2079.0L) + 23.0L/11088.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(-85.0L/8316.0L*x + 5.0L/308.0L) - 1.0L/168.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*((5573.0L/41580.0L)*x - 3721.0L/17325.0L) + 1577.0L/19800.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(-359.0L/440.0L*x + 20373.0L/15400.0L) - 2187.0L/4400.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*((4645.0L/1512.0L)*x - 425.0L/84.0L) + 647.0L/336.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(-875.0L/108.0L*x + 3425.0L/252.0L) - 2605.0L/504.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*((435.0L/28.0L)*x - 180.0L/7.0L) + 459.0L/56.0L) + 12.0L/7.0L;
-poly_val[6] = x*(x*(-27217.0L/1260.0L*x + 23617.0L/700.0L) - 10417.0L/1400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*((27217.0L/1260.0L)*x - 32617.0L/1050.0L) + 20017.0L/4200.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(-435.0L/28.0L*x + 585.0L/28.0L) - 27.0L/8.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*((875.0L/108.0L)*x - 75.0L/7.0L) + 55.0L/24.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(-4645.0L/1512.0L*x + 2095.0L/504.0L) - 1031.0L/1008.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*((359.0L/440.0L)*x - 8661.0L/7700.0L) + 837.0L/2800.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(-5573.0L/41580.0L*x + 4327.0L/23100.0L) - 2411.0L/46200.0L) - 1.0L/16632.0L;
-poly_val[13] = x*(x*((85.0L/8316.0L)*x - 10.0L/693.0L) + 23.0L/5544.0L);
-break;
-}
-}
-void beta_n6_m3(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*((28331.0L/19958400.0L)*x - 24881.0L/4989600.0L) + 6577.0L/1108800.0L) - 1021.0L/453600.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(-52651.0L/2851200.0L*x + 431789.0L/6652800.0L) - 171223.0L/2217600.0L) + 580429.0L/19958400.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*((15373.0L/138600.0L)*x - 216257.0L/554400.0L) + 1299.0L/2800.0L) - 23929.0L/138600.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(-11549.0L/28350.0L*x + 92891.0L/64800.0L) - 64361.0L/37800.0L) + 281189.0L/453600.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*((370289.0L/362880.0L)*x - 4021.0L/1120.0L) + 36659.0L/8640.0L) - 26755.0L/18144.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(-17663.0L/9600.0L*x + 434419.0L/67200.0L) - 169737.0L/22400.0L) + 170129.0L/67200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(x*(x*((30941.0L/12600.0L)*x - 72299.0L/8400.0L) + 18013.0L/1800.0L) - 757.0L/225.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(-30941.0L/12600.0L*x + 216277.0L/25200.0L) - 125161.0L/12600.0L) + 88541.0L/25200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*((17663.0L/9600.0L)*x - 107767.0L/16800.0L) + 83193.0L/11200.0L) - 46769.0L/16800.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(-370289.0L/362880.0L*x + 1289219.0L/362880.0L) - 166547.0L/40320.0L) + 116269.0L/72576.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*((11549.0L/28350.0L)*x - 30631.0L/21600.0L) + 41743.0L/25200.0L) - 73589.0L/113400.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(-15373.0L/138600.0L*x + 214187.0L/554400.0L) - 249.0L/550.0L) + 8969.0L/50400.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*((52651.0L/2851200.0L)*x - 321133.0L/4989600.0L) + 251417.0L/3326400.0L) - 148399.0L/4989600.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 4)*(x*(x*(-28331.0L/19958400.0L*x + 3659.0L/739200.0L) - 503.0L/86400.0L) + 6533.0L/2851200.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*((28331.0L/2851200.0L)*x - 24881.0L/831600.0L) + 6577.0L/221760.0L) - 1021.0L/113400.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(-368557.0L/2851200.0L*x + 431789.0L/1108800.0L) - 171223.0L/443520.0L) + 580429.0L/4989600.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*((15373.0L/19800.0L)*x - 216257.0L/92400.0L) + 1299.0L/560.0L) - 23929.0L/34650.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(-11549.0L/4050.0L*x + 92891.0L/10800.0L) - 64361.0L/7560.0L) + 281189.0L/113400.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*((370289.0L/51840.0L)*x - 12063.0L/560.0L) + 36659.0L/1728.0L) - 26755.0L/4536.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(-123641.0L/9600.0L*x + 434419.0L/11200.0L) - 169737.0L/4480.0L) + 170129.0L/16800.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(x*(x*((30941.0L/1800.0L)*x - 72299.0L/1400.0L) + 18013.0L/360.0L) - 3028.0L/225.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(-30941.0L/1800.0L*x + 216277.0L/4200.0L) - 125161.0L/2520.0L) + 88541.0L/6300.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*((123641.0L/9600.0L)*x - 107767.0L/2800.0L) + 83193.0L/2240.0L) - 46769.0L/4200.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(-370289.0L/51840.0L*x + 1289219.0L/60480.0L) - 166547.0L/8064.0L) + 116269.0L/18144.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*((11549.0L/4050.0L)*x - 30631.0L/3600.0L) + 41743.0L/5040.0L) - 73589.0L/28350.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(-15373.0L/19800.0L*x + 214187.0L/92400.0L) - 249.0L/110.0L) + 8969.0L/12600.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*((368557.0L/2851200.0L)*x - 321133.0L/831600.0L) + 251417.0L/665280.0L) - 148399.0L/1247400.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 3)*(x*(x*(-28331.0L/2851200.0L*x + 3659.0L/123200.0L) - 503.0L/17280.0L) + 6533.0L/712800.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*((28331.0L/475200.0L)*x - 24881.0L/166320.0L) + 6577.0L/55440.0L) - 1021.0L/37800.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(-368557.0L/475200.0L*x + 431789.0L/221760.0L) - 171223.0L/110880.0L) + 580429.0L/1663200.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*((15373.0L/3300.0L)*x - 216257.0L/18480.0L) + 1299.0L/140.0L) - 23929.0L/11550.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(-11549.0L/675.0L*x + 92891.0L/2160.0L) - 64361.0L/1890.0L) + 281189.0L/37800.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*((370289.0L/8640.0L)*x - 12063.0L/112.0L) + 36659.0L/432.0L) - 26755.0L/1512.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(-123641.0L/1600.0L*x + 434419.0L/2240.0L) - 169737.0L/1120.0L) + 170129.0L/5600.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(x*(x*((30941.0L/300.0L)*x - 72299.0L/280.0L) + 18013.0L/90.0L) - 3028.0L/75.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(-30941.0L/300.0L*x + 216277.0L/840.0L) - 125161.0L/630.0L) + 88541.0L/2100.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*((123641.0L/1600.0L)*x - 107767.0L/560.0L) + 83193.0L/560.0L) - 46769.0L/1400.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(-370289.0L/8640.0L*x + 1289219.0L/12096.0L) - 166547.0L/2016.0L) + 116269.0L/6048.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*((11549.0L/675.0L)*x - 30631.0L/720.0L) + 41743.0L/1260.0L) - 73589.0L/9450.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(-15373.0L/3300.0L*x + 214187.0L/18480.0L) - 498.0L/55.0L) + 8969.0L/4200.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*((368557.0L/475200.0L)*x - 321133.0L/166320.0L) + 251417.0L/166320.0L) - 148399.0L/415800.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 2)*(x*(x*(-28331.0L/475200.0L*x + 3659.0L/24640.0L) - 503.0L/4320.0L) + 6533.0L/237600.0L);
-break;
-}
-}
-void beta_n6_m4(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-78457.0L/17107200.0L*x + 353087.0L/17107200.0L) - 211223.0L/5987520.0L) + 324853.0L/11975040.0L) - 17057.0L/2177280.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((7139707.0L/119750400.0L)*x - 3213169.0L/11975040.0L) + 4576529.0L/9979200.0L) - 21111899.0L/59875200.0L) + 12185113.0L/119750400.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-396659.0L/1108800.0L*x + 198349.0L/123200.0L) - 305099.0L/110880.0L) + 36643.0L/17325.0L) - 9017.0L/14784.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((3570011.0L/2721600.0L)*x - 8033279.0L/1360800.0L) + 13728709.0L/1360800.0L) - 1506979.0L/194400.0L) + 243283.0L/108864.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-7140163.0L/2177280.0L*x + 4590463.0L/311040.0L) - 114395.0L/4536.0L) + 21089681.0L/1088640.0L) - 12192451.0L/2177280.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((793363.0L/134400.0L)*x - 595053.0L/22400.0L) + 21787.0L/480.0L) - 468581.0L/13440.0L) + 90827.0L/8960.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-510023.0L/64800.0L*x + 459029.0L/12960.0L) - 13724287.0L/226800.0L) + 5272181.0L/113400.0L) - 881767.0L/64800.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((510023.0L/64800.0L)*x - 1147531.0L/32400.0L) + 182975.0L/3024.0L) - 10548199.0L/226800.0L) + 248141.0L/18144.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(-793363.0L/134400.0L*x + 1189983.0L/44800.0L) - 1524721.0L/33600.0L) + 2345149.0L/67200.0L) - 92069.0L/8960.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*((7140163.0L/2177280.0L)*x - 16064113.0L/1088640.0L) + 2744477.0L/108864.0L) - 21115391.0L/1088640.0L) + 12416921.0L/2177280.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(-3570011.0L/2721600.0L*x + 16063541.0L/2721600.0L) - 182969.0L/18144.0L) + 37717.0L/4860.0L) - 1239151.0L/544320.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*((396659.0L/1108800.0L)*x - 2833.0L/1760.0L) + 1524793.0L/554400.0L) - 1173593.0L/554400.0L) + 20827.0L/33600.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(-7139707.0L/119750400.0L*x + 32125673.0L/119750400.0L) - 196051.0L/427680.0L) + 21126353.0L/59875200.0L) - 494243.0L/4790016.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 5)*(x*(x*(x*((78457.0L/17107200.0L)*x - 176513.0L/8553600.0L) + 43987.0L/1247400.0L) - 1625177.0L/59875200.0L) + 27131.0L/3421440.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-78457.0L/1900800.0L*x + 353087.0L/2138400.0L) - 211223.0L/855360.0L) + 324853.0L/1995840.0L) - 17057.0L/435456.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*((7139707.0L/13305600.0L)*x - 3213169.0L/1496880.0L) + 4576529.0L/1425600.0L) - 21111899.0L/9979200.0L) + 12185113.0L/23950080.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(-396659.0L/123200.0L*x + 198349.0L/15400.0L) - 305099.0L/15840.0L) + 73286.0L/5775.0L) - 45085.0L/14784.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*((3570011.0L/302400.0L)*x - 8033279.0L/170100.0L) + 13728709.0L/194400.0L) - 1506979.0L/32400.0L) + 1216415.0L/108864.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(-7140163.0L/241920.0L*x + 4590463.0L/38880.0L) - 114395.0L/648.0L) + 21089681.0L/181440.0L) - 12192451.0L/435456.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*((2380089.0L/44800.0L)*x - 595053.0L/2800.0L) + 152509.0L/480.0L) - 468581.0L/2240.0L) + 90827.0L/1792.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(x*(x*(x*(x*(-510023.0L/7200.0L*x + 459029.0L/1620.0L) - 13724287.0L/32400.0L) + 5272181.0L/18900.0L) - 881767.0L/12960.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*((510023.0L/7200.0L)*x - 1147531.0L/4050.0L) + 182975.0L/432.0L) - 10548199.0L/37800.0L) + 1240705.0L/18144.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(-2380089.0L/44800.0L*x + 1189983.0L/5600.0L) - 1524721.0L/4800.0L) + 2345149.0L/11200.0L) - 92069.0L/1792.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*((7140163.0L/241920.0L)*x - 16064113.0L/136080.0L) + 2744477.0L/15552.0L) - 21115391.0L/181440.0L) + 12416921.0L/435456.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(-3570011.0L/302400.0L*x + 16063541.0L/340200.0L) - 182969.0L/2592.0L) + 37717.0L/810.0L) - 1239151.0L/108864.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*((396659.0L/123200.0L)*x - 2833.0L/220.0L) + 1524793.0L/79200.0L) - 1173593.0L/92400.0L) + 20827.0L/6720.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(-7139707.0L/13305600.0L*x + 32125673.0L/14968800.0L) - 1372357.0L/427680.0L) + 21126353.0L/9979200.0L) - 2471215.0L/4790016.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 4)*(x*(x*(x*((78457.0L/1900800.0L)*x - 176513.0L/1069200.0L) + 43987.0L/178200.0L) - 1625177.0L/9979200.0L) + 27131.0L/684288.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(-78457.0L/237600.0L*x + 2471609.0L/2138400.0L) - 211223.0L/142560.0L) + 324853.0L/399168.0L) - 17057.0L/108864.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*((7139707.0L/1663200.0L)*x - 3213169.0L/213840.0L) + 4576529.0L/237600.0L) - 21111899.0L/1995840.0L) + 12185113.0L/5987520.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(-396659.0L/15400.0L*x + 198349.0L/2200.0L) - 305099.0L/2640.0L) + 73286.0L/1155.0L) - 45085.0L/3696.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*((3570011.0L/37800.0L)*x - 8033279.0L/24300.0L) + 13728709.0L/32400.0L) - 1506979.0L/6480.0L) + 1216415.0L/27216.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(-7140163.0L/30240.0L*x + 32133241.0L/38880.0L) - 114395.0L/108.0L) + 21089681.0L/36288.0L) - 12192451.0L/108864.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*((2380089.0L/5600.0L)*x - 595053.0L/400.0L) + 152509.0L/80.0L) - 468581.0L/448.0L) + 90827.0L/448.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(x*(x*(x*(x*(-510023.0L/900.0L*x + 3213203.0L/1620.0L) - 13724287.0L/5400.0L) + 5272181.0L/3780.0L) - 881767.0L/3240.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*((510023.0L/900.0L)*x - 8032717.0L/4050.0L) + 182975.0L/72.0L) - 10548199.0L/7560.0L) + 1240705.0L/4536.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(-2380089.0L/5600.0L*x + 1189983.0L/800.0L) - 1524721.0L/800.0L) + 2345149.0L/2240.0L) - 92069.0L/448.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*((7140163.0L/30240.0L)*x - 16064113.0L/19440.0L) + 2744477.0L/2592.0L) - 21115391.0L/36288.0L) + 12416921.0L/108864.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(-3570011.0L/37800.0L*x + 16063541.0L/48600.0L) - 182969.0L/432.0L) + 37717.0L/162.0L) - 1239151.0L/27216.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*((396659.0L/15400.0L)*x - 19831.0L/220.0L) + 1524793.0L/13200.0L) - 1173593.0L/18480.0L) + 20827.0L/1680.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(-7139707.0L/1663200.0L*x + 32125673.0L/2138400.0L) - 1372357.0L/71280.0L) + 21126353.0L/1995840.0L) - 2471215.0L/1197504.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 3)*(x*(x*(x*((78457.0L/237600.0L)*x - 1235591.0L/1069200.0L) + 43987.0L/29700.0L) - 1625177.0L/1995840.0L) + 27131.0L/171072.0L);
-break;
-}
-}
-void beta_n6_m5(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7235.0L/456192.0L)*x - 74611.0L/855360.0L) + 2208637.0L/11404800.0L) - 412957.0L/1900800.0L) + 5907001.0L/47900160.0L) - 3433.0L/120960.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-16459627.0L/79833600.0L*x + 24689461.0L/21772800.0L) - 43068409.0L/17107200.0L) + 278363.0L/98560.0L) - 383954369.0L/239500800.0L) + 17675923.0L/47900160.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((24689443.0L/19958400.0L)*x - 3394801.0L/498960.0L) + 301478693.0L/19958400.0L) - 56368357.0L/3326400.0L) + 38395529.0L/3991680.0L) - 345319.0L/155925.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1645963.0L/362880.0L*x + 27158407.0L/1088640.0L) - 7178059.0L/129600.0L) + 18789413.0L/302400.0L) - 191980489.0L/5443200.0L) + 2105623.0L/259200.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((16459631.0L/1451520.0L)*x - 67896011.0L/1088640.0L) + 602956499.0L/4354560.0L) - 37578791.0L/241920.0L) + 76794211.0L/870912.0L) - 2764627.0L/136080.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-9875779.0L/483840.0L*x + 7759543.0L/69120.0L) - 301478033.0L/1209600.0L) + 1789467.0L/6400.0L) - 76796659.0L/483840.0L) + 17696393.0L/483840.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((5443.0L/200.0L)*x - 9699427.0L/64800.0L) + 1794511.0L/5400.0L) - 59649.0L/160.0L) + 5999921.0L/28350.0L) - 1474523.0L/30240.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-5443.0L/200.0L*x + 387977.0L/2592.0L) - 10767061.0L/32400.0L) + 671053.0L/1800.0L) - 2400023.0L/11340.0L) + 22110101.0L/453600.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((9875779.0L/483840.0L)*x - 1697399.0L/15120.0L) + 86136463.0L/345600.0L) - 112737253.0L/403200.0L) + 384008213.0L/2419200.0L) - 22100089.0L/604800.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-16459631.0L/1451520.0L*x + 271583779.0L/4354560.0L) - 100492529.0L/725760.0L) + 37579201.0L/241920.0L) - 76801705.0L/870912.0L) + 3272737.0L/161280.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1645963.0L/362880.0L)*x - 6789593.0L/272160.0L) + 43068229.0L/777600.0L) - 695913.0L/11200.0L) + 7680115.0L/217728.0L) - 315497.0L/38880.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-24689443.0L/19958400.0L*x + 135791833.0L/19958400.0L) - 150738829.0L/9979200.0L) + 11273813.0L/665280.0L) - 192000847.0L/19958400.0L) + 802967.0L/362880.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((16459627.0L/79833600.0L)*x - 176353.0L/155520.0L) + 200985157.0L/79833600.0L) - 5368489.0L/1900800.0L) + 76799599.0L/47900160.0L) - 3679981.0L/9979200.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 6)*(x*(x*(x*(x*(-7235.0L/456192.0L*x + 596887.0L/6842880.0L) - 3312943.0L/17107200.0L) + 412961.0L/1900800.0L) - 29538071.0L/239500800.0L) + 6793517.0L/239500800.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*((7235.0L/41472.0L)*x - 74611.0L/85536.0L) + 2208637.0L/1267200.0L) - 412957.0L/237600.0L) + 5907001.0L/6842880.0L) - 3433.0L/20160.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-16459627.0L/7257600.0L*x + 24689461.0L/2177280.0L) - 43068409.0L/1900800.0L) + 278363.0L/12320.0L) - 383954369.0L/34214400.0L) + 17675923.0L/7983360.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*((24689443.0L/1814400.0L)*x - 3394801.0L/49896.0L) + 301478693.0L/2217600.0L) - 56368357.0L/415800.0L) + 38395529.0L/570240.0L) - 690638.0L/51975.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-18105593.0L/362880.0L*x + 27158407.0L/108864.0L) - 7178059.0L/14400.0L) + 18789413.0L/37800.0L) - 191980489.0L/777600.0L) + 2105623.0L/43200.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*((181055941.0L/1451520.0L)*x - 67896011.0L/108864.0L) + 602956499.0L/483840.0L) - 37578791.0L/30240.0L) + 76794211.0L/124416.0L) - 2764627.0L/22680.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-108633569.0L/483840.0L*x + 7759543.0L/6912.0L) - 301478033.0L/134400.0L) + 1789467.0L/800.0L) - 76796659.0L/69120.0L) + 17696393.0L/80640.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((59873.0L/200.0L)*x - 9699427.0L/6480.0L) + 1794511.0L/600.0L) - 59649.0L/20.0L) + 5999921.0L/4050.0L) - 1474523.0L/5040.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-59873.0L/200.0L*x + 1939885.0L/1296.0L) - 10767061.0L/3600.0L) + 671053.0L/225.0L) - 2400023.0L/1620.0L) + 22110101.0L/75600.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*((108633569.0L/483840.0L)*x - 1697399.0L/1512.0L) + 86136463.0L/38400.0L) - 112737253.0L/50400.0L) + 384008213.0L/345600.0L) - 22100089.0L/100800.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-181055941.0L/1451520.0L*x + 271583779.0L/435456.0L) - 100492529.0L/80640.0L) + 37579201.0L/30240.0L) - 76801705.0L/124416.0L) + 3272737.0L/26880.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*((18105593.0L/362880.0L)*x - 6789593.0L/27216.0L) + 43068229.0L/86400.0L) - 695913.0L/1400.0L) + 7680115.0L/31104.0L) - 315497.0L/6480.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(-24689443.0L/1814400.0L*x + 135791833.0L/1995840.0L) - 150738829.0L/1108800.0L) + 11273813.0L/83160.0L) - 192000847.0L/2851200.0L) + 802967.0L/60480.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*((16459627.0L/7257600.0L)*x - 176353.0L/15552.0L) + 200985157.0L/8870400.0L) - 5368489.0L/237600.0L) + 76799599.0L/6842880.0L) - 3679981.0L/1663200.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 5)*(x*(x*(x*(x*(-7235.0L/41472.0L*x + 596887.0L/684288.0L) - 3312943.0L/1900800.0L) + 412961.0L/237600.0L) - 29538071.0L/34214400.0L) + 6793517.0L/39916800.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((36175.0L/20736.0L)*x - 74611.0L/9504.0L) + 2208637.0L/158400.0L) - 2890699.0L/237600.0L) + 5907001.0L/1140480.0L) - 3433.0L/4032.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-16459627.0L/725760.0L*x + 24689461.0L/241920.0L) - 43068409.0L/237600.0L) + 278363.0L/1760.0L) - 383954369.0L/5702400.0L) + 17675923.0L/1596672.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((24689443.0L/181440.0L)*x - 3394801.0L/5544.0L) + 301478693.0L/277200.0L) - 56368357.0L/59400.0L) + 38395529.0L/95040.0L) - 690638.0L/10395.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(-18105593.0L/36288.0L*x + 27158407.0L/12096.0L) - 7178059.0L/1800.0L) + 18789413.0L/5400.0L) - 191980489.0L/129600.0L) + 2105623.0L/8640.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*((181055941.0L/145152.0L)*x - 67896011.0L/12096.0L) + 602956499.0L/60480.0L) - 37578791.0L/4320.0L) + 76794211.0L/20736.0L) - 2764627.0L/4536.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(-108633569.0L/48384.0L*x + 7759543.0L/768.0L) - 301478033.0L/16800.0L) + 12526269.0L/800.0L) - 76796659.0L/11520.0L) + 17696393.0L/16128.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*((59873.0L/20.0L)*x - 9699427.0L/720.0L) + 1794511.0L/75.0L) - 417543.0L/20.0L) + 5999921.0L/675.0L) - 1474523.0L/1008.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(-59873.0L/20.0L*x + 1939885.0L/144.0L) - 10767061.0L/450.0L) + 4697371.0L/225.0L) - 2400023.0L/270.0L) + 22110101.0L/15120.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*((108633569.0L/48384.0L)*x - 1697399.0L/168.0L) + 86136463.0L/4800.0L) - 112737253.0L/7200.0L) + 384008213.0L/57600.0L) - 22100089.0L/20160.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(-181055941.0L/145152.0L*x + 271583779.0L/48384.0L) - 100492529.0L/10080.0L) + 37579201.0L/4320.0L) - 76801705.0L/20736.0L) + 3272737.0L/5376.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*((18105593.0L/36288.0L)*x - 6789593.0L/3024.0L) + 43068229.0L/10800.0L) - 695913.0L/200.0L) + 7680115.0L/5184.0L) - 315497.0L/1296.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(-24689443.0L/181440.0L*x + 135791833.0L/221760.0L) - 150738829.0L/138600.0L) + 11273813.0L/11880.0L) - 192000847.0L/475200.0L) + 802967.0L/12096.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*((16459627.0L/725760.0L)*x - 176353.0L/1728.0L) + 200985157.0L/1108800.0L) - 37579423.0L/237600.0L) + 76799599.0L/1140480.0L) - 3679981.0L/332640.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 4)*(x*(x*(x*(x*(-36175.0L/20736.0L*x + 596887.0L/76032.0L) - 3312943.0L/237600.0L) + 2890727.0L/237600.0L) - 29538071.0L/5702400.0L) + 6793517.0L/7983360.0L);
-break;
-}
-}
-void beta_n6_m6(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1006447.0L/17740800.0L*x + 176631449.0L/479001600.0L) - 108089.0L/107520.0L) + 12827359.0L/8709120.0L) - 53326271.0L/43545600.0L) + 318527.0L/580608.0L) - 644497.0L/6220800.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/17740800.0L)*x - 574052209.0L/119750400.0L) + 695552713.0L/53222400.0L) - 104222291.0L/5443200.0L) + 693241553.0L/43545600.0L) - 25880341.0L/3628800.0L) + 8378479.0L/6220800.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/2956800.0L*x + 51026863.0L/1774080.0L) - 6259974401.0L/79833600.0L) + 33351133.0L/290304.0L) - 693241613.0L/7257600.0L) + 103521473.0L/2419200.0L) - 1675691.0L/207360.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/806400.0L)*x - 1148104417.0L/10886400.0L) + 2086658129.0L/7257600.0L) - 458578079.0L/1088640.0L) + 7625658583.0L/21772800.0L) - 569368571.0L/3628800.0L) + 92161379.0L/3110400.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/322560.0L*x + 2296208833.0L/8709120.0L) - 417331625.0L/580608.0L) + 9171561617.0L/8709120.0L) - 7625659477.0L/8709120.0L) + 1138737557.0L/2903040.0L) - 92158499.0L/1244160.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/179200.0L)*x - 11959421.0L/25200.0L) + 1251994873.0L/967680.0L) - 114644521.0L/60480.0L) + 7625660323.0L/4838400.0L) - 4744739.0L/6720.0L) + 92155001.0L/691200.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-13083811.0L/134400.0L*x + 328029833.0L/518400.0L) - 298094017.0L/172800.0L) + 1310223109.0L/518400.0L) - 1089380149.0L/518400.0L) + 162676657.0L/172800.0L) - 645061703.0L/3628800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/134400.0L)*x - 229620883.0L/362880.0L) + 2086658117.0L/1209600.0L) - 458578093.0L/181440.0L) + 7625661583.0L/3628800.0L) - 569367709.0L/604800.0L) + 3685967.0L/20736.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/179200.0L*x + 765402943.0L/1612800.0L) - 6259974347.0L/4838400.0L) + 1834312393.0L/967680.0L) - 7625661913.0L/4838400.0L) + 1138734017.0L/1612800.0L) - 92147879.0L/691200.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/322560.0L)*x - 574052207.0L/2177280.0L) + 139110541.0L/193536.0L) - 1146445259.0L/1088640.0L) + 7625662027.0L/8709120.0L) - 284683153.0L/725760.0L) + 92147789.0L/1244160.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/806400.0L*x + 2296208827.0L/21772800.0L) - 139110541.0L/483840.0L) + 366862487.0L/870912.0L) - 7625661943.0L/21772800.0L) + 227746279.0L/1451520.0L) - 92148581.0L/3110400.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13083811.0L/2956800.0L)*x - 127567157.0L/4435200.0L) + 569088577.0L/7257600.0L) - 208444597.0L/1814400.0L) + 693241973.0L/7257600.0L) - 51760477.0L/1209600.0L) + 8377249.0L/1036800.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/17740800.0L*x + 91848353.0L/19160064.0L) - 2086658117.0L/159667200.0L) + 166755679.0L/8709120.0L) - 693241943.0L/43545600.0L) + 103520903.0L/14515200.0L) - 1675469.0L/1244160.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 7)*(x*(x*(x*(x*(x*((1006447.0L/17740800.0L)*x - 3154133.0L/8553600.0L) + 22930309.0L/22809600.0L) - 11453.0L/7776.0L) + 7618043.0L/6220800.0L) - 142199.0L/259200.0L) + 4510921.0L/43545600.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/17740800.0L*x + 176631449.0L/39916800.0L) - 1188979.0L/107520.0L) + 12827359.0L/870912.0L) - 53326271.0L/4838400.0L) + 318527.0L/72576.0L) - 4511479.0L/6220800.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/17740800.0L)*x - 574052209.0L/9979200.0L) + 695552713.0L/4838400.0L) - 104222291.0L/544320.0L) + 693241553.0L/4838400.0L) - 25880341.0L/453600.0L) + 58649353.0L/6220800.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/2956800.0L*x + 51026863.0L/147840.0L) - 6259974401.0L/7257600.0L) + 166755665.0L/145152.0L) - 693241613.0L/806400.0L) + 103521473.0L/302400.0L) - 11729837.0L/207360.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/806400.0L)*x - 1148104417.0L/907200.0L) + 22953239419.0L/7257600.0L) - 458578079.0L/108864.0L) + 7625658583.0L/2419200.0L) - 569368571.0L/453600.0L) + 645129653.0L/3110400.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/322560.0L*x + 2296208833.0L/725760.0L) - 4590647875.0L/580608.0L) + 9171561617.0L/870912.0L) - 7625659477.0L/967680.0L) + 1138737557.0L/362880.0L) - 645109493.0L/1244160.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/179200.0L)*x - 11959421.0L/2100.0L) + 13771943603.0L/967680.0L) - 114644521.0L/6048.0L) + 7625660323.0L/537600.0L) - 4744739.0L/840.0L) + 645085007.0L/691200.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-170089543.0L/134400.0L*x + 328029833.0L/43200.0L) - 3279034187.0L/172800.0L) + 1310223109.0L/51840.0L) - 1089380149.0L/57600.0L) + 162676657.0L/21600.0L) - 645061703.0L/518400.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/134400.0L)*x - 229620883.0L/30240.0L) + 22953239287.0L/1209600.0L) - 458578093.0L/18144.0L) + 7625661583.0L/403200.0L) - 569367709.0L/75600.0L) + 25801769.0L/20736.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/179200.0L*x + 765402943.0L/134400.0L) - 68859717817.0L/4838400.0L) + 1834312393.0L/96768.0L) - 7625661913.0L/537600.0L) + 1138734017.0L/201600.0L) - 645035153.0L/691200.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/322560.0L)*x - 574052207.0L/181440.0L) + 1530215951.0L/193536.0L) - 1146445259.0L/108864.0L) + 7625662027.0L/967680.0L) - 284683153.0L/90720.0L) + 645034523.0L/1244160.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/806400.0L*x + 2296208827.0L/1814400.0L) - 1530215951.0L/483840.0L) + 1834312435.0L/435456.0L) - 7625661943.0L/2419200.0L) + 227746279.0L/181440.0L) - 645040067.0L/3110400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/2956800.0L)*x - 127567157.0L/369600.0L) + 6259974347.0L/7257600.0L) - 208444597.0L/181440.0L) + 693241973.0L/806400.0L) - 51760477.0L/151200.0L) + 58640743.0L/1036800.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/17740800.0L*x + 91848353.0L/1596672.0L) - 2086658117.0L/14515200.0L) + 166755679.0L/870912.0L) - 693241943.0L/4838400.0L) + 103520903.0L/1814400.0L) - 11728283.0L/1244160.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 6)*(x*(x*(x*(x*(x*((13083811.0L/17740800.0L)*x - 3154133.0L/712800.0L) + 22930309.0L/2073600.0L) - 57265.0L/3888.0L) + 7618043.0L/691200.0L) - 142199.0L/32400.0L) + 4510921.0L/6220800.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13083811.0L/1478400.0L*x + 176631449.0L/3628800.0L) - 1188979.0L/10752.0L) + 12827359.0L/96768.0L) - 53326271.0L/604800.0L) + 318527.0L/10368.0L) - 4511479.0L/1036800.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/1478400.0L)*x - 574052209.0L/907200.0L) + 695552713.0L/483840.0L) - 104222291.0L/60480.0L) + 693241553.0L/604800.0L) - 25880341.0L/64800.0L) + 58649353.0L/1036800.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/246400.0L*x + 51026863.0L/13440.0L) - 6259974401.0L/725760.0L) + 166755665.0L/16128.0L) - 693241613.0L/100800.0L) + 103521473.0L/43200.0L) - 11729837.0L/34560.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/67200.0L)*x - 12629148587.0L/907200.0L) + 22953239419.0L/725760.0L) - 458578079.0L/12096.0L) + 7625658583.0L/302400.0L) - 569368571.0L/64800.0L) + 645129653.0L/518400.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/26880.0L*x + 25258297163.0L/725760.0L) - 22953239375.0L/290304.0L) + 9171561617.0L/96768.0L) - 7625659477.0L/120960.0L) + 1138737557.0L/51840.0L) - 645109493.0L/207360.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((510268629.0L/44800.0L)*x - 131553631.0L/2100.0L) + 13771943603.0L/96768.0L) - 114644521.0L/672.0L) + 7625660323.0L/67200.0L) - 4744739.0L/120.0L) + 645085007.0L/115200.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(-170089543.0L/11200.0L*x + 3608328163.0L/43200.0L) - 3279034187.0L/17280.0L) + 1310223109.0L/5760.0L) - 1089380149.0L/7200.0L) + 1138736599.0L/21600.0L) - 645061703.0L/86400.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/11200.0L)*x - 2525829713.0L/30240.0L) + 22953239287.0L/120960.0L) - 458578093.0L/2016.0L) + 7625661583.0L/50400.0L) - 569367709.0L/10800.0L) + 25801769.0L/3456.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-510268629.0L/44800.0L*x + 8419432373.0L/134400.0L) - 68859717817.0L/483840.0L) + 1834312393.0L/10752.0L) - 7625661913.0L/67200.0L) + 1138734017.0L/28800.0L) - 645035153.0L/115200.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/26880.0L)*x - 6314574277.0L/181440.0L) + 7651079755.0L/96768.0L) - 1146445259.0L/12096.0L) + 7625662027.0L/120960.0L) - 284683153.0L/12960.0L) + 645034523.0L/207360.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/67200.0L*x + 25258297097.0L/1814400.0L) - 1530215951.0L/48384.0L) + 1834312435.0L/48384.0L) - 7625661943.0L/302400.0L) + 227746279.0L/25920.0L) - 645040067.0L/518400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((170089543.0L/246400.0L)*x - 127567157.0L/33600.0L) + 6259974347.0L/725760.0L) - 208444597.0L/20160.0L) + 693241973.0L/100800.0L) - 51760477.0L/21600.0L) + 58640743.0L/172800.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-170089543.0L/1478400.0L*x + 91848353.0L/145152.0L) - 2086658117.0L/1451520.0L) + 166755679.0L/96768.0L) - 693241943.0L/604800.0L) + 103520903.0L/259200.0L) - 11728283.0L/207360.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 5)*(x*(x*(x*(x*(x*((13083811.0L/1478400.0L)*x - 3154133.0L/64800.0L) + 22930309.0L/207360.0L) - 57265.0L/432.0L) + 7618043.0L/86400.0L) - 995393.0L/32400.0L) + 4510921.0L/1036800.0L);
-break;
-}
+#include "beta_polynomials.hpp"
+
+template <>
+struct spline_polynomials<6, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, -1.0, 1.0,
+         0, 0, 0, 0,
+         0, 0},
+        {0, 0, 0, 0,
+         0, 0, 0.5, 0.5,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<6, 0, 0>::coefficients[2][14];
+
+template <>
+struct spline_polynomials<6, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, -1.0, 1.0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<6, 0, 1>::coefficients[1][14];
+
+template <>
+struct spline_polynomials<6, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<6, 0, 2>::coefficients[1][14];
+
+template <class real_number>
+void beta_n6_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 0, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 0, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 0, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m7(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((4510921.0L/21772800.0L)*x - 4510921.0L/2903040.0L) + 48084247.0L/9580032.0L) - 180783353.0L/19958400.0L) + 7164511.0L/725760.0L) - 47200687.0L/7257600.0L) + 8712997.0L/3628800.0L) - 1392397.0L/3628800.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/21772800.0L*x + 58641973.0L/2903040.0L) - 625095211.0L/9580032.0L) + 56404406137.0L/479001600.0L) - 10245250733.0L/79833600.0L) + 3681653593.0L/43545600.0L) - 75512639.0L/2419200.0L) + 14480911.0L/2903040.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/3628800.0L)*x - 58641973.0L/483840.0L) + 625095211.0L/1596672.0L) - 28202203069.0L/39916800.0L) + 30735752207.0L/39916800.0L) - 920413399.0L/1814400.0L) + 226537907.0L/1209600.0L) - 36202223.0L/1209600.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/10886400.0L*x + 645061703.0L/1451520.0L) - 625095211.0L/435456.0L) + 18801468713.0L/7257600.0L) - 5122625369.0L/1814400.0L) + 4499798839.0L/2419200.0L) - 2491916837.0L/3628800.0L) + 113778281.0L/1036800.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/4354560.0L)*x - 645061703.0L/580608.0L) + 3125476055.0L/870912.0L) - 2820220307.0L/435456.0L) + 170754179.0L/24192.0L) - 20249094757.0L/4354560.0L) + 17304977.0L/10080.0L) - 12444493.0L/45360.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/2419200.0L*x + 645061703.0L/322560.0L) - 625095211.0L/96768.0L) + 56404406141.0L/4838400.0L) - 1229430089.0L/96768.0L) + 40498189451.0L/4838400.0L) - 830638849.0L/268800.0L) + 265482583.0L/537600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((645061703.0L/1814400.0L)*x - 645061703.0L/241920.0L) + 625095211.0L/72576.0L) - 447654017.0L/28800.0L) + 487869083.0L/28800.0L) - 241060651.0L/21600.0L) + 13184743.0L/3200.0L) - 79644851.0L/120960.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/1814400.0L*x + 645061703.0L/241920.0L) - 625095211.0L/72576.0L) + 56404406143.0L/3628800.0L) - 1280656343.0L/75600.0L) + 40498189271.0L/3628800.0L) - 276879593.0L/67200.0L) + 796449691.0L/1209600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/2419200.0L)*x - 645061703.0L/322560.0L) + 625095211.0L/96768.0L) - 440659423.0L/37800.0L) + 15367876117.0L/1209600.0L) - 20249094583.0L/2419200.0L) + 1245958141.0L/403200.0L) - 199112773.0L/403200.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/4354560.0L*x + 645061703.0L/580608.0L) - 3125476055.0L/870912.0L) + 3760293743.0L/580608.0L) - 2049050149.0L/290304.0L) + 13499396353.0L/2903040.0L) - 2491916263.0L/1451520.0L) + 796452497.0L/2903040.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/10886400.0L)*x - 645061703.0L/1451520.0L) + 625095211.0L/435456.0L) - 28202203073.0L/10886400.0L) + 2049050149.0L/725760.0L) - 10124547239.0L/5443200.0L) + 830638759.0L/1209600.0L) - 56889551.0L/518400.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/3628800.0L*x + 58641973.0L/483840.0L) - 625095211.0L/1596672.0L) + 56404406147.0L/79833600.0L) - 1397079647.0L/1814400.0L) + 3681653533.0L/7257600.0L) - 226537847.0L/1209600.0L) + 14480993.0L/483840.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/21772800.0L)*x - 58641973.0L/2903040.0L) + 625095211.0L/9580032.0L) - 4700367179.0L/39916800.0L) + 1280656343.0L/9979200.0L) - 68178769.0L/806400.0L) + 56634463.0L/1814400.0L) - 9050627.0L/1814400.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(-4510921.0L/21772800.0L*x + 4510921.0L/2903040.0L) - 48084247.0L/9580032.0L) + 619828639.0L/68428800.0L) - 37528391.0L/3801600.0L) + 40457731.0L/6220800.0L) - 92201.0L/38400.0L) + 5569619.0L/14515200.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((4510921.0L/1451520.0L)*x - 4510921.0L/207360.0L) + 625095211.0L/9580032.0L) - 180783353.0L/1663200.0L) + 78809621.0L/725760.0L) - 47200687.0L/725760.0L) + 8712997.0L/403200.0L) - 1392397.0L/453600.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/1451520.0L*x + 58641973.0L/207360.0L) - 8126237743.0L/9580032.0L) + 56404406137.0L/39916800.0L) - 10245250733.0L/7257600.0L) + 3681653593.0L/4354560.0L) - 75512639.0L/268800.0L) + 14480911.0L/362880.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/241920.0L)*x - 58641973.0L/34560.0L) + 8126237743.0L/1596672.0L) - 28202203069.0L/3326400.0L) + 30735752207.0L/3628800.0L) - 920413399.0L/181440.0L) + 226537907.0L/134400.0L) - 36202223.0L/151200.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/725760.0L*x + 645061703.0L/103680.0L) - 8126237743.0L/435456.0L) + 18801468713.0L/604800.0L) - 56348879059.0L/1814400.0L) + 4499798839.0L/241920.0L) - 2491916837.0L/403200.0L) + 113778281.0L/129600.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/290304.0L)*x - 645061703.0L/41472.0L) + 40631188715.0L/870912.0L) - 2820220307.0L/36288.0L) + 1878295969.0L/24192.0L) - 20249094757.0L/435456.0L) + 17304977.0L/1120.0L) - 12444493.0L/5670.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/161280.0L*x + 645061703.0L/23040.0L) - 8126237743.0L/96768.0L) + 56404406141.0L/403200.0L) - 13523730979.0L/96768.0L) + 40498189451.0L/483840.0L) - 2491916547.0L/89600.0L) + 265482583.0L/67200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((645061703.0L/120960.0L)*x - 645061703.0L/17280.0L) + 8126237743.0L/72576.0L) - 447654017.0L/2400.0L) + 5366559913.0L/28800.0L) - 241060651.0L/2160.0L) + 118662687.0L/3200.0L) - 79644851.0L/15120.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/120960.0L*x + 645061703.0L/17280.0L) - 8126237743.0L/72576.0L) + 56404406143.0L/302400.0L) - 14087219773.0L/75600.0L) + 40498189271.0L/362880.0L) - 830638779.0L/22400.0L) + 796449691.0L/151200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/161280.0L)*x - 645061703.0L/23040.0L) + 8126237743.0L/96768.0L) - 440659423.0L/3150.0L) + 169046637287.0L/1209600.0L) - 20249094583.0L/241920.0L) + 1245958141.0L/44800.0L) - 199112773.0L/50400.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/290304.0L*x + 645061703.0L/41472.0L) - 40631188715.0L/870912.0L) + 3760293743.0L/48384.0L) - 22539551639.0L/290304.0L) + 13499396353.0L/290304.0L) - 2491916263.0L/161280.0L) + 796452497.0L/362880.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/725760.0L)*x - 645061703.0L/103680.0L) + 8126237743.0L/435456.0L) - 28202203073.0L/907200.0L) + 22539551639.0L/725760.0L) - 10124547239.0L/544320.0L) + 830638759.0L/134400.0L) - 56889551.0L/64800.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/241920.0L*x + 58641973.0L/34560.0L) - 8126237743.0L/1596672.0L) + 56404406147.0L/6652800.0L) - 15367876117.0L/1814400.0L) + 3681653533.0L/725760.0L) - 226537847.0L/134400.0L) + 14480993.0L/60480.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/1451520.0L)*x - 58641973.0L/207360.0L) + 8126237743.0L/9580032.0L) - 4700367179.0L/3326400.0L) + 1280656343.0L/907200.0L) - 68178769.0L/80640.0L) + 56634463.0L/201600.0L) - 9050627.0L/226800.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 7)*(x*(x*(x*(x*(x*(x*(-4510921.0L/1451520.0L*x + 4510921.0L/207360.0L) - 625095211.0L/9580032.0L) + 619828639.0L/5702400.0L) - 37528391.0L/345600.0L) + 40457731.0L/622080.0L) - 276603.0L/12800.0L) + 5569619.0L/1814400.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((4510921.0L/103680.0L)*x - 58641973.0L/207360.0L) + 625095211.0L/798336.0L) - 180783353.0L/151200.0L) + 78809621.0L/72576.0L) - 47200687.0L/80640.0L) + 8712997.0L/50400.0L) - 1392397.0L/64800.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/103680.0L*x + 762345649.0L/207360.0L) - 8126237743.0L/798336.0L) + 56404406137.0L/3628800.0L) - 10245250733.0L/725760.0L) + 3681653593.0L/483840.0L) - 75512639.0L/33600.0L) + 14480911.0L/51840.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/17280.0L)*x - 762345649.0L/34560.0L) + 8126237743.0L/133056.0L) - 28202203069.0L/302400.0L) + 30735752207.0L/362880.0L) - 920413399.0L/20160.0L) + 226537907.0L/16800.0L) - 36202223.0L/21600.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/51840.0L*x + 8385802139.0L/103680.0L) - 8126237743.0L/36288.0L) + 206816155843.0L/604800.0L) - 56348879059.0L/181440.0L) + 4499798839.0L/26880.0L) - 2491916837.0L/50400.0L) + 796447967.0L/129600.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/20736.0L)*x - 8385802139.0L/41472.0L) + 40631188715.0L/72576.0L) - 31022423377.0L/36288.0L) + 9391479845.0L/12096.0L) - 20249094757.0L/48384.0L) + 17304977.0L/140.0L) - 12444493.0L/810.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/11520.0L*x + 8385802139.0L/23040.0L) - 8126237743.0L/8064.0L) + 620448467551.0L/403200.0L) - 67618654895.0L/48384.0L) + 40498189451.0L/53760.0L) - 2491916547.0L/11200.0L) + 265482583.0L/9600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*((645061703.0L/8640.0L)*x - 8385802139.0L/17280.0L) + 8126237743.0L/6048.0L) - 4924194187.0L/2400.0L) + 5366559913.0L/2880.0L) - 241060651.0L/240.0L) + 118662687.0L/400.0L) - 79644851.0L/2160.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/8640.0L*x + 8385802139.0L/17280.0L) - 8126237743.0L/6048.0L) + 620448467573.0L/302400.0L) - 14087219773.0L/7560.0L) + 40498189271.0L/40320.0L) - 830638779.0L/2800.0L) + 796449691.0L/21600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/11520.0L)*x - 8385802139.0L/23040.0L) + 8126237743.0L/8064.0L) - 4847253653.0L/3150.0L) + 169046637287.0L/120960.0L) - 20249094583.0L/26880.0L) + 1245958141.0L/5600.0L) - 199112773.0L/7200.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-645061703.0L/20736.0L*x + 8385802139.0L/41472.0L) - 40631188715.0L/72576.0L) + 41363231173.0L/48384.0L) - 112697758195.0L/145152.0L) + 13499396353.0L/32256.0L) - 2491916263.0L/20160.0L) + 796452497.0L/51840.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((645061703.0L/51840.0L)*x - 8385802139.0L/103680.0L) + 8126237743.0L/36288.0L) - 310224233803.0L/907200.0L) + 22539551639.0L/72576.0L) - 10124547239.0L/60480.0L) + 830638759.0L/16800.0L) - 398226857.0L/64800.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58641973.0L/17280.0L*x + 762345649.0L/34560.0L) - 8126237743.0L/133056.0L) + 56404406147.0L/604800.0L) - 15367876117.0L/181440.0L) + 3681653533.0L/80640.0L) - 226537847.0L/16800.0L) + 14480993.0L/8640.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58641973.0L/103680.0L)*x - 762345649.0L/207360.0L) + 8126237743.0L/798336.0L) - 4700367179.0L/302400.0L) + 1280656343.0L/90720.0L) - 68178769.0L/8960.0L) + 56634463.0L/25200.0L) - 9050627.0L/32400.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 6)*(x*(x*(x*(x*(x*(x*(-4510921.0L/103680.0L*x + 58641973.0L/207360.0L) - 625095211.0L/798336.0L) + 619828639.0L/518400.0L) - 37528391.0L/34560.0L) + 40457731.0L/69120.0L) - 276603.0L/1600.0L) + 5569619.0L/259200.0L);
-break;
+
+template void beta_n6_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.00018037518037518038, -0.002417027417027417, 0.01525974025974026, -0.061507936507936505,
+         0.1884920634920635, -0.5892857142857143, 1.1428571428571428, -1.1428571428571428,
+         0.5892857142857143, -0.1884920634920635, 0.061507936507936505, -0.01525974025974026,
+         0.002417027417027417, -0.00018037518037518038},
+        {-9.018759018759019e-05, 0.001388888888888889, -0.010227272727272727, 0.04861111111111111,
+         -0.1736111111111111, 0.5625, -0.42857142857142855, -0.42857142857142855,
+         0.5625, -0.1736111111111111, 0.04861111111111111, -0.010227272727272727,
+         0.001388888888888889, -9.018759018759019e-05},
+        {-4.5093795093795094e-05, 0.0006042568542568542, -0.003814935064935065, 0.015376984126984126,
+         -0.04712301587301587, 0.14732142857142858, -1.2857142857142858, 1.2857142857142858,
+         -0.14732142857142858, 0.04712301587301587, -0.015376984126984126, 0.003814935064935065,
+         -0.0006042568542568542, 4.5093795093795094e-05},
+        {2.2546897546897547e-05, -0.00034722222222222224, 0.002556818181818182, -0.012152777777777778,
+         0.043402777777777776, -0.140625, 0.6071428571428571, 0.6071428571428571,
+         -0.140625, 0.043402777777777776, -0.012152777777777778, 0.002556818181818182,
+         -0.00034722222222222224, 2.2546897546897547e-05}};
+};
+constexpr double spline_polynomials<6, 1, 0>::coefficients[4][14];
+
+template <>
+struct spline_polynomials<6, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0005411255411255411, -0.007251082251082251, 0.04577922077922078, -0.18452380952380953,
+         0.5654761904761905, -1.7678571428571428, 3.4285714285714284, -3.4285714285714284,
+         1.7678571428571428, -0.5654761904761905, 0.18452380952380953, -0.04577922077922078,
+         0.007251082251082251, -0.0005411255411255411},
+        {-0.00018037518037518038, 0.002777777777777778, -0.020454545454545454, 0.09722222222222222,
+         -0.3472222222222222, 1.125, -0.8571428571428571, -0.8571428571428571,
+         1.125, -0.3472222222222222, 0.09722222222222222, -0.020454545454545454,
+         0.002777777777777778, -0.00018037518037518038},
+        {-4.5093795093795094e-05, 0.0006042568542568542, -0.003814935064935065, 0.015376984126984126,
+         -0.04712301587301587, 0.14732142857142858, -1.2857142857142858, 1.2857142857142858,
+         -0.14732142857142858, 0.04712301587301587, -0.015376984126984126, 0.003814935064935065,
+         -0.0006042568542568542, 4.5093795093795094e-05}};
+};
+constexpr double spline_polynomials<6, 1, 1>::coefficients[3][14];
+
+template <>
+struct spline_polynomials<6, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0010822510822510823, -0.014502164502164502, 0.09155844155844156, -0.36904761904761907,
+         1.130952380952381, -3.5357142857142856, 6.857142857142857, -6.857142857142857,
+         3.5357142857142856, -1.130952380952381, 0.36904761904761907, -0.09155844155844156,
+         0.014502164502164502, -0.0010822510822510823},
+        {-0.00018037518037518038, 0.002777777777777778, -0.020454545454545454, 0.09722222222222222,
+         -0.3472222222222222, 1.125, -0.8571428571428571, -0.8571428571428571,
+         1.125, -0.3472222222222222, 0.09722222222222222, -0.020454545454545454,
+         0.002777777777777778, -0.00018037518037518038}};
+};
+constexpr double spline_polynomials<6, 1, 2>::coefficients[2][14];
+
+template <class real_number>
+void beta_n6_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 1, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 1, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 1, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.000511063011063011, 0.006701539201539201, -0.040795454545454544, 0.15360449735449735,
+         -0.4050925925925926, 0.7767857142857143, -1.0800396825396825, 1.0800396825396825,
+         -0.7767857142857143, 0.4050925925925926, -0.15360449735449735, 0.040795454545454544,
+         -0.006701539201539201, 0.000511063011063011},
+        {7.515632515632516e-05, -0.0011441798941798941, 0.00825487012987013, -0.03761574074074074,
+         0.11987433862433862, -0.20089285714285715, 0.1114484126984127, 0.1114484126984127,
+         -0.20089285714285715, 0.11987433862433862, -0.03761574074074074, 0.00825487012987013,
+         -0.0011441798941798941, 7.515632515632516e-05},
+        {0.0004359066859066859, -0.005767797017797018, 0.035657467532467534, -0.13831018518518517,
+         0.39103835978835977, -0.9776785714285714, 1.6828769841269842, -1.6828769841269842,
+         0.9776785714285714, -0.39103835978835977, 0.13831018518518517, -0.035657467532467534,
+         0.005767797017797018, -0.0004359066859066859},
+        {-0.00012776575276575276, 0.001960978835978836, -0.014354707792207792, 0.06741898148148148,
+         -0.23354828042328044, 0.6629464285714286, -0.48429563492063493, -0.48429563492063493,
+         0.6629464285714286, -0.23354828042328044, 0.06741898148148148, -0.014354707792207792,
+         0.001960978835978836, -0.00012776575276575276},
+        {-7.703523328523329e-05, 0.0010231030543530544, -0.006364650974025974, 0.02497726521164021,
+         -0.07244130291005291, 0.19587053571428573, -1.3532167658730159, 1.3532167658730159,
+         -0.19587053571428573, 0.07244130291005291, -0.02497726521164021, 0.006364650974025974,
+         -0.0010231030543530544, 7.703523328523329e-05},
+        {2.724416786916787e-05, -0.0004187334656084656, 0.003072747564935065, -0.014503761574074073,
+         0.05089492394179894, -0.15318080357142858, 0.6141083829365079, 0.6141083829365079,
+         -0.15318080357142858, 0.05089492394179894, -0.014503761574074073, 0.003072747564935065,
+         -0.0004187334656084656, 2.724416786916787e-05}};
+};
+constexpr double spline_polynomials<6, 2, 0>::coefficients[6][14];
+
+template <>
+struct spline_polynomials<6, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0025553150553150553, 0.03350769600769601, -0.20397727272727273, 0.7680224867724867,
+         -2.025462962962963, 3.8839285714285716, -5.400198412698413, 5.400198412698413,
+         -3.8839285714285716, 2.025462962962963, -0.7680224867724867, 0.20397727272727273,
+         -0.03350769600769601, 0.0025553150553150553},
+        {0.00030062530062530064, -0.0045767195767195765, 0.03301948051948052, -0.15046296296296297,
+         0.4794973544973545, -0.8035714285714286, 0.4457936507936508, 0.4457936507936508,
+         -0.8035714285714286, 0.4794973544973545, -0.15046296296296297, 0.03301948051948052,
+         -0.0045767195767195765, 0.00030062530062530064},
+        {0.0013077200577200577, -0.017303391053391053, 0.1069724025974026, -0.4149305555555556,
+         1.1731150793650793, -2.9330357142857144, 5.048630952380952, -5.048630952380952,
+         2.9330357142857144, -1.1731150793650793, 0.4149305555555556, -0.1069724025974026,
+         0.017303391053391053, -0.0013077200577200577},
+        {-0.0002555315055315055, 0.003921957671957672, -0.028709415584415584, 0.13483796296296297,
+         -0.46709656084656087, 1.3258928571428572, -0.9685912698412699, -0.9685912698412699,
+         1.3258928571428572, -0.46709656084656087, 0.13483796296296297, -0.028709415584415584,
+         0.003921957671957672, -0.0002555315055315055},
+        {-7.703523328523329e-05, 0.0010231030543530544, -0.006364650974025974, 0.02497726521164021,
+         -0.07244130291005291, 0.19587053571428573, -1.3532167658730159, 1.3532167658730159,
+         -0.19587053571428573, 0.07244130291005291, -0.02497726521164021, 0.006364650974025974,
+         -0.0010231030543530544, 7.703523328523329e-05}};
+};
+constexpr double spline_polynomials<6, 2, 1>::coefficients[5][14];
+
+template <>
+struct spline_polynomials<6, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.010221260221260221, 0.13403078403078403, -0.8159090909090909, 3.072089947089947,
+         -8.101851851851851, 15.535714285714286, -21.60079365079365, 21.60079365079365,
+         -15.535714285714286, 8.101851851851851, -3.072089947089947, 0.8159090909090909,
+         -0.13403078403078403, 0.010221260221260221},
+        {0.0009018759018759019, -0.01373015873015873, 0.09905844155844155, -0.4513888888888889,
+         1.4384920634920635, -2.4107142857142856, 1.3373809523809523, 1.3373809523809523,
+         -2.4107142857142856, 1.4384920634920635, -0.4513888888888889, 0.09905844155844155,
+         -0.01373015873015873, 0.0009018759018759019},
+        {0.0026154401154401155, -0.03460678210678211, 0.2139448051948052, -0.8298611111111112,
+         2.3462301587301586, -5.866071428571429, 10.097261904761904, -10.097261904761904,
+         5.866071428571429, -2.3462301587301586, 0.8298611111111112, -0.2139448051948052,
+         0.03460678210678211, -0.0026154401154401155},
+        {-0.0002555315055315055, 0.003921957671957672, -0.028709415584415584, 0.13483796296296297,
+         -0.46709656084656087, 1.3258928571428572, -0.9685912698412699, -0.9685912698412699,
+         1.3258928571428572, -0.46709656084656087, 0.13483796296296297, -0.028709415584415584,
+         0.003921957671957672, -0.0002555315055315055}};
+};
+constexpr double spline_polynomials<6, 2, 2>::coefficients[4][14];
+
+template <class real_number>
+void beta_n6_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 2, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 2, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 2, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m8(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-5569619.0L/7257600.0L*x + 94683523.0L/14515200.0L) - 75738929.0L/3110400.0L) + 151438411.0L/2903040.0L) - 16810041671.0L/239500800.0L) + 4852055207.0L/79833600.0L) - 40042259.0L/1209600.0L) + 75330931.0L/7257600.0L) - 10422101.0L/7257600.0L) + 31.0L/14515200.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((72405047.0L/7257600.0L)*x - 1230885799.0L/14515200.0L) + 984606077.0L/3110400.0L) - 1968699343.0L/2903040.0L) + 218530541723.0L/239500800.0L) - 75692061229.0L/95800320.0L) + 11452086073.0L/26611200.0L) - 5875812611.0L/43545600.0L) + 67743659.0L/3628800.0L) - 41.0L/1209600.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-72405047.0L/1209600.0L*x + 1230885799.0L/2419200.0L) - 984606077.0L/518400.0L) + 1968699343.0L/483840.0L) - 218530541723.0L/39916800.0L) + 11826884567.0L/2494800.0L) - 103068774649.0L/39916800.0L) + 22952393.0L/28350.0L) - 4233979.0L/37800.0L) + 601.0L/2419200.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((796455517.0L/3628800.0L)*x - 13539743789.0L/7257600.0L) + 10830666847.0L/1555200.0L) - 21655692773.0L/1451520.0L) + 218530541723.0L/10886400.0L) - 42051145127.0L/2419200.0L) + 17178129107.0L/1814400.0L) - 21544646231.0L/7257600.0L) + 124196729.0L/302400.0L) - 151.0L/145152.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-796455517.0L/1451520.0L*x + 13539743789.0L/2903040.0L) - 10830666847.0L/622080.0L) + 21655692773.0L/580608.0L) - 218530541723.0L/4354560.0L) + 189230153071.0L/4354560.0L) - 8589064553.0L/362880.0L) + 6463393873.0L/870912.0L) - 1490360897.0L/1451520.0L) + 59.0L/21504.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((796455517.0L/806400.0L)*x - 13539743789.0L/1612800.0L) + 10830666847.0L/345600.0L) - 21655692773.0L/322560.0L) + 218530541723.0L/2419200.0L) - 378460306141.0L/4838400.0L) + 103068774631.0L/2419200.0L) - 64633938793.0L/4838400.0L) + 745180519.0L/403200.0L) - 971.0L/201600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-796455517.0L/604800.0L*x + 13539743789.0L/1209600.0L) - 10830666847.0L/259200.0L) + 21655692773.0L/241920.0L) - 218530541723.0L/1814400.0L) + 901095967.0L/8640.0L) - 4908036887.0L/86400.0L) + 598462397.0L/33600.0L) - 745180579.0L/302400.0L) + 1001.0L/172800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((796455517.0L/604800.0L)*x - 13539743789.0L/1209600.0L) + 10830666847.0L/259200.0L) - 21655692773.0L/241920.0L) + 218530541723.0L/1814400.0L) - 378460306139.0L/3628800.0L) + 1073633069.0L/18900.0L) - 64633938973.0L/3628800.0L) + 46573789.0L/18900.0L) - 971.0L/201600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-796455517.0L/806400.0L*x + 13539743789.0L/1612800.0L) - 10830666847.0L/345600.0L) + 21655692773.0L/322560.0L) - 218530541723.0L/2419200.0L) + 189230153069.0L/2419200.0L) - 51534387311.0L/1209600.0L) + 32316969539.0L/2419200.0L) - 496787101.0L/268800.0L) + 59.0L/21504.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((796455517.0L/1451520.0L)*x - 13539743789.0L/2903040.0L) + 10830666847.0L/622080.0L) - 21655692773.0L/580608.0L) + 218530541723.0L/4354560.0L) - 126153435379.0L/2903040.0L) + 3817362023.0L/161280.0L) - 4308929279.0L/580608.0L) + 745180661.0L/725760.0L) - 151.0L/145152.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-796455517.0L/3628800.0L*x + 13539743789.0L/7257600.0L) - 10830666847.0L/1555200.0L) + 21655692773.0L/1451520.0L) - 218530541723.0L/10886400.0L) + 47307538267.0L/2721600.0L) - 3817362023.0L/403200.0L) + 8079242411.0L/2721600.0L) - 372590327.0L/907200.0L) + 601.0L/2419200.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((72405047.0L/1209600.0L)*x - 1230885799.0L/2419200.0L) + 984606077.0L/518400.0L) - 1968699343.0L/483840.0L) + 218530541723.0L/39916800.0L) - 75692061227.0L/15966720.0L) + 4684944301.0L/1814400.0L) - 5875812671.0L/7257600.0L) + 33871847.0L/302400.0L) - 41.0L/1209600.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-72405047.0L/7257600.0L*x + 1230885799.0L/14515200.0L) - 984606077.0L/3110400.0L) + 1968699343.0L/2903040.0L) - 218530541723.0L/239500800.0L) + 21025572563.0L/26611200.0L) - 1073633069.0L/2494800.0L) + 979302113.0L/7257600.0L) - 45162461.0L/2419200.0L) + 31.0L/14515200.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*((5569619.0L/7257600.0L)*x - 94683523.0L/14515200.0L) + 75738929.0L/3110400.0L) - 151438411.0L/2903040.0L) + 16810041671.0L/239500800.0L) - 4158904463.0L/68428800.0L) + 377541299.0L/11404800.0L) - 451985591.0L/43545600.0L) + 5211053.0L/3628800.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-94683523.0L/7257600.0L*x + 94683523.0L/907200.0L) - 75738929.0L/207360.0L) + 151438411.0L/207360.0L) - 218530541723.0L/239500800.0L) + 4852055207.0L/6652800.0L) - 440464849.0L/1209600.0L) + 75330931.0L/725760.0L) - 10422101.0L/806400.0L) + 31.0L/1814400.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1230885799.0L/7257600.0L)*x - 1230885799.0L/907200.0L) + 984606077.0L/207360.0L) - 1968699343.0L/207360.0L) + 2840897042399.0L/239500800.0L) - 75692061229.0L/7983360.0L) + 11452086073.0L/2419200.0L) - 5875812611.0L/4354560.0L) + 67743659.0L/403200.0L) - 41.0L/151200.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1230885799.0L/1209600.0L*x + 1230885799.0L/151200.0L) - 984606077.0L/34560.0L) + 1968699343.0L/34560.0L) - 2840897042399.0L/39916800.0L) + 11826884567.0L/207900.0L) - 103068774649.0L/3628800.0L) + 22952393.0L/2835.0L) - 4233979.0L/4200.0L) + 601.0L/302400.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/3628800.0L)*x - 13539743789.0L/453600.0L) + 10830666847.0L/103680.0L) - 21655692773.0L/103680.0L) + 2840897042399.0L/10886400.0L) - 42051145127.0L/201600.0L) + 188959420177.0L/1814400.0L) - 21544646231.0L/725760.0L) + 124196729.0L/33600.0L) - 151.0L/18144.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/1451520.0L*x + 13539743789.0L/181440.0L) - 10830666847.0L/41472.0L) + 21655692773.0L/41472.0L) - 2840897042399.0L/4354560.0L) + 189230153071.0L/362880.0L) - 94479710083.0L/362880.0L) + 32316969365.0L/435456.0L) - 1490360897.0L/161280.0L) + 59.0L/2688.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/806400.0L)*x - 13539743789.0L/100800.0L) + 10830666847.0L/23040.0L) - 21655692773.0L/23040.0L) + 2840897042399.0L/2419200.0L) - 378460306141.0L/403200.0L) + 1133756520941.0L/2419200.0L) - 64633938793.0L/483840.0L) + 745180519.0L/44800.0L) - 971.0L/25200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/604800.0L*x + 13539743789.0L/75600.0L) - 10830666847.0L/17280.0L) + 21655692773.0L/17280.0L) - 2840897042399.0L/1814400.0L) + 901095967.0L/720.0L) - 53988405757.0L/86400.0L) + 598462397.0L/3360.0L) - 745180579.0L/33600.0L) + 1001.0L/21600.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/604800.0L)*x - 13539743789.0L/75600.0L) + 10830666847.0L/17280.0L) - 21655692773.0L/17280.0L) + 2840897042399.0L/1814400.0L) - 378460306139.0L/302400.0L) + 11809963759.0L/18900.0L) - 64633938973.0L/362880.0L) + 46573789.0L/2100.0L) - 971.0L/25200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/806400.0L*x + 13539743789.0L/100800.0L) - 10830666847.0L/23040.0L) + 21655692773.0L/23040.0L) - 2840897042399.0L/2419200.0L) + 189230153069.0L/201600.0L) - 566878260421.0L/1209600.0L) + 32316969539.0L/241920.0L) - 1490361303.0L/89600.0L) + 59.0L/2688.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/1451520.0L)*x - 13539743789.0L/181440.0L) + 10830666847.0L/41472.0L) - 21655692773.0L/41472.0L) + 2840897042399.0L/4354560.0L) - 126153435379.0L/241920.0L) + 41990982253.0L/161280.0L) - 21544646395.0L/290304.0L) + 745180661.0L/80640.0L) - 151.0L/18144.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/3628800.0L*x + 13539743789.0L/453600.0L) - 10830666847.0L/103680.0L) + 21655692773.0L/103680.0L) - 2840897042399.0L/10886400.0L) + 47307538267.0L/226800.0L) - 41990982253.0L/403200.0L) + 8079242411.0L/272160.0L) - 372590327.0L/100800.0L) + 601.0L/302400.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1230885799.0L/1209600.0L)*x - 1230885799.0L/151200.0L) + 984606077.0L/34560.0L) - 1968699343.0L/34560.0L) + 2840897042399.0L/39916800.0L) - 75692061227.0L/1330560.0L) + 51534387311.0L/1814400.0L) - 5875812671.0L/725760.0L) + 33871847.0L/33600.0L) - 41.0L/151200.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1230885799.0L/7257600.0L*x + 1230885799.0L/907200.0L) - 984606077.0L/207360.0L) + 1968699343.0L/207360.0L) - 2840897042399.0L/239500800.0L) + 21025572563.0L/2217600.0L) - 1073633069.0L/226800.0L) + 979302113.0L/725760.0L) - 45162461.0L/268800.0L) + 31.0L/1814400.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(x*((94683523.0L/7257600.0L)*x - 94683523.0L/907200.0L) + 75738929.0L/207360.0L) - 151438411.0L/207360.0L) + 218530541723.0L/239500800.0L) - 4158904463.0L/5702400.0L) + 377541299.0L/1036800.0L) - 451985591.0L/4354560.0L) + 5211053.0L/403200.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-94683523.0L/453600.0L*x + 94683523.0L/60480.0L) - 530172503.0L/103680.0L) + 1968699343.0L/207360.0L) - 218530541723.0L/19958400.0L) + 4852055207.0L/604800.0L) - 440464849.0L/120960.0L) + 75330931.0L/80640.0L) - 10422101.0L/100800.0L) + 31.0L/259200.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1230885799.0L/453600.0L)*x - 1230885799.0L/60480.0L) + 6892242539.0L/103680.0L) - 25593091459.0L/207360.0L) + 2840897042399.0L/19958400.0L) - 75692061229.0L/725760.0L) + 11452086073.0L/241920.0L) - 5875812611.0L/483840.0L) + 67743659.0L/50400.0L) - 41.0L/21600.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1230885799.0L/75600.0L*x + 1230885799.0L/10080.0L) - 6892242539.0L/17280.0L) + 25593091459.0L/34560.0L) - 2840897042399.0L/3326400.0L) + 11826884567.0L/18900.0L) - 103068774649.0L/362880.0L) + 22952393.0L/315.0L) - 4233979.0L/525.0L) + 601.0L/43200.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/226800.0L)*x - 13539743789.0L/30240.0L) + 75814667929.0L/51840.0L) - 281524006049.0L/103680.0L) + 2840897042399.0L/907200.0L) - 462562596397.0L/201600.0L) + 188959420177.0L/181440.0L) - 21544646231.0L/80640.0L) + 124196729.0L/4200.0L) - 151.0L/2592.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/90720.0L*x + 13539743789.0L/12096.0L) - 75814667929.0L/20736.0L) + 281524006049.0L/41472.0L) - 2840897042399.0L/362880.0L) + 2081531683781.0L/362880.0L) - 94479710083.0L/36288.0L) + 32316969365.0L/48384.0L) - 1490360897.0L/20160.0L) + 59.0L/384.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/50400.0L)*x - 13539743789.0L/6720.0L) + 75814667929.0L/11520.0L) - 281524006049.0L/23040.0L) + 2840897042399.0L/201600.0L) - 4163063367551.0L/403200.0L) + 1133756520941.0L/241920.0L) - 64633938793.0L/53760.0L) + 745180519.0L/5600.0L) - 971.0L/3600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/37800.0L*x + 13539743789.0L/5040.0L) - 75814667929.0L/8640.0L) + 281524006049.0L/17280.0L) - 2840897042399.0L/151200.0L) + 9912055637.0L/720.0L) - 53988405757.0L/8640.0L) + 1795387191.0L/1120.0L) - 745180579.0L/4200.0L) + 7007.0L/21600.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/37800.0L)*x - 13539743789.0L/5040.0L) + 75814667929.0L/8640.0L) - 281524006049.0L/17280.0L) + 2840897042399.0L/151200.0L) - 4163063367529.0L/302400.0L) + 11809963759.0L/1890.0L) - 64633938973.0L/40320.0L) + 93147578.0L/525.0L) - 971.0L/3600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/50400.0L*x + 13539743789.0L/6720.0L) - 75814667929.0L/11520.0L) + 281524006049.0L/23040.0L) - 2840897042399.0L/201600.0L) + 2081531683759.0L/201600.0L) - 566878260421.0L/120960.0L) + 32316969539.0L/26880.0L) - 1490361303.0L/11200.0L) + 59.0L/384.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((13539743789.0L/90720.0L)*x - 13539743789.0L/12096.0L) + 75814667929.0L/20736.0L) - 281524006049.0L/41472.0L) + 2840897042399.0L/362880.0L) - 1387687789169.0L/241920.0L) + 41990982253.0L/16128.0L) - 21544646395.0L/32256.0L) + 745180661.0L/10080.0L) - 151.0L/2592.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-13539743789.0L/226800.0L*x + 13539743789.0L/30240.0L) - 75814667929.0L/51840.0L) + 281524006049.0L/103680.0L) - 2840897042399.0L/907200.0L) + 520382920937.0L/226800.0L) - 41990982253.0L/40320.0L) + 8079242411.0L/30240.0L) - 372590327.0L/12600.0L) + 601.0L/43200.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1230885799.0L/75600.0L)*x - 1230885799.0L/10080.0L) + 6892242539.0L/17280.0L) - 25593091459.0L/34560.0L) + 2840897042399.0L/3326400.0L) - 75692061227.0L/120960.0L) + 51534387311.0L/181440.0L) - 5875812671.0L/80640.0L) + 33871847.0L/4200.0L) - 41.0L/21600.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1230885799.0L/453600.0L*x + 1230885799.0L/60480.0L) - 6892242539.0L/103680.0L) + 25593091459.0L/207360.0L) - 2840897042399.0L/19958400.0L) + 21025572563.0L/201600.0L) - 1073633069.0L/22680.0L) + 979302113.0L/80640.0L) - 45162461.0L/33600.0L) + 31.0L/259200.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 7)*(x*(x*(x*(x*(x*(x*(x*((94683523.0L/453600.0L)*x - 94683523.0L/60480.0L) + 530172503.0L/103680.0L) - 1968699343.0L/207360.0L) + 218530541723.0L/19958400.0L) - 4158904463.0L/518400.0L) + 377541299.0L/103680.0L) - 451985591.0L/483840.0L) + 5211053.0L/50400.0L);
-break;
+
+template void beta_n6_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0014195025653358988, -0.018466259820426486, 0.11091630591630591, -0.4073721340388007,
+         1.020417217813051, -1.8398958333333333, 2.4556349206349206, -2.4556349206349206,
+         1.8398958333333333, -1.020417217813051, 0.4073721340388007, -0.11091630591630591,
+         0.018466259820426486, -0.0014195025653358988},
+        {-1.8313091229757895e-05, 0.00027143959435626104, -0.0018668831168831169, 0.007700617283950617,
+         -0.018718309082892418, 0.024933035714285713, -0.012301587301587301, -0.012301587301587301,
+         0.024933035714285713, -0.018718309082892418, 0.007700617283950617, -0.0018668831168831169,
+         0.00027143959435626104, -1.8313091229757895e-05},
+        {-0.0015756899350649351, 0.02055123406685907, -0.12398268398268399, 0.45913359788359787,
+         -1.170405505952381, 2.1567075892857144, -2.921765873015873, 2.921765873015873,
+         -2.1567075892857144, 1.170405505952381, -0.45913359788359787, 0.12398268398268399,
+         -0.02055123406685907, 0.0015756899350649351},
+        {8.889114357864358e-05, -0.00134775958994709, 0.009655032467532467, -0.0433912037037037,
+         0.13391307043650794, -0.21959263392857142, 0.12067460317460317, 0.12067460317460317,
+         -0.21959263392857142, 0.13391307043650794, -0.0433912037037037, 0.009655032467532467,
+         -0.00134775958994709, 8.889114357864358e-05},
+        {0.0007020634169071669, -0.009230220734126984, 0.05645427489177489, -0.2146924603174603,
+         0.5823665881283069, -1.3226590401785714, 2.143308531746032, -2.143308531746032,
+         1.3226590401785714, -0.5823665881283069, 0.2146924603174603, -0.05645427489177489,
+         0.009230220734126984, -0.0007020634169071669},
+        {-0.00013119945737133238, 0.002011873759920635, -0.014704748376623377, 0.06886284722222222,
+         -0.23705796337632276, 0.6676213727678572, -0.4866021825396825, -0.4866021825396825,
+         0.6676213727678572, -0.23705796337632276, 0.06886284722222222, -0.014704748376623377,
+         0.002011873759920635, -0.00013119945737133238},
+        {-9.92149608686067e-05, 0.001311638364047218, -0.008097718253968255, 0.03134245480599647,
+         -0.08838532193838183, 0.22461890811011906, -1.3915860615079365, 1.3915860615079365,
+         -0.22461890811011906, 0.08838532193838183, -0.03134245480599647, 0.008097718253968255,
+         -0.001311638364047218, 9.92149608686067e-05},
+        {2.7530309919632837e-05, -0.00042297470927028216, 0.0031019176136363636, -0.014624083719135803,
+         0.05118739752121913, -0.1535703822544643, 0.6143005952380952, 0.6143005952380952,
+         -0.1535703822544643, 0.05118739752121913, -0.014624083719135803, 0.0031019176136363636,
+         -0.00042297470927028216, 2.7530309919632837e-05}};
+};
+constexpr double spline_polynomials<6, 3, 0>::coefficients[8][14];
+
+template <>
+struct spline_polynomials<6, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.009936517957351291, -0.1292638187429854, 0.7764141414141414, -2.851604938271605,
+         7.142920524691358, -12.879270833333333, 17.189444444444444, -17.189444444444444,
+         12.879270833333333, -7.142920524691358, 2.851604938271605, -0.7764141414141414,
+         0.1292638187429854, -0.009936517957351291},
+        {-0.00010987854737854738, 0.0016286375661375661, -0.011201298701298702, 0.046203703703703705,
+         -0.11230985449735449, 0.1495982142857143, -0.07380952380952381, -0.07380952380952381,
+         0.1495982142857143, -0.11230985449735449, 0.046203703703703705, -0.011201298701298702,
+         0.0016286375661375661, -0.00010987854737854738},
+        {-0.007878449675324676, 0.10275617033429534, -0.6199134199134199, 2.295667989417989,
+         -5.852027529761905, 10.783537946428572, -14.608829365079366, 14.608829365079366,
+         -10.783537946428572, 5.852027529761905, -2.295667989417989, 0.6199134199134199,
+         -0.10275617033429534, 0.007878449675324676},
+        {0.0003555645743145743, -0.00539103835978836, 0.03862012987012987, -0.1735648148148148,
+         0.5356522817460317, -0.8783705357142857, 0.4826984126984127, 0.4826984126984127,
+         -0.8783705357142857, 0.5356522817460317, -0.1735648148148148, 0.03862012987012987,
+         -0.00539103835978836, 0.0003555645743145743},
+        {0.002106190250721501, -0.027690662202380954, 0.16936282467532468, -0.644077380952381,
+         1.7470997643849207, -3.967977120535714, 6.429925595238095, -6.429925595238095,
+         3.967977120535714, -1.7470997643849207, 0.644077380952381, -0.16936282467532468,
+         0.027690662202380954, -0.002106190250721501},
+        {-0.00026239891474266476, 0.00402374751984127, -0.029409496753246753, 0.13772569444444444,
+         -0.4741159267526455, 1.3352427455357143, -0.973204365079365, -0.973204365079365,
+         1.3352427455357143, -0.4741159267526455, 0.13772569444444444, -0.029409496753246753,
+         0.00402374751984127, -0.00026239891474266476},
+        {-9.92149608686067e-05, 0.001311638364047218, -0.008097718253968255, 0.03134245480599647,
+         -0.08838532193838183, 0.22461890811011906, -1.3915860615079365, 1.3915860615079365,
+         -0.22461890811011906, 0.08838532193838183, -0.03134245480599647, 0.008097718253968255,
+         -0.001311638364047218, 9.92149608686067e-05}};
+};
+constexpr double spline_polynomials<6, 3, 1>::coefficients[7][14];
+
+template <>
+struct spline_polynomials<6, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.059619107744107745, -0.7755829124579124, 4.658484848484848, -17.10962962962963,
+         42.85752314814815, -77.275625, 103.13666666666667, -103.13666666666667,
+         77.275625, -42.85752314814815, 17.10962962962963, -4.658484848484848,
+         0.7755829124579124, -0.059619107744107745},
+        {-0.0005493927368927369, 0.00814318783068783, -0.056006493506493504, 0.2310185185185185,
+         -0.5615492724867724, 0.7479910714285715, -0.36904761904761907, -0.36904761904761907,
+         0.7479910714285715, -0.5615492724867724, 0.2310185185185185, -0.056006493506493504,
+         0.00814318783068783, -0.0005493927368927369},
+        {-0.0315137987012987, 0.41102468133718134, -2.4796536796536794, 9.182671957671957,
+         -23.40811011904762, 43.13415178571429, -58.435317460317464, 58.435317460317464,
+         -43.13415178571429, 23.40811011904762, -9.182671957671957, 2.4796536796536794,
+         -0.41102468133718134, 0.0315137987012987},
+        {0.001066693722943723, -0.01617311507936508, 0.11586038961038961, -0.5206944444444445,
+         1.6069568452380953, -2.635111607142857, 1.448095238095238, 1.448095238095238,
+         -2.635111607142857, 1.6069568452380953, -0.5206944444444445, 0.11586038961038961,
+         -0.01617311507936508, 0.001066693722943723},
+        {0.004212380501443002, -0.05538132440476191, 0.33872564935064936, -1.288154761904762,
+         3.4941995287698413, -7.935954241071428, 12.85985119047619, -12.85985119047619,
+         7.935954241071428, -3.4941995287698413, 1.288154761904762, -0.33872564935064936,
+         0.05538132440476191, -0.004212380501443002},
+        {-0.00026239891474266476, 0.00402374751984127, -0.029409496753246753, 0.13772569444444444,
+         -0.4741159267526455, 1.3352427455357143, -0.973204365079365, -0.973204365079365,
+         1.3352427455357143, -0.4741159267526455, 0.13772569444444444, -0.029409496753246753,
+         0.00402374751984127, -0.00026239891474266476}};
+};
+constexpr double spline_polynomials<6, 3, 2>::coefficients[6][14];
+
+template <class real_number>
+void beta_n6_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 3, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 3, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 3, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.004586197624392069, 0.059621571201432313, -0.35773719336219334, 1.3117324368018812,
+         -3.2793958517048796, 5.902998511904762, -7.870725308641975, 7.870725308641975,
+         -5.902998511904762, 3.2793958517048796, -1.3117324368018812, 0.35773719336219334,
+         -0.059621571201432313, 0.004586197624392069},
+        {1.7828750467639356e-06, -2.512308935920047e-05, 0.00015827922077922077, -0.0005542695473251029,
+         0.0011516662992357436, -0.0013727678571428571, 0.0006404320987654321, 0.0006404320987654321,
+         -0.0013727678571428571, 0.0011516662992357436, -0.0005542695473251029, 0.00015827922077922077,
+         -2.512308935920047e-05, 1.7828750467639356e-06},
+        {0.006005700189727968, -0.0780878310218588, 0.46865349927849925, -1.719104570840682,
+         4.29981306951793, -7.742894345238096, 10.326360229276895, -10.326360229276895,
+         7.742894345238096, -4.29981306951793, 1.719104570840682, -0.46865349927849925,
+         0.0780878310218588, -0.006005700189727968},
+        {-2.0095966276521833e-05, 0.00029656268371546147, -0.002025162337662338, 0.00825488683127572,
+         -0.01986997538212816, 0.02630580357142857, -0.012942019400352734, -0.012942019400352734,
+         0.02630580357142857, -0.01986997538212816, 0.00825488683127572, -0.002025162337662338,
+         0.00029656268371546147, -2.0095966276521833e-05},
+        {-0.0032955140442119607, 0.04290932326739618, -0.2581341314935065, 0.9510332616843034,
+         -2.4001789503417106, 4.37033203125, -5.873287863756614, 5.873287863756614,
+         -4.37033203125, 2.4001789503417106, -0.9510332616843034, 0.2581341314935065,
+         -0.04290932326739618, 0.0032955140442119607},
+        {8.955972172118005e-05, -0.0013571807484567902, 0.009714387175324675, -0.04359905478395062,
+         0.13434494529872135, -0.220107421875, 0.12091476521164021, 0.12091476521164021,
+         -0.220107421875, 0.13434494529872135, -0.04359905478395062, 0.009714387175324675,
+         -0.0013571807484567902, 8.955972172118005e-05},
+        {0.0009887007684316713, -0.012956568934216504, 0.07881284947691197, -0.2966757376175779,
+         0.7873288288598619, -1.691596447172619, 2.635228863536155, -2.635228863536155,
+         1.691596447172619, -0.7873288288598619, 0.2966757376175779, -0.07881284947691197,
+         0.012956568934216504, -0.0009887007684316713},
+        {-0.00013131088706175512, 0.0020134439530055848, -0.014714640827922077, 0.06889748906893003,
+         -0.23712994252002498, 0.6677071707589286, -0.48664220954585535, -0.48664220954585535,
+         0.6677071707589286, -0.23712994252002498, 0.06889748906893003, -0.014714640827922077,
+         0.0020134439530055848, -0.00013131088706175512},
+        {-0.00011712979533888822, 0.0015445351265528132, -0.009495129165539322, 0.036466409637253824,
+         -0.10119546198410402, 0.24767749604724704, -1.4223310822448192, 1.4223310822448192,
+         -0.24767749604724704, 0.10119546198410402, -0.036466409637253824, 0.009495129165539322,
+         -0.0015445351265528132, 0.00011712979533888822},
+        {2.7537274275284258e-05, -0.00042307284633809155, 0.0031025358918425326, -0.014626248834555041,
+         0.051191896217700525, -0.15357574462890625, 0.6143030969259811, 0.6143030969259811,
+         -0.15357574462890625, 0.051191896217700525, -0.014626248834555041, 0.0031025358918425326,
+         -0.00042307284633809155, 2.7537274275284258e-05}};
+};
+constexpr double spline_polynomials<6, 4, 0>::coefficients[10][14];
+
+template <>
+struct spline_polynomials<6, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.04127577861952862, 0.5365941408128908, -3.2196347402597403, 11.80559193121693,
+         -29.514562665343917, 53.126986607142854, -70.83652777777777, 70.83652777777777,
+         -53.126986607142854, 29.514562665343917, -11.80559193121693, 3.2196347402597403,
+         -0.5365941408128908, 0.04127577861952862},
+        {1.4263000374111485e-05, -0.00020098471487360375, 0.0012662337662337662, -0.004434156378600823,
+         0.009213330393885949, -0.010982142857142857, 0.0051234567901234564, 0.0051234567901234564,
+         -0.010982142857142857, 0.009213330393885949, -0.004434156378600823, 0.0012662337662337662,
+         -0.00020098471487360375, 1.4263000374111485e-05},
+        {0.04203990132809577, -0.5466148171530116, 3.280574494949495, -12.033731995884773,
+         30.098691486625516, -54.200260416666666, 72.28452160493828, -72.28452160493828,
+         54.200260416666666, -30.098691486625516, 12.033731995884773, -3.280574494949495,
+         0.5466148171530116, -0.04203990132809577},
+        {-0.000120575797659131, 0.001779376102292769, -0.012150974025974025, 0.04952932098765432,
+         -0.11921985229276896, 0.15783482142857144, -0.0776521164021164, -0.0776521164021164,
+         0.15783482142857144, -0.11921985229276896, 0.04952932098765432, -0.012150974025974025,
+         0.001779376102292769, -0.000120575797659131},
+        {-0.016477570221059803, 0.2145466163369809, -1.2906706574675324, 4.755166308421517,
+         -12.000894751708554, 21.85166015625, -29.36643931878307, 29.36643931878307,
+         -21.85166015625, 12.000894751708554, -4.755166308421517, 1.2906706574675324,
+         -0.2145466163369809, 0.016477570221059803},
+        {0.0003582388868847202, -0.005428722993827161, 0.0388575487012987, -0.17439621913580247,
+         0.5373797811948854, -0.8804296875, 0.48365906084656085, 0.48365906084656085,
+         -0.8804296875, 0.5373797811948854, -0.17439621913580247, 0.0388575487012987,
+         -0.005428722993827161, 0.0003582388868847202},
+        {0.0029661023052950136, -0.03886970680264951, 0.23643854843073592, -0.8900272128527337,
+         2.3619864865795854, -5.0747893415178575, 7.9056865906084655, -7.9056865906084655,
+         5.0747893415178575, -2.3619864865795854, 0.8900272128527337, -0.23643854843073592,
+         0.03886970680264951, -0.0029661023052950136},
+        {-0.00026262177412351024, 0.0040268879060111696, -0.029429281655844155, 0.13779497813786007,
+         -0.47425988504004996, 1.3354143415178572, -0.9732844190917107, -0.9732844190917107,
+         1.3354143415178572, -0.47425988504004996, 0.13779497813786007, -0.029429281655844155,
+         0.0040268879060111696, -0.00026262177412351024},
+        {-0.00011712979533888822, 0.0015445351265528132, -0.009495129165539322, 0.036466409637253824,
+         -0.10119546198410402, 0.24767749604724704, -1.4223310822448192, 1.4223310822448192,
+         -0.24767749604724704, 0.10119546198410402, -0.036466409637253824, 0.009495129165539322,
+         -0.0015445351265528132, 0.00011712979533888822}};
+};
+constexpr double spline_polynomials<6, 4, 1>::coefficients[9][14];
+
+template <>
+struct spline_polynomials<6, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.330206228956229, 4.2927531265031265, -25.757077922077922, 94.44473544973545,
+         -236.11650132275133, 425.01589285714283, -566.6922222222222, 566.6922222222222,
+         -425.01589285714283, 236.11650132275133, -94.44473544973545, 25.757077922077922,
+         -4.2927531265031265, 0.330206228956229},
+        {9.984100261878039e-05, -0.0014068930041152264, 0.008863636363636363, -0.03103909465020576,
+         0.06449331275720165, -0.076875, 0.0358641975308642, 0.0358641975308642,
+         -0.076875, 0.06449331275720165, -0.03103909465020576, 0.008863636363636363,
+         -0.0014068930041152264, 9.984100261878039e-05},
+        {0.25223940796857464, -3.27968890291807, 19.68344696969697, -72.20239197530864,
+         180.5921489197531, -325.2015625, 433.7071296296296, -433.7071296296296,
+         325.2015625, -180.5921489197531, 72.20239197530864, -19.68344696969697,
+         3.27968890291807, -0.25223940796857464},
+        {-0.000602878988295655, 0.008896880511463845, -0.06075487012987013, 0.2476466049382716,
+         -0.5960992614638448, 0.7891741071428572, -0.388260582010582, -0.388260582010582,
+         0.7891741071428572, -0.5960992614638448, 0.2476466049382716, -0.06075487012987013,
+         0.008896880511463845, -0.000602878988295655},
+        {-0.06591028088423921, 0.8581864653479236, -5.16268262987013, 19.020665233686067,
+         -48.003579006834215, 87.406640625, -117.46575727513228, 117.46575727513228,
+         -87.406640625, 48.003579006834215, -19.020665233686067, 5.16268262987013,
+         -0.8581864653479236, 0.06591028088423921},
+        {0.0010747166606541606, -0.016286168981481483, 0.1165726461038961, -0.5231886574074074,
+         1.612139343584656, -2.6412890625, 1.4509771825396824, 1.4509771825396824,
+         -2.6412890625, 1.612139343584656, -0.5231886574074074, 0.1165726461038961,
+         -0.016286168981481483, 0.0010747166606541606},
+        {0.005932204610590027, -0.07773941360529903, 0.47287709686147184, -1.7800544257054673,
+         4.723972973159171, -10.149578683035715, 15.811373181216931, -15.811373181216931,
+         10.149578683035715, -4.723972973159171, 1.7800544257054673, -0.47287709686147184,
+         0.07773941360529903, -0.005932204610590027},
+        {-0.00026262177412351024, 0.0040268879060111696, -0.029429281655844155, 0.13779497813786007,
+         -0.47425988504004996, 1.3354143415178572, -0.9732844190917107, -0.9732844190917107,
+         1.3354143415178572, -0.47425988504004996, 0.13779497813786007, -0.029429281655844155,
+         0.0040268879060111696, -0.00026262177412351024}};
+};
+constexpr double spline_polynomials<6, 4, 2>::coefficients[8][14];
+
+template <class real_number>
+void beta_n6_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 4, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 4, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 4, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m9(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((5211053.0L/1814400.0L)*x - 99010007.0L/3628800.0L) + 838620967.0L/7257600.0L) - 23757347.0L/82944.0L) + 285008867.0L/622080.0L) - 7121920081.0L/14515200.0L) + 84305230741.0L/239500800.0L) - 13032278689.0L/79833600.0L) + 10751339.0L/241920.0L) - 7862447.0L/1451520.0L) + 1.0L/1451520.0L) + 31.0L/14515200.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-67743689.0L/1814400.0L*x + 1287130091.0L/3628800.0L) - 10902072571.0L/7257600.0L) + 308845511.0L/82944.0L) - 3705115271.0L/622080.0L) + 92584961053.0L/14515200.0L) - 1095967999633.0L/239500800.0L) + 1016517737743.0L/479001600.0L) - 15374414771.0L/26611200.0L) + 3066354337.0L/43545600.0L) - 1.0L/120960.0L) - 41.0L/1209600.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((67743689.0L/302400.0L)*x - 1287130091.0L/604800.0L) + 10902072571.0L/1209600.0L) - 308845511.0L/13824.0L) + 3705115271.0L/103680.0L) - 92584961053.0L/2419200.0L) + 1095967999633.0L/39916800.0L) - 63532358609.0L/4989600.0L) + 138369732947.0L/39916800.0L) - 21902531.0L/51840.0L) + 1.0L/24192.0L) + 601.0L/2419200.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-745180579.0L/907200.0L*x + 14158431001.0L/1814400.0L) - 119922798281.0L/3628800.0L) + 3397300621.0L/41472.0L) - 40756267981.0L/311040.0L) + 1018434571583.0L/7257600.0L) - 1095967999633.0L/10886400.0L) + 22589283061.0L/483840.0L) - 23061622159.0L/1814400.0L) + 749553283.0L/483840.0L) - 41.0L/362880.0L) - 151.0L/145152.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((745180579.0L/362880.0L)*x - 14158431001.0L/725760.0L) + 119922798281.0L/1451520.0L) - 16986503105.0L/82944.0L) + 40756267981.0L/124416.0L) - 1018434571583.0L/2903040.0L) + 1095967999633.0L/4354560.0L) - 72608409839.0L/622080.0L) + 288270277.0L/9072.0L) - 2409278407.0L/622080.0L) + 29.0L/161280.0L) + 59.0L/21504.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-745180579.0L/201600.0L*x + 14158431001.0L/403200.0L) - 119922798281.0L/806400.0L) + 3397300621.0L/9216.0L) - 40756267981.0L/69120.0L) + 1018434571583.0L/1612800.0L) - 1095967999633.0L/2419200.0L) + 1016517737747.0L/4838400.0L) - 27673946593.0L/483840.0L) + 963711361.0L/138240.0L) - 1.0L/6720.0L) - 971.0L/201600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((745180579.0L/151200.0L)*x - 14158431001.0L/302400.0L) + 119922798281.0L/604800.0L) - 3397300621.0L/6912.0L) + 40756267981.0L/51840.0L) - 1018434571583.0L/1209600.0L) + 1095967999633.0L/1814400.0L) - 84709811479.0L/302400.0L) + 46123244323.0L/604800.0L) - 702706199.0L/75600.0L) + 1001.0L/172800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-745180579.0L/151200.0L*x + 14158431001.0L/302400.0L) - 119922798281.0L/604800.0L) + 3397300621.0L/6912.0L) - 40756267981.0L/51840.0L) + 1018434571583.0L/1209600.0L) - 1095967999633.0L/1814400.0L) + 1016517737749.0L/3628800.0L) - 11530811081.0L/151200.0L) + 6745979491.0L/725760.0L) + 1.0L/6720.0L) - 971.0L/201600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((745180579.0L/201600.0L)*x - 14158431001.0L/403200.0L) + 119922798281.0L/806400.0L) - 3397300621.0L/9216.0L) + 40756267981.0L/69120.0L) - 1018434571583.0L/1612800.0L) + 1095967999633.0L/2419200.0L) - 20330354755.0L/96768.0L) + 69184866487.0L/1209600.0L) - 674597947.0L/96768.0L) - 29.0L/161280.0L) + 59.0L/21504.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-745180579.0L/362880.0L*x + 14158431001.0L/725760.0L) - 119922798281.0L/1451520.0L) + 16986503105.0L/82944.0L) - 40756267981.0L/124416.0L) + 1018434571583.0L/2903040.0L) - 1095967999633.0L/4354560.0L) + 338839245917.0L/2903040.0L) - 1024960985.0L/32256.0L) + 1606185583.0L/414720.0L) + 41.0L/362880.0L) - 151.0L/145152.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((745180579.0L/907200.0L)*x - 14158431001.0L/1814400.0L) + 119922798281.0L/3628800.0L) - 3397300621.0L/41472.0L) + 40756267981.0L/311040.0L) - 1018434571583.0L/7257600.0L) + 1095967999633.0L/10886400.0L) - 127064717219.0L/2721600.0L) + 204992197.0L/16128.0L) - 1686494857.0L/1088640.0L) - 1.0L/24192.0L) + 601.0L/2419200.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-67743689.0L/302400.0L*x + 1287130091.0L/604800.0L) - 10902072571.0L/1209600.0L) + 308845511.0L/13824.0L) - 3705115271.0L/103680.0L) + 92584961053.0L/2419200.0L) - 1095967999633.0L/39916800.0L) + 145216819679.0L/11404800.0L) - 6289533317.0L/1814400.0L) + 438050611.0L/1036800.0L) + 1.0L/120960.0L) - 41.0L/1209600.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((67743689.0L/1814400.0L)*x - 1287130091.0L/3628800.0L) + 10902072571.0L/7257600.0L) - 308845511.0L/82944.0L) + 3705115271.0L/622080.0L) - 92584961053.0L/14515200.0L) + 1095967999633.0L/239500800.0L) - 18824402551.0L/8870400.0L) + 11530811081.0L/19958400.0L) - 4867229.0L/69120.0L) - 1.0L/1451520.0L) + 31.0L/14515200.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 10)*(x*(x*(x*(x*(x*(x*(x*(x*(-5211053.0L/1814400.0L*x + 99010007.0L/3628800.0L) - 838620967.0L/7257600.0L) + 23757347.0L/82944.0L) - 285008867.0L/622080.0L) + 7121920081.0L/14515200.0L) - 84305230741.0L/239500800.0L) + 15638734427.0L/95800320.0L) - 3547941871.0L/79833600.0L) + 47174681.0L/8709120.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((99010007.0L/1814400.0L)*x - 99010007.0L/201600.0L) + 14256556439.0L/7257600.0L) - 23757347.0L/5184.0L) + 285008867.0L/41472.0L) - 7121920081.0L/1036800.0L) + 1095967999633.0L/239500800.0L) - 13032278689.0L/6652800.0L) + 118264729.0L/241920.0L) - 7862447.0L/145152.0L) + 1.0L/161280.0L) + 31.0L/1814400.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1287130091.0L/1814400.0L*x + 1287130091.0L/201600.0L) - 185335233707.0L/7257600.0L) + 308845511.0L/5184.0L) - 3705115271.0L/41472.0L) + 92584961053.0L/1036800.0L) - 14247583995229.0L/239500800.0L) + 1016517737743.0L/39916800.0L) - 15374414771.0L/2419200.0L) + 3066354337.0L/4354560.0L) - 1.0L/13440.0L) - 41.0L/151200.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1287130091.0L/302400.0L)*x - 1287130091.0L/33600.0L) + 185335233707.0L/1209600.0L) - 308845511.0L/864.0L) + 3705115271.0L/6912.0L) - 92584961053.0L/172800.0L) + 14247583995229.0L/39916800.0L) - 63532358609.0L/415800.0L) + 138369732947.0L/3628800.0L) - 21902531.0L/5184.0L) + 1.0L/2688.0L) + 601.0L/302400.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/907200.0L*x + 14158431001.0L/100800.0L) - 2038687570777.0L/3628800.0L) + 3397300621.0L/2592.0L) - 40756267981.0L/20736.0L) + 1018434571583.0L/518400.0L) - 14247583995229.0L/10886400.0L) + 22589283061.0L/40320.0L) - 253677843749.0L/1814400.0L) + 749553283.0L/48384.0L) - 41.0L/40320.0L) - 151.0L/18144.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/362880.0L)*x - 14158431001.0L/40320.0L) + 2038687570777.0L/1451520.0L) - 16986503105.0L/5184.0L) + 203781339905.0L/41472.0L) - 1018434571583.0L/207360.0L) + 14247583995229.0L/4354560.0L) - 72608409839.0L/51840.0L) + 3170973047.0L/9072.0L) - 2409278407.0L/62208.0L) + 29.0L/17920.0L) + 59.0L/2688.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/201600.0L*x + 14158431001.0L/22400.0L) - 2038687570777.0L/806400.0L) + 3397300621.0L/576.0L) - 40756267981.0L/4608.0L) + 1018434571583.0L/115200.0L) - 14247583995229.0L/2419200.0L) + 1016517737747.0L/403200.0L) - 304413412523.0L/483840.0L) + 963711361.0L/13824.0L) - 3.0L/2240.0L) - 971.0L/25200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/151200.0L)*x - 14158431001.0L/16800.0L) + 2038687570777.0L/604800.0L) - 3397300621.0L/432.0L) + 40756267981.0L/3456.0L) - 1018434571583.0L/86400.0L) + 14247583995229.0L/1814400.0L) - 84709811479.0L/25200.0L) + 507355687553.0L/604800.0L) - 702706199.0L/7560.0L) + 1001.0L/21600.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/151200.0L*x + 14158431001.0L/16800.0L) - 2038687570777.0L/604800.0L) + 3397300621.0L/432.0L) - 40756267981.0L/3456.0L) + 1018434571583.0L/86400.0L) - 14247583995229.0L/1814400.0L) + 1016517737749.0L/302400.0L) - 126838921891.0L/151200.0L) + 6745979491.0L/72576.0L) + 3.0L/2240.0L) - 971.0L/25200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/201600.0L)*x - 14158431001.0L/22400.0L) + 2038687570777.0L/806400.0L) - 3397300621.0L/576.0L) + 40756267981.0L/4608.0L) - 1018434571583.0L/115200.0L) + 14247583995229.0L/2419200.0L) - 20330354755.0L/8064.0L) + 761033531357.0L/1209600.0L) - 3372989735.0L/48384.0L) - 29.0L/17920.0L) + 59.0L/2688.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/362880.0L*x + 14158431001.0L/40320.0L) - 2038687570777.0L/1451520.0L) + 16986503105.0L/5184.0L) - 203781339905.0L/41472.0L) + 1018434571583.0L/207360.0L) - 14247583995229.0L/4354560.0L) + 338839245917.0L/241920.0L) - 11274570835.0L/32256.0L) + 1606185583.0L/41472.0L) + 41.0L/40320.0L) - 151.0L/18144.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/907200.0L)*x - 14158431001.0L/100800.0L) + 2038687570777.0L/3628800.0L) - 3397300621.0L/2592.0L) + 40756267981.0L/20736.0L) - 1018434571583.0L/518400.0L) + 14247583995229.0L/10886400.0L) - 127064717219.0L/226800.0L) + 2254914167.0L/16128.0L) - 1686494857.0L/108864.0L) - 1.0L/2688.0L) + 601.0L/302400.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1287130091.0L/302400.0L*x + 1287130091.0L/33600.0L) - 185335233707.0L/1209600.0L) + 308845511.0L/864.0L) - 3705115271.0L/6912.0L) + 92584961053.0L/172800.0L) - 14247583995229.0L/39916800.0L) + 145216819679.0L/950400.0L) - 69184866487.0L/1814400.0L) + 438050611.0L/103680.0L) + 1.0L/13440.0L) - 41.0L/151200.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1287130091.0L/1814400.0L)*x - 1287130091.0L/201600.0L) + 185335233707.0L/7257600.0L) - 308845511.0L/5184.0L) + 3705115271.0L/41472.0L) - 92584961053.0L/1036800.0L) + 14247583995229.0L/239500800.0L) - 18824402551.0L/739200.0L) + 11530811081.0L/1814400.0L) - 4867229.0L/6912.0L) - 1.0L/161280.0L) + 31.0L/1814400.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*(x*(-99010007.0L/1814400.0L*x + 99010007.0L/201600.0L) - 14256556439.0L/7257600.0L) + 23757347.0L/5184.0L) - 285008867.0L/41472.0L) + 7121920081.0L/1036800.0L) - 1095967999633.0L/239500800.0L) + 15638734427.0L/7983360.0L) - 3547941871.0L/7257600.0L) + 47174681.0L/870912.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((99010007.0L/100800.0L)*x - 1683170119.0L/201600.0L) + 14256556439.0L/453600.0L) - 118786735.0L/1728.0L) + 1995062069.0L/20736.0L) - 92584961053.0L/1036800.0L) + 1095967999633.0L/19958400.0L) - 13032278689.0L/604800.0L) + 118264729.0L/24192.0L) - 7862447.0L/16128.0L) + 1.0L/20160.0L) + 31.0L/259200.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1287130091.0L/100800.0L*x + 21881211547.0L/201600.0L) - 185335233707.0L/453600.0L) + 1544227555.0L/1728.0L) - 25935806897.0L/20736.0L) + 1203604493689.0L/1036800.0L) - 14247583995229.0L/19958400.0L) + 1016517737743.0L/3628800.0L) - 15374414771.0L/241920.0L) + 3066354337.0L/483840.0L) - 1.0L/1680.0L) - 41.0L/21600.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1287130091.0L/16800.0L)*x - 21881211547.0L/33600.0L) + 185335233707.0L/75600.0L) - 1544227555.0L/288.0L) + 25935806897.0L/3456.0L) - 1203604493689.0L/172800.0L) + 14247583995229.0L/3326400.0L) - 63532358609.0L/37800.0L) + 138369732947.0L/362880.0L) - 21902531.0L/576.0L) + 1.0L/336.0L) + 601.0L/43200.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/50400.0L*x + 240693327017.0L/100800.0L) - 2038687570777.0L/226800.0L) + 16986503105.0L/864.0L) - 285293875867.0L/10368.0L) + 13239649430579.0L/518400.0L) - 14247583995229.0L/907200.0L) + 248482113671.0L/40320.0L) - 253677843749.0L/181440.0L) + 749553283.0L/5376.0L) - 41.0L/5040.0L) - 151.0L/2592.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/20160.0L)*x - 240693327017.0L/40320.0L) + 2038687570777.0L/90720.0L) - 84932515525.0L/1728.0L) + 1426469379335.0L/20736.0L) - 13239649430579.0L/207360.0L) + 14247583995229.0L/362880.0L) - 798692508229.0L/51840.0L) + 15854865235.0L/4536.0L) - 2409278407.0L/6912.0L) + 29.0L/2240.0L) + 59.0L/384.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/11200.0L*x + 240693327017.0L/22400.0L) - 2038687570777.0L/50400.0L) + 16986503105.0L/192.0L) - 285293875867.0L/2304.0L) + 13239649430579.0L/115200.0L) - 14247583995229.0L/201600.0L) + 11181695115217.0L/403200.0L) - 304413412523.0L/48384.0L) + 963711361.0L/1536.0L) - 3.0L/280.0L) - 971.0L/3600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/8400.0L)*x - 240693327017.0L/16800.0L) + 2038687570777.0L/37800.0L) - 16986503105.0L/144.0L) + 285293875867.0L/1728.0L) - 13239649430579.0L/86400.0L) + 14247583995229.0L/151200.0L) - 931807926269.0L/25200.0L) + 507355687553.0L/60480.0L) - 702706199.0L/840.0L) + 7007.0L/21600.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/8400.0L*x + 240693327017.0L/16800.0L) - 2038687570777.0L/37800.0L) + 16986503105.0L/144.0L) - 285293875867.0L/1728.0L) + 13239649430579.0L/86400.0L) - 14247583995229.0L/151200.0L) + 11181695115239.0L/302400.0L) - 126838921891.0L/15120.0L) + 6745979491.0L/8064.0L) + 3.0L/280.0L) - 971.0L/3600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/11200.0L)*x - 240693327017.0L/22400.0L) + 2038687570777.0L/50400.0L) - 16986503105.0L/192.0L) + 285293875867.0L/2304.0L) - 13239649430579.0L/115200.0L) + 14247583995229.0L/201600.0L) - 223633902305.0L/8064.0L) + 761033531357.0L/120960.0L) - 3372989735.0L/5376.0L) - 29.0L/2240.0L) + 59.0L/384.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-14158431001.0L/20160.0L*x + 240693327017.0L/40320.0L) - 2038687570777.0L/90720.0L) + 84932515525.0L/1728.0L) - 1426469379335.0L/20736.0L) + 13239649430579.0L/207360.0L) - 14247583995229.0L/362880.0L) + 3727231705087.0L/241920.0L) - 56372854175.0L/16128.0L) + 1606185583.0L/4608.0L) + 41.0L/5040.0L) - 151.0L/2592.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((14158431001.0L/50400.0L)*x - 240693327017.0L/100800.0L) + 2038687570777.0L/226800.0L) - 16986503105.0L/864.0L) + 285293875867.0L/10368.0L) - 13239649430579.0L/518400.0L) + 14247583995229.0L/907200.0L) - 1397711889409.0L/226800.0L) + 11274570835.0L/8064.0L) - 1686494857.0L/12096.0L) - 1.0L/336.0L) + 601.0L/43200.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-1287130091.0L/16800.0L*x + 21881211547.0L/33600.0L) - 185335233707.0L/75600.0L) + 1544227555.0L/288.0L) - 25935806897.0L/3456.0L) + 1203604493689.0L/172800.0L) - 14247583995229.0L/3326400.0L) + 145216819679.0L/86400.0L) - 69184866487.0L/181440.0L) + 438050611.0L/11520.0L) + 1.0L/1680.0L) - 41.0L/21600.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((1287130091.0L/100800.0L)*x - 21881211547.0L/201600.0L) + 185335233707.0L/453600.0L) - 1544227555.0L/1728.0L) + 25935806897.0L/20736.0L) - 1203604493689.0L/1036800.0L) + 14247583995229.0L/19958400.0L) - 18824402551.0L/67200.0L) + 11530811081.0L/181440.0L) - 4867229.0L/768.0L) - 1.0L/20160.0L) + 31.0L/259200.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 8)*(x*(x*(x*(x*(x*(x*(x*(x*(-99010007.0L/100800.0L*x + 1683170119.0L/201600.0L) - 14256556439.0L/453600.0L) + 118786735.0L/1728.0L) - 1995062069.0L/20736.0L) + 92584961053.0L/1036800.0L) - 1095967999633.0L/19958400.0L) + 15638734427.0L/725760.0L) - 3547941871.0L/725760.0L) + 47174681.0L/96768.0L);
-break;
+
+template void beta_n6_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 5, 0>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0158595503647587, -0.20617417979397146, 1.2370452040243707, -4.535832782186949,
+         11.339582644400354, -20.41124958664021, 27.215, -27.215,
+         20.41124958664021, -11.339582644400354, 4.535832782186949, -1.2370452040243707,
+         0.20617417979397146, -0.0158595503647587},
+        {-7.306864945753835e-08, 9.415417401528512e-07, -5.185786435786436e-06, 1.6075102880658438e-05,
+         -3.0427873309817754e-05, 3.410218253968254e-05, -1.54320987654321e-05, -1.54320987654321e-05,
+         3.410218253968254e-05, -3.0427873309817754e-05, 1.6075102880658438e-05, -5.185786435786436e-06,
+         9.415417401528512e-07, -7.306864945753835e-08},
+        {-0.024410635580340442, 0.31733929594389665, -1.9040436983926567, 6.981523414535567,
+         -17.45387415720532, 31.417060495205025, -41.88947530864198, 41.88947530864198,
+         -31.417060495205025, 17.45387415720532, -6.981523414535567, 1.9040436983926567,
+         -0.31733929594389665, 0.024410635580340442},
+        {1.8742108585858586e-06, -2.6300016534391534e-05, 0.00016476145382395382, -0.000574363425925926,
+         0.0011897011408730158, -0.0014153955853174604, 0.0006597222222222222, 0.0006597222222222222,
+         -0.0014153955853174604, 0.0011897011408730158, -0.000574363425925926, 0.00016476145382395382,
+         -2.6300016534391534e-05, 1.8742108585858586e-06},
+        {0.015917919167702153, -0.20694669339309096, 1.241806751793731, -4.554000059707525,
+         11.387052222268151, -20.49992533688823, 27.335735229276896, -27.335735229276896,
+         20.49992533688823, -11.387052222268151, 4.554000059707525, -1.241806751793731,
+         0.20694669339309096, -0.015917919167702153},
+        {-2.0141634182432794e-05, 0.000297151147303057, -0.002028403454184704, 0.008264933770576131,
+         -0.019888992802946797, 0.026327117435515874, -0.012951664462081128, -0.012951664462081128,
+         0.026327117435515874, -0.019888992802946797, 0.008264933770576131, -0.002028403454184704,
+         0.000297151147303057, -2.0141634182432794e-05},
+        {-0.005773568788705508, 0.07512403886020423, -0.4514224446223144, 1.6597571339010142,
+         -4.171988738529266, 7.5595897791625335, -10.125631613756614, 10.125631613756614,
+         -7.5595897791625335, 4.171988738529266, -1.6597571339010142, 0.4514224446223144,
+         -0.07512403886020423, 0.005773568788705508},
+        {8.95711386976578e-05, -0.001357327864353689, 0.009715197454455267, -0.04360156651877572,
+         0.13434969965392599, -0.22011275034102182, 0.12091717647707231, 0.12091717647707231,
+         -0.22011275034102182, 0.13434969965392599, -0.04360156651877572, 0.009715197454455267,
+         -0.001357327864353689, 8.95711386976578e-05},
+        {0.0012984576114933644, -0.016983408383317508, 0.10297388861801297, -0.38526622164466673,
+         1.0088050523833063, -2.0902536656616855, 3.1667718322861553, -3.1667718322861553,
+         2.0902536656616855, -1.0088050523833063, 0.38526622164466673, -0.10297388861801297,
+         0.016983408383317508, -0.0012984576114933644},
+        {-0.00013131231418381483, 0.002013462342492697, -0.014714742112813402, 0.06889780303578318,
+         -0.23713053681442556, 0.6677078368171813, -0.4866425109540344, -0.4866425109540344,
+         0.6677078368171813, -0.23713053681442556, 0.06889780303578318, -0.014714742112813402,
+         0.002013462342492697, -0.00013131231418381483},
+        {-0.0001326176374919729, 0.0017458770990078634, -0.010703181122594371, 0.04089593383860826,
+         -0.11226927316027624, 0.2676103569717004, -1.4489082306823193, 1.4489082306823193,
+         -0.2676103569717004, 0.11226927316027624, -0.04089593383860826, 0.010703181122594371,
+         -0.0017458770990078634, 0.0001326176374919729},
+        {2.7537345631387244e-05, -0.0004230737658124472, 0.003102540956087099, -0.014626264532897698,
+         0.05119192593242056, -0.1535757779318189, 0.61430311199639, 0.61430311199639,
+         -0.1535757779318189, 0.05119192593242056, -0.014626264532897698, 0.003102540956087099,
+         -0.0004230737658124472, 2.7537345631387244e-05}};
+};
+constexpr double spline_polynomials<6, 5, 0>::coefficients[12][14];
+
+template <>
+struct spline_polynomials<6, 5, 1>
+{
+    static constexpr int degree = 10;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.17445505401234568, -2.267915977733686, 13.607497244268078, -49.89416060405644,
+         124.73540908840388, -224.52374545304232, 299.365, -299.365,
+         224.52374545304232, -124.73540908840388, 49.89416060405644, -13.607497244268078,
+         2.267915977733686, -0.17445505401234568},
+        {-7.306864945753834e-07, 9.415417401528513e-06, -5.185786435786436e-05, 0.00016075102880658436,
+         -0.00030427873309817754, 0.0003410218253968254, -0.00015432098765432098, -0.00015432098765432098,
+         0.0003410218253968254, -0.00030427873309817754, 0.00016075102880658436, -5.185786435786436e-05,
+         9.415417401528513e-06, -7.306864945753834e-07},
+        {-0.21969572022306397, 2.8560536634950697, -17.13639328553391, 62.83371073082011,
+         -157.08486741484788, 282.75354445684525, -377.0052777777778, 377.0052777777778,
+         -282.75354445684525, 157.08486741484788, -62.83371073082011, 17.13639328553391,
+         -2.8560536634950697, 0.21969572022306397},
+        {1.4993686868686869e-05, -0.00021040013227513227, 0.0013180916305916305, -0.004594907407407408,
+         0.009517609126984126, -0.011323164682539683, 0.005277777777777778, 0.005277777777777778,
+         -0.011323164682539683, 0.009517609126984126, -0.004594907407407408, 0.0013180916305916305,
+         -0.00021040013227513227, 1.4993686868686869e-05},
+        {0.11142543417391508, -1.4486268537516367, 8.692647262556116, -31.878000417952673,
+         79.70936555587706, -143.4994773582176, 191.35014660493826, -191.35014660493826,
+         143.4994773582176, -79.70936555587706, 31.878000417952673, -8.692647262556116,
+         1.4486268537516367, -0.11142543417391508},
+        {-0.00012084980509459676, 0.0017829068838183422, -0.012170420725108225, 0.04958960262345679,
+         -0.11933395681768078, 0.15796270461309525, -0.07770998677248678, -0.07770998677248678,
+         0.15796270461309525, -0.11933395681768078, 0.04958960262345679, -0.012170420725108225,
+         0.0017829068838183422, -0.00012084980509459676},
+        {-0.028867843943527538, 0.3756201943010211, -2.257112223111572, 8.29878566950507,
+         -20.85994369264633, 37.79794889581267, -50.628158068783065, 50.628158068783065,
+         -37.79794889581267, 20.85994369264633, -8.29878566950507, 2.257112223111572,
+         -0.3756201943010211, 0.028867843943527538},
+        {0.0003582845547906312, -0.005429311457414756, 0.03886078981782107, -0.17440626607510287,
+         0.5373987986157039, -0.8804510013640873, 0.48366870590828925, 0.48366870590828925,
+         -0.8804510013640873, 0.5373987986157039, -0.17440626607510287, 0.03886078981782107,
+         -0.005429311457414756, 0.0003582845547906312},
+        {0.0038953728344800938, -0.050950225149952524, 0.3089216658540389, -1.1557986649340002,
+         3.0264151571499185, -6.270760996985057, 9.500315496858466, -9.500315496858466,
+         6.270760996985057, -3.0264151571499185, 1.1557986649340002, -0.3089216658540389,
+         0.050950225149952524, -0.0038953728344800938},
+        {-0.00026262462836762967, 0.004026924684985394, -0.029429484225626804, 0.13779560607156635,
+         -0.4742610736288511, 1.3354156736343625, -0.9732850219080688, -0.9732850219080688,
+         1.3354156736343625, -0.4742610736288511, 0.13779560607156635, -0.029429484225626804,
+         0.004026924684985394, -0.00026262462836762967},
+        {-0.0001326176374919729, 0.0017458770990078634, -0.010703181122594371, 0.04089593383860826,
+         -0.11226927316027624, 0.2676103569717004, -1.4489082306823193, 1.4489082306823193,
+         -0.2676103569717004, 0.11226927316027624, -0.04089593383860826, 0.010703181122594371,
+         -0.0017458770990078634, 0.0001326176374919729}};
+};
+constexpr double spline_polynomials<6, 5, 1>::coefficients[11][14];
+
+template <>
+struct spline_polynomials<6, 5, 2>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {1.744550540123457, -22.67915977733686, 136.07497244268077, -498.94160604056435,
+         1247.354090884039, -2245.2374545304233, 2993.65, -2993.65,
+         2245.2374545304233, -1247.354090884039, 498.94160604056435, -136.07497244268077,
+         22.67915977733686, -1.744550540123457},
+        {-6.576178451178451e-06, 8.473875661375662e-05, -0.0004667207792207792, 0.0014467592592592592,
+         -0.002738508597883598, 0.0030691964285714285, -0.001388888888888889, -0.001388888888888889,
+         0.0030691964285714285, -0.002738508597883598, 0.0014467592592592592, -0.0004667207792207792,
+         8.473875661375662e-05, -6.576178451178451e-06},
+        {-1.7575657617845117, 22.848429307960558, -137.09114628427128, 502.66968584656087,
+         -1256.678939318783, 2262.028355654762, -3016.0422222222223, 3016.0422222222223,
+         -2262.028355654762, 1256.678939318783, -502.66968584656087, 137.09114628427128,
+         -22.848429307960558, 1.7575657617845117},
+        {0.00010495580808080808, -0.001472800925925926, 0.009226641414141415, -0.032164351851851854,
+         0.0666232638888889, -0.07926215277777778, 0.036944444444444446, 0.036944444444444446,
+         -0.07926215277777778, 0.0666232638888889, -0.032164351851851854, 0.009226641414141415,
+         -0.001472800925925926, 0.00010495580808080808},
+        {0.6685526050434905, -8.69176112250982, 52.1558835753367, -191.26800250771606,
+         478.25619333526237, -860.9968641493056, 1148.1008796296296, -1148.1008796296296,
+         860.9968641493056, -478.25619333526237, 191.26800250771606, -52.1558835753367,
+         8.69176112250982, -0.6685526050434905},
+        {-0.0006042490254729838, 0.008914534419091711, -0.060852103625541124, 0.24794801311728396,
+         -0.5966697840884039, 0.7898135230654761, -0.38854993386243386, -0.38854993386243386,
+         0.7898135230654761, -0.5966697840884039, 0.24794801311728396, -0.060852103625541124,
+         0.008914534419091711, -0.0006042490254729838},
+        {-0.11547137577411015, 1.5024807772040845, -9.028448892446288, 33.19514267802028,
+         -83.43977477058532, 151.19179558325067, -202.51263227513226, 202.51263227513226,
+         -151.19179558325067, 83.43977477058532, -33.19514267802028, 9.028448892446288,
+         -1.5024807772040845, 0.11547137577411015},
+        {0.0010748536643718936, -0.016287934372244267, 0.1165823694534632, -0.5232187982253086,
+         1.612196395847112, -2.6413530040922617, 1.4510061177248677, 1.4510061177248677,
+         -2.6413530040922617, 1.612196395847112, -0.5232187982253086, 0.1165823694534632,
+         -0.016287934372244267, 0.0010748536643718936},
+        {0.0077907456689601876, -0.10190045029990505, 0.6178433317080778, -2.3115973298680004,
+         6.052830314299837, -12.541521993970115, 19.000630993716932, -19.000630993716932,
+         12.541521993970115, -6.052830314299837, 2.3115973298680004, -0.6178433317080778,
+         0.10190045029990505, -0.0077907456689601876},
+        {-0.00026262462836762967, 0.004026924684985394, -0.029429484225626804, 0.13779560607156635,
+         -0.4742610736288511, 1.3354156736343625, -0.9732850219080688, -0.9732850219080688,
+         1.3354156736343625, -0.4742610736288511, 0.13779560607156635, -0.029429484225626804,
+         0.004026924684985394, -0.00026262462836762967}};
+};
+constexpr double spline_polynomials<6, 5, 2>::coefficients[10][14];
+
+template <class real_number>
+void beta_n6_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 5, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 5, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 5, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m5<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m5<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 6, 0>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.05673064348845599, 0.7374983653499279, -4.424990192099567, 16.224964037698413,
+         -40.56241009424603, 73.01233816964286, -97.34978422619048, 97.34978422619048,
+         -73.01233816964286, 40.56241009424603, -16.224964037698413, 4.424990192099567,
+         -0.7374983653499279, 0.05673064348845599},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {0.10095551559744267, -1.3124217278188632, 7.874530492173721, -28.873278838734567,
+         72.1831977857694, -129.9297568411045, 173.23967633928572, -173.23967633928572,
+         129.9297568411045, -72.1831977857694, 28.873278838734567, -7.874530492173721,
+         1.3124217278188632, -0.10095551559744267},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-0.07759561385076794, 1.008744013459454, -6.052472003486001, 22.19242719987783,
+         -55.481133620560975, 99.8661275292452, -133.15489802069555, 133.15489802069555,
+         -99.8661275292452, 55.481133620560975, -22.19242719987783, 6.052472003486001,
+         -1.008744013459454, 0.07759561385076794},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.033646245257844654, -0.4374149325649434, 2.624616186824846, -9.624301321488279,
+         24.062805376720036, -43.31628101490162, 57.75754279996142, -57.75754279996142,
+         43.31628101490162, -24.062805376720036, 9.624301321488279, -2.624616186824846,
+         0.4374149325649434, -0.033646245257844654},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.009097629930607226, 0.11833683370492656, -0.7106992136906485, 2.6104386204849055,
+         -6.548692454988994, 11.837656468790044, -15.829720533259962, 15.829720533259962,
+         -11.837656468790044, 6.548692454988994, -2.6104386204849055, 0.7106992136906485,
+         -0.11833683370492656, 0.009097629930607226},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.0016308637256835362, -0.021304687867789742, 0.12890156552484636, -0.48033437030305587,
+         1.246475424029279, -2.518060334624437, 3.73718072423649, -3.73718072423649,
+         2.518060334624437, -1.246475424029279, 0.48033437030305587, -0.12890156552484636,
+         0.021304687867789742, -0.0016308637256835362},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00014646789224989672, 0.001925930410860873, -0.011783500993712429, 0.044857106699374476,
+         -0.12217220531219178, 0.28543563484514833, -1.4726752678469166, 1.4726752678469166,
+         -0.28543563484514833, 0.12217220531219178, -0.044857106699374476, 0.011783500993712429,
+         -0.001925930410860873, 0.00014646789224989672},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 6, 0>::coefficients[14][14];
+
+template <>
+struct spline_polynomials<6, 6, 1>
+{
+    static constexpr int degree = 12;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.7374983653499279, 9.587478749549062, -57.524872497294375, 210.92453249007937,
+         -527.3113312251984, 949.1603962053572, -1265.5471949404762, 1265.5471949404762,
+         -949.1603962053572, 527.3113312251984, -210.92453249007937, 57.524872497294375,
+         -9.587478749549062, 0.7374983653499279},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {1.1105106715718696, -14.436639006007496, 86.61983541391093, -317.60606722608026,
+         794.0151756434634, -1429.2273252521495, 1905.636439732143, -1905.636439732143,
+         1429.2273252521495, -794.0151756434634, 317.60606722608026, -86.61983541391093,
+         14.436639006007496, -1.1105106715718696},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-0.6983605246569113, 9.078696121135087, -54.47224803137401, 199.73184479890045,
+         -499.33020258504877, 898.7951477632068, -1198.39408218626, 1198.39408218626,
+         -898.7951477632068, 499.33020258504877, -199.73184479890045, 54.47224803137401,
+         -9.078696121135087, 0.6983605246569113},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {0.23552371680491255, -3.0619045279546038, 18.37231330777392, -67.37010925041795,
+         168.43963763704025, -303.21396710431134, 404.30279959972995, -404.30279959972995,
+         303.21396710431134, -168.43963763704025, 67.37010925041795, -18.37231330777392,
+         3.0619045279546038, -0.23552371680491255},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.04548814965303613, 0.5916841685246328, -3.553496068453242, 13.052193102424527,
+         -32.743462274944974, 59.18828234395022, -79.14860266629981, 79.14860266629981,
+         -59.18828234395022, 32.743462274944974, -13.052193102424527, 3.553496068453242,
+         -0.5916841685246328, 0.04548814965303613},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.004892591177050609, -0.06391406360336922, 0.3867046965745391, -1.4410031109091677,
+         3.739426272087837, -7.55418100387331, 11.21154217270947, -11.21154217270947,
+         7.55418100387331, -3.739426272087837, 1.4410031109091677, -0.3867046965745391,
+         0.06391406360336922, -0.004892591177050609},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00014646789224989672, 0.001925930410860873, -0.011783500993712429, 0.044857106699374476,
+         -0.12217220531219178, 0.28543563484514833, -1.4726752678469166, 1.4726752678469166,
+         -0.28543563484514833, 0.12217220531219178, -0.044857106699374476, 0.011783500993712429,
+         -0.001925930410860873, 0.00014646789224989672}};
+};
+constexpr double spline_polynomials<6, 6, 1>::coefficients[13][14];
+
+template <>
+struct spline_polynomials<6, 6, 2>
+{
+    static constexpr int degree = 11;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-8.849980384199133, 115.04974499458875, -690.2984699675325, 2531.0943898809523,
+         -6327.735974702381, 11389.924754464286, -15186.566339285715, 15186.566339285715,
+         -11389.924754464286, 6327.735974702381, -2531.0943898809523, 690.2984699675325,
+         -115.04974499458875, 8.849980384199133},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {11.105106715718694, -144.36639006007496, 866.1983541391094, -3176.0606722608027,
+         7940.151756434634, -14292.273252521494, 19056.364397321428, -19056.364397321428,
+         14292.273252521494, -7940.151756434634, 3176.0606722608027, -866.1983541391094,
+         144.36639006007496, -11.105106715718694},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-5.586884197255291, 72.6295689690807, -435.77798425099206, 1597.8547583912036,
+         -3994.64162068039, 7190.361182105655, -9587.15265749008, 9587.15265749008,
+         -7190.361182105655, 3994.64162068039, -1597.8547583912036, 435.77798425099206,
+         -72.6295689690807, 5.586884197255291},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {1.4131423008294752, -18.371427167727624, 110.23387984664352, -404.2206555025077,
+         1010.6378258222416, -1819.283802625868, 2425.8167975983797, -2425.8167975983797,
+         1819.283802625868, -1010.6378258222416, 404.2206555025077, -110.23387984664352,
+         18.371427167727624, -1.4131423008294752},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.18195259861214452, 2.366736674098531, -14.213984273812969, 52.208772409698106,
+         -130.9738490997799, 236.75312937580088, -316.59441066519923, 316.59441066519923,
+         -236.75312937580088, 130.9738490997799, -52.208772409698106, 14.213984273812969,
+         -2.366736674098531, 0.18195259861214452},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.009785182354101219, -0.12782812720673845, 0.7734093931490782, -2.8820062218183353,
+         7.478852544175674, -15.10836200774662, 22.42308434541894, -22.42308434541894,
+         15.10836200774662, -7.478852544175674, 2.8820062218183353, -0.7734093931490782,
+         0.12782812720673845, -0.009785182354101219},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 6, 2>::coefficients[12][14];
+
+template <class real_number>
+void beta_n6_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 6, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 6, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 6, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m10(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-47174681.0L/4354560.0L*x + 47174681.0L/414720.0L) - 837938401.0L/1555200.0L) + 349395769.0L/230400.0L) - 2912855069.0L/1036800.0L) + 1485152419.0L/414720.0L) - 1979375821.0L/622080.0L) + 28259090669.0L/14515200.0L) - 94064276017.0L/119750400.0L) + 90455812441.0L/479001600.0L) - 1865083.0L/90720.0L) - 1.0L/8709120.0L) + 1.0L/1451520.0L) + 31.0L/14515200.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/4354560.0L)*x - 613270853.0L/414720.0L) + 10893199213.0L/1555200.0L) - 4542144997.0L/230400.0L) + 37867115897.0L/1036800.0L) - 19306981447.0L/414720.0L) + 25731885673.0L/622080.0L) - 367368178697.0L/14515200.0L) + 1222835588221.0L/119750400.0L) - 32664598937.0L/13305600.0L) + 21336549517.0L/79833600.0L) + 1.0L/604800.0L) - 1.0L/120960.0L) - 41.0L/1209600.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/725760.0L*x + 613270853.0L/69120.0L) - 10893199213.0L/259200.0L) + 4542144997.0L/38400.0L) - 37867115897.0L/172800.0L) + 19306981447.0L/69120.0L) - 25731885673.0L/103680.0L) + 367368178697.0L/2419200.0L) - 1222835588221.0L/19958400.0L) + 1175925561731.0L/79833600.0L) - 64009648543.0L/39916800.0L) - 1.0L/96768.0L) + 1.0L/24192.0L) + 601.0L/2419200.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/2177280.0L)*x - 6745979383.0L/207360.0L) + 119825191343.0L/777600.0L) - 49963594967.0L/115200.0L) + 416538274867.0L/518400.0L) - 212376795917.0L/207360.0L) + 283050742403.0L/311040.0L) - 4041049965667.0L/7257600.0L) + 1222835588221.0L/5443200.0L) - 117592556173.0L/2177280.0L) + 2667068689.0L/453600.0L) + 41.0L/1088640.0L) - 41.0L/362880.0L) - 151.0L/145152.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/870912.0L*x + 6745979383.0L/82944.0L) - 119825191343.0L/311040.0L) + 49963594967.0L/46080.0L) - 416538274867.0L/207360.0L) + 212376795917.0L/82944.0L) - 283050742403.0L/124416.0L) + 4041049965667.0L/2903040.0L) - 1222835588221.0L/2177280.0L) + 391975187243.0L/2903040.0L) - 711218317.0L/48384.0L) - 29.0L/322560.0L) + 29.0L/161280.0L) + 59.0L/21504.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/483840.0L)*x - 6745979383.0L/46080.0L) + 119825191343.0L/172800.0L) - 49963594967.0L/25600.0L) + 416538274867.0L/115200.0L) - 212376795917.0L/46080.0L) + 283050742403.0L/69120.0L) - 4041049965667.0L/1612800.0L) + 1222835588221.0L/1209600.0L) - 9186918451.0L/37800.0L) + 2560385941.0L/96768.0L) + 1.0L/6720.0L) - 1.0L/6720.0L) - 971.0L/201600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/362880.0L*x + 6745979383.0L/34560.0L) - 119825191343.0L/129600.0L) + 49963594967.0L/19200.0L) - 416538274867.0L/86400.0L) + 212376795917.0L/34560.0L) - 283050742403.0L/51840.0L) + 4041049965667.0L/1209600.0L) - 1222835588221.0L/907200.0L) + 167989365961.0L/518400.0L) - 338675389.0L/9600.0L) - 91.0L/518400.0L) + 1001.0L/172800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/362880.0L)*x - 6745979383.0L/34560.0L) + 119825191343.0L/129600.0L) - 49963594967.0L/19200.0L) + 416538274867.0L/86400.0L) - 212376795917.0L/34560.0L) + 283050742403.0L/51840.0L) - 4041049965667.0L/1209600.0L) + 1222835588221.0L/907200.0L) - 195987593621.0L/604800.0L) + 10668274753.0L/302400.0L) + 1.0L/6720.0L) + 1.0L/6720.0L) - 971.0L/201600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/483840.0L*x + 6745979383.0L/46080.0L) - 119825191343.0L/172800.0L) + 49963594967.0L/25600.0L) - 416538274867.0L/115200.0L) + 212376795917.0L/46080.0L) - 283050742403.0L/69120.0L) + 4041049965667.0L/1612800.0L) - 1222835588221.0L/1209600.0L) + 47037022469.0L/193536.0L) - 16002412129.0L/604800.0L) - 29.0L/322560.0L) - 29.0L/161280.0L) + 59.0L/21504.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/870912.0L)*x - 6745979383.0L/82944.0L) + 119825191343.0L/311040.0L) - 49963594967.0L/46080.0L) + 416538274867.0L/207360.0L) - 212376795917.0L/82944.0L) + 283050742403.0L/124416.0L) - 4041049965667.0L/2903040.0L) + 1222835588221.0L/2177280.0L) - 293981390431.0L/2177280.0L) + 4267309901.0L/290304.0L) + 41.0L/1088640.0L) + 41.0L/362880.0L) - 151.0L/145152.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/2177280.0L*x + 6745979383.0L/207360.0L) - 119825191343.0L/777600.0L) + 49963594967.0L/115200.0L) - 416538274867.0L/518400.0L) + 212376795917.0L/207360.0L) - 283050742403.0L/311040.0L) + 4041049965667.0L/7257600.0L) - 1222835588221.0L/5443200.0L) + 130658395747.0L/2419200.0L) - 4267309901.0L/725760.0L) - 1.0L/96768.0L) - 1.0L/24192.0L) + 601.0L/2419200.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/725760.0L)*x - 613270853.0L/69120.0L) + 10893199213.0L/259200.0L) - 4542144997.0L/38400.0L) + 37867115897.0L/172800.0L) - 19306981447.0L/69120.0L) + 25731885673.0L/103680.0L) - 367368178697.0L/2419200.0L) + 1222835588221.0L/19958400.0L) - 587962780861.0L/39916800.0L) + 1454764739.0L/907200.0L) + 1.0L/604800.0L) + 1.0L/120960.0L) - 41.0L/1209600.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/4354560.0L*x + 613270853.0L/414720.0L) - 10893199213.0L/1555200.0L) + 4542144997.0L/230400.0L) - 37867115897.0L/1036800.0L) + 19306981447.0L/414720.0L) - 25731885673.0L/622080.0L) + 367368178697.0L/14515200.0L) - 1222835588221.0L/119750400.0L) + 1175925561721.0L/479001600.0L) - 10668274753.0L/39916800.0L) - 1.0L/8709120.0L) - 1.0L/1451520.0L) + 31.0L/14515200.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 11)*(x*(x*(x*(x*(x*(x*(x*(x*(x*((47174681.0L/4354560.0L)*x - 47174681.0L/414720.0L) + 837938401.0L/1555200.0L) - 349395769.0L/230400.0L) + 2912855069.0L/1036800.0L) - 1485152419.0L/414720.0L) + 1979375821.0L/622080.0L) - 28259090669.0L/14515200.0L) + 94064276017.0L/119750400.0L) - 107685491.0L/570240.0L) + 26051953.0L/1267200.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-47174681.0L/207360.0L*x + 47174681.0L/20736.0L) - 15920829619.0L/1555200.0L) + 349395769.0L/12800.0L) - 49518536173.0L/1036800.0L) + 1485152419.0L/25920.0L) - 1979375821.0L/41472.0L) + 28259090669.0L/1036800.0L) - 1222835588221.0L/119750400.0L) + 90455812441.0L/39916800.0L) - 20515913.0L/90720.0L) - 1.0L/870912.0L) + 1.0L/161280.0L) + 31.0L/1814400.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/207360.0L)*x - 613270853.0L/20736.0L) + 206970785047.0L/1555200.0L) - 4542144997.0L/12800.0L) + 643740970249.0L/1036800.0L) - 19306981447.0L/25920.0L) + 25731885673.0L/41472.0L) - 367368178697.0L/1036800.0L) + 15896862646873.0L/119750400.0L) - 32664598937.0L/1108800.0L) + 21336549517.0L/7257600.0L) + 1.0L/60480.0L) - 1.0L/13440.0L) - 41.0L/151200.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/34560.0L*x + 613270853.0L/3456.0L) - 206970785047.0L/259200.0L) + 13626434991.0L/6400.0L) - 643740970249.0L/172800.0L) + 19306981447.0L/4320.0L) - 25731885673.0L/6912.0L) + 367368178697.0L/172800.0L) - 15896862646873.0L/19958400.0L) + 1175925561731.0L/6652800.0L) - 64009648543.0L/3628800.0L) - 5.0L/48384.0L) + 1.0L/2688.0L) + 601.0L/302400.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/103680.0L)*x - 6745979383.0L/10368.0L) + 2276678635517.0L/777600.0L) - 49963594967.0L/6400.0L) + 7081150672739.0L/518400.0L) - 212376795917.0L/12960.0L) + 283050742403.0L/20736.0L) - 4041049965667.0L/518400.0L) + 15896862646873.0L/5443200.0L) - 117592556173.0L/181440.0L) + 29337755579.0L/453600.0L) + 41.0L/108864.0L) - 41.0L/40320.0L) - 151.0L/18144.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/41472.0L*x + 33729896915.0L/20736.0L) - 2276678635517.0L/311040.0L) + 49963594967.0L/2560.0L) - 7081150672739.0L/207360.0L) + 212376795917.0L/5184.0L) - 1415253712015.0L/41472.0L) + 4041049965667.0L/207360.0L) - 15896862646873.0L/2177280.0L) + 391975187243.0L/241920.0L) - 7823401487.0L/48384.0L) - 29.0L/32256.0L) + 29.0L/17920.0L) + 59.0L/2688.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/23040.0L)*x - 6745979383.0L/2304.0L) + 2276678635517.0L/172800.0L) - 449672354703.0L/12800.0L) + 7081150672739.0L/115200.0L) - 212376795917.0L/2880.0L) + 283050742403.0L/4608.0L) - 4041049965667.0L/115200.0L) + 15896862646873.0L/1209600.0L) - 9186918451.0L/3150.0L) + 28164245351.0L/96768.0L) + 1.0L/672.0L) - 3.0L/2240.0L) - 971.0L/25200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/17280.0L*x + 6745979383.0L/1728.0L) - 2276678635517.0L/129600.0L) + 149890784901.0L/3200.0L) - 7081150672739.0L/86400.0L) + 212376795917.0L/2160.0L) - 283050742403.0L/3456.0L) + 4041049965667.0L/86400.0L) - 15896862646873.0L/907200.0L) + 167989365961.0L/43200.0L) - 3725429279.0L/9600.0L) - 91.0L/51840.0L) + 1001.0L/21600.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/17280.0L)*x - 6745979383.0L/1728.0L) + 2276678635517.0L/129600.0L) - 149890784901.0L/3200.0L) + 7081150672739.0L/86400.0L) - 212376795917.0L/2160.0L) + 283050742403.0L/3456.0L) - 4041049965667.0L/86400.0L) + 15896862646873.0L/907200.0L) - 195987593621.0L/50400.0L) + 117351022283.0L/302400.0L) + 1.0L/672.0L) + 3.0L/2240.0L) - 971.0L/25200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/23040.0L*x + 6745979383.0L/2304.0L) - 2276678635517.0L/172800.0L) + 449672354703.0L/12800.0L) - 7081150672739.0L/115200.0L) + 212376795917.0L/2880.0L) - 283050742403.0L/4608.0L) + 4041049965667.0L/115200.0L) - 15896862646873.0L/1209600.0L) + 47037022469.0L/16128.0L) - 176026533419.0L/604800.0L) - 29.0L/32256.0L) - 29.0L/17920.0L) + 59.0L/2688.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/41472.0L)*x - 33729896915.0L/20736.0L) + 2276678635517.0L/311040.0L) - 49963594967.0L/2560.0L) + 7081150672739.0L/207360.0L) - 212376795917.0L/5184.0L) + 1415253712015.0L/41472.0L) - 4041049965667.0L/207360.0L) + 15896862646873.0L/2177280.0L) - 293981390431.0L/181440.0L) + 46940408911.0L/290304.0L) + 41.0L/108864.0L) + 41.0L/40320.0L) - 151.0L/18144.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/103680.0L*x + 6745979383.0L/10368.0L) - 2276678635517.0L/777600.0L) + 49963594967.0L/6400.0L) - 7081150672739.0L/518400.0L) + 212376795917.0L/12960.0L) - 283050742403.0L/20736.0L) + 4041049965667.0L/518400.0L) - 15896862646873.0L/5443200.0L) + 130658395747.0L/201600.0L) - 46940408911.0L/725760.0L) - 5.0L/48384.0L) - 1.0L/2688.0L) + 601.0L/302400.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/34560.0L)*x - 613270853.0L/3456.0L) + 206970785047.0L/259200.0L) - 13626434991.0L/6400.0L) + 643740970249.0L/172800.0L) - 19306981447.0L/4320.0L) + 25731885673.0L/6912.0L) - 367368178697.0L/172800.0L) + 15896862646873.0L/19958400.0L) - 587962780861.0L/3326400.0L) + 16002412129.0L/907200.0L) + 1.0L/60480.0L) + 1.0L/13440.0L) - 41.0L/151200.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/207360.0L*x + 613270853.0L/20736.0L) - 206970785047.0L/1555200.0L) + 4542144997.0L/12800.0L) - 643740970249.0L/1036800.0L) + 19306981447.0L/25920.0L) - 25731885673.0L/41472.0L) + 367368178697.0L/1036800.0L) - 15896862646873.0L/119750400.0L) + 1175925561721.0L/39916800.0L) - 10668274753.0L/3628800.0L) - 1.0L/870912.0L) - 1.0L/161280.0L) + 31.0L/1814400.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 10)*(x*(x*(x*(x*(x*(x*(x*(x*(x*((47174681.0L/207360.0L)*x - 47174681.0L/20736.0L) + 15920829619.0L/1555200.0L) - 349395769.0L/12800.0L) + 49518536173.0L/1036800.0L) - 1485152419.0L/25920.0L) + 1979375821.0L/41472.0L) - 28259090669.0L/1036800.0L) + 1222835588221.0L/119750400.0L) - 107685491.0L/47520.0L) + 26051953.0L/115200.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-47174681.0L/10368.0L*x + 896318939.0L/20736.0L) - 15920829619.0L/86400.0L) + 5939728073.0L/12800.0L) - 49518536173.0L/64800.0L) + 1485152419.0L/1728.0L) - 13855630747.0L/20736.0L) + 367368178697.0L/1036800.0L) - 1222835588221.0L/9979200.0L) + 90455812441.0L/3628800.0L) - 20515913.0L/9072.0L) - 1.0L/96768.0L) + 1.0L/20160.0L) + 31.0L/259200.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/10368.0L)*x - 11652146207.0L/20736.0L) + 206970785047.0L/86400.0L) - 77216464949.0L/12800.0L) + 643740970249.0L/64800.0L) - 19306981447.0L/1728.0L) + 180123199711.0L/20736.0L) - 4775786323061.0L/1036800.0L) + 15896862646873.0L/9979200.0L) - 32664598937.0L/100800.0L) + 21336549517.0L/725760.0L) + 1.0L/6720.0L) - 1.0L/1680.0L) - 41.0L/21600.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/1728.0L*x + 11652146207.0L/3456.0L) - 206970785047.0L/14400.0L) + 231649394847.0L/6400.0L) - 643740970249.0L/10800.0L) + 19306981447.0L/288.0L) - 180123199711.0L/3456.0L) + 4775786323061.0L/172800.0L) - 15896862646873.0L/1663200.0L) + 1175925561731.0L/604800.0L) - 64009648543.0L/362880.0L) - 5.0L/5376.0L) + 1.0L/336.0L) + 601.0L/43200.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/5184.0L)*x - 128173608277.0L/10368.0L) + 2276678635517.0L/43200.0L) - 849381114439.0L/6400.0L) + 7081150672739.0L/32400.0L) - 212376795917.0L/864.0L) + 1981355196821.0L/10368.0L) - 52533649553671.0L/518400.0L) + 15896862646873.0L/453600.0L) - 1293518117903.0L/181440.0L) + 29337755579.0L/45360.0L) + 41.0L/12096.0L) - 41.0L/5040.0L) - 151.0L/2592.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-33729896915.0L/10368.0L*x + 640868041385.0L/20736.0L) - 2276678635517.0L/17280.0L) + 849381114439.0L/2560.0L) - 7081150672739.0L/12960.0L) + 1061883979585.0L/1728.0L) - 9906775984105.0L/20736.0L) + 52533649553671.0L/207360.0L) - 15896862646873.0L/181440.0L) + 4311727059673.0L/241920.0L) - 39117007435.0L/24192.0L) - 29.0L/3584.0L) + 29.0L/2240.0L) + 59.0L/384.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/1152.0L)*x - 128173608277.0L/2304.0L) + 2276678635517.0L/9600.0L) - 7644430029951.0L/12800.0L) + 7081150672739.0L/7200.0L) - 212376795917.0L/192.0L) + 1981355196821.0L/2304.0L) - 52533649553671.0L/115200.0L) + 15896862646873.0L/100800.0L) - 101056102961.0L/3150.0L) + 140821226755.0L/48384.0L) + 3.0L/224.0L) - 3.0L/280.0L) - 971.0L/3600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/864.0L*x + 128173608277.0L/1728.0L) - 2276678635517.0L/7200.0L) + 2548143343317.0L/3200.0L) - 7081150672739.0L/5400.0L) + 212376795917.0L/144.0L) - 1981355196821.0L/1728.0L) + 52533649553671.0L/86400.0L) - 15896862646873.0L/75600.0L) + 1847883025571.0L/43200.0L) - 3725429279.0L/960.0L) - 91.0L/5760.0L) + 7007.0L/21600.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((6745979383.0L/864.0L)*x - 128173608277.0L/1728.0L) + 2276678635517.0L/7200.0L) - 2548143343317.0L/3200.0L) + 7081150672739.0L/5400.0L) - 212376795917.0L/144.0L) + 1981355196821.0L/1728.0L) - 52533649553671.0L/86400.0L) + 15896862646873.0L/75600.0L) - 2155863529831.0L/50400.0L) + 117351022283.0L/30240.0L) + 3.0L/224.0L) + 3.0L/280.0L) - 971.0L/3600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/1152.0L*x + 128173608277.0L/2304.0L) - 2276678635517.0L/9600.0L) + 7644430029951.0L/12800.0L) - 7081150672739.0L/7200.0L) + 212376795917.0L/192.0L) - 1981355196821.0L/2304.0L) + 52533649553671.0L/115200.0L) - 15896862646873.0L/100800.0L) + 517407247159.0L/16128.0L) - 176026533419.0L/60480.0L) - 29.0L/3584.0L) - 29.0L/2240.0L) + 59.0L/384.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((33729896915.0L/10368.0L)*x - 640868041385.0L/20736.0L) + 2276678635517.0L/17280.0L) - 849381114439.0L/2560.0L) + 7081150672739.0L/12960.0L) - 1061883979585.0L/1728.0L) + 9906775984105.0L/20736.0L) - 52533649553671.0L/207360.0L) + 15896862646873.0L/181440.0L) - 3233795294741.0L/181440.0L) + 234702044555.0L/145152.0L) + 41.0L/12096.0L) + 41.0L/5040.0L) - 151.0L/2592.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-6745979383.0L/5184.0L*x + 128173608277.0L/10368.0L) - 2276678635517.0L/43200.0L) + 849381114439.0L/6400.0L) - 7081150672739.0L/32400.0L) + 212376795917.0L/864.0L) - 1981355196821.0L/10368.0L) + 52533649553671.0L/518400.0L) - 15896862646873.0L/453600.0L) + 1437242353217.0L/201600.0L) - 46940408911.0L/72576.0L) - 5.0L/5376.0L) - 1.0L/336.0L) + 601.0L/43200.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((613270853.0L/1728.0L)*x - 11652146207.0L/3456.0L) + 206970785047.0L/14400.0L) - 231649394847.0L/6400.0L) + 643740970249.0L/10800.0L) - 19306981447.0L/288.0L) + 180123199711.0L/3456.0L) - 4775786323061.0L/172800.0L) + 15896862646873.0L/1663200.0L) - 587962780861.0L/302400.0L) + 16002412129.0L/90720.0L) + 1.0L/6720.0L) + 1.0L/1680.0L) - 41.0L/21600.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-613270853.0L/10368.0L*x + 11652146207.0L/20736.0L) - 206970785047.0L/86400.0L) + 77216464949.0L/12800.0L) - 643740970249.0L/64800.0L) + 19306981447.0L/1728.0L) - 180123199711.0L/20736.0L) + 4775786323061.0L/1036800.0L) - 15896862646873.0L/9979200.0L) + 1175925561721.0L/3628800.0L) - 10668274753.0L/362880.0L) - 1.0L/96768.0L) - 1.0L/20160.0L) + 31.0L/259200.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 9)*(x*(x*(x*(x*(x*(x*(x*(x*(x*((47174681.0L/10368.0L)*x - 896318939.0L/20736.0L) + 15920829619.0L/86400.0L) - 5939728073.0L/12800.0L) + 49518536173.0L/64800.0L) - 1485152419.0L/1728.0L) + 13855630747.0L/20736.0L) - 367368178697.0L/1036800.0L) + 1222835588221.0L/9979200.0L) - 107685491.0L/4320.0L) + 26051953.0L/11520.0L);
-break;
+
+template void beta_n6_m6<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m6<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 7, 0>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.2071814833186361, -2.6933592831422692, 16.160155698853615, -59.25390422912992,
+         148.1347605728248, -266.64256903108463, 355.52342537477955, -355.52342537477955,
+         266.64256903108463, -148.1347605728248, 59.25390422912992, -16.160155698853615,
+         2.6933592831422692, -0.2071814833186361},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-0.41929823929606913, 5.450877110848899, -32.70526266509339, 119.91929643867577,
+         -299.7982410966894, 539.636833974041, -719.5157786320547, 719.5157786320547,
+         -539.636833974041, 299.7982410966894, -119.91929643867577, 32.70526266509339,
+         -5.450877110848899, 0.41929823929606913},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {0.37288121245315253, -4.847455786943091, 29.08473484691909, -106.6440281394676,
+         266.610071037602, -479.8981286944031, 639.8641721436838, -639.8641721436838,
+         479.8981286944031, -266.610071037602, 106.6440281394676, -29.08473484691909,
+         4.847455786943091, -0.37288121245315253},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-0.19089798754064705, 2.4816748714278827, -14.890057151296572, 54.596906075183256,
+         -136.49233080882453, 245.68628246811963, -327.5817712725281, 327.5817712725281,
+         -245.68628246811963, 136.49233080882453, -54.596906075183256, 14.890057151296572,
+         -2.4816748714278827, 0.19089798754064705},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.06197183868031443, -0.8056476470570505, 4.834012473777489, -17.725421040314636,
+         44.31560467378593, -79.77131974962023, 106.36426111291956, -106.36426111291956,
+         79.77131974962023, -44.31560467378593, 17.725421040314636, -4.834012473777489,
+         0.8056476470570505, -0.06197183868031443},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.013346468943977693, 0.17357174087874264, -1.042108656733545, 3.825606578308859,
+         -9.586612349548878, 17.305912278997834, -23.120728280203682, 23.120728280203682,
+         -17.305912278997834, 9.586612349548878, -3.825606578308859, 1.042108656733545,
+         -0.17357174087874264, 0.013346468943977693},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.0019849336434644084, -0.02590759679894108, 0.1565190191117544, -0.5815983667883854,
+         1.4996354152426028, -2.9737483188084193, 4.344764703148467, -4.344764703148467,
+         2.9737483188084193, -1.4996354152426028, 0.5815983667883854, -0.1565190191117544,
+         0.02590759679894108, -0.0019849336434644084},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00015911324645635644, 0.0020903200155448494, -0.012769838621816288, 0.04847367800242196,
+         -0.13121363356981047, 0.301710205708862, -1.4943746956652013, 1.4943746956652013,
+         -0.301710205708862, 0.13121363356981047, -0.04847367800242196, 0.012769838621816288,
+         -0.0020903200155448494, 0.00015911324645635644},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 7, 0>::coefficients[16][14];
+
+template <>
+struct spline_polynomials<6, 7, 1>
+{
+    static constexpr int degree = 14;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.1077222497795414, -40.40038924713404, 242.40233548280423, -888.8085634369488,
+         2222.021408592372, -3999.63853546627, 5332.851380621693, -5332.851380621693,
+         3999.63853546627, -2222.021408592372, 888.8085634369488, -242.40233548280423,
+         40.40038924713404, -3.1077222497795414},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-5.450877110848899, 70.8614024410357, -425.1684146462141, 1558.950853702785,
+         -3897.377134256963, 7015.2788416625335, -9353.70512221671, 9353.70512221671,
+         -7015.2788416625335, 3897.377134256963, -1558.950853702785, 425.1684146462141,
+         -70.8614024410357, 5.450877110848899},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {4.101693336984678, -53.32201365637401, 319.93208331611, -1173.0843095341436,
+         2932.7107814136216, -5278.879415638434, 7038.505893580523, -7038.505893580523,
+         5278.879415638434, -2932.7107814136216, 1173.0843095341436, -319.93208331611,
+         53.32201365637401, -4.101693336984678},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-1.7180818878658235, 22.335073842850942, -134.01051436166915, 491.3721546766493,
+         -1228.4309772794209, 2211.1765422130766, -2948.235941452753, 2948.235941452753,
+         -2211.1765422130766, 1228.4309772794209, -491.3721546766493, 134.01051436166915,
+         -22.335073842850942, 1.7180818878658235},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {0.433802870762201, -5.639533529399354, 33.83808731644242, -124.07794728220244,
+         310.2092327165015, -558.3992382473416, 744.5498277904369, -744.5498277904369,
+         558.3992382473416, -310.2092327165015, 124.07794728220244, -33.83808731644242,
+         5.639533529399354, -0.433802870762201},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.06673234471988847, 0.8678587043937132, -5.210543283667724, 19.128032891544294,
+         -47.93306174774439, 86.52956139498917, -115.60364140101842, 115.60364140101842,
+         -86.52956139498917, 47.93306174774439, -19.128032891544294, 5.210543283667724,
+         -0.8678587043937132, 0.06673234471988847},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.005954800930393226, -0.07772279039682324, 0.4695570573352632, -1.744795100365156,
+         4.498906245727809, -8.921244956425259, 13.0342941094454, -13.0342941094454,
+         8.921244956425259, -4.498906245727809, 1.744795100365156, -0.4695570573352632,
+         0.07772279039682324, -0.005954800930393226},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00015911324645635644, 0.0020903200155448494, -0.012769838621816288, 0.04847367800242196,
+         -0.13121363356981047, 0.301710205708862, -1.4943746956652013, 1.4943746956652013,
+         -0.301710205708862, 0.13121363356981047, -0.04847367800242196, 0.012769838621816288,
+         -0.0020903200155448494, 0.00015911324645635644}};
+};
+constexpr double spline_polynomials<6, 7, 1>::coefficients[15][14];
+
+template <>
+struct spline_polynomials<6, 7, 2>
+{
+    static constexpr int degree = 13;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {43.50811149691358, -565.6054494598766, 3393.632696759259, -12443.319888117285,
+         31108.29972029321, -55994.939496527775, 74659.9193287037, -74659.9193287037,
+         55994.939496527775, -31108.29972029321, 12443.319888117285, -3393.632696759259,
+         565.6054494598766, -43.50811149691358},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-65.41052533018679, 850.3368292924282, -5102.02097575457, 18707.41024443342,
+         -46768.525611083554, 84183.3460999504, -112244.46146660054, 112244.46146660054,
+         -84183.3460999504, 46768.525611083554, -18707.41024443342, 5102.02097575457,
+         -850.3368292924282, 65.41052533018679},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {41.01693336984678, -533.2201365637401, 3199.3208331611, -11730.843095341435,
+         29327.107814136216, -52788.79415638434, 70385.05893580522, -70385.05893580522,
+         52788.79415638434, -29327.107814136216, 11730.843095341435, -3199.3208331611,
+         533.2201365637401, -41.01693336984678},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-13.744655102926588, 178.68059074280754, -1072.0841148933532, 3930.9772374131944,
+         -9827.447818235367, 17689.412337704613, -23585.887531622026, 23585.887531622026,
+         -17689.412337704613, 9827.447818235367, -3930.9772374131944, 1072.0841148933532,
+         -178.68059074280754, 13.744655102926588},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {2.602817224573206, -33.83720117639612, 203.02852389865453, -744.4676836932147,
+         1861.255396299009, -3350.3954294840496, 4467.298966742622, -4467.298966742622,
+         3350.3954294840496, -1861.255396299009, 744.4676836932147, -203.02852389865453,
+         33.83720117639612, -2.602817224573206},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.26692937887955387, 3.4714348175748526, -20.842173134670897, 76.51213156617717,
+         -191.73224699097756, 346.1182455799567, -462.4145656040737, 462.4145656040737,
+         -346.1182455799567, 191.73224699097756, -76.51213156617717, 20.842173134670897,
+         -3.4714348175748526, 0.26692937887955387},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.011909601860786451, -0.15544558079364648, 0.9391141146705264, -3.489590200730312,
+         8.997812491455617, -17.842489912850517, 26.0685882188908, -26.0685882188908,
+         17.842489912850517, -8.997812491455617, 3.489590200730312, -0.9391141146705264,
+         0.15544558079364648, -0.011909601860786451},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 7, 2>::coefficients[14][14];
+
+template <class real_number>
+void beta_n6_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 7, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 7, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 7, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m7<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m7<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 8, 0>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.7674188436948853, 9.97644496803351, -59.85866980820106, 219.48178929673722,
+         -548.7044732418431, 987.6680518353174, -1316.8907357804233, 1316.8907357804233,
+         -987.6680518353174, 548.7044732418431, -219.48178929673722, 59.85866980820106,
+         -9.97644496803351, 0.7674188436948853},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {1.7420191707084067, -22.646249219209288, 135.87749531525574, -498.2174828226043,
+         1245.5437070565108, -2241.9786727017195, 2989.304896935626, -2989.304896935626,
+         2241.9786727017195, -1245.5437070565108, 498.2174828226043, -135.87749531525574,
+         22.646249219209288, -1.7420191707084067},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-1.7622812157621186, 22.90965580490754, -137.45793482944524, 504.0124277079659,
+         -1260.0310692699147, 2268.0559246858465, -3024.0745662477952, 3024.0745662477952,
+         -2268.0559246858465, 1260.0310692699147, -504.0124277079659, 137.45793482944524,
+         -22.90965580490754, 1.7622812157621186},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {1.0443727006861772, -13.576845133972412, 81.46107092909502, -298.69059377411264,
+         746.7264851242146, -1344.1076740503058, 1792.1435659515541, -1792.1435659515541,
+         1344.1076740503058, -746.7264851242146, 298.69059377411264, -81.46107092909502,
+         13.576845133972412, -1.0443727006861772},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-0.4007390776134673, 5.209609042374545, -31.25766217697655, 114.61145783600983,
+         -286.528710210891, 515.7517653918393, -687.6690818374876, 687.6690818374876,
+         -515.7517653918393, 286.528710210891, -114.61145783600983, 31.25766217697655,
+         -5.209609042374545, 0.4007390776134673},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.10394005669487848, -1.351234481246383, 8.107533478913483, -29.72833139247995,
+         74.32288055419922, -133.78441633436415, 178.38172322591146, -178.38172322591146,
+         133.78441633436415, -74.32288055419922, 29.72833139247995, -8.107533478913483,
+         1.351234481246383, -0.10394005669487848},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.018592496195798197, 0.2417700951524092, -1.4512987823755443, 5.3259703723295235,
+         -13.337521834600539, 24.057549352090824, -32.12291104432767, 32.12291104432767,
+         -24.057549352090824, 13.337521834600539, -5.3259703723295235, 1.4512987823755443,
+         -0.2417700951524092, 0.018592496195798197},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.002359649875737302, -0.030778907818488695, 0.18574688522904007, -0.6887672092184328,
+         1.7675575213177215, -3.456008109743633, 4.987777757728751, -4.987777757728751,
+         3.456008109743633, -1.7675575213177215, 0.6887672092184328, -0.18574688522904007,
+         0.030778907818488695, -0.002359649875737302},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00017082312871488436, 0.0022425484849057124, -0.013683209437981465, 0.05182270432836094,
+         -0.13958619938465794, 0.3167808241755874, -1.5144688536208353, 1.5144688536208353,
+         -0.3167808241755874, 0.13958619938465794, -0.05182270432836094, 0.013683209437981465,
+         -0.0022425484849057124, 0.00017082312871488436},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 8, 0>::coefficients[18][14];
+
+template <>
+struct spline_polynomials<6, 8, 1>
+{
+    static constexpr int degree = 16;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-13.046120342813051, 169.59956445656965, -1017.597386739418, 3731.1904180445326,
+         -9327.97604511133, 16790.356881200398, -22387.142508267196, 22387.142508267196,
+         -16790.356881200398, 9327.97604511133, -3731.1904180445326, 1017.597386739418,
+         -169.59956445656965, 13.046120342813051},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {26.1302875606261, -339.69373828813934, 2038.162429728836, -7473.262242339065,
+         18683.155605847664, -33629.68009052579, 44839.57345403439, -44839.57345403439,
+         33629.68009052579, -18683.155605847664, 7473.262242339065, -2038.162429728836,
+         339.69373828813934, -26.1302875606261},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-22.90965580490754, 297.82552546379804, -1786.9531527827883, 6552.161560203556,
+         -16380.403900508893, 29484.727020916005, -39312.96936122134, 39312.96936122134,
+         -29484.727020916005, 16380.403900508893, -6552.161560203556, 1786.9531527827883,
+         -297.82552546379804, 22.90965580490754},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {11.48809970754795, -149.34529647369655, 896.0717802200452, -3285.5965315152393,
+         8213.99133636636, -14785.184414553365, 19713.579225467096, -19713.579225467096,
+         14785.184414553365, -8213.99133636636, 3285.5965315152393, -896.0717802200452,
+         149.34529647369655, -11.48809970754795},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-3.606651698521205, 46.886481381370906, -281.31895959278893, 1031.5031205240884,
+         -2578.758391898019, 4641.765888526553, -6189.021736537388, 6189.021736537388,
+         -4641.765888526553, 2578.758391898019, -1031.5031205240884, 281.31895959278893,
+         -46.886481381370906, 3.606651698521205},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {0.7275803968641493, -9.458641368724681, 56.752734352394384, -208.09831974735965,
+         520.2601638793946, -936.490914340549, 1248.6720625813803, -1248.6720625813803,
+         936.490914340549, -520.2601638793946, 208.09831974735965, -56.752734352394384,
+         9.458641368724681, -0.7275803968641493},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.09296248097899099, 1.208850475762046, -7.256493911877722, 26.62985186164762,
+         -66.6876091730027, 120.28774676045413, -160.61455522163834, 160.61455522163834,
+         -120.28774676045413, 66.6876091730027, -26.62985186164762, 7.256493911877722,
+         -1.208850475762046, 0.09296248097899099},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.007078949627211906, -0.09233672345546608, 0.5572406556871202, -2.0663016276552986,
+         5.302672563953164, -10.368024329230899, 14.963333273186255, -14.963333273186255,
+         10.368024329230899, -5.302672563953164, 2.0663016276552986, -0.5572406556871202,
+         0.09233672345546608, -0.007078949627211906},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00017082312871488436, 0.0022425484849057124, -0.013683209437981465, 0.05182270432836094,
+         -0.13958619938465794, 0.3167808241755874, -1.5144688536208353, 1.5144688536208353,
+         -0.3167808241755874, 0.13958619938465794, -0.05182270432836094, 0.013683209437981465,
+         -0.0022425484849057124, 0.00017082312871488436}};
+};
+constexpr double spline_polynomials<6, 8, 1>::coefficients[17][14];
+
+template <>
+struct spline_polynomials<6, 8, 2>
+{
+    static constexpr int degree = 15;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-208.73792548500882, 2713.5930313051144, -16281.558187830688, 59699.04668871252,
+         -149247.6167217813, 268645.71009920636, -358194.28013227513, 358194.28013227513,
+         -268645.71009920636, 149247.6167217813, -59699.04668871252, 16281.558187830688,
+         -2713.5930313051144, 208.73792548500882},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {365.8240258487654, -4755.712336033951, 28534.274016203704, -104625.67139274691,
+         261564.17848186727, -470815.5212673611, 627754.0283564815, -627754.0283564815,
+         470815.5212673611, -261564.17848186727, 104625.67139274691, -28534.274016203704,
+         4755.712336033951, -365.8240258487654},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-274.9158696588905, 3573.9063055655765, -21443.43783339346, 78625.93872244268,
+         -196564.8468061067, 353816.72425099206, -471755.6323346561, 471755.6323346561,
+         -353816.72425099206, 196564.8468061067, -78625.93872244268, 21443.43783339346,
+         -3573.9063055655765, 274.9158696588905},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {114.8809970754795, -1493.4529647369654, 8960.717802200452, -32855.96531515239,
+         82139.91336366361, -147851.84414553366, 197135.79225467096, -197135.79225467096,
+         147851.84414553366, -82139.91336366361, 32855.96531515239, -8960.717802200452,
+         1493.4529647369654, -114.8809970754795},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-28.85321358816964, 375.09185105096725, -2250.5516767423114, 8252.024964192708,
+         -20630.067135184152, 37134.12710821242, -49512.173892299106, 49512.173892299106,
+         -37134.12710821242, 20630.067135184152, -8252.024964192708, 2250.5516767423114,
+         -375.09185105096725, 28.85321358816964},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {4.365482381184896, -56.751848212348094, 340.5164061143663, -1248.589918484158,
+         3121.560983276367, -5618.945486043294, 7492.032375488281, -7492.032375488281,
+         5618.945486043294, -3121.560983276367, 1248.589918484158, -340.5164061143663,
+         56.751848212348094, -4.365482381184896},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.37184992391596394, 4.835401903048184, -29.025975647510887, 106.51940744659048,
+         -266.7504366920108, 481.1509870418165, -642.4582208865534, 642.4582208865534,
+         -481.1509870418165, 266.7504366920108, -106.51940744659048, 29.025975647510887,
+         -4.835401903048184, 0.37184992391596394},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.014157899254423812, -0.18467344691093215, 1.1144813113742404, -4.132603255310597,
+         10.605345127906329, -20.736048658461797, 29.92666654637251, -29.92666654637251,
+         20.736048658461797, -10.605345127906329, 4.132603255310597, -1.1144813113742404,
+         0.18467344691093215, -0.014157899254423812},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 8, 2>::coefficients[16][14];
+
+template <class real_number>
+void beta_n6_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 8, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 8, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 8, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m11(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((26051953.0L/633600.0L)*x - 599194919.0L/1267200.0L) + 26963068441.0L/10886400.0L) - 3235371397.0L/414720.0L) + 51079328023.0L/3110400.0L) - 1118089903.0L/46080.0L) + 26630059633.0L/1036800.0L) - 40405623613.0L/2073600.0L) + 6461456951.0L/622080.0L) - 53804561281.0L/14515200.0L) + 7640220799.0L/9580032.0L) - 37563484601.0L/479001600.0L) - 1.0L/79833600.0L) - 1.0L/8709120.0L) + 1.0L/1451520.0L) + 31.0L/14515200.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/633600.0L*x + 7789533947.0L/1267200.0L) - 350519889733.0L/10886400.0L) + 42059828161.0L/414720.0L) - 664031264299.0L/3110400.0L) + 14535168739.0L/46080.0L) - 346190775229.0L/1036800.0L) + 525273106969.0L/2073600.0L) - 83998940363.0L/622080.0L) + 699459296653.0L/14515200.0L) - 99322870387.0L/9580032.0L) + 2466289393.0L/2419200.0L) + 1.0L/7983360.0L) + 1.0L/604800.0L) - 1.0L/120960.0L) - 41.0L/1209600.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/105600.0L)*x - 7789533947.0L/211200.0L) + 350519889733.0L/1814400.0L) - 42059828161.0L/69120.0L) + 664031264299.0L/518400.0L) - 14535168739.0L/7680.0L) + 346190775229.0L/172800.0L) - 525273106969.0L/345600.0L) + 83998940363.0L/103680.0L) - 699459296653.0L/2419200.0L) + 99322870387.0L/1596672.0L) - 97665059963.0L/15966720.0L) - 1.0L/1814400.0L) - 1.0L/96768.0L) + 1.0L/24192.0L) + 601.0L/2419200.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/28800.0L*x + 7789533947.0L/57600.0L) - 3855718787063.0L/5443200.0L) + 462658109771.0L/207360.0L) - 7304343907289.0L/1555200.0L) + 159886856129.0L/23040.0L) - 3808098527519.0L/518400.0L) + 5778004176659.0L/1036800.0L) - 923988343993.0L/311040.0L) + 7694052263183.0L/7257600.0L) - 99322870387.0L/435456.0L) + 61040662477.0L/2721600.0L) + 1.0L/725760.0L) + 41.0L/1088640.0L) - 41.0L/362880.0L) - 151.0L/145152.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/11520.0L)*x - 7789533947.0L/23040.0L) + 3855718787063.0L/2177280.0L) - 462658109771.0L/82944.0L) + 7304343907289.0L/622080.0L) - 159886856129.0L/9216.0L) + 3808098527519.0L/207360.0L) - 5778004176659.0L/414720.0L) + 923988343993.0L/124416.0L) - 7694052263183.0L/2903040.0L) + 496614351935.0L/870912.0L) - 162775099939.0L/2903040.0L) - 1.0L/483840.0L) - 29.0L/322560.0L) + 29.0L/161280.0L) + 59.0L/21504.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/6400.0L*x + 7789533947.0L/12800.0L) - 3855718787063.0L/1209600.0L) + 462658109771.0L/46080.0L) - 7304343907289.0L/345600.0L) + 159886856129.0L/5120.0L) - 3808098527519.0L/115200.0L) + 5778004176659.0L/230400.0L) - 923988343993.0L/69120.0L) + 7694052263183.0L/1612800.0L) - 99322870387.0L/96768.0L) + 244162649909.0L/2419200.0L) + 1.0L/604800.0L) + 1.0L/6720.0L) - 1.0L/6720.0L) - 971.0L/201600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/4800.0L)*x - 7789533947.0L/9600.0L) + 3855718787063.0L/907200.0L) - 462658109771.0L/34560.0L) + 7304343907289.0L/259200.0L) - 159886856129.0L/3840.0L) + 3808098527519.0L/86400.0L) - 5778004176659.0L/172800.0L) + 923988343993.0L/51840.0L) - 7694052263183.0L/1209600.0L) + 99322870387.0L/72576.0L) - 69760757117.0L/518400.0L) - 91.0L/518400.0L) + 1001.0L/172800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/4800.0L*x + 7789533947.0L/9600.0L) - 3855718787063.0L/907200.0L) + 462658109771.0L/34560.0L) - 7304343907289.0L/259200.0L) + 159886856129.0L/3840.0L) - 3808098527519.0L/86400.0L) + 5778004176659.0L/172800.0L) - 923988343993.0L/51840.0L) + 7694052263183.0L/1209600.0L) - 99322870387.0L/72576.0L) + 8138754997.0L/60480.0L) - 1.0L/604800.0L) + 1.0L/6720.0L) + 1.0L/6720.0L) - 971.0L/201600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/6400.0L)*x - 7789533947.0L/12800.0L) + 3855718787063.0L/1209600.0L) - 462658109771.0L/46080.0L) + 7304343907289.0L/345600.0L) - 159886856129.0L/5120.0L) + 3808098527519.0L/115200.0L) - 5778004176659.0L/230400.0L) + 923988343993.0L/69120.0L) - 7694052263183.0L/1612800.0L) + 99322870387.0L/96768.0L) - 488325299821.0L/4838400.0L) + 1.0L/483840.0L) - 29.0L/322560.0L) - 29.0L/161280.0L) + 59.0L/21504.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/11520.0L*x + 7789533947.0L/23040.0L) - 3855718787063.0L/2177280.0L) + 462658109771.0L/82944.0L) - 7304343907289.0L/622080.0L) + 159886856129.0L/9216.0L) - 3808098527519.0L/207360.0L) + 5778004176659.0L/414720.0L) - 923988343993.0L/124416.0L) + 7694052263183.0L/2903040.0L) - 496614351935.0L/870912.0L) + 244162649911.0L/4354560.0L) - 1.0L/725760.0L) + 41.0L/1088640.0L) + 41.0L/362880.0L) - 151.0L/145152.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/28800.0L)*x - 7789533947.0L/57600.0L) + 3855718787063.0L/5443200.0L) - 462658109771.0L/207360.0L) + 7304343907289.0L/1555200.0L) - 159886856129.0L/23040.0L) + 3808098527519.0L/518400.0L) - 5778004176659.0L/1036800.0L) + 923988343993.0L/311040.0L) - 7694052263183.0L/7257600.0L) + 99322870387.0L/435456.0L) - 54258366647.0L/2419200.0L) + 1.0L/1814400.0L) - 1.0L/96768.0L) - 1.0L/24192.0L) + 601.0L/2419200.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-338675389.0L/105600.0L*x + 7789533947.0L/211200.0L) - 350519889733.0L/1814400.0L) + 42059828161.0L/69120.0L) - 664031264299.0L/518400.0L) + 14535168739.0L/7680.0L) - 346190775229.0L/172800.0L) + 525273106969.0L/345600.0L) - 83998940363.0L/103680.0L) + 699459296653.0L/2419200.0L) - 99322870387.0L/1596672.0L) + 30520331239.0L/4989600.0L) - 1.0L/7983360.0L) + 1.0L/604800.0L) + 1.0L/120960.0L) - 41.0L/1209600.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((338675389.0L/633600.0L)*x - 7789533947.0L/1267200.0L) + 350519889733.0L/10886400.0L) - 42059828161.0L/414720.0L) + 664031264299.0L/3110400.0L) - 14535168739.0L/46080.0L) + 346190775229.0L/1036800.0L) - 525273106969.0L/2073600.0L) + 83998940363.0L/622080.0L) - 699459296653.0L/14515200.0L) + 99322870387.0L/9580032.0L) - 1775728363.0L/1741824.0L) + 1.0L/79833600.0L) - 1.0L/8709120.0L) - 1.0L/1451520.0L) + 31.0L/14515200.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 12)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-26051953.0L/633600.0L*x + 599194919.0L/1267200.0L) - 26963068441.0L/10886400.0L) + 3235371397.0L/414720.0L) - 51079328023.0L/3110400.0L) + 1118089903.0L/46080.0L) - 26630059633.0L/1036800.0L) + 40405623613.0L/2073600.0L) - 6461456951.0L/622080.0L) + 53804561281.0L/14515200.0L) - 7640220799.0L/9580032.0L) + 894368681.0L/11404800.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((599194919.0L/633600.0L)*x - 599194919.0L/57600.0L) + 26963068441.0L/518400.0L) - 3235371397.0L/20736.0L) + 970507232437.0L/3110400.0L) - 1118089903.0L/2560.0L) + 452711013761.0L/1036800.0L) - 40405623613.0L/129600.0L) + 6461456951.0L/41472.0L) - 53804561281.0L/1036800.0L) + 99322870387.0L/9580032.0L) - 37563484601.0L/39916800.0L) - 1.0L/7257600.0L) - 1.0L/870912.0L) + 1.0L/161280.0L) + 31.0L/1814400.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/633600.0L*x + 7789533947.0L/57600.0L) - 350519889733.0L/518400.0L) + 42059828161.0L/20736.0L) - 12616594021681.0L/3110400.0L) + 14535168739.0L/2560.0L) - 5885243178893.0L/1036800.0L) + 525273106969.0L/129600.0L) - 83998940363.0L/41472.0L) + 699459296653.0L/1036800.0L) - 1291197315031.0L/9580032.0L) + 2466289393.0L/201600.0L) + 1.0L/725760.0L) + 1.0L/60480.0L) - 1.0L/13440.0L) - 41.0L/151200.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/105600.0L)*x - 7789533947.0L/9600.0L) + 350519889733.0L/86400.0L) - 42059828161.0L/3456.0L) + 12616594021681.0L/518400.0L) - 43605506217.0L/1280.0L) + 5885243178893.0L/172800.0L) - 525273106969.0L/21600.0L) + 83998940363.0L/6912.0L) - 699459296653.0L/172800.0L) + 1291197315031.0L/1596672.0L) - 97665059963.0L/1330560.0L) - 11.0L/1814400.0L) - 5.0L/48384.0L) + 1.0L/2688.0L) + 601.0L/302400.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/28800.0L*x + 85684873417.0L/28800.0L) - 3855718787063.0L/259200.0L) + 462658109771.0L/10368.0L) - 138782534238491.0L/1555200.0L) + 159886856129.0L/1280.0L) - 64737674967823.0L/518400.0L) + 5778004176659.0L/64800.0L) - 923988343993.0L/20736.0L) + 7694052263183.0L/518400.0L) - 1291197315031.0L/435456.0L) + 61040662477.0L/226800.0L) + 11.0L/725760.0L) + 41.0L/108864.0L) - 41.0L/40320.0L) - 151.0L/18144.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/11520.0L)*x - 85684873417.0L/11520.0L) + 3855718787063.0L/103680.0L) - 2313290548855.0L/20736.0L) + 138782534238491.0L/622080.0L) - 159886856129.0L/512.0L) + 64737674967823.0L/207360.0L) - 5778004176659.0L/25920.0L) + 4619941719965.0L/41472.0L) - 7694052263183.0L/207360.0L) + 6455986575155.0L/870912.0L) - 162775099939.0L/241920.0L) - 11.0L/483840.0L) - 29.0L/32256.0L) + 29.0L/17920.0L) + 59.0L/2688.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/6400.0L*x + 85684873417.0L/6400.0L) - 3855718787063.0L/57600.0L) + 462658109771.0L/2304.0L) - 138782534238491.0L/345600.0L) + 1438981705161.0L/2560.0L) - 64737674967823.0L/115200.0L) + 5778004176659.0L/14400.0L) - 923988343993.0L/4608.0L) + 7694052263183.0L/115200.0L) - 1291197315031.0L/96768.0L) + 244162649909.0L/201600.0L) + 11.0L/604800.0L) + 1.0L/672.0L) - 3.0L/2240.0L) - 971.0L/25200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/4800.0L)*x - 85684873417.0L/4800.0L) + 3855718787063.0L/43200.0L) - 462658109771.0L/1728.0L) + 138782534238491.0L/259200.0L) - 479660568387.0L/640.0L) + 64737674967823.0L/86400.0L) - 5778004176659.0L/10800.0L) + 923988343993.0L/3456.0L) - 7694052263183.0L/86400.0L) + 1291197315031.0L/72576.0L) - 69760757117.0L/43200.0L) - 91.0L/51840.0L) + 1001.0L/21600.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/4800.0L*x + 85684873417.0L/4800.0L) - 3855718787063.0L/43200.0L) + 462658109771.0L/1728.0L) - 138782534238491.0L/259200.0L) + 479660568387.0L/640.0L) - 64737674967823.0L/86400.0L) + 5778004176659.0L/10800.0L) - 923988343993.0L/3456.0L) + 7694052263183.0L/86400.0L) - 1291197315031.0L/72576.0L) + 8138754997.0L/5040.0L) - 11.0L/604800.0L) + 1.0L/672.0L) + 3.0L/2240.0L) - 971.0L/25200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/6400.0L)*x - 85684873417.0L/6400.0L) + 3855718787063.0L/57600.0L) - 462658109771.0L/2304.0L) + 138782534238491.0L/345600.0L) - 1438981705161.0L/2560.0L) + 64737674967823.0L/115200.0L) - 5778004176659.0L/14400.0L) + 923988343993.0L/4608.0L) - 7694052263183.0L/115200.0L) + 1291197315031.0L/96768.0L) - 488325299821.0L/403200.0L) + 11.0L/483840.0L) - 29.0L/32256.0L) - 29.0L/17920.0L) + 59.0L/2688.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/11520.0L*x + 85684873417.0L/11520.0L) - 3855718787063.0L/103680.0L) + 2313290548855.0L/20736.0L) - 138782534238491.0L/622080.0L) + 159886856129.0L/512.0L) - 64737674967823.0L/207360.0L) + 5778004176659.0L/25920.0L) - 4619941719965.0L/41472.0L) + 7694052263183.0L/207360.0L) - 6455986575155.0L/870912.0L) + 244162649911.0L/362880.0L) - 11.0L/725760.0L) + 41.0L/108864.0L) + 41.0L/40320.0L) - 151.0L/18144.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/28800.0L)*x - 85684873417.0L/28800.0L) + 3855718787063.0L/259200.0L) - 462658109771.0L/10368.0L) + 138782534238491.0L/1555200.0L) - 159886856129.0L/1280.0L) + 64737674967823.0L/518400.0L) - 5778004176659.0L/64800.0L) + 923988343993.0L/20736.0L) - 7694052263183.0L/518400.0L) + 1291197315031.0L/435456.0L) - 54258366647.0L/201600.0L) + 11.0L/1814400.0L) - 5.0L/48384.0L) - 1.0L/2688.0L) + 601.0L/302400.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/105600.0L*x + 7789533947.0L/9600.0L) - 350519889733.0L/86400.0L) + 42059828161.0L/3456.0L) - 12616594021681.0L/518400.0L) + 43605506217.0L/1280.0L) - 5885243178893.0L/172800.0L) + 525273106969.0L/21600.0L) - 83998940363.0L/6912.0L) + 699459296653.0L/172800.0L) - 1291197315031.0L/1596672.0L) + 30520331239.0L/415800.0L) - 1.0L/725760.0L) + 1.0L/60480.0L) + 1.0L/13440.0L) - 41.0L/151200.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/633600.0L)*x - 7789533947.0L/57600.0L) + 350519889733.0L/518400.0L) - 42059828161.0L/20736.0L) + 12616594021681.0L/3110400.0L) - 14535168739.0L/2560.0L) + 5885243178893.0L/1036800.0L) - 525273106969.0L/129600.0L) + 83998940363.0L/41472.0L) - 699459296653.0L/1036800.0L) + 1291197315031.0L/9580032.0L) - 1775728363.0L/145152.0L) + 1.0L/7257600.0L) - 1.0L/870912.0L) - 1.0L/161280.0L) + 31.0L/1814400.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 11)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-599194919.0L/633600.0L*x + 599194919.0L/57600.0L) - 26963068441.0L/518400.0L) + 3235371397.0L/20736.0L) - 970507232437.0L/3110400.0L) + 1118089903.0L/2560.0L) - 452711013761.0L/1036800.0L) + 40405623613.0L/129600.0L) - 6461456951.0L/41472.0L) + 53804561281.0L/1036800.0L) - 99322870387.0L/9580032.0L) + 894368681.0L/950400.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((599194919.0L/28800.0L)*x - 4194364433.0L/19200.0L) + 26963068441.0L/25920.0L) - 61472056543.0L/20736.0L) + 970507232437.0L/172800.0L) - 19007528351.0L/2560.0L) + 452711013761.0L/64800.0L) - 40405623613.0L/8640.0L) + 45230198657.0L/20736.0L) - 699459296653.0L/1036800.0L) + 99322870387.0L/798336.0L) - 37563484601.0L/3628800.0L) - 1.0L/725760.0L) - 1.0L/96768.0L) + 1.0L/20160.0L) + 31.0L/259200.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/28800.0L*x + 54526737629.0L/19200.0L) - 350519889733.0L/25920.0L) + 799136735059.0L/20736.0L) - 12616594021681.0L/172800.0L) + 247097868563.0L/2560.0L) - 5885243178893.0L/64800.0L) + 525273106969.0L/8640.0L) - 587992582541.0L/20736.0L) + 9092970856489.0L/1036800.0L) - 1291197315031.0L/798336.0L) + 27129183323.0L/201600.0L) + 1.0L/72576.0L) + 1.0L/6720.0L) - 1.0L/1680.0L) - 41.0L/21600.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/4800.0L)*x - 54526737629.0L/3200.0L) + 350519889733.0L/4320.0L) - 799136735059.0L/3456.0L) + 12616594021681.0L/28800.0L) - 741293605689.0L/1280.0L) + 5885243178893.0L/10800.0L) - 525273106969.0L/1440.0L) + 587992582541.0L/3456.0L) - 9092970856489.0L/172800.0L) + 1291197315031.0L/133056.0L) - 97665059963.0L/120960.0L) - 11.0L/181440.0L) - 5.0L/5376.0L) + 1.0L/336.0L) + 601.0L/43200.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-85684873417.0L/14400.0L*x + 599794113919.0L/9600.0L) - 3855718787063.0L/12960.0L) + 8790504085649.0L/10368.0L) - 138782534238491.0L/86400.0L) + 2718076554193.0L/1280.0L) - 64737674967823.0L/32400.0L) + 5778004176659.0L/4320.0L) - 6467918407951.0L/10368.0L) + 100022679421379.0L/518400.0L) - 1291197315031.0L/36288.0L) + 671447287247.0L/226800.0L) + 11.0L/72576.0L) + 41.0L/12096.0L) - 41.0L/5040.0L) - 151.0L/2592.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((85684873417.0L/5760.0L)*x - 599794113919.0L/3840.0L) + 3855718787063.0L/5184.0L) - 43952520428245.0L/20736.0L) + 138782534238491.0L/34560.0L) - 2718076554193.0L/512.0L) + 64737674967823.0L/12960.0L) - 5778004176659.0L/1728.0L) + 32339592039755.0L/20736.0L) - 100022679421379.0L/207360.0L) + 6455986575155.0L/72576.0L) - 1790526099329.0L/241920.0L) - 11.0L/48384.0L) - 29.0L/3584.0L) + 29.0L/2240.0L) + 59.0L/384.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-85684873417.0L/3200.0L*x + 1799382341757.0L/6400.0L) - 3855718787063.0L/2880.0L) + 8790504085649.0L/2304.0L) - 138782534238491.0L/19200.0L) + 24462688987737.0L/2560.0L) - 64737674967823.0L/7200.0L) + 5778004176659.0L/960.0L) - 6467918407951.0L/2304.0L) + 100022679421379.0L/115200.0L) - 1291197315031.0L/8064.0L) + 2685789148999.0L/201600.0L) + 11.0L/60480.0L) + 3.0L/224.0L) - 3.0L/280.0L) - 971.0L/3600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((85684873417.0L/2400.0L)*x - 599794113919.0L/1600.0L) + 3855718787063.0L/2160.0L) - 8790504085649.0L/1728.0L) + 138782534238491.0L/14400.0L) - 8154229662579.0L/640.0L) + 64737674967823.0L/5400.0L) - 5778004176659.0L/720.0L) + 6467918407951.0L/1728.0L) - 100022679421379.0L/86400.0L) + 1291197315031.0L/6048.0L) - 767368328287.0L/43200.0L) - 91.0L/5760.0L) + 7007.0L/21600.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-85684873417.0L/2400.0L*x + 599794113919.0L/1600.0L) - 3855718787063.0L/2160.0L) + 8790504085649.0L/1728.0L) - 138782534238491.0L/14400.0L) + 8154229662579.0L/640.0L) - 64737674967823.0L/5400.0L) + 5778004176659.0L/720.0L) - 6467918407951.0L/1728.0L) + 100022679421379.0L/86400.0L) - 1291197315031.0L/6048.0L) + 89526304967.0L/5040.0L) - 11.0L/60480.0L) + 3.0L/224.0L) + 3.0L/280.0L) - 971.0L/3600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((85684873417.0L/3200.0L)*x - 1799382341757.0L/6400.0L) + 3855718787063.0L/2880.0L) - 8790504085649.0L/2304.0L) + 138782534238491.0L/19200.0L) - 24462688987737.0L/2560.0L) + 64737674967823.0L/7200.0L) - 5778004176659.0L/960.0L) + 6467918407951.0L/2304.0L) - 100022679421379.0L/115200.0L) + 1291197315031.0L/8064.0L) - 5371578298031.0L/403200.0L) + 11.0L/48384.0L) - 29.0L/3584.0L) - 29.0L/2240.0L) + 59.0L/384.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-85684873417.0L/5760.0L*x + 599794113919.0L/3840.0L) - 3855718787063.0L/5184.0L) + 43952520428245.0L/20736.0L) - 138782534238491.0L/34560.0L) + 2718076554193.0L/512.0L) - 64737674967823.0L/12960.0L) + 5778004176659.0L/1728.0L) - 32339592039755.0L/20736.0L) + 100022679421379.0L/207360.0L) - 6455986575155.0L/72576.0L) + 2685789149021.0L/362880.0L) - 11.0L/72576.0L) + 41.0L/12096.0L) + 41.0L/5040.0L) - 151.0L/2592.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((85684873417.0L/14400.0L)*x - 599794113919.0L/9600.0L) + 3855718787063.0L/12960.0L) - 8790504085649.0L/10368.0L) + 138782534238491.0L/86400.0L) - 2718076554193.0L/1280.0L) + 64737674967823.0L/32400.0L) - 5778004176659.0L/4320.0L) + 6467918407951.0L/10368.0L) - 100022679421379.0L/518400.0L) + 1291197315031.0L/36288.0L) - 596842033117.0L/201600.0L) + 11.0L/181440.0L) - 5.0L/5376.0L) - 1.0L/336.0L) + 601.0L/43200.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-7789533947.0L/4800.0L*x + 54526737629.0L/3200.0L) - 350519889733.0L/4320.0L) + 799136735059.0L/3456.0L) - 12616594021681.0L/28800.0L) + 741293605689.0L/1280.0L) - 5885243178893.0L/10800.0L) + 525273106969.0L/1440.0L) - 587992582541.0L/3456.0L) + 9092970856489.0L/172800.0L) - 1291197315031.0L/133056.0L) + 30520331239.0L/37800.0L) - 1.0L/72576.0L) + 1.0L/6720.0L) + 1.0L/1680.0L) - 41.0L/21600.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((7789533947.0L/28800.0L)*x - 54526737629.0L/19200.0L) + 350519889733.0L/25920.0L) - 799136735059.0L/20736.0L) + 12616594021681.0L/172800.0L) - 247097868563.0L/2560.0L) + 5885243178893.0L/64800.0L) - 525273106969.0L/8640.0L) + 587992582541.0L/20736.0L) - 9092970856489.0L/1036800.0L) + 1291197315031.0L/798336.0L) - 19533011993.0L/145152.0L) + 1.0L/725760.0L) - 1.0L/96768.0L) - 1.0L/20160.0L) + 31.0L/259200.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 10)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-599194919.0L/28800.0L*x + 4194364433.0L/19200.0L) - 26963068441.0L/25920.0L) + 61472056543.0L/20736.0L) - 970507232437.0L/172800.0L) + 19007528351.0L/2560.0L) - 452711013761.0L/64800.0L) + 40405623613.0L/8640.0L) - 45230198657.0L/20736.0L) + 699459296653.0L/1036800.0L) - 99322870387.0L/798336.0L) + 894368681.0L/86400.0L);
-break;
+
+template void beta_n6_m8<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m8<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 9, 0>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {2.872053020282187, -37.33668926366843, 224.0201355820106, -821.4071638007055,
+         2053.517909501764, -3696.3322371031745, 4928.442982804233, -4928.442982804233,
+         3696.3322371031745, -2053.517909501764, 821.4071638007055, -224.0201355820106,
+         37.33668926366843, -2.872053020282187},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-7.229538139329806, 93.98399581128747, -563.9039748677249, 2067.6479078483244,
+         -5169.119769620811, 9304.41558531746, -12405.887447089946, 12405.887447089946,
+         -9304.41558531746, 5169.119769620811, -2067.6479078483244, 563.9039748677249,
+         -93.98399581128747, 7.229538139329806},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {8.204138466343327, -106.65380006246326, 639.9228003747795, -2346.3836013741916,
+         5865.959003435479, -10558.726206183863, 14078.30160824515, -14078.30160824515,
+         10558.726206183863, -5865.959003435479, 2346.3836013741916, -639.9228003747795,
+         106.65380006246326, -8.204138466343327},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-5.531850804882489, 71.91406046347235, -431.48436278083415, 1582.1093301963917,
+         -3955.2733254909795, 7119.491985883763, -9492.655981178352, 9492.655981178352,
+         -7119.491985883763, 3955.2733254909795, -1582.1093301963917, 431.48436278083415,
+         -71.91406046347235, 5.531850804882489},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {2.457961296606316, -31.953496880934217, 191.72098141086585, -702.9769322072724,
+         1757.442331207114, -3163.396196999525, 4217.861596550512, -4217.861596550512,
+         3163.396196999525, -1757.442331207114, 702.9769322072724, -191.72098141086585,
+         31.953496880934217, -2.457961296606316},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-0.754136226593502, 9.803771979114996, -58.82263979741926, 215.68304244429976,
+         -539.2076717316158, 970.5738961291439, -1294.0985894872272, 1294.0985894872272,
+         -970.5738961291439, 539.2076717316158, -215.68304244429976, 58.82263979741926,
+         -9.803771979114996, 0.754136226593502},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.16283958152488426, -2.1169283040364584, 12.701696415653934, -46.57359549386161,
+         116.43604080765336, -209.5881047905816, 279.4533078342014, -279.4533078342014,
+         209.5881047905816, -116.43604080765336, 46.57359549386161, -12.701696415653934,
+         2.1169283040364584, -0.16283958152488426},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.024903159570441674, 0.3238087190227744, -1.9435305255977355, 7.130820097477558,
+         -17.849646147470626, 32.17937311525698, -42.952009395215875, 42.952009395215875,
+         -32.17937311525698, 17.849646147470626, -7.130820097477558, 1.9435305255977355,
+         -0.3238087190227744, 0.024903159570441674},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.002754066336652519, -0.03590632181038652, 0.21651136918042702, -0.801570317040185,
+         2.049565290872102, -3.9636220949415177, 5.664596404659265, -5.664596404659265,
+         3.9636220949415177, -2.049565290872102, 0.801570317040185, -0.21651136918042702,
+         0.03590632181038652, -0.002754066336652519},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00018177914151808482, 0.0023849766513473186, -0.014537778436631102, 0.05495612399007628,
+         -0.14741974853894627, 0.33088121265330644, -1.5332693715911274, 1.5332693715911274,
+         -0.33088121265330644, 0.14741974853894627, -0.05495612399007628, 0.014537778436631102,
+         -0.0023849766513473186, 0.00018177914151808482},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 9, 0>::coefficients[20][14];
+
+template <>
+struct spline_polynomials<6, 9, 1>
+{
+    static constexpr int degree = 18;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {54.56900738536155, -709.3970960097001, 4256.382576058201, -15606.736112213404,
+         39016.840280533506, -70230.31250496031, 93640.41667328043, -93640.41667328043,
+         70230.31250496031, -39016.840280533506, 15606.736112213404, -4256.382576058201,
+         709.3970960097001, -54.56900738536155},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-122.9021483686067, 1597.727928791887, -9586.367572751322, 35150.014433421515,
+         -87875.03608355379, 158175.06495039683, -210900.0866005291, 210900.0866005291,
+         -158175.06495039683, 87875.03608355379, -35150.014433421515, 9586.367572751322,
+         -1597.727928791887, 122.9021483686067},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {123.06207699514991, -1599.807000936949, 9598.842005621693, -35195.754020612876,
+         87989.38505153218, -158380.89309275793, 211174.52412367726, -211174.52412367726,
+         158380.89309275793, -87989.38505153218, 35195.754020612876, -9598.842005621693,
+         1599.807000936949, -123.06207699514991},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-71.91406046347235, 934.8827860251406, -5609.296716150844, 20567.421292553096,
+         -51418.553231382735, 92553.39581648892, -123404.52775531856, 123404.52775531856,
+         -92553.39581648892, 51418.553231382735, -20567.421292553096, 5609.296716150844,
+         -934.8827860251406, 71.91406046347235},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {27.037574262669477, -351.4884656902764, 2108.9307955195245, -7732.746254279996,
+         19331.86564327825, -34797.358166994774, 46396.47756205564, -46396.47756205564,
+         34797.358166994774, -19331.86564327825, 7732.746254279996, -2108.9307955195245,
+         351.4884656902764, -27.037574262669477},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-6.787226039341518, 88.23394781203497, -529.4037581767733, 1941.147381998698,
+         -4852.869045584543, 8735.165065162295, -11646.887305385044, 11646.887305385044,
+         -8735.165065162295, 4852.869045584543, -1941.147381998698, 529.4037581767733,
+         -88.23394781203497, 6.787226039341518},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {1.1398770706741899, -14.818498128255209, 88.91187490957755, -326.0151684570312,
+         815.0522856535734, -1467.1167335340713, 1956.1731548394098, -1956.1731548394098,
+         1467.1167335340713, -815.0522856535734, 326.0151684570312, -88.91187490957755,
+         14.818498128255209, -1.1398770706741899},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.12451579785220837, 1.619043595113872, -9.717652627988677, 35.65410048738779,
+         -89.24823073735313, 160.8968655762849, -214.7600469760794, 214.7600469760794,
+         -160.8968655762849, 89.24823073735313, -35.65410048738779, 9.717652627988677,
+         -1.619043595113872, 0.12451579785220837},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.008262199009957557, -0.10771896543115955, 0.649534107541281, -2.404710951120555,
+         6.1486958726163055, -11.890866284824552, 16.993789213977795, -16.993789213977795,
+         11.890866284824552, -6.1486958726163055, 2.404710951120555, -0.649534107541281,
+         0.10771896543115955, -0.008262199009957557},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00018177914151808482, 0.0023849766513473186, -0.014537778436631102, 0.05495612399007628,
+         -0.14741974853894627, 0.33088121265330644, -1.5332693715911274, 1.5332693715911274,
+         -0.33088121265330644, 0.14741974853894627, -0.05495612399007628, 0.014537778436631102,
+         -0.0023849766513473186, 0.00018177914151808482}};
+};
+constexpr double spline_polynomials<6, 9, 1>::coefficients[19][14];
+
+template <>
+struct spline_polynomials<6, 9, 2>
+{
+    static constexpr int degree = 17;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {982.2421329365079, -12769.147728174603, 76614.88636904761, -280921.25001984125,
+         702303.1250496032, -1264145.6250892857, 1685527.5001190477, -1685527.5001190477,
+         1264145.6250892857, -702303.1250496032, 280921.25001984125, -76614.88636904761,
+         12769.147728174603, -982.2421329365079},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-1966.4343738977072, 25563.646860670193, -153381.88116402115, 562400.2309347442,
+         -1406000.5773368606, 2530801.0392063493, -3374401.3856084654, 3374401.3856084654,
+         -2530801.0392063493, 1406000.5773368606, -562400.2309347442, 153381.88116402115,
+         -25563.646860670193, 1966.4343738977072},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {1722.8690779320987, -22397.298013117284, 134383.7880787037, -492740.55628858024,
+         1231851.3907214506, -2217332.503298611, 2956443.3377314815, -2956443.3377314815,
+         2217332.503298611, -1231851.3907214506, 492740.55628858024, -134383.7880787037,
+         22397.298013117284, -1722.8690779320987},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-862.9687255616683, 11218.593432301688, -67311.56059381012, 246809.05551063712,
+         -617022.6387765928, 1110640.7497978671, -1480854.3330638227, 1480854.3330638227,
+         -1110640.7497978671, 617022.6387765928, -246809.05551063712, 67311.56059381012,
+         -11218.593432301688, 862.9687255616683},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {270.3757426266948, -3514.884656902764, 21089.307955195243, -77327.46254279996,
+         193318.65643278253, -347973.5816699477, 463964.7756205564, -463964.7756205564,
+         347973.5816699477, -193318.65643278253, 77327.46254279996, -21089.307955195243,
+         3514.884656902764, -270.3757426266948},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-54.297808314732144, 705.8715824962798, -4235.230065414186, 15529.179055989584,
+         -38822.95236467634, 69881.32052129836, -93175.09844308035, 93175.09844308035,
+         -69881.32052129836, 38822.95236467634, -15529.179055989584, 4235.230065414186,
+         -705.8715824962798, 54.297808314732144},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {6.839262424045139, -88.91098876953124, 533.4712494574653, -1956.0910107421876,
+         4890.313713921441, -8802.700401204427, 11737.038929036458, -11737.038929036458,
+         8802.700401204427, -4890.313713921441, 1956.0910107421876, -533.4712494574653,
+         88.91098876953124, -6.839262424045139},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.4980631914088335, 6.476174380455488, -38.87061051195471, 142.61640194955115,
+         -356.9929229494125, 643.5874623051396, -859.0401879043176, 859.0401879043176,
+         -643.5874623051396, 356.9929229494125, -142.61640194955115, 38.87061051195471,
+         -6.476174380455488, 0.4980631914088335},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.016524398019915114, -0.2154379308623191, 1.299068215082562, -4.80942190224111,
+         12.297391745232611, -23.781732569649105, 33.98757842795559, -33.98757842795559,
+         23.781732569649105, -12.297391745232611, 4.80942190224111, -1.299068215082562,
+         0.2154379308623191, -0.016524398019915114},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 9, 2>::coefficients[18][14];
+
+template <class real_number>
+void beta_n6_m9(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 9, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 9, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 9, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m9<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m9<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 10, 0>
+{
+    static constexpr int degree = 21;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-10.833397863389182, 140.8341722240594, -845.0050333443562, 3098.351788929306,
+         -7745.879472323266, 13942.583050181878, -18590.11073357584, 18590.11073357584,
+         -13942.583050181878, 7745.879472323266, -3098.351788929306, 845.0050333443562,
+         -140.8341722240594, 10.833397863389182},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {29.955547678755146, -389.4221198238169, 2336.5327189429013, -8567.28663612397,
+         21418.216590309927, -38552.78986255787, 51403.719816743826, -51403.719816743826,
+         38552.78986255787, -21418.216590309927, 8567.28663612397, -2336.5327189429013,
+         389.4221198238169, -29.955547678755146},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-37.69846963011188, 490.0801051914545, -2940.480631148727, 10781.762314212,
+         -26954.405785529998, 48517.930413953996, -64690.57388527199, 64690.57388527199,
+         -48517.930413953996, 26954.405785529998, -10781.762314212, 2940.480631148727,
+         -490.0801051914545, 37.69846963011188},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {28.516759460198045, -370.7178729825746, 2224.3072378954475, -8155.793205616641,
+         20389.4830140416, -36701.06942527489, 48934.75923369984, -48934.75923369984,
+         36701.06942527489, -20389.4830140416, 8155.793205616641, -2224.3072378954475,
+         370.7178729825746, -28.516759460198045},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-14.418622489693927, 187.44209236602106, -1124.6525541961264, 4123.726032052464,
+         -10309.315080131159, 18556.767144236084, -24742.35619231478, 24742.35619231478,
+         -18556.767144236084, 10309.315080131159, -4123.726032052464, 1124.6525541961264,
+         -187.44209236602106, 14.418622489693927},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {5.123992802049748, -66.61190645169883, 399.6714388354535, -1465.461942764094,
+         3663.6548575991674, -6594.578744505221, 8792.771659891441, -8792.771659891441,
+         6594.578744505221, -3663.6548575991674, 1465.461942764094, -399.6714388354535,
+         66.61190645169883, -5.123992802049748},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-1.3095594568942168, 17.02427397302429, -102.14565176087503, 374.53408631030425,
+         -936.335281396627, 1685.403593526164, -2247.204852683254, 2247.204852683254,
+         -1685.403593526164, 936.335281396627, -374.53408631030425, 102.14565176087503,
+         -17.02427397302429, 1.3095594568942168},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.24218575728212924, -3.1484285888806434, 18.890698124719044, -69.26660176043367,
+         173.16855647408352, -311.7066329901559, 415.6113454336338, -415.6113454336338,
+         311.7066329901559, -173.16855647408352, 69.26660176043367, -18.890698124719044,
+         3.1484285888806434, -0.24218575728212924},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.03234186354768339, 0.42051187072691676, -2.5237494358225896, 9.25828943496869,
+         -23.168319491198453, 41.75298513396707, -55.716825420162664, 55.716825420162664,
+         -41.75298513396707, 23.168319491198453, -9.25828943496869, 2.5237494358225896,
+         -0.42051187072691676, 0.03234186354768339},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.0031673276687215037, -0.041278719127283314, 0.2487457530818078, -0.9197630580119145,
+         2.3450471433014255, -4.495489429314301, 6.373752850489642, -6.373752850489642,
+         4.495489429314301, -2.3450471433014255, 0.9197630580119145, -0.2487457530818078,
+         0.041278719127283314, -0.0031673276687215037},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00019211067481980944, 0.0025192865842697384, -0.015343638034165621, 0.05791094251436952,
+         -0.15480679484967938, 0.344177896012626, -1.5509982827368867, 1.5509982827368867,
+         -0.344177896012626, 0.15480679484967938, -0.05791094251436952, 0.015343638034165621,
+         -0.0025192865842697384, 0.00019211067481980944},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 10, 0>::coefficients[22][14];
+
+template <>
+struct spline_polynomials<6, 10, 1>
+{
+    static constexpr int degree = 20;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-227.50135513117283, 2957.517616705247, -17745.10570023148, 65065.387567515434,
+         -162663.46891878857, 292794.24405381945, -390392.3254050926, 390392.3254050926,
+         -292794.24405381945, 162663.46891878857, -65065.387567515434, 17745.10570023148,
+         -2957.517616705247, 227.50135513117283},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {569.1554058963477, -7399.020276652521, 44394.12165991512, -162778.44608635546,
+         406946.11521588865, -732503.0073885996, 976670.6765181327, -976670.6765181327,
+         732503.0073885996, -406946.11521588865, 162778.44608635546, -44394.12165991512,
+         7399.020276652521, -569.1554058963477},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-640.873983711902, 8331.361788254726, -49988.170729528356, 183289.95934160397,
+         -458224.89835400996, 824804.8170372179, -1099739.756049624, 1099739.756049624,
+         -824804.8170372179, 458224.89835400996, -183289.95934160397, 49988.170729528356,
+         -8331.361788254726, 640.873983711902},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {427.7513919029707, -5560.768094738619, 33364.608568431715, -122336.89808424961,
+         305842.245210624, -550516.0413791232, 734021.3885054977, -734021.3885054977,
+         550516.0413791232, -305842.245210624, 122336.89808424961, -33364.608568431715,
+         5560.768094738619, -427.7513919029707},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-187.44209236602106, 2436.7472007582737, -14620.483204549642, 53608.438416682024,
+         -134021.09604170505, 241237.9728750691, -321650.6305000922, 321650.6305000922,
+         -241237.9728750691, 134021.09604170505, -53608.438416682024, 14620.483204549642,
+         -2436.7472007582737, 187.44209236602106},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {56.36392082254723, -732.7309709686872, 4396.385827189989, -16120.081370405032,
+         40300.20343359085, -72540.36618955743, 96720.48825880585, -96720.48825880585,
+         72540.36618955743, -40300.20343359085, 16120.081370405032, -4396.385827189989,
+         732.7309709686872, -56.36392082254723},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-11.786035112047953, 153.2184657572186, -919.3108658478752, 3370.806776792738,
+         -8427.017532569644, 15168.632341735476, -20224.843674149288, 20224.843674149288,
+         -15168.632341735476, 8427.017532569644, -3370.806776792738, 919.3108658478752,
+         -153.2184657572186, 11.786035112047953},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {1.6953003009749048, -22.039000122164502, 132.2348868730333, -484.8662123230357,
+         1212.1798953185846, -2181.9464309310915, 2909.2794180354367, -2909.2794180354367,
+         2181.9464309310915, -1212.1798953185846, 484.8662123230357, -132.2348868730333,
+         22.039000122164502, -1.6953003009749048},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.16170931773841696, 2.1025593536345837, -12.618747179112948, 46.29144717484345,
+         -115.84159745599227, 208.76492566983535, -278.5841271008133, 278.5841271008133,
+         -208.76492566983535, 115.84159745599227, -46.29144717484345, 12.618747179112948,
+         -2.1025593536345837, 0.16170931773841696},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.00950198300616451, -0.12383615738184994, 0.7462372592454234, -2.7592891740357435,
+         7.035141429904277, -13.486468287942902, 19.121258551468927, -19.121258551468927,
+         13.486468287942902, -7.035141429904277, 2.7592891740357435, -0.7462372592454234,
+         0.12383615738184994, -0.00950198300616451},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00019211067481980944, 0.0025192865842697384, -0.015343638034165621, 0.05791094251436952,
+         -0.15480679484967938, 0.344177896012626, -1.5509982827368867, 1.5509982827368867,
+         -0.344177896012626, 0.15480679484967938, -0.05791094251436952, 0.015343638034165621,
+         -0.0025192865842697384, 0.00019211067481980944}};
+};
+constexpr double spline_polynomials<6, 10, 1>::coefficients[21][14];
+
+template <>
+struct spline_polynomials<6, 10, 2>
+{
+    static constexpr int degree = 19;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4550.027102623457, 59150.35233410494, -354902.1140046296, 1301307.7513503085,
+         -3253269.3783757715, 5855884.881076389, -7807846.508101852, 7807846.508101852,
+         -5855884.881076389, 3253269.3783757715, -1301307.7513503085, 354902.1140046296,
+         -59150.35233410494, 4550.027102623457},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {10244.79730613426, -133182.36497974538, 799094.1898784722, -2930012.0295543983,
+         7325030.073885995, -13185054.132994791, 17580072.17732639, -17580072.17732639,
+         13185054.132994791, -7325030.073885995, 2930012.0295543983, -799094.1898784722,
+         133182.36497974538, -10244.79730613426},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-10253.983739390433, 133301.78861207562, -799810.7316724537, 2932639.3494656635,
+         -7331598.373664159, 13196877.072595486, -17595836.096793983, 17595836.096793983,
+         -13196877.072595486, 7331598.373664159, -2932639.3494656635, 799810.7316724537,
+         -133301.78861207562, 10253.983739390433},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {5988.5194866415895, -77850.75332634067, 467104.519958044, -1712716.5731794946,
+         4281791.4329487365, -7707224.579307726, 10276299.439076968, -10276299.439076968,
+         7707224.579307726, -4281791.4329487365, 1712716.5731794946, -467104.519958044,
+         77850.75332634067, -5988.5194866415895},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-2249.305108392253, 29240.966409099285, -175445.79845459573, 643301.2610001843,
+         -1608253.1525004606, 2894855.674500829, -3859807.5660011056, 3859807.5660011056,
+         -2894855.674500829, 1608253.1525004606, -643301.2610001843, 175445.79845459573,
+         -29240.966409099285, 2249.305108392253},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {563.6392082254723, -7327.309709686871, 43963.85827189989, -161200.81370405032,
+         403002.0343359084, -725403.6618955743, 967204.8825880586, -967204.8825880586,
+         725403.6618955743, -403002.0343359084, 161200.81370405032, -43963.85827189989,
+         7327.309709686871, -563.6392082254723},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-94.28828089638363, 1225.7477260577489, -7354.486926783002, 26966.454214341906,
+         -67416.14026055715, 121349.05873388381, -161798.7493931943, 161798.7493931943,
+         -121349.05873388381, 67416.14026055715, -26966.454214341906, 7354.486926783002,
+         -1225.7477260577489, 94.28828089638363},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {10.171801805849428, -132.23400073298703, 793.4093212381998, -2909.1972739382145,
+         7273.079371911508, -13091.678585586547, 17455.67650821262, -17455.67650821262,
+         13091.678585586547, -7273.079371911508, 2909.1972739382145, -793.4093212381998,
+         132.23400073298703, -10.171801805849428},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.6468372709536678, 8.410237414538335, -50.47498871645179, 185.1657886993738,
+         -463.3663898239691, 835.0597026793414, -1114.3365084032532, 1114.3365084032532,
+         -835.0597026793414, 463.3663898239691, -185.1657886993738, 50.47498871645179,
+         -8.410237414538335, 0.6468372709536678},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.01900396601232902, -0.24767231476369989, 1.4924745184908468, -5.518578348071487,
+         14.070282859808554, -26.972936575885804, 38.24251710293785, -38.24251710293785,
+         26.972936575885804, -14.070282859808554, 5.518578348071487, -1.4924745184908468,
+         0.24767231476369989, -0.01900396601232902},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 10, 2>::coefficients[20][14];
+
+template <class real_number>
+void beta_n6_m10(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 10, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 10, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 10, 2>>(x, poly_val);
+        break;
+    }
 }
-void beta_n6_m12(int deriv, double x, double *poly_val){
-switch(deriv)
-{
-case 0:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-894368681.0L/5702400.0L*x + 894368681.0L/456192.0L) - 475259833.0L/42240.0L) + 89431559663.0L/2280960.0L) - 503016379057.0L/5443200.0L) + 321894504433.0L/2073600.0L) - 592866122297.0L/3110400.0L) + 119172690967.0L/691200.0L) - 118257666689.0L/1036800.0L) + 37212350719.0L/691200.0L) - 53552108621.0L/3110400.0L) + 535054363969.0L/159667200.0L) - 71938872239.0L/239500800.0L) + 1.0L/479001600.0L) - 1.0L/79833600.0L) - 1.0L/8709120.0L) + 1.0L/1451520.0L) + 31.0L/14515200.0L) - 31.0L/2419200.0L) - 139.0L/8709120.0L) + 139.0L/1451520.0L) + 479.0L/10886400.0L) - 479.0L/1814400.0L) - 1.0L/33264.0L) + 1.0L/5544.0L);
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/5702400.0L)*x - 11626792853.0L/456192.0L) + 6178377829.0L/42240.0L) - 1162610275619.0L/2280960.0L) + 6539212927741.0L/5443200.0L) - 4184628557629.0L/2073600.0L) + 7707259589861.0L/3110400.0L) - 1549244982571.0L/691200.0L) + 1537349666957.0L/1036800.0L) - 483760559347.0L/691200.0L) + 696177412073.0L/3110400.0L) - 6955706731597.0L/159667200.0L) + 935205339107.0L/239500800.0L) - 1.0L/39916800.0L) + 1.0L/7983360.0L) + 1.0L/604800.0L) - 1.0L/120960.0L) - 41.0L/1209600.0L) + 41.0L/241920.0L) + 121.0L/453600.0L) - 121.0L/90720.0L) - 19.0L/25200.0L) + 19.0L/5040.0L) + 1.0L/1925.0L) - 1.0L/385.0L);
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/950400.0L*x + 11626792853.0L/76032.0L) - 6178377829.0L/7040.0L) + 1162610275619.0L/380160.0L) - 6539212927741.0L/907200.0L) + 4184628557629.0L/345600.0L) - 7707259589861.0L/518400.0L) + 1549244982571.0L/115200.0L) - 1537349666957.0L/172800.0L) + 483760559347.0L/115200.0L) - 696177412073.0L/518400.0L) + 6955706731597.0L/26611200.0L) - 935205339107.0L/39916800.0L) + 1.0L/7257600.0L) - 1.0L/1814400.0L) - 1.0L/96768.0L) + 1.0L/24192.0L) + 601.0L/2419200.0L) - 601.0L/604800.0L) - 625.0L/290304.0L) + 625.0L/72576.0L) + 643.0L/100800.0L) - 643.0L/25200.0L) - 1.0L/224.0L) + 1.0L/56.0L);
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/259200.0L)*x - 11626792853.0L/20736.0L) + 6178377829.0L/1920.0L) - 1162610275619.0L/103680.0L) + 71931342205151.0L/2721600.0L) - 46030914133919.0L/1036800.0L) + 84779855488471.0L/1555200.0L) - 17041694808281.0L/345600.0L) + 16910846336527.0L/518400.0L) - 5321366152817.0L/345600.0L) + 7657951532803.0L/1555200.0L) - 6955706731597.0L/7257600.0L) + 935205339107.0L/10886400.0L) - 1.0L/2177280.0L) + 1.0L/725760.0L) + 41.0L/1088640.0L) - 41.0L/362880.0L) - 151.0L/145152.0L) + 151.0L/48384.0L) + 3011.0L/272160.0L) - 3011.0L/90720.0L) - 4969.0L/136080.0L) + 4969.0L/45360.0L) + 5.0L/189.0L) - 5.0L/63.0L);
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/103680.0L*x + 58133964265.0L/41472.0L) - 6178377829.0L/768.0L) + 1162610275619.0L/41472.0L) - 71931342205151.0L/1088640.0L) + 46030914133919.0L/414720.0L) - 84779855488471.0L/622080.0L) + 17041694808281.0L/138240.0L) - 16910846336527.0L/207360.0L) + 5321366152817.0L/138240.0L) - 7657951532803.0L/622080.0L) + 6955706731597.0L/2903040.0L) - 935205339107.0L/4354560.0L) + 1.0L/967680.0L) - 1.0L/483840.0L) - 29.0L/322560.0L) + 29.0L/161280.0L) + 59.0L/21504.0L) - 59.0L/10752.0L) - 33853.0L/967680.0L) + 33853.0L/483840.0L) + 4469.0L/26880.0L) - 4469.0L/13440.0L) - 15.0L/112.0L) + 15.0L/56.0L);
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/57600.0L)*x - 11626792853.0L/4608.0L) + 18535133487.0L/1280.0L) - 1162610275619.0L/23040.0L) + 71931342205151.0L/604800.0L) - 46030914133919.0L/230400.0L) + 84779855488471.0L/345600.0L) - 17041694808281.0L/76800.0L) + 16910846336527.0L/115200.0L) - 5321366152817.0L/76800.0L) + 7657951532803.0L/345600.0L) - 6955706731597.0L/1612800.0L) + 935205339107.0L/2419200.0L) - 1.0L/604800.0L) + 1.0L/604800.0L) + 1.0L/6720.0L) - 1.0L/6720.0L) - 971.0L/201600.0L) + 971.0L/201600.0L) + 1039.0L/15120.0L) - 1039.0L/15120.0L) - 1769.0L/4200.0L) + 1769.0L/4200.0L) + 6.0L/7.0L) - 6.0L/7.0L);
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/43200.0L*x + 11626792853.0L/3456.0L) - 6178377829.0L/320.0L) + 1162610275619.0L/17280.0L) - 71931342205151.0L/453600.0L) + 46030914133919.0L/172800.0L) - 84779855488471.0L/259200.0L) + 17041694808281.0L/57600.0L) - 16910846336527.0L/86400.0L) + 5321366152817.0L/57600.0L) - 7657951532803.0L/259200.0L) + 6955706731597.0L/1209600.0L) - 935205339107.0L/1814400.0L) + 1.0L/518400.0L) - 91.0L/518400.0L) + 1001.0L/172800.0L) - 44473.0L/518400.0L) + 37037.0L/64800.0L) - 5369.0L/3600.0L) + 1;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/43200.0L)*x - 11626792853.0L/3456.0L) + 6178377829.0L/320.0L) - 1162610275619.0L/17280.0L) + 71931342205151.0L/453600.0L) - 46030914133919.0L/172800.0L) + 84779855488471.0L/259200.0L) - 17041694808281.0L/57600.0L) + 16910846336527.0L/86400.0L) - 5321366152817.0L/57600.0L) + 7657951532803.0L/259200.0L) - 6955706731597.0L/1209600.0L) + 935205339107.0L/1814400.0L) - 1.0L/604800.0L) - 1.0L/604800.0L) + 1.0L/6720.0L) + 1.0L/6720.0L) - 971.0L/201600.0L) - 971.0L/201600.0L) + 1039.0L/15120.0L) + 1039.0L/15120.0L) - 1769.0L/4200.0L) - 1769.0L/4200.0L) + 6.0L/7.0L) + 6.0L/7.0L);
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/57600.0L*x + 11626792853.0L/4608.0L) - 18535133487.0L/1280.0L) + 1162610275619.0L/23040.0L) - 71931342205151.0L/604800.0L) + 46030914133919.0L/230400.0L) - 84779855488471.0L/345600.0L) + 17041694808281.0L/76800.0L) - 16910846336527.0L/115200.0L) + 5321366152817.0L/76800.0L) - 7657951532803.0L/345600.0L) + 6955706731597.0L/1612800.0L) - 935205339107.0L/2419200.0L) + 1.0L/967680.0L) + 1.0L/483840.0L) - 29.0L/322560.0L) - 29.0L/161280.0L) + 59.0L/21504.0L) + 59.0L/10752.0L) - 33853.0L/967680.0L) - 33853.0L/483840.0L) + 4469.0L/26880.0L) + 4469.0L/13440.0L) - 15.0L/112.0L) - 15.0L/56.0L);
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/103680.0L)*x - 58133964265.0L/41472.0L) + 6178377829.0L/768.0L) - 1162610275619.0L/41472.0L) + 71931342205151.0L/1088640.0L) - 46030914133919.0L/414720.0L) + 84779855488471.0L/622080.0L) - 17041694808281.0L/138240.0L) + 16910846336527.0L/207360.0L) - 5321366152817.0L/138240.0L) + 7657951532803.0L/622080.0L) - 6955706731597.0L/2903040.0L) + 935205339107.0L/4354560.0L) - 1.0L/2177280.0L) - 1.0L/725760.0L) + 41.0L/1088640.0L) + 41.0L/362880.0L) - 151.0L/145152.0L) - 151.0L/48384.0L) + 3011.0L/272160.0L) + 3011.0L/90720.0L) - 4969.0L/136080.0L) - 4969.0L/45360.0L) + 5.0L/189.0L) + 5.0L/63.0L);
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/259200.0L*x + 11626792853.0L/20736.0L) - 6178377829.0L/1920.0L) + 1162610275619.0L/103680.0L) - 71931342205151.0L/2721600.0L) + 46030914133919.0L/1036800.0L) - 84779855488471.0L/1555200.0L) + 17041694808281.0L/345600.0L) - 16910846336527.0L/518400.0L) + 5321366152817.0L/345600.0L) - 7657951532803.0L/1555200.0L) + 6955706731597.0L/7257600.0L) - 935205339107.0L/10886400.0L) + 1.0L/7257600.0L) + 1.0L/1814400.0L) - 1.0L/96768.0L) - 1.0L/24192.0L) + 601.0L/2419200.0L) + 601.0L/604800.0L) - 625.0L/290304.0L) - 625.0L/72576.0L) + 643.0L/100800.0L) + 643.0L/25200.0L) - 1.0L/224.0L) - 1.0L/56.0L);
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/950400.0L)*x - 11626792853.0L/76032.0L) + 6178377829.0L/7040.0L) - 1162610275619.0L/380160.0L) + 6539212927741.0L/907200.0L) - 4184628557629.0L/345600.0L) + 7707259589861.0L/518400.0L) - 1549244982571.0L/115200.0L) + 1537349666957.0L/172800.0L) - 483760559347.0L/115200.0L) + 696177412073.0L/518400.0L) - 6955706731597.0L/26611200.0L) + 935205339107.0L/39916800.0L) - 1.0L/39916800.0L) - 1.0L/7983360.0L) + 1.0L/604800.0L) + 1.0L/120960.0L) - 41.0L/1209600.0L) - 41.0L/241920.0L) + 121.0L/453600.0L) + 121.0L/90720.0L) - 19.0L/25200.0L) - 19.0L/5040.0L) + 1.0L/1925.0L) + 1.0L/385.0L);
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/5702400.0L*x + 11626792853.0L/456192.0L) - 6178377829.0L/42240.0L) + 1162610275619.0L/2280960.0L) - 6539212927741.0L/5443200.0L) + 4184628557629.0L/2073600.0L) - 7707259589861.0L/3110400.0L) + 1549244982571.0L/691200.0L) - 1537349666957.0L/1036800.0L) + 483760559347.0L/691200.0L) - 696177412073.0L/3110400.0L) + 6955706731597.0L/159667200.0L) - 935205339107.0L/239500800.0L) + 1.0L/479001600.0L) + 1.0L/79833600.0L) - 1.0L/8709120.0L) - 1.0L/1451520.0L) + 31.0L/14515200.0L) + 31.0L/2419200.0L) - 139.0L/8709120.0L) - 139.0L/1451520.0L) + 479.0L/10886400.0L) + 479.0L/1814400.0L) - 1.0L/33264.0L) - 1.0L/5544.0L);
-poly_val[13] = pow(x, 13)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((894368681.0L/5702400.0L)*x - 894368681.0L/456192.0L) + 475259833.0L/42240.0L) - 89431559663.0L/2280960.0L) + 503016379057.0L/5443200.0L) - 321894504433.0L/2073600.0L) + 592866122297.0L/3110400.0L) - 119172690967.0L/691200.0L) + 118257666689.0L/1036800.0L) - 37212350719.0L/691200.0L) + 53552108621.0L/3110400.0L) - 535054363969.0L/159667200.0L) + 71938872239.0L/239500800.0L);
-break;
-case 1:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-894368681.0L/228096.0L*x + 894368681.0L/19008.0L) - 10930976159.0L/42240.0L) + 89431559663.0L/103680.0L) - 503016379057.0L/259200.0L) + 321894504433.0L/103680.0L) - 11264456323643.0L/3110400.0L) + 119172690967.0L/38400.0L) - 2010380333713.0L/1036800.0L) + 37212350719.0L/43200.0L) - 53552108621.0L/207360.0L) + 535054363969.0L/11404800.0L) - 935205339107.0L/239500800.0L) + 1.0L/39916800.0L) - 1.0L/7257600.0L) - 1.0L/870912.0L) + 1.0L/161280.0L) + 31.0L/1814400.0L) - 31.0L/345600.0L) - 139.0L/1451520.0L) + 139.0L/290304.0L) + 479.0L/2721600.0L) - 479.0L/604800.0L) - 1.0L/16632.0L) + 1.0L/5544.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/228096.0L)*x - 11626792853.0L/19008.0L) + 142102690067.0L/42240.0L) - 1162610275619.0L/103680.0L) + 6539212927741.0L/259200.0L) - 4184628557629.0L/103680.0L) + 146437932207359.0L/3110400.0L) - 1549244982571.0L/38400.0L) + 26134944338269.0L/1036800.0L) - 483760559347.0L/43200.0L) + 696177412073.0L/207360.0L) - 6955706731597.0L/11404800.0L) + 12157669408391.0L/239500800.0L) - 1.0L/3326400.0L) + 1.0L/725760.0L) + 1.0L/60480.0L) - 1.0L/13440.0L) - 41.0L/151200.0L) + 41.0L/34560.0L) + 121.0L/75600.0L) - 121.0L/18144.0L) - 19.0L/6300.0L) + 19.0L/1680.0L) + 2.0L/1925.0L) - 1.0L/385.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/38016.0L*x + 11626792853.0L/3168.0L) - 142102690067.0L/7040.0L) + 1162610275619.0L/17280.0L) - 6539212927741.0L/43200.0L) + 4184628557629.0L/17280.0L) - 146437932207359.0L/518400.0L) + 1549244982571.0L/6400.0L) - 26134944338269.0L/172800.0L) + 483760559347.0L/7200.0L) - 696177412073.0L/34560.0L) + 6955706731597.0L/1900800.0L) - 12157669408391.0L/39916800.0L) + 1.0L/604800.0L) - 11.0L/1814400.0L) - 5.0L/48384.0L) + 1.0L/2688.0L) + 601.0L/302400.0L) - 601.0L/86400.0L) - 625.0L/48384.0L) + 3125.0L/72576.0L) + 643.0L/25200.0L) - 643.0L/8400.0L) - 1.0L/112.0L) + 1.0L/56.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/10368.0L)*x - 11626792853.0L/864.0L) + 142102690067.0L/1920.0L) - 12788713031809.0L/51840.0L) + 71931342205151.0L/129600.0L) - 46030914133919.0L/51840.0L) + 1610817254280949.0L/1555200.0L) - 17041694808281.0L/19200.0L) + 287484387720959.0L/518400.0L) - 5321366152817.0L/21600.0L) + 7657951532803.0L/103680.0L) - 6955706731597.0L/518400.0L) + 12157669408391.0L/10886400.0L) - 1.0L/181440.0L) + 11.0L/725760.0L) + 41.0L/108864.0L) - 41.0L/40320.0L) - 151.0L/18144.0L) + 151.0L/6912.0L) + 3011.0L/45360.0L) - 3011.0L/18144.0L) - 4969.0L/34020.0L) + 4969.0L/15120.0L) + 10.0L/189.0L) - 5.0L/63.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58133964265.0L/20736.0L*x + 58133964265.0L/1728.0L) - 142102690067.0L/768.0L) + 12788713031809.0L/20736.0L) - 71931342205151.0L/51840.0L) + 46030914133919.0L/20736.0L) - 1610817254280949.0L/622080.0L) + 17041694808281.0L/7680.0L) - 287484387720959.0L/207360.0L) + 5321366152817.0L/8640.0L) - 7657951532803.0L/41472.0L) + 6955706731597.0L/207360.0L) - 12157669408391.0L/4354560.0L) + 1.0L/80640.0L) - 11.0L/483840.0L) - 29.0L/32256.0L) + 29.0L/17920.0L) + 59.0L/2688.0L) - 59.0L/1536.0L) - 33853.0L/161280.0L) + 33853.0L/96768.0L) + 4469.0L/6720.0L) - 4469.0L/4480.0L) - 15.0L/56.0L) + 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/2304.0L)*x - 11626792853.0L/192.0L) + 426308070201.0L/1280.0L) - 12788713031809.0L/11520.0L) + 71931342205151.0L/28800.0L) - 46030914133919.0L/11520.0L) + 1610817254280949.0L/345600.0L) - 51125084424843.0L/12800.0L) + 287484387720959.0L/115200.0L) - 5321366152817.0L/4800.0L) + 7657951532803.0L/23040.0L) - 6955706731597.0L/115200.0L) + 12157669408391.0L/2419200.0L) - 1.0L/50400.0L) + 11.0L/604800.0L) + 1.0L/672.0L) - 3.0L/2240.0L) - 971.0L/25200.0L) + 971.0L/28800.0L) + 1039.0L/2520.0L) - 1039.0L/3024.0L) - 1769.0L/1050.0L) + 1769.0L/1400.0L) + 12.0L/7.0L) - 6.0L/7.0L;
-poly_val[6] = x*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/1728.0L*x + 11626792853.0L/144.0L) - 142102690067.0L/320.0L) + 12788713031809.0L/8640.0L) - 71931342205151.0L/21600.0L) + 46030914133919.0L/8640.0L) - 1610817254280949.0L/259200.0L) + 17041694808281.0L/3200.0L) - 287484387720959.0L/86400.0L) + 5321366152817.0L/3600.0L) - 7657951532803.0L/17280.0L) + 6955706731597.0L/86400.0L) - 12157669408391.0L/1814400.0L) + 1.0L/43200.0L) - 91.0L/51840.0L) + 1001.0L/21600.0L) - 44473.0L/86400.0L) + 37037.0L/16200.0L) - 5369.0L/1800.0L);
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/1728.0L)*x - 11626792853.0L/144.0L) + 142102690067.0L/320.0L) - 12788713031809.0L/8640.0L) + 71931342205151.0L/21600.0L) - 46030914133919.0L/8640.0L) + 1610817254280949.0L/259200.0L) - 17041694808281.0L/3200.0L) + 287484387720959.0L/86400.0L) - 5321366152817.0L/3600.0L) + 7657951532803.0L/17280.0L) - 6955706731597.0L/86400.0L) + 12157669408391.0L/1814400.0L) - 1.0L/50400.0L) - 11.0L/604800.0L) + 1.0L/672.0L) + 3.0L/2240.0L) - 971.0L/25200.0L) - 971.0L/28800.0L) + 1039.0L/2520.0L) + 1039.0L/3024.0L) - 1769.0L/1050.0L) - 1769.0L/1400.0L) + 12.0L/7.0L) + 6.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/2304.0L*x + 11626792853.0L/192.0L) - 426308070201.0L/1280.0L) + 12788713031809.0L/11520.0L) - 71931342205151.0L/28800.0L) + 46030914133919.0L/11520.0L) - 1610817254280949.0L/345600.0L) + 51125084424843.0L/12800.0L) - 287484387720959.0L/115200.0L) + 5321366152817.0L/4800.0L) - 7657951532803.0L/23040.0L) + 6955706731597.0L/115200.0L) - 12157669408391.0L/2419200.0L) + 1.0L/80640.0L) + 11.0L/483840.0L) - 29.0L/32256.0L) - 29.0L/17920.0L) + 59.0L/2688.0L) + 59.0L/1536.0L) - 33853.0L/161280.0L) - 33853.0L/96768.0L) + 4469.0L/6720.0L) + 4469.0L/4480.0L) - 15.0L/56.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58133964265.0L/20736.0L)*x - 58133964265.0L/1728.0L) + 142102690067.0L/768.0L) - 12788713031809.0L/20736.0L) + 71931342205151.0L/51840.0L) - 46030914133919.0L/20736.0L) + 1610817254280949.0L/622080.0L) - 17041694808281.0L/7680.0L) + 287484387720959.0L/207360.0L) - 5321366152817.0L/8640.0L) + 7657951532803.0L/41472.0L) - 6955706731597.0L/207360.0L) + 12157669408391.0L/4354560.0L) - 1.0L/181440.0L) - 11.0L/725760.0L) + 41.0L/108864.0L) + 41.0L/40320.0L) - 151.0L/18144.0L) - 151.0L/6912.0L) + 3011.0L/45360.0L) + 3011.0L/18144.0L) - 4969.0L/34020.0L) - 4969.0L/15120.0L) + 10.0L/189.0L) + 5.0L/63.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/10368.0L*x + 11626792853.0L/864.0L) - 142102690067.0L/1920.0L) + 12788713031809.0L/51840.0L) - 71931342205151.0L/129600.0L) + 46030914133919.0L/51840.0L) - 1610817254280949.0L/1555200.0L) + 17041694808281.0L/19200.0L) - 287484387720959.0L/518400.0L) + 5321366152817.0L/21600.0L) - 7657951532803.0L/103680.0L) + 6955706731597.0L/518400.0L) - 12157669408391.0L/10886400.0L) + 1.0L/604800.0L) + 11.0L/1814400.0L) - 5.0L/48384.0L) - 1.0L/2688.0L) + 601.0L/302400.0L) + 601.0L/86400.0L) - 625.0L/48384.0L) - 3125.0L/72576.0L) + 643.0L/25200.0L) + 643.0L/8400.0L) - 1.0L/112.0L) - 1.0L/56.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/38016.0L)*x - 11626792853.0L/3168.0L) + 142102690067.0L/7040.0L) - 1162610275619.0L/17280.0L) + 6539212927741.0L/43200.0L) - 4184628557629.0L/17280.0L) + 146437932207359.0L/518400.0L) - 1549244982571.0L/6400.0L) + 26134944338269.0L/172800.0L) - 483760559347.0L/7200.0L) + 696177412073.0L/34560.0L) - 6955706731597.0L/1900800.0L) + 12157669408391.0L/39916800.0L) - 1.0L/3326400.0L) - 1.0L/725760.0L) + 1.0L/60480.0L) + 1.0L/13440.0L) - 41.0L/151200.0L) - 41.0L/34560.0L) + 121.0L/75600.0L) + 121.0L/18144.0L) - 19.0L/6300.0L) - 19.0L/1680.0L) + 2.0L/1925.0L) + 1.0L/385.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/228096.0L*x + 11626792853.0L/19008.0L) - 142102690067.0L/42240.0L) + 1162610275619.0L/103680.0L) - 6539212927741.0L/259200.0L) + 4184628557629.0L/103680.0L) - 146437932207359.0L/3110400.0L) + 1549244982571.0L/38400.0L) - 26134944338269.0L/1036800.0L) + 483760559347.0L/43200.0L) - 696177412073.0L/207360.0L) + 6955706731597.0L/11404800.0L) - 12157669408391.0L/239500800.0L) + 1.0L/39916800.0L) + 1.0L/7257600.0L) - 1.0L/870912.0L) - 1.0L/161280.0L) + 31.0L/1814400.0L) + 31.0L/345600.0L) - 139.0L/1451520.0L) - 139.0L/290304.0L) + 479.0L/2721600.0L) + 479.0L/604800.0L) - 1.0L/16632.0L) - 1.0L/5544.0L;
-poly_val[13] = pow(x, 12)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((894368681.0L/228096.0L)*x - 894368681.0L/19008.0L) + 10930976159.0L/42240.0L) - 89431559663.0L/103680.0L) + 503016379057.0L/259200.0L) - 321894504433.0L/103680.0L) + 11264456323643.0L/3110400.0L) - 119172690967.0L/38400.0L) + 2010380333713.0L/1036800.0L) - 37212350719.0L/43200.0L) + 53552108621.0L/207360.0L) - 535054363969.0L/11404800.0L) + 935205339107.0L/239500800.0L);
-break;
-case 2:
-poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-894368681.0L/9504.0L*x + 20570479663.0L/19008.0L) - 10930976159.0L/1920.0L) + 626020917641.0L/34560.0L) - 503016379057.0L/12960.0L) + 6115995584227.0L/103680.0L) - 11264456323643.0L/172800.0L) + 2025935746439.0L/38400.0L) - 2010380333713.0L/64800.0L) + 37212350719.0L/2880.0L) - 374864760347.0L/103680.0L) + 6955706731597.0L/11404800.0L) - 935205339107.0L/19958400.0L) + 1.0L/3628800.0L) - 1.0L/725760.0L) - 1.0L/96768.0L) + 1.0L/20160.0L) + 31.0L/259200.0L) - 31.0L/57600.0L) - 139.0L/290304.0L) + 139.0L/72576.0L) + 479.0L/907200.0L) - 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/9504.0L)*x - 267416235619.0L/19008.0L) + 142102690067.0L/1920.0L) - 8138271929333.0L/34560.0L) + 6539212927741.0L/12960.0L) - 79507942594951.0L/103680.0L) + 146437932207359.0L/172800.0L) - 26337164703707.0L/38400.0L) + 26134944338269.0L/64800.0L) - 483760559347.0L/2880.0L) + 4873241884511.0L/103680.0L) - 90424187510761.0L/11404800.0L) + 12157669408391.0L/19958400.0L) - 1.0L/302400.0L) + 1.0L/72576.0L) + 1.0L/6720.0L) - 1.0L/1680.0L) - 41.0L/21600.0L) + 41.0L/5760.0L) + 121.0L/15120.0L) - 121.0L/4536.0L) - 19.0L/2100.0L) + 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/1584.0L*x + 267416235619.0L/3168.0L) - 142102690067.0L/320.0L) + 8138271929333.0L/5760.0L) - 6539212927741.0L/2160.0L) + 79507942594951.0L/17280.0L) - 146437932207359.0L/28800.0L) + 26337164703707.0L/6400.0L) - 26134944338269.0L/10800.0L) + 483760559347.0L/480.0L) - 4873241884511.0L/17280.0L) + 90424187510761.0L/1900800.0L) - 12157669408391.0L/3326400.0L) + 11.0L/604800.0L) - 11.0L/181440.0L) - 5.0L/5376.0L) + 1.0L/336.0L) + 601.0L/43200.0L) - 601.0L/14400.0L) - 3125.0L/48384.0L) + 3125.0L/18144.0L) + 643.0L/8400.0L) - 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/432.0L)*x - 267416235619.0L/864.0L) + 1563129590737.0L/960.0L) - 89520991222663.0L/17280.0L) + 71931342205151.0L/6480.0L) - 874587368544461.0L/51840.0L) + 1610817254280949.0L/86400.0L) - 289708811740777.0L/19200.0L) + 287484387720959.0L/32400.0L) - 5321366152817.0L/1440.0L) + 53605660729621.0L/51840.0L) - 90424187510761.0L/518400.0L) + 12157669408391.0L/907200.0L) - 11.0L/181440.0L) + 11.0L/72576.0L) + 41.0L/12096.0L) - 41.0L/5040.0L) - 151.0L/2592.0L) + 151.0L/1152.0L) + 3011.0L/9072.0L) - 3011.0L/4536.0L) - 4969.0L/11340.0L) + 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-58133964265.0L/864.0L*x + 1337081178095.0L/1728.0L) - 1563129590737.0L/384.0L) + 89520991222663.0L/6912.0L) - 71931342205151.0L/2592.0L) + 874587368544461.0L/20736.0L) - 1610817254280949.0L/34560.0L) + 289708811740777.0L/7680.0L) - 287484387720959.0L/12960.0L) + 5321366152817.0L/576.0L) - 53605660729621.0L/20736.0L) + 90424187510761.0L/207360.0L) - 12157669408391.0L/362880.0L) + 11.0L/80640.0L) - 11.0L/48384.0L) - 29.0L/3584.0L) + 29.0L/2240.0L) + 59.0L/384.0L) - 59.0L/256.0L) - 33853.0L/32256.0L) + 33853.0L/24192.0L) + 4469.0L/2240.0L) - 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/96.0L)*x - 267416235619.0L/192.0L) + 4689388772211.0L/640.0L) - 89520991222663.0L/3840.0L) + 71931342205151.0L/1440.0L) - 874587368544461.0L/11520.0L) + 1610817254280949.0L/19200.0L) - 869126435222331.0L/12800.0L) + 287484387720959.0L/7200.0L) - 5321366152817.0L/320.0L) + 53605660729621.0L/11520.0L) - 90424187510761.0L/115200.0L) + 12157669408391.0L/201600.0L) - 11.0L/50400.0L) + 11.0L/60480.0L) + 3.0L/224.0L) - 3.0L/280.0L) - 971.0L/3600.0L) + 971.0L/4800.0L) + 1039.0L/504.0L) - 1039.0L/756.0L) - 1769.0L/350.0L) + 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[6] = pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/72.0L*x + 267416235619.0L/144.0L) - 1563129590737.0L/160.0L) + 89520991222663.0L/2880.0L) - 71931342205151.0L/1080.0L) + 874587368544461.0L/8640.0L) - 1610817254280949.0L/14400.0L) + 289708811740777.0L/3200.0L) - 287484387720959.0L/5400.0L) + 5321366152817.0L/240.0L) - 53605660729621.0L/8640.0L) + 90424187510761.0L/86400.0L) - 12157669408391.0L/151200.0L) + 11.0L/43200.0L) - 91.0L/5760.0L) + 7007.0L/21600.0L) - 44473.0L/17280.0L) + 37037.0L/5400.0L) - 5369.0L/1800.0L;
-poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/72.0L)*x - 267416235619.0L/144.0L) + 1563129590737.0L/160.0L) - 89520991222663.0L/2880.0L) + 71931342205151.0L/1080.0L) - 874587368544461.0L/8640.0L) + 1610817254280949.0L/14400.0L) - 289708811740777.0L/3200.0L) + 287484387720959.0L/5400.0L) - 5321366152817.0L/240.0L) + 53605660729621.0L/8640.0L) - 90424187510761.0L/86400.0L) + 12157669408391.0L/151200.0L) - 11.0L/50400.0L) - 11.0L/60480.0L) + 3.0L/224.0L) + 3.0L/280.0L) - 971.0L/3600.0L) - 971.0L/4800.0L) + 1039.0L/504.0L) + 1039.0L/756.0L) - 1769.0L/350.0L) - 1769.0L/700.0L) + 12.0L/7.0L;
-poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/96.0L*x + 267416235619.0L/192.0L) - 4689388772211.0L/640.0L) + 89520991222663.0L/3840.0L) - 71931342205151.0L/1440.0L) + 874587368544461.0L/11520.0L) - 1610817254280949.0L/19200.0L) + 869126435222331.0L/12800.0L) - 287484387720959.0L/7200.0L) + 5321366152817.0L/320.0L) - 53605660729621.0L/11520.0L) + 90424187510761.0L/115200.0L) - 12157669408391.0L/201600.0L) + 11.0L/80640.0L) + 11.0L/48384.0L) - 29.0L/3584.0L) - 29.0L/2240.0L) + 59.0L/384.0L) + 59.0L/256.0L) - 33853.0L/32256.0L) - 33853.0L/24192.0L) + 4469.0L/2240.0L) + 4469.0L/2240.0L) - 15.0L/56.0L;
-poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((58133964265.0L/864.0L)*x - 1337081178095.0L/1728.0L) + 1563129590737.0L/384.0L) - 89520991222663.0L/6912.0L) + 71931342205151.0L/2592.0L) - 874587368544461.0L/20736.0L) + 1610817254280949.0L/34560.0L) - 289708811740777.0L/7680.0L) + 287484387720959.0L/12960.0L) - 5321366152817.0L/576.0L) + 53605660729621.0L/20736.0L) - 90424187510761.0L/207360.0L) + 12157669408391.0L/362880.0L) - 11.0L/181440.0L) - 11.0L/72576.0L) + 41.0L/12096.0L) + 41.0L/5040.0L) - 151.0L/2592.0L) - 151.0L/1152.0L) + 3011.0L/9072.0L) + 3011.0L/4536.0L) - 4969.0L/11340.0L) - 4969.0L/7560.0L) + 10.0L/189.0L;
-poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/432.0L*x + 267416235619.0L/864.0L) - 1563129590737.0L/960.0L) + 89520991222663.0L/17280.0L) - 71931342205151.0L/6480.0L) + 874587368544461.0L/51840.0L) - 1610817254280949.0L/86400.0L) + 289708811740777.0L/19200.0L) - 287484387720959.0L/32400.0L) + 5321366152817.0L/1440.0L) - 53605660729621.0L/51840.0L) + 90424187510761.0L/518400.0L) - 12157669408391.0L/907200.0L) + 11.0L/604800.0L) + 11.0L/181440.0L) - 5.0L/5376.0L) - 1.0L/336.0L) + 601.0L/43200.0L) + 601.0L/14400.0L) - 3125.0L/48384.0L) - 3125.0L/18144.0L) + 643.0L/8400.0L) + 643.0L/4200.0L) - 1.0L/112.0L;
-poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((11626792853.0L/1584.0L)*x - 267416235619.0L/3168.0L) + 142102690067.0L/320.0L) - 8138271929333.0L/5760.0L) + 6539212927741.0L/2160.0L) - 79507942594951.0L/17280.0L) + 146437932207359.0L/28800.0L) - 26337164703707.0L/6400.0L) + 26134944338269.0L/10800.0L) - 483760559347.0L/480.0L) + 4873241884511.0L/17280.0L) - 90424187510761.0L/1900800.0L) + 12157669408391.0L/3326400.0L) - 1.0L/302400.0L) - 1.0L/72576.0L) + 1.0L/6720.0L) + 1.0L/1680.0L) - 41.0L/21600.0L) - 41.0L/5760.0L) + 121.0L/15120.0L) + 121.0L/4536.0L) - 19.0L/2100.0L) - 19.0L/840.0L) + 2.0L/1925.0L;
-poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(-11626792853.0L/9504.0L*x + 267416235619.0L/19008.0L) - 142102690067.0L/1920.0L) + 8138271929333.0L/34560.0L) - 6539212927741.0L/12960.0L) + 79507942594951.0L/103680.0L) - 146437932207359.0L/172800.0L) + 26337164703707.0L/38400.0L) - 26134944338269.0L/64800.0L) + 483760559347.0L/2880.0L) - 4873241884511.0L/103680.0L) + 90424187510761.0L/11404800.0L) - 12157669408391.0L/19958400.0L) + 1.0L/3628800.0L) + 1.0L/725760.0L) - 1.0L/96768.0L) - 1.0L/20160.0L) + 31.0L/259200.0L) + 31.0L/57600.0L) - 139.0L/290304.0L) - 139.0L/72576.0L) + 479.0L/907200.0L) + 479.0L/302400.0L) - 1.0L/16632.0L;
-poly_val[13] = pow(x, 11)*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*(x*((894368681.0L/9504.0L)*x - 20570479663.0L/19008.0L) + 10930976159.0L/1920.0L) - 626020917641.0L/34560.0L) + 503016379057.0L/12960.0L) - 6115995584227.0L/103680.0L) + 11264456323643.0L/172800.0L) - 2025935746439.0L/38400.0L) + 2010380333713.0L/64800.0L) - 37212350719.0L/2880.0L) + 374864760347.0L/103680.0L) - 6955706731597.0L/11404800.0L) + 935205339107.0L/19958400.0L);
-break;
+
+template void beta_n6_m10<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m10<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 11, 0>
+{
+    static constexpr int degree = 23;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {41.11735006313131, -534.525550820707, 3207.1533049242425, -11759.562118055555,
+         29398.905295138888, -52918.02953125, 70557.37270833334, -70557.37270833334,
+         52918.02953125, -29398.905295138888, 11759.562118055555, -3207.1533049242425,
+         534.525550820707, -41.11735006313131},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-123.90611053700029, 1610.7794369810038, -9664.676621886023, 35437.147613582085,
+         -88592.86903395521, 159467.16426111938, -212622.8856814925, 212622.8856814925,
+         -159467.16426111938, 88592.86903395521, -35437.147613582085, 9664.676621886023,
+         -1610.7794369810038, 123.90611053700029},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {171.29643852076904, -2226.8537007699974, 13361.122204619984, -48990.78141693994,
+         122476.95354234986, -220458.51637622976, 293944.68850163964, -293944.68850163964,
+         220458.51637622976, -122476.95354234986, 48990.78141693994, -13361.122204619984,
+         2226.8537007699974, -171.29643852076904},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-143.7041377616223, 1868.15379090109, -11208.922745406539, 41099.38339982398,
+         -102748.45849955994, 184947.2252992079, -246596.30039894386, 246596.30039894386,
+         -184947.2252992079, 102748.45849955994, -41099.38339982398, 11208.922745406539,
+         -1868.15379090109, 143.7041377616223},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {81.51959352595325, -1059.7547158373923, 6358.528295024354, -23314.60374842263,
+         58286.50937105658, -104915.71686790184, 139887.62249053578, -139887.62249053578,
+         104915.71686790184, -58286.50937105658, 23314.60374842263, -6358.528295024354,
+         1059.7547158373923, -81.51959352595325},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-32.96961441270825, 428.60498736520725, -2571.6299241912434, 9429.309722034559,
+         -23573.2743050864, 42431.89374915552, -56575.85833220736, 56575.85833220736,
+         -42431.89374915552, 23573.2743050864, -9429.309722034559, 2571.6299241912434,
+         -428.60498736520725, 32.96961441270825},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {9.76174078280333, -126.90263020149538, 761.4157813342329, -2791.857865259618,
+         6979.6446638379775, -12563.360395735079, 16751.147194864585, -16751.147194864585,
+         12563.360395735079, -6979.6446638379775, 2791.857865259618, -761.4157813342329,
+         126.90263020149538, -9.76174078280333},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-2.137728739171642, 27.79047464263082, -166.74285577851418, 611.3905010416478,
+         -1528.476318224986, 2751.25745981721, -3668.3433410713155, 3668.3433410713155,
+         -2751.25745981721, 1528.476318224986, -611.3905010416478, 166.74285577851418,
+         -27.79047464263082, 2.137728739171642},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.3457069175668074, -4.494203672581459, 26.96534862692394, -98.87365360185163,
+         247.1861860776284, -444.93836627653667, 593.2536564821415, -593.2536564821415,
+         444.93836627653667, -247.1861860776284, 98.87365360185163, -26.96534862692394,
+         4.494203672581459, -0.3457069175668074},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.0409686269047399, 0.5326597943686514, -3.1966369776729975, 11.725543755086852,
+         -29.33645529149386, 52.8556295744988, -70.52035134087164, 70.52035134087164,
+         -52.8556295744988, 29.33645529149386, -11.725543755086852, 3.1966369776729975,
+         -0.5326597943686514, 0.0409686269047399},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.003598665836574329, -0.04688611530937005, 0.2823901301743282, -1.0431257740178226,
+         2.6534539333161957, -5.050621651340887, 7.1139291465250905, -7.1139291465250905,
+         5.050621651340887, -2.6534539333161957, 1.0431257740178226, -0.2823901301743282,
+         0.04688611530937005, -0.003598665836574329},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00020191381499828274, 0.0026467274065898917, -0.01610828296808654, 0.06071464060541289,
+         -0.16181604007728778, 0.35679453742232115, -1.567820471283147, 1.567820471283147,
+         -0.35679453742232115, 0.16181604007728778, -0.06071464060541289, 0.01610828296808654,
+         -0.0026467274065898917, 0.00020191381499828274},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 11, 0>::coefficients[24][14];
+
+template <>
+struct spline_polynomials<6, 11, 1>
+{
+    static constexpr int degree = 22;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {945.6990514520202, -12294.087668876262, 73764.52601325758, -270469.92871527775,
+         676174.8217881945, -1217114.67921875, 1622819.5722916666, -1622819.5722916666,
+         1217114.67921875, -676174.8217881945, 270469.92871527775, -73764.52601325758,
+         12294.087668876262, -945.6990514520202},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-2602.0283212770064, 33826.36817660108, -202958.20905960648, 744180.0998852238,
+         -1860450.2497130595, 3348810.449483507, -4465080.599311342, 4465080.599311342,
+         -3348810.449483507, 1860450.2497130595, -744180.0998852238, 202958.20905960648,
+         -33826.36817660108, 2602.0283212770064},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {3254.6323318946115, -42310.22031462995, 253861.32188777972, -930824.846921859,
+         2327062.1173046473, -4188711.811148365, 5584949.081531154, -5584949.081531154,
+         4188711.811148365, -2327062.1173046473, 930824.846921859, -253861.32188777972,
+         42310.22031462995, -3254.6323318946115},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-2442.970341947579, 31758.61444531853, -190551.68667191116, 698689.5177970076,
+         -1746723.794492519, 3144102.8300865344, -4192137.1067820457, 4192137.1067820457,
+         -3144102.8300865344, 1746723.794492519, -698689.5177970076, 190551.68667191116,
+         -31758.61444531853, 2442.970341947579},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {1222.7939028892988, -15896.320737560884, 95377.9244253653, -349719.0562263395,
+         874297.6405658487, -1573735.7530185275, 2098314.3373580365, -2098314.3373580365,
+         1573735.7530185275, -874297.6405658487, 349719.0562263395, -95377.9244253653,
+         15896.320737560884, -1222.7939028892988},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-428.60498736520725, 5571.864835747694, -33431.18901448617, 122581.02638644927,
+         -306452.5659661232, 551614.6187390217, -735486.1583186956, 735486.1583186956,
+         -551614.6187390217, 306452.5659661232, -122581.02638644927, 33431.18901448617,
+         -5571.864835747694, 428.60498736520725},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {107.37914861083661, -1395.928932216449, 8375.573594676562, -30710.436517855796,
+         76776.09130221776, -138196.96435308587, 184262.61914351044, -184262.61914351044,
+         138196.96435308587, -76776.09130221776, 30710.436517855796, -8375.573594676562,
+         1395.928932216449, -107.37914861083661},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-19.23955865254478, 250.11427178367737, -1500.6857020066277, 5502.514509374831,
+         -13756.286864024874, 24761.31713835489, -33015.09006964184, 33015.09006964184,
+         -24761.31713835489, 13756.286864024874, -5502.514509374831, 1500.6857020066277,
+         -250.11427178367737, 19.23955865254478},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {2.419948422967652, -31.459425708070214, 188.7574403884676, -692.1155752129614,
+         1730.3033025433988, -3114.5685639357566, 4152.77559537499, -4152.77559537499,
+         3114.5685639357566, -1730.3033025433988, 692.1155752129614, -188.7574403884676,
+         31.459425708070214, -2.419948422967652},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.2048431345236995, 2.663298971843257, -15.983184888364987, 58.62771877543426,
+         -146.6822764574693, 264.278147872494, -352.6017567043582, 352.6017567043582,
+         -264.278147872494, 146.6822764574693, -58.62771877543426, 15.983184888364987,
+         -2.663298971843257, 0.2048431345236995},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.010795997509722988, -0.14065834592811013, 0.8471703905229846, -3.1293773220534677,
+         7.960361799948588, -15.151864954022662, 21.34178743957527, -21.34178743957527,
+         15.151864954022662, -7.960361799948588, 3.1293773220534677, -0.8471703905229846,
+         0.14065834592811013, -0.010795997509722988},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00020191381499828274, 0.0026467274065898917, -0.01610828296808654, 0.06071464060541289,
+         -0.16181604007728778, 0.35679453742232115, -1.567820471283147, 1.567820471283147,
+         -0.35679453742232115, 0.16181604007728778, -0.06071464060541289, 0.01610828296808654,
+         -0.0026467274065898917, 0.00020191381499828274}};
+};
+constexpr double spline_polynomials<6, 11, 1>::coefficients[23][14];
+
+template <>
+struct spline_polynomials<6, 11, 2>
+{
+    static constexpr int degree = 21;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {20805.379131944443, -270469.92871527775, 1622819.5722916666, -5950338.431736111,
+         14875846.079340277, -26776522.9428125, 35702030.59041667, -35702030.59041667,
+         26776522.9428125, -14875846.079340277, 5950338.431736111, -1622819.5722916666,
+         270469.92871527775, -20805.379131944443},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-52040.56642554012, 676527.3635320216, -4059164.18119213, 14883601.997704476,
+         -37209004.99426119, 66976208.98967014, -89301611.98622686, 89301611.98622686,
+         -66976208.98967014, 37209004.99426119, -14883601.997704476, 4059164.18119213,
+         -676527.3635320216, 52040.56642554012},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {58583.38197410301, -761583.9656633391, 4569503.793980035, -16754847.24459346,
+         41887118.11148365, -75396812.60067058, 100529083.46756077, -100529083.46756077,
+         75396812.60067058, -41887118.11148365, 16754847.24459346, -4569503.793980035,
+         761583.9656633391, -58583.38197410301},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-39087.525471161265, 508137.8311250965, -3048826.9867505785, 11179032.284752121,
+         -27947580.711880304, 50305645.28138455, -67074193.70851273, 67074193.70851273,
+         -50305645.28138455, 27947580.711880304, -11179032.284752121, 3048826.9867505785,
+         -508137.8311250965, 39087.525471161265},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {17119.11464045018, -222548.49032585238, 1335290.9419551142, -4896066.787168752,
+         12240166.967921881, -22032300.542259388, 29376400.723012514, -29376400.723012514,
+         22032300.542259388, -12240166.967921881, 4896066.787168752, -1335290.9419551142,
+         222548.49032585238, -17119.11464045018},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-5143.259848382487, 66862.37802897234, -401174.268173834, 1470972.3166373912,
+         -3677430.7915934785, 6619375.4248682605, -8825833.899824347, 8825833.899824347,
+         -6619375.4248682605, 3677430.7915934785, -1470972.3166373912, 401174.268173834,
+         -66862.37802897234, 5143.259848382487},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {1073.7914861083661, -13959.289322164492, 83755.7359467656, -307104.365178558,
+         767760.9130221775, -1381969.6435308587, 1842626.1914351045, -1842626.1914351045,
+         1381969.6435308587, -767760.9130221775, 307104.365178558, -83755.7359467656,
+         13959.289322164492, -1073.7914861083661},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-153.91646922035824, 2000.914174269419, -12005.485616053022, 44020.116074998645,
+         -110050.294912199, 198090.53710683913, -264120.7205571347, 264120.7205571347,
+         -198090.53710683913, 110050.294912199, -44020.116074998645, 12005.485616053022,
+         -2000.914174269419, 153.91646922035824},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {14.51969053780591, -188.75655424842128, 1132.5446423308056, -4152.693451277768,
+         10381.819815260393, -18687.41138361454, 24916.653572249943, -24916.653572249943,
+         18687.41138361454, -10381.819815260393, 4152.693451277768, -1132.5446423308056,
+         188.75655424842128, -14.51969053780591},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-0.819372538094798, 10.653195887373029, -63.932739553459946, 234.51087510173704,
+         -586.7291058298772, 1057.112591489976, -1410.4070268174328, 1410.4070268174328,
+         -1057.112591489976, 586.7291058298772, -234.51087510173704, 63.932739553459946,
+         -10.653195887373029, 0.819372538094798},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.021591995019445975, -0.28131669185622027, 1.6943407810459692, -6.2587546441069355,
+         15.920723599897176, -30.303729908045323, 42.68357487915054, -42.68357487915054,
+         30.303729908045323, -15.920723599897176, 6.2587546441069355, -1.6943407810459692,
+         0.28131669185622027, -0.021591995019445975},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 11, 2>::coefficients[22][14];
+
+template <class real_number>
+void beta_n6_m11(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 11, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 11, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 11, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m11<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m11<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<6, 12, 0>
+{
+    static constexpr int degree = 25;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-156.84074793069584, 2038.929723099046, -12233.578338594276, 44856.45390817901,
+         -112141.13477044753, 201854.04258680556, -269138.7234490741, 269138.7234490741,
+         -201854.04258680556, 112141.13477044753, -44856.45390817901, 12233.578338594276,
+         -2038.929723099046, 156.84074793069584},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {511.63959385521883, -6651.314720117845, 39907.88832070707, -146328.9238425926,
+         365822.30960648146, -658480.1572916667, 877973.5430555556, -877973.5430555556,
+         658480.1572916667, -365822.30960648146, 146328.9238425926, -39907.88832070707,
+         6651.314720117845, -511.63959385521883},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-770.8741957511206, 10021.364544764569, -60128.18726858741, 220470.0199848205,
+         -551175.0499620513, 992115.0899316923, -1322820.119908923, 1322820.119908923,
+         -992115.0899316923, 551175.0499620513, -220470.0199848205, 60128.18726858741,
+         -10021.364544764569, 770.8741957511206},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {710.436509532536, -9235.674623922969, 55414.047743537805, -203184.8417263053,
+         507962.1043157632, -914331.7877683738, 1219109.0503578319, -1219109.0503578319,
+         914331.7877683738, -507962.1043157632, 203184.8417263053, -55414.047743537805,
+         9235.674623922969, -710.436509532536},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-446.9704277057412, 5810.615560174636, -34863.693361047815, 127833.54232384199,
+         -319583.855809605, 575250.940457289, -767001.2539430519, 767001.2539430519,
+         -575250.940457289, 319583.855809605, -127833.54232384199, 34863.693361047815,
+         -5810.615560174636, 446.9704277057412},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {202.82610950360083, -2636.7394235468105, 15820.436541280864, -58008.26731802984,
+         145020.66829507457, -261037.20293113426, 348049.60390817904, -348049.60390817904,
+         261037.20293113426, -145020.66829507457, 58008.26731802984, -15820.436541280864,
+         2636.7394235468105, -202.82610950360083},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-68.35068157285546, 888.558860447121, -5331.353162682726, 19548.294929836662,
+         -48870.73732459165, 87967.32718426497, -117289.76957901997, 117289.76957901997,
+         -87967.32718426497, 48870.73732459165, -19548.294929836662, 5331.353162682726,
+         -888.558860447121, 68.35068157285546},
+        {1.043837849393405e-09, -1.1482216343327455e-08, 5.636724386724387e-08, -1.6075102880658437e-07,
+         2.8705540858318636e-07, -3.1001984126984127e-07, 1.3778659611992944e-07, 1.3778659611992944e-07,
+         -3.1001984126984127e-07, 2.8705540858318636e-07, -1.6075102880658437e-07, 5.636724386724387e-08,
+         -1.1482216343327455e-08, 1.043837849393405e-09},
+        {17.343398031406302, -225.46417443333402, 1352.7850467252647, -4960.211838360068,
+         12400.529596589104, -22320.953274687105, 29761.27103346729, -29761.27103346729,
+         22320.953274687105, -12400.529596589104, 4960.211838360068, -1352.7850467252647,
+         225.46417443333402, -17.343398031406302},
+        {-7.463440623162845e-08, 9.587650646678424e-07, -5.270337301587302e-06, 1.631622942386831e-05,
+         -3.0858456422692537e-05, 3.4567212301587303e-05, -1.5638778659611993e-05, -1.5638778659611993e-05,
+         3.4567212301587303e-05, -3.0858456422692537e-05, 1.631622942386831e-05, -5.270337301587302e-06,
+         9.587650646678424e-07, -7.463440623162845e-08},
+        {-3.3223626842658565, 43.19071592885561, -259.1443034958629, 950.1958093385932,
+         -2375.4895889673494, 4275.881347153464, -5701.175190852988, 5701.175190852988,
+         -4275.881347153464, 2375.4895889673494, -950.1958093385932, 259.1443034958629,
+         -43.19071592885561, 3.3223626842658565},
+        {1.875189456569665e-06, -2.6310781112213404e-05, 0.00016481429811507936, -0.000574514130015432,
+         0.0011899702553185626, -0.0014156862289186507, 0.0006598513971560846, 0.0006598513971560846,
+         -0.0014156862289186507, 0.0011899702553185626, -0.000574514130015432, 0.00016481429811507936,
+         -2.6310781112213404e-05, 1.875189456569665e-06},
+        {0.4773329114661646, -6.205341593273102, 37.2321761510738, -136.51868785706776,
+         341.29877171566875, -614.3410204250093, 819.1238620134384, -819.1238620134384,
+         614.3410204250093, -341.29877171566875, 136.51868785706776, -37.2321761510738,
+         6.205341593273102, -0.4773329114661646},
+        {-2.014196038176073e-05, 0.0002971547354956643, -0.002028421068948413, 0.008264984005272634,
+         -0.019889082507761977, 0.02632721431671627, -0.012951707520392416, -0.012951707520392416,
+         0.02632721431671627, -0.019889082507761977, 0.008264984005272634, -0.002028421068948413,
+         0.0002971547354956643, -2.014196038176073e-05},
+        {-0.05084057644719169, 0.6609951384205246, -3.966649041984237, 14.548921324228063,
+         -36.394899214346886, 65.56082863563425, -87.4606167557189, 87.4606167557189,
+         -65.56082863563425, 36.394899214346886, -14.548921324228063, 3.966649041984237,
+         -0.6609951384205246, 0.05084057644719169},
+        {8.957119986003178e-05, -0.0013573285371398028, 0.009715200757223463, -0.043601575937781314,
+         0.13434971647357885, -0.2201127685062469, 0.12091718455050568, 0.12091718455050568,
+         -0.2201127685062469, 0.13434971647357885, -0.043601575937781314, 0.009715200757223463,
+         -0.0013573285371398028, 8.957119986003178e-05},
+        {0.004047390815776683, -0.05271954003900065, 0.31739067855211184, -1.1714611180696959,
+         2.974292293445879, -5.628130699574316, 7.88394121083633, -7.88394121083633,
+         5.628130699574316, -2.974292293445879, 1.1714611180696959, -0.31739067855211184,
+         0.05271954003900065, -0.004047390815776683},
+        {-0.00013131232030005223, 0.0020134624097713086, -0.014714742443090222, 0.06889780397768373,
+         -0.23713053849639085, 0.6677078386337038, -0.48664251176137774, -0.48664251176137774,
+         0.6677078386337038, -0.23713053849639085, 0.06889780397768373, -0.014714742443090222,
+         0.0020134624097713086, -0.00013131232030005223},
+        {-0.00021126225206499844, 0.0027682570884571957, -0.016837461059290366, 0.06338829360649358,
+         -0.16850017257998953, 0.36882597592718425, -1.583862389289631, 1.583862389289631,
+         -0.36882597592718425, 0.16850017257998953, -0.06338829360649358, 0.016837461059290366,
+         -0.0027682570884571957, 0.00021126225206499844},
+        {2.753734588623047e-05, -0.00042307376861572266, 0.003102540969848633, -0.014626264572143555,
+         0.05119192600250244, -0.15357577800750732, 0.6143031120300293, 0.6143031120300293,
+         -0.15357577800750732, 0.05119192600250244, -0.014626264572143555, 0.003102540969848633,
+         -0.00042307376861572266, 2.753734588623047e-05}};
+};
+constexpr double spline_polynomials<6, 12, 0>::coefficients[26][14];
+
+template <>
+struct spline_polynomials<6, 12, 1>
+{
+    static constexpr int degree = 24;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-3921.0186982673963, 50973.24307747615, -305839.4584648569, 1121411.3477044753,
+         -2803528.3692611884, 5046351.064670139, -6728468.086226852, 6728468.086226852,
+         -5046351.064670139, 2803528.3692611884, -1121411.3477044753, 305839.4584648569,
+         -50973.24307747615, 3921.0186982673963},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {11767.710658670034, -152980.23856271044, 917881.4313762627, -3365565.2483796296,
+         8413913.120949075, -15145043.617708333, 20193391.49027778, -20193391.49027778,
+         15145043.617708333, -8413913.120949075, 3365565.2483796296, -917881.4313762627,
+         152980.23856271044, -11767.710658670034},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-16188.358110773534, 210448.65544005594, -1262691.9326403358, 4629870.419681231,
+         -11574676.049203077, 20834416.888565537, -27779222.518087383, 27779222.518087383,
+         -20834416.888565537, 11574676.049203077, -4629870.419681231, 1262691.9326403358,
+         -210448.65544005594, 16188.358110773534},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {13498.293681118184, -175477.8178545364, 1052866.9071272183, -3860511.992799801,
+         9651279.981999502, -17372303.9675991, 23163071.956798803, -23163071.956798803,
+         17372303.9675991, -9651279.981999502, 3860511.992799801, -1052866.9071272183,
+         175477.8178545364, -13498.293681118184},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-7598.497270997601, 98780.4645229688, -592682.7871378128, 2173170.219505314,
+         -5432925.548763284, 9779265.987773912, -13039021.317031883, 13039021.317031883,
+         -9779265.987773912, 5432925.548763284, -2173170.219505314, 592682.7871378128,
+         -98780.4645229688, 7598.497270997601},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {3042.3916425540124, -39551.09135320216, 237306.54811921297, -870124.0097704475,
+         2175310.024426119, -3915558.0439670137, 5220744.058622685, -5220744.058622685,
+         3915558.0439670137, -2175310.024426119, 870124.0097704475, -237306.54811921297,
+         39551.09135320216, -3042.3916425540124},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-888.558860447121, 11551.265185812572, -69307.59111487544, 254127.8340878766,
+         -635319.5852196915, 1143575.2533954447, -1524767.0045272596, 1524767.0045272596,
+         -1143575.2533954447, 635319.5852196915, -254127.8340878766, 69307.59111487544,
+         -11551.265185812572, 888.558860447121},
+        {1.252605419272086e-08, -1.3778659611992944e-07, 6.764069264069264e-07, -1.9290123456790124e-06,
+         3.444664902998236e-06, -3.7202380952380952e-06, 1.6534391534391535e-06, 1.6534391534391535e-06,
+         -3.7202380952380952e-06, 3.444664902998236e-06, -1.9290123456790124e-06, 6.764069264069264e-07,
+         -1.3778659611992944e-07, 1.252605419272086e-08},
+        {190.77737834546932, -2480.105918766674, 14880.635513977912, -54562.33022196075,
+         136405.82556248014, -245530.48602155817, 327373.98136814014, -327373.98136814014,
+         245530.48602155817, -136405.82556248014, 54562.33022196075, -14880.635513977912,
+         2480.105918766674, -190.77737834546932},
+        {-7.463440623162846e-07, 9.587650646678425e-06, -5.270337301587302e-05, 0.00016316229423868312,
+         -0.0003085845642269253, 0.00034567212301587303, -0.00015638778659611994, -0.00015638778659611994,
+         0.00034567212301587303, -0.0003085845642269253, 0.00016316229423868312, -5.270337301587302e-05,
+         9.587650646678425e-06, -7.463440623162846e-07},
+        {-29.90126415839271, 388.71644335970046, -2332.298731462766, 8551.76228404734,
+         -21379.406300706145, 38482.93212438118, -51310.576717676886, 51310.576717676886,
+         -38482.93212438118, 21379.406300706145, -8551.76228404734, 2332.298731462766,
+         -388.71644335970046, 29.90126415839271},
+        {1.500151565255732e-05, -0.00021048624889770723, 0.0013185143849206349, -0.004596113040123456,
+         0.0095197620425485, -0.011325489831349206, 0.005278811177248677, 0.005278811177248677,
+         -0.011325489831349206, 0.0095197620425485, -0.004596113040123456, 0.0013185143849206349,
+         -0.00021048624889770723, 1.500151565255732e-05},
+        {3.3413303802631518, -43.437391152911715, 260.6252330575166, -955.6308149994744,
+         2389.0914020096816, -4300.387142975065, 5733.867034094069, -5733.867034094069,
+         4300.387142975065, -2389.0914020096816, 955.6308149994744, -260.6252330575166,
+         43.437391152911715, -3.3413303802631518},
+        {-0.00012085176229056437, 0.001782928412973986, -0.012170526413690477, 0.0495899040316358,
+         -0.11933449504657187, 0.15796328590029762, -0.0777102451223545, -0.0777102451223545,
+         0.15796328590029762, -0.11933449504657187, 0.0495899040316358, -0.012170526413690477,
+         0.001782928412973986, -0.00012085176229056437},
+        {-0.25420288223595844, 3.304975692102623, -19.833245209921184, 72.74460662114032,
+         -181.97449607173445, 327.8041431781713, -437.30308377859456, 437.30308377859456,
+         -327.8041431781713, 181.97449607173445, -72.74460662114032, 19.833245209921184,
+         -3.304975692102623, 0.25420288223595844},
+        {0.0003582847994401271, -0.005429314148559211, 0.03886080302889385, -0.17440630375112526,
+         0.5373988658943154, -0.8804510740249876, 0.4836687382020227, 0.4836687382020227,
+         -0.8804510740249876, 0.5373988658943154, -0.17440630375112526, 0.03886080302889385,
+         -0.005429314148559211, 0.0003582847994401271},
+        {0.01214217244733005, -0.15815862011700194, 0.9521720356563355, -3.5143833542090874,
+         8.922876880337636, -16.884392098722948, 23.65182363250899, -23.65182363250899,
+         16.884392098722948, -8.922876880337636, 3.5143833542090874, -0.9521720356563355,
+         0.15815862011700194, -0.01214217244733005},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447},
+        {-0.00021126225206499844, 0.0027682570884571957, -0.016837461059290366, 0.06338829360649358,
+         -0.16850017257998953, 0.36882597592718425, -1.583862389289631, 1.583862389289631,
+         -0.36882597592718425, 0.16850017257998953, -0.06338829360649358, 0.016837461059290366,
+         -0.0027682570884571957, 0.00021126225206499844}};
+};
+constexpr double spline_polynomials<6, 12, 1>::coefficients[25][14];
+
+template <>
+struct spline_polynomials<6, 12, 2>
+{
+    static constexpr int degree = 23;
+    static constexpr int nb_values = 14;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-94104.44875841751, 1223357.8338594276, -7340147.003156566, 26913872.344907407,
+         -67284680.86226852, 121112425.55208333, -161483234.06944445, 161483234.06944445,
+         -121112425.55208333, 67284680.86226852, -26913872.344907407, 7340147.003156566,
+         -1223357.8338594276, 94104.44875841751},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {258889.63449074075, -3365565.2483796296, 20193391.49027778, -74042435.46435185,
+         185106088.66087964, -333190959.58958334, 444254612.7861111, -444254612.7861111,
+         333190959.58958334, -185106088.66087964, 74042435.46435185, -20193391.49027778,
+         3365565.2483796296, -258889.63449074075},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-323767.1622154707, 4208973.108801119, -25253838.652806714, 92597408.39362462,
+         -231493520.98406154, 416688337.77131075, -555584450.3617477, 555584450.3617477,
+         -416688337.77131075, 231493520.98406154, -92597408.39362462, 25253838.652806714,
+         -4208973.108801119, 323767.1622154707},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {242969.28626012732, -3158600.721381655, 18951604.32828993, -69489215.8703964,
+         173723039.67599103, -312701471.41678387, 416935295.2223785, -416935295.2223785,
+         312701471.41678387, -173723039.67599103, 69489215.8703964, -18951604.32828993,
+         3158600.721381655, -242969.28626012732},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-121575.95633596161, 1580487.4323675008, -9482924.594205005, 34770723.51208502,
+         -86926808.78021255, 156468255.8043826, -208624341.07251012, 208624341.07251012,
+         -156468255.8043826, 86926808.78021255, -34770723.51208502, 9482924.594205005,
+         -1580487.4323675008, 121575.95633596161},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {42593.482995756174, -553715.2789448303, 3322291.6736689815, -12181736.136786265,
+         30454340.341965664, -54817812.615538195, 73090416.82071759, -73090416.82071759,
+         54817812.615538195, -30454340.341965664, 12181736.136786265, -3322291.6736689815,
+         553715.2789448303, -42593.482995756174},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {-10662.706325365452, 138615.18222975088, -831691.0933785052, 3049534.0090545192,
+         -7623835.022636298, 13722903.040745337, -18297204.054327115, 18297204.054327115,
+         -13722903.040745337, 7623835.022636298, -3049534.0090545192, 831691.0933785052,
+         -138615.18222975088, 10662.706325365452},
+        {1.3778659611992944e-07, -1.515652557319224e-06, 7.4404761904761905e-06, -2.1219135802469135e-05,
+         3.78913139329806e-05, -4.0922619047619046e-05, 1.8187830687830687e-05, 1.8187830687830687e-05,
+         -4.0922619047619046e-05, 3.78913139329806e-05, -2.1219135802469135e-05, 7.4404761904761905e-06,
+         -1.515652557319224e-06, 1.3778659611992944e-07},
+        {1907.773783454693, -24801.059187666742, 148806.35513977913, -545623.3022196075,
+         1364058.2556248014, -2455304.8602155815, 3273739.813681402, -3273739.813681402,
+         2455304.8602155815, -1364058.2556248014, 545623.3022196075, -148806.35513977913,
+         24801.059187666742, -1907.773783454693},
+        {-6.717096560846561e-06, 8.628885582010582e-05, -0.00047433035714285714, 0.0014684606481481482,
+         -0.002777261078042328, 0.003111049107142857, -0.0014074900793650794, -0.0014074900793650794,
+         0.003111049107142857, -0.002777261078042328, 0.0014684606481481482, -0.00047433035714285714,
+         8.628885582010582e-05, -6.717096560846561e-06},
+        {-239.21011326714168, 3109.7315468776037, -18658.38985170213, 68414.09827237872,
+         -171035.25040564916, 307863.45699504943, -410484.6137414151, 410484.6137414151,
+         -307863.45699504943, 171035.25040564916, -68414.09827237872, 18658.38985170213,
+         -3109.7315468776037, 239.21011326714168},
+        {0.00010501060956790124, -0.0014734037422839505, 0.009229600694444444, -0.0321727912808642,
+         0.06663833429783951, -0.07927842881944444, 0.03695167824074074, 0.03695167824074074,
+         -0.07927842881944444, 0.06663833429783951, -0.0321727912808642, 0.009229600694444444,
+         -0.0014734037422839505, 0.00010501060956790124},
+        {20.04798228157891, -260.6243469174703, 1563.7513983450995, -5733.784889996847,
+         14334.548412058088, -25802.32285785039, 34403.20220456441, -34403.20220456441,
+         25802.32285785039, -14334.548412058088, 5733.784889996847, -1563.7513983450995,
+         260.6243469174703, -20.04798228157891},
+        {-0.0006042588114528219, 0.00891464206486993, -0.06085263206845238, 0.247949520158179,
+         -0.5966724752328594, 0.7898164295014881, -0.38855122561177247, -0.38855122561177247,
+         0.7898164295014881, -0.5966724752328594, 0.247949520158179, -0.06085263206845238,
+         0.00891464206486993, -0.0006042588114528219},
+        {-1.0168115289438338, 13.219902768410492, -79.33298083968474, 290.9784264845613,
+         -727.8979842869378, 1311.216572712685, -1749.2123351143782, 1749.2123351143782,
+         -1311.216572712685, 727.8979842869378, -290.9784264845613, 79.33298083968474,
+         -13.219902768410492, 1.0168115289438338},
+        {0.0010748543983203813, -0.016287942445677633, 0.11658240908668155, -0.5232189112533757,
+         1.6121965976829462, -2.641353222074963, 1.451006214606068, 1.451006214606068,
+         -2.641353222074963, 1.6121965976829462, -0.5232189112533757, 0.11658240908668155,
+         -0.016287942445677633, 0.0010748543983203813},
+        {0.0242843448946601, -0.31631724023400387, 1.904344071312671, -7.028766708418175,
+         17.845753760675272, -33.768784197445896, 47.30364726501798, -47.30364726501798,
+         33.768784197445896, -17.845753760675272, 7.028766708418175, -1.904344071312671,
+         0.31631724023400387, -0.0242843448946601},
+        {-0.00026262464060010447, 0.004026924819542617, -0.029429484886180444, 0.13779560795536747,
+         -0.4742610769927817, 1.3354156772674075, -0.9732850235227555, -0.9732850235227555,
+         1.3354156772674075, -0.4742610769927817, 0.13779560795536747, -0.029429484886180444,
+         0.004026924819542617, -0.00026262464060010447}};
+};
+constexpr double spline_polynomials<6, 12, 2>::coefficients[24][14];
+
+template <class real_number>
+void beta_n6_m12(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
+    switch(deriv)
+    {
+    case 0:
+        evaluate_beta_polynomials<spline_polynomials<6, 12, 0>>(x, poly_val);
+        break;
+    case 1:
+        evaluate_beta_polynomials<spline_polynomials<6, 12, 1>>(x, poly_val);
+        break;
+    case 2:
+        evaluate_beta_polynomials<spline_polynomials<6, 12, 2>>(x, poly_val);
+        break;
+    }
 }
+
+template void beta_n6_m12<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n6_m12<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
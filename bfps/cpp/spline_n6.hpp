@@ -28,19 +28,32 @@
 
 #define SPLINE_N6
 
-void beta_n6_m0( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m1( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m2( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m3( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m4( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m5( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m6( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m7( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m8( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m9( const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m10(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m11(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n6_m12(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m5(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m6(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m7(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m8(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m9(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m10(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m11(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n6_m12(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N6
 
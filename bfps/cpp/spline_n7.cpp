@@ -25,300 +25,544 @@
 
 
 #include "spline_n7.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n7_m0(int deriv, double x, double *poly_val) {
+template <>
+struct spline_polynomials<7, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, -1.0,
+         1.0, 0, 0, 0,
+         0, 0, 0, 0},
+        {0, 0, 0, 0,
+         0, 0, 0, 0.5,
+         0.5, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<7, 0, 0>::coefficients[2][16];
+
+template <>
+struct spline_polynomials<7, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, -1.0,
+         1.0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<7, 0, 1>::coefficients[1][16];
+
+template <>
+struct spline_polynomials<7, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<7, 0, 2>::coefficients[1][16];
+
+template <class real_number>
+void beta_n7_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = -x + 1;
-        poly_val[8] = x;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
+        evaluate_beta_polynomials<spline_polynomials<7, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = -1;
-        poly_val[8] = 1;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
+        evaluate_beta_polynomials<spline_polynomials<7, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
+        evaluate_beta_polynomials<spline_polynomials<7, 0, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n7_m1(int deriv, double x, double *poly_val) {
+
+template void beta_n7_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n7_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<7, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-4.1625041625041625e-05, 0.0006382506382506383, -0.004623154623154623, 0.021212121212121213,
+         -0.0707070707070707, 0.19444444444444445, -0.5833333333333334, 1.125,
+         -1.125, 0.5833333333333334, -0.19444444444444445, 0.0707070707070707,
+         -0.021212121212121213, 0.004623154623154623, -0.0006382506382506383, 4.1625041625041625e-05},
+        {2.0812520812520813e-05, -0.00036075036075036075, 0.0029914529914529917, -0.015909090909090907,
+         0.06186868686868687, -0.19444444444444445, 0.5833333333333334, -0.4375,
+         -0.4375, 0.5833333333333334, -0.19444444444444445, 0.06186868686868687,
+         -0.015909090909090907, 0.0029914529914529917, -0.00036075036075036075, 2.0812520812520813e-05},
+        {1.0406260406260406e-05, -0.00015956265956265956, 0.0011557886557886558, -0.005303030303030303,
+         0.017676767676767676, -0.04861111111111111, 0.14583333333333334, -1.28125,
+         1.28125, -0.14583333333333334, 0.04861111111111111, -0.017676767676767676,
+         0.005303030303030303, -0.0011557886557886558, 0.00015956265956265956, -1.0406260406260406e-05},
+        {-5.203130203130203e-06, 9.018759018759019e-05, -0.0007478632478632479, 0.003977272727272727,
+         -0.015467171717171718, 0.04861111111111111, -0.14583333333333334, 0.609375,
+         0.609375, -0.14583333333333334, 0.04861111111111111, -0.015467171717171718,
+         0.003977272727272727, -0.0007478632478632479, 9.018759018759019e-05, -5.203130203130203e-06}};
+};
+constexpr double spline_polynomials<7, 1, 0>::coefficients[4][16];
+
+template <>
+struct spline_polynomials<7, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00012487512487512488, 0.0019147519147519148, -0.01386946386946387, 0.06363636363636363,
+         -0.21212121212121213, 0.5833333333333334, -1.75, 3.375,
+         -3.375, 1.75, -0.5833333333333334, 0.21212121212121213,
+         -0.06363636363636363, 0.01386946386946387, -0.0019147519147519148, 0.00012487512487512488},
+        {4.1625041625041625e-05, -0.0007215007215007215, 0.005982905982905983, -0.031818181818181815,
+         0.12373737373737374, -0.3888888888888889, 1.1666666666666667, -0.875,
+         -0.875, 1.1666666666666667, -0.3888888888888889, 0.12373737373737374,
+         -0.031818181818181815, 0.005982905982905983, -0.0007215007215007215, 4.1625041625041625e-05},
+        {1.0406260406260406e-05, -0.00015956265956265956, 0.0011557886557886558, -0.005303030303030303,
+         0.017676767676767676, -0.04861111111111111, 0.14583333333333334, -1.28125,
+         1.28125, -0.14583333333333334, 0.04861111111111111, -0.017676767676767676,
+         0.005303030303030303, -0.0011557886557886558, 0.00015956265956265956, -1.0406260406260406e-05}};
+};
+constexpr double spline_polynomials<7, 1, 1>::coefficients[3][16];
+
+template <>
+struct spline_polynomials<7, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00024975024975024975, 0.0038295038295038295, -0.02773892773892774, 0.12727272727272726,
+         -0.42424242424242425, 1.1666666666666667, -3.5, 6.75,
+         -6.75, 3.5, -1.1666666666666667, 0.42424242424242425,
+         -0.12727272727272726, 0.02773892773892774, -0.0038295038295038295, 0.00024975024975024975},
+        {4.1625041625041625e-05, -0.0007215007215007215, 0.005982905982905983, -0.031818181818181815,
+         0.12373737373737374, -0.3888888888888889, 1.1666666666666667, -0.875,
+         -0.875, 1.1666666666666667, -0.3888888888888889, 0.12373737373737374,
+         -0.031818181818181815, 0.005982905982905983, -0.0007215007215007215, 4.1625041625041625e-05}};
+};
+constexpr double spline_polynomials<7, 1, 2>::coefficients[2][16];
+
+template <class real_number>
+void beta_n7_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(-1.0L/24024.0L*x + 1.0L/12012.0L) - 1.0L/24024.0L);
-        poly_val[1] = x*(x*((23.0L/36036.0L)*x - 95.0L/72072.0L) + 7.0L/10296.0L);
-        poly_val[2] = x*(x*(-119.0L/25740.0L*x + 511.0L/51480.0L) - 7.0L/1320.0L);
-        poly_val[3] = x*(x*((7.0L/330.0L)*x - 21.0L/440.0L) + 7.0L/264.0L);
-        poly_val[4] = x*(x*(-7.0L/99.0L*x + 133.0L/792.0L) - 7.0L/72.0L);
-        poly_val[5] = x*(x*((7.0L/36.0L)*x - 35.0L/72.0L) + 7.0L/24.0L);
-        poly_val[6] = x*(x*(-7.0L/12.0L*x + 35.0L/24.0L) - 7.0L/8.0L);
-        poly_val[7] = pow(x, 2)*((9.0L/8.0L)*x - 17.0L/8.0L) + 1;
-        poly_val[8] = x*(x*(-9.0L/8.0L*x + 5.0L/4.0L) + 7.0L/8.0L);
-        poly_val[9] = x*(x*((7.0L/12.0L)*x - 7.0L/24.0L) - 7.0L/24.0L);
-        poly_val[10] = x*(x*(-7.0L/36.0L*x + 7.0L/72.0L) + 7.0L/72.0L);
-        poly_val[11] = x*(x*((7.0L/99.0L)*x - 35.0L/792.0L) - 7.0L/264.0L);
-        poly_val[12] = x*(x*(-7.0L/330.0L*x + 7.0L/440.0L) + 7.0L/1320.0L);
-        poly_val[13] = x*(x*((119.0L/25740.0L)*x - 203.0L/51480.0L) - 7.0L/10296.0L);
-        poly_val[14] = x*(x*(-23.0L/36036.0L*x + 43.0L/72072.0L) + 1.0L/24024.0L);
-        poly_val[15] = pow(x, 2)*((1.0L/24024.0L)*x - 1.0L/24024.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(-1.0L/8008.0L*x + 1.0L/6006.0L) - 1.0L/24024.0L;
-        poly_val[1] = x*((23.0L/12012.0L)*x - 95.0L/36036.0L) + 7.0L/10296.0L;
-        poly_val[2] = x*(-119.0L/8580.0L*x + 511.0L/25740.0L) - 7.0L/1320.0L;
-        poly_val[3] = x*((7.0L/110.0L)*x - 21.0L/220.0L) + 7.0L/264.0L;
-        poly_val[4] = x*(-7.0L/33.0L*x + 133.0L/396.0L) - 7.0L/72.0L;
-        poly_val[5] = x*((7.0L/12.0L)*x - 35.0L/36.0L) + 7.0L/24.0L;
-        poly_val[6] = x*(-7.0L/4.0L*x + 35.0L/12.0L) - 7.0L/8.0L;
-        poly_val[7] = x*((27.0L/8.0L)*x - 17.0L/4.0L);
-        poly_val[8] = x*(-27.0L/8.0L*x + 5.0L/2.0L) + 7.0L/8.0L;
-        poly_val[9] = x*((7.0L/4.0L)*x - 7.0L/12.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(-7.0L/12.0L*x + 7.0L/36.0L) + 7.0L/72.0L;
-        poly_val[11] = x*((7.0L/33.0L)*x - 35.0L/396.0L) - 7.0L/264.0L;
-        poly_val[12] = x*(-7.0L/110.0L*x + 7.0L/220.0L) + 7.0L/1320.0L;
-        poly_val[13] = x*((119.0L/8580.0L)*x - 203.0L/25740.0L) - 7.0L/10296.0L;
-        poly_val[14] = x*(-23.0L/12012.0L*x + 43.0L/36036.0L) + 1.0L/24024.0L;
-        poly_val[15] = x*((1.0L/8008.0L)*x - 1.0L/12012.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = -1.0L/4004.0L*x + 1.0L/6006.0L;
-        poly_val[1] = (23.0L/6006.0L)*x - 95.0L/36036.0L;
-        poly_val[2] = -119.0L/4290.0L*x + 511.0L/25740.0L;
-        poly_val[3] = (7.0L/55.0L)*x - 21.0L/220.0L;
-        poly_val[4] = -14.0L/33.0L*x + 133.0L/396.0L;
-        poly_val[5] = (7.0L/6.0L)*x - 35.0L/36.0L;
-        poly_val[6] = -7.0L/2.0L*x + 35.0L/12.0L;
-        poly_val[7] = (27.0L/4.0L)*x - 17.0L/4.0L;
-        poly_val[8] = -27.0L/4.0L*x + 5.0L/2.0L;
-        poly_val[9] = (7.0L/2.0L)*x - 7.0L/12.0L;
-        poly_val[10] = -7.0L/6.0L*x + 7.0L/36.0L;
-        poly_val[11] = (14.0L/33.0L)*x - 35.0L/396.0L;
-        poly_val[12] = -7.0L/55.0L*x + 7.0L/220.0L;
-        poly_val[13] = (119.0L/4290.0L)*x - 203.0L/25740.0L;
-        poly_val[14] = -23.0L/6006.0L*x + 43.0L/36036.0L;
-        poly_val[15] = (1.0L/4004.0L)*x - 1.0L/12012.0L;
+        evaluate_beta_polynomials<spline_polynomials<7, 1, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n7_m2(int deriv, double x, double *poly_val) {
+
+template void beta_n7_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n7_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<7, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.00011892869035726179, -0.0017954928669214384, 0.012695545195545195, -0.055946969696969696,
+         0.17308501683501684, -0.4050925925925926, 0.7291666666666666, -0.988202947845805,
+         0.988202947845805, -0.7291666666666666, 0.4050925925925926, -0.17308501683501684,
+         0.055946969696969696, -0.012695545195545195, 0.0017954928669214384, -0.00011892869035726179},
+        {-1.7839303553589267e-05, 0.00030706727135298566, -0.0025178062678062677, 0.013125,
+         -0.0489793771043771, 0.13773148148148148, -0.21875, 0.11910147392290249,
+         0.11910147392290249, -0.21875, 0.13773148148148148, -0.0489793771043771,
+         0.013125, -0.0025178062678062677, 0.00030706727135298566, -1.7839303553589267e-05},
+        {-0.00010108938680367251, 0.0015359970717113574, -0.010970927220927221, 0.04918560606060606,
+         -0.15724957912457913, 0.39699074074074076, -0.9479166666666666, 1.6191014739229026,
+         -1.6191014739229026, 0.9479166666666666, -0.39699074074074076, 0.15724957912457913,
+         -0.04918560606060606, 0.010970927220927221, -0.0015359970717113574, 0.00010108938680367251},
+        {2.9732172589315448e-05, -0.0005142839964268536, 0.004250356125356125, -0.02247159090909091,
+         0.08635837542087542, -0.2633101851851852, 0.6927083333333334, -0.49705073696145124,
+         -0.49705073696145124, 0.6927083333333334, -0.2633101851851852, 0.08635837542087542,
+         -0.02247159090909091, 0.004250356125356125, -0.0005142839964268536, 2.9732172589315448e-05},
+        {1.7839303553589267e-05, -0.00027178096374524946, 0.0019492602305102304, -0.00879971590909091,
+         0.02849458122895623, -0.07392939814814815, 0.19140625, -1.343012684240363,
+         1.343012684240363, -0.19140625, 0.07392939814814815, -0.02849458122895623,
+         0.00879971590909091, -0.0019492602305102304, 0.00027178096374524946, -1.7839303553589267e-05},
+        {-6.318086675229532e-06, 0.0001093792946471518, -0.0009052261396011396, 0.004797585227272728,
+         -0.018528382786195285, 0.057219328703703706, -0.15950520833333334, 0.6168188421201815,
+         0.6168188421201815, -0.15950520833333334, 0.057219328703703706, -0.018528382786195285,
+         0.004797585227272728, -0.0009052261396011396, 0.0001093792946471518, -6.318086675229532e-06}};
+};
+constexpr double spline_polynomials<7, 2, 0>::coefficients[6][16];
+
+template <>
+struct spline_polynomials<7, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0005946434517863089, -0.008977464334607192, 0.06347772597772598, -0.2797348484848485,
+         0.8654250841750841, -2.025462962962963, 3.6458333333333335, -4.941014739229025,
+         4.941014739229025, -3.6458333333333335, 2.025462962962963, -0.8654250841750841,
+         0.2797348484848485, -0.06347772597772598, 0.008977464334607192, -0.0005946434517863089},
+        {-7.135721421435707e-05, 0.0012282690854119426, -0.01007122507122507, 0.0525,
+         -0.1959175084175084, 0.5509259259259259, -0.875, 0.47640589569160996,
+         0.47640589569160996, -0.875, 0.5509259259259259, -0.1959175084175084,
+         0.0525, -0.01007122507122507, 0.0012282690854119426, -7.135721421435707e-05},
+        {-0.00030326816041101757, 0.0046079912151340725, -0.032912781662781665, 0.14755681818181818,
+         -0.47174873737373735, 1.1909722222222223, -2.84375, 4.857304421768707,
+         -4.857304421768707, 2.84375, -1.1909722222222223, 0.47174873737373735,
+         -0.14755681818181818, 0.032912781662781665, -0.0046079912151340725, 0.00030326816041101757},
+        {5.9464345178630896e-05, -0.0010285679928537072, 0.00850071225071225, -0.04494318181818182,
+         0.17271675084175084, -0.5266203703703703, 1.3854166666666667, -0.9941014739229025,
+         -0.9941014739229025, 1.3854166666666667, -0.5266203703703703, 0.17271675084175084,
+         -0.04494318181818182, 0.00850071225071225, -0.0010285679928537072, 5.9464345178630896e-05},
+        {1.7839303553589267e-05, -0.00027178096374524946, 0.0019492602305102304, -0.00879971590909091,
+         0.02849458122895623, -0.07392939814814815, 0.19140625, -1.343012684240363,
+         1.343012684240363, -0.19140625, 0.07392939814814815, -0.02849458122895623,
+         0.00879971590909091, -0.0019492602305102304, 0.00027178096374524946, -1.7839303553589267e-05}};
+};
+constexpr double spline_polynomials<7, 2, 1>::coefficients[5][16];
+
+template <>
+struct spline_polynomials<7, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0023785738071452358, -0.03590985733842877, 0.25391090391090393, -1.118939393939394,
+         3.4617003367003365, -8.101851851851851, 14.583333333333334, -19.7640589569161,
+         19.7640589569161, -14.583333333333334, 8.101851851851851, -3.4617003367003365,
+         1.118939393939394, -0.25391090391090393, 0.03590985733842877, -0.0023785738071452358},
+        {-0.00021407164264307122, 0.0036848072562358277, -0.030213675213675215, 0.1575,
+         -0.5877525252525253, 1.6527777777777777, -2.625, 1.4292176870748299,
+         1.4292176870748299, -2.625, 1.6527777777777777, -0.5877525252525253,
+         0.1575, -0.030213675213675215, 0.0036848072562358277, -0.00021407164264307122},
+        {-0.0006065363208220351, 0.009215982430268145, -0.06582556332556333, 0.29511363636363636,
+         -0.9434974747474747, 2.3819444444444446, -5.6875, 9.714608843537414,
+         -9.714608843537414, 5.6875, -2.3819444444444446, 0.9434974747474747,
+         -0.29511363636363636, 0.06582556332556333, -0.009215982430268145, 0.0006065363208220351},
+        {5.9464345178630896e-05, -0.0010285679928537072, 0.00850071225071225, -0.04494318181818182,
+         0.17271675084175084, -0.5266203703703703, 1.3854166666666667, -0.9941014739229025,
+         -0.9941014739229025, 1.3854166666666667, -0.5266203703703703, 0.17271675084175084,
+         -0.04494318181818182, 0.00850071225071225, -0.0010285679928537072, 5.9464345178630896e-05}};
+};
+constexpr double spline_polynomials<7, 2, 2>::coefficients[4][16];
+
+template <class real_number>
+void beta_n7_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*((5.0L/42042.0L)*x - 53.0L/168168.0L) + 1.0L/4312.0L) + 1.0L/168168.0L) - 1.0L/24024.0L);
-        poly_val[1] = x*(x*(x*(x*(-5435.0L/3027024.0L*x + 1613.0L/336336.0L) - 3599.0L/1009008.0L) - 7.0L/61776.0L) + 7.0L/10296.0L);
-        poly_val[2] = x*(x*(x*(x*((19607.0L/1544400.0L)*x - 26453.0L/772200.0L) + 39851.0L/1544400.0L) + 7.0L/6600.0L) - 7.0L/1320.0L);
-        poly_val[3] = x*(x*(x*(x*(-1477.0L/26400.0L*x + 4039.0L/26400.0L) - 1029.0L/8800.0L) - 7.0L/1056.0L) + 7.0L/264.0L);
-        poly_val[4] = x*(x*(x*(x*((1645.0L/9504.0L)*x - 763.0L/1584.0L) + 1183.0L/3168.0L) + 7.0L/216.0L) - 7.0L/72.0L);
-        poly_val[5] = x*(x*(x*(x*(-175.0L/432.0L*x + 497.0L/432.0L) - 385.0L/432.0L) - 7.0L/48.0L) + 7.0L/24.0L);
-        poly_val[6] = x*(x*(x*(x*((35.0L/48.0L)*x - 49.0L/24.0L) + 21.0L/16.0L) + 7.0L/8.0L) - 7.0L/8.0L);
-        poly_val[7] = pow(x, 2)*(x*(x*(-174319.0L/176400.0L*x + 152269.0L/58800.0L) - 64069.0L/58800.0L) - 266681.0L/176400.0L) + 1;
-        poly_val[8] = x*(x*(x*(x*((174319.0L/176400.0L)*x - 103697.0L/44100.0L) + 108169.0L/176400.0L) + 7.0L/8.0L) + 7.0L/8.0L);
-        poly_val[9] = x*(x*(x*(x*(-35.0L/48.0L*x + 77.0L/48.0L) - 7.0L/16.0L) - 7.0L/48.0L) - 7.0L/24.0L);
-        poly_val[10] = x*(x*(x*(x*((175.0L/432.0L)*x - 7.0L/8.0L) + 49.0L/144.0L) + 7.0L/216.0L) + 7.0L/72.0L);
-        poly_val[11] = x*(x*(x*(x*(-1645.0L/9504.0L*x + 3647.0L/9504.0L) - 1687.0L/9504.0L) - 7.0L/1056.0L) - 7.0L/264.0L);
-        poly_val[12] = x*(x*(x*(x*((1477.0L/26400.0L)*x - 1673.0L/13200.0L) + 567.0L/8800.0L) + 7.0L/6600.0L) + 7.0L/1320.0L);
-        poly_val[13] = x*(x*(x*(x*(-19607.0L/1544400.0L*x + 15043.0L/514800.0L) - 623.0L/39600.0L) - 7.0L/61776.0L) - 7.0L/10296.0L);
-        poly_val[14] = x*(x*(x*(x*((5435.0L/3027024.0L)*x - 6329.0L/1513512.0L) + 7079.0L/3027024.0L) + 1.0L/168168.0L) + 1.0L/24024.0L);
-        poly_val[15] = pow(x, 3)*(x*(-5.0L/42042.0L*x + 47.0L/168168.0L) - 9.0L/56056.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*((25.0L/42042.0L)*x - 53.0L/42042.0L) + 3.0L/4312.0L) + 1.0L/84084.0L) - 1.0L/24024.0L;
-        poly_val[1] = x*(x*(x*(-27175.0L/3027024.0L*x + 1613.0L/84084.0L) - 3599.0L/336336.0L) - 7.0L/30888.0L) + 7.0L/10296.0L;
-        poly_val[2] = x*(x*(x*((19607.0L/308880.0L)*x - 26453.0L/193050.0L) + 39851.0L/514800.0L) + 7.0L/3300.0L) - 7.0L/1320.0L;
-        poly_val[3] = x*(x*(x*(-1477.0L/5280.0L*x + 4039.0L/6600.0L) - 3087.0L/8800.0L) - 7.0L/528.0L) + 7.0L/264.0L;
-        poly_val[4] = x*(x*(x*((8225.0L/9504.0L)*x - 763.0L/396.0L) + 1183.0L/1056.0L) + 7.0L/108.0L) - 7.0L/72.0L;
-        poly_val[5] = x*(x*(x*(-875.0L/432.0L*x + 497.0L/108.0L) - 385.0L/144.0L) - 7.0L/24.0L) + 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*((175.0L/48.0L)*x - 49.0L/6.0L) + 63.0L/16.0L) + 7.0L/4.0L) - 7.0L/8.0L;
-        poly_val[7] = x*(x*(x*(-174319.0L/35280.0L*x + 152269.0L/14700.0L) - 64069.0L/19600.0L) - 266681.0L/88200.0L);
-        poly_val[8] = x*(x*(x*((174319.0L/35280.0L)*x - 103697.0L/11025.0L) + 108169.0L/58800.0L) + 7.0L/4.0L) + 7.0L/8.0L;
-        poly_val[9] = x*(x*(x*(-175.0L/48.0L*x + 77.0L/12.0L) - 21.0L/16.0L) - 7.0L/24.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*((875.0L/432.0L)*x - 7.0L/2.0L) + 49.0L/48.0L) + 7.0L/108.0L) + 7.0L/72.0L;
-        poly_val[11] = x*(x*(x*(-8225.0L/9504.0L*x + 3647.0L/2376.0L) - 1687.0L/3168.0L) - 7.0L/528.0L) - 7.0L/264.0L;
-        poly_val[12] = x*(x*(x*((1477.0L/5280.0L)*x - 1673.0L/3300.0L) + 1701.0L/8800.0L) + 7.0L/3300.0L) + 7.0L/1320.0L;
-        poly_val[13] = x*(x*(x*(-19607.0L/308880.0L*x + 15043.0L/128700.0L) - 623.0L/13200.0L) - 7.0L/30888.0L) - 7.0L/10296.0L;
-        poly_val[14] = x*(x*(x*((27175.0L/3027024.0L)*x - 6329.0L/378378.0L) + 7079.0L/1009008.0L) + 1.0L/84084.0L) + 1.0L/24024.0L;
-        poly_val[15] = pow(x, 2)*(x*(-25.0L/42042.0L*x + 47.0L/42042.0L) - 27.0L/56056.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*((50.0L/21021.0L)*x - 53.0L/14014.0L) + 3.0L/2156.0L) + 1.0L/84084.0L;
-        poly_val[1] = x*(x*(-27175.0L/756756.0L*x + 1613.0L/28028.0L) - 3599.0L/168168.0L) - 7.0L/30888.0L;
-        poly_val[2] = x*(x*((19607.0L/77220.0L)*x - 26453.0L/64350.0L) + 39851.0L/257400.0L) + 7.0L/3300.0L;
-        poly_val[3] = x*(x*(-1477.0L/1320.0L*x + 4039.0L/2200.0L) - 3087.0L/4400.0L) - 7.0L/528.0L;
-        poly_val[4] = x*(x*((8225.0L/2376.0L)*x - 763.0L/132.0L) + 1183.0L/528.0L) + 7.0L/108.0L;
-        poly_val[5] = x*(x*(-875.0L/108.0L*x + 497.0L/36.0L) - 385.0L/72.0L) - 7.0L/24.0L;
-        poly_val[6] = x*(x*((175.0L/12.0L)*x - 49.0L/2.0L) + 63.0L/8.0L) + 7.0L/4.0L;
-        poly_val[7] = x*(x*(-174319.0L/8820.0L*x + 152269.0L/4900.0L) - 64069.0L/9800.0L) - 266681.0L/88200.0L;
-        poly_val[8] = x*(x*((174319.0L/8820.0L)*x - 103697.0L/3675.0L) + 108169.0L/29400.0L) + 7.0L/4.0L;
-        poly_val[9] = x*(x*(-175.0L/12.0L*x + 77.0L/4.0L) - 21.0L/8.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*((875.0L/108.0L)*x - 21.0L/2.0L) + 49.0L/24.0L) + 7.0L/108.0L;
-        poly_val[11] = x*(x*(-8225.0L/2376.0L*x + 3647.0L/792.0L) - 1687.0L/1584.0L) - 7.0L/528.0L;
-        poly_val[12] = x*(x*((1477.0L/1320.0L)*x - 1673.0L/1100.0L) + 1701.0L/4400.0L) + 7.0L/3300.0L;
-        poly_val[13] = x*(x*(-19607.0L/77220.0L*x + 15043.0L/42900.0L) - 623.0L/6600.0L) - 7.0L/30888.0L;
-        poly_val[14] = x*(x*((27175.0L/756756.0L)*x - 6329.0L/126126.0L) + 7079.0L/504504.0L) + 1.0L/84084.0L;
-        poly_val[15] = x*(x*(-50.0L/21021.0L*x + 47.0L/14014.0L) - 27.0L/28028.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 2, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n7_m3(int deriv, double x, double *poly_val) {
+
+template void beta_n7_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n7_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<7, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0003303855535998393, 0.004958600702648322, -0.03473983578150245, 0.1507402898027898,
+         -0.4531764570306237, 0.9996351410934744, -1.6702017195767196, 2.1506342120181405,
+         -2.1506342120181405, 1.6702017195767196, -0.9996351410934744, 0.4531764570306237,
+         -0.1507402898027898, 0.03473983578150245, -0.004958600702648322, 0.0003303855535998393},
+        {4.639044817616246e-06, -7.86206738587691e-05, 0.000628646045312712, -0.003133342352092352,
+         0.010655688832772165, -0.023361992945326277, 0.029576719576719576, -0.01429173752834467,
+         -0.01429173752834467, 0.029576719576719576, -0.023361992945326277, 0.010655688832772165,
+         -0.003133342352092352, 0.000628646045312712, -7.86206738587691e-05, 4.639044817616246e-06},
+        {0.00036671785555714127, -0.00551444339390768, 0.03875042203167203, -0.16900218704906206,
+         0.5129673596079846, -1.1548189484126985, 1.9818179563492064, -2.6011786068594103,
+         2.6011786068594103, -1.9818179563492064, 1.1548189484126985, -0.5129673596079846,
+         0.16900218704906206, -0.03875042203167203, 0.00551444339390768, -0.00036671785555714127},
+        {-2.1318587166801452e-05, 0.00036603277674706247, -0.0029892908017908016, 0.015475006764069264,
+         -0.05697114372895623, 0.15525297619047618, -0.2409325396825397, 0.129820277069161,
+         0.129820277069161, -0.2409325396825397, 0.15525297619047618, -0.05697114372895623,
+         0.015475006764069264, -0.0029892908017908016, 0.00036603277674706247, -2.1318587166801452e-05},
+        {-0.00016303667810364239, 0.0024657347034579176, -0.01748464642995893, 0.07744941039862915,
+         -0.24222016481782108, 0.5844223296957672, -1.2610794890873016, 2.0223453886763036,
+         -2.0223453886763036, 1.2610794890873016, -0.5844223296957672, 0.24222016481782108,
+         -0.07744941039862915, 0.01748464642995893, -0.0024657347034579176, 0.00016303667810364239},
+        {3.0601993492618496e-05, -0.0005290253727753728, 0.004368227258852259, -0.023059092600108227,
+         0.0883563170770202, -0.26769055886243387, 0.6982539682539682, -0.4997304377480159,
+         -0.4997304377480159, 0.6982539682539682, -0.26769055886243387, 0.0883563170770202,
+         -0.023059092600108227, 0.004368227258852259, -0.0005290253727753728, 3.0601993492618496e-05},
+        {2.3001577828586756e-05, -0.0003492590997241295, 0.0024920701645962063, -0.0111550329372595,
+         0.03557546337005973, -0.08954869722773369, 0.21750315186838623, -1.3766163438031462,
+         1.3766163438031462, -0.21750315186838623, 0.08954869722773369, -0.03557546337005973,
+         0.0111550329372595, -0.0024920701645962063, 0.0003492590997241295, -2.3001577828586756e-05},
+        {-6.390571750504786e-06, 0.00011060774267619506, -0.0009150487340591507, 0.00484654370152417,
+         -0.01869487792420735, 0.057584359843474424, -0.15996734457671957, 0.6170421505190617,
+         0.6170421505190617, -0.15996734457671957, 0.057584359843474424, -0.01869487792420735,
+         0.00484654370152417, -0.0009150487340591507, 0.00011060774267619506, -6.390571750504786e-06}};
+};
+constexpr double spline_polynomials<7, 3, 0>::coefficients[8][16];
+
+template <>
+struct spline_polynomials<7, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0023126988751988754, 0.034710204918538254, -0.24317885047051713, 1.0551820286195286,
+         -3.172235199214366, 6.997445987654321, -11.691412037037036, 15.054439484126984,
+         -15.054439484126984, 11.691412037037036, -6.997445987654321, 3.172235199214366,
+         -1.0551820286195286, 0.24317885047051713, -0.034710204918538254, 0.0023126988751988754},
+        {2.7834268905697478e-05, -0.0004717240431526146, 0.003771876271876272, -0.018800054112554112,
+         0.063934132996633, -0.14017195767195767, 0.17746031746031746, -0.08575042517006802,
+         -0.08575042517006802, 0.17746031746031746, -0.14017195767195767, 0.063934132996633,
+         -0.018800054112554112, 0.003771876271876272, -0.0004717240431526146, 2.7834268905697478e-05},
+        {0.0018335892777857064, -0.027572216969538398, 0.19375211015836016, -0.8450109352453102,
+         2.564836798039923, -5.774094742063492, 9.909089781746031, -13.005893034297053,
+         13.005893034297053, -9.909089781746031, 5.774094742063492, -2.564836798039923,
+         0.8450109352453102, -0.19375211015836016, 0.027572216969538398, -0.0018335892777857064},
+        {-8.527434866720581e-05, 0.0014641311069882499, -0.011957163207163207, 0.061900027056277056,
+         -0.22788457491582492, 0.6210119047619047, -0.9637301587301588, 0.519281108276644,
+         0.519281108276644, -0.9637301587301588, 0.6210119047619047, -0.22788457491582492,
+         0.061900027056277056, -0.011957163207163207, 0.0014641311069882499, -8.527434866720581e-05},
+        {-0.0004891100343109272, 0.007397204110373754, -0.05245393928987679, 0.23234823119588743,
+         -0.7266604944534633, 1.7532669890873016, -3.7832384672619046, 6.067036166028911,
+         -6.067036166028911, 3.7832384672619046, -1.7532669890873016, 0.7266604944534633,
+         -0.23234823119588743, 0.05245393928987679, -0.007397204110373754, 0.0004891100343109272},
+        {6.120398698523699e-05, -0.0010580507455507455, 0.008736454517704518, -0.046118185200216454,
+         0.1767126341540404, -0.5353811177248677, 1.3965079365079365, -0.9994608754960318,
+         -0.9994608754960318, 1.3965079365079365, -0.5353811177248677, 0.1767126341540404,
+         -0.046118185200216454, 0.008736454517704518, -0.0010580507455507455, 6.120398698523699e-05},
+        {2.3001577828586756e-05, -0.0003492590997241295, 0.0024920701645962063, -0.0111550329372595,
+         0.03557546337005973, -0.08954869722773369, 0.21750315186838623, -1.3766163438031462,
+         1.3766163438031462, -0.21750315186838623, 0.08954869722773369, -0.03557546337005973,
+         0.0111550329372595, -0.0024920701645962063, 0.0003492590997241295, -2.3001577828586756e-05}};
+};
+constexpr double spline_polynomials<7, 3, 1>::coefficients[7][16];
+
+template <>
+struct spline_polynomials<7, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.01387619325119325, 0.20826122951122952, -1.4590731028231028, 6.331092171717172,
+         -19.033411195286195, 41.98467592592593, -70.14847222222222, 90.3266369047619,
+         -90.3266369047619, 70.14847222222222, -41.98467592592593, 19.033411195286195,
+         -6.331092171717172, 1.4590731028231028, -0.20826122951122952, 0.01387619325119325},
+        {0.0001391713445284874, -0.002358620215763073, 0.01885938135938136, -0.09400027056277056,
+         0.319670664983165, -0.7008597883597883, 0.8873015873015873, -0.4287521258503401,
+         -0.4287521258503401, 0.8873015873015873, -0.7008597883597883, 0.319670664983165,
+         -0.09400027056277056, 0.01885938135938136, -0.002358620215763073, 0.0001391713445284874},
+        {0.0073343571111428255, -0.11028886787815359, 0.7750084406334407, -3.380043740981241,
+         10.259347192159693, -23.09637896825397, 39.636359126984125, -52.02357213718821,
+         52.02357213718821, -39.636359126984125, 23.09637896825397, -10.259347192159693,
+         3.380043740981241, -0.7750084406334407, 0.11028886787815359, -0.0073343571111428255},
+        {-0.0002558230460016174, 0.004392393320964749, -0.03587148962148962, 0.18570008116883116,
+         -0.6836537247474748, 1.8630357142857144, -2.8911904761904763, 1.557843324829932,
+         1.557843324829932, -2.8911904761904763, 1.8630357142857144, -0.6836537247474748,
+         0.18570008116883116, -0.03587148962148962, 0.004392393320964749, -0.0002558230460016174},
+        {-0.0009782200686218544, 0.014794408220747507, -0.10490787857975357, 0.46469646239177487,
+         -1.4533209889069265, 3.506533978174603, -7.566476934523809, 12.134072332057823,
+         -12.134072332057823, 7.566476934523809, -3.506533978174603, 1.4533209889069265,
+         -0.46469646239177487, 0.10490787857975357, -0.014794408220747507, 0.0009782200686218544},
+        {6.120398698523699e-05, -0.0010580507455507455, 0.008736454517704518, -0.046118185200216454,
+         0.1767126341540404, -0.5353811177248677, 1.3965079365079365, -0.9994608754960318,
+         -0.9994608754960318, 1.3965079365079365, -0.5353811177248677, 0.1767126341540404,
+         -0.046118185200216454, 0.008736454517704518, -0.0010580507455507455, 6.120398698523699e-05}};
+};
+constexpr double spline_polynomials<7, 3, 2>::coefficients[6][16];
+
+template <class real_number>
+void beta_n7_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-200017.0L/605404800.0L*x + 175717.0L/151351200.0L) - 139417.0L/100900800.0L) + 6109.0L/11642400.0L) + 59.0L/950400.0L) + 1.0L/168168.0L) - 1.0L/24024.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*((4502941.0L/908107200.0L)*x - 2878489.0L/165110400.0L) + 119663.0L/5765760.0L) - 1094837.0L/139708800.0L) - 20137.0L/19958400.0L) - 7.0L/61776.0L) + 7.0L/10296.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-901357.0L/25945920.0L*x + 10570201.0L/86486400.0L) - 4195157.0L/28828800.0L) + 14135041.0L/259459200.0L) + 2077.0L/266112.0L) + 7.0L/6600.0L) - 7.0L/1320.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*((200569.0L/1330560.0L)*x - 3530803.0L/6652800.0L) + 93403.0L/147840.0L) - 1551821.0L/6652800.0L) - 31957.0L/831600.0L) - 7.0L/1056.0L) + 7.0L/264.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-9044677.0L/19958400.0L*x + 56909.0L/35640.0L) - 6314093.0L/3326400.0L) + 213061.0L/311850.0L) + 247081.0L/1814400.0L) + 7.0L/216.0L) - 7.0L/72.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*((906869.0L/907200.0L)*x - 2130157.0L/604800.0L) + 503599.0L/120960.0L) - 2574109.0L/1814400.0L) - 222581.0L/604800.0L) - 7.0L/48.0L) + 7.0L/24.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-505069.0L/302400.0L*x + 394819.0L/67200.0L) - 277219.0L/40320.0L) + 1344209.0L/604800.0L) + 90281.0L/201600.0L) + 7.0L/8.0L) - 7.0L/8.0L);
-        poly_val[7] = pow(x, 2)*(pow(x, 2)*(x*(x*((121399.0L/56448.0L)*x - 1182509.0L/156800.0L) + 12323341.0L/1411200.0L) - 3993487.0L/1411200.0L) - 266681.0L/176400.0L) + 1;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(-121399.0L/56448.0L*x + 2650561.0L/352800.0L) - 174319.0L/20160.0L) + 350719.0L/117600.0L) - 90281.0L/201600.0L) + 7.0L/8.0L) + 7.0L/8.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*((505069.0L/302400.0L)*x - 703519.0L/120960.0L) + 1350319.0L/201600.0L) - 1501481.0L/604800.0L) + 222581.0L/604800.0L) - 7.0L/48.0L) - 7.0L/24.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(-906869.0L/907200.0L*x + 1261139.0L/362880.0L) - 811073.0L/201600.0L) + 2819581.0L/1814400.0L) - 247081.0L/1814400.0L) + 7.0L/216.0L) + 7.0L/72.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*((9044677.0L/19958400.0L)*x - 1497319.0L/950400.0L) + 813523.0L/443520.0L) - 14314981.0L/19958400.0L) + 31957.0L/831600.0L) - 7.0L/1056.0L) - 7.0L/264.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(-200569.0L/1330560.0L*x + 39649.0L/75600.0L) - 226559.0L/369600.0L) + 200173.0L/831600.0L) - 2077.0L/266112.0L) + 7.0L/6600.0L) + 7.0L/1320.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*((901357.0L/25945920.0L)*x - 31384387.0L/259459200.0L) + 2451851.0L/17297280.0L) - 1112533.0L/19958400.0L) + 20137.0L/19958400.0L) - 7.0L/61776.0L) - 7.0L/10296.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(-4502941.0L/908107200.0L*x + 2091853.0L/121080960.0L) - 12279031.0L/605404800.0L) + 1114733.0L/139708800.0L) - 59.0L/950400.0L) + 1.0L/168168.0L) + 1.0L/24024.0L);
-        poly_val[15] = pow(x, 4)*(x*(x*((200017.0L/605404800.0L)*x - 232417.0L/201801600.0L) + 39031.0L/28828800.0L) - 322417.0L/605404800.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(-200017.0L/86486400.0L*x + 175717.0L/25225200.0L) - 139417.0L/20180160.0L) + 6109.0L/2910600.0L) + 59.0L/316800.0L) + 1.0L/84084.0L) - 1.0L/24024.0L;
-        poly_val[1] = x*(x*(x*(x*(x*((4502941.0L/129729600.0L)*x - 2878489.0L/27518400.0L) + 119663.0L/1153152.0L) - 1094837.0L/34927200.0L) - 20137.0L/6652800.0L) - 7.0L/30888.0L) + 7.0L/10296.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(-901357.0L/3706560.0L*x + 10570201.0L/14414400.0L) - 4195157.0L/5765760.0L) + 14135041.0L/64864800.0L) + 2077.0L/88704.0L) + 7.0L/3300.0L) - 7.0L/1320.0L;
-        poly_val[3] = x*(x*(x*(x*(x*((200569.0L/190080.0L)*x - 3530803.0L/1108800.0L) + 93403.0L/29568.0L) - 1551821.0L/1663200.0L) - 31957.0L/277200.0L) - 7.0L/528.0L) + 7.0L/264.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(-9044677.0L/2851200.0L*x + 56909.0L/5940.0L) - 6314093.0L/665280.0L) + 426122.0L/155925.0L) + 247081.0L/604800.0L) + 7.0L/108.0L) - 7.0L/72.0L;
-        poly_val[5] = x*(x*(x*(x*(x*((906869.0L/129600.0L)*x - 2130157.0L/100800.0L) + 503599.0L/24192.0L) - 2574109.0L/453600.0L) - 222581.0L/201600.0L) - 7.0L/24.0L) + 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(-505069.0L/43200.0L*x + 394819.0L/11200.0L) - 277219.0L/8064.0L) + 1344209.0L/151200.0L) + 90281.0L/67200.0L) + 7.0L/4.0L) - 7.0L/8.0L;
-        poly_val[7] = x*(pow(x, 2)*(x*(x*((121399.0L/8064.0L)*x - 3547527.0L/78400.0L) + 12323341.0L/282240.0L) - 3993487.0L/352800.0L) - 266681.0L/88200.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(-121399.0L/8064.0L*x + 2650561.0L/58800.0L) - 174319.0L/4032.0L) + 350719.0L/29400.0L) - 90281.0L/67200.0L) + 7.0L/4.0L) + 7.0L/8.0L;
-        poly_val[9] = x*(x*(x*(x*(x*((505069.0L/43200.0L)*x - 703519.0L/20160.0L) + 1350319.0L/40320.0L) - 1501481.0L/151200.0L) + 222581.0L/201600.0L) - 7.0L/24.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(-906869.0L/129600.0L*x + 1261139.0L/60480.0L) - 811073.0L/40320.0L) + 2819581.0L/453600.0L) - 247081.0L/604800.0L) + 7.0L/108.0L) + 7.0L/72.0L;
-        poly_val[11] = x*(x*(x*(x*(x*((9044677.0L/2851200.0L)*x - 1497319.0L/158400.0L) + 813523.0L/88704.0L) - 14314981.0L/4989600.0L) + 31957.0L/277200.0L) - 7.0L/528.0L) - 7.0L/264.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(-200569.0L/190080.0L*x + 39649.0L/12600.0L) - 226559.0L/73920.0L) + 200173.0L/207900.0L) - 2077.0L/88704.0L) + 7.0L/3300.0L) + 7.0L/1320.0L;
-        poly_val[13] = x*(x*(x*(x*(x*((901357.0L/3706560.0L)*x - 31384387.0L/43243200.0L) + 2451851.0L/3459456.0L) - 1112533.0L/4989600.0L) + 20137.0L/6652800.0L) - 7.0L/30888.0L) - 7.0L/10296.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(-4502941.0L/129729600.0L*x + 2091853.0L/20180160.0L) - 12279031.0L/121080960.0L) + 1114733.0L/34927200.0L) - 59.0L/316800.0L) + 1.0L/84084.0L) + 1.0L/24024.0L;
-        poly_val[15] = pow(x, 3)*(x*(x*((200017.0L/86486400.0L)*x - 232417.0L/33633600.0L) + 39031.0L/5765760.0L) - 322417.0L/151351200.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(-200017.0L/14414400.0L*x + 175717.0L/5045040.0L) - 139417.0L/5045040.0L) + 6109.0L/970200.0L) + 59.0L/158400.0L) + 1.0L/84084.0L;
-        poly_val[1] = x*(x*(x*(x*((4502941.0L/21621600.0L)*x - 2878489.0L/5503680.0L) + 119663.0L/288288.0L) - 1094837.0L/11642400.0L) - 20137.0L/3326400.0L) - 7.0L/30888.0L;
-        poly_val[2] = x*(x*(x*(x*(-901357.0L/617760.0L*x + 10570201.0L/2882880.0L) - 4195157.0L/1441440.0L) + 14135041.0L/21621600.0L) + 2077.0L/44352.0L) + 7.0L/3300.0L;
-        poly_val[3] = x*(x*(x*(x*((200569.0L/31680.0L)*x - 3530803.0L/221760.0L) + 93403.0L/7392.0L) - 1551821.0L/554400.0L) - 31957.0L/138600.0L) - 7.0L/528.0L;
-        poly_val[4] = x*(x*(x*(x*(-9044677.0L/475200.0L*x + 56909.0L/1188.0L) - 6314093.0L/166320.0L) + 426122.0L/51975.0L) + 247081.0L/302400.0L) + 7.0L/108.0L;
-        poly_val[5] = x*(x*(x*(x*((906869.0L/21600.0L)*x - 2130157.0L/20160.0L) + 503599.0L/6048.0L) - 2574109.0L/151200.0L) - 222581.0L/100800.0L) - 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*(x*(-505069.0L/7200.0L*x + 394819.0L/2240.0L) - 277219.0L/2016.0L) + 1344209.0L/50400.0L) + 90281.0L/33600.0L) + 7.0L/4.0L;
-        poly_val[7] = pow(x, 2)*(x*(x*((121399.0L/1344.0L)*x - 3547527.0L/15680.0L) + 12323341.0L/70560.0L) - 3993487.0L/117600.0L) - 266681.0L/88200.0L;
-        poly_val[8] = x*(x*(x*(x*(-121399.0L/1344.0L*x + 2650561.0L/11760.0L) - 174319.0L/1008.0L) + 350719.0L/9800.0L) - 90281.0L/33600.0L) + 7.0L/4.0L;
-        poly_val[9] = x*(x*(x*(x*((505069.0L/7200.0L)*x - 703519.0L/4032.0L) + 1350319.0L/10080.0L) - 1501481.0L/50400.0L) + 222581.0L/100800.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*(x*(-906869.0L/21600.0L*x + 1261139.0L/12096.0L) - 811073.0L/10080.0L) + 2819581.0L/151200.0L) - 247081.0L/302400.0L) + 7.0L/108.0L;
-        poly_val[11] = x*(x*(x*(x*((9044677.0L/475200.0L)*x - 1497319.0L/31680.0L) + 813523.0L/22176.0L) - 14314981.0L/1663200.0L) + 31957.0L/138600.0L) - 7.0L/528.0L;
-        poly_val[12] = x*(x*(x*(x*(-200569.0L/31680.0L*x + 39649.0L/2520.0L) - 226559.0L/18480.0L) + 200173.0L/69300.0L) - 2077.0L/44352.0L) + 7.0L/3300.0L;
-        poly_val[13] = x*(x*(x*(x*((901357.0L/617760.0L)*x - 31384387.0L/8648640.0L) + 2451851.0L/864864.0L) - 1112533.0L/1663200.0L) + 20137.0L/3326400.0L) - 7.0L/30888.0L;
-        poly_val[14] = x*(x*(x*(x*(-4502941.0L/21621600.0L*x + 2091853.0L/4036032.0L) - 12279031.0L/30270240.0L) + 1114733.0L/11642400.0L) - 59.0L/158400.0L) + 1.0L/84084.0L;
-        poly_val[15] = pow(x, 2)*(x*(x*((200017.0L/14414400.0L)*x - 232417.0L/6726720.0L) + 39031.0L/1441440.0L) - 322417.0L/50450400.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 3, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n7_m4(int deriv, double x, double *poly_val) {
+
+template void beta_n7_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n7_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<7, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.001066152762581334, -0.015992565727188744, 0.11195060790546901, -0.48513468013468014,
+         1.4554568836513282, -3.2021174125514404, 5.337009755291005, -6.861973891408415,
+         6.861973891408415, -5.337009755291005, 3.2021174125514404, -1.4554568836513282,
+         0.48513468013468014, -0.11195060790546901, 0.015992565727188744, -0.001066152762581334},
+        {-5.12054083482655e-07, 8.43957813203845e-06, -6.45512537873649e-05, 0.0002980699855699856,
+         -0.0008804479985035541, 0.0016642324368018812, -0.0018853339947089947, 0.0008601033005794911,
+         0.0008601033005794911, -0.0018853339947089947, 0.0016642324368018812, -0.0008804479985035541,
+         0.0002980699855699856, -6.45512537873649e-05, 8.43957813203845e-06, -5.12054083482655e-07},
+        {-0.0013965383161811734, 0.020951166429837065, -0.14669044368697146, 0.63587496993747,
+         -1.9086333406819518, 4.201752553644915, -7.0072114748677246, 9.012608103426556,
+         -9.012608103426556, 7.0072114748677246, -4.201752553644915, 1.9086333406819518,
+         -0.63587496993747, 0.14669044368697146, -0.020951166429837065, 0.0013965383161811734},
+        {5.151098901098901e-06, -8.706025199080754e-05, 0.0006931972991000768, -0.0034314123376623378,
+         0.01153613683127572, -0.02502622538212816, 0.031462053571428575, -0.015151840828924162,
+         -0.015151840828924162, 0.031462053571428575, -0.02502622538212816, 0.01153613683127572,
+         -0.0034314123376623378, 0.0006931972991000768, -8.706025199080754e-05, 5.151098901098901e-06},
+        {0.0007665251415251415, -0.011511655541603459, 0.08073189999622292, -0.3509276920995671,
+         1.0587636909772327, -2.3556129781194883, 3.9831966145833335, -5.174418816137566,
+         5.174418816137566, -3.9831966145833335, 2.3556129781194883, -1.0587636909772327,
+         0.3509276920995671, -0.08073189999622292, 0.011511655541603459, -0.0007665251415251415},
+        {-2.151060744810745e-05, 0.0003691976185465769, -0.0030134975219610637, 0.015586783008658008,
+         -0.05730131172839506, 0.1558770633542769, -0.24163953993055556, 0.1301428158068783,
+         0.1301428158068783, -0.24163953993055556, 0.1558770633542769, -0.05730131172839506,
+         0.015586783008658008, -0.0030134975219610637, 0.0003691976185465769, -2.151060744810745e-05},
+        {-0.00022967122576497576, 0.0034652700614072143, -0.024481559424050742, 0.10777032790704666,
+         -0.33318622004602905, 0.7845546679802322, -1.5946425987929893, 2.4512187568893298,
+         -2.4512187568893298, 1.5946425987929893, -0.7845546679802322, 0.33318622004602905,
+         -0.10777032790704666, 0.024481559424050742, -0.0034652700614072143, 0.00022967122576497576},
+        {3.063399687283616e-05, -0.0005295528464086251, 0.004372261712213969, -0.02307772197420635,
+         0.08841134507692668, -0.267794573389734, 0.6983718016286375, -0.4997841942043021,
+         -0.4997841942043021, 0.6983718016286375, -0.267794573389734, 0.08841134507692668,
+         -0.02307772197420635, 0.004372261712213969, -0.0005295528464086251, 3.063399687283616e-05},
+        {2.7166237057420095e-05, -0.0004117300595959605, 0.0029293772267269444, -0.013050090281535594,
+         0.04126084182182273, -0.10205696837051274, 0.23835084622499172, -1.4034209293164603,
+         1.4034209293164603, -0.23835084622499172, 0.10205696837051274, -0.04126084182182273,
+         0.013050090281535594, -0.0029293772267269444, 0.0004117300595959605, -2.7166237057420095e-05},
+        {-6.39257196176839e-06, 0.00011064070977827333, -0.0009153008873942577, 0.004847708037405303,
+         -0.018698317174201506, 0.05759086075143068, -0.1599747091626364, 0.6170455102975797,
+         0.6170455102975797, -0.1599747091626364, 0.05759086075143068, -0.018698317174201506,
+         0.004847708037405303, -0.0009153008873942577, 0.00011064070977827333, -6.39257196176839e-06}};
+};
+constexpr double spline_polynomials<7, 4, 0>::coefficients[10][16];
+
+template <>
+struct spline_polynomials<7, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.009595374863232005, -0.1439330915446987, 1.0075554711492212, -4.366212121212121,
+         13.099111952861954, -28.81905671296296, 48.03308779761905, -61.757765022675734,
+         61.757765022675734, -48.03308779761905, 28.81905671296296, -13.099111952861954,
+         4.366212121212121, -1.0075554711492212, 0.1439330915446987, -0.009595374863232005},
+        {-4.09643266786124e-06, 6.75166250563076e-05, -0.0005164100302989192, 0.0023845598845598846,
+         -0.0070435839880284325, 0.01331385949441505, -0.015082671957671958, 0.0068808264046359285,
+         0.0068808264046359285, -0.015082671957671958, 0.01331385949441505, -0.0070435839880284325,
+         0.0023845598845598846, -0.0005164100302989192, 6.75166250563076e-05, -4.09643266786124e-06},
+        {-0.009775768213268213, 0.14665816500885945, -1.0268331058088003, 4.451124789562289,
+         -13.360433384773662, 29.412267875514402, -49.05048032407407, 63.08825672398589,
+         -63.08825672398589, 49.05048032407407, -29.412267875514402, 13.360433384773662,
+         -4.451124789562289, 1.0268331058088003, -0.14665816500885945, 0.009775768213268213},
+        {3.0906593406593407e-05, -0.0005223615119448453, 0.004159183794600461, -0.020588474025974027,
+         0.06921682098765432, -0.15015735229276897, 0.18877232142857142, -0.09091104497354498,
+         -0.09091104497354498, 0.18877232142857142, -0.15015735229276897, 0.06921682098765432,
+         -0.020588474025974027, 0.004159183794600461, -0.0005223615119448453, 3.0906593406593407e-05},
+        {0.0038326257076257077, -0.05755827770801729, 0.40365949998111456, -1.7546384604978356,
+         5.293818454886163, -11.778064890597443, 19.915983072916667, -25.87209408068783,
+         25.87209408068783, -19.915983072916667, 11.778064890597443, -5.293818454886163,
+         1.7546384604978356, -0.40365949998111456, 0.05755827770801729, -0.0038326257076257077},
+        {-8.60424297924298e-05, 0.0014767904741863076, -0.012053990087844255, 0.06234713203463203,
+         -0.22920524691358024, 0.6235082534171076, -0.9665581597222223, 0.5205712632275132,
+         0.5205712632275132, -0.9665581597222223, 0.6235082534171076, -0.22920524691358024,
+         0.06234713203463203, -0.012053990087844255, 0.0014767904741863076, -8.60424297924298e-05},
+        {-0.0006890136772949273, 0.010395810184221643, -0.07344467827215223, 0.32331098372114,
+         -0.9995586601380873, 2.353664003940697, -4.783927796378968, 7.353656270667989,
+         -7.353656270667989, 4.783927796378968, -2.353664003940697, 0.9995586601380873,
+         -0.32331098372114, 0.07344467827215223, -0.010395810184221643, 0.0006890136772949273},
+        {6.126799374567232e-05, -0.0010591056928172503, 0.008744523424427938, -0.0461554439484127,
+         0.17682269015385335, -0.535589146779468, 1.396743603257275, -0.9995683884086042,
+         -0.9995683884086042, 1.396743603257275, -0.535589146779468, 0.17682269015385335,
+         -0.0461554439484127, 0.008744523424427938, -0.0010591056928172503, 6.126799374567232e-05},
+        {2.7166237057420095e-05, -0.0004117300595959605, 0.0029293772267269444, -0.013050090281535594,
+         0.04126084182182273, -0.10205696837051274, 0.23835084622499172, -1.4034209293164603,
+         1.4034209293164603, -0.23835084622499172, 0.10205696837051274, -0.04126084182182273,
+         0.013050090281535594, -0.0029293772267269444, 0.0004117300595959605, -2.7166237057420095e-05}};
+};
+constexpr double spline_polynomials<7, 4, 1>::coefficients[9][16];
+
+template <>
+struct spline_polynomials<7, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 16;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.07676299890585604, -1.1514647323575895, 8.06044376919377, -34.92969696969697,
+         104.79289562289563, -230.5524537037037, 384.2647023809524, -494.0621201814059,
+         494.0621201814059, -384.2647023809524, 230.5524537037037, -104.79289562289563,
+         34.92969696969697, -8.06044376919377, 1.1514647323575895, -0.07676299890585604},
+        {-2.8675028675028676e-05, 0.0004726163753941532, -0.0036148702120924344, 0.016691919191919192,
+         -0.04930508791619903, 0.09319701646090535, -0.1055787037037037, 0.0481657848324515,
+         0.0481657848324515, -0.1055787037037037, 0.09319701646090535, -0.04930508791619903,
+         0.016691919191919192, -0.0036148702120924344, 0.0004726163753941532, -2.8675028675028676e-05},
+        {-0.05865460927960928, 0.8799489900531567, -6.160998634852802, 26.706748737373736,
+         -80.16260030864197, 176.4736072530864, -294.30288194444444, 378.52954034391536,
+         -378.52954034391536, 294.30288194444444, -176.4736072530864, 80.16260030864197,
+         -26.706748737373736, 6.160998634852802, -0.8799489900531567, 0.05865460927960928},
+        {0.00015453296703296703, -0.0026118075597242264, 0.020795918973002307, -0.10294237012987013,
+         0.34608410493827163, -0.7507867614638448, 0.9438616071428572, -0.45455522486772487,
+         -0.45455522486772487, 0.9438616071428572, -0.7507867614638448, 0.34608410493827163,
+         -0.10294237012987013, 0.020795918973002307, -0.0026118075597242264, 0.00015453296703296703},
+        {0.01533050283050283, -0.23023311083206915, 1.6146379999244582, -7.018553841991342,
+         21.175273819544653, -47.112259562389774, 79.66393229166667, -103.48837632275132,
+         103.48837632275132, -79.66393229166667, 47.112259562389774, -21.175273819544653,
+         7.018553841991342, -1.6146379999244582, 0.23023311083206915, -0.01533050283050283},
+        {-0.00025812728937728936, 0.0044303714225589225, -0.03616197026353277, 0.1870413961038961,
+         -0.6876157407407407, 1.8705247602513229, -2.899674479166667, 1.5617137896825397,
+         1.5617137896825397, -2.899674479166667, 1.8705247602513229, -0.6876157407407407,
+         0.1870413961038961, -0.03616197026353277, 0.0044303714225589225, -0.00025812728937728936},
+        {-0.0013780273545898546, 0.020791620368443287, -0.14688935654430446, 0.64662196744228,
+         -1.9991173202761745, 4.707328007881394, -9.567855592757937, 14.707312541335979,
+         -14.707312541335979, 9.567855592757937, -4.707328007881394, 1.9991173202761745,
+         -0.64662196744228, 0.14688935654430446, -0.020791620368443287, 0.0013780273545898546},
+        {6.126799374567232e-05, -0.0010591056928172503, 0.008744523424427938, -0.0461554439484127,
+         0.17682269015385335, -0.535589146779468, 1.396743603257275, -0.9995683884086042,
+         -0.9995683884086042, 1.396743603257275, -0.535589146779468, 0.17682269015385335,
+         -0.0461554439484127, 0.008744523424427938, -0.0010591056928172503, 6.126799374567232e-05}};
+};
+constexpr double spline_polynomials<7, 4, 2>::coefficients[8][16];
+
+template <class real_number>
+void beta_n7_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((322727.0L/302702400.0L)*x - 414979.0L/86486400.0L) + 141853.0L/17297280.0L) - 6059.0L/960960.0L) + 11.0L/6048.0L) - 59.0L/6652800.0L) + 59.0L/950400.0L) + 1.0L/168168.0L) - 1.0L/24024.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-13405813.0L/838252800.0L*x + 60333233.0L/838252800.0L) - 670268567.0L/5448643200.0L) + 3680359.0L/38918880.0L) - 42433073.0L/1556755200.0L) + 20137.0L/119750400.0L) - 20137.0L/19958400.0L) - 7.0L/61776.0L) + 7.0L/10296.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((174279691.0L/1556755200.0L)*x - 1120513.0L/2223936.0L) + 44685269.0L/51891840.0L) - 515148581.0L/778377600.0L) + 296702557.0L/1556755200.0L) - 2077.0L/1330560.0L) + 2077.0L/266112.0L) + 7.0L/6600.0L) - 7.0L/1320.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(-28817.0L/59400.0L*x + 4841917.0L/2217600.0L) - 2256829.0L/604800.0L) + 19073623.0L/6652800.0L) - 609701.0L/739200.0L) + 31957.0L/3326400.0L) - 31957.0L/831600.0L) - 7.0L/1056.0L) + 7.0L/264.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*((3112349.0L/2138400.0L)*x - 56029813.0L/8553600.0L) + 60931183.0L/5443200.0L) - 36766399.0L/4276800.0L) + 14799451.0L/5987520.0L) - 247081.0L/5443200.0L) + 247081.0L/1814400.0L) + 7.0L/216.0L) - 7.0L/72.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(-4979933.0L/1555200.0L*x + 156886007.0L/10886400.0L) - 8935543.0L/362880.0L) + 51445649.0L/2721600.0L) - 59327153.0L/10886400.0L) + 222581.0L/1209600.0L) - 222581.0L/604800.0L) - 7.0L/48.0L) + 7.0L/24.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*((6455647.0L/1209600.0L)*x - 7263173.0L/302400.0L) + 8272337.0L/201600.0L) - 3809647.0L/120960.0L) + 11059493.0L/1209600.0L) - 90281.0L/201600.0L) + 90281.0L/201600.0L) + 7.0L/8.0L) - 7.0L/8.0L);
-        poly_val[7] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-43576279.0L/6350400.0L*x + 11205641.0L/362880.0L) - 19141411.0L/362880.0L) + 73478603.0L/1814400.0L) - 21513043.0L/1814400.0L) + 54613.0L/90720.0L) - 266681.0L/176400.0L) + 1;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*((43576279.0L/6350400.0L)*x - 392175587.0L/12700800.0L) + 223287331.0L/4233600.0L) - 36755869.0L/907200.0L) + 1353509.0L/113400.0L) - 90281.0L/201600.0L) - 90281.0L/201600.0L) + 7.0L/8.0L) + 7.0L/8.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*(-6455647.0L/1209600.0L*x + 4149733.0L/172800.0L) - 24807889.0L/604800.0L) + 794597.0L/25200.0L) - 2251181.0L/241920.0L) + 222581.0L/1209600.0L) + 222581.0L/604800.0L) - 7.0L/48.0L) - 7.0L/24.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*((4979933.0L/1555200.0L)*x - 39212443.0L/2721600.0L) + 5358427.0L/217728.0L) - 103036921.0L/5443200.0L) + 60708181.0L/10886400.0L) - 247081.0L/5443200.0L) - 247081.0L/1814400.0L) + 7.0L/216.0L) + 7.0L/72.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(-3112349.0L/2138400.0L*x + 56014751.0L/8553600.0L) - 223273759.0L/19958400.0L) + 14724943.0L/1710720.0L) - 13763713.0L/5443200.0L) + 31957.0L/3326400.0L) + 31957.0L/831600.0L) - 7.0L/1056.0L) - 7.0L/264.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*((28817.0L/59400.0L)*x - 968119.0L/443520.0L) + 4961851.0L/1330560.0L) - 9545759.0L/3326400.0L) + 932753.0L/1108800.0L) - 2077.0L/1330560.0L) - 2077.0L/266112.0L) + 7.0L/6600.0L) + 7.0L/1320.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(-174279691.0L/1556755200.0L*x + 784158119.0L/1556755200.0L) - 669877073.0L/778377600.0L) + 257762143.0L/389188800.0L) - 23213117.0L/119750400.0L) + 20137.0L/119750400.0L) + 20137.0L/19958400.0L) - 7.0L/61776.0L) - 7.0L/10296.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*((13405813.0L/838252800.0L)*x - 2154253.0L/29937600.0L) + 2900003.0L/23587200.0L) - 73650743.0L/778377600.0L) + 1722493.0L/62270208.0L) - 59.0L/6652800.0L) - 59.0L/950400.0L) + 1.0L/168168.0L) + 1.0L/24024.0L);
-        poly_val[15] = pow(x, 5)*(x*(x*(x*(-322727.0L/302702400.0L*x + 2904233.0L/605404800.0L) - 2005.0L/244608.0L) + 545581.0L/86486400.0L) - 159353.0L/86486400.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*((322727.0L/33633600.0L)*x - 414979.0L/10810800.0L) + 141853.0L/2471040.0L) - 6059.0L/160160.0L) + 55.0L/6048.0L) - 59.0L/1663200.0L) + 59.0L/316800.0L) + 1.0L/84084.0L) - 1.0L/24024.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(-13405813.0L/93139200.0L*x + 60333233.0L/104781600.0L) - 670268567.0L/778377600.0L) + 3680359.0L/6486480.0L) - 42433073.0L/311351040.0L) + 20137.0L/29937600.0L) - 20137.0L/6652800.0L) - 7.0L/30888.0L) + 7.0L/10296.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*((174279691.0L/172972800.0L)*x - 1120513.0L/277992.0L) + 44685269.0L/7413120.0L) - 515148581.0L/129729600.0L) + 296702557.0L/311351040.0L) - 2077.0L/332640.0L) + 2077.0L/88704.0L) + 7.0L/3300.0L) - 7.0L/1320.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(-28817.0L/6600.0L*x + 4841917.0L/277200.0L) - 2256829.0L/86400.0L) + 19073623.0L/1108800.0L) - 609701.0L/147840.0L) + 31957.0L/831600.0L) - 31957.0L/277200.0L) - 7.0L/528.0L) + 7.0L/264.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*((3112349.0L/237600.0L)*x - 56029813.0L/1069200.0L) + 60931183.0L/777600.0L) - 36766399.0L/712800.0L) + 14799451.0L/1197504.0L) - 247081.0L/1360800.0L) + 247081.0L/604800.0L) + 7.0L/108.0L) - 7.0L/72.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(-4979933.0L/172800.0L*x + 156886007.0L/1360800.0L) - 8935543.0L/51840.0L) + 51445649.0L/453600.0L) - 59327153.0L/2177280.0L) + 222581.0L/302400.0L) - 222581.0L/201600.0L) - 7.0L/24.0L) + 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*((6455647.0L/134400.0L)*x - 7263173.0L/37800.0L) + 8272337.0L/28800.0L) - 3809647.0L/20160.0L) + 11059493.0L/241920.0L) - 90281.0L/50400.0L) + 90281.0L/67200.0L) + 7.0L/4.0L) - 7.0L/8.0L;
-        poly_val[7] = x*(pow(x, 2)*(x*(x*(x*(x*(-43576279.0L/705600.0L*x + 11205641.0L/45360.0L) - 19141411.0L/51840.0L) + 73478603.0L/302400.0L) - 21513043.0L/362880.0L) + 54613.0L/22680.0L) - 266681.0L/88200.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*((43576279.0L/705600.0L)*x - 392175587.0L/1587600.0L) + 223287331.0L/604800.0L) - 36755869.0L/151200.0L) + 1353509.0L/22680.0L) - 90281.0L/50400.0L) - 90281.0L/67200.0L) + 7.0L/4.0L) + 7.0L/8.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(-6455647.0L/134400.0L*x + 4149733.0L/21600.0L) - 24807889.0L/86400.0L) + 794597.0L/4200.0L) - 2251181.0L/48384.0L) + 222581.0L/302400.0L) + 222581.0L/201600.0L) - 7.0L/24.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*((4979933.0L/172800.0L)*x - 39212443.0L/340200.0L) + 5358427.0L/31104.0L) - 103036921.0L/907200.0L) + 60708181.0L/2177280.0L) - 247081.0L/1360800.0L) - 247081.0L/604800.0L) + 7.0L/108.0L) + 7.0L/72.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(-3112349.0L/237600.0L*x + 56014751.0L/1069200.0L) - 223273759.0L/2851200.0L) + 14724943.0L/285120.0L) - 13763713.0L/1088640.0L) + 31957.0L/831600.0L) + 31957.0L/277200.0L) - 7.0L/528.0L) - 7.0L/264.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*((28817.0L/6600.0L)*x - 968119.0L/55440.0L) + 4961851.0L/190080.0L) - 9545759.0L/554400.0L) + 932753.0L/221760.0L) - 2077.0L/332640.0L) - 2077.0L/88704.0L) + 7.0L/3300.0L) + 7.0L/1320.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(-174279691.0L/172972800.0L*x + 784158119.0L/194594400.0L) - 669877073.0L/111196800.0L) + 257762143.0L/64864800.0L) - 23213117.0L/23950080.0L) + 20137.0L/29937600.0L) + 20137.0L/6652800.0L) - 7.0L/30888.0L) - 7.0L/10296.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*((13405813.0L/93139200.0L)*x - 2154253.0L/3742200.0L) + 2900003.0L/3369600.0L) - 73650743.0L/129729600.0L) + 8612465.0L/62270208.0L) - 59.0L/1663200.0L) - 59.0L/316800.0L) + 1.0L/84084.0L) + 1.0L/24024.0L;
-        poly_val[15] = pow(x, 4)*(x*(x*(x*(-322727.0L/33633600.0L*x + 2904233.0L/75675600.0L) - 2005.0L/34944.0L) + 545581.0L/14414400.0L) - 159353.0L/17297280.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*((322727.0L/4204200.0L)*x - 414979.0L/1544400.0L) + 141853.0L/411840.0L) - 6059.0L/32032.0L) + 55.0L/1512.0L) - 59.0L/554400.0L) + 59.0L/158400.0L) + 1.0L/84084.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-13405813.0L/11642400.0L*x + 60333233.0L/14968800.0L) - 670268567.0L/129729600.0L) + 3680359.0L/1297296.0L) - 42433073.0L/77837760.0L) + 20137.0L/9979200.0L) - 20137.0L/3326400.0L) - 7.0L/30888.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*((174279691.0L/21621600.0L)*x - 7843591.0L/277992.0L) + 44685269.0L/1235520.0L) - 515148581.0L/25945920.0L) + 296702557.0L/77837760.0L) - 2077.0L/110880.0L) + 2077.0L/44352.0L) + 7.0L/3300.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(-28817.0L/825.0L*x + 4841917.0L/39600.0L) - 2256829.0L/14400.0L) + 19073623.0L/221760.0L) - 609701.0L/36960.0L) + 31957.0L/277200.0L) - 31957.0L/138600.0L) - 7.0L/528.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*((3112349.0L/29700.0L)*x - 392208691.0L/1069200.0L) + 60931183.0L/129600.0L) - 36766399.0L/142560.0L) + 14799451.0L/299376.0L) - 247081.0L/453600.0L) + 247081.0L/302400.0L) + 7.0L/108.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(-4979933.0L/21600.0L*x + 156886007.0L/194400.0L) - 8935543.0L/8640.0L) + 51445649.0L/90720.0L) - 59327153.0L/544320.0L) + 222581.0L/100800.0L) - 222581.0L/100800.0L) - 7.0L/24.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*((6455647.0L/16800.0L)*x - 7263173.0L/5400.0L) + 8272337.0L/4800.0L) - 3809647.0L/4032.0L) + 11059493.0L/60480.0L) - 90281.0L/16800.0L) + 90281.0L/33600.0L) + 7.0L/4.0L;
-        poly_val[7] = pow(x, 2)*(x*(x*(x*(x*(-43576279.0L/88200.0L*x + 11205641.0L/6480.0L) - 19141411.0L/8640.0L) + 73478603.0L/60480.0L) - 21513043.0L/90720.0L) + 54613.0L/7560.0L) - 266681.0L/88200.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*((43576279.0L/88200.0L)*x - 392175587.0L/226800.0L) + 223287331.0L/100800.0L) - 36755869.0L/30240.0L) + 1353509.0L/5670.0L) - 90281.0L/16800.0L) - 90281.0L/33600.0L) + 7.0L/4.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(-6455647.0L/16800.0L*x + 29048131.0L/21600.0L) - 24807889.0L/14400.0L) + 794597.0L/840.0L) - 2251181.0L/12096.0L) + 222581.0L/100800.0L) + 222581.0L/100800.0L) - 7.0L/24.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*((4979933.0L/21600.0L)*x - 39212443.0L/48600.0L) + 5358427.0L/5184.0L) - 103036921.0L/181440.0L) + 60708181.0L/544320.0L) - 247081.0L/453600.0L) - 247081.0L/302400.0L) + 7.0L/108.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(-3112349.0L/29700.0L*x + 392103257.0L/1069200.0L) - 223273759.0L/475200.0L) + 14724943.0L/57024.0L) - 13763713.0L/272160.0L) + 31957.0L/277200.0L) + 31957.0L/138600.0L) - 7.0L/528.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*((28817.0L/825.0L)*x - 968119.0L/7920.0L) + 4961851.0L/31680.0L) - 9545759.0L/110880.0L) + 932753.0L/55440.0L) - 2077.0L/110880.0L) - 2077.0L/44352.0L) + 7.0L/3300.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(-174279691.0L/21621600.0L*x + 784158119.0L/27799200.0L) - 669877073.0L/18532800.0L) + 257762143.0L/12972960.0L) - 23213117.0L/5987520.0L) + 20137.0L/9979200.0L) + 20137.0L/3326400.0L) - 7.0L/30888.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*((13405813.0L/11642400.0L)*x - 2154253.0L/534600.0L) + 2900003.0L/561600.0L) - 73650743.0L/25945920.0L) + 8612465.0L/15567552.0L) - 59.0L/554400.0L) - 59.0L/158400.0L) + 1.0L/84084.0L;
-        poly_val[15] = pow(x, 3)*(x*(x*(x*(-322727.0L/4204200.0L*x + 2904233.0L/10810800.0L) - 2005.0L/5824.0L) + 545581.0L/2882880.0L) - 159353.0L/4324320.0L);
+        evaluate_beta_polynomials<spline_polynomials<7, 4, 2>>(x, poly_val);
         break;
     }
 }
+
+template void beta_n7_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n7_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
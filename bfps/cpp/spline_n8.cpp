@@ -25,330 +25,620 @@
 
 
 #include "spline_n8.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n8_m0(int deriv, double x, double *poly_val) {
+template <>
+struct spline_polynomials<8, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         -1.0, 1.0, 0, 0,
+         0, 0, 0, 0,
+         0, 0},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0.5, 0.5, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<8, 0, 0>::coefficients[2][18];
+
+template <>
+struct spline_polynomials<8, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         -1.0, 1.0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<8, 0, 1>::coefficients[1][18];
+
+template <>
+struct spline_polynomials<8, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0}};
+};
+constexpr double spline_polynomials<8, 0, 2>::coefficients[1][18];
+
+template <class real_number>
+void beta_n8_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = -x + 1;
-        poly_val[9] = x;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
+        evaluate_beta_polynomials<spline_polynomials<8, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = -1;
-        poly_val[9] = 1;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
+        evaluate_beta_polynomials<spline_polynomials<8, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
+        evaluate_beta_polynomials<spline_polynomials<8, 0, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n8_m1(int deriv, double x, double *poly_val) {
+
+template void beta_n8_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n8_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<8, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {9.712509712509713e-06, -0.0001678876678876679, 0.0013764013764013764, -0.007148407148407148,
+         0.02665112665112665, -0.07777777777777778, 0.19797979797979798, -0.5777777777777777,
+         1.1111111111111112, -1.1111111111111112, 0.5777777777777777, -0.19797979797979798,
+         0.07777777777777778, -0.02665112665112665, 0.007148407148407148, -0.0013764013764013764,
+         0.0001678876678876679, -9.712509712509713e-06},
+        {-4.856254856254856e-06, 9.365634365634366e-05, -0.0008658008658008658, 0.005128205128205128,
+         -0.022027972027972027, 0.07424242424242425, -0.21212121212121213, 0.6,
+         -0.4444444444444444, -0.4444444444444444, 0.6, -0.21212121212121213,
+         0.07424242424242425, -0.022027972027972027, 0.005128205128205128, -0.0008658008658008658,
+         9.365634365634366e-05, -4.856254856254856e-06},
+        {-2.428127428127428e-06, 4.197191697191697e-05, -0.0003441003441003441, 0.001787101787101787,
+         -0.0066627816627816625, 0.019444444444444445, -0.049494949494949494, 0.14444444444444443,
+         -1.2777777777777777, 1.2777777777777777, -0.14444444444444443, 0.049494949494949494,
+         -0.019444444444444445, 0.0066627816627816625, -0.001787101787101787, 0.0003441003441003441,
+         -4.197191697191697e-05, 2.428127428127428e-06},
+        {1.214063714063714e-06, -2.3414085914085914e-05, 0.00021645021645021645, -0.001282051282051282,
+         0.005506993006993007, -0.018560606060606062, 0.05303030303030303, -0.15,
+         0.6111111111111112, 0.6111111111111112, -0.15, 0.05303030303030303,
+         -0.018560606060606062, 0.005506993006993007, -0.001282051282051282, 0.00021645021645021645,
+         -2.3414085914085914e-05, 1.214063714063714e-06}};
+};
+constexpr double spline_polynomials<8, 1, 0>::coefficients[4][18];
+
+template <>
+struct spline_polynomials<8, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {2.9137529137529138e-05, -0.0005036630036630037, 0.004129204129204129, -0.021445221445221447,
+         0.07995337995337995, -0.23333333333333334, 0.593939393939394, -1.7333333333333334,
+         3.3333333333333335, -3.3333333333333335, 1.7333333333333334, -0.593939393939394,
+         0.23333333333333334, -0.07995337995337995, 0.021445221445221447, -0.004129204129204129,
+         0.0005036630036630037, -2.9137529137529138e-05},
+        {-9.712509712509713e-06, 0.0001873126873126873, -0.0017316017316017316, 0.010256410256410256,
+         -0.044055944055944055, 0.1484848484848485, -0.42424242424242425, 1.2,
+         -0.8888888888888888, -0.8888888888888888, 1.2, -0.42424242424242425,
+         0.1484848484848485, -0.044055944055944055, 0.010256410256410256, -0.0017316017316017316,
+         0.0001873126873126873, -9.712509712509713e-06},
+        {-2.428127428127428e-06, 4.197191697191697e-05, -0.0003441003441003441, 0.001787101787101787,
+         -0.0066627816627816625, 0.019444444444444445, -0.049494949494949494, 0.14444444444444443,
+         -1.2777777777777777, 1.2777777777777777, -0.14444444444444443, 0.049494949494949494,
+         -0.019444444444444445, 0.0066627816627816625, -0.001787101787101787, 0.0003441003441003441,
+         -4.197191697191697e-05, 2.428127428127428e-06}};
+};
+constexpr double spline_polynomials<8, 1, 1>::coefficients[3][18];
+
+template <>
+struct spline_polynomials<8, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {5.8275058275058275e-05, -0.0010073260073260074, 0.008258408258408258, -0.042890442890442894,
+         0.1599067599067599, -0.4666666666666667, 1.187878787878788, -3.466666666666667,
+         6.666666666666667, -6.666666666666667, 3.466666666666667, -1.187878787878788,
+         0.4666666666666667, -0.1599067599067599, 0.042890442890442894, -0.008258408258408258,
+         0.0010073260073260074, -5.8275058275058275e-05},
+        {-9.712509712509713e-06, 0.0001873126873126873, -0.0017316017316017316, 0.010256410256410256,
+         -0.044055944055944055, 0.1484848484848485, -0.42424242424242425, 1.2,
+         -0.8888888888888888, -0.8888888888888888, 1.2, -0.42424242424242425,
+         0.1484848484848485, -0.044055944055944055, 0.010256410256410256, -0.0017316017316017316,
+         0.0001873126873126873, -9.712509712509713e-06}};
+};
+constexpr double spline_polynomials<8, 1, 2>::coefficients[2][18];
+
+template <class real_number>
+void beta_n8_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*((1.0L/102960.0L)*x - 1.0L/51480.0L) + 1.0L/102960.0L);
-        poly_val[1] = x*(x*(-11.0L/65520.0L*x + 83.0L/240240.0L) - 8.0L/45045.0L);
-        poly_val[2] = x*(x*((62.0L/45045.0L)*x - 4.0L/1365.0L) + 2.0L/1287.0L);
-        poly_val[3] = x*(x*(-46.0L/6435.0L*x + 34.0L/2145.0L) - 56.0L/6435.0L);
-        poly_val[4] = x*(x*((343.0L/12870.0L)*x - 133.0L/2145.0L) + 7.0L/198.0L);
-        poly_val[5] = x*(x*(-7.0L/90.0L*x + 21.0L/110.0L) - 56.0L/495.0L);
-        poly_val[6] = x*(x*((98.0L/495.0L)*x - 28.0L/55.0L) + 14.0L/45.0L);
-        poly_val[7] = x*(x*(-26.0L/45.0L*x + 22.0L/15.0L) - 8.0L/9.0L);
-        poly_val[8] = pow(x, 2)*((10.0L/9.0L)*x - 19.0L/9.0L) + 1;
-        poly_val[9] = x*(x*(-10.0L/9.0L*x + 11.0L/9.0L) + 8.0L/9.0L);
-        poly_val[10] = x*(x*((26.0L/45.0L)*x - 4.0L/15.0L) - 14.0L/45.0L);
-        poly_val[11] = x*(x*(-98.0L/495.0L*x + 14.0L/165.0L) + 56.0L/495.0L);
-        poly_val[12] = x*(x*((7.0L/90.0L)*x - 7.0L/165.0L) - 7.0L/198.0L);
-        poly_val[13] = x*(x*(-343.0L/12870.0L*x + 7.0L/390.0L) + 56.0L/6435.0L);
-        poly_val[14] = x*(x*((46.0L/6435.0L)*x - 4.0L/715.0L) - 2.0L/1287.0L);
-        poly_val[15] = x*(x*(-62.0L/45045.0L*x + 6.0L/5005.0L) + 8.0L/45045.0L);
-        poly_val[16] = x*(x*((11.0L/65520.0L)*x - 19.0L/120120.0L) - 1.0L/102960.0L);
-        poly_val[17] = pow(x, 2)*(-1.0L/102960.0L*x + 1.0L/102960.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*((1.0L/34320.0L)*x - 1.0L/25740.0L) + 1.0L/102960.0L;
-        poly_val[1] = x*(-11.0L/21840.0L*x + 83.0L/120120.0L) - 8.0L/45045.0L;
-        poly_val[2] = x*((62.0L/15015.0L)*x - 8.0L/1365.0L) + 2.0L/1287.0L;
-        poly_val[3] = x*(-46.0L/2145.0L*x + 68.0L/2145.0L) - 56.0L/6435.0L;
-        poly_val[4] = x*((343.0L/4290.0L)*x - 266.0L/2145.0L) + 7.0L/198.0L;
-        poly_val[5] = x*(-7.0L/30.0L*x + 21.0L/55.0L) - 56.0L/495.0L;
-        poly_val[6] = x*((98.0L/165.0L)*x - 56.0L/55.0L) + 14.0L/45.0L;
-        poly_val[7] = x*(-26.0L/15.0L*x + 44.0L/15.0L) - 8.0L/9.0L;
-        poly_val[8] = x*((10.0L/3.0L)*x - 38.0L/9.0L);
-        poly_val[9] = x*(-10.0L/3.0L*x + 22.0L/9.0L) + 8.0L/9.0L;
-        poly_val[10] = x*((26.0L/15.0L)*x - 8.0L/15.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(-98.0L/165.0L*x + 28.0L/165.0L) + 56.0L/495.0L;
-        poly_val[12] = x*((7.0L/30.0L)*x - 14.0L/165.0L) - 7.0L/198.0L;
-        poly_val[13] = x*(-343.0L/4290.0L*x + 7.0L/195.0L) + 56.0L/6435.0L;
-        poly_val[14] = x*((46.0L/2145.0L)*x - 8.0L/715.0L) - 2.0L/1287.0L;
-        poly_val[15] = x*(-62.0L/15015.0L*x + 12.0L/5005.0L) + 8.0L/45045.0L;
-        poly_val[16] = x*((11.0L/21840.0L)*x - 19.0L/60060.0L) - 1.0L/102960.0L;
-        poly_val[17] = x*(-1.0L/34320.0L*x + 1.0L/51480.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = (1.0L/17160.0L)*x - 1.0L/25740.0L;
-        poly_val[1] = -11.0L/10920.0L*x + 83.0L/120120.0L;
-        poly_val[2] = (124.0L/15015.0L)*x - 8.0L/1365.0L;
-        poly_val[3] = -92.0L/2145.0L*x + 68.0L/2145.0L;
-        poly_val[4] = (343.0L/2145.0L)*x - 266.0L/2145.0L;
-        poly_val[5] = -7.0L/15.0L*x + 21.0L/55.0L;
-        poly_val[6] = (196.0L/165.0L)*x - 56.0L/55.0L;
-        poly_val[7] = -52.0L/15.0L*x + 44.0L/15.0L;
-        poly_val[8] = (20.0L/3.0L)*x - 38.0L/9.0L;
-        poly_val[9] = -20.0L/3.0L*x + 22.0L/9.0L;
-        poly_val[10] = (52.0L/15.0L)*x - 8.0L/15.0L;
-        poly_val[11] = -196.0L/165.0L*x + 28.0L/165.0L;
-        poly_val[12] = (7.0L/15.0L)*x - 14.0L/165.0L;
-        poly_val[13] = -343.0L/2145.0L*x + 7.0L/195.0L;
-        poly_val[14] = (92.0L/2145.0L)*x - 8.0L/715.0L;
-        poly_val[15] = -124.0L/15015.0L*x + 12.0L/5005.0L;
-        poly_val[16] = (11.0L/10920.0L)*x - 19.0L/60060.0L;
-        poly_val[17] = -1.0L/17160.0L*x + 1.0L/51480.0L;
+        evaluate_beta_polynomials<spline_polynomials<8, 1, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n8_m2(int deriv, double x, double *poly_val) {
+
+template void beta_n8_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n8_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<8, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.7923465423465423e-05, 0.00047707748600605746, -0.0038448324162609878, 0.019445739445739445,
+         -0.06937451437451438, 0.18678451178451178, -0.4006734006734007, 0.6888888888888889,
+         -0.9170223922902494, 0.9170223922902494, -0.6888888888888889, 0.4006734006734007,
+         -0.18678451178451178, 0.06937451437451438, -0.019445739445739445, 0.0038448324162609878,
+         -0.00047707748600605746, 2.7923465423465423e-05},
+        {4.249222999222999e-06, -8.157764854193426e-05, 0.0007489864632721776, -0.004387464387464388,
+         0.018479020979020978, -0.05980639730639731, 0.1531986531986532, -0.23333333333333334,
+         0.12517786281179138, 0.12517786281179138, -0.23333333333333334, 0.1531986531986532,
+         -0.05980639730639731, 0.018479020979020978, -0.004387464387464388, 0.0007489864632721776,
+         -8.157764854193426e-05, 4.249222999222999e-06},
+        {2.3674242424242424e-05, -0.0004064264108906966, 0.0032988175845318703, -0.01687127687127687,
+         0.06133838383838384, -0.17117003367003367, 0.3983164983164983, -0.9222222222222223,
+         1.5696223072562359, -1.5696223072562359, 0.9222222222222223, -0.3983164983164983,
+         0.17117003367003367, -0.06133838383838384, 0.01687127687127687, -0.0032988175845318703,
+         0.0004064264108906966, -2.3674242424242424e-05},
+        {-6.980866355866356e-06, 0.00013444516792731077, -0.0012402940974369546, 0.007321937321937322,
+         -0.031267482517482514, 0.1041456228956229, -0.2887205387205387, 0.7166666666666667,
+         -0.5070333758503401, -0.5070333758503401, 0.7166666666666667, -0.2887205387205387,
+         0.1041456228956229, -0.031267482517482514, 0.007321937321937322, -0.0012402940974369546,
+         0.00013444516792731077, -6.980866355866356e-06},
+        {-4.1733440170940175e-06, 7.178925984729556e-05, -0.0005844023701166558, 0.0030024605024605027,
+         -0.010998688811188812, 0.03111847643097643, -0.07453703703703704, 0.1875,
+         -1.3350916772959183, 1.3350916772959183, -0.1875, 0.07453703703703704,
+         -0.03111847643097643, 0.010998688811188812, -0.0030024605024605027, 0.0005844023701166558,
+         -7.178925984729556e-05, 4.1733440170940175e-06},
+        {1.4796401515151515e-06, -2.8512688947956804e-05, 0.00026326187040472755, -0.0015562678062678063,
+         0.006661931818181819, -0.022298505892255894, 0.06260521885521886, -0.16458333333333333,
+         0.6189347275368481, 0.6189347275368481, -0.16458333333333333, 0.06260521885521886,
+         -0.022298505892255894, 0.006661931818181819, -0.0015562678062678063, 0.00026326187040472755,
+         -2.8512688947956804e-05, 1.4796401515151515e-06}};
+};
+constexpr double spline_polynomials<8, 2, 0>::coefficients[6][18];
+
+template <>
+struct spline_polynomials<8, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00013961732711732712, 0.002385387430030287, -0.019224162081304938, 0.09722869722869723,
+         -0.34687257187257187, 0.9339225589225589, -2.0033670033670035, 3.4444444444444446,
+         -4.585111961451247, 4.585111961451247, -3.4444444444444446, 2.0033670033670035,
+         -0.9339225589225589, 0.34687257187257187, -0.09722869722869723, 0.019224162081304938,
+         -0.002385387430030287, 0.00013961732711732712},
+        {1.6996891996891997e-05, -0.00032631059416773705, 0.00299594585308871, -0.01754985754985755,
+         0.07391608391608391, -0.23922558922558923, 0.6127946127946128, -0.9333333333333333,
+         0.5007114512471655, 0.5007114512471655, -0.9333333333333333, 0.6127946127946128,
+         -0.23922558922558923, 0.07391608391608391, -0.01754985754985755, 0.00299594585308871,
+         -0.00032631059416773705, 1.6996891996891997e-05},
+        {7.102272727272727e-05, -0.00121927923267209, 0.009896452753595611, -0.05061383061383062,
+         0.18401515151515152, -0.513510101010101, 1.194949494949495, -2.7666666666666666,
+         4.708866921768707, -4.708866921768707, 2.7666666666666666, -1.194949494949495,
+         0.513510101010101, -0.18401515151515152, 0.05061383061383062, -0.009896452753595611,
+         0.00121927923267209, -7.102272727272727e-05},
+        {-1.3961732711732712e-05, 0.00026889033585462155, -0.0024805881948739093, 0.014643874643874644,
+         -0.06253496503496503, 0.2082912457912458, -0.5774410774410774, 1.4333333333333333,
+         -1.0140667517006803, -1.0140667517006803, 1.4333333333333333, -0.5774410774410774,
+         0.2082912457912458, -0.06253496503496503, 0.014643874643874644, -0.0024805881948739093,
+         0.00026889033585462155, -1.3961732711732712e-05},
+        {-4.1733440170940175e-06, 7.178925984729556e-05, -0.0005844023701166558, 0.0030024605024605027,
+         -0.010998688811188812, 0.03111847643097643, -0.07453703703703704, 0.1875,
+         -1.3350916772959183, 1.3350916772959183, -0.1875, 0.07453703703703704,
+         -0.03111847643097643, 0.010998688811188812, -0.0030024605024605027, 0.0005844023701166558,
+         -7.178925984729556e-05, 4.1733440170940175e-06}};
+};
+constexpr double spline_polynomials<8, 2, 1>::coefficients[5][18];
+
+template <>
+struct spline_polynomials<8, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0005584693084693085, 0.009541549720121148, -0.07689664832521975, 0.3889147889147889,
+         -1.3874902874902875, 3.7356902356902357, -8.013468013468014, 13.777777777777779,
+         -18.340447845804988, 18.340447845804988, -13.777777777777779, 8.013468013468014,
+         -3.7356902356902357, 1.3874902874902875, -0.3889147889147889, 0.07689664832521975,
+         -0.009541549720121148, 0.0005584693084693085},
+        {5.099067599067599e-05, -0.000978931782503211, 0.00898783755926613, -0.05264957264957265,
+         0.22174825174825175, -0.7176767676767677, 1.8383838383838385, -2.8,
+         1.5021343537414966, 1.5021343537414966, -2.8, 1.8383838383838385,
+         -0.7176767676767677, 0.22174825174825175, -0.05264957264957265, 0.00898783755926613,
+         -0.000978931782503211, 5.099067599067599e-05},
+        {0.00014204545454545454, -0.00243855846534418, 0.019792905507191223, -0.10122766122766123,
+         0.36803030303030304, -1.027020202020202, 2.38989898989899, -5.533333333333333,
+         9.417733843537414, -9.417733843537414, 5.533333333333333, -2.38989898989899,
+         1.027020202020202, -0.36803030303030304, 0.10122766122766123, -0.019792905507191223,
+         0.00243855846534418, -0.00014204545454545454},
+        {-1.3961732711732712e-05, 0.00026889033585462155, -0.0024805881948739093, 0.014643874643874644,
+         -0.06253496503496503, 0.2082912457912458, -0.5774410774410774, 1.4333333333333333,
+         -1.0140667517006803, -1.0140667517006803, 1.4333333333333333, -0.5774410774410774,
+         0.2082912457912458, -0.06253496503496503, 0.014643874643874644, -0.0024805881948739093,
+         0.00026889033585462155, -1.3961732711732712e-05}};
+};
+constexpr double spline_polynomials<8, 2, 2>::coefficients[4][18];
+
+template <class real_number>
+void beta_n8_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(-23.0L/823680.0L*x + 61.0L/823680.0L) - 1.0L/18304.0L) - 1.0L/823680.0L) + 1.0L/102960.0L);
-        poly_val[1] = x*(x*(x*(x*((3851.0L/8072064.0L)*x - 5143.0L/4036032.0L) + 12773.0L/13453440.0L) + 8.0L/315315.0L) - 8.0L/45045.0L);
-        poly_val[2] = x*(x*(x*(x*(-3637.0L/945945.0L*x + 33.0L/3185.0L) - 821.0L/105105.0L) - 1.0L/3861.0L) + 2.0L/1287.0L);
-        poly_val[3] = x*(x*(x*(x*((1877.0L/96525.0L)*x - 5116.0L/96525.0L) + 3911.0L/96525.0L) + 56.0L/32175.0L) - 56.0L/6435.0L);
-        poly_val[4] = x*(x*(x*(x*(-17857.0L/257400.0L*x + 49399.0L/257400.0L) - 4263.0L/28600.0L) - 7.0L/792.0L) + 7.0L/198.0L);
-        poly_val[5] = x*(x*(x*(x*((2219.0L/11880.0L)*x - 1043.0L/1980.0L) + 329.0L/792.0L) + 56.0L/1485.0L) - 56.0L/495.0L);
-        poly_val[6] = x*(x*(x*(x*(-119.0L/297.0L*x + 343.0L/297.0L) - 1351.0L/1485.0L) - 7.0L/45.0L) + 14.0L/45.0L);
-        poly_val[7] = x*(x*(x*(x*((31.0L/45.0L)*x - 88.0L/45.0L) + 19.0L/15.0L) + 8.0L/9.0L) - 8.0L/9.0L);
-        poly_val[8] = pow(x, 2)*(x*(x*(-647051.0L/705600.0L*x + 568651.0L/235200.0L) - 686753.0L/705600.0L) - 1077749.0L/705600.0L) + 1;
-        poly_val[9] = x*(x*(x*(x*((647051.0L/705600.0L)*x - 764651.0L/352800.0L) + 333451.0L/705600.0L) + 8.0L/9.0L) + 8.0L/9.0L);
-        poly_val[10] = x*(x*(x*(x*(-31.0L/45.0L*x + 67.0L/45.0L) - 1.0L/3.0L) - 7.0L/45.0L) - 14.0L/45.0L);
-        poly_val[11] = x*(x*(x*(x*((119.0L/297.0L)*x - 28.0L/33.0L) + 49.0L/165.0L) + 56.0L/1485.0L) + 56.0L/495.0L);
-        poly_val[12] = x*(x*(x*(x*(-2219.0L/11880.0L*x + 4837.0L/11880.0L) - 2093.0L/11880.0L) - 7.0L/792.0L) - 7.0L/198.0L);
-        poly_val[13] = x*(x*(x*(x*((17857.0L/257400.0L)*x - 1813.0L/11700.0L) + 2149.0L/28600.0L) + 56.0L/32175.0L) + 56.0L/6435.0L);
-        poly_val[14] = x*(x*(x*(x*(-1877.0L/96525.0L*x + 1423.0L/32175.0L) - 739.0L/32175.0L) - 1.0L/3861.0L) - 2.0L/1287.0L);
-        poly_val[15] = x*(x*(x*(x*((3637.0L/945945.0L)*x - 8384.0L/945945.0L) + 911.0L/189189.0L) + 8.0L/315315.0L) + 8.0L/45045.0L);
-        poly_val[16] = x*(x*(x*(x*(-3851.0L/8072064.0L*x + 8969.0L/8072064.0L) - 8383.0L/13453440.0L) - 1.0L/823680.0L) - 1.0L/102960.0L);
-        poly_val[17] = pow(x, 3)*(x*((23.0L/823680.0L)*x - 3.0L/45760.0L) + 31.0L/823680.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(-23.0L/164736.0L*x + 61.0L/205920.0L) - 3.0L/18304.0L) - 1.0L/411840.0L) + 1.0L/102960.0L;
-        poly_val[1] = x*(x*(x*((19255.0L/8072064.0L)*x - 5143.0L/1009008.0L) + 12773.0L/4484480.0L) + 16.0L/315315.0L) - 8.0L/45045.0L;
-        poly_val[2] = x*(x*(x*(-3637.0L/189189.0L*x + 132.0L/3185.0L) - 821.0L/35035.0L) - 2.0L/3861.0L) + 2.0L/1287.0L;
-        poly_val[3] = x*(x*(x*((1877.0L/19305.0L)*x - 20464.0L/96525.0L) + 3911.0L/32175.0L) + 112.0L/32175.0L) - 56.0L/6435.0L;
-        poly_val[4] = x*(x*(x*(-17857.0L/51480.0L*x + 49399.0L/64350.0L) - 12789.0L/28600.0L) - 7.0L/396.0L) + 7.0L/198.0L;
-        poly_val[5] = x*(x*(x*((2219.0L/2376.0L)*x - 1043.0L/495.0L) + 329.0L/264.0L) + 112.0L/1485.0L) - 56.0L/495.0L;
-        poly_val[6] = x*(x*(x*(-595.0L/297.0L*x + 1372.0L/297.0L) - 1351.0L/495.0L) - 14.0L/45.0L) + 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*((31.0L/9.0L)*x - 352.0L/45.0L) + 19.0L/5.0L) + 16.0L/9.0L) - 8.0L/9.0L;
-        poly_val[8] = x*(x*(x*(-647051.0L/141120.0L*x + 568651.0L/58800.0L) - 686753.0L/235200.0L) - 1077749.0L/352800.0L);
-        poly_val[9] = x*(x*(x*((647051.0L/141120.0L)*x - 764651.0L/88200.0L) + 333451.0L/235200.0L) + 16.0L/9.0L) + 8.0L/9.0L;
-        poly_val[10] = x*(x*(x*(-31.0L/9.0L*x + 268.0L/45.0L) - 1) - 14.0L/45.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*((595.0L/297.0L)*x - 112.0L/33.0L) + 49.0L/55.0L) + 112.0L/1485.0L) + 56.0L/495.0L;
-        poly_val[12] = x*(x*(x*(-2219.0L/2376.0L*x + 4837.0L/2970.0L) - 2093.0L/3960.0L) - 7.0L/396.0L) - 7.0L/198.0L;
-        poly_val[13] = x*(x*(x*((17857.0L/51480.0L)*x - 1813.0L/2925.0L) + 6447.0L/28600.0L) + 112.0L/32175.0L) + 56.0L/6435.0L;
-        poly_val[14] = x*(x*(x*(-1877.0L/19305.0L*x + 5692.0L/32175.0L) - 739.0L/10725.0L) - 2.0L/3861.0L) - 2.0L/1287.0L;
-        poly_val[15] = x*(x*(x*((3637.0L/189189.0L)*x - 33536.0L/945945.0L) + 911.0L/63063.0L) + 16.0L/315315.0L) + 8.0L/45045.0L;
-        poly_val[16] = x*(x*(x*(-19255.0L/8072064.0L*x + 8969.0L/2018016.0L) - 8383.0L/4484480.0L) - 1.0L/411840.0L) - 1.0L/102960.0L;
-        poly_val[17] = pow(x, 2)*(x*((23.0L/164736.0L)*x - 3.0L/11440.0L) + 31.0L/274560.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(-23.0L/41184.0L*x + 61.0L/68640.0L) - 3.0L/9152.0L) - 1.0L/411840.0L;
-        poly_val[1] = x*(x*((19255.0L/2018016.0L)*x - 5143.0L/336336.0L) + 12773.0L/2242240.0L) + 16.0L/315315.0L;
-        poly_val[2] = x*(x*(-14548.0L/189189.0L*x + 396.0L/3185.0L) - 1642.0L/35035.0L) - 2.0L/3861.0L;
-        poly_val[3] = x*(x*((7508.0L/19305.0L)*x - 20464.0L/32175.0L) + 7822.0L/32175.0L) + 112.0L/32175.0L;
-        poly_val[4] = x*(x*(-17857.0L/12870.0L*x + 49399.0L/21450.0L) - 12789.0L/14300.0L) - 7.0L/396.0L;
-        poly_val[5] = x*(x*((2219.0L/594.0L)*x - 1043.0L/165.0L) + 329.0L/132.0L) + 112.0L/1485.0L;
-        poly_val[6] = x*(x*(-2380.0L/297.0L*x + 1372.0L/99.0L) - 2702.0L/495.0L) - 14.0L/45.0L;
-        poly_val[7] = x*(x*((124.0L/9.0L)*x - 352.0L/15.0L) + 38.0L/5.0L) + 16.0L/9.0L;
-        poly_val[8] = x*(x*(-647051.0L/35280.0L*x + 568651.0L/19600.0L) - 686753.0L/117600.0L) - 1077749.0L/352800.0L;
-        poly_val[9] = x*(x*((647051.0L/35280.0L)*x - 764651.0L/29400.0L) + 333451.0L/117600.0L) + 16.0L/9.0L;
-        poly_val[10] = x*(x*(-124.0L/9.0L*x + 268.0L/15.0L) - 2) - 14.0L/45.0L;
-        poly_val[11] = x*(x*((2380.0L/297.0L)*x - 112.0L/11.0L) + 98.0L/55.0L) + 112.0L/1485.0L;
-        poly_val[12] = x*(x*(-2219.0L/594.0L*x + 4837.0L/990.0L) - 2093.0L/1980.0L) - 7.0L/396.0L;
-        poly_val[13] = x*(x*((17857.0L/12870.0L)*x - 1813.0L/975.0L) + 6447.0L/14300.0L) + 112.0L/32175.0L;
-        poly_val[14] = x*(x*(-7508.0L/19305.0L*x + 5692.0L/10725.0L) - 1478.0L/10725.0L) - 2.0L/3861.0L;
-        poly_val[15] = x*(x*((14548.0L/189189.0L)*x - 33536.0L/315315.0L) + 1822.0L/63063.0L) + 16.0L/315315.0L;
-        poly_val[16] = x*(x*(-19255.0L/2018016.0L*x + 8969.0L/672672.0L) - 8383.0L/2242240.0L) - 1.0L/411840.0L;
-        poly_val[17] = x*(x*((23.0L/41184.0L)*x - 9.0L/11440.0L) + 31.0L/137280.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 2, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n8_m3(int deriv, double x, double *poly_val) {
+
+template void beta_n8_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n8_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<8, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {7.75854987164511e-05, -0.001319572017488684, 0.010563723313723314, -0.05287243840815269,
+         0.18534978524561857, -0.4831435485810486, 0.9695429292929293, -1.5286005920886874,
+         1.9146869488536156, -1.9146869488536156, 1.5286005920886874, -0.9695429292929293,
+         0.4831435485810486, -0.18534978524561857, 0.05287243840815269, -0.010563723313723314,
+         0.001319572017488684, -7.75854987164511e-05},
+        {-1.1567742222504128e-06, 2.1990658151372436e-05, -0.00019892519297281202, 0.0011376267031028935,
+         -0.004590877872127872, 0.013603149551066217, -0.02757265111431778, 0.03354676870748299,
+         -0.01594592466616276, -0.01594592466616276, 0.03354676870748299, -0.02757265111431778,
+         0.013603149551066217, -0.004590877872127872, 0.0011376267031028935, -0.00019892519297281202,
+         2.1990658151372436e-05, -1.1567742222504128e-06},
+        {-8.611258946080374e-05, 0.0014667564991225706, -0.011767624901553473, 0.05910006825185397,
+         -0.2083868533087283, 0.5491421732202982, -1.1278305976430976, 1.8353393329554044,
+         -2.3530376039304612, 2.3530376039304612, -1.8353393329554044, 1.1278305976430976,
+         -0.5491421732202982, 0.2083868533087283, -0.05910006825185397, 0.011767624901553473,
+         -0.0014667564991225706, 8.611258946080374e-05},
+        {5.1168036659108085e-06, -9.807064215546358e-05, 0.0008981803580017866, -0.005240684414791558,
+         0.021922179383116882, -0.07000875946969697, 0.17387814153439154, -0.2584934098639456,
+         0.13713730631141346, 0.13713730631141346, -0.2584934098639456, 0.17387814153439154,
+         -0.07000875946969697, 0.021922179383116882, -0.005240684414791558, 0.0008981803580017866,
+         -9.807064215546358e-05, 5.1168036659108085e-06},
+        {3.8221523433577005e-05, -0.0006538461641698249, 0.005279515705854992, -0.026784859072805502,
+         0.09609146857193732, -0.2617594490289803, 0.5801057975589226, -1.208834833238851,
+         1.9286261101662887, -1.9286261101662887, 1.208834833238851, -0.5801057975589226,
+         0.2617594490289803, -0.09609146857193732, 0.026784859072805502, -0.005279515705854992,
+         0.0006538461641698249, -3.8221523433577005e-05},
+        {-7.197761522538308e-06, 0.0001385684163306931, -0.0012775925711193568, 0.0075352423287691145,
+         -0.032128272118506496, 0.1066962134364478, -0.2938904108044733, 0.7229566857993197,
+         -0.5100232367252456, -0.5100232367252456, 0.7229566857993197, -0.2938904108044733,
+         0.1066962134364478, -0.032128272118506496, 0.0075352423287691145, -0.0012775925711193568,
+         0.0001385684163306931, -7.197761522538308e-06},
+        {-5.385617434538566e-06, 9.240757262055625e-05, -0.0007494605468935826, 0.003828592352587888,
+         -0.013894779205651601, 0.03866759437755531, -0.08968614530723906, 0.21138438425138573,
+         -1.3650086608717562, 1.3650086608717562, -0.21138438425138573, 0.08968614530723906,
+         -0.03866759437755531, 0.013894779205651601, -0.003828592352587888, 0.0007494605468935826,
+         -9.240757262055625e-05, 5.385617434538566e-06},
+        {1.4977147487378142e-06, -2.8856292981572e-05, 0.0002663700765449277, -0.001574043223503789,
+         0.0067336642849338164, -0.0225110551039913, 0.06303604152888007, -0.16510750159438775,
+         0.6191838826097569, 0.6191838826097569, -0.16510750159438775, 0.06303604152888007,
+         -0.0225110551039913, 0.0067336642849338164, -0.001574043223503789, 0.0002663700765449277,
+         -2.8856292981572e-05, 1.4977147487378142e-06}};
+};
+constexpr double spline_polynomials<8, 3, 0>::coefficients[8][18];
+
+template <>
+struct spline_polynomials<8, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0005430984910151577, -0.009237004122420789, 0.0739460631960632, -0.37010706885706884,
+         1.29744849671933, -3.38200484006734, 6.786800505050505, -10.70020414462081,
+         13.402808641975309, -13.402808641975309, 10.70020414462081, -6.786800505050505,
+         3.38200484006734, -1.29744849671933, 0.37010706885706884, -0.0739460631960632,
+         0.009237004122420789, -0.0005430984910151577},
+        {-6.940645333502476e-06, 0.00013194394890823463, -0.0011935511578368722, 0.006825760218617361,
+         -0.027545267232767234, 0.0816188973063973, -0.1654359066859067, 0.20128061224489796,
+         -0.09567554799697657, -0.09567554799697657, 0.20128061224489796, -0.1654359066859067,
+         0.0816188973063973, -0.027545267232767234, 0.006825760218617361, -0.0011935511578368722,
+         0.00013194394890823463, -6.940645333502476e-06},
+        {-0.00043056294730401876, 0.0073337824956128525, -0.05883812450776736, 0.2955003412592698,
+         -1.0419342665436415, 2.7457108661014913, -5.639152988215488, 9.176696664777023,
+         -11.765188019652305, 11.765188019652305, -9.176696664777023, 5.639152988215488,
+         -2.7457108661014913, 1.0419342665436415, -0.2955003412592698, 0.05883812450776736,
+         -0.0073337824956128525, 0.00043056294730401876},
+        {2.0467214663643234e-05, -0.00039228256862185434, 0.0035927214320071463, -0.02096273765916623,
+         0.08768871753246753, -0.28003503787878786, 0.6955125661375662, -1.0339736394557824,
+         0.5485492252456539, 0.5485492252456539, -1.0339736394557824, 0.6955125661375662,
+         -0.28003503787878786, 0.08768871753246753, -0.02096273765916623, 0.0035927214320071463,
+         -0.00039228256862185434, 2.0467214663643234e-05},
+        {0.00011466457030073101, -0.0019615384925094747, 0.015838547117564973, -0.0803545772184165,
+         0.288274405715812, -0.7852783470869409, 1.7403173926767677, -3.626504499716553,
+         5.785878330498866, -5.785878330498866, 3.626504499716553, -1.7403173926767677,
+         0.7852783470869409, -0.288274405715812, 0.0803545772184165, -0.015838547117564973,
+         0.0019615384925094747, -0.00011466457030073101},
+        {-1.4395523045076616e-05, 0.0002771368326613862, -0.0025551851422387136, 0.015070484657538229,
+         -0.06425654423701299, 0.2133924268728956, -0.5877808216089466, 1.4459133715986394,
+         -1.0200464734504913, -1.0200464734504913, 1.4459133715986394, -0.5877808216089466,
+         0.2133924268728956, -0.06425654423701299, 0.015070484657538229, -0.0025551851422387136,
+         0.0002771368326613862, -1.4395523045076616e-05},
+        {-5.385617434538566e-06, 9.240757262055625e-05, -0.0007494605468935826, 0.003828592352587888,
+         -0.013894779205651601, 0.03866759437755531, -0.08968614530723906, 0.21138438425138573,
+         -1.3650086608717562, 1.3650086608717562, -0.21138438425138573, 0.08968614530723906,
+         -0.03866759437755531, 0.013894779205651601, -0.003828592352587888, 0.0007494605468935826,
+         -9.240757262055625e-05, 5.385617434538566e-06}};
+};
+constexpr double spline_polynomials<8, 3, 1>::coefficients[7][18];
+
+template <>
+struct spline_polynomials<8, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.003258590946090946, -0.05542202473452473, 0.4436763791763792, -2.220642413142413,
+         7.784690980315981, -20.29202904040404, 40.72080303030303, -64.20122486772486,
+         80.41685185185185, -80.41685185185185, 64.20122486772486, -40.72080303030303,
+         20.29202904040404, -7.784690980315981, 2.220642413142413, -0.4436763791763792,
+         0.05542202473452473, -0.003258590946090946},
+        {-3.470322666751238e-05, 0.0006597197445411731, -0.005967755789184361, 0.03412880109308681,
+         -0.13772633616383617, 0.40809448653198654, -0.8271795334295334, 1.0064030612244899,
+         -0.47837773998488287, -0.47837773998488287, 1.0064030612244899, -0.8271795334295334,
+         0.40809448653198654, -0.13772633616383617, 0.03412880109308681, -0.005967755789184361,
+         0.0006597197445411731, -3.470322666751238e-05},
+        {-0.001722251789216075, 0.02933512998245141, -0.23535249803106945, 1.1820013650370793,
+         -4.167737066174566, 10.982843464405965, -22.556611952861953, 36.70678665910809,
+         -47.06075207860922, 47.06075207860922, -36.70678665910809, 22.556611952861953,
+         -10.982843464405965, 4.167737066174566, -1.1820013650370793, 0.23535249803106945,
+         -0.02933512998245141, 0.001722251789216075},
+        {6.14016439909297e-05, -0.001176847705865563, 0.010778164296021438, -0.06288821297749869,
+         0.2630661525974026, -0.8401051136363636, 2.086537698412698, -3.101920918367347,
+         1.6456476757369614, 1.6456476757369614, -3.101920918367347, 2.086537698412698,
+         -0.8401051136363636, 0.2630661525974026, -0.06288821297749869, 0.010778164296021438,
+         -0.001176847705865563, 6.14016439909297e-05},
+        {0.00022932914060146202, -0.003923076985018949, 0.031677094235129946, -0.160709154436833,
+         0.576548811431624, -1.5705566941738818, 3.4806347853535353, -7.253008999433106,
+         11.571756660997732, -11.571756660997732, 7.253008999433106, -3.4806347853535353,
+         1.5705566941738818, -0.576548811431624, 0.160709154436833, -0.031677094235129946,
+         0.003923076985018949, -0.00022932914060146202},
+        {-1.4395523045076616e-05, 0.0002771368326613862, -0.0025551851422387136, 0.015070484657538229,
+         -0.06425654423701299, 0.2133924268728956, -0.5877808216089466, 1.4459133715986394,
+         -1.0200464734504913, -1.0200464734504913, 1.4459133715986394, -0.5877808216089466,
+         0.2133924268728956, -0.06425654423701299, 0.015070484657538229, -0.0025551851422387136,
+         0.0002771368326613862, -1.4395523045076616e-05}};
+};
+constexpr double spline_polynomials<8, 3, 2>::coefficients[6][18];
+
+template <class real_number>
+void beta_n8_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*((1409119.0L/18162144000.0L)*x - 225133.0L/825552000.0L) + 982819.0L/3027024000.0L) - 280097.0L/2270268000.0L) - 266681.0L/18162144000.0L) - 1.0L/823680.0L) + 1.0L/102960.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-3423751.0L/2594592000.0L*x + 84281297.0L/18162144000.0L) - 1239279.0L/224224000.0L) + 584159.0L/279417600.0L) + 21701.0L/81081000.0L) + 8.0L/315315.0L) - 8.0L/45045.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*((1142023.0L/108108000.0L)*x - 2637197.0L/70945875.0L) + 16757869.0L/378378000.0L) - 1574527.0L/94594500.0L) - 1058149.0L/454053600.0L) - 1.0L/3861.0L) + 2.0L/1287.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(-8002307.0L/151351200.0L*x + 84540767.0L/454053600.0L) - 33583789.0L/151351200.0L) + 961571.0L/11642400.0L) + 41981.0L/3243240.0L) + 56.0L/32175.0L) - 56.0L/6435.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*((6870101.0L/37065600.0L)*x - 8475431.0L/12972960.0L) + 1246801.0L/1601600.0L) - 18501503.0L/64864800.0L) - 1033649.0L/19958400.0L) - 7.0L/792.0L) + 7.0L/198.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(-16071287.0L/33264000.0L*x + 24300857.0L/14256000.0L) - 22488359.0L/11088000.0L) + 24013303.0L/33264000.0L) + 999349.0L/6237000.0L) + 56.0L/1485.0L) - 56.0L/495.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*((383939.0L/396000.0L)*x - 2667076.0L/779625.0L) + 5606353.0L/1386000.0L) - 25547.0L/18900.0L) - 901349.0L/2268000.0L) - 7.0L/45.0L) + 14.0L/45.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(-24268063.0L/15876000.0L*x + 85470809.0L/15876000.0L) - 1232929.0L/196000.0L) + 31221523.0L/15876000.0L) + 372149.0L/793800.0L) + 8.0L/9.0L) - 8.0L/9.0L);
-        poly_val[8] = pow(x, 2)*(pow(x, 2)*(x*(x*((434251.0L/226800.0L)*x - 14219287.0L/2116800.0L) + 4099663.0L/529200.0L) - 7673891.0L/3175200.0L) - 1077749.0L/705600.0L) + 1;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(-434251.0L/226800.0L*x + 8491067.0L/1270080.0L) - 8098063.0L/1058400.0L) + 16330063.0L/6350400.0L) - 372149.0L/793800.0L) + 8.0L/9.0L) + 8.0L/9.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*((24268063.0L/15876000.0L)*x - 2637676.0L/496125.0L) + 596739.0L/98000.0L) - 4429349.0L/1984500.0L) + 901349.0L/2268000.0L) - 7.0L/45.0L) - 14.0L/45.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(-383939.0L/396000.0L*x + 7633697.0L/2268000.0L) - 32262353.0L/8316000.0L) + 2482583.0L/1663200.0L) - 999349.0L/6237000.0L) + 56.0L/1485.0L) + 56.0L/495.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*((16071287.0L/33264000.0L)*x - 5978251.0L/3564000.0L) + 32375053.0L/16632000.0L) - 6319283.0L/8316000.0L) + 1033649.0L/19958400.0L) - 7.0L/792.0L) - 7.0L/198.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(-6870101.0L/37065600.0L*x + 167126329.0L/259459200.0L) - 2405369.0L/3203200.0L) + 76448243.0L/259459200.0L) - 41981.0L/3243240.0L) + 56.0L/32175.0L) + 56.0L/6435.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*((8002307.0L/151351200.0L)*x - 521923.0L/2837835.0L) + 5425117.0L/25225200.0L) - 41011.0L/485100.0L) + 1058149.0L/454053600.0L) - 1.0L/3861.0L) - 2.0L/1287.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(-1142023.0L/108108000.0L*x + 83487077.0L/2270268000.0L) - 10870837.0L/252252000.0L) + 12826589.0L/756756000.0L) - 21701.0L/81081000.0L) + 8.0L/315315.0L) + 8.0L/45045.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*((3423751.0L/2594592000.0L)*x - 41741251.0L/9081072000.0L) + 604847.0L/112112000.0L) - 7411.0L/3492720.0L) + 266681.0L/18162144000.0L) - 1.0L/823680.0L) - 1.0L/102960.0L);
-        poly_val[17] = pow(x, 4)*(x*(x*(-1409119.0L/18162144000.0L*x + 1636969.0L/6054048000.0L) - 1923619.0L/6054048000.0L) + 206279.0L/1651104000.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*((1409119.0L/2594592000.0L)*x - 225133.0L/137592000.0L) + 982819.0L/605404800.0L) - 280097.0L/567567000.0L) - 266681.0L/6054048000.0L) - 1.0L/411840.0L) + 1.0L/102960.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(-3423751.0L/370656000.0L*x + 84281297.0L/3027024000.0L) - 1239279.0L/44844800.0L) + 584159.0L/69854400.0L) + 21701.0L/27027000.0L) + 16.0L/315315.0L) - 8.0L/45045.0L;
-        poly_val[2] = x*(x*(x*(x*(x*((1142023.0L/15444000.0L)*x - 5274394.0L/23648625.0L) + 16757869.0L/75675600.0L) - 1574527.0L/23648625.0L) - 1058149.0L/151351200.0L) - 2.0L/3861.0L) + 2.0L/1287.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(-8002307.0L/21621600.0L*x + 84540767.0L/75675600.0L) - 33583789.0L/30270240.0L) + 961571.0L/2910600.0L) + 41981.0L/1081080.0L) + 112.0L/32175.0L) - 56.0L/6435.0L;
-        poly_val[4] = x*(x*(x*(x*(x*((48090707.0L/37065600.0L)*x - 8475431.0L/2162160.0L) + 1246801.0L/320320.0L) - 18501503.0L/16216200.0L) - 1033649.0L/6652800.0L) - 7.0L/396.0L) + 7.0L/198.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(-16071287.0L/4752000.0L*x + 24300857.0L/2376000.0L) - 22488359.0L/2217600.0L) + 24013303.0L/8316000.0L) + 999349.0L/2079000.0L) + 112.0L/1485.0L) - 56.0L/495.0L;
-        poly_val[6] = x*(x*(x*(x*(x*((2687573.0L/396000.0L)*x - 5334152.0L/259875.0L) + 5606353.0L/277200.0L) - 25547.0L/4725.0L) - 901349.0L/756000.0L) - 14.0L/45.0L) + 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(-24268063.0L/2268000.0L*x + 85470809.0L/2646000.0L) - 1232929.0L/39200.0L) + 31221523.0L/3969000.0L) + 372149.0L/264600.0L) + 16.0L/9.0L) - 8.0L/9.0L;
-        poly_val[8] = x*(pow(x, 2)*(x*(x*((434251.0L/32400.0L)*x - 14219287.0L/352800.0L) + 4099663.0L/105840.0L) - 7673891.0L/793800.0L) - 1077749.0L/352800.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(-434251.0L/32400.0L*x + 8491067.0L/211680.0L) - 8098063.0L/211680.0L) + 16330063.0L/1587600.0L) - 372149.0L/264600.0L) + 16.0L/9.0L) + 8.0L/9.0L;
-        poly_val[10] = x*(x*(x*(x*(x*((24268063.0L/2268000.0L)*x - 5275352.0L/165375.0L) + 596739.0L/19600.0L) - 4429349.0L/496125.0L) + 901349.0L/756000.0L) - 14.0L/45.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(-2687573.0L/396000.0L*x + 7633697.0L/378000.0L) - 32262353.0L/1663200.0L) + 2482583.0L/415800.0L) - 999349.0L/2079000.0L) + 112.0L/1485.0L) + 56.0L/495.0L;
-        poly_val[12] = x*(x*(x*(x*(x*((16071287.0L/4752000.0L)*x - 5978251.0L/594000.0L) + 32375053.0L/3326400.0L) - 6319283.0L/2079000.0L) + 1033649.0L/6652800.0L) - 7.0L/396.0L) - 7.0L/198.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(-48090707.0L/37065600.0L*x + 167126329.0L/43243200.0L) - 2405369.0L/640640.0L) + 76448243.0L/64864800.0L) - 41981.0L/1081080.0L) + 112.0L/32175.0L) + 56.0L/6435.0L;
-        poly_val[14] = x*(x*(x*(x*(x*((8002307.0L/21621600.0L)*x - 1043846.0L/945945.0L) + 5425117.0L/5045040.0L) - 41011.0L/121275.0L) + 1058149.0L/151351200.0L) - 2.0L/3861.0L) - 2.0L/1287.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(-1142023.0L/15444000.0L*x + 83487077.0L/378378000.0L) - 10870837.0L/50450400.0L) + 12826589.0L/189189000.0L) - 21701.0L/27027000.0L) + 16.0L/315315.0L) + 8.0L/45045.0L;
-        poly_val[16] = x*(x*(x*(x*(x*((3423751.0L/370656000.0L)*x - 41741251.0L/1513512000.0L) + 604847.0L/22422400.0L) - 7411.0L/873180.0L) + 266681.0L/6054048000.0L) - 1.0L/411840.0L) - 1.0L/102960.0L;
-        poly_val[17] = pow(x, 3)*(x*(x*(-1409119.0L/2594592000.0L*x + 1636969.0L/1009008000.0L) - 1923619.0L/1210809600.0L) + 206279.0L/412776000.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*((1409119.0L/432432000.0L)*x - 225133.0L/27518400.0L) + 982819.0L/151351200.0L) - 280097.0L/189189000.0L) - 266681.0L/3027024000.0L) - 1.0L/411840.0L;
-        poly_val[1] = x*(x*(x*(x*(-3423751.0L/61776000.0L*x + 84281297.0L/605404800.0L) - 1239279.0L/11211200.0L) + 584159.0L/23284800.0L) + 21701.0L/13513500.0L) + 16.0L/315315.0L;
-        poly_val[2] = x*(x*(x*(x*((1142023.0L/2574000.0L)*x - 5274394.0L/4729725.0L) + 16757869.0L/18918900.0L) - 1574527.0L/7882875.0L) - 1058149.0L/75675600.0L) - 2.0L/3861.0L;
-        poly_val[3] = x*(x*(x*(x*(-8002307.0L/3603600.0L*x + 84540767.0L/15135120.0L) - 33583789.0L/7567560.0L) + 961571.0L/970200.0L) + 41981.0L/540540.0L) + 112.0L/32175.0L;
-        poly_val[4] = x*(x*(x*(x*((48090707.0L/6177600.0L)*x - 8475431.0L/432432.0L) + 1246801.0L/80080.0L) - 18501503.0L/5405400.0L) - 1033649.0L/3326400.0L) - 7.0L/396.0L;
-        poly_val[5] = x*(x*(x*(x*(-16071287.0L/792000.0L*x + 24300857.0L/475200.0L) - 22488359.0L/554400.0L) + 24013303.0L/2772000.0L) + 999349.0L/1039500.0L) + 112.0L/1485.0L;
-        poly_val[6] = x*(x*(x*(x*((2687573.0L/66000.0L)*x - 5334152.0L/51975.0L) + 5606353.0L/69300.0L) - 25547.0L/1575.0L) - 901349.0L/378000.0L) - 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*(x*(-24268063.0L/378000.0L*x + 85470809.0L/529200.0L) - 1232929.0L/9800.0L) + 31221523.0L/1323000.0L) + 372149.0L/132300.0L) + 16.0L/9.0L;
-        poly_val[8] = pow(x, 2)*(x*(x*((434251.0L/5400.0L)*x - 14219287.0L/70560.0L) + 4099663.0L/26460.0L) - 7673891.0L/264600.0L) - 1077749.0L/352800.0L;
-        poly_val[9] = x*(x*(x*(x*(-434251.0L/5400.0L*x + 8491067.0L/42336.0L) - 8098063.0L/52920.0L) + 16330063.0L/529200.0L) - 372149.0L/132300.0L) + 16.0L/9.0L;
-        poly_val[10] = x*(x*(x*(x*((24268063.0L/378000.0L)*x - 5275352.0L/33075.0L) + 596739.0L/4900.0L) - 4429349.0L/165375.0L) + 901349.0L/378000.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(-2687573.0L/66000.0L*x + 7633697.0L/75600.0L) - 32262353.0L/415800.0L) + 2482583.0L/138600.0L) - 999349.0L/1039500.0L) + 112.0L/1485.0L;
-        poly_val[12] = x*(x*(x*(x*((16071287.0L/792000.0L)*x - 5978251.0L/118800.0L) + 32375053.0L/831600.0L) - 6319283.0L/693000.0L) + 1033649.0L/3326400.0L) - 7.0L/396.0L;
-        poly_val[13] = x*(x*(x*(x*(-48090707.0L/6177600.0L*x + 167126329.0L/8648640.0L) - 2405369.0L/160160.0L) + 76448243.0L/21621600.0L) - 41981.0L/540540.0L) + 112.0L/32175.0L;
-        poly_val[14] = x*(x*(x*(x*((8002307.0L/3603600.0L)*x - 1043846.0L/189189.0L) + 5425117.0L/1261260.0L) - 41011.0L/40425.0L) + 1058149.0L/75675600.0L) - 2.0L/3861.0L;
-        poly_val[15] = x*(x*(x*(x*(-1142023.0L/2574000.0L*x + 83487077.0L/75675600.0L) - 10870837.0L/12612600.0L) + 12826589.0L/63063000.0L) - 21701.0L/13513500.0L) + 16.0L/315315.0L;
-        poly_val[16] = x*(x*(x*(x*((3423751.0L/61776000.0L)*x - 41741251.0L/302702400.0L) + 604847.0L/5605600.0L) - 7411.0L/291060.0L) + 266681.0L/3027024000.0L) - 1.0L/411840.0L;
-        poly_val[17] = pow(x, 2)*(x*(x*(-1409119.0L/432432000.0L*x + 1636969.0L/201801600.0L) - 1923619.0L/302702400.0L) + 206279.0L/137592000.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 3, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n8_m4(int deriv, double x, double *poly_val) {
+
+template void beta_n8_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n8_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<8, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0002501455844089773, 0.004252543208830411, -0.03402109787625661, 0.17011073398970225,
+         -0.595412728667937, 1.5481524328937524, -3.0964674456202235, 4.866088214915596,
+         -6.0827593635833965, 6.0827593635833965, -4.866088214915596, 3.0964674456202235,
+         -1.5481524328937524, 0.595412728667937, -0.17011073398970225, 0.03402109787625661,
+         -0.004252543208830411, 0.0002501455844089773},
+        {1.3880863955268717e-07, -2.5941836767729626e-06, 2.2875676645517917e-05, -0.00012562705519054726,
+         0.0004729688714063714, -0.0012341324120838009, 0.0021694958847736623, -0.002361725245653817,
+         0.0010585996551398338, 0.0010585996551398338, -0.002361725245653817, 0.0021694958847736623,
+         -0.0012341324120838009, 0.0004729688714063714, -0.00012562705519054726, 2.2875676645517917e-05,
+         -2.5941836767729626e-06, 1.3880863955268717e-07},
+        {0.00032773108312542836, -0.005572115226319095, 0.04458482118997992, -0.22298317239785495,
+         0.7807625139135556, -2.031295981474801, 4.066010374913152, -6.394688807004283,
+         7.997446312437011, -7.997446312437011, 6.394688807004283, -4.066010374913152,
+         2.031295981474801, -0.7807625139135556, 0.22298317239785495, -0.04458482118997992,
+         0.005572115226319095, -0.00032773108312542836},
+        {-1.2955828618030998e-06, 2.45848418281454e-05, -0.00022180086961832993, 0.0012632537582934408,
+         -0.005063846743534243, 0.014837281963150019, -0.029742146999091442, 0.03590849395313681,
+         -0.017004524321302596, -0.017004524321302596, 0.03590849395313681, -0.029742146999091442,
+         0.014837281963150019, -0.005063846743534243, 0.0012632537582934408, -0.00022180086961832993,
+         2.45848418281454e-05, -1.2955828618030998e-06},
+        {-0.00017991718361417023, 0.0030614602024339748, -0.024525536605149702, 0.12289159349799231,
+         -0.4316666265592047, 1.1296993355554554, -2.2890058897506815, 3.660122413548753,
+         -4.634072365274235, 4.634072365274235, -3.660122413548753, 2.2890058897506815,
+         -1.1296993355554554, 0.4316666265592047, -0.12289159349799231, 0.024525536605149702,
+         -0.0030614602024339748, 0.00017991718361417023},
+        {5.168856905743067e-06, -9.904346103425345e-05, 0.0009067587367438558, -0.005287794560488013,
+         0.02209954270989427, -0.0704715591242284, 0.17469170249118166, -0.25937905683106577,
+         0.13753428118209088, 0.13753428118209088, -0.25937905683106577, 0.17469170249118166,
+         -0.0704715591242284, 0.02209954270989427, -0.005287794560488013, 0.0009067587367438558,
+         -9.904346103425345e-05, 5.168856905743067e-06},
+        {5.3855622459138085e-05, -0.0009196301147217256, 0.007405834323121029, -0.037416779947161895,
+         0.1333047641136834, -0.3585189760848398, 0.7736350129101865, -1.5129653466710757,
+         2.308798570390251, -2.308798570390251, 1.5129653466710757, -0.7736350129101865,
+         0.3585189760848398, -0.1333047641136834, 0.037416779947161895, -0.007405834323121029,
+         0.0009196301147217256, -5.3855622459138085e-05},
+        {-7.206437062510351e-06, 0.00013873055281049142, -0.0012790223009097018, 0.007543094019718524,
+         -0.03215783267296939, 0.10677334671220305, -0.29402600429727166, 0.7231042936271731,
+         -0.5100893992036919, -0.5100893992036919, 0.7231042936271731, -0.29402600429727166,
+         0.10677334671220305, -0.03215783267296939, 0.007543094019718524, -0.0012790223009097018,
+         0.00013873055281049142, -7.206437062510351e-06},
+        {-6.362748623636133e-06, 0.00010901906953005005, -0.00088235546047271, 0.004493087407235163,
+         -0.01622061017701073, 0.044715064818546535, -0.10178172126669305, 0.2303925413408998,
+         -1.3887694396357537, 1.3887694396357537, -0.2303925413408998, 0.10178172126669305,
+         -0.044715064818546535, 0.01622061017701073, -0.004493087407235163, 0.00088235546047271,
+         -0.00010901906953005005, 6.362748623636133e-06},
+        {1.4982569699860668e-06, -2.8866426511559395e-05, 0.0002664594346568243, -0.001574533954188127,
+         0.006735511819587747, -0.022515875933726004, 0.06304451612217997, -0.1651167270836286,
+         0.6191880177646597, 0.6191880177646597, -0.1651167270836286, 0.06304451612217997,
+         -0.022515875933726004, 0.006735511819587747, -0.001574533954188127, 0.0002664594346568243,
+         -2.8866426511559395e-05, 1.4982569699860668e-06}};
+};
+constexpr double spline_polynomials<8, 4, 0>::coefficients[10][18];
+
+template <>
+struct spline_polynomials<8, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0022513102596807954, 0.0382728888794737, -0.30618988088630944, 1.5309966059073201,
+         -5.358714558011433, 13.933371896043772, -27.86820701058201, 43.79479393424036,
+         -54.744834272250564, 54.744834272250564, -43.79479393424036, 27.86820701058201,
+         -13.933371896043772, 5.358714558011433, -1.5309966059073201, 0.30618988088630944,
+         -0.0382728888794737, 0.0022513102596807954},
+        {1.1104691164214973e-06, -2.07534694141837e-05, 0.00018300541316414333, -0.0010050164415243781,
+         0.0037837509712509714, -0.009873059296670407, 0.0173559670781893, -0.018893801965230536,
+         0.00846879724111867, 0.00846879724111867, -0.018893801965230536, 0.0173559670781893,
+         -0.009873059296670407, 0.0037837509712509714, -0.0010050164415243781, 0.00018300541316414333,
+         -2.07534694141837e-05, 1.1104691164214973e-06},
+        {0.0022941175818779985, -0.039004806584233664, 0.3120937483298594, -1.5608822067849846,
+         5.465337597394889, -14.219071870323607, 28.462072624392068, -44.76282164902998,
+         55.982124187059085, -55.982124187059085, 44.76282164902998, -28.462072624392068,
+         14.219071870323607, -5.465337597394889, 1.5608822067849846, -0.3120937483298594,
+         0.039004806584233664, -0.0022941175818779985},
+        {-7.7734971708186e-06, 0.0001475090509688724, -0.0013308052177099796, 0.007579522549760645,
+         -0.030383080461205463, 0.08902369177890011, -0.17845288199454867, 0.21545096371882086,
+         -0.10202714592781557, -0.10202714592781557, 0.21545096371882086, -0.17845288199454867,
+         0.08902369177890011, -0.030383080461205463, 0.007579522549760645, -0.0013308052177099796,
+         0.0001475090509688724, -7.7734971708186e-06},
+        {-0.0008995859180708511, 0.015307301012169873, -0.1226276830257485, 0.6144579674899615,
+         -2.1583331327960233, 5.648496677777277, -11.445029448753408, 18.300612067743764,
+         -23.170361826371174, 23.170361826371174, -18.300612067743764, 11.445029448753408,
+         -5.648496677777277, 2.1583331327960233, -0.6144579674899615, 0.1226276830257485,
+         -0.015307301012169873, 0.0008995859180708511},
+        {2.0675427622972268e-05, -0.0003961738441370138, 0.0036270349469754233, -0.021151178241952052,
+         0.08839817083957709, -0.2818862364969136, 0.6987668099647266, -1.037516227324263,
+         0.5501371247283635, 0.5501371247283635, -1.037516227324263, 0.6987668099647266,
+         -0.2818862364969136, 0.08839817083957709, -0.021151178241952052, 0.0036270349469754233,
+         -0.0003961738441370138, 2.0675427622972268e-05},
+        {0.00016156686737741426, -0.0027588903441651768, 0.02221750296936309, -0.11225033984148568,
+         0.39991429234105014, -1.0755569282545194, 2.3209050387305594, -4.538896040013228,
+         6.926395711170753, -6.926395711170753, 4.538896040013228, -2.3209050387305594,
+         1.0755569282545194, -0.39991429234105014, 0.11225033984148568, -0.02221750296936309,
+         0.0027588903441651768, -0.00016156686737741426},
+        {-1.4412874125020702e-05, 0.00027746110562098283, -0.0025580446018194035, 0.015086188039437048,
+         -0.06431566534593879, 0.2135466934244061, -0.5880520085945433, 1.4462085872543462,
+         -1.0201787984073838, -1.0201787984073838, 1.4462085872543462, -0.5880520085945433,
+         0.2135466934244061, -0.06431566534593879, 0.015086188039437048, -0.0025580446018194035,
+         0.00027746110562098283, -1.4412874125020702e-05},
+        {-6.362748623636133e-06, 0.00010901906953005005, -0.00088235546047271, 0.004493087407235163,
+         -0.01622061017701073, 0.044715064818546535, -0.10178172126669305, 0.2303925413408998,
+         -1.3887694396357537, 1.3887694396357537, -0.2303925413408998, 0.10178172126669305,
+         -0.044715064818546535, 0.01622061017701073, -0.004493087407235163, 0.00088235546047271,
+         -0.00010901906953005005, 6.362748623636133e-06}};
+};
+constexpr double spline_polynomials<8, 4, 1>::coefficients[9][18];
+
+template <>
+struct spline_polynomials<8, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 18;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.018010482077446363, 0.3061831110357896, -2.4495190470904755, 12.247972847258561,
+         -42.86971646409146, 111.46697516835017, -222.9456560846561, 350.3583514739229,
+         -437.9586741780045, 437.9586741780045, -350.3583514739229, 222.9456560846561,
+         -111.46697516835017, 42.86971646409146, -12.247972847258561, 2.4495190470904755,
+         -0.3061831110357896, 0.018010482077446363},
+        {7.77328381495048e-06, -0.00014527428589928589, 0.0012810378921490032, -0.007035115090670646,
+         0.0264862567987568, -0.06911141507669286, 0.1214917695473251, -0.13225661375661377,
+         0.05928158068783069, 0.05928158068783069, -0.13225661375661377, 0.1214917695473251,
+         -0.06911141507669286, 0.0264862567987568, -0.007035115090670646, 0.0012810378921490032,
+         -0.00014527428589928589, 7.77328381495048e-06},
+        {0.013764705491267992, -0.23402883950540201, 1.8725624899791566, -9.365293240709907,
+         32.792025584369334, -85.31443122194163, 170.77243574635241, -268.5769298941799,
+         335.8927451223545, -335.8927451223545, 268.5769298941799, -170.77243574635241,
+         85.31443122194163, -32.792025584369334, 9.365293240709907, -1.8725624899791566,
+         0.23402883950540201, -0.013764705491267992},
+        {-3.8867485854093e-05, 0.000737545254844362, -0.006654026088549898, 0.037897612748803225,
+         -0.15191540230602732, 0.4451184588945006, -0.8922644099727433, 1.0772548185941042,
+         -0.5101357296390778, -0.5101357296390778, 1.0772548185941042, -0.8922644099727433,
+         0.4451184588945006, -0.15191540230602732, 0.037897612748803225, -0.006654026088549898,
+         0.000737545254844362, -3.8867485854093e-05},
+        {-0.0035983436722834042, 0.06122920404867949, -0.490510732102994, 2.457831869959846,
+         -8.633332531184093, 22.593986711109107, -45.78011779501363, 73.20244827097505,
+         -92.6814473054847, 92.6814473054847, -73.20244827097505, 45.78011779501363,
+         -22.593986711109107, 8.633332531184093, -2.457831869959846, 0.490510732102994,
+         -0.06122920404867949, 0.0035983436722834042},
+        {6.20262828689168e-05, -0.0011885215324110414, 0.010881104840926269, -0.06345353472585616,
+         0.2651945125187313, -0.8456587094907407, 2.09630042989418, -3.112548681972789,
+         1.6504113741850908, 1.6504113741850908, -3.112548681972789, 2.09630042989418,
+         -0.8456587094907407, 0.2651945125187313, -0.06345353472585616, 0.010881104840926269,
+         -0.0011885215324110414, 6.20262828689168e-05},
+        {0.0003231337347548285, -0.0055177806883303536, 0.04443500593872618, -0.22450067968297135,
+         0.7998285846821003, -2.151113856509039, 4.641810077461119, -9.077792080026455,
+         13.852791422341506, -13.852791422341506, 9.077792080026455, -4.641810077461119,
+         2.151113856509039, -0.7998285846821003, 0.22450067968297135, -0.04443500593872618,
+         0.0055177806883303536, -0.0003231337347548285},
+        {-1.4412874125020702e-05, 0.00027746110562098283, -0.0025580446018194035, 0.015086188039437048,
+         -0.06431566534593879, 0.2135466934244061, -0.5880520085945433, 1.4462085872543462,
+         -1.0201787984073838, -1.0201787984073838, 1.4462085872543462, -0.5880520085945433,
+         0.2135466934244061, -0.06431566534593879, 0.015086188039437048, -0.0025580446018194035,
+         0.00027746110562098283, -1.4412874125020702e-05}};
+};
+constexpr double spline_polynomials<8, 4, 2>::coefficients[8][18];
+
+template <class real_number>
+void beta_n8_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*(-1101377.0L/4402944000.0L*x + 14870423.0L/13208832000.0L) - 159755.0L/83026944.0L) + 1953779.0L/1320883200.0L) - 952949.0L/2235340800.0L) + 266681.0L/145297152000.0L) - 266681.0L/18162144000.0L) - 1.0L/823680.0L) + 1.0L/102960.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*((617882417.0L/145297152000.0L)*x - 4729333.0L/247104000.0L) + 43207609.0L/1320883200.0L) - 913297027.0L/36324288000.0L) + 38966747.0L/5381376000.0L) - 21701.0L/567567000.0L) + 21701.0L/81081000.0L) + 8.0L/315315.0L) - 8.0L/45045.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*(-463422059.0L/13621608000.0L*x + 189610079.0L/1238328000.0L) - 891181997.0L/3405402000.0L) + 273948221.0L/1362160800.0L) - 788229307.0L/13621608000.0L) + 1058149.0L/2724321600.0L) - 1058149.0L/454053600.0L) - 1.0L/3861.0L) + 2.0L/1287.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*((42130577.0L/247665600.0L)*x - 18961871.0L/24766560.0L) + 7617133.0L/5821200.0L) - 1369431659.0L/1362160800.0L) + 787169833.0L/2724321600.0L) - 41981.0L/16216200.0L) + 41981.0L/3243240.0L) + 56.0L/32175.0L) - 56.0L/6435.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*(-617941241.0L/1037836800.0L*x + 34336129.0L/12812800.0L) - 216051389.0L/47174400.0L) + 1825249697.0L/518918400.0L) - 349286711.0L/345945600.0L) + 1033649.0L/79833600.0L) - 1033649.0L/19958400.0L) - 7.0L/792.0L) + 7.0L/198.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*((264845533.0L/171072000.0L)*x - 149002003.0L/21384000.0L) + 1425869503.0L/119750400.0L) - 177679.0L/19440.0L) + 627784987.0L/239500800.0L) - 999349.0L/18711000.0L) + 999349.0L/6237000.0L) + 56.0L/1485.0L) - 56.0L/495.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*(-42136729.0L/13608000.0L*x + 189644803.0L/13608000.0L) - 5940337.0L/249480.0L) + 1367199013.0L/74844000.0L) - 786324923.0L/149688000.0L) + 901349.0L/4536000.0L) - 901349.0L/2268000.0L) - 7.0L/45.0L) + 14.0L/45.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*((154508033.0L/31752000.0L)*x - 115893523.0L/5292000.0L) + 2651402.0L/70875.0L) - 18221291.0L/635040.0L) + 88029853.0L/10584000.0L) - 372149.0L/793800.0L) + 372149.0L/793800.0L) + 8.0L/9.0L) - 8.0L/9.0L);
-        poly_val[8] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-618047281.0L/101606400.0L*x + 5297753.0L/193536.0L) - 2375132021.0L/50803200.0L) + 1822225277.0L/50803200.0L) - 355812263.0L/33868800.0L) + 63566689.0L/101606400.0L) - 1077749.0L/705600.0L) + 1;
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*(x*((618047281.0L/101606400.0L)*x - 231758767.0L/8467200.0L) + 2374701779.0L/50803200.0L) - 303866687.0L/8467200.0L) + 119588617.0L/11289600.0L) - 372149.0L/793800.0L) - 372149.0L/793800.0L) + 8.0L/9.0L) + 8.0L/9.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*(-154508033.0L/31752000.0L*x + 231737053.0L/10584000.0L) - 59361409.0L/1587600.0L) + 91229503.0L/3175200.0L) - 5997349.0L/705600.0L) + 901349.0L/4536000.0L) + 901349.0L/2268000.0L) - 7.0L/45.0L) - 14.0L/45.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*((42136729.0L/13608000.0L)*x - 94792879.0L/6804000.0L) + 178080211.0L/7484400.0L) - 124488893.0L/6804000.0L) + 808490713.0L/149688000.0L) - 999349.0L/18711000.0L) - 999349.0L/6237000.0L) + 56.0L/1485.0L) + 56.0L/495.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*(-264845533.0L/171072000.0L*x + 1191593773.0L/171072000.0L) - 23984633.0L/2016000.0L) + 156569593.0L/17107200.0L) - 3224840863.0L/1197504000.0L) + 1033649.0L/79833600.0L) + 1033649.0L/19958400.0L) - 7.0L/792.0L) - 7.0L/198.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*((617941241.0L/1037836800.0L)*x - 351041.0L/131040.0L) + 2374601821.0L/518918400.0L) - 456767273.0L/129729600.0L) + 27500531.0L/26611200.0L) - 41981.0L/16216200.0L) - 41981.0L/3243240.0L) + 56.0L/32175.0L) + 56.0L/6435.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*(-42130577.0L/247665600.0L*x + 189556483.0L/247665600.0L) - 7951072.0L/6081075.0L) + 1370477429.0L/1362160800.0L) - 803027411.0L/2724321600.0L) + 1058149.0L/2724321600.0L) + 1058149.0L/454053600.0L) - 1.0L/3861.0L) - 2.0L/1287.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*((463422059.0L/13621608000.0L)*x - 148934833.0L/972972000.0L) + 2698663.0L/10319400.0L) - 274116233.0L/1362160800.0L) + 160398913.0L/2724321600.0L) - 21701.0L/567567000.0L) - 21701.0L/81081000.0L) + 8.0L/315315.0L) + 8.0L/45045.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*(-617882417.0L/145297152000.0L*x + 926697983.0L/48432384000.0L) - 36537089.0L/1117670400.0L) + 166138879.0L/6604416000.0L) - 356085943.0L/48432384000.0L) + 266681.0L/145297152000.0L) + 266681.0L/18162144000.0L) - 1.0L/823680.0L) - 1.0L/102960.0L);
-        poly_val[17] = pow(x, 5)*(x*(x*(x*((1101377.0L/4402944000.0L)*x - 3716689.0L/3302208000.0L) + 46568317.0L/24216192000.0L) - 1194499.0L/807206400.0L) + 62788793.0L/145297152000.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(-1101377.0L/489216000.0L*x + 14870423.0L/1651104000.0L) - 159755.0L/11860992.0L) + 1953779.0L/220147200.0L) - 952949.0L/447068160.0L) + 266681.0L/36324288000.0L) - 266681.0L/6054048000.0L) - 1.0L/411840.0L) + 1.0L/102960.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*((617882417.0L/16144128000.0L)*x - 4729333.0L/30888000.0L) + 43207609.0L/188697600.0L) - 913297027.0L/6054048000.0L) + 38966747.0L/1076275200.0L) - 21701.0L/141891750.0L) + 21701.0L/27027000.0L) + 16.0L/315315.0L) - 8.0L/45045.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(-463422059.0L/1513512000.0L*x + 189610079.0L/154791000.0L) - 891181997.0L/486486000.0L) + 273948221.0L/227026800.0L) - 788229307.0L/2724321600.0L) + 1058149.0L/681080400.0L) - 1058149.0L/151351200.0L) - 2.0L/3861.0L) + 2.0L/1287.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*((42130577.0L/27518400.0L)*x - 18961871.0L/3095820.0L) + 7617133.0L/831600.0L) - 1369431659.0L/227026800.0L) + 787169833.0L/544864320.0L) - 41981.0L/4054050.0L) + 41981.0L/1081080.0L) + 112.0L/32175.0L) - 56.0L/6435.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(-617941241.0L/115315200.0L*x + 34336129.0L/1601600.0L) - 216051389.0L/6739200.0L) + 1825249697.0L/86486400.0L) - 349286711.0L/69189120.0L) + 1033649.0L/19958400.0L) - 1033649.0L/6652800.0L) - 7.0L/396.0L) + 7.0L/198.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*((264845533.0L/19008000.0L)*x - 149002003.0L/2673000.0L) + 1425869503.0L/17107200.0L) - 177679.0L/3240.0L) + 627784987.0L/47900160.0L) - 999349.0L/4677750.0L) + 999349.0L/2079000.0L) + 112.0L/1485.0L) - 56.0L/495.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(-42136729.0L/1512000.0L*x + 189644803.0L/1701000.0L) - 5940337.0L/35640.0L) + 1367199013.0L/12474000.0L) - 786324923.0L/29937600.0L) + 901349.0L/1134000.0L) - 901349.0L/756000.0L) - 14.0L/45.0L) + 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*((154508033.0L/3528000.0L)*x - 115893523.0L/661500.0L) + 2651402.0L/10125.0L) - 18221291.0L/105840.0L) + 88029853.0L/2116800.0L) - 372149.0L/198450.0L) + 372149.0L/264600.0L) + 16.0L/9.0L) - 8.0L/9.0L;
-        poly_val[8] = x*(pow(x, 2)*(x*(x*(x*(x*(-618047281.0L/11289600.0L*x + 5297753.0L/24192.0L) - 2375132021.0L/7257600.0L) + 1822225277.0L/8467200.0L) - 355812263.0L/6773760.0L) + 63566689.0L/25401600.0L) - 1077749.0L/352800.0L);
-        poly_val[9] = x*(x*(x*(x*(x*(x*(x*((618047281.0L/11289600.0L)*x - 231758767.0L/1058400.0L) + 2374701779.0L/7257600.0L) - 303866687.0L/1411200.0L) + 119588617.0L/2257920.0L) - 372149.0L/198450.0L) - 372149.0L/264600.0L) + 16.0L/9.0L) + 8.0L/9.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(-154508033.0L/3528000.0L*x + 231737053.0L/1323000.0L) - 59361409.0L/226800.0L) + 91229503.0L/529200.0L) - 5997349.0L/141120.0L) + 901349.0L/1134000.0L) + 901349.0L/756000.0L) - 14.0L/45.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*((42136729.0L/1512000.0L)*x - 94792879.0L/850500.0L) + 178080211.0L/1069200.0L) - 124488893.0L/1134000.0L) + 808490713.0L/29937600.0L) - 999349.0L/4677750.0L) - 999349.0L/2079000.0L) + 112.0L/1485.0L) + 56.0L/495.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(-264845533.0L/19008000.0L*x + 1191593773.0L/21384000.0L) - 23984633.0L/288000.0L) + 156569593.0L/2851200.0L) - 3224840863.0L/239500800.0L) + 1033649.0L/19958400.0L) + 1033649.0L/6652800.0L) - 7.0L/396.0L) - 7.0L/198.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*((617941241.0L/115315200.0L)*x - 351041.0L/16380.0L) + 2374601821.0L/74131200.0L) - 456767273.0L/21621600.0L) + 27500531.0L/5322240.0L) - 41981.0L/4054050.0L) - 41981.0L/1081080.0L) + 112.0L/32175.0L) + 56.0L/6435.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(-42130577.0L/27518400.0L*x + 189556483.0L/30958200.0L) - 7951072.0L/868725.0L) + 1370477429.0L/227026800.0L) - 803027411.0L/544864320.0L) + 1058149.0L/681080400.0L) + 1058149.0L/151351200.0L) - 2.0L/3861.0L) - 2.0L/1287.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*((463422059.0L/1513512000.0L)*x - 148934833.0L/121621500.0L) + 2698663.0L/1474200.0L) - 274116233.0L/227026800.0L) + 160398913.0L/544864320.0L) - 21701.0L/141891750.0L) - 21701.0L/27027000.0L) + 16.0L/315315.0L) + 8.0L/45045.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(-617882417.0L/16144128000.0L*x + 926697983.0L/6054048000.0L) - 36537089.0L/159667200.0L) + 166138879.0L/1100736000.0L) - 356085943.0L/9686476800.0L) + 266681.0L/36324288000.0L) + 266681.0L/6054048000.0L) - 1.0L/411840.0L) - 1.0L/102960.0L;
-        poly_val[17] = pow(x, 4)*(x*(x*(x*((1101377.0L/489216000.0L)*x - 3716689.0L/412776000.0L) + 46568317.0L/3459456000.0L) - 1194499.0L/134534400.0L) + 62788793.0L/29059430400.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-1101377.0L/61152000.0L*x + 14870423.0L/235872000.0L) - 159755.0L/1976832.0L) + 1953779.0L/44029440.0L) - 952949.0L/111767040.0L) + 266681.0L/12108096000.0L) - 266681.0L/3027024000.0L) - 1.0L/411840.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*((617882417.0L/2018016000.0L)*x - 33105331.0L/30888000.0L) + 43207609.0L/31449600.0L) - 913297027.0L/1210809600.0L) + 38966747.0L/269068800.0L) - 21701.0L/47297250.0L) + 21701.0L/13513500.0L) + 16.0L/315315.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-463422059.0L/189189000.0L*x + 189610079.0L/22113000.0L) - 891181997.0L/81081000.0L) + 273948221.0L/45405360.0L) - 788229307.0L/681080400.0L) + 1058149.0L/227026800.0L) - 1058149.0L/75675600.0L) - 2.0L/3861.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*((42130577.0L/3439800.0L)*x - 18961871.0L/442260.0L) + 7617133.0L/138600.0L) - 1369431659.0L/45405360.0L) + 787169833.0L/136216080.0L) - 41981.0L/1351350.0L) + 41981.0L/540540.0L) + 112.0L/32175.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-617941241.0L/14414400.0L*x + 34336129.0L/228800.0L) - 216051389.0L/1123200.0L) + 1825249697.0L/17297280.0L) - 349286711.0L/17297280.0L) + 1033649.0L/6652800.0L) - 1033649.0L/3326400.0L) - 7.0L/396.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*((264845533.0L/2376000.0L)*x - 1043014021.0L/2673000.0L) + 1425869503.0L/2851200.0L) - 177679.0L/648.0L) + 627784987.0L/11975040.0L) - 999349.0L/1559250.0L) + 999349.0L/1039500.0L) + 112.0L/1485.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-42136729.0L/189000.0L*x + 189644803.0L/243000.0L) - 5940337.0L/5940.0L) + 1367199013.0L/2494800.0L) - 786324923.0L/7484400.0L) + 901349.0L/378000.0L) - 901349.0L/378000.0L) - 14.0L/45.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*((154508033.0L/441000.0L)*x - 115893523.0L/94500.0L) + 5302804.0L/3375.0L) - 18221291.0L/21168.0L) + 88029853.0L/529200.0L) - 372149.0L/66150.0L) + 372149.0L/132300.0L) + 16.0L/9.0L;
-        poly_val[8] = pow(x, 2)*(x*(x*(x*(x*(-618047281.0L/1411200.0L*x + 5297753.0L/3456.0L) - 2375132021.0L/1209600.0L) + 1822225277.0L/1693440.0L) - 355812263.0L/1693440.0L) + 63566689.0L/8467200.0L) - 1077749.0L/352800.0L;
-        poly_val[9] = x*(x*(x*(x*(x*(x*((618047281.0L/1411200.0L)*x - 231758767.0L/151200.0L) + 2374701779.0L/1209600.0L) - 303866687.0L/282240.0L) + 119588617.0L/564480.0L) - 372149.0L/66150.0L) - 372149.0L/132300.0L) + 16.0L/9.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(-154508033.0L/441000.0L*x + 231737053.0L/189000.0L) - 59361409.0L/37800.0L) + 91229503.0L/105840.0L) - 5997349.0L/35280.0L) + 901349.0L/378000.0L) + 901349.0L/378000.0L) - 14.0L/45.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*((42136729.0L/189000.0L)*x - 94792879.0L/121500.0L) + 178080211.0L/178200.0L) - 124488893.0L/226800.0L) + 808490713.0L/7484400.0L) - 999349.0L/1559250.0L) - 999349.0L/1039500.0L) + 112.0L/1485.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(-264845533.0L/2376000.0L*x + 8341156411.0L/21384000.0L) - 23984633.0L/48000.0L) + 156569593.0L/570240.0L) - 3224840863.0L/59875200.0L) + 1033649.0L/6652800.0L) + 1033649.0L/3326400.0L) - 7.0L/396.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*((617941241.0L/14414400.0L)*x - 351041.0L/2340.0L) + 2374601821.0L/12355200.0L) - 456767273.0L/4324320.0L) + 27500531.0L/1330560.0L) - 41981.0L/1351350.0L) - 41981.0L/540540.0L) + 112.0L/32175.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(-42130577.0L/3439800.0L*x + 189556483.0L/4422600.0L) - 15902144.0L/289575.0L) + 1370477429.0L/45405360.0L) - 803027411.0L/136216080.0L) + 1058149.0L/227026800.0L) + 1058149.0L/75675600.0L) - 2.0L/3861.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*((463422059.0L/189189000.0L)*x - 148934833.0L/17374500.0L) + 2698663.0L/245700.0L) - 274116233.0L/45405360.0L) + 160398913.0L/136216080.0L) - 21701.0L/47297250.0L) - 21701.0L/13513500.0L) + 16.0L/315315.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(-617882417.0L/2018016000.0L*x + 926697983.0L/864864000.0L) - 36537089.0L/26611200.0L) + 166138879.0L/220147200.0L) - 356085943.0L/2421619200.0L) + 266681.0L/12108096000.0L) + 266681.0L/3027024000.0L) - 1.0L/411840.0L;
-        poly_val[17] = pow(x, 3)*(x*(x*(x*((1101377.0L/61152000.0L)*x - 3716689.0L/58968000.0L) + 46568317.0L/576576000.0L) - 1194499.0L/26906880.0L) + 62788793.0L/7264857600.0L);
+        evaluate_beta_polynomials<spline_polynomials<8, 4, 2>>(x, poly_val);
         break;
     }
 }
+
+template void beta_n8_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n8_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
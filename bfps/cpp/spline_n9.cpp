@@ -25,360 +25,620 @@
 
 
 #include "spline_n9.hpp"
-#include <cmath>
+#include "beta_polynomials.hpp"
 
-void beta_n9_m0(int deriv, double x, double *poly_val) {
+template <>
+struct spline_polynomials<9, 0, 0>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, -1.0, 1.0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0},
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0.5, 0.5, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<9, 0, 0>::coefficients[2][20];
+
+template <>
+struct spline_polynomials<9, 0, 1>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, -1.0, 1.0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<9, 0, 1>::coefficients[1][20];
+
+template <>
+struct spline_polynomials<9, 0, 2>
+{
+    static constexpr int degree = 0;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0,
+         0, 0, 0, 0}};
+};
+constexpr double spline_polynomials<9, 0, 2>::coefficients[1][20];
+
+template <class real_number>
+void beta_n9_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = -x + 1;
-        poly_val[10] = x;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
+        evaluate_beta_polynomials<spline_polynomials<9, 0, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = -1;
-        poly_val[10] = 1;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
+        evaluate_beta_polynomials<spline_polynomials<9, 0, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = 0;
-        poly_val[1] = 0;
-        poly_val[2] = 0;
-        poly_val[3] = 0;
-        poly_val[4] = 0;
-        poly_val[5] = 0;
-        poly_val[6] = 0;
-        poly_val[7] = 0;
-        poly_val[8] = 0;
-        poly_val[9] = 0;
-        poly_val[10] = 0;
-        poly_val[11] = 0;
-        poly_val[12] = 0;
-        poly_val[13] = 0;
-        poly_val[14] = 0;
-        poly_val[15] = 0;
-        poly_val[16] = 0;
-        poly_val[17] = 0;
-        poly_val[18] = 0;
-        poly_val[19] = 0;
+        evaluate_beta_polynomials<spline_polynomials<9, 0, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n9_m1(int deriv, double x, double *poly_val) {
+
+template void beta_n9_m0<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n9_m0<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<9, 1, 0>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-2.285296402943462e-06, 4.399195575666164e-05, -0.00040327319739084445, 0.002347652347652348,
+         -0.009790209790209791, 0.03146853146853147, -0.08321678321678322, 0.2,
+         -0.5727272727272728, 1.1, -1.1, 0.5727272727272728,
+         -0.2, 0.08321678321678322, -0.03146853146853147, 0.009790209790209791,
+         -0.002347652347652348, 0.00040327319739084445, -4.399195575666164e-05, 2.285296402943462e-06},
+        {1.142648201471731e-06, -2.428127428127428e-05, 0.0002479138508550273, -0.0016233766233766235,
+         0.007692307692307693, -0.028321678321678322, 0.08566433566433566, -0.22727272727272727,
+         0.6136363636363636, -0.45, -0.45, 0.6136363636363636,
+         -0.22727272727272727, 0.08566433566433566, -0.028321678321678322, 0.007692307692307693,
+         -0.0016233766233766235, 0.0002479138508550273, -2.428127428127428e-05, 1.142648201471731e-06},
+        {5.713241007358655e-07, -1.099798893916541e-05, 0.00010081829934771111, -0.000586913086913087,
+         0.0024475524475524478, -0.007867132867132868, 0.020804195804195805, -0.05,
+         0.1431818181818182, -1.275, 1.275, -0.1431818181818182,
+         0.05, -0.020804195804195805, 0.007867132867132868, -0.0024475524475524478,
+         0.000586913086913087, -0.00010081829934771111, 1.099798893916541e-05, -5.713241007358655e-07},
+        {-2.8566205036793275e-07, 6.07031857031857e-06, -6.197846271375683e-05, 0.00040584415584415587,
+         -0.0019230769230769232, 0.007080419580419581, -0.021416083916083916, 0.056818181818181816,
+         -0.1534090909090909, 0.6125, 0.6125, -0.1534090909090909,
+         0.056818181818181816, -0.021416083916083916, 0.007080419580419581, -0.0019230769230769232,
+         0.00040584415584415587, -6.197846271375683e-05, 6.07031857031857e-06, -2.8566205036793275e-07}};
+};
+constexpr double spline_polynomials<9, 1, 0>::coefficients[4][20];
+
+template <>
+struct spline_polynomials<9, 1, 1>
+{
+    static constexpr int degree = 2;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-6.855889208830385e-06, 0.0001319758672699849, -0.0012098195921725334, 0.007042957042957043,
+         -0.02937062937062937, 0.0944055944055944, -0.24965034965034966, 0.6,
+         -1.7181818181818183, 3.3, -3.3, 1.7181818181818183,
+         -0.6, 0.24965034965034966, -0.0944055944055944, 0.02937062937062937,
+         -0.007042957042957043, 0.0012098195921725334, -0.0001319758672699849, 6.855889208830385e-06},
+        {2.285296402943462e-06, -4.856254856254856e-05, 0.0004958277017100547, -0.003246753246753247,
+         0.015384615384615385, -0.056643356643356645, 0.17132867132867133, -0.45454545454545453,
+         1.2272727272727273, -0.9, -0.9, 1.2272727272727273,
+         -0.45454545454545453, 0.17132867132867133, -0.056643356643356645, 0.015384615384615385,
+         -0.003246753246753247, 0.0004958277017100547, -4.856254856254856e-05, 2.285296402943462e-06},
+        {5.713241007358655e-07, -1.099798893916541e-05, 0.00010081829934771111, -0.000586913086913087,
+         0.0024475524475524478, -0.007867132867132868, 0.020804195804195805, -0.05,
+         0.1431818181818182, -1.275, 1.275, -0.1431818181818182,
+         0.05, -0.020804195804195805, 0.007867132867132868, -0.0024475524475524478,
+         0.000586913086913087, -0.00010081829934771111, 1.099798893916541e-05, -5.713241007358655e-07}};
+};
+constexpr double spline_polynomials<9, 1, 1>::coefficients[3][20];
+
+template <>
+struct spline_polynomials<9, 1, 2>
+{
+    static constexpr int degree = 1;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.371177841766077e-05, 0.0002639517345399698, -0.002419639184345067, 0.014085914085914086,
+         -0.05874125874125874, 0.1888111888111888, -0.4993006993006993, 1.2,
+         -3.4363636363636365, 6.6, -6.6, 3.4363636363636365,
+         -1.2, 0.4993006993006993, -0.1888111888111888, 0.05874125874125874,
+         -0.014085914085914086, 0.002419639184345067, -0.0002639517345399698, 1.371177841766077e-05},
+        {2.285296402943462e-06, -4.856254856254856e-05, 0.0004958277017100547, -0.003246753246753247,
+         0.015384615384615385, -0.056643356643356645, 0.17132867132867133, -0.45454545454545453,
+         1.2272727272727273, -0.9, -0.9, 1.2272727272727273,
+         -0.45454545454545453, 0.17132867132867133, -0.056643356643356645, 0.015384615384615385,
+         -0.003246753246753247, 0.0004958277017100547, -4.856254856254856e-05, 2.285296402943462e-06}};
+};
+constexpr double spline_polynomials<9, 1, 2>::coefficients[2][20];
+
+template <class real_number>
+void beta_n9_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(-1.0L/437580.0L*x + 1.0L/218790.0L) - 1.0L/437580.0L);
-        poly_val[1] = x*(x*((7.0L/159120.0L)*x - 79.0L/875160.0L) + 9.0L/194480.0L);
-        poly_val[2] = x*(x*(-549.0L/1361360.0L*x + 1161.0L/1361360.0L) - 9.0L/20020.0L);
-        poly_val[3] = x*(x*((47.0L/20020.0L)*x - 103.0L/20020.0L) + 2.0L/715.0L);
-        poly_val[4] = x*(x*(-7.0L/715.0L*x + 16.0L/715.0L) - 9.0L/715.0L);
-        poly_val[5] = x*(x*((9.0L/286.0L)*x - 54.0L/715.0L) + 63.0L/1430.0L);
-        poly_val[6] = x*(x*(-119.0L/1430.0L*x + 301.0L/1430.0L) - 7.0L/55.0L);
-        poly_val[7] = x*(x*((1.0L/5.0L)*x - 29.0L/55.0L) + 18.0L/55.0L);
-        poly_val[8] = x*(x*(-63.0L/110.0L*x + 81.0L/55.0L) - 9.0L/10.0L);
-        poly_val[9] = pow(x, 2)*((11.0L/10.0L)*x - 21.0L/10.0L) + 1;
-        poly_val[10] = x*(x*(-11.0L/10.0L*x + 6.0L/5.0L) + 9.0L/10.0L);
-        poly_val[11] = x*(x*((63.0L/110.0L)*x - 27.0L/110.0L) - 18.0L/55.0L);
-        poly_val[12] = x*(x*(-1.0L/5.0L*x + 4.0L/55.0L) + 7.0L/55.0L);
-        poly_val[13] = x*(x*((119.0L/1430.0L)*x - 28.0L/715.0L) - 63.0L/1430.0L);
-        poly_val[14] = x*(x*(-9.0L/286.0L*x + 27.0L/1430.0L) + 9.0L/715.0L);
-        poly_val[15] = x*(x*((7.0L/715.0L)*x - 1.0L/143.0L) - 2.0L/715.0L);
-        poly_val[16] = x*(x*(-47.0L/20020.0L*x + 19.0L/10010.0L) + 9.0L/20020.0L);
-        poly_val[17] = x*(x*((549.0L/1361360.0L)*x - 243.0L/680680.0L) - 9.0L/194480.0L);
-        poly_val[18] = x*(x*(-7.0L/159120.0L*x + 73.0L/1750320.0L) + 1.0L/437580.0L);
-        poly_val[19] = pow(x, 2)*((1.0L/437580.0L)*x - 1.0L/437580.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 1, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(-1.0L/145860.0L*x + 1.0L/109395.0L) - 1.0L/437580.0L;
-        poly_val[1] = x*((7.0L/53040.0L)*x - 79.0L/437580.0L) + 9.0L/194480.0L;
-        poly_val[2] = x*(-1647.0L/1361360.0L*x + 1161.0L/680680.0L) - 9.0L/20020.0L;
-        poly_val[3] = x*((141.0L/20020.0L)*x - 103.0L/10010.0L) + 2.0L/715.0L;
-        poly_val[4] = x*(-21.0L/715.0L*x + 32.0L/715.0L) - 9.0L/715.0L;
-        poly_val[5] = x*((27.0L/286.0L)*x - 108.0L/715.0L) + 63.0L/1430.0L;
-        poly_val[6] = x*(-357.0L/1430.0L*x + 301.0L/715.0L) - 7.0L/55.0L;
-        poly_val[7] = x*((3.0L/5.0L)*x - 58.0L/55.0L) + 18.0L/55.0L;
-        poly_val[8] = x*(-189.0L/110.0L*x + 162.0L/55.0L) - 9.0L/10.0L;
-        poly_val[9] = x*((33.0L/10.0L)*x - 21.0L/5.0L);
-        poly_val[10] = x*(-33.0L/10.0L*x + 12.0L/5.0L) + 9.0L/10.0L;
-        poly_val[11] = x*((189.0L/110.0L)*x - 27.0L/55.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(-3.0L/5.0L*x + 8.0L/55.0L) + 7.0L/55.0L;
-        poly_val[13] = x*((357.0L/1430.0L)*x - 56.0L/715.0L) - 63.0L/1430.0L;
-        poly_val[14] = x*(-27.0L/286.0L*x + 27.0L/715.0L) + 9.0L/715.0L;
-        poly_val[15] = x*((21.0L/715.0L)*x - 2.0L/143.0L) - 2.0L/715.0L;
-        poly_val[16] = x*(-141.0L/20020.0L*x + 19.0L/5005.0L) + 9.0L/20020.0L;
-        poly_val[17] = x*((1647.0L/1361360.0L)*x - 243.0L/340340.0L) - 9.0L/194480.0L;
-        poly_val[18] = x*(-7.0L/53040.0L*x + 73.0L/875160.0L) + 1.0L/437580.0L;
-        poly_val[19] = x*((1.0L/145860.0L)*x - 1.0L/218790.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 1, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = -1.0L/72930.0L*x + 1.0L/109395.0L;
-        poly_val[1] = (7.0L/26520.0L)*x - 79.0L/437580.0L;
-        poly_val[2] = -1647.0L/680680.0L*x + 1161.0L/680680.0L;
-        poly_val[3] = (141.0L/10010.0L)*x - 103.0L/10010.0L;
-        poly_val[4] = -42.0L/715.0L*x + 32.0L/715.0L;
-        poly_val[5] = (27.0L/143.0L)*x - 108.0L/715.0L;
-        poly_val[6] = -357.0L/715.0L*x + 301.0L/715.0L;
-        poly_val[7] = (6.0L/5.0L)*x - 58.0L/55.0L;
-        poly_val[8] = -189.0L/55.0L*x + 162.0L/55.0L;
-        poly_val[9] = (33.0L/5.0L)*x - 21.0L/5.0L;
-        poly_val[10] = -33.0L/5.0L*x + 12.0L/5.0L;
-        poly_val[11] = (189.0L/55.0L)*x - 27.0L/55.0L;
-        poly_val[12] = -6.0L/5.0L*x + 8.0L/55.0L;
-        poly_val[13] = (357.0L/715.0L)*x - 56.0L/715.0L;
-        poly_val[14] = -27.0L/143.0L*x + 27.0L/715.0L;
-        poly_val[15] = (42.0L/715.0L)*x - 2.0L/143.0L;
-        poly_val[16] = -141.0L/10010.0L*x + 19.0L/5005.0L;
-        poly_val[17] = (1647.0L/680680.0L)*x - 243.0L/340340.0L;
-        poly_val[18] = -7.0L/26520.0L*x + 73.0L/875160.0L;
-        poly_val[19] = (1.0L/72930.0L)*x - 1.0L/218790.0L;
+        evaluate_beta_polynomials<spline_polynomials<9, 1, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n9_m2(int deriv, double x, double *poly_val) {
+
+template void beta_n9_m1<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n9_m1<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<9, 2, 0>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {6.601967386281112e-06, -0.000125937288927485, 0.0011398134428596614, -0.006512535083963655,
+         0.026386946386946386, -0.08087412587412587, 0.1962121212121212, -0.3939393939393939,
+         0.6545454545454545, -0.8602322688334593, 0.8602322688334593, -0.6545454545454545,
+         0.3939393939393939, -0.1962121212121212, 0.08087412587412587, -0.026386946386946386,
+         0.006512535083963655, -0.0011398134428596614, 0.000125937288927485, -6.601967386281112e-06},
+        {-1.0156872901970941e-06, 2.15159069325736e-05, -0.00021869543271854197, 0.001422387136672851,
+         -0.006666666666666667, 0.024073426573426572, -0.06995920745920746, 0.16666666666666666,
+         -0.24545454545454545, 0.13011613441672965, 0.13011613441672965, -0.24545454545454545,
+         0.16666666666666666, -0.06995920745920746, 0.024073426573426572, -0.006666666666666667,
+         0.001422387136672851, -0.00021869543271854197, 2.15159069325736e-05, -1.0156872901970941e-06},
+        {-5.586280096084018e-06, 0.00010696060022040415, -0.0009731799188206752, 0.005603919889634175,
+         -0.022983682983682984, 0.07190559440559441, -0.18132284382284383, 0.396969696969697,
+         -0.9, 1.5301161344167296, -1.5301161344167296, 0.9,
+         -0.396969696969697, 0.18132284382284383, -0.07190559440559441, 0.022983682983682984,
+         -0.005603919889634175, 0.0009731799188206752, -0.00010696060022040415, 5.586280096084018e-06},
+        {1.650491846570278e-06, -3.503922774756108e-05, 0.0003572615672142983, -0.002334570191713049,
+         0.011025641025641025, -0.04035839160839161, 0.1206439393939394, -0.3106060606060606,
+         0.7363636363636363, -0.5150580672083648, -0.5150580672083648, 0.7363636363636363,
+         -0.3106060606060606, 0.1206439393939394, -0.04035839160839161, 0.011025641025641025,
+         -0.002334570191713049, 0.0003572615672142983, -3.503922774756108e-05, 1.650491846570278e-06},
+        {9.83947062378435e-07, -1.8869069497133222e-05, 0.00017205663952643994, -0.0009939465296608153,
+         0.004096736596736597, -0.012921765734265735, 0.03306745337995338, -0.07462121212121212,
+         0.18409090909090908, -1.3287645168020912, 1.3287645168020912, -0.18409090909090908,
+         0.07462121212121212, -0.03306745337995338, 0.012921765734265735, -0.004096736596736597,
+         0.0009939465296608153, -0.00017205663952643994, 1.8869069497133222e-05, -9.83947062378435e-07},
+        {-3.4914250600525113e-07, 7.41506275360442e-06, -7.56469272586657e-05, 0.000494743351886209,
+         -0.00233974358974359, 0.008585008741258742, -0.025788534382284383, 0.06723484848484848,
+         -0.16875, 0.6206322584010456, 0.6206322584010456, -0.16875,
+         0.06723484848484848, -0.025788534382284383, 0.008585008741258742, -0.00233974358974359,
+         0.000494743351886209, -7.56469272586657e-05, 7.41506275360442e-06, -3.4914250600525113e-07}};
+};
+constexpr double spline_polynomials<9, 2, 0>::coefficients[6][20];
+
+template <>
+struct spline_polynomials<9, 2, 1>
+{
+    static constexpr int degree = 4;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {3.3009836931405556e-05, -0.000629686444637425, 0.005699067214298307, -0.03256267541981828,
+         0.13193473193473193, -0.4043706293706294, 0.9810606060606061, -1.9696969696969697,
+         3.272727272727273, -4.301161344167297, 4.301161344167297, -3.272727272727273,
+         1.9696969696969697, -0.9810606060606061, 0.4043706293706294, -0.13193473193473193,
+         0.03256267541981828, -0.005699067214298307, 0.000629686444637425, -3.3009836931405556e-05},
+        {-4.0627491607883764e-06, 8.60636277302944e-05, -0.0008747817308741679, 0.005689548546691404,
+         -0.02666666666666667, 0.09629370629370629, -0.27983682983682984, 0.6666666666666666,
+         -0.9818181818181818, 0.5204645376669186, 0.5204645376669186, -0.9818181818181818,
+         0.6666666666666666, -0.27983682983682984, 0.09629370629370629, -0.02666666666666667,
+         0.005689548546691404, -0.0008747817308741679, 8.60636277302944e-05, -4.0627491607883764e-06},
+        {-1.6758840288252053e-05, 0.0003208818006612124, -0.0029195397564620255, 0.016811759668902526,
+         -0.06895104895104895, 0.21571678321678323, -0.5439685314685314, 1.190909090909091,
+         -2.7, 4.590348403250189, -4.590348403250189, 2.7,
+         -1.190909090909091, 0.5439685314685314, -0.21571678321678323, 0.06895104895104895,
+         -0.016811759668902526, 0.0029195397564620255, -0.0003208818006612124, 1.6758840288252053e-05},
+        {3.300983693140556e-06, -7.007845549512216e-05, 0.0007145231344285966, -0.004669140383426098,
+         0.02205128205128205, -0.08071678321678322, 0.2412878787878788, -0.6212121212121212,
+         1.4727272727272727, -1.0301161344167296, -1.0301161344167296, 1.4727272727272727,
+         -0.6212121212121212, 0.2412878787878788, -0.08071678321678322, 0.02205128205128205,
+         -0.004669140383426098, 0.0007145231344285966, -7.007845549512216e-05, 3.300983693140556e-06},
+        {9.83947062378435e-07, -1.8869069497133222e-05, 0.00017205663952643994, -0.0009939465296608153,
+         0.004096736596736597, -0.012921765734265735, 0.03306745337995338, -0.07462121212121212,
+         0.18409090909090908, -1.3287645168020912, 1.3287645168020912, -0.18409090909090908,
+         0.07462121212121212, -0.03306745337995338, 0.012921765734265735, -0.004096736596736597,
+         0.0009939465296608153, -0.00017205663952643994, 1.8869069497133222e-05, -9.83947062378435e-07}};
+};
+constexpr double spline_polynomials<9, 2, 1>::coefficients[5][20];
+
+template <>
+struct spline_polynomials<9, 2, 2>
+{
+    static constexpr int degree = 3;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.00013203934772562222, -0.0025187457785497, 0.022796268857193228, -0.1302507016792731,
+         0.5277389277389277, -1.6174825174825176, 3.9242424242424243, -7.878787878787879,
+         13.090909090909092, -17.204645376669188, 17.204645376669188, -13.090909090909092,
+         7.878787878787879, -3.9242424242424243, 1.6174825174825176, -0.5277389277389277,
+         0.1302507016792731, -0.022796268857193228, 0.0025187457785497, -0.00013203934772562222},
+        {-1.218824748236513e-05, 0.0002581908831908832, -0.0026243451926225036, 0.017068645640074213,
+         -0.08, 0.2888811188811189, -0.8395104895104896, 2.0,
+         -2.9454545454545453, 1.561393613000756, 1.561393613000756, -2.9454545454545453,
+         2.0, -0.8395104895104896, 0.2888811188811189, -0.08,
+         0.017068645640074213, -0.0026243451926225036, 0.0002581908831908832, -1.218824748236513e-05},
+        {-3.3517680576504107e-05, 0.0006417636013224249, -0.005839079512924051, 0.03362351933780505,
+         -0.1379020979020979, 0.43143356643356645, -1.0879370629370628, 2.381818181818182,
+         -5.4, 9.180696806500379, -9.180696806500379, 5.4,
+         -2.381818181818182, 1.0879370629370628, -0.43143356643356645, 0.1379020979020979,
+         -0.03362351933780505, 0.005839079512924051, -0.0006417636013224249, 3.3517680576504107e-05},
+        {3.300983693140556e-06, -7.007845549512216e-05, 0.0007145231344285966, -0.004669140383426098,
+         0.02205128205128205, -0.08071678321678322, 0.2412878787878788, -0.6212121212121212,
+         1.4727272727272727, -1.0301161344167296, -1.0301161344167296, 1.4727272727272727,
+         -0.6212121212121212, 0.2412878787878788, -0.08071678321678322, 0.02205128205128205,
+         -0.004669140383426098, 0.0007145231344285966, -7.007845549512216e-05, 3.300983693140556e-06}};
+};
+constexpr double spline_polynomials<9, 2, 2>::coefficients[4][20];
+
+template <class real_number>
+void beta_n9_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*((1.0L/151470.0L)*x - 23.0L/1312740.0L) + 1.0L/77220.0L) + 1.0L/3938220.0L) - 1.0L/437580.0L);
-        poly_val[1] = x*(x*(x*(x*(-15871.0L/126023040.0L*x + 42389.0L/126023040.0L) - 31621.0L/126023040.0L) - 9.0L/1555840.0L) + 9.0L/194480.0L);
-        poly_val[2] = x*(x*(x*(x*((17379.0L/15247232.0L)*x - 23391.0L/7623616.0L) + 176391.0L/76236160.0L) + 9.0L/140140.0L) - 9.0L/20020.0L);
-        poly_val[3] = x*(x*(x*(x*(-1369.0L/210210.0L*x + 2481.0L/140140.0L) - 379.0L/28028.0L) - 1.0L/2145.0L) + 2.0L/715.0L);
-        poly_val[4] = x*(x*(x*(x*((283.0L/10725.0L)*x - 779.0L/10725.0L) + 604.0L/10725.0L) + 9.0L/3575.0L) - 9.0L/715.0L);
-        poly_val[5] = x*(x*(x*(x*(-2313.0L/28600.0L*x + 6471.0L/28600.0L) - 5103.0L/28600.0L) - 63.0L/5720.0L) + 63.0L/1430.0L);
-        poly_val[6] = x*(x*(x*(x*((259.0L/1320.0L)*x - 1603.0L/2860.0L) + 2569.0L/5720.0L) + 7.0L/165.0L) - 7.0L/55.0L);
-        poly_val[7] = x*(x*(x*(x*(-13.0L/33.0L*x + 38.0L/33.0L) - 152.0L/165.0L) - 9.0L/55.0L) + 18.0L/55.0L);
-        poly_val[8] = x*(x*(x*(x*((36.0L/55.0L)*x - 207.0L/110.0L) + 27.0L/22.0L) + 9.0L/10.0L) - 9.0L/10.0L);
-        poly_val[9] = pow(x, 2)*(x*(x*(-5462819.0L/6350400.0L*x + 4827779.0L/2116800.0L) - 1864259.0L/2116800.0L) - 9778141.0L/6350400.0L) + 1;
-        poly_val[10] = x*(x*(x*(x*((5462819.0L/6350400.0L)*x - 6415379.0L/3175200.0L) + 2287619.0L/6350400.0L) + 9.0L/10.0L) + 9.0L/10.0L);
-        poly_val[11] = x*(x*(x*(x*(-36.0L/55.0L*x + 153.0L/110.0L) - 27.0L/110.0L) - 9.0L/55.0L) - 18.0L/55.0L);
-        poly_val[12] = x*(x*(x*(x*((13.0L/33.0L)*x - 9.0L/11.0L) + 14.0L/55.0L) + 7.0L/165.0L) + 7.0L/55.0L);
-        poly_val[13] = x*(x*(x*(x*(-259.0L/1320.0L*x + 7217.0L/17160.0L) - 581.0L/3432.0L) - 63.0L/5720.0L) - 63.0L/1430.0L);
-        poly_val[14] = x*(x*(x*(x*((2313.0L/28600.0L)*x - 2547.0L/14300.0L) + 2349.0L/28600.0L) + 9.0L/3575.0L) + 9.0L/715.0L);
-        poly_val[15] = x*(x*(x*(x*(-283.0L/10725.0L*x + 212.0L/3575.0L) - 106.0L/3575.0L) - 1.0L/2145.0L) - 2.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*((1369.0L/210210.0L)*x - 6247.0L/420420.0L) + 3293.0L/420420.0L) + 9.0L/140140.0L) + 9.0L/20020.0L);
-        poly_val[17] = x*(x*(x*(x*(-17379.0L/15247232.0L*x + 40113.0L/15247232.0L) - 6453.0L/4484480.0L) - 9.0L/1555840.0L) - 9.0L/194480.0L);
-        poly_val[18] = x*(x*(x*(x*((15871.0L/126023040.0L)*x - 6161.0L/21003840.0L) + 1385.0L/8401536.0L) + 1.0L/3938220.0L) + 1.0L/437580.0L);
-        poly_val[19] = pow(x, 3)*(x*(-1.0L/151470.0L*x + 61.0L/3938220.0L) - 7.0L/787644.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 2, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*((1.0L/30294.0L)*x - 23.0L/328185.0L) + 1.0L/25740.0L) + 1.0L/1969110.0L) - 1.0L/437580.0L;
-        poly_val[1] = x*(x*(x*(-15871.0L/25204608.0L*x + 42389.0L/31505760.0L) - 31621.0L/42007680.0L) - 9.0L/777920.0L) + 9.0L/194480.0L;
-        poly_val[2] = x*(x*(x*((86895.0L/15247232.0L)*x - 23391.0L/1905904.0L) + 529173.0L/76236160.0L) + 9.0L/70070.0L) - 9.0L/20020.0L;
-        poly_val[3] = x*(x*(x*(-1369.0L/42042.0L*x + 2481.0L/35035.0L) - 1137.0L/28028.0L) - 2.0L/2145.0L) + 2.0L/715.0L;
-        poly_val[4] = x*(x*(x*((283.0L/2145.0L)*x - 3116.0L/10725.0L) + 604.0L/3575.0L) + 18.0L/3575.0L) - 9.0L/715.0L;
-        poly_val[5] = x*(x*(x*(-2313.0L/5720.0L*x + 6471.0L/7150.0L) - 15309.0L/28600.0L) - 63.0L/2860.0L) + 63.0L/1430.0L;
-        poly_val[6] = x*(x*(x*((259.0L/264.0L)*x - 1603.0L/715.0L) + 7707.0L/5720.0L) + 14.0L/165.0L) - 7.0L/55.0L;
-        poly_val[7] = x*(x*(x*(-65.0L/33.0L*x + 152.0L/33.0L) - 152.0L/55.0L) - 18.0L/55.0L) + 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*((36.0L/11.0L)*x - 414.0L/55.0L) + 81.0L/22.0L) + 9.0L/5.0L) - 9.0L/10.0L;
-        poly_val[9] = x*(x*(x*(-5462819.0L/1270080.0L*x + 4827779.0L/529200.0L) - 1864259.0L/705600.0L) - 9778141.0L/3175200.0L);
-        poly_val[10] = x*(x*(x*((5462819.0L/1270080.0L)*x - 6415379.0L/793800.0L) + 2287619.0L/2116800.0L) + 9.0L/5.0L) + 9.0L/10.0L;
-        poly_val[11] = x*(x*(x*(-36.0L/11.0L*x + 306.0L/55.0L) - 81.0L/110.0L) - 18.0L/55.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*((65.0L/33.0L)*x - 36.0L/11.0L) + 42.0L/55.0L) + 14.0L/165.0L) + 7.0L/55.0L;
-        poly_val[13] = x*(x*(x*(-259.0L/264.0L*x + 7217.0L/4290.0L) - 581.0L/1144.0L) - 63.0L/2860.0L) - 63.0L/1430.0L;
-        poly_val[14] = x*(x*(x*((2313.0L/5720.0L)*x - 2547.0L/3575.0L) + 7047.0L/28600.0L) + 18.0L/3575.0L) + 9.0L/715.0L;
-        poly_val[15] = x*(x*(x*(-283.0L/2145.0L*x + 848.0L/3575.0L) - 318.0L/3575.0L) - 2.0L/2145.0L) - 2.0L/715.0L;
-        poly_val[16] = x*(x*(x*((1369.0L/42042.0L)*x - 6247.0L/105105.0L) + 3293.0L/140140.0L) + 9.0L/70070.0L) + 9.0L/20020.0L;
-        poly_val[17] = x*(x*(x*(-86895.0L/15247232.0L*x + 40113.0L/3811808.0L) - 19359.0L/4484480.0L) - 9.0L/777920.0L) - 9.0L/194480.0L;
-        poly_val[18] = x*(x*(x*((15871.0L/25204608.0L)*x - 6161.0L/5250960.0L) + 1385.0L/2800512.0L) + 1.0L/1969110.0L) + 1.0L/437580.0L;
-        poly_val[19] = pow(x, 2)*(x*(-1.0L/30294.0L*x + 61.0L/984555.0L) - 7.0L/262548.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 2, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*((2.0L/15147.0L)*x - 23.0L/109395.0L) + 1.0L/12870.0L) + 1.0L/1969110.0L;
-        poly_val[1] = x*(x*(-15871.0L/6301152.0L*x + 42389.0L/10501920.0L) - 31621.0L/21003840.0L) - 9.0L/777920.0L;
-        poly_val[2] = x*(x*((86895.0L/3811808.0L)*x - 70173.0L/1905904.0L) + 529173.0L/38118080.0L) + 9.0L/70070.0L;
-        poly_val[3] = x*(x*(-2738.0L/21021.0L*x + 7443.0L/35035.0L) - 1137.0L/14014.0L) - 2.0L/2145.0L;
-        poly_val[4] = x*(x*((1132.0L/2145.0L)*x - 3116.0L/3575.0L) + 1208.0L/3575.0L) + 18.0L/3575.0L;
-        poly_val[5] = x*(x*(-2313.0L/1430.0L*x + 19413.0L/7150.0L) - 15309.0L/14300.0L) - 63.0L/2860.0L;
-        poly_val[6] = x*(x*((259.0L/66.0L)*x - 4809.0L/715.0L) + 7707.0L/2860.0L) + 14.0L/165.0L;
-        poly_val[7] = x*(x*(-260.0L/33.0L*x + 152.0L/11.0L) - 304.0L/55.0L) - 18.0L/55.0L;
-        poly_val[8] = x*(x*((144.0L/11.0L)*x - 1242.0L/55.0L) + 81.0L/11.0L) + 9.0L/5.0L;
-        poly_val[9] = x*(x*(-5462819.0L/317520.0L*x + 4827779.0L/176400.0L) - 1864259.0L/352800.0L) - 9778141.0L/3175200.0L;
-        poly_val[10] = x*(x*((5462819.0L/317520.0L)*x - 6415379.0L/264600.0L) + 2287619.0L/1058400.0L) + 9.0L/5.0L;
-        poly_val[11] = x*(x*(-144.0L/11.0L*x + 918.0L/55.0L) - 81.0L/55.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*((260.0L/33.0L)*x - 108.0L/11.0L) + 84.0L/55.0L) + 14.0L/165.0L;
-        poly_val[13] = x*(x*(-259.0L/66.0L*x + 7217.0L/1430.0L) - 581.0L/572.0L) - 63.0L/2860.0L;
-        poly_val[14] = x*(x*((2313.0L/1430.0L)*x - 7641.0L/3575.0L) + 7047.0L/14300.0L) + 18.0L/3575.0L;
-        poly_val[15] = x*(x*(-1132.0L/2145.0L*x + 2544.0L/3575.0L) - 636.0L/3575.0L) - 2.0L/2145.0L;
-        poly_val[16] = x*(x*((2738.0L/21021.0L)*x - 6247.0L/35035.0L) + 3293.0L/70070.0L) + 9.0L/70070.0L;
-        poly_val[17] = x*(x*(-86895.0L/3811808.0L*x + 120339.0L/3811808.0L) - 19359.0L/2242240.0L) - 9.0L/777920.0L;
-        poly_val[18] = x*(x*((15871.0L/6301152.0L)*x - 6161.0L/1750320.0L) + 1385.0L/1400256.0L) + 1.0L/1969110.0L;
-        poly_val[19] = x*(x*(-2.0L/15147.0L*x + 61.0L/328185.0L) - 7.0L/131274.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 2, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n9_m3(int deriv, double x, double *poly_val) {
+
+template void beta_n9_m2<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n9_m2<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<9, 3, 0>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-1.834666461767302e-05, 0.00034872271882075806, -0.003140211737375603, 0.017808521890367128,
+         -0.07131851327684662, 0.21435521125699697, -0.501668318564152, 0.9354807972010353,
+         -1.4090421176046175, 1.7267200333837238, -1.7267200333837238, 1.4090421176046175,
+         -0.9354807972010353, 0.501668318564152, -0.21435521125699697, 0.07131851327684662,
+         -0.017808521890367128, 0.003140211737375603, -0.00034872271882075806, 1.834666461767302e-05},
+        {2.86068519611937e-07, -6.0199390556533416e-06, 6.060990829898393e-05, -0.00038858862147552625,
+         0.0017795644611120801, -0.006166543278150421, 0.01646269047310714, -0.031365919684372065,
+         0.036960710420531846, -0.017336789808516, -0.017336789808516, 0.036960710420531846,
+         -0.031365919684372065, 0.01646269047310714, -0.006166543278150421, 0.0017795644611120801,
+         -0.00038858862147552625, 6.060990829898393e-05, -6.0199390556533416e-06, 2.86068519611937e-07},
+        {2.036196584953588e-05, -0.00038747932804305353, 0.0034949722458913635, -0.019868926501739003,
+         0.07987583134458134, -0.2416405343168736, 0.5724633601352351, -1.0955499918401703,
+         1.7113270427489178, -2.1552722938712523, 2.1552722938712523, -1.7113270427489178,
+         1.0955499918401703, -0.5724633601352351, 0.2416405343168736, -0.07987583134458134,
+         0.019868926501739003, -0.0034949722458913635, 0.00038747932804305353, -2.036196584953588e-05},
+        {-1.230238679906047e-06, 2.6030861224313605e-05, -0.0002641528639427799, 0.0017138286027794957,
+         -0.008001340012500727, 0.028698334032039387, -0.08230622531403782, 0.19019110642994572,
+         -0.27317507826994436, 0.14311872677311666, 0.14311872677311666, -0.27317507826994436,
+         0.19019110642994572, -0.08230622531403782, 0.028698334032039387, -0.008001340012500727,
+         0.0017138286027794957, -0.0002641528639427799, 2.6030861224313605e-05, -1.230238679906047e-06},
+        {-9.026279711897708e-06, 0.00017234610999929627, -0.0015619696195786007, 0.008943017744078012,
+         -0.03635590422309172, 0.11209719651628133, -0.2753856535536223, 0.5723723464448911,
+         -1.1641953970508658, 1.853876140676178, -1.853876140676178, 1.1641953970508658,
+         -0.5723723464448911, 0.2753856535536223, -0.11209719651628133, 0.03635590422309172,
+         -0.008943017744078012, 0.0015619696195786007, -0.00017234610999929627, 9.026279711897708e-06},
+        {1.7041296939975161e-06, -3.616796632049608e-05, 0.0003686259250203578, -0.00240743055823971,
+         0.011359309362099541, -0.041514618473044815, 0.12373069385764698, -0.31648717054688036,
+         0.743293769567486, -0.5183087152974616, -0.5183087152974616, 0.743293769567486,
+         -0.31648717054688036, 0.12373069385764698, -0.041514618473044815, 0.011359309362099541,
+         -0.00240743055823971, 0.0003686259250203578, -3.616796632049608e-05, 1.7041296939975161e-06},
+        {1.2706136970295758e-06, -2.4317861978707566e-05, 0.00022112244792293374, -0.0012722046841978018,
+         0.005211088366687325, -0.016271065910156313, 0.04090602085751825, -0.0892380995774783,
+         0.20610719217848125, -1.355744517323712, 1.355744517323712, -0.20610719217848125,
+         0.0892380995774783, -0.04090602085751825, 0.016271065910156313, -0.005211088366687325,
+         0.0012722046841978018, -0.00022112244792293374, 2.4317861978707566e-05, -1.2706136970295758e-06},
+        {-3.536123266241876e-07, 7.509124301349004e-06, -7.659395707583733e-05, 0.0005008150490967641,
+         -0.002367549284448466, 0.008681360979979841, -0.02604576392092668, 0.0677249409799168,
+         -0.16932751110032082, 0.6209031457418037, 0.6209031457418037, -0.16932751110032082,
+         0.0677249409799168, -0.02604576392092668, 0.008681360979979841, -0.002367549284448466,
+         0.0005008150490967641, -7.659395707583733e-05, 7.509124301349004e-06, -3.536123266241876e-07}};
+};
+constexpr double spline_polynomials<9, 3, 0>::coefficients[8][20];
+
+template <>
+struct spline_polynomials<9, 3, 1>
+{
+    static constexpr int degree = 6;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.00012842665232371114, 0.0024410590317453062, -0.02198148216162922, 0.1246596532325699,
+         -0.4992295929379263, 1.500486478798979, -3.511678229949063, 6.548365580407247,
+         -9.863294823232323, 12.087040233686068, -12.087040233686068, 9.863294823232323,
+         -6.548365580407247, 3.511678229949063, -1.500486478798979, 0.4992295929379263,
+         -0.1246596532325699, 0.02198148216162922, -0.0024410590317453062, 0.00012842665232371114},
+        {1.716411117671622e-06, -3.611963433392005e-05, 0.0003636594497939036, -0.0023315317288531575,
+         0.010677386766672481, -0.03699925966890252, 0.09877614283864283, -0.1881955181062324,
+         0.2217642625231911, -0.104020738851096, -0.104020738851096, 0.2217642625231911,
+         -0.1881955181062324, 0.09877614283864283, -0.03699925966890252, 0.010677386766672481,
+         -0.0023315317288531575, 0.0003636594497939036, -3.611963433392005e-05, 1.716411117671622e-06},
+        {0.00010180982924767938, -0.0019373966402152676, 0.01747486122945682, -0.099344632508695,
+         0.39937915672290675, -1.2082026715843681, 2.862316800676176, -5.477749959200852,
+         8.556635213744588, -10.77636146935626, 10.77636146935626, -8.556635213744588,
+         5.477749959200852, -2.862316800676176, 1.2082026715843681, -0.39937915672290675,
+         0.099344632508695, -0.01747486122945682, 0.0019373966402152676, -0.00010180982924767938},
+        {-4.920954719624188e-06, 0.00010412344489725442, -0.0010566114557711197, 0.006855314411117983,
+         -0.03200536005000291, 0.11479333612815755, -0.3292249012561513, 0.7607644257197829,
+         -1.0927003130797774, 0.5724749070924666, 0.5724749070924666, -1.0927003130797774,
+         0.7607644257197829, -0.3292249012561513, 0.11479333612815755, -0.03200536005000291,
+         0.006855314411117983, -0.0010566114557711197, 0.00010412344489725442, -4.920954719624188e-06},
+        {-2.707883913569313e-05, 0.0005170383299978889, -0.004685908858735802, 0.026829053232234036,
+         -0.10906771266927517, 0.336291589548844, -0.8261569606608669, 1.7171170393346733,
+         -3.4925861911525975, 5.561628422028534, -5.561628422028534, 3.4925861911525975,
+         -1.7171170393346733, 0.8261569606608669, -0.336291589548844, 0.10906771266927517,
+         -0.026829053232234036, 0.004685908858735802, -0.0005170383299978889, 2.707883913569313e-05},
+        {3.4082593879950323e-06, -7.233593264099216e-05, 0.0007372518500407156, -0.00481486111647942,
+         0.022718618724199082, -0.08302923694608963, 0.24746138771529397, -0.6329743410937607,
+         1.486587539134972, -1.0366174305949232, -1.0366174305949232, 1.486587539134972,
+         -0.6329743410937607, 0.24746138771529397, -0.08302923694608963, 0.022718618724199082,
+         -0.00481486111647942, 0.0007372518500407156, -7.233593264099216e-05, 3.4082593879950323e-06},
+        {1.2706136970295758e-06, -2.4317861978707566e-05, 0.00022112244792293374, -0.0012722046841978018,
+         0.005211088366687325, -0.016271065910156313, 0.04090602085751825, -0.0892380995774783,
+         0.20610719217848125, -1.355744517323712, 1.355744517323712, -0.20610719217848125,
+         0.0892380995774783, -0.04090602085751825, 0.016271065910156313, -0.005211088366687325,
+         0.0012722046841978018, -0.00022112244792293374, 2.4317861978707566e-05, -1.2706136970295758e-06}};
+};
+constexpr double spline_polynomials<9, 3, 1>::coefficients[7][20];
+
+template <>
+struct spline_polynomials<9, 3, 2>
+{
+    static constexpr int degree = 5;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {-0.0007705599139422669, 0.014646354190471838, -0.13188889296977532, 0.7479579193954194,
+         -2.9953775576275574, 9.002918872793872, -21.07006937969438, 39.290193482443485,
+         -59.17976893939394, 72.5222414021164, -72.5222414021164, 59.17976893939394,
+         -39.290193482443485, 21.07006937969438, -9.002918872793872, 2.9953775576275574,
+         -0.7479579193954194, 0.13188889296977532, -0.014646354190471838, 0.0007705599139422669},
+        {8.58205558835811e-06, -0.00018059817166960024, 0.001818297248969518, -0.011657658644265788,
+         0.053386933833362404, -0.18499629834451264, 0.4938807141932142, -0.9409775905311619,
+         1.1088213126159554, -0.52010369425548, -0.52010369425548, 1.1088213126159554,
+         -0.9409775905311619, 0.4938807141932142, -0.18499629834451264, 0.053386933833362404,
+         -0.011657658644265788, 0.001818297248969518, -0.00018059817166960024, 8.58205558835811e-06},
+        {0.0004072393169907175, -0.00774958656086107, 0.06989944491782728, -0.39737853003478,
+         1.597516626891627, -4.8328106863374725, 11.449267202704704, -21.91099983680341,
+         34.22654085497835, -43.10544587742504, 43.10544587742504, -34.22654085497835,
+         21.91099983680341, -11.449267202704704, 4.8328106863374725, -1.597516626891627,
+         0.39737853003478, -0.06989944491782728, 0.00774958656086107, -0.0004072393169907175},
+        {-1.4762864158872563e-05, 0.00031237033469176326, -0.003169834367313359, 0.020565943233353947,
+         -0.09601608015000872, 0.3443800083844727, -0.9876747037684538, 2.2822932771593485,
+         -3.278100939239332, 1.7174247212773999, 1.7174247212773999, -3.278100939239332,
+         2.2822932771593485, -0.9876747037684538, 0.3443800083844727, -0.09601608015000872,
+         0.020565943233353947, -0.003169834367313359, 0.00031237033469176326, -1.4762864158872563e-05},
+        {-5.415767827138626e-05, 0.0010340766599957777, -0.009371817717471604, 0.05365810646446807,
+         -0.21813542533855035, 0.672583179097688, -1.6523139213217337, 3.4342340786693466,
+         -6.985172382305195, 11.123256844057067, -11.123256844057067, 6.985172382305195,
+         -3.4342340786693466, 1.6523139213217337, -0.672583179097688, 0.21813542533855035,
+         -0.05365810646446807, 0.009371817717471604, -0.0010340766599957777, 5.415767827138626e-05},
+        {3.4082593879950323e-06, -7.233593264099216e-05, 0.0007372518500407156, -0.00481486111647942,
+         0.022718618724199082, -0.08302923694608963, 0.24746138771529397, -0.6329743410937607,
+         1.486587539134972, -1.0366174305949232, -1.0366174305949232, 1.486587539134972,
+         -0.6329743410937607, 0.24746138771529397, -0.08302923694608963, 0.022718618724199082,
+         -0.00481486111647942, 0.0007372518500407156, -7.233593264099216e-05, 3.4082593879950323e-06}};
+};
+constexpr double spline_polynomials<9, 3, 2>::coefficients[6][20];
+
+template <class real_number>
+void beta_n9_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(-1888217.0L/102918816000.0L*x + 4978651.0L/77189112000.0L) - 11858753.0L/154378224000.0L) + 44201.0L/1513512000.0L) + 63397.0L/18162144000.0L) + 1.0L/3938220.0L) - 1.0L/437580.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*((3845371.0L/11027016000.0L)*x - 378705053.0L/308756448000.0L) + 451208881.0L/308756448000.0L) - 11393267.0L/20583763200.0L) - 10949.0L/155232000.0L) - 9.0L/1555840.0L) + 9.0L/194480.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(-53864479.0L/17153136000.0L*x + 34466423.0L/3118752000.0L) - 50212829.0L/3811808000.0L) + 4865737.0L/980179200.0L) + 196909.0L/288288000.0L) + 9.0L/140140.0L) - 9.0L/20020.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*((323440939.0L/18162144000.0L)*x - 1139100889.0L/18162144000.0L) + 452791811.0L/6054048000.0L) - 2074439.0L/74131200.0L) - 9601741.0L/2270268000.0L) - 1.0L/2145.0L) + 2.0L/715.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(-46260611.0L/648648000.0L*x + 190244191.0L/756756000.0L) - 28367477.0L/94594500.0L) + 252001891.0L/2270268000.0L) + 5861.0L/310464.0L) + 9.0L/3575.0L) - 9.0L/715.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*((216286123.0L/1009008000.0L)*x - 381611761.0L/504504000.0L) + 25287533.0L/28028000.0L) - 12734027.0L/38808000.0L) - 9381241.0L/144144000.0L) - 63.0L/5720.0L) + 63.0L/1430.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(-650812303.0L/1297296000.0L*x + 328457149.0L/185328000.0L) - 912727037.0L/432432000.0L) + 192796181.0L/259459200.0L) + 9072541.0L/49896000.0L) + 7.0L/165.0L) - 7.0L/55.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*((326737249.0L/349272000.0L)*x - 384845203.0L/116424000.0L) + 455197111.0L/116424000.0L) - 89503367.0L/69854400.0L) - 8190541.0L/19404000.0L) - 9.0L/55.0L) + 18.0L/55.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(-15623459.0L/11088000.0L*x + 12051359.0L/2425500.0L) - 24996777.0L/4312000.0L) + 3398939.0L/1940400.0L) + 3427741.0L/7056000.0L) + 9.0L/10.0L) - 9.0L/10.0L);
-        poly_val[9] = pow(x, 2)*(pow(x, 2)*(x*(x*((109653629.0L/63504000.0L)*x - 128296219.0L/21168000.0L) + 442116007.0L/63504000.0L) - 18943367.0L/9072000.0L) - 9778141.0L/6350400.0L) + 1;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(-109653629.0L/63504000.0L*x + 191343373.0L/31752000.0L) - 217755137.0L/31752000.0L) + 10180259.0L/4536000.0L) - 3427741.0L/7056000.0L) + 9.0L/10.0L) + 9.0L/10.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*((15623459.0L/11088000.0L)*x - 379906003.0L/77616000.0L) + 48081059.0L/8624000.0L) - 31369501.0L/15523200.0L) + 8190541.0L/19404000.0L) - 9.0L/55.0L) - 18.0L/55.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(-326737249.0L/349272000.0L*x + 566312567.0L/174636000.0L) - 108321659.0L/29106000.0L) + 49820941.0L/34927200.0L) - 9072541.0L/49896000.0L) + 7.0L/165.0L) + 7.0L/55.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*((650812303.0L/1297296000.0L)*x - 4884169.0L/2808000.0L) + 54375817.0L/27027000.0L) - 101735461.0L/129729600.0L) + 9381241.0L/144144000.0L) - 63.0L/5720.0L) - 63.0L/1430.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(-216286123.0L/1009008000.0L*x + 750779339.0L/1009008000.0L) - 97002071.0L/112112000.0L) + 342332713.0L/1009008000.0L) - 5861.0L/310464.0L) + 9.0L/3575.0L) + 9.0L/715.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*((46260611.0L/648648000.0L)*x - 1125304793.0L/4540536000.0L) + 437719279.0L/1513512000.0L) - 516063203.0L/4540536000.0L) + 9601741.0L/2270268000.0L) - 1.0L/2145.0L) - 2.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(-323440939.0L/18162144000.0L*x + 93748807.0L/1513512000.0L) - 219338303.0L/3027024000.0L) + 3696851.0L/129729600.0L) - 196909.0L/288288000.0L) + 9.0L/140140.0L) + 9.0L/20020.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*((53864479.0L/17153136000.0L)*x - 374972053.0L/34306272000.0L) + 48826629.0L/3811808000.0L) - 290471.0L/57657600.0L) + 10949.0L/155232000.0L) - 9.0L/1555840.0L) - 9.0L/194480.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*(-3845371.0L/11027016000.0L*x + 374987663.0L/308756448000.0L) - 440056711.0L/308756448000.0L) + 2662049.0L/4750099200.0L) - 63397.0L/18162144000.0L) + 1.0L/3938220.0L) + 1.0L/437580.0L);
-        poly_val[19] = pow(x, 4)*(x*(x*((1888217.0L/102918816000.0L)*x - 19737953.0L/308756448000.0L) + 23187553.0L/308756448000.0L) - 9114251.0L/308756448000.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 3, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(-1888217.0L/14702688000.0L*x + 4978651.0L/12864852000.0L) - 11858753.0L/30875644800.0L) + 44201.0L/378378000.0L) + 63397.0L/6054048000.0L) + 1.0L/1969110.0L) - 1.0L/437580.0L;
-        poly_val[1] = x*(x*(x*(x*(x*((3845371.0L/1575288000.0L)*x - 378705053.0L/51459408000.0L) + 451208881.0L/61751289600.0L) - 11393267.0L/5145940800.0L) - 10949.0L/51744000.0L) - 9.0L/777920.0L) + 9.0L/194480.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(-53864479.0L/2450448000.0L*x + 34466423.0L/519792000.0L) - 50212829.0L/762361600.0L) + 4865737.0L/245044800.0L) + 196909.0L/96096000.0L) + 9.0L/70070.0L) - 9.0L/20020.0L;
-        poly_val[3] = x*(x*(x*(x*(x*((323440939.0L/2594592000.0L)*x - 1139100889.0L/3027024000.0L) + 452791811.0L/1210809600.0L) - 2074439.0L/18532800.0L) - 9601741.0L/756756000.0L) - 2.0L/2145.0L) + 2.0L/715.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(-46260611.0L/92664000.0L*x + 190244191.0L/126126000.0L) - 28367477.0L/18918900.0L) + 252001891.0L/567567000.0L) + 5861.0L/103488.0L) + 18.0L/3575.0L) - 9.0L/715.0L;
-        poly_val[5] = x*(x*(x*(x*(x*((216286123.0L/144144000.0L)*x - 381611761.0L/84084000.0L) + 25287533.0L/5605600.0L) - 12734027.0L/9702000.0L) - 9381241.0L/48048000.0L) - 63.0L/2860.0L) + 63.0L/1430.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(-650812303.0L/185328000.0L*x + 328457149.0L/30888000.0L) - 912727037.0L/86486400.0L) + 192796181.0L/64864800.0L) + 9072541.0L/16632000.0L) + 14.0L/165.0L) - 7.0L/55.0L;
-        poly_val[7] = x*(x*(x*(x*(x*((326737249.0L/49896000.0L)*x - 384845203.0L/19404000.0L) + 455197111.0L/23284800.0L) - 89503367.0L/17463600.0L) - 8190541.0L/6468000.0L) - 18.0L/55.0L) + 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(-15623459.0L/1584000.0L*x + 12051359.0L/404250.0L) - 24996777.0L/862400.0L) + 3398939.0L/485100.0L) + 3427741.0L/2352000.0L) + 9.0L/5.0L) - 9.0L/10.0L;
-        poly_val[9] = x*(pow(x, 2)*(x*(x*((109653629.0L/9072000.0L)*x - 128296219.0L/3528000.0L) + 442116007.0L/12700800.0L) - 18943367.0L/2268000.0L) - 9778141.0L/3175200.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(-109653629.0L/9072000.0L*x + 191343373.0L/5292000.0L) - 217755137.0L/6350400.0L) + 10180259.0L/1134000.0L) - 3427741.0L/2352000.0L) + 9.0L/5.0L) + 9.0L/10.0L;
-        poly_val[11] = x*(x*(x*(x*(x*((15623459.0L/1584000.0L)*x - 379906003.0L/12936000.0L) + 48081059.0L/1724800.0L) - 31369501.0L/3880800.0L) + 8190541.0L/6468000.0L) - 18.0L/55.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(-326737249.0L/49896000.0L*x + 566312567.0L/29106000.0L) - 108321659.0L/5821200.0L) + 49820941.0L/8731800.0L) - 9072541.0L/16632000.0L) + 14.0L/165.0L) + 7.0L/55.0L;
-        poly_val[13] = x*(x*(x*(x*(x*((650812303.0L/185328000.0L)*x - 4884169.0L/468000.0L) + 54375817.0L/5405400.0L) - 101735461.0L/32432400.0L) + 9381241.0L/48048000.0L) - 63.0L/2860.0L) - 63.0L/1430.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(-216286123.0L/144144000.0L*x + 750779339.0L/168168000.0L) - 97002071.0L/22422400.0L) + 342332713.0L/252252000.0L) - 5861.0L/103488.0L) + 18.0L/3575.0L) + 9.0L/715.0L;
-        poly_val[15] = x*(x*(x*(x*(x*((46260611.0L/92664000.0L)*x - 1125304793.0L/756756000.0L) + 437719279.0L/302702400.0L) - 516063203.0L/1135134000.0L) + 9601741.0L/756756000.0L) - 2.0L/2145.0L) - 2.0L/715.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(-323440939.0L/2594592000.0L*x + 93748807.0L/252252000.0L) - 219338303.0L/605404800.0L) + 3696851.0L/32432400.0L) - 196909.0L/96096000.0L) + 9.0L/70070.0L) + 9.0L/20020.0L;
-        poly_val[17] = x*(x*(x*(x*(x*((53864479.0L/2450448000.0L)*x - 374972053.0L/5717712000.0L) + 48826629.0L/762361600.0L) - 290471.0L/14414400.0L) + 10949.0L/51744000.0L) - 9.0L/777920.0L) - 9.0L/194480.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(-3845371.0L/1575288000.0L*x + 374987663.0L/51459408000.0L) - 440056711.0L/61751289600.0L) + 2662049.0L/1187524800.0L) - 63397.0L/6054048000.0L) + 1.0L/1969110.0L) + 1.0L/437580.0L;
-        poly_val[19] = pow(x, 3)*(x*(x*((1888217.0L/14702688000.0L)*x - 19737953.0L/51459408000.0L) + 23187553.0L/61751289600.0L) - 9114251.0L/77189112000.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 3, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(-1888217.0L/2450448000.0L*x + 4978651.0L/2572970400.0L) - 11858753.0L/7718911200.0L) + 44201.0L/126126000.0L) + 63397.0L/3027024000.0L) + 1.0L/1969110.0L;
-        poly_val[1] = x*(x*(x*(x*((3845371.0L/262548000.0L)*x - 378705053.0L/10291881600.0L) + 451208881.0L/15437822400.0L) - 11393267.0L/1715313600.0L) - 10949.0L/25872000.0L) - 9.0L/777920.0L;
-        poly_val[2] = x*(x*(x*(x*(-53864479.0L/408408000.0L*x + 34466423.0L/103958400.0L) - 50212829.0L/190590400.0L) + 4865737.0L/81681600.0L) + 196909.0L/48048000.0L) + 9.0L/70070.0L;
-        poly_val[3] = x*(x*(x*(x*((323440939.0L/432432000.0L)*x - 1139100889.0L/605404800.0L) + 452791811.0L/302702400.0L) - 2074439.0L/6177600.0L) - 9601741.0L/378378000.0L) - 2.0L/2145.0L;
-        poly_val[4] = x*(x*(x*(x*(-46260611.0L/15444000.0L*x + 190244191.0L/25225200.0L) - 28367477.0L/4729725.0L) + 252001891.0L/189189000.0L) + 5861.0L/51744.0L) + 18.0L/3575.0L;
-        poly_val[5] = x*(x*(x*(x*((216286123.0L/24024000.0L)*x - 381611761.0L/16816800.0L) + 25287533.0L/1401400.0L) - 12734027.0L/3234000.0L) - 9381241.0L/24024000.0L) - 63.0L/2860.0L;
-        poly_val[6] = x*(x*(x*(x*(-650812303.0L/30888000.0L*x + 328457149.0L/6177600.0L) - 912727037.0L/21621600.0L) + 192796181.0L/21621600.0L) + 9072541.0L/8316000.0L) + 14.0L/165.0L;
-        poly_val[7] = x*(x*(x*(x*((326737249.0L/8316000.0L)*x - 384845203.0L/3880800.0L) + 455197111.0L/5821200.0L) - 89503367.0L/5821200.0L) - 8190541.0L/3234000.0L) - 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*(x*(-15623459.0L/264000.0L*x + 12051359.0L/80850.0L) - 24996777.0L/215600.0L) + 3398939.0L/161700.0L) + 3427741.0L/1176000.0L) + 9.0L/5.0L;
-        poly_val[9] = pow(x, 2)*(x*(x*((109653629.0L/1512000.0L)*x - 128296219.0L/705600.0L) + 442116007.0L/3175200.0L) - 18943367.0L/756000.0L) - 9778141.0L/3175200.0L;
-        poly_val[10] = x*(x*(x*(x*(-109653629.0L/1512000.0L*x + 191343373.0L/1058400.0L) - 217755137.0L/1587600.0L) + 10180259.0L/378000.0L) - 3427741.0L/1176000.0L) + 9.0L/5.0L;
-        poly_val[11] = x*(x*(x*(x*((15623459.0L/264000.0L)*x - 379906003.0L/2587200.0L) + 48081059.0L/431200.0L) - 31369501.0L/1293600.0L) + 8190541.0L/3234000.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*(x*(-326737249.0L/8316000.0L*x + 566312567.0L/5821200.0L) - 108321659.0L/1455300.0L) + 49820941.0L/2910600.0L) - 9072541.0L/8316000.0L) + 14.0L/165.0L;
-        poly_val[13] = x*(x*(x*(x*((650812303.0L/30888000.0L)*x - 4884169.0L/93600.0L) + 54375817.0L/1351350.0L) - 101735461.0L/10810800.0L) + 9381241.0L/24024000.0L) - 63.0L/2860.0L;
-        poly_val[14] = x*(x*(x*(x*(-216286123.0L/24024000.0L*x + 750779339.0L/33633600.0L) - 97002071.0L/5605600.0L) + 342332713.0L/84084000.0L) - 5861.0L/51744.0L) + 18.0L/3575.0L;
-        poly_val[15] = x*(x*(x*(x*((46260611.0L/15444000.0L)*x - 1125304793.0L/151351200.0L) + 437719279.0L/75675600.0L) - 516063203.0L/378378000.0L) + 9601741.0L/378378000.0L) - 2.0L/2145.0L;
-        poly_val[16] = x*(x*(x*(x*(-323440939.0L/432432000.0L*x + 93748807.0L/50450400.0L) - 219338303.0L/151351200.0L) + 3696851.0L/10810800.0L) - 196909.0L/48048000.0L) + 9.0L/70070.0L;
-        poly_val[17] = x*(x*(x*(x*((53864479.0L/408408000.0L)*x - 374972053.0L/1143542400.0L) + 48826629.0L/190590400.0L) - 290471.0L/4804800.0L) + 10949.0L/25872000.0L) - 9.0L/777920.0L;
-        poly_val[18] = x*(x*(x*(x*(-3845371.0L/262548000.0L*x + 374987663.0L/10291881600.0L) - 440056711.0L/15437822400.0L) + 2662049.0L/395841600.0L) - 63397.0L/3027024000.0L) + 1.0L/1969110.0L;
-        poly_val[19] = pow(x, 2)*(x*(x*((1888217.0L/2450448000.0L)*x - 19737953.0L/10291881600.0L) + 23187553.0L/15437822400.0L) - 9114251.0L/25729704000.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 3, 2>>(x, poly_val);
         break;
     }
 }
-void beta_n9_m4(int deriv, double x, double *poly_val) {
+
+template void beta_n9_m3<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n9_m3<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
+template <>
+struct spline_polynomials<9, 4, 0>
+{
+    static constexpr int degree = 9;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {5.911133194824449e-05, -0.001123131637444828, 0.010108383654306712, -0.057282399992717455,
+         0.22913836391415757, -0.6874516720878328, 1.604161267680365, -2.979369592562053,
+         4.469327174809318, -5.462703822025209, 5.462703822025209, -4.469327174809318,
+         2.979369592562053, -1.604161267680365, 0.6874516720878328, -0.22913836391415757,
+         0.057282399992717455, -0.010108383654306712, 0.001123131637444828, -5.911133194824449e-05},
+        {-3.644116428118918e-08, 7.583084323329032e-07, -7.513740854733502e-06, 4.7036168563946345e-05,
+         -0.00020740102783753579, 0.0006736868042671614, -0.001598398290238568, 0.002652705723142231,
+         -0.002796614100185529, 0.0012357765958749755, 0.0012357765958749755, -0.002796614100185529,
+         0.002652705723142231, -0.001598398290238568, 0.0006736868042671614, -0.00020740102783753579,
+         4.7036168563946345e-05, -7.513740854733502e-06, 7.583084323329032e-07, -3.644116428118918e-08},
+        {-7.745799656591752e-05, 0.0014718543562655861, -0.013248595391682313, 0.07509092188308458,
+         -0.30045687719100417, 0.9018068833448297, -2.105829586244517, 3.914850389763088,
+         -5.878369292413935, 7.189423855408933, -7.189423855408933, 5.878369292413935,
+         -3.914850389763088, 2.105829586244517, -0.9018068833448297, 0.30045687719100417,
+         -0.07509092188308458, 0.013248595391682313, -0.0014718543562655861, 7.745799656591752e-05},
+        {3.2250968389312616e-07, -6.778247487986244e-06, 6.812364915371743e-05, -0.0004356247900394726,
+         0.001986965488949616, -0.006840230082417582, 0.01806108876334571, -0.0340186254075143,
+         0.039757324520717376, -0.018572566404390974, -0.018572566404390974, 0.039757324520717376,
+         -0.0340186254075143, 0.01806108876334571, -0.006840230082417582, 0.001986965488949616,
+         -0.0004356247900394726, 6.812364915371743e-05, -6.778247487986244e-06, 3.2250968389312616e-07},
+        {4.252871533012756e-05, -0.000808653692084864, 0.00728561611625638, -0.04134982649900805,
+         0.16580271781239042, -0.4994349113498109, 1.174023835515372, -2.21281358905094,
+         3.3873247333024117, -4.203786227130705, 4.203786227130705, -3.3873247333024117,
+         2.21281358905094, -1.174023835515372, 0.4994349113498109, -0.16580271781239042,
+         0.04134982649900805, -0.00728561611625638, 0.000808653692084864, -4.252871533012756e-05},
+        {-1.2439041165114929e-06, 2.6315226886438444e-05, -0.000266970516763305, 0.0017314671659909755,
+         -0.008079115397939802, 0.028950966583639576, -0.08290562467287728, 0.19118587107612406,
+         -0.27422380855751394, 0.14358214299656977, 0.14358214299656977, -0.27422380855751394,
+         0.19118587107612406, -0.08290562467287728, 0.028950966583639576, -0.008079115397939802,
+         0.0017314671659909755, -0.000266970516763305, 2.6315226886438444e-05, -1.2439041165114929e-06},
+        {-1.272073795866299e-05, 0.00024254183733959803, -0.00219374359797277, 0.012523167743622853,
+         -0.05067705196772657, 0.15506292602177088, -0.3756457327836451, 0.7585829459800194,
+         -1.4435283454764483, 2.1952951295527536, -2.1952951295527536, 1.4435283454764483,
+         -0.7585829459800194, 0.3756457327836451, -0.15506292602177088, 0.05067705196772657,
+         -0.012523167743622853, 0.00219374359797277, -0.00024254183733959803, 1.272073795866299e-05},
+        {1.7064072667650905e-06, -3.621536059751689e-05, 0.00036909553382377864, -0.0024103703187749567,
+         0.011372271926339387, -0.04155672389831151, 0.1238305937507869, -0.31665296465457676,
+         0.7434685579487477, -0.5183859513347038, -0.5183859513347038, 0.7434685579487477,
+         -0.31665296465457676, 0.1238305937507869, -0.04155672389831151, 0.011372271926339387,
+         -0.0024103703187749567, 0.00036909553382377864, -3.621536059751689e-05, 1.7064072667650905e-06},
+        {1.5015173374524058e-06, -2.8705094937476426e-05, 0.0002606083215725693, -0.0014959640591693543,
+         0.006106160100727003, -0.01895642400424941, 0.047172275809394676, -0.10087626204842381,
+         0.22356550145508014, -1.377083204128498, 1.377083204128498, -0.22356550145508014,
+         0.10087626204842381, -0.047172275809394676, 0.01895642400424941, -0.006106160100727003,
+         0.0014959640591693543, -0.0002606083215725693, 2.8705094937476426e-05, -1.5015173374524058e-06},
+        {-3.53754674922161e-07, 7.512086443662804e-06, -7.662330762605113e-05, 0.000500998784130217,
+         -0.002368359444713456, 0.00868399256905901, -0.026052007664247926, 0.06773530311164783,
+         -0.16933843537414967, 0.6209079729941313, 0.6209079729941313, -0.16933843537414967,
+         0.06773530311164783, -0.026052007664247926, 0.00868399256905901, -0.002368359444713456,
+         0.000500998784130217, -7.662330762605113e-05, 7.512086443662804e-06, -3.53754674922161e-07}};
+};
+constexpr double spline_polynomials<9, 4, 0>::coefficients[10][20];
+
+template <>
+struct spline_polynomials<9, 4, 1>
+{
+    static constexpr int degree = 8;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.0005320019875342004, -0.010108184737003452, 0.0909754528887604, -0.515541599934457,
+         2.062245275227418, -6.187065048790495, 14.437451409123284, -26.814326333058474,
+         40.22394457328386, -49.164334398226885, 49.164334398226885, -40.22394457328386,
+         26.814326333058474, -14.437451409123284, 6.187065048790495, -2.062245275227418,
+         0.515541599934457, -0.0909754528887604, 0.010108184737003452, -0.0005320019875342004},
+        {-2.915293142495134e-07, 6.066467458663226e-06, -6.010992683786801e-05, 0.00037628934851157076,
+         -0.0016592082227002863, 0.005389494434137291, -0.012787186321908544, 0.021221645785137848,
+         -0.02237291280148423, 0.009886212766999804, 0.009886212766999804, -0.02237291280148423,
+         0.021221645785137848, -0.012787186321908544, 0.005389494434137291, -0.0016592082227002863,
+         0.00037628934851157076, -6.010992683786801e-05, 6.066467458663226e-06, -2.915293142495134e-07},
+        {-0.0005422059759614226, 0.010302980493859103, -0.0927401677417762, 0.525636453181592,
+         -2.103198140337029, 6.312648183413809, -14.740807103711617, 27.40395272834162,
+         -41.148585046897544, 50.32596698786253, -50.32596698786253, 41.148585046897544,
+         -27.40395272834162, 14.740807103711617, -6.312648183413809, 2.103198140337029,
+         -0.525636453181592, 0.0927401677417762, -0.010302980493859103, 0.0005422059759614226},
+        {1.935058103358757e-06, -4.066948492791747e-05, 0.00040874189492230456, -0.0026137487402368353,
+         0.011921792933697696, -0.041041380494505494, 0.10836653258007424, -0.20411175244508578,
+         0.23854394712430427, -0.11143539842634585, -0.11143539842634585, 0.23854394712430427,
+         -0.20411175244508578, 0.10836653258007424, -0.041041380494505494, 0.011921792933697696,
+         -0.0026137487402368353, 0.00040874189492230456, -4.066948492791747e-05, 1.935058103358757e-06},
+        {0.00021264357665063782, -0.00404326846042432, 0.0364280805812819, -0.20674913249504023,
+         0.8290135890619521, -2.4971745567490546, 5.87011917757686, -11.0640679452547,
+         16.93662366651206, -21.018931135653528, 21.018931135653528, -16.93662366651206,
+         11.0640679452547, -5.87011917757686, 2.4971745567490546, -0.8290135890619521,
+         0.20674913249504023, -0.0364280805812819, 0.00404326846042432, -0.00021264357665063782},
+        {-4.9756164660459715e-06, 0.00010526090754575378, -0.00106788206705322, 0.006925868663963902,
+         -0.03231646159175921, 0.1158038663345583, -0.3316224986915091, 0.7647434843044962,
+         -1.0968952342300557, 0.5743285719862791, 0.5743285719862791, -1.0968952342300557,
+         0.7647434843044962, -0.3316224986915091, 0.1158038663345583, -0.03231646159175921,
+         0.006925868663963902, -0.00106788206705322, 0.00010526090754575378, -4.9756164660459715e-06},
+        {-3.816221387598897e-05, 0.0007276255120187941, -0.00658123079391831, 0.03756950323086856,
+         -0.1520311559031797, 0.46518877806531267, -1.1269371983509353, 2.2757488379400583,
+         -4.330585036429344, 6.5858853886582605, -6.5858853886582605, 4.330585036429344,
+         -2.2757488379400583, 1.1269371983509353, -0.46518877806531267, 0.1520311559031797,
+         -0.03756950323086856, 0.00658123079391831, -0.0007276255120187941, 3.816221387598897e-05},
+        {3.412814533530181e-06, -7.243072119503378e-05, 0.0007381910676475573, -0.0048207406375499135,
+         0.022744543852678774, -0.08311344779662302, 0.2476611875015738, -0.6333059293091535,
+         1.4869371158974953, -1.0367719026694076, -1.0367719026694076, 1.4869371158974953,
+         -0.6333059293091535, 0.2476611875015738, -0.08311344779662302, 0.022744543852678774,
+         -0.0048207406375499135, 0.0007381910676475573, -7.243072119503378e-05, 3.412814533530181e-06},
+        {1.5015173374524058e-06, -2.8705094937476426e-05, 0.0002606083215725693, -0.0014959640591693543,
+         0.006106160100727003, -0.01895642400424941, 0.047172275809394676, -0.10087626204842381,
+         0.22356550145508014, -1.377083204128498, 1.377083204128498, -0.22356550145508014,
+         0.10087626204842381, -0.047172275809394676, 0.01895642400424941, -0.006106160100727003,
+         0.0014959640591693543, -0.0002606083215725693, 2.8705094937476426e-05, -1.5015173374524058e-06}};
+};
+constexpr double spline_polynomials<9, 4, 1>::coefficients[9][20];
+
+template <>
+struct spline_polynomials<9, 4, 2>
+{
+    static constexpr int degree = 7;
+    static constexpr int nb_values = 20;
+    static constexpr double coefficients[degree+1][nb_values] = {
+        {0.004256015900273603, -0.08086547789602762, 0.7278036231100832, -4.124332799475656,
+         16.497962201819345, -49.49652039032396, 115.49961127298627, -214.5146106644678,
+         321.7915565862709, -393.3146751858151, 393.3146751858151, -321.7915565862709,
+         214.5146106644678, -115.49961127298627, 49.49652039032396, -16.497962201819345,
+         4.124332799475656, -0.7278036231100832, 0.08086547789602762, -0.004256015900273603},
+        {-2.040705199746594e-06, 4.2465272210642584e-05, -0.0004207694878650761, 0.002634025439580995,
+         -0.011614457558902003, 0.03772646103896104, -0.0895103042533598, 0.14855152049596493,
+         -0.15661038961038962, 0.06920348936899863, 0.06920348936899863, -0.15661038961038962,
+         0.14855152049596493, -0.0895103042533598, 0.03772646103896104, -0.011614457558902003,
+         0.002634025439580995, -0.0004207694878650761, 4.2465272210642584e-05, -2.040705199746594e-06},
+        {-0.0032532358557685356, 0.061817882963154616, -0.5564410064506572, 3.1538187190895526,
+         -12.619188842022176, 37.87588910048285, -88.4448426222697, 164.4237163700497,
+         -246.89151028138528, 301.9558019271752, -301.9558019271752, 246.89151028138528,
+         -164.4237163700497, 88.4448426222697, -37.87588910048285, 12.619188842022176,
+         -3.1538187190895526, 0.5564410064506572, -0.061817882963154616, 0.0032532358557685356},
+        {9.675290516793784e-06, -0.00020334742463958734, 0.0020437094746115227, -0.013068743701184177,
+         0.05960896466848848, -0.20520690247252749, 0.5418326629003712, -1.0205587622254289,
+         1.1927197356215213, -0.5571769921317292, -0.5571769921317292, 1.1927197356215213,
+         -1.0205587622254289, 0.5418326629003712, -0.20520690247252749, 0.05960896466848848,
+         -0.013068743701184177, 0.0020437094746115227, -0.00020334742463958734, 9.675290516793784e-06},
+        {0.0008505743066025513, -0.01617307384169728, 0.1457123223251276, -0.8269965299801609,
+         3.3160543562478084, -9.988698226996219, 23.48047671030744, -44.2562717810188,
+         67.74649466604824, -84.07572454261411, 84.07572454261411, -67.74649466604824,
+         44.2562717810188, -23.48047671030744, 9.988698226996219, -3.3160543562478084,
+         0.8269965299801609, -0.1457123223251276, 0.01617307384169728, -0.0008505743066025513},
+        {-1.4926849398137913e-05, 0.0003157827226372613, -0.0032036462011596598, 0.020777605991891705,
+         -0.09694938477527763, 0.3474115990036749, -0.9948674960745273, 2.2942304529134887,
+         -3.290685702690167, 1.7229857159588373, 1.7229857159588373, -3.290685702690167,
+         2.2942304529134887, -0.9948674960745273, 0.3474115990036749, -0.09694938477527763,
+         0.020777605991891705, -0.0032036462011596598, 0.0003157827226372613, -1.4926849398137913e-05},
+        {-7.632442775197795e-05, 0.0014552510240375882, -0.01316246158783662, 0.07513900646173712,
+         -0.3040623118063594, 0.9303775561306253, -2.2538743967018706, 4.551497675880117,
+         -8.661170072858688, 13.171770777316521, -13.171770777316521, 8.661170072858688,
+         -4.551497675880117, 2.2538743967018706, -0.9303775561306253, 0.3040623118063594,
+         -0.07513900646173712, 0.01316246158783662, -0.0014552510240375882, 7.632442775197795e-05},
+        {3.412814533530181e-06, -7.243072119503378e-05, 0.0007381910676475573, -0.0048207406375499135,
+         0.022744543852678774, -0.08311344779662302, 0.2476611875015738, -0.6333059293091535,
+         1.4869371158974953, -1.0367719026694076, -1.0367719026694076, 1.4869371158974953,
+         -0.6333059293091535, 0.2476611875015738, -0.08311344779662302, 0.022744543852678774,
+         -0.0048207406375499135, 0.0007381910676475573, -7.243072119503378e-05, 3.412814533530181e-06}};
+};
+constexpr double spline_polynomials<9, 4, 2>::coefficients[8][20];
+
+template <class real_number>
+void beta_n9_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val)
+{
     switch(deriv)
     {
     case 0:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*(x*((41064761.0L/694702008000.0L)*x - 739266961.0L/2778808032000.0L) + 19438393.0L/42750892800.0L) - 252257.0L/721768320.0L) + 1645439.0L/16345929600.0L) - 63397.0L/163459296000.0L) + 63397.0L/18162144000.0L) + 1.0L/3938220.0L) - 1.0L/437580.0L);
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(x*(-24967737721.0L/22230464256000.0L*x + 112371677293.0L/22230464256000.0L) - 32009510671.0L/3705077376000.0L) + 73804272761.0L/11115232128000.0L) - 2040029.0L/1067489280.0L) + 10949.0L/1241856000.0L) - 10949.0L/155232000.0L) - 9.0L/1555840.0L) + 9.0L/194480.0L);
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*(x*((2774247673.0L/274450176000.0L)*x - 346838241.0L/7623616000.0L) + 27714803.0L/356428800.0L) - 4099765343.0L/68612544000.0L) + 1571889307.0L/91483392000.0L) - 196909.0L/2018016000.0L) + 196909.0L/288288000.0L) + 9.0L/140140.0L) - 9.0L/20020.0L);
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(x*(-390139199.0L/6810804000.0L*x + 14047573997.0L/54486432000.0L) - 3429833893.0L/7783776000.0L) + 67075889.0L/198132480.0L) - 58224899.0L/598752000.0L) + 9601741.0L/13621608000.0L) - 9601741.0L/2270268000.0L) - 1.0L/2145.0L) + 2.0L/715.0L);
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*(x*((3121232971.0L/13621608000.0L)*x - 2809674701.0L/2724321600.0L) + 8003230493.0L/4540536000.0L) - 4610296543.0L/3405402000.0L) + 5290082767.0L/13621608000.0L) - 5861.0L/1552320.0L) + 5861.0L/310464.0L) + 9.0L/3575.0L) - 9.0L/715.0L);
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(x*(-2774576947.0L/4036032000.0L*x + 1387590587.0L/448448000.0L) - 2134234717.0L/403603200.0L) + 234077981.0L/57657600.0L) - 62576029.0L/53813760.0L) + 9381241.0L/576576000.0L) - 9381241.0L/144144000.0L) - 63.0L/5720.0L) + 63.0L/1430.0L);
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*(x*((3567551993.0L/2223936000.0L)*x - 1003596169.0L/138996000.0L) + 96036348283.0L/7783776000.0L) - 119617651.0L/12636000.0L) + 8431990223.0L/3113510400.0L) - 9072541.0L/149688000.0L) + 9072541.0L/49896000.0L) + 7.0L/165.0L) - 7.0L/55.0L);
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(x*(-3121831129.0L/1047816000.0L*x + 3512754907.0L/261954000.0L) - 29097643.0L/1270080.0L) + 2629412623.0L/149688000.0L) - 2639918789.0L/523908000.0L) + 8190541.0L/38808000.0L) - 8190541.0L/19404000.0L) - 9.0L/55.0L) + 18.0L/55.0L);
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*(x*((173445649.0L/38808000.0L)*x - 173469767.0L/8624000.0L) + 2666634419.0L/77616000.0L) - 204389797.0L/7761600.0L) + 7042859.0L/924000.0L) - 3427741.0L/7056000.0L) + 3427741.0L/7056000.0L) + 9.0L/10.0L) - 9.0L/10.0L);
-        poly_val[9] = pow(x, 2)*(pow(x, 2)*(x*(x*(x*(x*(-24977055133.0L/4572288000.0L*x + 4496095937.0L/182891520.0L) - 13710284363.0L/326592000.0L) + 73580652293.0L/2286144000.0L) - 43121414201.0L/4572288000.0L) + 117868837.0L/182891520.0L) - 9778141.0L/6350400.0L) + 1;
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*(x*((24977055133.0L/4572288000.0L)*x - 28097774443.0L/1143072000.0L) + 913803707.0L/21772800.0L) - 7362601913.0L/228614400.0L) + 1244337839.0L/130636800.0L) - 3427741.0L/7056000.0L) - 3427741.0L/7056000.0L) + 9.0L/10.0L) + 9.0L/10.0L);
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(x*(-173445649.0L/38808000.0L*x + 173421531.0L/8624000.0L) - 2664897923.0L/77616000.0L) + 186093701.0L/7056000.0L) - 40471741.0L/5174400.0L) + 8190541.0L/38808000.0L) + 8190541.0L/19404000.0L) - 9.0L/55.0L) - 18.0L/55.0L);
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*(x*((3121831129.0L/1047816000.0L)*x - 14045460533.0L/1047816000.0L) + 4796663819.0L/209563200.0L) - 41156842.0L/2338875.0L) + 5454795473.0L/1047816000.0L) - 9072541.0L/149688000.0L) - 9072541.0L/49896000.0L) + 7.0L/165.0L) + 7.0L/55.0L);
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(x*(-3567551993.0L/2223936000.0L*x + 16050429233.0L/2223936000.0L) - 223628941.0L/18144000.0L) + 2108327369.0L/222393600.0L) - 43498588667.0L/15567552000.0L) + 9381241.0L/576576000.0L) + 9381241.0L/144144000.0L) - 63.0L/5720.0L) - 63.0L/1430.0L);
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*(x*((2774576947.0L/4036032000.0L)*x - 34674659.0L/11211200.0L) + 10660297499.0L/2018016000.0L) - 26627609.0L/6552000.0L) + 1606926733.0L/1345344000.0L) - 5861.0L/1552320.0L) - 5861.0L/310464.0L) + 9.0L/3575.0L) + 9.0L/715.0L);
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(x*(-3121232971.0L/13621608000.0L*x + 7021361617.0L/6810804000.0L) - 4797418079.0L/2724321600.0L) + 3691153121.0L/2724321600.0L) - 38663749.0L/97297200.0L) + 9601741.0L/13621608000.0L) + 9601741.0L/2270268000.0L) - 1.0L/2145.0L) - 2.0L/715.0L);
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*(x*((390139199.0L/6810804000.0L)*x - 14042448331.0L/54486432000.0L) + 1142301647.0L/2594592000.0L) - 9228730547.0L/27243216000.0L) + 41576923.0L/419126400.0L) - 196909.0L/2018016000.0L) - 196909.0L/288288000.0L) + 9.0L/140140.0L) + 9.0L/20020.0L);
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(x*(-2774247673.0L/274450176000.0L*x + 1386894709.0L/30494464000.0L) - 304627159.0L/3920716800.0L) + 745799291.0L/12475008000.0L) - 1920359.0L/109824000.0L) + 10949.0L/1241856000.0L) + 10949.0L/155232000.0L) - 9.0L/1555840.0L) - 9.0L/194480.0L);
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*(x*((24967737721.0L/22230464256000.0L)*x - 28084490549.0L/5557616064000.0L) + 8723736529.0L/1010475648000.0L) - 7383695351.0L/1111523212800.0L) + 2538335281.0L/1307674368000.0L) - 63397.0L/163459296000.0L) - 63397.0L/18162144000.0L) + 1.0L/3938220.0L) + 1.0L/437580.0L);
-        poly_val[19] = pow(x, 5)*(x*(x*(x*(-41064761.0L/694702008000.0L*x + 147812887.0L/555761606400.0L) - 420895147.0L/926269344000.0L) + 138794879.0L/396972576000.0L) - 283684103.0L/2778808032000.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 4, 0>>(x, poly_val);
         break;
     case 1:
-        poly_val[0] = x*(x*(x*(x*(x*(x*(x*((41064761.0L/77189112000.0L)*x - 739266961.0L/347351004000.0L) + 19438393.0L/6107270400.0L) - 252257.0L/120294720.0L) + 1645439.0L/3269185920.0L) - 63397.0L/40864824000.0L) + 63397.0L/6054048000.0L) + 1.0L/1969110.0L) - 1.0L/437580.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(x*(-24967737721.0L/2470051584000.0L*x + 112371677293.0L/2778808032000.0L) - 32009510671.0L/529296768000.0L) + 73804272761.0L/1852538688000.0L) - 2040029.0L/213497856.0L) + 10949.0L/310464000.0L) - 10949.0L/51744000.0L) - 9.0L/777920.0L) + 9.0L/194480.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*(x*((2774247673.0L/30494464000.0L)*x - 346838241.0L/952952000.0L) + 27714803.0L/50918400.0L) - 4099765343.0L/11435424000.0L) + 1571889307.0L/18296678400.0L) - 196909.0L/504504000.0L) + 196909.0L/96096000.0L) + 9.0L/70070.0L) - 9.0L/20020.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(x*(-390139199.0L/756756000.0L*x + 14047573997.0L/6810804000.0L) - 3429833893.0L/1111968000.0L) + 67075889.0L/33022080.0L) - 58224899.0L/119750400.0L) + 9601741.0L/3405402000.0L) - 9601741.0L/756756000.0L) - 2.0L/2145.0L) + 2.0L/715.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*(x*((3121232971.0L/1513512000.0L)*x - 2809674701.0L/340540200.0L) + 8003230493.0L/648648000.0L) - 4610296543.0L/567567000.0L) + 5290082767.0L/2724321600.0L) - 5861.0L/388080.0L) + 5861.0L/103488.0L) + 18.0L/3575.0L) - 9.0L/715.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(x*(-2774576947.0L/448448000.0L*x + 1387590587.0L/56056000.0L) - 2134234717.0L/57657600.0L) + 234077981.0L/9609600.0L) - 62576029.0L/10762752.0L) + 9381241.0L/144144000.0L) - 9381241.0L/48048000.0L) - 63.0L/2860.0L) + 63.0L/1430.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*(x*((3567551993.0L/247104000.0L)*x - 1003596169.0L/17374500.0L) + 96036348283.0L/1111968000.0L) - 119617651.0L/2106000.0L) + 8431990223.0L/622702080.0L) - 9072541.0L/37422000.0L) + 9072541.0L/16632000.0L) + 14.0L/165.0L) - 7.0L/55.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(x*(-3121831129.0L/116424000.0L*x + 3512754907.0L/32744250.0L) - 29097643.0L/181440.0L) + 2629412623.0L/24948000.0L) - 2639918789.0L/104781600.0L) + 8190541.0L/9702000.0L) - 8190541.0L/6468000.0L) - 18.0L/55.0L) + 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*(x*((173445649.0L/4312000.0L)*x - 173469767.0L/1078000.0L) + 2666634419.0L/11088000.0L) - 204389797.0L/1293600.0L) + 7042859.0L/184800.0L) - 3427741.0L/1764000.0L) + 3427741.0L/2352000.0L) + 9.0L/5.0L) - 9.0L/10.0L;
-        poly_val[9] = x*(pow(x, 2)*(x*(x*(x*(x*(-24977055133.0L/508032000.0L*x + 4496095937.0L/22861440.0L) - 13710284363.0L/46656000.0L) + 73580652293.0L/381024000.0L) - 43121414201.0L/914457600.0L) + 117868837.0L/45722880.0L) - 9778141.0L/3175200.0L);
-        poly_val[10] = x*(x*(x*(x*(x*(x*(x*((24977055133.0L/508032000.0L)*x - 28097774443.0L/142884000.0L) + 913803707.0L/3110400.0L) - 7362601913.0L/38102400.0L) + 1244337839.0L/26127360.0L) - 3427741.0L/1764000.0L) - 3427741.0L/2352000.0L) + 9.0L/5.0L) + 9.0L/10.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(x*(-173445649.0L/4312000.0L*x + 173421531.0L/1078000.0L) - 2664897923.0L/11088000.0L) + 186093701.0L/1176000.0L) - 40471741.0L/1034880.0L) + 8190541.0L/9702000.0L) + 8190541.0L/6468000.0L) - 18.0L/55.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*(x*((3121831129.0L/116424000.0L)*x - 14045460533.0L/130977000.0L) + 4796663819.0L/29937600.0L) - 82313684.0L/779625.0L) + 5454795473.0L/209563200.0L) - 9072541.0L/37422000.0L) - 9072541.0L/16632000.0L) + 14.0L/165.0L) + 7.0L/55.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(x*(-3567551993.0L/247104000.0L*x + 16050429233.0L/277992000.0L) - 223628941.0L/2592000.0L) + 2108327369.0L/37065600.0L) - 43498588667.0L/3113510400.0L) + 9381241.0L/144144000.0L) + 9381241.0L/48048000.0L) - 63.0L/2860.0L) - 63.0L/1430.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*(x*((2774576947.0L/448448000.0L)*x - 34674659.0L/1401400.0L) + 10660297499.0L/288288000.0L) - 26627609.0L/1092000.0L) + 1606926733.0L/269068800.0L) - 5861.0L/388080.0L) - 5861.0L/103488.0L) + 18.0L/3575.0L) + 9.0L/715.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(x*(-3121232971.0L/1513512000.0L*x + 7021361617.0L/851350500.0L) - 4797418079.0L/389188800.0L) + 3691153121.0L/454053600.0L) - 38663749.0L/19459440.0L) + 9601741.0L/3405402000.0L) + 9601741.0L/756756000.0L) - 2.0L/2145.0L) - 2.0L/715.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*(x*((390139199.0L/756756000.0L)*x - 14042448331.0L/6810804000.0L) + 1142301647.0L/370656000.0L) - 9228730547.0L/4540536000.0L) + 41576923.0L/83825280.0L) - 196909.0L/504504000.0L) - 196909.0L/96096000.0L) + 9.0L/70070.0L) + 9.0L/20020.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(x*(-2774247673.0L/30494464000.0L*x + 1386894709.0L/3811808000.0L) - 304627159.0L/560102400.0L) + 745799291.0L/2079168000.0L) - 1920359.0L/21964800.0L) + 10949.0L/310464000.0L) + 10949.0L/51744000.0L) - 9.0L/777920.0L) - 9.0L/194480.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*(x*((24967737721.0L/2470051584000.0L)*x - 28084490549.0L/694702008000.0L) + 8723736529.0L/144353664000.0L) - 7383695351.0L/185253868800.0L) + 2538335281.0L/261534873600.0L) - 63397.0L/40864824000.0L) - 63397.0L/6054048000.0L) + 1.0L/1969110.0L) + 1.0L/437580.0L;
-        poly_val[19] = pow(x, 4)*(x*(x*(x*(-41064761.0L/77189112000.0L*x + 147812887.0L/69470200800.0L) - 420895147.0L/132324192000.0L) + 138794879.0L/66162096000.0L) - 283684103.0L/555761606400.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 4, 1>>(x, poly_val);
         break;
     case 2:
-        poly_val[0] = x*(x*(x*(x*(x*(x*((41064761.0L/9648639000.0L)*x - 739266961.0L/49621572000.0L) + 19438393.0L/1017878400.0L) - 252257.0L/24058944.0L) + 1645439.0L/817296480.0L) - 63397.0L/13621608000.0L) + 63397.0L/3027024000.0L) + 1.0L/1969110.0L;
-        poly_val[1] = x*(x*(x*(x*(x*(x*(-24967737721.0L/308756448000.0L*x + 112371677293.0L/396972576000.0L) - 32009510671.0L/88216128000.0L) + 73804272761.0L/370507737600.0L) - 2040029.0L/53374464.0L) + 10949.0L/103488000.0L) - 10949.0L/25872000.0L) - 9.0L/777920.0L;
-        poly_val[2] = x*(x*(x*(x*(x*(x*((2774247673.0L/3811808000.0L)*x - 346838241.0L/136136000.0L) + 27714803.0L/8486400.0L) - 4099765343.0L/2287084800.0L) + 1571889307.0L/4574169600.0L) - 196909.0L/168168000.0L) + 196909.0L/48048000.0L) + 9.0L/70070.0L;
-        poly_val[3] = x*(x*(x*(x*(x*(x*(-390139199.0L/94594500.0L*x + 14047573997.0L/972972000.0L) - 3429833893.0L/185328000.0L) + 67075889.0L/6604416.0L) - 58224899.0L/29937600.0L) + 9601741.0L/1135134000.0L) - 9601741.0L/378378000.0L) - 2.0L/2145.0L;
-        poly_val[4] = x*(x*(x*(x*(x*(x*((3121232971.0L/189189000.0L)*x - 2809674701.0L/48648600.0L) + 8003230493.0L/108108000.0L) - 4610296543.0L/113513400.0L) + 5290082767.0L/681080400.0L) - 5861.0L/129360.0L) + 5861.0L/51744.0L) + 18.0L/3575.0L;
-        poly_val[5] = x*(x*(x*(x*(x*(x*(-2774576947.0L/56056000.0L*x + 1387590587.0L/8008000.0L) - 2134234717.0L/9609600.0L) + 234077981.0L/1921920.0L) - 62576029.0L/2690688.0L) + 9381241.0L/48048000.0L) - 9381241.0L/24024000.0L) - 63.0L/2860.0L;
-        poly_val[6] = x*(x*(x*(x*(x*(x*((3567551993.0L/30888000.0L)*x - 7025173183.0L/17374500.0L) + 96036348283.0L/185328000.0L) - 119617651.0L/421200.0L) + 8431990223.0L/155675520.0L) - 9072541.0L/12474000.0L) + 9072541.0L/8316000.0L) + 14.0L/165.0L;
-        poly_val[7] = x*(x*(x*(x*(x*(x*(-3121831129.0L/14553000.0L*x + 3512754907.0L/4677750.0L) - 29097643.0L/30240.0L) + 2629412623.0L/4989600.0L) - 2639918789.0L/26195400.0L) + 8190541.0L/3234000.0L) - 8190541.0L/3234000.0L) - 18.0L/55.0L;
-        poly_val[8] = x*(x*(x*(x*(x*(x*((173445649.0L/539000.0L)*x - 173469767.0L/154000.0L) + 2666634419.0L/1848000.0L) - 204389797.0L/258720.0L) + 7042859.0L/46200.0L) - 3427741.0L/588000.0L) + 3427741.0L/1176000.0L) + 9.0L/5.0L;
-        poly_val[9] = pow(x, 2)*(x*(x*(x*(x*(-24977055133.0L/63504000.0L*x + 4496095937.0L/3265920.0L) - 13710284363.0L/7776000.0L) + 73580652293.0L/76204800.0L) - 43121414201.0L/228614400.0L) + 117868837.0L/15240960.0L) - 9778141.0L/3175200.0L;
-        poly_val[10] = x*(x*(x*(x*(x*(x*((24977055133.0L/63504000.0L)*x - 28097774443.0L/20412000.0L) + 913803707.0L/518400.0L) - 7362601913.0L/7620480.0L) + 1244337839.0L/6531840.0L) - 3427741.0L/588000.0L) - 3427741.0L/1176000.0L) + 9.0L/5.0L;
-        poly_val[11] = x*(x*(x*(x*(x*(x*(-173445649.0L/539000.0L*x + 173421531.0L/154000.0L) - 2664897923.0L/1848000.0L) + 186093701.0L/235200.0L) - 40471741.0L/258720.0L) + 8190541.0L/3234000.0L) + 8190541.0L/3234000.0L) - 18.0L/55.0L;
-        poly_val[12] = x*(x*(x*(x*(x*(x*((3121831129.0L/14553000.0L)*x - 14045460533.0L/18711000.0L) + 4796663819.0L/4989600.0L) - 82313684.0L/155925.0L) + 5454795473.0L/52390800.0L) - 9072541.0L/12474000.0L) - 9072541.0L/8316000.0L) + 14.0L/165.0L;
-        poly_val[13] = x*(x*(x*(x*(x*(x*(-3567551993.0L/30888000.0L*x + 112353004631.0L/277992000.0L) - 223628941.0L/432000.0L) + 2108327369.0L/7413120.0L) - 43498588667.0L/778377600.0L) + 9381241.0L/48048000.0L) + 9381241.0L/24024000.0L) - 63.0L/2860.0L;
-        poly_val[14] = x*(x*(x*(x*(x*(x*((2774576947.0L/56056000.0L)*x - 34674659.0L/200200.0L) + 10660297499.0L/48048000.0L) - 26627609.0L/218400.0L) + 1606926733.0L/67267200.0L) - 5861.0L/129360.0L) - 5861.0L/51744.0L) + 18.0L/3575.0L;
-        poly_val[15] = x*(x*(x*(x*(x*(x*(-3121232971.0L/189189000.0L*x + 7021361617.0L/121621500.0L) - 4797418079.0L/64864800.0L) + 3691153121.0L/90810720.0L) - 38663749.0L/4864860.0L) + 9601741.0L/1135134000.0L) + 9601741.0L/378378000.0L) - 2.0L/2145.0L;
-        poly_val[16] = x*(x*(x*(x*(x*(x*((390139199.0L/94594500.0L)*x - 14042448331.0L/972972000.0L) + 1142301647.0L/61776000.0L) - 9228730547.0L/908107200.0L) + 41576923.0L/20956320.0L) - 196909.0L/168168000.0L) - 196909.0L/48048000.0L) + 9.0L/70070.0L;
-        poly_val[17] = x*(x*(x*(x*(x*(x*(-2774247673.0L/3811808000.0L*x + 1386894709.0L/544544000.0L) - 304627159.0L/93350400.0L) + 745799291.0L/415833600.0L) - 1920359.0L/5491200.0L) + 10949.0L/103488000.0L) + 10949.0L/25872000.0L) - 9.0L/777920.0L;
-        poly_val[18] = x*(x*(x*(x*(x*(x*((24967737721.0L/308756448000.0L)*x - 28084490549.0L/99243144000.0L) + 8723736529.0L/24058944000.0L) - 7383695351.0L/37050773760.0L) + 2538335281.0L/65383718400.0L) - 63397.0L/13621608000.0L) - 63397.0L/3027024000.0L) + 1.0L/1969110.0L;
-        poly_val[19] = pow(x, 3)*(x*(x*(x*(-41064761.0L/9648639000.0L*x + 147812887.0L/9924314400.0L) - 420895147.0L/22054032000.0L) + 138794879.0L/13232419200.0L) - 283684103.0L/138940401600.0L);
+        evaluate_beta_polynomials<spline_polynomials<9, 4, 2>>(x, poly_val);
         break;
     }
 }
+
+template void beta_n9_m4<float>(const int deriv, const float x, float *__restrict__ poly_val);
+template void beta_n9_m4<double>(const int deriv, const double x, double *__restrict__ poly_val);
+
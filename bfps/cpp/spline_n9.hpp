@@ -28,11 +28,16 @@
 
 #define SPLINE_N9
 
-void beta_n9_m0(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n9_m1(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n9_m2(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n9_m3(const int deriv, const double x, double *__restrict__ poly_val);
-void beta_n9_m4(const int deriv, const double x, double *__restrict__ poly_val);
+template <class real_number>
+void beta_n9_m0(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n9_m1(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n9_m2(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n9_m3(const int deriv, const real_number x, real_number *__restrict__ poly_val);
+template <class real_number>
+void beta_n9_m4(const int deriv, const real_number x, real_number *__restrict__ poly_val);
 
 #endif//SPLINE_N9
 
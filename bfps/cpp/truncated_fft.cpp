@@ -0,0 +1,375 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <algorithm>
+#include <cassert>
+#include "base.hpp"
+#include "omputils.hpp"
+#include "truncated_fft.hpp"
+#include "scope_timer.hpp"
+
+template <typename rnumber>
+truncated_fft<rnumber>::truncated_fft(
+        const int NX,
+        const int NY,
+        const int NZ,
+        const int howmany,
+        const MPI_Comm COMM_TO_USE,
+        const unsigned FFTW_PLAN_RIGOR,
+        const double DKX,
+        const double DKY,
+        const double KM2)
+{
+    TIMEZONE("truncated_fft::truncated_fft");
+    this->nx = NX;
+    this->ny = NY;
+    this->nz = NZ;
+    this->nxc = NX/2+1;
+    this->ncomp = howmany;
+    this->comm = COMM_TO_USE;
+    MPI_Comm_size(this->comm, &this->nprocs);
+    MPI_Comm_rank(this->comm, &this->myrank);
+    this->dkx = DKX;
+    this->dky = DKY;
+    this->kM2 = KM2;
+
+    /* same distribution as the FFTW-MPI transposed transforms */
+    ptrdiff_t nfftw[3];
+    nfftw[0] = NZ;
+    nfftw[1] = NY;
+    nfftw[2] = NX;
+    ptrdiff_t local_n0, local_0_start;
+    ptrdiff_t local_n1, local_1_start;
+    fftw_mpi_local_size_many_transposed(
+            3, nfftw, howmany,
+            FFTW_MPI_DEFAULT_BLOCK, FFTW_MPI_DEFAULT_BLOCK, this->comm,
+            &local_n0, &local_0_start,
+            &local_n1, &local_1_start);
+    int local_extents[4] = {int(local_n0), int(local_0_start),
+                            int(local_n1), int(local_1_start)};
+    std::vector<int> all_extents(4*this->nprocs);
+    MPI_Allgather(local_extents, 4, MPI_INT,
+                  &all_extents.front(), 4, MPI_INT,
+                  this->comm);
+    this->z_size.resize(this->nprocs);
+    this->z_start.resize(this->nprocs);
+    this->ky_size.resize(this->nprocs);
+    this->ky_start.resize(this->nprocs);
+    for (int p=0; p<this->nprocs; p++)
+    {
+        this->z_size[p] = all_extents[4*p+0];
+        this->z_start[p] = all_extents[4*p+1];
+        this->ky_size[p] = all_extents[4*p+2];
+        this->ky_start[p] = all_extents[4*p+3];
+    }
+
+    /* band of kept lines, with the same kx and ky values as `kspace` */
+    this->line_size.resize(this->ny);
+    this->max_line_size = 0;
+    for (int iy=0; iy<this->ny; iy++)
+    {
+        const double ky = this->dky*((iy <= this->ny/2) ? iy : iy - this->ny);
+        ptrdiff_t nn = 0;
+        while (nn < this->nxc &&
+               (nn*this->dkx)*(nn*this->dkx) + ky*ky <= this->kM2)
+            nn++;
+        this->line_size[iy] = nn;
+        this->max_line_size = std::max(this->max_line_size, nn);
+    }
+    this->line_offset.resize(this->ny);
+    this->nlines.resize(this->nprocs);
+    for (int p=0; p<this->nprocs; p++)
+    {
+        this->nlines[p] = 0;
+        for (ptrdiff_t iy = this->ky_start[p]; iy < this->ky_start[p] + this->ky_size[p]; iy++)
+        {
+            this->line_offset[iy] = this->nlines[p];
+            this->nlines[p] += this->line_size[iy];
+        }
+    }
+
+    /* exchange pattern */
+    this->send_count.resize(this->nprocs);
+    this->send_displ.resize(this->nprocs);
+    this->recv_count.resize(this->nprocs);
+    this->recv_displ.resize(this->nprocs);
+    for (int p=0; p<this->nprocs; p++)
+    {
+        this->send_count[p] = local_n0*this->nlines[p]*this->ncomp;
+        this->recv_count[p] = this->z_size[p]*this->nlines[this->myrank]*this->ncomp;
+        this->send_displ[p] = (p == 0) ? 0 : this->send_displ[p-1] + this->send_count[p-1];
+        this->recv_displ[p] = (p == 0) ? 0 : this->recv_displ[p-1] + this->recv_count[p-1];
+    }
+    this->buffer0 = fftw_interface<rnumber>::alloc_complex(std::max(
+            this->send_displ[this->nprocs-1] + this->send_count[this->nprocs-1], 1));
+    this->buffer1 = fftw_interface<rnumber>::alloc_complex(std::max(
+            this->recv_displ[this->nprocs-1] + this->recv_count[this->nprocs-1], 1));
+
+    /* 1D plans, components are always the fastest index.
+     * planning may overwrite arrays, so a temporary array stands in for
+     * field arrays, which have the same alignment */
+    rnumber *rtmp = fftw_interface<rnumber>::alloc_real(
+            std::max(std::max(local_n0*this->ny, local_n1*this->nz)*(this->nx+2),
+                     ptrdiff_t(1))*this->ncomp);
+    complex *ctmp = (complex*)rtmp;
+    typename fftw_interface<rnumber>::iodim dims[1], howmany_dims[2];
+    howmany_dims[1].n = this->ncomp;
+    howmany_dims[1].is = 1;
+    howmany_dims[1].os = 1;
+
+    /* x: in-place, (z, y) rows of the real array <-> (z, y, kx) */
+    dims[0].n = this->nx;
+    dims[0].is = this->ncomp;
+    dims[0].os = this->ncomp;
+    howmany_dims[0].n = local_n0*this->ny;
+    howmany_dims[0].is = (this->nx+2)*this->ncomp;
+    howmany_dims[0].os = this->nxc*this->ncomp;
+    this->x_r2c = fftw_interface<rnumber>::plan_guru_dft_r2c(
+            1, dims, 2, howmany_dims,
+            rtmp, ctmp,
+            FFTW_PLAN_RIGOR);
+    howmany_dims[0].is = this->nxc*this->ncomp;
+    howmany_dims[0].os = (this->nx+2)*this->ncomp;
+    this->x_c2r = fftw_interface<rnumber>::plan_guru_dft_c2r(
+            1, dims, 2, howmany_dims,
+            ctmp, rtmp,
+            FFTW_PLAN_RIGOR);
+
+    /* y: in-place on the kx values of the band of (z, y, kx) */
+    dims[0].n = this->ny;
+    dims[0].is = this->nxc*this->ncomp;
+    dims[0].os = this->nxc*this->ncomp;
+    howmany_dims[0].n = local_n0;
+    howmany_dims[0].is = this->ny*this->nxc*this->ncomp;
+    howmany_dims[0].os = this->ny*this->nxc*this->ncomp;
+    howmany_dims[1].n = this->max_line_size*this->ncomp;
+    this->y_forward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            ctmp, ctmp,
+            FFTW_FORWARD, FFTW_PLAN_RIGOR);
+    this->y_backward = fftw_interface<rnumber>::plan_guru_dft(
+            1, dims, 2, howmany_dims,
+            ctmp, ctmp,
+            FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+
+    /* z: in-place on the kept lines of every ky plane of the field array.
+     * planes with the same number of lines and the same alignment share
+     * plans */
+    dims[0].n = this->nz;
+    dims[0].is = this->nxc*this->ncomp;
+    dims[0].os = this->nxc*this->ncomp;
+    this->z_forward.resize(local_n1, nullptr);
+    this->z_backward.resize(local_n1, nullptr);
+    std::map<std::pair<ptrdiff_t, int>, ptrdiff_t> plane_plans;
+    for (ptrdiff_t yy = 0; yy < local_n1; yy++)
+    {
+        const ptrdiff_t nn = this->line_size[local_1_start + yy];
+        if (nn == 0)
+            continue;
+        complex *plane = ctmp + yy*this->nz*this->nxc*this->ncomp;
+        const std::pair<ptrdiff_t, int> plane_key(
+                nn, fftw_interface<rnumber>::alignment_of((rnumber*)plane));
+        auto found = plane_plans.find(plane_key);
+        if (found != plane_plans.end())
+        {
+            this->z_forward[yy] = this->z_forward[found->second];
+            this->z_backward[yy] = this->z_backward[found->second];
+            continue;
+        }
+        howmany_dims[0].n = nn*this->ncomp;
+        howmany_dims[0].is = 1;
+        howmany_dims[0].os = 1;
+        this->z_forward[yy] = fftw_interface<rnumber>::plan_guru_dft(
+                1, dims, 1, howmany_dims,
+                plane, plane,
+                FFTW_FORWARD, FFTW_PLAN_RIGOR);
+        this->z_backward[yy] = fftw_interface<rnumber>::plan_guru_dft(
+                1, dims, 1, howmany_dims,
+                plane, plane,
+                FFTW_BACKWARD, FFTW_PLAN_RIGOR);
+        this->all_z_plans.push_back(this->z_forward[yy]);
+        this->all_z_plans.push_back(this->z_backward[yy]);
+        plane_plans[plane_key] = yy;
+    }
+    fftw_interface<rnumber>::free(rtmp);
+}
+
+template <typename rnumber>
+truncated_fft<rnumber>::~truncated_fft()
+{
+    fftw_interface<rnumber>::destroy_plan(this->x_r2c);
+    fftw_interface<rnumber>::destroy_plan(this->x_c2r);
+    fftw_interface<rnumber>::destroy_plan(this->y_forward);
+    fftw_interface<rnumber>::destroy_plan(this->y_backward);
+    for (auto pp : this->all_z_plans)
+        fftw_interface<rnumber>::destroy_plan(pp);
+    fftw_interface<rnumber>::free(this->buffer0);
+    fftw_interface<rnumber>::free(this->buffer1);
+}
+
+/* kept lines of (z, y, kx) -> (ky, kz, kx), in-place on cdata,
+ * modes outside the band are set to zero */
+template <typename rnumber>
+void truncated_fft<rnumber>::transpose_forward(complex *cdata)
+{
+    TIMEZONE("truncated_fft::transpose_forward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    const ptrdiff_t local_nz = this->z_size[this->myrank];
+    const ptrdiff_t local_nky = this->ky_size[this->myrank];
+    const ptrdiff_t local_ky_start = this->ky_start[this->myrank];
+    const ptrdiff_t local_nlines = this->nlines[this->myrank];
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(local_nz);
+        for (int p=0; p<this->nprocs; p++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t iy = this->ky_start[p]; iy < this->ky_start[p] + this->ky_size[p]; iy++)
+        {
+            const rnumber *src = (const rnumber*)(cdata) + nc2*(
+                    (zz*this->ny + iy)*this->nxc);
+            std::copy(src, src + nc2*this->line_size[iy],
+                      (rnumber*)(this->buffer0) + 2*this->send_displ[p] + nc2*(
+                        zz*this->nlines[p] + this->line_offset[iy]));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer0, &this->send_count.front(), &this->send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer1, &this->recv_count.front(), &this->recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(local_nky);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(local_nky);
+        for (int q=0; q<this->nprocs; q++)
+        for (ptrdiff_t yy = start; yy < end; yy++)
+        for (ptrdiff_t zz = 0; zz < this->z_size[q]; zz++)
+        {
+            const ptrdiff_t iy = local_ky_start + yy;
+            const rnumber *src = (rnumber*)(this->buffer1) + 2*this->recv_displ[q] + nc2*(
+                    zz*local_nlines + this->line_offset[iy]);
+            rnumber *dst = (rnumber*)(cdata) + nc2*(
+                    (yy*this->nz + this->z_start[q] + zz)*this->nxc);
+            std::copy(src, src + nc2*this->line_size[iy], dst);
+            std::fill(dst + nc2*this->line_size[iy], dst + nc2*this->nxc, rnumber(0));
+        }
+    }
+}
+
+/* kept lines of (ky, kz, kx) -> (z, y, kx), in-place on cdata,
+ * modes outside the band are set to zero */
+template <typename rnumber>
+void truncated_fft<rnumber>::transpose_backward(complex *cdata)
+{
+    TIMEZONE("truncated_fft::transpose_backward");
+    const ptrdiff_t nc2 = 2*this->ncomp;
+    const ptrdiff_t local_nz = this->z_size[this->myrank];
+    const ptrdiff_t local_nky = this->ky_size[this->myrank];
+    const ptrdiff_t local_ky_start = this->ky_start[this->myrank];
+    const ptrdiff_t local_nlines = this->nlines[this->myrank];
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(local_nky);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(local_nky);
+        for (int q=0; q<this->nprocs; q++)
+        for (ptrdiff_t yy = start; yy < end; yy++)
+        for (ptrdiff_t zz = 0; zz < this->z_size[q]; zz++)
+        {
+            const ptrdiff_t iy = local_ky_start + yy;
+            const rnumber *src = (const rnumber*)(cdata) + nc2*(
+                    (yy*this->nz + this->z_start[q] + zz)*this->nxc);
+            std::copy(src, src + nc2*this->line_size[iy],
+                      (rnumber*)(this->buffer1) + 2*this->recv_displ[q] + nc2*(
+                        zz*local_nlines + this->line_offset[iy]));
+        }
+    }
+    {
+        TIMEZONE("MPI_Alltoallv");
+        MPI_Alltoallv(
+                this->buffer1, &this->recv_count.front(), &this->recv_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->buffer0, &this->send_count.front(), &this->send_displ.front(),
+                mpi_real_type<rnumber>::complex(),
+                this->comm);
+    }
+    #pragma omp parallel
+    {
+        const ptrdiff_t start = OmpUtils::ForIntervalStart(local_nz);
+        const ptrdiff_t end = OmpUtils::ForIntervalEnd(local_nz);
+        for (int p=0; p<this->nprocs; p++)
+        for (ptrdiff_t zz = start; zz < end; zz++)
+        for (ptrdiff_t iy = this->ky_start[p]; iy < this->ky_start[p] + this->ky_size[p]; iy++)
+        {
+            const rnumber *src = (rnumber*)(this->buffer0) + 2*this->send_displ[p] + nc2*(
+                    zz*this->nlines[p] + this->line_offset[iy]);
+            rnumber *dst = (rnumber*)(cdata) + nc2*(
+                    (zz*this->ny + iy)*this->nxc);
+            std::copy(src, src + nc2*this->line_size[iy], dst);
+            std::fill(dst + nc2*this->line_size[iy], dst + nc2*this->nxc, rnumber(0));
+        }
+    }
+}
+
+template <typename rnumber>
+void truncated_fft<rnumber>::r2c(rnumber *data)
+{
+    TIMEZONE("truncated_fft::r2c");
+    complex *cdata = (complex*)data;
+    fftw_interface<rnumber>::execute_dft_r2c(this->x_r2c, data, cdata);
+    fftw_interface<rnumber>::execute_dft(this->y_forward, cdata, cdata);
+    this->transpose_forward(cdata);
+    for (ptrdiff_t yy = 0; yy < ptrdiff_t(this->z_forward.size()); yy++)
+        if (this->z_forward[yy] != nullptr)
+        {
+            complex *plane = cdata + yy*this->nz*this->nxc*this->ncomp;
+            fftw_interface<rnumber>::execute_dft(this->z_forward[yy], plane, plane);
+        }
+}
+
+template <typename rnumber>
+void truncated_fft<rnumber>::c2r(complex *cdata)
+{
+    TIMEZONE("truncated_fft::c2r");
+    for (ptrdiff_t yy = 0; yy < ptrdiff_t(this->z_backward.size()); yy++)
+        if (this->z_backward[yy] != nullptr)
+        {
+            complex *plane = cdata + yy*this->nz*this->nxc*this->ncomp;
+            fftw_interface<rnumber>::execute_dft(this->z_backward[yy], plane, plane);
+        }
+    this->transpose_backward(cdata);
+    fftw_interface<rnumber>::execute_dft(this->y_backward, cdata, cdata);
+    fftw_interface<rnumber>::execute_dft_c2r(this->x_c2r, cdata, (rnumber*)cdata);
+}
+
+template class truncated_fft<float>;
+template class truncated_fft<double>;
+
@@ -0,0 +1,172 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+#include <mpi.h>
+#include <map>
+#include <tuple>
+#include <vector>
+#include "fftw_interface.hpp"
+
+#ifndef TRUNCATED_FFT_HPP
+
+#define TRUNCATED_FFT_HPP
+
+/** \class truncated_fft
+ *  \brief Slab r2c/c2r transforms restricted to a band of Fourier modes.
+ *
+ *  Uses the same data distribution and array layouts as the FFTW-MPI
+ *  transforms of the `FFTW` backend of `field` (real space (z, y, x) split
+ *  along z, Fourier space (ky, kz, kx) split along ky), but only keeps the
+ *  kz lines with \f$k_x^2 + k_y^2 \leq k_M^2\f$.
+ *  For a dealiased field all other modes vanish, so:
+ *
+ *   - the y transforms are only computed for the kx values of the band;
+ *   - only the kept lines are sent through the all-to-all exchange;
+ *   - the z transforms are only computed for the kept lines.
+ *
+ *  `c2r` ignores the modes outside the band, and `r2c` sets them to zero.
+ *  With the 2/3 rule the band holds about a third of the kz lines, with the
+ *  smooth filter about three quarters of them.
+ *
+ *  As for `fftw_plan_registry`, objects are shared between fields with the
+ *  same shape, number of components, communicator, planner flags and band,
+ *  and `clear` must be called before `fftw_mpi_cleanup`.
+ */
+
+template <typename rnumber>
+class truncated_fft
+{
+    private:
+        using complex = typename fftw_interface<rnumber>::complex;
+        using plan = typename fftw_interface<rnumber>::plan;
+        /* key: nz, ny, nx, howmany, communicator, flags, dkx, dky, kM2 */
+        using key_type = std::tuple<int, int, int, int, MPI_Comm, unsigned,
+                                    double, double, double>;
+
+        static std::map<key_type, truncated_fft<rnumber>*> &get_registry()
+        {
+            static std::map<key_type, truncated_fft<rnumber>*> registry;
+            return registry;
+        }
+
+        /* serial 1D plans; the kz plans depend on the number of kept
+         * lines, so there is one per local ky plane (possibly shared) */
+        plan x_r2c, x_c2r;
+        plan y_forward, y_backward;
+        std::vector<plan> z_forward, z_backward;
+        std::vector<plan> all_z_plans;
+
+        /* exchange buffers, holding only the kept lines: buffer0 those of
+         * the local z planes, in the order they are sent to each process,
+         * buffer1 those of the local ky planes, in the order they are
+         * received from each process.
+         * the x and y transforms work in place on the field array */
+        complex *buffer0, *buffer1;
+
+        /* all-to-all counts and displacements for the forward transform,
+         * in units of complex numbers; the backward transform swaps the
+         * send and receive lists */
+        std::vector<int> send_count, send_displ;
+        std::vector<int> recv_count, recv_displ;
+
+        truncated_fft(
+                const int nx,
+                const int ny,
+                const int nz,
+                const int howmany,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR,
+                const double DKX,
+                const double DKY,
+                const double KM2);
+        ~truncated_fft();
+
+        void transpose_forward(complex *cdata);
+        void transpose_backward(complex *cdata);
+
+    public:
+        /* global sizes and number of components */
+        int nx, ny, nz, nxc, ncomp;
+        MPI_Comm comm;
+        int nprocs, myrank;
+
+        /* band of kept modes */
+        double dkx, dky, kM2;
+        /* number of kept kx values for every ky, the largest of them,
+         * and the offset of every ky in units of kept lines, counted from
+         * the first ky held by the same process */
+        std::vector<ptrdiff_t> line_size, line_offset;
+        ptrdiff_t max_line_size;
+
+        /* FFTW-MPI distribution of z and ky over processes,
+         * and number of kept lines held by every process */
+        std::vector<ptrdiff_t> z_size, z_start;
+        std::vector<ptrdiff_t> ky_size, ky_start;
+        std::vector<ptrdiff_t> nlines;
+
+        static truncated_fft<rnumber> *get(
+                const int nx,
+                const int ny,
+                const int nz,
+                const int howmany,
+                const MPI_Comm COMM_TO_USE,
+                const unsigned FFTW_PLAN_RIGOR,
+                const double DKX,
+                const double DKY,
+                const double KM2)
+        {
+            const key_type key(nz, ny, nx, howmany, COMM_TO_USE, FFTW_PLAN_RIGOR,
+                               DKX, DKY, KM2);
+            auto found = get_registry().find(key);
+            if (found != get_registry().end())
+                return found->second;
+            truncated_fft<rnumber> *new_tfft = new truncated_fft<rnumber>(
+                    nx, ny, nz, howmany, COMM_TO_USE, FFTW_PLAN_RIGOR,
+                    DKX, DKY, KM2);
+            get_registry()[key] = new_tfft;
+            return new_tfft;
+        }
+
+        static int size()
+        {
+            return int(get_registry().size());
+        }
+
+        static void clear()
+        {
+            for (auto kv : get_registry())
+                delete kv.second;
+            get_registry().clear();
+        }
+
+        /* unnormalized transforms, in-place on a field array */
+        void r2c(rnumber *data);
+        void c2r(complex *cdata);
+};
+
+#endif//TRUNCATED_FFT_HPP
+
@@ -32,6 +32,7 @@
 #include "fftw_tools.hpp"
 #include "vorticity_equation.hpp"
 #include "scope_timer.hpp"
+#include "shared_array.hpp"
 
 
 
@@ -43,7 +44,8 @@ void vorticity_equation<rnumber, be>::impose_zero_modes()
     this->u->impose_zero_mode();
     this->v[0]->impose_zero_mode();
     this->v[1]->impose_zero_mode();
-    this->v[2]->impose_zero_mode();
+    if (this->v[2] != nullptr)
+        this->v[2]->impose_zero_mode();
 }
 
 template <class rnumber,
@@ -107,6 +109,89 @@ void vorticity_equation<rnumber, be>::update_checkpoint()
     MPI_Bcast(&this->checkpoint, 1, MPI_INT, 0, this->kk->layout->comm);
 }
 
+/** \brief Only compute the Fourier modes that the solver uses.
+ *
+ *  The solver fields only hold modes inside the dealiasing sphere, and only
+ *  those modes of their transforms are used, so the transforms can skip
+ *  everything else (see `truncated_fft`).
+ */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::use_truncated_transforms(void)
+{
+    this->cvorticity->use_truncated_transforms(this->kk);
+    this->v[1]->use_truncated_transforms(this->kk);
+    this->cvelocity->use_truncated_transforms(this->kk);
+    if (this->rvorticity != nullptr)
+    {
+        this->rvorticity->use_truncated_transforms(this->kk);
+        this->v[2]->use_truncated_transforms(this->kk);
+    }
+}
+
+template <class rnumber,
+          field_backend be>
+bool vorticity_equation<rnumber, be>::use_async_checkpoints()
+{
+    TIMEZONE("vorticity_equation::use_async_checkpoints");
+    if (this->checkpoint_buffer != nullptr)
+        return true;
+    int mpi_thread_level;
+    MPI_Query_thread(&mpi_thread_level);
+    /* a failed query counts as a library that is not thread-safe */
+    hbool_t hdf5_threadsafe = false;
+    if (H5is_library_threadsafe(&hdf5_threadsafe) < 0)
+        hdf5_threadsafe = false;
+    if (mpi_thread_level < MPI_THREAD_MULTIPLE || !hdf5_threadsafe)
+    {
+        if (this->kk->layout->myrank == 0)
+            std::cerr <<
+                "asynchronous checkpoints need MPI_THREAD_MULTIPLE and a "
+                "thread-safe HDF5, writing checkpoints synchronously." <<
+                std::endl;
+        return false;
+    }
+    /* the buffer is only written to disk, so it is a plain copy of the
+     * layouts of cvorticity, without transforms */
+    MPI_Comm_dup(this->cvorticity->comm, &this->checkpoint_comm);
+    this->checkpoint_buffer = new field<rnumber, be, THREE>(
+            *this->cvorticity,
+            this->checkpoint_comm);
+    return true;
+}
+
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::write_checkpoint_async()
+{
+    TIMEZONE("vorticity_equation::write_checkpoint_async");
+    /* the checkpoint file may be the same as the one being written */
+    this->wait_for_checkpoint();
+    this->update_checkpoint();
+    *this->checkpoint_buffer = this->cvorticity->get_cdata();
+    const std::string fname = this->get_current_fname();
+    const int iteration = this->iteration;
+    this->checkpoint_writer = std::thread(
+            [this, fname, iteration](){
+        /* the timers only know about OpenMP threads */
+        EventManager::currentThreadIsMuted() = true;
+        this->checkpoint_buffer->io(
+                fname,
+                "vorticity",
+                iteration,
+                false);
+    });
+}
+
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::wait_for_checkpoint()
+{
+    TIMEZONE("vorticity_equation::wait_for_checkpoint");
+    if (this->checkpoint_writer.joinable())
+        this->checkpoint_writer.join();
+}
+
 template <class rnumber,
           field_backend be>
 vorticity_equation<rnumber, be>::vorticity_equation(
@@ -117,7 +202,8 @@ vorticity_equation<rnumber, be>::vorticity_equation(
         double DKX,
         double DKY,
         double DKZ,
-        unsigned FFTW_PLAN_RIGOR)
+        unsigned FFTW_PLAN_RIGOR,
+        const char *TIME_STEPPER)
 {
     TIMEZONE("vorticity_equation::vorticity_equation");
     /* initialize name and basic stuff */
@@ -125,16 +211,38 @@ vorticity_equation<rnumber, be>::vorticity_equation(
     this->name[255] = '\0';
     this->iteration = 0;
     this->checkpoint = 0;
+    strncpy(this->time_stepper, TIME_STEPPER, 128);
+    this->time_stepper[127] = '\0';
+    this->CFL_number = 0;
+    this->step_dt = 0;
+    const bool low_storage = (strcmp(this->time_stepper, "low_storage_RK3") == 0);
 
-    /* initialize fields */
+    /* initialize fields.
+     * the low storage scheme only needs the vorticity, one register (v[1])
+     * and the velocity, and it brings the vorticity itself to real space
+     * to compute the nonlinear term, so rvorticity and v[2] are not
+     * allocated.
+     * the solver itself therefore holds 3 vector fields with
+     * low_storage_RK3, and 5 with RK3. scratch fields leased from the pool
+     * (pressure and velocity products in compute_pressure and the
+     * acceleration methods) only exist while they are used, unless a code
+     * reserves them. */
     this->cvorticity = new field<rnumber, be, THREE>(
             nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
-    this->rvorticity = new field<rnumber, be, THREE>(
-            nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
     this->v[1] = new field<rnumber, be, THREE>(
             nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
-    this->v[2] = new field<rnumber, be, THREE>(
-            nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
+    if (low_storage)
+    {
+        this->rvorticity = nullptr;
+        this->v[2] = nullptr;
+    }
+    else
+    {
+        this->rvorticity = new field<rnumber, be, THREE>(
+                nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
+        this->v[2] = new field<rnumber, be, THREE>(
+                nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
+    }
     this->v[0] = this->cvorticity;
     this->v[3] = this->cvorticity;
 
@@ -146,6 +254,41 @@ vorticity_equation<rnumber, be>::vorticity_equation(
     this->kk = new kspace<be, SMOOTH>(
             this->cvorticity->clayout, DKX, DKY, DKZ);
 
+    /* the integrating factors are needed for the substeps of the scheme */
+    if (low_storage)
+    {
+        this->integrating_factors_fractions[0] = 1./3;
+        this->integrating_factors_fractions[1] = 5./12;
+        this->integrating_factors_fractions[2] = 1./4;
+    }
+    else
+    {
+        this->integrating_factors_fractions[0] = 1;
+        this->integrating_factors_fractions[1] = 0.5;
+        this->integrating_factors_fractions[2] = -0.5;
+    }
+
+    /* integrating factors can be tabulated on k2 shells if all values of
+     * kx^2, ky^2 and kz^2 are multiples of dk2 */
+    this->integrating_factors_on_shells = true;
+    for (auto kaxis : {&this->kk->kx, &this->kk->ky, &this->kk->kz})
+        for (double kval : *kaxis)
+        {
+            const double nn = kval*kval / this->kk->dk2;
+            if (fabs(nn - round(nn)) > 1e-10*nn)
+                this->integrating_factors_on_shells = false;
+        }
+    this->integrating_factors_nu = 0;
+    this->integrating_factors_dt = 0;
+
+    /* initialize scratch field pool, nothing is kept alive by default */
+    this->pool = new field_pool<rnumber, be>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_PLAN_RIGOR);
+
+    /* checkpoints are synchronous unless use_async_checkpoints is called */
+    this->checkpoint_buffer = nullptr;
+    this->checkpoint_comm = MPI_COMM_NULL;
+
     /* ``physical'' parameters etc, initialized here just in case */
 
     this->nu = 0.1;
@@ -160,7 +303,14 @@ template <class rnumber,
 vorticity_equation<rnumber, be>::~vorticity_equation()
 {
     TIMEZONE("vorticity_equation::~vorticity_equation");
+    this->wait_for_checkpoint();
+    if (this->checkpoint_buffer != nullptr)
+    {
+        delete this->checkpoint_buffer;
+        MPI_Comm_free(&this->checkpoint_comm);
+    }
     delete this->kk;
+    delete this->pool;
     delete this->cvorticity;
     delete this->rvorticity;
     delete this->v[1];
@@ -253,13 +403,13 @@ void vorticity_equation<rnumber, be>::add_forcing(
         ptrdiff_t cindex;
         if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->fmode])
         {
-            cindex = ((this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->sizes[1])*this->cvorticity->clayout->sizes[2];
+            cindex = ((this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
             dst->cval(cindex,2, 0) -= this->famplitude*factor/2;
             //dst->get_cdata()[cindex*3+2][0] -= this->famplitude*factor/2;
         }
         if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->cvorticity->clayout->sizes[0] - this->fmode])
         {
-            cindex = ((this->cvorticity->clayout->sizes[0] - this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->sizes[1])*this->cvorticity->clayout->sizes[2];
+            cindex = ((this->cvorticity->clayout->sizes[0] - this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
             dst->cval(cindex, 2, 0) -= this->famplitude*factor/2;
             //dst->get_cdata()[cindex*3+2][0] -= this->famplitude*factor/2;
         }
@@ -272,9 +422,7 @@ void vorticity_equation<rnumber, be>::add_forcing(
                         ptrdiff_t xindex,
                         ptrdiff_t yindex,
                         ptrdiff_t zindex){
-            double knorm = sqrt(this->kk->kx[xindex]*this->kk->kx[xindex] +
-                                this->kk->ky[yindex]*this->kk->ky[yindex] +
-                                this->kk->kz[zindex]*this->kk->kz[zindex]);
+            const double knorm = this->kk->knorm[cindex];
             if ((this->fk0 <= knorm) &&
                     (this->fk1 >= knorm))
                 for (int c=0; c<3; c++)
@@ -289,152 +437,372 @@ void vorticity_equation<rnumber, be>::add_forcing(
 
 template <class rnumber,
           field_backend be>
+template <class update_type>
 void vorticity_equation<rnumber, be>::omega_nonlin(
-        int src)
+        int src,
+        update_type update,
+        double *dt)
 {
     DEBUG_MSG("vorticity_equation::omega_nonlin(%d)\n", src);
     assert(src >= 0 && src < 3);
     this->compute_velocity(this->v[src]);
-    /* get fields from Fourier space to real space */
-    this->u->ift();
-    this->rvorticity->real_space_representation = false;
-    *this->rvorticity = this->v[src]->get_cdata();
-    this->rvorticity->ift();
-    /* compute cross product $u \times \omega$, and normalize */
-    this->u->RLOOP(
+    /* get fields from Fourier space to real space, with a single transform.
+     * without rvorticity (low storage scheme), v[src] itself goes to real
+     * space, and it is normalized there so that it comes back unchanged
+     * (up to roundoff) with the nonlinear term.
+     * this round trip adds the roundoff of two transforms to the state
+     * itself at each substep, about one epsilon: in single precision, 8
+     * steps of the 32^3 test in tests/DNS/test_low_storage_RK3.py differ
+     * from double precision by 1.7e-6 with low_storage_RK3, and by 1.2e-7
+     * with RK3. the vorticity can't be staged through the register v[1]
+     * instead, since the scheme reads the register in the second and third
+     * substeps; RK3 should be used where this matters */
+    const bool in_place = (this->rvorticity == nullptr);
+    field<rnumber, be, THREE> *rvort = in_place ? this->v[src] : this->rvorticity;
+    if (!in_place)
+    {
+        this->rvorticity->real_space_representation = false;
+        *this->rvorticity = this->v[src]->get_cdata();
+    }
+    field<rnumber, be, THREE>::ift_many({this->u, rvort}, this->pool);
+    /* compute cross product $u \times \omega$, and normalize.
+     * if needed, find the largest velocity over grid spacing on the way */
+    const rnumber npoints = this->u->npoints;
+    const double inverse_dx[3] = {
+        this->kk->dkx*this->u->rlayout->sizes[2] / (2*acos(-1.)),
+        this->kk->dky*this->u->rlayout->sizes[1] / (2*acos(-1.)),
+        this->kk->dkz*this->u->rlayout->sizes[0] / (2*acos(-1.))};
+    shared_array<double> local_rate_threaded(
+            1,
+            [&](double *local_rate){
+        local_rate[0] = 0;
+    });
+    this->u->RLOOP_ROWS(
                 [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
+                    ptrdiff_t nx,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        rnumber tmp[3];
-        for (int cc=0; cc<3; cc++)
-            tmp[cc] = (this->u->rval(rindex,(cc+1)%3)*this->rvorticity->rval(rindex,(cc+2)%3) -
-                       this->u->rval(rindex,(cc+2)%3)*this->rvorticity->rval(rindex,(cc+1)%3));
-            //tmp[cc][0] = (this->u->get_rdata()[tindex+(cc+1)%3]*this->rvorticity->get_rdata()[tindex+(cc+2)%3] -
-            //              this->u->get_rdata()[tindex+(cc+2)%3]*this->rvorticity->get_rdata()[tindex+(cc+1)%3]);
-        for (int cc=0; cc<3; cc++)
-            this->u->rval(rindex,cc) = tmp[cc] / this->u->npoints;
-            //this->u->get_rdata()[(3*rindex)+cc] = tmp[cc][0] / this->u->npoints;
+        rnumber *__restrict__ uu = this->u->get_rdata() + 3*rindex;
+        rnumber *__restrict__ ww = rvort->get_rdata() + 3*rindex;
+        if (dt != nullptr)
+        {
+            double rate = local_rate_threaded.getMine()[0];
+            #pragma omp simd reduction(max:rate)
+            for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+                rate = std::max(rate, double(
+                        fabs(uu[3*xindex+0])*inverse_dx[0] +
+                        fabs(uu[3*xindex+1])*inverse_dx[1] +
+                        fabs(uu[3*xindex+2])*inverse_dx[2]));
+            local_rate_threaded.getMine()[0] = rate;
+        }
+        #pragma omp simd
+        for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+        {
+            const rnumber u0 = uu[3*xindex+0], u1 = uu[3*xindex+1], u2 = uu[3*xindex+2];
+            const rnumber w0 = ww[3*xindex+0], w1 = ww[3*xindex+1], w2 = ww[3*xindex+2];
+            uu[3*xindex+0] = (u1*w2 - u2*w1) / npoints;
+            uu[3*xindex+1] = (u2*w0 - u0*w2) / npoints;
+            uu[3*xindex+2] = (u0*w1 - u1*w0) / npoints;
+        }
+        if (in_place)
+        {
+            #pragma omp simd
+            for (ptrdiff_t xindex = 0; xindex < 3*nx; xindex++)
+                ww[xindex] /= npoints;
+        }
     }
     );
+    if (dt != nullptr)
+    {
+        local_rate_threaded.mergeParallel([&](const int idx, const double& v1, const double& v2) -> double {
+            return std::max(v1, v2);
+        });
+        double rate;
+        MPI_Allreduce(
+                local_rate_threaded.getMasterData(),
+                &rate,
+                1,
+                MPI_DOUBLE,
+                MPI_MAX,
+                this->u->comm);
+        if (rate > 0)
+            *dt = std::min(*dt, this->CFL_number / rate);
+        /* keep the time step of the previous step if it is only slightly
+         * smaller than allowed, so that small fluctuations of the velocity
+         * don't force new integrating factors (or break the constant step
+         * formulas of the particle integrator) at every step */
+        if (this->step_dt > 0 &&
+            this->step_dt <= *dt &&
+            this->step_dt >= 0.9*(*dt))
+            *dt = this->step_dt;
+        DEBUG_MSG("vorticity_equation::omega_nonlin max rate %g, dt %g\n", rate, *dt);
+        this->update_integrating_factors(*dt);
+    }
     /* go back to Fourier space */
     //this->clean_up_real_space(this->ru, 3);
-    this->u->dft();
-    this->kk->template dealias<rnumber, THREE>(this->u->get_cdata());
-    /* $\imath k \times Fourier(u \times \omega)$ */
-    this->kk->CLOOP(
+    if (in_place)
+        field<rnumber, be, THREE>::dft_many({this->u, rvort}, this->pool);
+    else
+        this->u->dft();
+    /* single sweep over Fourier space: dealias, compute
+     * $\imath k \times Fourier(u \times \omega)$, add the forcing and
+     * project onto divergence free fields, i.e. the same operations as
+     * `dealias`, the curl, `add_forcing` and `force_divfree` */
+    const bool linear_forcing = (strcmp(this->forcing_type, "linear") == 0);
+    ptrdiff_t Kolmogorov_cindex[2] = {-1, -1};
+    if (strcmp(this->forcing_type, "Kolmogorov") == 0)
+    {
+        if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->fmode])
+            Kolmogorov_cindex[0] = ((this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
+        if (this->cvorticity->clayout->myrank == this->cvorticity->clayout->rank[0][this->cvorticity->clayout->sizes[0] - this->fmode])
+            Kolmogorov_cindex[1] = ((this->cvorticity->clayout->sizes[0] - this->fmode - this->cvorticity->clayout->starts[0]) * this->cvorticity->clayout->subsizes[1])*this->cvorticity->clayout->subsizes[2];
+    }
+    this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
                     ptrdiff_t yindex,
-                    ptrdiff_t zindex){
+                    ptrdiff_t zindex,
+                    double k2){
+        const double filter = this->kk->dealias_factor(k2);
+        rnumber uu[3][2];
+        for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+            uu[cc][i] = this->u->cval(cindex, cc, i)*filter;
         rnumber tmp[3][2];
+        tmp[0][0] = -(this->kk->ky[yindex]*uu[2][1] - this->kk->kz[zindex]*uu[1][1]);
+        tmp[1][0] = -(this->kk->kz[zindex]*uu[0][1] - this->kk->kx[xindex]*uu[2][1]);
+        tmp[2][0] = -(this->kk->kx[xindex]*uu[1][1] - this->kk->ky[yindex]*uu[0][1]);
+        tmp[0][1] =  (this->kk->ky[yindex]*uu[2][0] - this->kk->kz[zindex]*uu[1][0]);
+        tmp[1][1] =  (this->kk->kz[zindex]*uu[0][0] - this->kk->kx[xindex]*uu[2][0]);
+        tmp[2][1] =  (this->kk->kx[xindex]*uu[1][0] - this->kk->ky[yindex]*uu[0][0]);
+        if (linear_forcing)
         {
-            tmp[0][0] = -(this->kk->ky[yindex]*this->u->cval(cindex,2,1) - this->kk->kz[zindex]*this->u->cval(cindex,1,1));
-            tmp[1][0] = -(this->kk->kz[zindex]*this->u->cval(cindex,0,1) - this->kk->kx[xindex]*this->u->cval(cindex,2,1));
-            tmp[2][0] = -(this->kk->kx[xindex]*this->u->cval(cindex,1,1) - this->kk->ky[yindex]*this->u->cval(cindex,0,1));
-            tmp[0][1] =  (this->kk->ky[yindex]*this->u->cval(cindex,2,0) - this->kk->kz[zindex]*this->u->cval(cindex,1,0));
-            tmp[1][1] =  (this->kk->kz[zindex]*this->u->cval(cindex,0,0) - this->kk->kx[xindex]*this->u->cval(cindex,2,0));
-            tmp[2][1] =  (this->kk->kx[xindex]*this->u->cval(cindex,1,0) - this->kk->ky[yindex]*this->u->cval(cindex,0,0));
+            const double knorm = this->kk->knorm[cindex];
+            if ((this->fk0 <= knorm) &&
+                    (this->fk1 >= knorm))
+                for (int cc=0; cc<3; cc++)
+                    for (int i=0; i<2; i++)
+                        tmp[cc][i] += this->famplitude*this->v[src]->cval(cindex,cc,i);
         }
-        //ptrdiff_t tindex = 3*cindex;
-        //{
-        //    tmp[0][0] = -(this->kk->ky[yindex]*this->u->get_cdata()[tindex+2][1] - this->kk->kz[zindex]*this->u->get_cdata()[tindex+1][1]);
-        //    tmp[1][0] = -(this->kk->kz[zindex]*this->u->get_cdata()[tindex+0][1] - this->kk->kx[xindex]*this->u->get_cdata()[tindex+2][1]);
-        //    tmp[2][0] = -(this->kk->kx[xindex]*this->u->get_cdata()[tindex+1][1] - this->kk->ky[yindex]*this->u->get_cdata()[tindex+0][1]);
-        //    tmp[0][1] =  (this->kk->ky[yindex]*this->u->get_cdata()[tindex+2][0] - this->kk->kz[zindex]*this->u->get_cdata()[tindex+1][0]);
-        //    tmp[1][1] =  (this->kk->kz[zindex]*this->u->get_cdata()[tindex+0][0] - this->kk->kx[xindex]*this->u->get_cdata()[tindex+2][0]);
-        //    tmp[2][1] =  (this->kk->kx[xindex]*this->u->get_cdata()[tindex+1][0] - this->kk->ky[yindex]*this->u->get_cdata()[tindex+0][0]);
-        //}
+        if (cindex == Kolmogorov_cindex[0] || cindex == Kolmogorov_cindex[1])
+            tmp[2][0] -= this->famplitude/2;
+        if (k2 > 0)
+            this->kk->template project_divfree<rnumber>(tmp, xindex, yindex, zindex, k2);
+        else
+            std::fill_n((rnumber*)tmp, 6, 0.0);
+        update(cindex, xindex, yindex, zindex, k2, tmp);
+    }
+    );
+}
+
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::omega_nonlin(
+        int src)
+{
+    this->omega_nonlin(
+            src,
+            [&](ptrdiff_t cindex,
+                ptrdiff_t xindex,
+                ptrdiff_t yindex,
+                ptrdiff_t zindex,
+                double k2,
+                rnumber nonlin[3][2]){
         for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
-            this->u->cval(cindex, cc, i) = tmp[cc][i];
-            //this->u->get_cdata()[3*cindex+cc][i] = tmp[cc][i];
+            this->u->cval(cindex, cc, i) = nonlin[cc][i];
     }
     );
-    this->add_forcing(this->u, this->v[src], 1.0);
-    this->kk->template force_divfree<rnumber>(this->u->get_cdata());
+}
+
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::update_integrating_factors(double dt)
+{
+    if (!this->integrating_factors_on_shells ||
+        (this->integrating_factors_nu == this->nu &&
+         this->integrating_factors_dt == dt))
+        return;
+    TIMEZONE("vorticity_equation::update_integrating_factors");
+    /* the RK updates only use shells with k2 <= kM2 */
+    const size_t nshells = size_t(this->kk->kM2 / this->kk->dk2) + 2;
+    this->integrating_factors.resize(3*nshells);
+    for (size_t shell = 0; shell < nshells; shell++)
+    {
+        const double k2 = shell*this->kk->dk2;
+        for (int i=0; i<3; i++)
+            this->integrating_factors[3*shell+i] = exp(
+                    -this->nu * k2 * dt * this->integrating_factors_fractions[i]);
+    }
+    this->integrating_factors_nu = this->nu;
+    this->integrating_factors_dt = dt;
 }
 
 template <class rnumber,
           field_backend be>
 void vorticity_equation<rnumber, be>::step(double dt)
 {
+    if (strcmp(this->time_stepper, "low_storage_RK3") == 0)
+    {
+        this->step_low_storage_RK3(dt);
+        return;
+    }
     DEBUG_MSG("vorticity_equation::step\n");
     TIMEZONE("vorticity_equation::step");
-    *this->v[1] = 0.0;
-    this->omega_nonlin(0);
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
+    /* with adaptive time stepping, the first substep chooses dt and
+     * updates the integrating factors */
+    const bool adaptive = (this->CFL_number > 0);
+    if (!adaptive)
+        this->update_integrating_factors(dt);
+    /* every substep updates the next vorticity field within the same sweep
+     * that computes the nonlinear term, and sets it to zero outside the
+     * dealiasing sphere */
+    this->omega_nonlin(
+            0,
+            [&](ptrdiff_t cindex,
+                ptrdiff_t xindex,
+                ptrdiff_t yindex,
+                ptrdiff_t zindex,
+                double k2,
+                rnumber nonlin[3][2]){
         if (k2 <= this->kk->kM2)
         {
-            double factor0;
-            factor0 = exp(-this->nu * k2 * dt);
+            double factors[3];
+            this->get_integrating_factors(k2, dt, factors);
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[1]->cval(cindex,cc,i) = (
                         this->v[0]->cval(cindex,cc,i) +
-                        dt*this->u->cval(cindex,cc,i))*factor0;
-                //this->v[1]->get_cdata()[3*cindex+cc][i] = (
-                //        this->v[0]->get_cdata()[3*cindex+cc][i] +
-                //        dt*this->u->get_cdata()[3*cindex+cc][i])*factor0;
+                        dt*nonlin[cc][i])*factors[0];
         }
-    }
-    );
+        else
+            std::fill_n((rnumber*)(this->v[1]->get_cdata()+3*cindex), 6, 0.0);
+    },
+    adaptive ? &dt : nullptr);
 
-    this->omega_nonlin(1);
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
+    this->omega_nonlin(
+            1,
+            [&](ptrdiff_t cindex,
+                ptrdiff_t xindex,
+                ptrdiff_t yindex,
+                ptrdiff_t zindex,
+                double k2,
+                rnumber nonlin[3][2]){
         if (k2 <= this->kk->kM2)
         {
-            double factor0, factor1;
-            factor0 = exp(-this->nu * k2 * dt/2);
-            factor1 = exp( this->nu * k2 * dt/2);
+            double factors[3];
+            this->get_integrating_factors(k2, dt, factors);
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[2]->cval(cindex, cc, i) = (
-                        3*this->v[0]->cval(cindex,cc,i)*factor0 +
+                        3*this->v[0]->cval(cindex,cc,i)*factors[1] +
                         ( this->v[1]->cval(cindex,cc,i) +
-                         dt*this->u->cval(cindex,cc,i))*factor1)*0.25;
-                //this->v[2]->get_cdata()[3*cindex+cc][i] = (
-                //        3*this->v[0]->get_cdata()[3*cindex+cc][i]*factor0 +
-                //        (this->v[1]->get_cdata()[3*cindex+cc][i] +
-                //         dt*this->u->get_cdata()[3*cindex+cc][i])*factor1)*0.25;
+                         dt*nonlin[cc][i])*factors[2])*0.25;
         }
+        else
+            std::fill_n((rnumber*)(this->v[2]->get_cdata()+3*cindex), 6, 0.0);
     }
     );
 
-    this->omega_nonlin(2);
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-        if (k2 <= this->kk->kM2)
+    /* the last substep also projects the result onto divergence free
+     * fields, as `force_divfree` would */
+    this->omega_nonlin(
+            2,
+            [&](ptrdiff_t cindex,
+                ptrdiff_t xindex,
+                ptrdiff_t yindex,
+                ptrdiff_t zindex,
+                double k2,
+                rnumber nonlin[3][2]){
+        if (k2 <= this->kk->kM2 && k2 > 0)
         {
-            double factor0;
-            factor0 = exp(-this->nu * k2 * dt * 0.5);
+            double factors[3];
+            this->get_integrating_factors(k2, dt, factors);
             for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
                 this->v[3]->cval(cindex,cc,i) = (
-                        this->v[0]->cval(cindex,cc,i)*factor0 +
+                        this->v[0]->cval(cindex,cc,i)*factors[1] +
                         2*(this->v[2]->cval(cindex,cc,i) +
-                           dt*this->u->cval(cindex,cc,i)))*factor0/3;
-                //this->v[3]->get_cdata()[3*cindex+cc][i] = (
-                //        this->v[0]->get_cdata()[3*cindex+cc][i]*factor0 +
-                //        2*(this->v[2]->get_cdata()[3*cindex+cc][i] +
-                //           dt*this->u->get_cdata()[3*cindex+cc][i]))*factor0/3;
+                           dt*nonlin[cc][i]))*factors[1]/3;
+            this->kk->template project_divfree<rnumber>(
+                    this->v[3]->get_cdata()+3*cindex,
+                    xindex, yindex, zindex, k2);
         }
+        else
+            std::fill_n((rnumber*)(this->v[3]->get_cdata()+3*cindex), 6, 0.0);
     }
     );
 
-    this->kk->template force_divfree<rnumber>(this->cvorticity->get_cdata());
     this->cvorticity->symmetrize();
+    this->step_dt = dt;
+    this->iteration++;
+}
+
+/** \brief Low storage (2N) third order Runge-Kutta step.
+ *
+ *  Williamson's scheme, with integrating factors for the viscous term:
+ *  for each substep s, with $E_s$ the integrating factor over the length
+ *  of the substep,
+ *  \f[
+ *      q = E_s (A_s q + \Delta t N(\omega)), \qquad
+ *      \omega = E_s \omega + B_s q.
+ *  \f]
+ *  Only the vorticity, the register `v[1]` and the velocity (which holds
+ *  the nonlinear term) are used, and the vorticity is updated within the
+ *  sweep that computes the nonlinear term.
+ */
+template <class rnumber,
+          field_backend be>
+void vorticity_equation<rnumber, be>::step_low_storage_RK3(double dt)
+{
+    DEBUG_MSG("vorticity_equation::step_low_storage_RK3\n");
+    TIMEZONE("vorticity_equation::step_low_storage_RK3");
+    assert(this->rvorticity == nullptr);
+    const bool adaptive = (this->CFL_number > 0);
+    if (!adaptive)
+        this->update_integrating_factors(dt);
+    const double A[3] = {0., -5./9, -153./128};
+    const double B[3] = {1./3, 15./16, 8./15};
+    for (int substep = 0; substep < 3; substep++)
+    {
+        /* the last substep also projects the result onto divergence free
+         * fields, as `force_divfree` would */
+        const bool last = (substep == 2);
+        this->omega_nonlin(
+                0,
+                [&](ptrdiff_t cindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex,
+                    double k2,
+                    rnumber nonlin[3][2]){
+            if (k2 <= this->kk->kM2 && (k2 > 0 || !last))
+            {
+                double factors[3];
+                this->get_integrating_factors(k2, dt, factors);
+                for (int cc=0; cc<3; cc++) for (int i=0; i<2; i++)
+                {
+                    /* the register is not read in the first substep, it
+                     * may hold anything */
+                    const double qq = factors[substep]*(
+                            (substep == 0 ? 0. : A[substep]*this->v[1]->cval(cindex,cc,i)) +
+                            dt*nonlin[cc][i]);
+                    this->v[1]->cval(cindex,cc,i) = qq;
+                    this->v[0]->cval(cindex,cc,i) = (
+                            factors[substep]*this->v[0]->cval(cindex,cc,i) +
+                            B[substep]*qq);
+                }
+                if (last)
+                    this->kk->template project_divfree<rnumber>(
+                            this->v[0]->get_cdata()+3*cindex,
+                            xindex, yindex, zindex, k2);
+            }
+            else
+            {
+                std::fill_n((rnumber*)(this->v[0]->get_cdata()+3*cindex), 6, 0.0);
+                std::fill_n((rnumber*)(this->v[1]->get_cdata()+3*cindex), 6, 0.0);
+            }
+        },
+        (adaptive && substep == 0) ? &dt : nullptr);
+    }
+
+    this->cvorticity->symmetrize();
+    this->step_dt = dt;
     this->iteration++;
 }
 
@@ -446,22 +814,35 @@ void vorticity_equation<rnumber, be>::compute_pressure(field<rnumber, be, ONE> *
     pressure->real_space_representation = false;
     /* assume velocity is already in real space representation */
 
+    /* diagonal terms 11 22 33 go in v[1], off-diagonal terms 12 23 31 go in
+     * a scratch field, and both are transformed at once */
+    auto uu_offdiag = this->pool->template get<THREE>();
     this->v[1]->real_space_representation = true;
-    /* diagonal terms 11 22 33 */
-    this->v[1]->RLOOP (
+    uu_offdiag->real_space_representation = true;
+    this->v[1]->RLOOP_ROWS(
                 [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
+                    ptrdiff_t nx,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = this->u->rval(rindex,cc)*this->u->rval(rindex,cc);
-            //this->v[1]->get_rdata()[tindex+cc] = this->u->get_rdata()[tindex+cc]*this->u->get_rdata()[tindex+cc];
+        const rnumber *__restrict__ uu = this->u->get_rdata() + 3*rindex;
+        rnumber *__restrict__ diag = this->v[1]->get_rdata() + 3*rindex;
+        rnumber *__restrict__ offdiag = uu_offdiag->get_rdata() + 3*rindex;
+        #pragma omp simd
+        for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+        {
+            const rnumber u0 = uu[3*xindex+0], u1 = uu[3*xindex+1], u2 = uu[3*xindex+2];
+            diag[3*xindex+0] = u0*u0;
+            diag[3*xindex+1] = u1*u1;
+            diag[3*xindex+2] = u2*u2;
+            offdiag[3*xindex+0] = u0*u1;
+            offdiag[3*xindex+1] = u1*u2;
+            offdiag[3*xindex+2] = u2*u0;
         }
-        );
-    //this->clean_up_real_space(this->rv[1], 3);
-    this->v[1]->dft();
+    }
+    );
+    field<rnumber, be, THREE>::dft_many({this->v[1], uu_offdiag.get()}, this->pool);
     this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
+    this->kk->template dealias<rnumber, THREE>(uu_offdiag->get_cdata());
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
@@ -477,46 +858,15 @@ void vorticity_equation<rnumber, be>::compute_pressure(field<rnumber, be, ONE> *
                     -(this->kk->kx[xindex]*this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][i] +
                       this->kk->ky[yindex]*this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][i] +
                       this->kk->kz[zindex]*this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][i]);
-            }
-        }
-        else
-            std::fill_n((rnumber*)(pressure->get_cdata()+cindex), 2, 0.0);
-    }
-    );
-    /* off-diagonal terms 12 23 31 */
-    this->v[1]->real_space_representation = true;
-    this->v[1]->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = this->u->rval(rindex,cc)*this->u->rval(rindex,(cc+1)%3);
-            //this->v[1]->get_rdata()[tindex+cc] = this->u->get_rdata()[tindex+cc]*this->u->get_rdata()[tindex+(cc+1)%3];
-    }
-    );
-    //this->clean_up_real_space(this->rv[1], 3);
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-        if (k2 <= this->kk->kM2 && k2 > 0)
-        {
-            ptrdiff_t tindex = 3*cindex;
-            for (int i=0; i<2; i++)
-            {
                 pressure->get_cdata()[cindex][i] -= \
-                    2*(this->kk->kx[xindex]*this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][i] +
-                       this->kk->ky[yindex]*this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][i] +
-                       this->kk->kz[zindex]*this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][i]);
+                    2*(this->kk->kx[xindex]*this->kk->ky[yindex]*uu_offdiag->get_cdata()[tindex+0][i] +
+                       this->kk->ky[yindex]*this->kk->kz[zindex]*uu_offdiag->get_cdata()[tindex+1][i] +
+                       this->kk->kz[zindex]*this->kk->kx[xindex]*uu_offdiag->get_cdata()[tindex+2][i]);
                 pressure->get_cdata()[cindex][i] /= pressure->npoints*k2;
             }
         }
+        else
+            std::fill_n((rnumber*)(pressure->get_cdata()+cindex), 2, 0.0);
     }
     );
 }
@@ -531,15 +881,11 @@ template <class rnumber,
 void vorticity_equation<rnumber, be>::compute_Lagrangian_acceleration(
         field<rnumber, be, THREE> *acceleration)
 {
-    field<rnumber, be, ONE> *pressure = new field<rnumber, be, ONE>(
-            this->cvelocity->rlayout->sizes[2],
-            this->cvelocity->rlayout->sizes[1],
-            this->cvelocity->rlayout->sizes[0],
-            this->cvelocity->rlayout->comm,
-            this->cvelocity->fftw_plan_rigor);
+    TIMEZONE("vorticity_equation::compute_Lagrangian_acceleration");
+    auto pressure = this->pool->template get<ONE>();
     this->compute_velocity(this->cvorticity);
     this->cvelocity->ift();
-    this->compute_pressure(pressure);
+    this->compute_pressure(pressure.get());
     this->compute_velocity(this->cvorticity);
     acceleration->real_space_representation = false;
     *acceleration = 0.0;
@@ -558,7 +904,7 @@ void vorticity_equation<rnumber, be>::compute_Lagrangian_acceleration(
                         - this->nu*k2*this->cvelocity->get_cdata()[tindex+cc][i];
             if (strcmp(this->forcing_type, "linear") == 0)
             {
-                double knorm = sqrt(k2);
+                const double knorm = this->kk->knorm[cindex];
                 if ((this->fk0 <= knorm) &&
                         (this->fk1 >= knorm))
                     for (int c=0; c<3; c++)
@@ -574,7 +920,6 @@ void vorticity_equation<rnumber, be>::compute_Lagrangian_acceleration(
             acceleration->get_cdata()[tindex+2][1] -= this->kk->kz[zindex]*pressure->get_cdata()[cindex][0];
         }
         });
-    delete pressure;
 }
 
 template <class rnumber,
@@ -600,7 +945,7 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
                         - this->nu*k2*this->cvelocity->get_cdata()[tindex+cc][i];
             if (strcmp(this->forcing_type, "linear") == 0)
             {
-                double knorm = sqrt(k2);
+                const double knorm = this->kk->knorm[cindex];
                 if ((this->fk0 <= knorm) &&
                         (this->fk1 >= knorm))
                 {
@@ -615,22 +960,36 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
     );
     this->cvelocity->ift();
     /* compute uu */
-    /* 11 22 33 */
+    /* 11 22 33 go in v[1], 12 23 31 go in a scratch field,
+     * and both are transformed at once */
+    auto uu_offdiag = this->pool->template get<THREE>();
     this->v[1]->real_space_representation = true;
-    this->cvelocity->RLOOP (
+    uu_offdiag->real_space_representation = true;
+    const rnumber npoints = this->cvelocity->npoints;
+    this->cvelocity->RLOOP_ROWS(
                 [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
+                    ptrdiff_t nx,
                     ptrdiff_t yindex,
                     ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = \
-                this->cvelocity->rval(rindex,cc)*this->cvelocity->rval(rindex,cc) / this->cvelocity->npoints;
-            //this->v[1]->get_rdata()[tindex+cc] = this->cvelocity->get_rdata()[tindex+cc]*this->cvelocity->get_rdata()[tindex+cc] / this->cvelocity->npoints;
+        const rnumber *__restrict__ uu = this->cvelocity->get_rdata() + 3*rindex;
+        rnumber *__restrict__ diag = this->v[1]->get_rdata() + 3*rindex;
+        rnumber *__restrict__ offdiag = uu_offdiag->get_rdata() + 3*rindex;
+        #pragma omp simd
+        for (ptrdiff_t xindex = 0; xindex < nx; xindex++)
+        {
+            const rnumber u0 = uu[3*xindex+0], u1 = uu[3*xindex+1], u2 = uu[3*xindex+2];
+            diag[3*xindex+0] = u0*u0 / npoints;
+            diag[3*xindex+1] = u1*u1 / npoints;
+            diag[3*xindex+2] = u2*u2 / npoints;
+            offdiag[3*xindex+0] = u0*u1 / npoints;
+            offdiag[3*xindex+1] = u1*u2 / npoints;
+            offdiag[3*xindex+2] = u2*u0 / npoints;
+        }
     }
     );
-    this->v[1]->dft();
+    field<rnumber, be, THREE>::dft_many({this->v[1], uu_offdiag.get()}, this->pool);
     this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
+    this->kk->template dealias<rnumber, THREE>(uu_offdiag->get_cdata());
     this->kk->CLOOP_K2(
                 [&](ptrdiff_t cindex,
                     ptrdiff_t xindex,
@@ -640,6 +999,7 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
         if (k2 <= this->kk->kM2)
         {
             ptrdiff_t tindex = 3*cindex;
+            /* 11 22 33 */
             acceleration->get_cdata()[tindex+0][0] +=
                     this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][1];
             acceleration->get_cdata()[tindex+0][1] +=
@@ -652,52 +1012,25 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
                     this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][1];
             acceleration->get_cdata()[tindex+2][1] +=
                    -this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][0];
-        }
-    }
-    );
-    /* 12 23 31 */
-    this->v[1]->real_space_representation = true;
-    this->cvelocity->RLOOP (
-                [&](ptrdiff_t rindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex){
-        //ptrdiff_t tindex = 3*rindex;
-        for (int cc=0; cc<3; cc++)
-            this->v[1]->rval(rindex,cc) = \
-                this->cvelocity->rval(rindex,cc)*this->cvelocity->rval(rindex,(cc+1)%3) / this->cvelocity->npoints;
-            //this->v[1]->get_rdata()[tindex+cc] = this->cvelocity->get_rdata()[tindex+cc]*this->cvelocity->get_rdata()[tindex+(cc+1)%3] / this->cvelocity->npoints;
-    }
-    );
-    this->v[1]->dft();
-    this->kk->template dealias<rnumber, THREE>(this->v[1]->get_cdata());
-    this->kk->CLOOP_K2(
-                [&](ptrdiff_t cindex,
-                    ptrdiff_t xindex,
-                    ptrdiff_t yindex,
-                    ptrdiff_t zindex,
-                    double k2){
-        if (k2 <= this->kk->kM2)
-        {
-            ptrdiff_t tindex = 3*cindex;
+            /* 12 23 31 */
             acceleration->get_cdata()[tindex+0][0] +=
-                    (this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][1] +
-                     this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][1]);
+                    (this->kk->ky[yindex]*uu_offdiag->get_cdata()[tindex+0][1] +
+                     this->kk->kz[zindex]*uu_offdiag->get_cdata()[tindex+2][1]);
             acceleration->get_cdata()[tindex+0][1] +=
-                  - (this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+0][0] +
-                     this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+2][0]);
+                  - (this->kk->ky[yindex]*uu_offdiag->get_cdata()[tindex+0][0] +
+                     this->kk->kz[zindex]*uu_offdiag->get_cdata()[tindex+2][0]);
             acceleration->get_cdata()[tindex+1][0] +=
-                    (this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][1] +
-                     this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][1]);
+                    (this->kk->kz[zindex]*uu_offdiag->get_cdata()[tindex+1][1] +
+                     this->kk->kx[xindex]*uu_offdiag->get_cdata()[tindex+0][1]);
             acceleration->get_cdata()[tindex+1][1] +=
-                  - (this->kk->kz[zindex]*this->v[1]->get_cdata()[tindex+1][0] +
-                     this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+0][0]);
+                  - (this->kk->kz[zindex]*uu_offdiag->get_cdata()[tindex+1][0] +
+                     this->kk->kx[xindex]*uu_offdiag->get_cdata()[tindex+0][0]);
             acceleration->get_cdata()[tindex+2][0] +=
-                    (this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][1] +
-                     this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][1]);
+                    (this->kk->kx[xindex]*uu_offdiag->get_cdata()[tindex+2][1] +
+                     this->kk->ky[yindex]*uu_offdiag->get_cdata()[tindex+1][1]);
             acceleration->get_cdata()[tindex+2][1] +=
-                  - (this->kk->kx[xindex]*this->v[1]->get_cdata()[tindex+2][0] +
-                     this->kk->ky[yindex]*this->v[1]->get_cdata()[tindex+1][0]);
+                  - (this->kk->kx[xindex]*uu_offdiag->get_cdata()[tindex+2][0] +
+                     this->kk->ky[yindex]*uu_offdiag->get_cdata()[tindex+1][0]);
         }
     }
     );
@@ -716,5 +1049,7 @@ void vorticity_equation<rnumber, be>::compute_Eulerian_acceleration(
 /* finally, force generation of code for single precision                    */
 template class vorticity_equation<float, FFTW>;
 template class vorticity_equation<double, FFTW>;
+template class vorticity_equation<float, PENCIL>;
+template class vorticity_equation<double, PENCIL>;
 /*****************************************************************************/
 
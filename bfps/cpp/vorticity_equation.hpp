@@ -26,8 +26,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <iostream>
+#include <cmath>
+#include <thread>
 
 #include "field.hpp"
+#include "field_pool.hpp"
 #include "field_descriptor.hpp"
 
 #ifndef VORTICITY_EQUATION
@@ -61,6 +64,16 @@ class vorticity_equation
         field<rnumber, be, THREE> *rvorticity;
         kspace<be, SMOOTH> *kk;
 
+        /* scratch fields for statistics and postprocessing.
+         * they are freed when released, see `field_pool::reserve` */
+        field_pool<rnumber, be> *pool;
+
+        /* asynchronous checkpoints, see `use_async_checkpoints`.
+         * checkpoint_buffer is nullptr for synchronous checkpoints */
+        field<rnumber, be, THREE> *checkpoint_buffer;
+        MPI_Comm checkpoint_comm;
+        std::thread checkpoint_writer;
+
 
         /* short names for velocity, and 4 vorticity fields */
         field<rnumber, be, THREE> *u, *v[4];
@@ -72,6 +85,30 @@ class vorticity_equation
         double fk0, fk1;   // for band forcing
         char forcing_type[128];
 
+        /* time stepping scheme, either "RK3" (the default) or
+         * "low_storage_RK3" */
+        char time_stepper[128];
+
+        /* adaptive time stepping: if CFL_number > 0, `step(dt)` uses at most
+         * dt, and at most CFL_number / max(|u_x|/dx + |u_y|/dy + |u_z|/dz),
+         * with the maximum taken over the velocity that the first substep
+         * brings to real space anyway.
+         * the time step actually used is stored in step_dt. */
+        double CFL_number;
+        double step_dt;
+
+        /* integrating factors exp(-nu k2 f dt) for the three fractions f of
+         * the time step used by the time stepper, i.e. 1, 1/2 and -1/2 for
+         * "RK3", and the lengths 1/3, 5/12 and 1/4 of the substeps for
+         * "low_storage_RK3" */
+        double integrating_factors_fractions[3];
+        /* integrating factors on the shells k2 = n*dk2, for the nu and dt
+         * they were computed with.
+         * only used if every k2 is a multiple of dk2 */
+        std::vector<double> integrating_factors;
+        double integrating_factors_nu, integrating_factors_dt;
+        bool integrating_factors_on_shells;
+
         /* constructor, destructor */
         vorticity_equation(
                 const char *NAME,
@@ -81,12 +118,41 @@ class vorticity_equation
                 double DKX = 1.0,
                 double DKY = 1.0,
                 double DKZ = 1.0,
-                unsigned FFTW_PLAN_RIGOR = FFTW_MEASURE);
+                unsigned FFTW_PLAN_RIGOR = FFTW_MEASURE,
+                const char *TIME_STEPPER = "RK3");
         ~vorticity_equation(void);
 
         /* solver essential methods */
+        void update_integrating_factors(double dt);
+        inline void get_integrating_factors(
+                const double k2,
+                const double dt,
+                double factors[3]) const
+        {
+            if (this->integrating_factors_on_shells)
+            {
+                const size_t shell = size_t(k2 / this->kk->dk2 + 0.5);
+                assert(3*shell+2 < this->integrating_factors.size());
+                factors[0] = this->integrating_factors[3*shell+0];
+                factors[1] = this->integrating_factors[3*shell+1];
+                factors[2] = this->integrating_factors[3*shell+2];
+            }
+            else
+            {
+                for (int i=0; i<3; i++)
+                    factors[i] = exp(-this->nu * k2 * dt * this->integrating_factors_fractions[i]);
+            }
+        }
         void omega_nonlin(int src);
+        /* computes the nonlinear term for v[src], and calls
+         * update(cindex, xindex, yindex, zindex, k2, nonlin) for every mode,
+         * within the same sweep over Fourier space.
+         * if dt is not null, *dt is reduced to satisfy the CFL condition
+         * before the sweep (see CFL_number) */
+        template <class update_type>
+        void omega_nonlin(int src, update_type update, double *dt = nullptr);
         void step(double dt);
+        void step_low_storage_RK3(double dt);
         void impose_zero_modes(void);
         void add_forcing(field<rnumber, be, THREE> *dst,
                          field<rnumber, be, THREE> *src_vorticity,
@@ -104,9 +170,27 @@ class vorticity_equation
                     std::string(".h5"));
         }
         void update_checkpoint(void);
+        /* from now on, `io_checkpoint(false)` copies the vorticity to
+         * checkpoint_buffer and writes it from a background thread, while
+         * the time stepping goes on.
+         * the background thread uses a duplicate of the communicator, so
+         * it needs MPI_THREAD_MULTIPLE and a thread-safe HDF5 build;
+         * returns false, and leaves checkpoints synchronous, otherwise. */
+        bool use_async_checkpoints(void);
+        /* from now on, the transforms of the solver fields skip the modes
+         * outside the dealiasing sphere */
+        void use_truncated_transforms(void);
+        void write_checkpoint_async(void);
+        /* waits for the pending asynchronous checkpoint, if any */
+        void wait_for_checkpoint(void);
         inline void io_checkpoint(bool read = true)
         {
             assert(!this->cvorticity->real_space_representation);
+            if (!read && this->checkpoint_buffer != nullptr)
+            {
+                this->write_checkpoint_async();
+                return;
+            }
             if (!read)
                 this->update_checkpoint();
             std::string fname = this->get_current_fname();
@@ -0,0 +1,213 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+"""Coefficient tables of the interpolation kernels.
+
+`bfps/cpp/spline_n*.cpp` and `bfps/cpp/Lagrange_polys.cpp` hold the
+coefficients of the kernel polynomials in powers of t = x - 1/2, which
+`evaluate_beta_polynomials` (see `bfps/cpp/beta_polynomials.hpp`)
+evaluates with Horner's scheme, in single or double precision.
+The tables are computed here, with exact rational arithmetic, from the
+polynomials in powers of x as they were written in those sources before
+the tables were introduced (each poly_val[i] given as a Horner expression
+in x).
+Those sources are read from the git history:
+
+    python beta_polynomials.py REVISION tables OUTDIR
+        writes the table sources into OUTDIR
+    python beta_polynomials.py REVISION reference
+        prints the reference values used in tests/test_beta_polynomials.cpp
+
+where REVISION is any revision older than the tables.
+"""
+
+import os
+import re
+import sys
+import subprocess
+from fractions import Fraction
+
+source_names = (['spline_n{0}.cpp'.format(n) for n in range(1, 11)] +
+                ['Lagrange_polys.cpp'])
+
+class polynomial:
+    """polynomial with rational coefficients, lowest degree first"""
+    def __init__(self, coefficients):
+        self.c = [Fraction(v) for v in coefficients]
+        while len(self.c) > 1 and self.c[-1] == 0:
+            self.c.pop()
+    @staticmethod
+    def lift(other):
+        if isinstance(other, polynomial):
+            return other
+        return polynomial([other])
+    def __add__(self, other):
+        other = polynomial.lift(other)
+        n = max(len(self.c), len(other.c))
+        return polynomial(
+                [(self.c[i] if i < len(self.c) else 0) +
+                 (other.c[i] if i < len(other.c) else 0)
+                 for i in range(n)])
+    __radd__ = __add__
+    def __neg__(self):
+        return polynomial([-v for v in self.c])
+    def __pos__(self):
+        return self
+    def __sub__(self, other):
+        return self + (-polynomial.lift(other))
+    def __rsub__(self, other):
+        return polynomial.lift(other) - self
+    def __mul__(self, other):
+        other = polynomial.lift(other)
+        result = [Fraction(0)]*(len(self.c) + len(other.c) - 1)
+        for i, a in enumerate(self.c):
+            for j, b in enumerate(other.c):
+                result[i+j] += a*b
+        return polynomial(result)
+    __rmul__ = __mul__
+    def __truediv__(self, other):
+        other = polynomial.lift(other)
+        assert(len(other.c) == 1)
+        return polynomial([v / other.c[0] for v in self.c])
+    def __rtruediv__(self, other):
+        assert(len(self.c) == 1)
+        return polynomial([Fraction(other) / self.c[0]])
+    def __pow__(self, n):
+        result = polynomial([1])
+        for i in range(n):
+            result = result*self
+        return result
+    def __call__(self, x):
+        result = Fraction(0)
+        for v in reversed(self.c):
+            result = result*x + v
+        return result
+    def shift(self, a):
+        """coefficients of q(t) = p(t + a)"""
+        result = polynomial([0])
+        for v in reversed(self.c):
+            result = result*polynomial([a, 1]) + v
+        return result
+
+def read_expression(expr):
+    """C++ expression in x (as written by sympy) to polynomial"""
+    expr = re.sub(r'(\d+)\.0L', r'Fraction(\1)', expr)
+    expr = re.sub(r'pow\(x, (\d+)\)', r'(x**\1)', expr)
+    expr = re.sub(r'(?<![\w(])(\d+)(?![\w)])', r'Fraction(\1)', expr)
+    return polynomial.lift(eval(expr, {'Fraction': Fraction,
+                                       'x': polynomial([0, 1])}))
+
+def read_source(src):
+    """returns {function name: {deriv: [polynomials]}}"""
+    functions = {}
+    for m in re.finditer(
+            r'void (beta_\w+)\(int deriv, double x, double \*poly_val\)\s*\{(.*?)\n\}',
+            src, re.S):
+        cases = {}
+        for case in re.finditer(r'case (\d+):(.*?)break;', m.group(2), re.S):
+            values = {}
+            for line in re.finditer(r'poly_val\[(\d+)\] = (.*?);', case.group(2)):
+                values[int(line.group(1))] = read_expression(line.group(2))
+            cases[int(case.group(1))] = [values[i] for i in range(len(values))]
+        functions[m.group(1)] = cases
+    return functions
+
+def get_source(revision, name):
+    return subprocess.check_output(
+            ['git', 'show', '{0}:bfps/cpp/{1}'.format(revision, name)]).decode()
+
+def kernel_name(function_name):
+    m = re.match(r'beta_n(\d+)_m(\d+)$', function_name)
+    if m:
+        return 'spline', (int(m.group(1)), int(m.group(2)))
+    m = re.match(r'beta_Lagrange_n(\d+)$', function_name)
+    return 'Lagrange', (int(m.group(1)),)
+
+def write_table(kind, args, polys):
+    centered = [p.shift(Fraction(1, 2)) for p in polys]
+    degree = max(len(p.c) for p in centered) - 1
+    nb_values = len(centered)
+    rows = []
+    for k in reversed(range(degree+1)):
+        values = [repr(float(p.c[k])) if (k < len(p.c) and p.c[k] != 0) else '0'
+                  for p in centered]
+        lines = [', '.join(values[i:i+4]) for i in range(0, nb_values, 4)]
+        rows.append('        {' + ',\n         '.join(lines) + '}')
+    name = '{0}_polynomials<{1}>'.format(kind, ', '.join(str(a) for a in args))
+    text = ('template <>\nstruct {0}\n{{\n'
+            '    static constexpr int degree = {1};\n'
+            '    static constexpr int nb_values = {2};\n'
+            '    static constexpr double coefficients[degree+1][nb_values] = {{\n'
+            '{3}}};\n}};\n'
+            'constexpr double {0}::coefficients[{4}][{2}];\n').format(
+                name, degree, nb_values, ',\n'.join(rows), degree+1)
+    return text, name
+
+def write_source(src):
+    head = src[:src.index('#include')]
+    own_header = re.search(r'#include "(\w+\.hpp)"', src).group(1)
+    out = [head + '#include "{0}"\n#include "beta_polynomials.hpp"\n\n'.format(own_header)]
+    for function_name, cases in read_source(src).items():
+        kind, args = kernel_name(function_name)
+        calls = []
+        for deriv in sorted(cases):
+            text, name = write_table(kind, args + (deriv,), cases[deriv])
+            out.append(text + '\n')
+            calls.append(('    case {0}:\n'
+                          '        evaluate_beta_polynomials<{1}>(x, poly_val);\n'
+                          '        break;\n').format(deriv, name))
+        out.append(('template <class real_number>\n'
+                    'void {0}(const int deriv, const real_number x, real_number *__restrict__ poly_val)\n{{\n'
+                    '    switch(deriv)\n    {{\n{1}    }}\n}}\n\n'
+                    'template void {0}<float>(const int deriv, const float x, float *__restrict__ poly_val);\n'
+                    'template void {0}<double>(const int deriv, const double x, double *__restrict__ poly_val);\n\n').format(
+                        function_name, ''.join(calls)))
+    return ''.join(out).rstrip('\n') + '\n\n'
+
+def write_reference(revision, x = Fraction(3, 10)):
+    """central values of each kernel and of its derivatives at x"""
+    lines = []
+    for source_name in source_names:
+        for function_name, cases in read_source(get_source(revision, source_name)).items():
+            kind, args = kernel_name(function_name)
+            center = len(cases[0]) // 2 - 1
+            values = [float(cases[deriv][center](x)) for deriv in sorted(cases)]
+            lines.append('    {{"{0}", {0}, {0}, {1}, {{{2}}}}},'.format(
+                function_name, args[0],
+                ', '.join(repr(v) for v in values)))
+    return '\n'.join(lines)
+
+def main():
+    revision = sys.argv[1]
+    if sys.argv[2] == 'tables':
+        outdir = sys.argv[3]
+        for source_name in source_names:
+            with open(os.path.join(outdir, source_name), 'w') as outfile:
+                outfile.write(write_source(get_source(revision, source_name)))
+    elif sys.argv[2] == 'reference':
+        print(write_reference(revision))
+    return None
+
+if __name__ == '__main__':
+    main()
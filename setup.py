@@ -102,7 +102,11 @@ src_file_list = ['full_code/joint_acc_vel_stats',
                  'field_binary_IO',
                  'vorticity_equation',
                  'field',
+                 'rspace_stats',
                  'kspace',
+                 'pencil_fft',
+                 'truncated_fft',
+                 'numa_tools',
                  'field_layout',
                  'field_descriptor',
                  'rFFTW_distributed_particles',
@@ -158,7 +162,9 @@ header_list = (['cpp/base.hpp'] +
                ['cpp/bfps_timer.hpp'] +
                ['cpp/omputils.hpp'] +
                ['cpp/shared_array.hpp'] +
+               ['cpp/field_pool.hpp'] +
                ['cpp/spline.hpp'] +
+               ['cpp/beta_polynomials.hpp'] +
                ['cpp/' + fname + '.hpp'
                 for fname in src_file_list] +
                particle_headers +
@@ -183,16 +189,19 @@ class CompileLibCommand(distutils.cmd.Command):
             ('timing-output=', None, 'Toggle timing output.'),
             ('fftw-estimate=', None, 'Use FFTW ESTIMATE.'),
             ('disable-fftw-omp=', None, 'Turn Off FFTW OpenMP.'),
+            ('single-precision-particles=', None, 'Store and exchange particles in single precision.'),
             ]
     def initialize_options(self):
         self.timing_output = 0
         self.fftw_estimate = 0
         self.disable_fftw_omp = 0
+        self.single_precision_particles = 0
         return None
     def finalize_options(self):
         self.timing_output = (int(self.timing_output) == 1)
         self.fftw_estimate = (int(self.fftw_estimate) == 1)
         self.disable_fftw_omp = (int(self.disable_fftw_omp) == 1)
+        self.single_precision_particles = (int(self.single_precision_particles) == 1)
         return None
     def run(self):
         if not os.path.isdir('obj'):
@@ -219,6 +228,8 @@ class CompileLibCommand(distutils.cmd.Command):
             eca += ['-DUSE_FFTWESTIMATE']
         if self.disable_fftw_omp:
             eca += ['-DNO_FFTWOMP']
+        if self.single_precision_particles:
+            eca += ['-DBFPS_SINGLE_PRECISION_PARTICLES']
         for fname in src_file_list:
             ifile = 'bfps/cpp/' + fname + '.cpp'
             ofile = 'obj/' + fname + '.o'
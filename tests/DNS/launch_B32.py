@@ -0,0 +1,56 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import sys
+
+import bfps
+from bfps import DNS
+
+def launch_from_B32(
+        code,
+        simname,
+        extra_arguments = []):
+    """Launch `code` from the 32^3 initial condition that is shipped with
+    bfps, in the current folder.
+    Command line arguments of the test are passed on after the
+    `extra_arguments`, so they can override any of the parameters
+    (e.g. `--np 1`).
+    Returns the `DNS` object, for the names of its files."""
+    c = DNS()
+    c.launch(
+            [code,
+             '-n', '32',
+             '--src-simname', 'B32p1e4',
+             '--src-wd', bfps.lib_dir + '/test',
+             '--src-iteration', '0',
+             '--simname', simname,
+             '--np', '4',
+             '--ntpp', '1',
+             '--wd', './'] +
+             extra_arguments +
+             sys.argv[1:])
+    return c
@@ -0,0 +1,86 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import numpy as np
+import h5py
+
+from launch_B32 import launch_from_B32
+
+def run_NSVE(
+        time_stepper,
+        dt,
+        niterations,
+        precision = 'double'):
+    c = launch_from_B32(
+            'NSVE',
+            'ls_{0}_{1}_{2}'.format(time_stepper, niterations, precision),
+            ['--dt', '{0}'.format(dt),
+             '--time_stepper', time_stepper,
+             '--niter_todo', '{0}'.format(niterations),
+             '--niter_out', '{0}'.format(niterations),
+             '--niter_stat', '1',
+             '--precision', precision])
+    with h5py.File(c.get_checkpoint_0_fname(), 'r') as data_file:
+        vorticity = data_file['vorticity/complex/{0}'.format(niterations)][...]
+    return vorticity
+
+def relative_difference(field0, field1):
+    return np.sqrt(np.sum(np.abs(field0 - field1)**2) /
+                   np.sum(np.abs(field0)**2))
+
+def main():
+    """low_storage_RK3 and RK3 are both third order schemes, so their
+    difference after a fixed time must shrink by about 8 when the time step
+    is halved.
+    The low storage scheme sends the vorticity itself to real space and back
+    at each substep, which costs about one single precision epsilon per
+    substep (RK3 only adds the roundoff of the nonlinear term)."""
+    dt = 0.01
+    niterations = 8
+    differences = []
+    for refinement in [1, 2]:
+        fields = [run_NSVE(time_stepper,
+                           dt / refinement,
+                           niterations*refinement)
+                  for time_stepper in ['RK3', 'low_storage_RK3']]
+        differences.append(relative_difference(fields[0], fields[1]))
+    print('relative differences between the schemes {0}'.format(differences))
+    assert(differences[0] < 1e-3)
+    assert(differences[0] / differences[1] > 4)
+    roundoff = {}
+    for time_stepper in ['RK3', 'low_storage_RK3']:
+        roundoff[time_stepper] = relative_difference(
+                run_NSVE(time_stepper, dt, niterations, 'double'),
+                run_NSVE(time_stepper, dt, niterations, 'single'))
+    print('single precision roundoff {0}'.format(roundoff))
+    assert(roundoff['RK3'] < niterations*np.finfo(np.float32).eps)
+    assert(roundoff['low_storage_RK3'] < 2*3*niterations*np.finfo(np.float32).eps)
+    print('SUCCESS! low_storage_RK3 agrees with RK3.')
+    return None
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,71 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import numpy as np
+import h5py
+
+from launch_B32 import launch_from_B32
+
+def main():
+    """Sorting the tracers by cell only changes their order in memory, the
+    output (which is ordered by particle index) must not change."""
+    niterations = 16
+    nparticles = 10000
+    runs = []
+    for sort_threshold in [0, 0.001]:
+        runs.append(launch_from_B32(
+                'NSVEparticles',
+                'sort{0}'.format(int(sort_threshold > 0)),
+                ['--niter_todo', '{0}'.format(niterations),
+                 '--niter_out', '{0}'.format(niterations),
+                 '--niter_stat', '1',
+                 '--niter_part', '4',
+                 '--nparticles', '{0}'.format(nparticles),
+                 '--particle-rand-seed', '2',
+                 '--tracers0_sort_threshold', '{0}'.format(sort_threshold)]))
+    f0 = h5py.File(runs[0].get_checkpoint_0_fname(), 'r')
+    f1 = h5py.File(runs[1].get_checkpoint_0_fname(), 'r')
+    for group in ['tracers0/state/{0}', 'tracers0/rhs/{0}']:
+        x0 = f0[group.format(niterations)][...]
+        x1 = f1[group.format(niterations)][...]
+        assert(np.max(np.abs(x0 - x1)) < 1e-10)
+    f0 = h5py.File(runs[0].get_particle_file_name(), 'r')
+    f1 = h5py.File(runs[1].get_particle_file_name(), 'r')
+    for quantity in ['velocity', 'acceleration']:
+        group0 = f0['tracers0/' + quantity]
+        group1 = f1['tracers0/' + quantity]
+        assert(len(group0.keys()) > 1)
+        assert(sorted(group0.keys()) == sorted(group1.keys()))
+        for iteration in group0.keys():
+            y0 = group0[iteration][...]
+            y1 = group1[iteration][...]
+            assert(np.max(np.abs(y0 - y1)) < 1e-10)
+    print('SUCCESS! Sorted tracer output matches unsorted output.')
+    return None
+
+if __name__ == '__main__':
+    main()
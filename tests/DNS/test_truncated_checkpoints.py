@@ -0,0 +1,58 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import numpy as np
+import h5py
+
+from launch_B32 import launch_from_B32
+
+def main():
+    """A run that restarts from truncated checkpoints must reproduce the
+    statistics of a run that uses full checkpoints."""
+    niterations = 8
+    njobs = 2
+    statistics = []
+    for truncated in [0, 1]:
+        c = launch_from_B32(
+                'NSVE',
+                'truncated{0}'.format(truncated),
+                ['--truncated_checkpoints', '{0}'.format(truncated),
+                 '--niter_todo', '{0}'.format(niterations),
+                 '--niter_out', '{0}'.format(niterations),
+                 '--niter_stat', '1',
+                 '--njobs', '{0}'.format(njobs)])
+        with h5py.File(c.get_data_file_name(), 'r') as data_file:
+            statistics.append(
+                    [data_file['statistics/moments/vorticity'][:njobs*niterations+1],
+                     data_file['statistics/spectra/velocity_velocity'][:njobs*niterations+1]])
+    for full, truncated in zip(statistics[0], statistics[1]):
+        assert(np.max(np.abs(full - truncated)) <= 1e-5*np.max(np.abs(full)))
+    print('SUCCESS! Restart from truncated checkpoints passed.')
+    return None
+
+if __name__ == '__main__':
+    main()
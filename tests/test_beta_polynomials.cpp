@@ -0,0 +1,207 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Checks of the interpolation kernels of `spline.hpp` and
+ * `Lagrange_polys.hpp`: the kernels sum to 1 and their derivatives sum to 0
+ * for any x in [0, 1], and the central value of each kernel and of its
+ * derivatives matches the one computed with exact rational arithmetic from
+ * the original form of the polynomials (see meta/beta_polynomials.py).
+ * The single precision kernels must agree with the double precision ones;
+ * the smoothest high order splines lose a few digits in their second
+ * derivatives (about 5e-5 relative for beta_n6_m12).
+ * Returns EXIT_FAILURE if any check fails, see test_beta_polynomials.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include "spline.hpp"
+#include "Lagrange_polys.hpp"
+
+struct kernel_reference
+{
+    const char *name;
+    void (*beta)(int deriv, double x, double *poly_val);
+    void (*beta_float)(int deriv, float x, float *poly_val);
+    int neighbours;
+    /* value at x = 0.3 of poly_val[neighbours], for deriv 0, 1 and 2 */
+    double center_values[3];
+};
+
+/* python meta/beta_polynomials.py REVISION reference */
+const kernel_reference kernels[] = {
+    {"beta_n1_m0", beta_n1_m0, beta_n1_m0, 1, {0.7, -1.0, 0.0}},
+    {"beta_n1_m1", beta_n1_m1, beta_n1_m1, 1, {0.8155, -1.095, -2.3}},
+    {"beta_n1_m2", beta_n1_m2, beta_n1_m2, 1, {0.84196, -1.1265, -3.62}},
+    {"beta_n2_m0", beta_n2_m0, beta_n2_m0, 2, {0.7, -1.0, 0.0}},
+    {"beta_n2_m1", beta_n2_m1, beta_n2_m1, 2, {0.826, -1.04, -2.2666666666666666}},
+    {"beta_n2_m2", beta_n2_m2, beta_n2_m2, 2, {0.8462125, -1.054875, -3.205}},
+    {"beta_n2_m3", beta_n2_m3, beta_n2_m3, 2, {0.857017, -1.0471575, -3.8959}},
+    {"beta_n2_m4", beta_n2_m4, beta_n2_m4, 2, {0.864472105, -1.027632225, -4.423336}},
+    {"beta_n3_m0", beta_n3_m0, beta_n3_m0, 3, {0.7, -1.0, 0.0}},
+    {"beta_n3_m1", beta_n3_m1, beta_n3_m1, 3, {0.83125, -1.0125, -2.25}},
+    {"beta_n3_m2", beta_n3_m2, beta_n3_m2, 3, {0.8487675, -1.0180416666666667, -3.007222222222222}},
+    {"beta_n3_m3", beta_n3_m3, beta_n3_m3, 3, {0.85681299375, -1.0121341041666667, -3.5198584722222224}},
+    {"beta_n3_m4", beta_n3_m4, beta_n3_m4, 3, {0.8622962775, -0.9977731229166666, -3.9077914722222222}},
+    {"beta_n3_m5", beta_n3_m5, beta_n3_m5, 3, {0.8662907551725, -0.9797028667791666, -4.188582419722223}},
+    {"beta_n3_m6", beta_n3_m6, beta_n3_m6, 3, {0.86929590475665, -0.9603840480239166, -4.376659808662223}},
+    {"beta_n4_m0", beta_n4_m0, beta_n4_m0, 4, {0.7, -1.0, 0.0}},
+    {"beta_n4_m1", beta_n4_m1, beta_n4_m1, 4, {0.8344, -0.996, -2.24}},
+    {"beta_n4_m2", beta_n4_m2, beta_n4_m2, 4, {0.850429125, -0.9956354166666667, -2.891472222222222}},
+    {"beta_n4_m3", beta_n4_m3, beta_n4_m3, 4, {0.8568732375, -0.9907109166666667, -3.299869722222222}},
+    {"beta_n4_m4", beta_n4_m4, beta_n4_m4, 4, {0.861211716946875, -0.9793465441979167, -3.606784039722222}},
+    {"beta_n4_m5", beta_n4_m5, beta_n4_m5, 4, {0.864367195482, -0.9650717603485417, -3.8285977235972224}},
+    {"beta_n4_m6", beta_n4_m6, beta_n4_m6, 4, {0.8667393791812088, -0.9498220079964854, -3.977060921098722}},
+    {"beta_n4_m7", beta_n4_m7, beta_n4_m7, 4, {0.8685595142335298, -0.9346542158938098, -4.063734018828297}},
+    {"beta_n4_m8", beta_n4_m8, beta_n4_m8, 4, {0.8699757675630154, -0.9201544794252673, -4.099702357354914}},
+    {"beta_n5_m0", beta_n5_m0, beta_n5_m0, 5, {0.7, -1.0, 0.0}},
+    {"beta_n5_m1", beta_n5_m1, beta_n5_m1, 5, {0.8365, -0.985, -2.2333333333333334}},
+    {"beta_n5_m2", beta_n5_m2, beta_n5_m2, 5, {0.851588325, -0.9805754166666667, -2.815472222222222}},
+    {"beta_n5_m3", beta_n5_m3, beta_n5_m3, 5, {0.856986844875, -0.9762616404166666, -3.1554529472222224}},
+    {"beta_n5_m4", beta_n5_m4, beta_n5_m4, 5, {0.860577022659375, -0.9668548546979167, -3.4093918947222224}},
+    {"beta_n5_m5", beta_n5_m5, beta_n5_m5, 5, {0.8631852708943406, -0.955055624674698, -3.592737917437847}},
+    {"beta_n5_m6", beta_n5_m6, beta_n5_m6, 5, {0.8651451581878298, -0.9424563492165535, -3.7153975303636972}},
+    {"beta_n5_m7", beta_n5_m7, beta_n5_m7, 5, {0.8666485265428513, -0.9299282795913743, -3.786986499650436}},
+    {"beta_n5_m8", beta_n5_m8, beta_n5_m8, 5, {0.8678180830038056, -0.9179542491577938, -3.8166895208810234}},
+    {"beta_n5_m9", beta_n5_m9, beta_n5_m9, 5, {0.8687373466377802, -0.9067917621738162, -3.812937424415821}},
+    {"beta_n5_m10", beta_n5_m10, beta_n5_m10, 5, {0.8694655648461698, -0.8965620301988213, -3.783214232236659}},
+    {"beta_n6_m0", beta_n6_m0, beta_n6_m0, 6, {0.7, -1.0, 0.0}},
+    {"beta_n6_m1", beta_n6_m1, beta_n6_m1, 6, {0.838, -0.9771428571428571, -2.2285714285714286}},
+    {"beta_n6_m2", beta_n6_m2, beta_n6_m2, 6, {0.852440825, -0.9697599404761905, -2.7617420634920635}},
+    {"beta_n6_m3", beta_n6_m3, beta_n6_m3, 6, {0.857103077, -0.9658601354761904, -3.0533624634920633}},
+    {"beta_n6_m4", beta_n6_m4, beta_n6_m4, 6, {0.86016573557625, -0.9578326592303571, -3.2699454524920637}},
+    {"beta_n6_m5", beta_n6_m5, beta_n6_m5, 6, {0.862388718053175, -0.9477762784168572, -3.42620892658373}},
+    {"beta_n6_m6", beta_n6_m6, beta_n6_m6, 6, {0.8640585807396459, -0.9370414468018857, -3.5307173382639987}},
+    {"beta_n6_m7", beta_n6_m7, beta_n6_m7, 6, {0.865339239074645, -0.926369294010226, -3.5917010685020547}},
+    {"beta_n6_m8", beta_n6_m8, beta_n6_m8, 6, {0.8663354105365096, -0.9161703957101843, -3.6170006611843286}},
+    {"beta_n6_m9", beta_n6_m9, beta_n6_m9, 6, {0.8671183233209003, -0.9066635976140114, -3.61380509879906}},
+    {"beta_n6_m10", beta_n6_m10, beta_n6_m10, 6, {0.8677384849897155, -0.8979518027425591, -3.588492377622928}},
+    {"beta_n6_m11", beta_n6_m11, beta_n6_m11, 6, {0.8682327781928576, -0.8900666492638651, -3.5465727272884346}},
+    {"beta_n6_m12", beta_n6_m12, beta_n6_m12, 6, {0.8686287257981228, -0.8829961563127001, -3.4927023048033687}},
+    {"beta_n7_m0", beta_n7_m0, beta_n7_m0, 7, {0.7, -1.0, 0.0}},
+    {"beta_n7_m1", beta_n7_m1, beta_n7_m1, 7, {0.839125, -0.97125, -2.225}},
+    {"beta_n7_m2", beta_n7_m2, beta_n7_m2, 7, {0.853093325, -0.9616170833333333, -2.7217420634920635}},
+    {"beta_n7_m3", beta_n7_m3, beta_n7_m3, 7, {0.85720908546875, -0.9580154755208333, -2.977363559027778}},
+    {"beta_n7_m4", beta_n7_m4, beta_n7_m4, 7, {0.859879805295, -0.95101236943125, -3.1661849980277776}},
+    {"beta_n8_m0", beta_n8_m0, beta_n8_m0, 8, {0.7, -1.0, 0.0}},
+    {"beta_n8_m1", beta_n8_m1, beta_n8_m1, 8, {0.84, -0.9666666666666667, -2.2222222222222223}},
+    {"beta_n8_m2", beta_n8_m2, beta_n8_m2, 8, {0.85360848125, -0.9552655208333334, -2.6908045634920637}},
+    {"beta_n8_m3", beta_n8_m3, beta_n8_m3, 8, {0.857302539625, -0.9518885316666666, -2.918584678968254}},
+    {"beta_n8_m4", beta_n8_m4, beta_n8_m4, 8, {0.8596705606477735, -0.9456762779691407, -3.0859612800203373}},
+    {"beta_n9_m0", beta_n9_m0, beta_n9_m0, 9, {0.7, -1.0, 0.0}},
+    {"beta_n9_m1", beta_n9_m1, beta_n9_m1, 9, {0.8407, -0.963, -2.22}},
+    {"beta_n9_m2", beta_n9_m2, beta_n9_m2, 9, {0.8540253701388889, -0.9501729282407407, -2.6661625881834214}},
+    {"beta_n9_m3", beta_n9_m3, beta_n9_m3, 9, {0.8573841569951389, -0.9469710147199074, -2.871767526695326}},
+    {"beta_n9_m4", beta_n9_m4, beta_n9_m4, 9, {0.8595113445498429, -0.9413877924660851, -3.022079316091854}},
+    {"beta_n10_m0", beta_n10_m0, beta_n10_m0, 10, {0.7, -1.0, 0.0}},
+    {"beta_n10_m1", beta_n10_m1, beta_n10_m1, 10, {0.8412727272727273, -0.96, -2.2181818181818183}},
+    {"beta_n10_m2", beta_n10_m2, beta_n10_m2, 10, {0.854369579229798, -0.9459988373316498, -2.6460716790925125}},
+    {"beta_n10_m3", beta_n10_m3, beta_n10_m3, 10, {0.8574554250252525, -0.9429371087331649, -2.83359726675485}},
+    {"beta_n10_m4", beta_n10_m4, beta_n10_m4, 10, {0.859386430878407, -0.937866163117587, -2.97000618080759}},
+    {"beta_Lagrange_n1", beta_Lagrange_n1, beta_Lagrange_n1, 1, {0.7735, -0.965, -1.1}},
+    {"beta_Lagrange_n2", beta_Lagrange_n2, beta_Lagrange_n2, 2, {0.8005725, -0.9472083333333333, -1.525}},
+    {"beta_Lagrange_n3", beta_Lagrange_n3, beta_Lagrange_n3, 3, {0.81458251875, -0.9370987291666667, -1.7482634722222221}},
+    {"beta_Lagrange_n4", beta_Lagrange_n4, beta_Lagrange_n4, 4, {0.823135635196875, -0.9306466154479167, -1.8855624397222221}},
+    {"beta_Lagrange_n5", beta_Lagrange_n5, beta_Lagrange_n5, 5, {0.8288975846432531, -0.9261859999534271, -1.9784543288920138}},
+    {"beta_Lagrange_n6", beta_Lagrange_n6, beta_Lagrange_n6, 6, {0.8330420725664693, -0.9229226672423061, -2.0454595521852657}},
+    {"beta_Lagrange_n7", beta_Lagrange_n7, beta_Lagrange_n7, 7, {0.8361659803385937, -0.9204333267261329, -2.096066137629653}},
+    {"beta_Lagrange_n8", beta_Lagrange_n8, beta_Lagrange_n8, 8, {0.8386047977812479, -0.9184725573716475, -2.135633533615213}},
+    {"beta_Lagrange_n9", beta_Lagrange_n9, beta_Lagrange_n9, 9, {0.8405615423094042, -0.9168885275709313, -2.1674165412098687}},
+    {"beta_Lagrange_n10", beta_Lagrange_n10, beta_Lagrange_n10, 10, {0.8421662507083585, -0.915582363696987, -2.1935055537583197}},
+};
+
+int main()
+{
+    const int nb_kernels = sizeof(kernels) / sizeof(kernels[0]);
+    int nb_failures = 0;
+    double poly_val[22];
+    float poly_val_float[22];
+    for (int k = 0; k < nb_kernels; k++)
+    {
+        const kernel_reference &kernel = kernels[k];
+        const int nb_values = 2*kernel.neighbours + 2;
+        /* sum rules */
+        double worst_sum_error = 0;
+        for (int ix = 0; ix <= 20; ix++)
+        {
+            const double x = ix / 20.;
+            for (int deriv = 0; deriv < 3; deriv++)
+            {
+                kernel.beta(deriv, x, poly_val);
+                double sum = 0, scale = 1;
+                for (int i = 0; i < nb_values; i++)
+                {
+                    sum += poly_val[i];
+                    scale += std::fabs(poly_val[i]);
+                }
+                const double sum_error = std::fabs(sum - (deriv == 0 ? 1 : 0)) / scale;
+                if (sum_error > worst_sum_error)
+                    worst_sum_error = sum_error;
+            }
+        }
+        /* reference values */
+        double worst_value_error = 0;
+        for (int deriv = 0; deriv < 3; deriv++)
+        {
+            kernel.beta(deriv, 0.3, poly_val);
+            const double value_error = (
+                    std::fabs(poly_val[kernel.neighbours] - kernel.center_values[deriv]) /
+                    (1 + std::fabs(kernel.center_values[deriv])));
+            if (value_error > worst_value_error)
+                worst_value_error = value_error;
+        }
+        /* single precision evaluation */
+        double worst_float_error = 0;
+        for (int ix = 0; ix <= 20; ix++)
+        {
+            const float x = ix / 20.f;
+            for (int deriv = 0; deriv < 3; deriv++)
+            {
+                kernel.beta(deriv, double(x), poly_val);
+                kernel.beta_float(deriv, x, poly_val_float);
+                double scale = 1;
+                for (int i = 0; i < nb_values; i++)
+                    scale += std::fabs(poly_val[i]);
+                for (int i = 0; i < nb_values; i++)
+                {
+                    const double float_error = std::fabs(poly_val_float[i] - poly_val[i]) / scale;
+                    if (float_error > worst_float_error)
+                        worst_float_error = float_error;
+                }
+            }
+        }
+        const bool failed = (worst_sum_error > 1e-12 ||
+                             worst_value_error > 1e-12 ||
+                             worst_float_error > 1e-4);
+        printf("%-20s sum error %.3e, value error %.3e, float error %.3e%s\n",
+               kernel.name, worst_sum_error, worst_value_error, worst_float_error,
+               failed ? "  FAILED" : "");
+        if (failed)
+            nb_failures++;
+    }
+    printf("%d kernels, %d failures\n", nb_kernels, nb_failures);
+    return (nb_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
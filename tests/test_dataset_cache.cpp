@@ -0,0 +1,147 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Dataset handles cached by `hdf5_tools::open_cached_dataset`:
+ *  - the same dataset, reached through different group handles, always
+ *    gets the same handle, and the same path in another file doesn't;
+ *  - `close_cached_datasets` closes the handles of one file only, leaving
+ *    no open datasets in that file;
+ *  - datasets are opened again after that, and values written through
+ *    cached handles, before and after, end up in the file.
+ * Prints the number of failed checks, see test_dataset_cache.py. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "hdf5_tools.hpp"
+
+int myrank, nprocs;
+
+int errors = 0;
+
+void check(const bool condition, const std::string message)
+{
+    if (!condition)
+    {
+        printf("failed: %s\n", message.c_str());
+        errors++;
+    }
+}
+
+hid_t create_file(const std::string file_name)
+{
+    hid_t file = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t group = H5Gcreate(file, "statistics", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hsize_t dims = 4;
+    hid_t space = H5Screate_simple(1, &dims, NULL);
+    H5Dclose(H5Dcreate(group, "values", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    H5Sclose(space);
+    space = H5Screate(H5S_SCALAR);
+    H5Dclose(H5Dcreate(file, "iteration", H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+    H5Sclose(space);
+    H5Gclose(group);
+    return file;
+}
+
+/* writes `value` at `index` of statistics/values, through a new group handle */
+hid_t write_value(const hid_t file, const hsize_t index, const int value)
+{
+    hid_t group = H5Gopen(file, "statistics", H5P_DEFAULT);
+    hid_t dset = hdf5_tools::open_cached_dataset(group, "values");
+    H5Gclose(group);
+    hsize_t count = 1;
+    hid_t wspace = H5Dget_space(dset);
+    H5Sselect_hyperslab(wspace, H5S_SELECT_SET, &index, NULL, &count, NULL);
+    hid_t mspace = H5Screate_simple(1, &count, NULL);
+    H5Dwrite(dset, H5T_NATIVE_INT, mspace, wspace, H5P_DEFAULT, &value);
+    H5Sclose(mspace);
+    H5Sclose(wspace);
+    return dset;
+}
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    if (myrank == 0)
+    {
+        hid_t file0 = create_file("test_dataset_cache_0.h5");
+        hid_t file1 = create_file("test_dataset_cache_1.h5");
+
+        const hid_t dset0 = write_value(file0, 0, 10);
+        check(write_value(file0, 1, 11) == dset0, "same dataset through another group handle");
+        const hid_t dset1 = write_value(file1, 0, 20);
+        check(dset1 != dset0, "same path in another file");
+        const hid_t iteration0 = hdf5_tools::open_cached_dataset(file0, "iteration");
+        check(iteration0 >= 0 && iteration0 != dset0, "dataset at the root of the file");
+        check(hdf5_tools::open_cached_dataset(file0, "iteration") == iteration0, "dataset at the root of the file, again");
+        const int iteration = 8;
+        H5Dwrite(iteration0, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &iteration);
+
+        H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+        check(hdf5_tools::open_cached_dataset(file0, "missing") < 0, "missing dataset");
+
+        hdf5_tools::close_cached_datasets(file0);
+        check(H5Fget_obj_count(file0, H5F_OBJ_DATASET) == 0, "no open datasets after closing the cache");
+        check(H5Iis_valid(dset0) <= 0, "closed handle");
+        check(H5Iis_valid(dset1) > 0, "handle of the other file");
+        check(write_value(file1, 1, 21) == dset1, "other file still cached");
+
+        /* opened again after closing the cache */
+        const hid_t dset0_again = write_value(file0, 2, 12);
+        check(H5Iis_valid(dset0_again) > 0, "dataset opened again");
+        check(write_value(file0, 3, 13) == dset0_again, "dataset opened again, cached");
+        hdf5_tools::close_cached_datasets(file0);
+        hdf5_tools::close_cached_datasets(file1);
+        H5Fclose(file0);
+        H5Fclose(file1);
+
+        int values[4];
+        file0 = H5Fopen("test_dataset_cache_0.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        hid_t dset = H5Dopen(file0, "statistics/values", H5P_DEFAULT);
+        H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, values);
+        H5Dclose(dset);
+        for (int i = 0; i < 4; i++)
+            check(values[i] == 10 + i, "value " + std::to_string(i) + " of the first file");
+        int read_iteration = 0;
+        dset = H5Dopen(file0, "iteration", H5P_DEFAULT);
+        H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &read_iteration);
+        H5Dclose(dset);
+        check(read_iteration == iteration, "iteration of the first file");
+        H5Fclose(file0);
+        file1 = H5Fopen("test_dataset_cache_1.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        dset = H5Dopen(file1, "statistics/values", H5P_DEFAULT);
+        H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, values);
+        H5Dclose(dset);
+        check(values[0] == 20 && values[1] == 21, "values of the second file");
+        H5Fclose(file1);
+        printf("worst error %d\n", errors);
+    }
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
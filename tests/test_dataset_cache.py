@@ -0,0 +1,50 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import sys
+import argparse
+
+from test_ghost_planes import compile_test, run_test
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--ncpu',
+            type = int, dest = 'ncpu', nargs = '+',
+            default = [1])
+    opt = parser.parse_args(sys.argv[1:])
+    compile_test(
+            src = 'test_dataset_cache.cpp',
+            exe = 'test_dataset_cache')
+    # only rank 0 uses the cache
+    for ncpu in opt.ncpu:
+        worst = run_test(ncpu, exe = 'test_dataset_cache')
+        print('{0} processes, {1} failed checks'.format(ncpu, worst))
+        assert(worst == 0)
+    return None
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Plans of `fftw_plan_registry`, shared between fields:
+ *  - fields with the same grid, number of components and precision add no
+ *    plans to the registry, including temporary fields that are created
+ *    and deleted repeatedly;
+ *  - transforms through shared plans, after the field that created them
+ *    is deleted, give the same modes as transforms through new plans
+ *    created after `clear`.
+ * Prints the largest difference, with 1 added for every unexpected
+ * registry size, see test_fft_plans.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "field.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+template <typename rnumber>
+void fill_field(field<rnumber, FFTW, THREE> *f)
+{
+    /* the same values for every field, whatever the thread that sets them */
+    f->real_space_representation = true;
+    f->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t, ptrdiff_t, ptrdiff_t){
+        for (int cc = 0; cc < 3; cc++)
+            f->rval(rindex, cc) = std::sin(0.37*rindex + cc + myrank);
+    });
+}
+
+double expect_size(const int size, const int expected_size)
+{
+    if (size == expected_size)
+        return 0;
+    if (myrank == 0)
+        printf("registry holds %d plans instead of %d\n", size, expected_size);
+    return 1;
+}
+
+template <typename rnumber>
+double plan_error(const int nx, const int ny, const int nz)
+{
+    double error = 0;
+    fftw_plan_registry<rnumber>::clear();
+    /* one r2c and one c2r plan per grid and number of components */
+    field<rnumber, FFTW, THREE> *shared = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    error += expect_size(fftw_plan_registry<rnumber>::size(), 2);
+    field<rnumber, FFTW, ONE> *scalar = new field<rnumber, FFTW, ONE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    error += expect_size(fftw_plan_registry<rnumber>::size(), 4);
+    for (int i = 0; i < 3; i++)
+    {
+        field<rnumber, FFTW, THREE> *tmp = new field<rnumber, FFTW, THREE>(
+                nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        fill_field(tmp);
+        tmp->dft();
+        delete tmp;
+    }
+    error += expect_size(fftw_plan_registry<rnumber>::size(), 4);
+
+    /* the field that created the plans is gone */
+    field<rnumber, FFTW, THREE> *a = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    delete shared;
+    fill_field(a);
+    a->dft();
+    std::vector<rnumber> modes((rnumber*)a->get_cdata(),
+                               (rnumber*)a->get_cdata() + 2*a->clayout->local_size);
+    a->ift();
+    std::vector<rnumber> values(a->get_rdata(), a->get_rdata() + a->rmemlayout->local_size);
+    delete a;
+    delete scalar;
+
+    /* new plans; fields must not be transformed after `clear` */
+    fftw_plan_registry<rnumber>::clear();
+    error += expect_size(fftw_plan_registry<rnumber>::size(), 0);
+    field<rnumber, FFTW, THREE> *b = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    error += expect_size(fftw_plan_registry<rnumber>::size(), 2);
+    fill_field(b);
+    b->dft();
+    for (size_t i = 0; i < modes.size(); i++)
+        error = std::max(error, double(std::fabs(modes[i] - ((rnumber*)b->get_cdata())[i])));
+    b->ift();
+    b->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t, ptrdiff_t, ptrdiff_t){
+        for (int cc = 0; cc < 3; cc++)
+            error = std::max(error, double(std::fabs(values[rindex*3 + cc] - b->rval(rindex, cc))));
+    });
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    delete b;
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    fftwf_mpi_init();
+    double worst = 0;
+    const int shapes[2][3] = {{16, 12, 12}, {12, 10, 10}};
+    for (auto shape : shapes)
+    {
+        const double error_double = plan_error<double>(shape[0], shape[1], shape[2]);
+        const double error_float = plan_error<float>(shape[0], shape[1], shape[2]);
+        if (myrank == 0)
+            printf("%d x %d x %d, errors %g %g\n",
+                   shape[0], shape[1], shape[2],
+                   error_double, error_float);
+        worst = std::max(worst, std::max(error_double, error_float));
+    }
+    fftw_plan_registry<double>::clear();
+    fftw_plan_registry<float>::clear();
+    fftw_mpi_cleanup();
+    fftwf_mpi_cleanup();
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+/* The blocked stencil kernel of `particles_field_computer`, through
+ * `apply_computation` on z slabs and through `apply_computation_with_ghosts`,
+ * compared with a plain per-particle interpolation of the full field.
+ * The particle counts are not multiples of the block size, and some
+ * particles sit on the box boundaries or outside of the box, so that the
+ * stencils wrap around in every direction.
+ * Prints the largest difference, see test_field_computer.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <hdf5.h>
+#include "particles/particles_field_computer.hpp"
+#include "particles/particles_generic_interp.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+/* the parts of `field` used by `apply_computation` */
+struct slab_field
+{
+    int nx, ny, z0;
+    std::vector<double> data;
+
+    slab_field(const int NX, const int NY, const int NZ, const int Z0, const int Z1):
+        nx(NX), ny(NY), z0(Z0),
+        data(size_t(std::max(Z1-Z0, 1))*NY*(NX+2)*3, 0.0)
+    {
+        for (int zz = Z0; zz < Z1; zz++)
+        for (int yy = 0; yy < NY; yy++)
+        for (int xx = 0; xx < NX; xx++)
+        for (int cc = 0; cc < 3; cc++)
+            this->data[this->get_rindex_from_global(xx, yy, zz)*3 + cc] = (
+                    std::sin(2*M_PI*(double(xx)/NX + 2*double(yy)/NY) + cc) *
+                    std::cos(2*M_PI*double(zz)/NZ) +
+                    0.01*xx*yy - 0.02*zz*cc);
+    }
+
+    const double &rval(const ptrdiff_t rindex, const unsigned int component = 0) const
+    {
+        return this->data[rindex*3 + component];
+    }
+
+    ptrdiff_t get_rindex_from_global(const ptrdiff_t xx, const ptrdiff_t yy, const ptrdiff_t zz) const
+    {
+        return ((zz - this->z0)*this->ny + yy)*(this->nx + 2) + xx;
+    }
+};
+
+/* one particle at a time, all the periodic indexes computed in the stencil loops */
+template <class interpolator, int neighbours>
+void reference_interpolation(
+        const interpolator &interp,
+        const slab_field &field,
+        const int nz,
+        const std::array<double, 3> &box_width,
+        const std::array<double, 3> &spatial_step,
+        const double position[],
+        double result[])
+{
+    const int grid_dim[3] = {field.nx, field.ny, nz};
+    int cell[3];
+    double beta[3][2*neighbours+2];
+    for (int i = 0; i < 3; i++)
+    {
+        const double pos_in_box = position[i] - std::floor(position[i]/box_width[i])*box_width[i];
+        const double cell_index = std::floor(pos_in_box/spatial_step[i]);
+        cell[i] = int(cell_index) % grid_dim[i];
+        interp.compute_beta(0, (pos_in_box - cell_index*spatial_step[i])/spatial_step[i], beta[i]);
+    }
+    std::fill_n(result, 3, 0.);
+    for (int iz = 0; iz < 2*neighbours+2; iz++)
+    for (int iy = 0; iy < 2*neighbours+2; iy++)
+    for (int ix = 0; ix < 2*neighbours+2; ix++)
+    {
+        const int zz = (cell[2] - neighbours + iz + nz) % nz;
+        const int yy = (cell[1] - neighbours + iy + field.ny) % field.ny;
+        const int xx = (cell[0] - neighbours + ix + field.nx) % field.nx;
+        for (int cc = 0; cc < 3; cc++)
+            result[cc] += (field.rval(field.get_rindex_from_global(xx, yy, zz), cc) *
+                           beta[0][ix]*beta[1][iy]*beta[2][iz]);
+    }
+}
+
+template <int neighbours, int smoothness>
+double interpolation_error(const int nz, const int nslabs, const unsigned seed)
+{
+    const int nx = 12, ny = 10;
+    typedef particles_generic_interp<double, neighbours, smoothness> interpolator;
+    typedef particles_field_computer<long long int, double, interpolator, neighbours> computer;
+    interpolator interp;
+    const std::array<size_t, 3> field_grid_dim{{size_t(nx), size_t(ny), size_t(nz)}};
+    const std::array<double, 3> box_width{{2*M_PI, 1.5, 0.5}};
+    const std::array<double, 3> box_offset{{0., 0., 0.}};
+    const std::array<double, 3> spatial_step{{box_width[0]/nx, box_width[1]/ny, box_width[2]/nz}};
+    slab_field full_field(nx, ny, nz, 0, nz);
+
+    /* a number of particles that is not a multiple of the block size,
+     * the first ones on the box boundaries and outside of the box */
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> uniform(-0.5, 1.5);
+    const long long int nb_particles = 53;
+    std::vector<double> positions(3*nb_particles);
+    for (long long int p = 0; p < nb_particles; p++)
+        for (int i = 0; i < 3; i++)
+            positions[3*p + i] = uniform(gen)*box_width[i];
+    for (int i = 0; i < 3; i++)
+    {
+        positions[3*0 + i] = 0.;
+        positions[3*1 + i] = box_width[i]*(1 - 1e-9);
+        positions[3*2 + i] = -spatial_step[i]*0.5;
+        positions[3*3 + i] = box_width[i] + spatial_step[i]*0.25;
+    }
+    std::vector<double> reference(3*nb_particles);
+    for (long long int p = 0; p < nb_particles; p++)
+        reference_interpolation<interpolator, neighbours>(
+                interp, full_field, nz, box_width, spatial_step,
+                &positions[3*p], &reference[3*p]);
+
+    double error = 0;
+    const int planes_per_slab = (nz + nslabs - 1) / nslabs;
+    std::vector<double> rhs(3*nb_particles, 0);
+    for (int slab = 0; slab < nslabs; slab++)
+    {
+        const int first_z = std::min(nz, slab*planes_per_slab);
+        const int last_z = std::min(nz, (slab+1)*planes_per_slab);
+        if (first_z == last_z)
+            continue;
+        computer slab_computer(field_grid_dim, {first_z, last_z}, interp, box_width, box_offset, spatial_step);
+
+        /* each slab adds the part of the stencils it holds */
+        slab_field local_field(nx, ny, nz, first_z, last_z);
+        slab_computer.template apply_computation<slab_field, 3>(
+                local_field, positions.data(), rhs.data(), nb_particles);
+
+        /* the particles of the slab, computed entirely from the slab and
+         * its ghost planes */
+        std::vector<double> slab_positions;
+        std::vector<long long int> slab_indexes;
+        for (long long int p = 0; p < nb_particles; p++)
+            if (slab_computer.pbc_field_layer(positions[3*p + 2], IDX_Z) >= first_z &&
+                slab_computer.pbc_field_layer(positions[3*p + 2], IDX_Z) < last_z)
+            {
+                slab_indexes.push_back(p);
+                slab_positions.insert(slab_positions.end(), &positions[3*p], &positions[3*p] + 3);
+            }
+        std::vector<const double*> planes;
+        for (int zz = first_z - neighbours; zz < last_z + neighbours + 1; zz++)
+            planes.push_back(&full_field.rval(full_field.get_rindex_from_global(0, 0, (zz + nz) % nz)));
+        std::vector<double> ghost_rhs(slab_positions.size(), 0);
+        slab_computer.template apply_computation_with_ghosts<double, 3>(
+                planes.data(), ptrdiff_t(nx+2)*3,
+                slab_positions.data(), ghost_rhs.data(), slab_indexes.size());
+        for (size_t i = 0; i < slab_indexes.size(); i++)
+            for (int cc = 0; cc < 3; cc++)
+                error = std::max(error, std::fabs(ghost_rhs[3*i + cc] - reference[3*slab_indexes[i] + cc]));
+    }
+    for (long long int i = 0; i < 3*nb_particles; i++)
+        error = std::max(error, std::fabs(rhs[i] - reference[i]));
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    double worst = 0;
+    for (int nz : {11, 16})
+    for (int nslabs : {1, 2, 3, 5})
+    {
+        const double error1 = interpolation_error<1, 0>(nz, nslabs, 1);
+        const double error2 = interpolation_error<2, 1>(nz, nslabs, 2);
+        const double error3 = interpolation_error<3, 2>(nz, nslabs, 3);
+        const double error4 = interpolation_error<4, 1>(nz, nslabs, 4);
+        if (myrank == 0)
+            printf("nz = %d, %d slabs, errors %g %g %g %g\n",
+                   nz, nslabs, error1, error2, error3, error4);
+        worst = std::max(worst, std::max(std::max(error1, error2), std::max(error3, error4)));
+    }
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
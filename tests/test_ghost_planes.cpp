@@ -0,0 +1,170 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+/* Interpolation through `particles_distr_mpi` on z slabs of arbitrary
+ * thickness, compared with a serial interpolation of the full field.
+ * The slabs are distributed by hand (no FFTW), so that layouts with very
+ * few planes per process can be checked, for every value of
+ * BFPS_PARTICLES_GHOST_PLANES.
+ * Prints the largest difference, see test_ghost_planes.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <hdf5.h>
+#include "particles/particles_distr_mpi.hpp"
+#include "particles/particles_field_computer.hpp"
+#include "particles/particles_generic_interp.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+/* the parts of `field` used by the particle code */
+struct slab_layout
+{
+    hsize_t subsizes[3];
+};
+
+struct slab_field
+{
+    int nx, ny, z0;
+    std::vector<double> data;
+    slab_layout layout;
+    slab_layout *rmemlayout;
+
+    slab_field(const int NX, const int NY, const int Z0, const int Z1):
+        nx(NX), ny(NY), z0(Z0),
+        data(size_t(std::max(Z1-Z0, 1))*NY*(NX+2)*3, 0.0),
+        rmemlayout(&layout)
+    {
+        this->layout.subsizes[0] = hsize_t(Z1-Z0);
+        this->layout.subsizes[1] = hsize_t(NY);
+        this->layout.subsizes[2] = hsize_t(NX+2);
+        for (int zz = Z0; zz < Z1; zz++)
+        for (int yy = 0; yy < NY; yy++)
+        for (int xx = 0; xx < NX; xx++)
+        for (int cc = 0; cc < 3; cc++)
+            this->data[this->get_rindex_from_global(xx, yy, zz)*3 + cc] = (
+                    std::sin(0.3*xx + 1.1*yy + 0.7*zz + cc) +
+                    0.01*xx*yy - 0.02*zz*cc);
+    }
+
+    const double &rval(const ptrdiff_t rindex, const unsigned int component = 0) const
+    {
+        return this->data[rindex*3 + component];
+    }
+
+    ptrdiff_t get_rindex_from_global(const ptrdiff_t xx, const ptrdiff_t yy, const ptrdiff_t zz) const
+    {
+        return ((zz - this->z0)*this->ny + yy)*(this->nx + 2) + xx;
+    }
+};
+
+template <int neighbours>
+double interpolation_error(const int nz, const char *mode, const unsigned seed)
+{
+    const int nx = 12, ny = 10;
+    const int planes_per_proc = (nz + nprocs - 1) / nprocs;
+    const int first_z = std::min(nz, myrank*planes_per_proc);
+    const int last_z = std::min(nz, (myrank+1)*planes_per_proc);
+    slab_field local_field(nx, ny, first_z, last_z);
+    slab_field full_field(nx, ny, 0, nz);
+
+    typedef particles_generic_interp<double, neighbours, 1> interpolator;
+    typedef particles_field_computer<long long int, double, interpolator, neighbours> computer;
+    interpolator interp;
+    const std::array<size_t, 3> field_grid_dim{{size_t(nx), size_t(ny), size_t(nz)}};
+    const std::array<double, 3> box_width{{1., 1., 1.}};
+    const std::array<double, 3> box_offset{{0., 0., 0.}};
+    const std::array<double, 3> spatial_step{{1./nx, 1./ny, 1./nz}};
+    computer local_computer(field_grid_dim, {first_z, last_z}, interp, box_width, box_offset, spatial_step);
+    computer full_computer(field_grid_dim, {0, nz}, interp, box_width, box_offset, spatial_step);
+    setenv("BFPS_PARTICLES_GHOST_PLANES", mode, 1);
+    particles_distr_mpi<long long int, double> distr(MPI_COMM_WORLD, {first_z, last_z}, field_grid_dim);
+
+    /* a few particles in each local plane */
+    std::mt19937 gen(seed + myrank);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<long long int> nb_particles_per_plane(std::max(last_z - first_z, 1), 0);
+    std::vector<double> positions;
+    for (int zz = first_z; zz < last_z; zz++)
+    {
+        nb_particles_per_plane[zz - first_z] = 1 + gen()%7;
+        for (int i = 0; i < nb_particles_per_plane[zz - first_z]; i++)
+        {
+            positions.push_back(uniform(gen));
+            positions.push_back(uniform(gen));
+            positions.push_back((zz + uniform(gen)) / nz);
+        }
+    }
+    const long long int nb_particles = positions.size() / 3;
+    std::vector<double> rhs(3*nb_particles + 3, 0), reference(3*nb_particles + 3, 0);
+    distr.template compute_distr<computer, slab_field, 3, 3>(
+            local_computer, local_field, nb_particles_per_plane.data(),
+            positions.data(), rhs.data(), neighbours);
+    /* the second call reuses the exchange chosen by the first one */
+    std::vector<double> rhs_again(3*nb_particles + 3, 0);
+    distr.template compute_distr<computer, slab_field, 3, 3>(
+            local_computer, local_field, nb_particles_per_plane.data(),
+            positions.data(), rhs_again.data(), neighbours);
+    full_computer.template apply_computation<slab_field, 3>(
+            full_field, positions.data(), reference.data(), nb_particles);
+
+    double error = 0;
+    for (long long int i = 0; i < 3*nb_particles; i++)
+        error = std::max(error, std::max(std::fabs(rhs[i] - reference[i]),
+                                         std::fabs(rhs_again[i] - reference[i])));
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    double worst = 0;
+    for (int nz : {9, 16, 24})
+    for (const char *mode : {"TRUE", "FALSE", "AUTO"})
+    {
+        const double error1 = interpolation_error<1>(nz, mode, 1);
+        const double error2 = interpolation_error<2>(nz, mode, 2);
+        const double error3 = interpolation_error<3>(nz, mode, 3);
+        if (myrank == 0)
+            printf("nz = %d, BFPS_PARTICLES_GHOST_PLANES = %s, errors %g %g %g\n",
+                   nz, mode, error1, error2, error3);
+        worst = std::max(worst, std::max(error1, std::max(error2, error3)));
+    }
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import os
+import sys
+import subprocess
+import argparse
+
+import bfps
+
+def compile_test(
+        src = 'test_ghost_planes.cpp',
+        exe = 'test_ghost_planes'):
+    command_strings = [bfps.install_info['compiler']]
+    command_strings += [os.path.join(os.path.dirname(os.path.abspath(__file__)), src),
+                        '-o', exe]
+    command_strings += bfps.install_info['extra_compile_args']
+    command_strings += ['-I' + idir for idir in bfps.install_info['include_dirs']]
+    command_strings.append('-I' + bfps.header_dir)
+    command_strings += ['-L' + ldir for ldir in bfps.install_info['library_dirs']]
+    command_strings += ['-Wl,-rpath=' + ldir for ldir in bfps.install_info['library_dirs']]
+    command_strings.append('-L' + bfps.lib_dir)
+    command_strings.append('-Wl,-rpath=' + bfps.lib_dir)
+    for libname in ['bfps'] + bfps.install_info['libraries']:
+        command_strings += ['-l' + libname]
+    command_strings += ['-fopenmp']
+    print('compiling test with command\n' + ' '.join(command_strings))
+    assert(subprocess.call(command_strings) == 0)
+    return None
+
+def run_test(
+        ncpu,
+        exe = 'test_ghost_planes'):
+    out = subprocess.check_output(
+            ['mpirun', '-np', '{0}'.format(ncpu),
+             '-x', 'OMP_NUM_THREADS=2',
+             './' + exe]).decode()
+    print(out)
+    worst = float(out.split('worst error')[-1])
+    return worst
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--ncpu',
+            type = int, dest = 'ncpu', nargs = '+',
+            default = [1, 2, 3, 5, 7])
+    opt = parser.parse_args(sys.argv[1:])
+    compile_test()
+    # the slabs hold as few as one plane per process, so the stencils
+    # reach the same process from both sides
+    for ncpu in opt.ncpu:
+        worst = run_test(ncpu)
+        print('{0} processes, worst error {1}'.format(ncpu, worst))
+        assert(worst < 1e-12)
+    return None
+
+if __name__ == '__main__':
+    main()
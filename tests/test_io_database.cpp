@@ -0,0 +1,126 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Reads databases in the layout of older files, which test_io_database.py
+ * writes with h5py: "vorticity/real" is a contiguous (2, nz, ny, nx, 3)
+ * dataset, and "pressure/real" a contiguous (nz, ny, nx) dataset without
+ * a time dimension.
+ * The second entry of the vorticity database is then overwritten, and read
+ * back.
+ * Prints the largest difference from the expected values. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "field.hpp"
+
+int myrank, nprocs;
+
+const int nx = 8, ny = 6, nz = 4;
+
+/* values stored by test_io_database.py */
+double vorticity_value(const int t, const int z, const int y, const int x, const int c)
+{
+    return double((((t*nz + z)*ny + y)*nx + x)*3 + c);
+}
+
+double pressure_value(const int z, const int y, const int x)
+{
+    return -double((z*ny + y)*nx + x);
+}
+
+template <field_components fc, class value_function>
+double field_error(field<double, FFTW, fc> *ff, value_function value)
+{
+    double error = 0;
+    ff->RLOOP(
+            [&](ptrdiff_t rindex,
+                ptrdiff_t xindex,
+                ptrdiff_t yindex,
+                ptrdiff_t zindex){
+        for (unsigned int c = 0; c < ncomp(fc); c++)
+            error = std::max(error, std::fabs(
+                    ff->rval(rindex, c) -
+                    value(zindex + ff->rlayout->starts[0], yindex, xindex, c)));
+    });
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    const std::string fname = "test_io_database.h5";
+    double worst = 0;
+    {
+        field<double, FFTW, THREE> vorticity(nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        field<double, FFTW, ONE> pressure(nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        for (int t = 0; t < 2; t++)
+        {
+            vorticity.real_space_representation = true;
+            vorticity.io_database(fname, "vorticity", t, true);
+            const double error = field_error(&vorticity,
+                    [&](int z, int y, int x, int c){return vorticity_value(t, z, y, x, c);});
+            if (myrank == 0)
+                printf("vorticity entry %d, error %g\n", t, error);
+            worst = std::max(worst, error);
+        }
+        pressure.real_space_representation = true;
+        pressure.io_database(fname, "pressure", 0, true);
+        const double error = field_error(&pressure,
+                [&](int z, int y, int x, int){return pressure_value(z, y, x);});
+        if (myrank == 0)
+            printf("pressure, error %g\n", error);
+        worst = std::max(worst, error);
+
+        /* the old dataset is written in place */
+        vorticity.io_database(fname, "vorticity", 0, true);
+        vorticity.RLOOP(
+                [&](ptrdiff_t rindex,
+                    ptrdiff_t xindex,
+                    ptrdiff_t yindex,
+                    ptrdiff_t zindex){
+            for (int c = 0; c < 3; c++)
+                vorticity.rval(rindex, c) *= 2;
+        });
+        vorticity.io_database(fname, "vorticity", 1, false);
+        vorticity.io_database(fname, "vorticity", 1, true);
+        const double write_error = field_error(&vorticity,
+                [&](int z, int y, int x, int c){return 2*vorticity_value(0, z, y, x, c);});
+        if (myrank == 0)
+            printf("vorticity entry 1 after writing, error %g\n", write_error);
+        worst = std::max(worst, write_error);
+    }
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    fftw_plan_registry<double>::clear();
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
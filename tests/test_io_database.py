@@ -0,0 +1,61 @@
+#######################################################################
+#                                                                     #
+#  Copyright 2015 Max Planck Institute                                #
+#                 for Dynamics and Self-Organization                  #
+#                                                                     #
+#  This file is part of bfps.                                         #
+#                                                                     #
+#  bfps is free software: you can redistribute it and/or modify       #
+#  it under the terms of the GNU General Public License as published  #
+#  by the Free Software Foundation, either version 3 of the License,  #
+#  or (at your option) any later version.                             #
+#                                                                     #
+#  bfps is distributed in the hope that it will be useful,            #
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of     #
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      #
+#  GNU General Public License for more details.                       #
+#                                                                     #
+#  You should have received a copy of the GNU General Public License  #
+#  along with bfps.  If not, see <http://www.gnu.org/licenses/>       #
+#                                                                     #
+# Contact: Cristian.Lalescu@ds.mpg.de                                 #
+#                                                                     #
+#######################################################################
+
+
+
+
+import numpy as np
+import h5py
+
+from test_ghost_planes import compile_test, run_test
+
+def write_old_layout(
+        fname = 'test_io_database.h5',
+        nx = 8, ny = 6, nz = 4):
+    """databases as older versions of bfps created them: contiguous, with
+    a fixed number of entries, or without a time dimension"""
+    vorticity = np.arange(2*nz*ny*nx*3, dtype = np.float64).reshape(2, nz, ny, nx, 3)
+    pressure = -np.arange(nz*ny*nx, dtype = np.float64).reshape(nz, ny, nx)
+    with h5py.File(fname, 'w') as ofile:
+        ofile.create_dataset('vorticity/real', data = vorticity)
+        ofile.create_dataset('pressure/real', data = pressure)
+    return vorticity
+
+def main():
+    vorticity = write_old_layout()
+    compile_test(
+            src = 'test_io_database.cpp',
+            exe = 'test_io_database')
+    worst = run_test(1, exe = 'test_io_database')
+    assert(worst == 0)
+    with h5py.File('test_io_database.h5', 'r') as ifile:
+        dset = ifile['vorticity/real']
+        assert(dset.chunks is None)
+        assert(dset.shape == vorticity.shape)
+        assert(np.all(dset[0] == vorticity[0]))
+        assert(np.all(dset[1] == 2*vorticity[0]))
+    return None
+
+if __name__ == '__main__':
+    main()
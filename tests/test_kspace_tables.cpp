@@ -0,0 +1,126 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* The per mode tables of `kspace`, and the filters that use them, compared
+ * with the same quantities computed in double precision from the
+ * wavenumbers of each mode:
+ *  - |k| and the spectrum shell of every mode;
+ *  - the Gaussian and ball filters and the smooth dealiasing filter
+ *    applied to fields of ones.
+ * The box is not isotropic, so that dk differs from some of dkx, dky, dkz.
+ * Prints the largest difference, see test_kspace_tables.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "field.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+double table_error(const int nx, const int ny, const int nz)
+{
+    field<double, FFTW, THREE> *gauss = new field<double, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    field<double, FFTW, THREE> *ball = new field<double, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    field<double, FFTW, THREE> *smooth = new field<double, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    kspace<FFTW, SMOOTH> *kk = new kspace<FFTW, SMOOTH>(gauss->clayout, 1., 1., 2.);
+
+    double error = 0;
+    kk->CLOOP_K2(
+            [&](ptrdiff_t cindex, ptrdiff_t, ptrdiff_t, ptrdiff_t, double k2){
+        const double knorm = std::sqrt(k2);
+        error = std::max(error, std::fabs(kk->knorm[cindex] - knorm) / std::max(knorm, 1.));
+        const int shell = (k2 <= kk->kM2) ? int(knorm / kk->dk) : kk->nshells;
+        if (kk->shell_index[cindex] != shell)
+            error = std::max(error, 1.);
+        for (int cc = 0; cc < 3; cc++)
+        for (int ii = 0; ii < 2; ii++)
+        {
+            gauss->cval(cindex, cc, ii) = 1;
+            ball->cval(cindex, cc, ii) = 1;
+            smooth->cval(cindex, cc, ii) = 1;
+        }
+    });
+
+    const double wavenumber = 3.;
+    kk->filter<double, THREE>(gauss->get_cdata(), wavenumber, "Gauss");
+    kk->filter<double, THREE>(ball->get_cdata(), wavenumber, "ball");
+    kk->dealias<double, THREE>(smooth->get_cdata());
+    const double ell = M_PI / wavenumber;
+    kk->CLOOP_K2(
+            [&](ptrdiff_t cindex, ptrdiff_t, ptrdiff_t, ptrdiff_t, double k2){
+        const double gauss_value = std::exp(-ell*ell*k2/2);
+        const double argument = std::sqrt(k2)*ell/2;
+        const double ball_value = ((k2 > 0) ?
+                3*(std::sin(argument) - argument*std::cos(argument)) / std::pow(argument, 3) :
+                1.);
+        const double smooth_value = std::exp(-36*std::pow(k2/kk->kM2, 18));
+        for (int cc = 0; cc < 3; cc++)
+        for (int ii = 0; ii < 2; ii++)
+        {
+            error = std::max(error, std::fabs(gauss->cval(cindex, cc, ii) - gauss_value));
+            error = std::max(error, std::fabs(ball->cval(cindex, cc, ii) - ball_value));
+            error = std::max(error, std::fabs(smooth->cval(cindex, cc, ii) - smooth_value));
+        }
+    });
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    delete kk;
+    delete smooth;
+    delete ball;
+    delete gauss;
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    double worst = 0;
+    const int shapes[3][3] = {{16, 12, 12}, {20, 15, 15}, {12, 10, 10}};
+    for (auto shape : shapes)
+    {
+        const double error = table_error(shape[0], shape[1], shape[2]);
+        if (myrank == 0)
+            printf("%d x %d x %d, error %g\n",
+                   shape[0], shape[1], shape[2], error);
+        worst = std::max(worst, error);
+    }
+    fftw_plan_registry<double>::clear();
+    fftw_plan_registry<float>::clear();
+    fftw_mpi_cleanup();
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,262 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Sorting of the particles by cell in `particles_system::redistribute`:
+ * after the sort the particles of each z plane must be in Morton order of
+ * their x/y cells, and the positions, the indexes and every rhs buffer must
+ * have been permuted together.
+ * The z slabs are distributed by hand (no FFTW), as in test_ghost_planes.
+ * Prints the number of inconsistent values, see test_particle_sorting.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <array>
+#include <random>
+#include <algorithm>
+#include <hdf5.h>
+#include "particles/particles_system.hpp"
+#include "particles/particles_generic_interp.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+/* the parts of `field` used by the particle code */
+struct slab_layout
+{
+    hsize_t subsizes[3];
+};
+
+struct slab_field
+{
+    int nx, ny, z0;
+    std::vector<double> data;
+    slab_layout layout;
+    slab_layout *rmemlayout;
+
+    slab_field(const int NX, const int NY, const int Z0, const int Z1):
+        nx(NX), ny(NY), z0(Z0),
+        data(size_t(std::max(Z1-Z0, 1))*NY*(NX+2)*3, 0.0),
+        rmemlayout(&layout)
+    {
+        this->layout.subsizes[0] = hsize_t(Z1-Z0);
+        this->layout.subsizes[1] = hsize_t(NY);
+        this->layout.subsizes[2] = hsize_t(NX+2);
+    }
+
+    slab_field(const slab_field &src):
+        nx(src.nx), ny(src.ny), z0(src.z0),
+        data(src.data), layout(src.layout),
+        rmemlayout(&this->layout)
+    {}
+
+    const double &rval(const ptrdiff_t rindex, const unsigned int component = 0) const
+    {
+        return this->data[rindex*3 + component];
+    }
+
+    ptrdiff_t get_rindex_from_global(const ptrdiff_t xx, const ptrdiff_t yy, const ptrdiff_t zz) const
+    {
+        return ((zz - this->z0)*this->ny + yy)*(this->nx + 2) + xx;
+    }
+};
+
+/* particles given in random order, with rhs values that identify them */
+class shuffled_input: public abstract_particles_input<long long int, double>
+{
+public:
+    std::vector<double> positions;
+    std::vector<long long int> indexes;
+    long long int total_nb_particles;
+    int nb_rhs;
+
+    static double rhs_value(const long long int index, const int idx_rhs, const int component)
+    {
+        return double(index) + 0.25*idx_rhs + 0.0625*component;
+    }
+
+    long long int getTotalNbParticles() final
+    {
+        return this->total_nb_particles;
+    }
+    long long int getLocalNbParticles() final
+    {
+        return this->indexes.size();
+    }
+    int getNbRhs() final
+    {
+        return this->nb_rhs;
+    }
+    std::unique_ptr<double[]> getMyParticles() final
+    {
+        std::unique_ptr<double[]> result(new double[this->positions.size()]);
+        std::copy(this->positions.begin(), this->positions.end(), result.get());
+        return result;
+    }
+    std::unique_ptr<long long int[]> getMyParticlesIndexes() final
+    {
+        std::unique_ptr<long long int[]> result(new long long int[this->indexes.size()]);
+        std::copy(this->indexes.begin(), this->indexes.end(), result.get());
+        return result;
+    }
+    std::vector<std::unique_ptr<double[]>> getMyRhs() final
+    {
+        std::vector<std::unique_ptr<double[]>> result(this->nb_rhs);
+        for (int idx_rhs = 0; idx_rhs < this->nb_rhs; idx_rhs++)
+        {
+            result[idx_rhs].reset(new double[this->indexes.size()*3]);
+            for (size_t p = 0; p < this->indexes.size(); p++)
+                for (int cc = 0; cc < 3; cc++)
+                    result[idx_rhs][p*3 + cc] = rhs_value(this->indexes[p], idx_rhs, cc);
+        }
+        return result;
+    }
+};
+
+uint64_t morton_key(const uint32_t idx_x, const uint32_t idx_y)
+{
+    uint64_t key = 0;
+    for (int idx_bit = 0; idx_bit < 32; idx_bit++)
+        key |= ((uint64_t((idx_x >> idx_bit) & 1U) << (2*idx_bit)) |
+                (uint64_t((idx_y >> idx_bit) & 1U) << (2*idx_bit+1)));
+    return key;
+}
+
+long long int sorting_errors(const int nz, const int nb_rhs, const unsigned seed)
+{
+    const int nx = 12, ny = 10;
+    const long long int nb_per_plane = 40;
+    const int planes_per_proc = (nz + nprocs - 1) / nprocs;
+    const int first_z = std::min(nz, myrank*planes_per_proc);
+    const int last_z = std::min(nz, (myrank+1)*planes_per_proc);
+    slab_field local_field(nx, ny, first_z, last_z);
+
+    typedef particles_generic_interp<double, 1, 1> interpolator;
+    typedef particles_system<long long int, double, double, slab_field, interpolator, 1, 3> system;
+    const std::array<size_t, 3> field_grid_dim{{size_t(nx), size_t(ny), size_t(nz)}};
+    const std::array<double, 3> box_width{{1., 1., 1.}};
+    const std::array<double, 3> box_offset{{0., 0., 0.}};
+    const std::array<double, 3> spatial_step{{1./nx, 1./ny, 1./nz}};
+    const std::array<size_t, 3> local_field_dims{{size_t(nx), size_t(ny), size_t(last_z - first_z)}};
+    const std::array<size_t, 3> local_field_offset{{0, 0, size_t(first_z)}};
+    system particles(field_grid_dim, box_width, box_offset, spatial_step,
+                     first_z*spatial_step[2], last_z*spatial_step[2],
+                     local_field_dims, local_field_offset, local_field,
+                     MPI_COMM_WORLD, nb_per_plane*nz);
+
+    /* the particles of the local planes, in random order */
+    shuffled_input input;
+    input.total_nb_particles = nb_per_plane*nz;
+    input.nb_rhs = nb_rhs;
+    std::mt19937 gen(seed + myrank);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    for (long long int index = first_z*nb_per_plane; index < last_z*nb_per_plane; index++)
+    {
+        input.indexes.push_back(index);
+        input.positions.push_back(uniform(gen));
+        input.positions.push_back(uniform(gen));
+        input.positions.push_back((index / nb_per_plane + uniform(gen)) / nz);
+    }
+    const std::vector<double> original_positions(input.positions);
+    std::shuffle(input.indexes.begin(), input.indexes.end(), gen);
+    std::vector<double> shuffled_positions(input.positions.size());
+    for (size_t p = 0; p < input.indexes.size(); p++)
+        std::copy(&original_positions[(input.indexes[p] - first_z*nb_per_plane)*3],
+                  &original_positions[(input.indexes[p] - first_z*nb_per_plane)*3] + 3,
+                  &shuffled_positions[p*3]);
+    input.positions = shuffled_positions;
+
+    particles.init(input);
+    particles.enable_cell_sorting(1e-6);
+    particles.redistribute();
+
+    long long int nb_errors = 0;
+    const long long int nb_particles = particles.getLocalNbParticles();
+    if (nb_particles != (last_z - first_z)*nb_per_plane)
+        nb_errors += 1;
+    const double *positions = particles.getParticlesPositions();
+    const long long int *indexes = particles.getParticlesIndexes();
+    const std::unique_ptr<double[]> *rhs = particles.getParticlesRhs();
+    std::vector<int> seen((last_z - first_z)*nb_per_plane, 0);
+    for (long long int p = 0; p < std::min(nb_particles, (last_z - first_z)*nb_per_plane); p++)
+    {
+        const long long int local_index = indexes[p] - first_z*nb_per_plane;
+        if (local_index < 0 || local_index >= (last_z - first_z)*nb_per_plane)
+        {
+            nb_errors += 1;
+            continue;
+        }
+        seen[local_index] += 1;
+        for (int i = 0; i < 3; i++)
+            if (positions[p*3 + i] != original_positions[local_index*3 + i])
+                nb_errors += 1;
+        for (int idx_rhs = 0; idx_rhs < nb_rhs; idx_rhs++)
+            for (int cc = 0; cc < 3; cc++)
+                if (rhs[idx_rhs][p*3 + cc] != shuffled_input::rhs_value(indexes[p], idx_rhs, cc))
+                    nb_errors += 1;
+        /* sorted by z plane, then by cell */
+        if (p > 0)
+        {
+            const int plane = int(std::floor(positions[p*3 + 2]*nz));
+            const int previous_plane = int(std::floor(positions[(p-1)*3 + 2]*nz));
+            const uint64_t key = morton_key(
+                    uint32_t(positions[p*3]*nx), uint32_t(positions[p*3 + 1]*ny));
+            const uint64_t previous_key = morton_key(
+                    uint32_t(positions[(p-1)*3]*nx), uint32_t(positions[(p-1)*3 + 1]*ny));
+            if (plane < previous_plane || (plane == previous_plane && key < previous_key))
+                nb_errors += 1;
+        }
+    }
+    for (int count : seen)
+        if (count != 1)
+            nb_errors += 1;
+    MPI_Allreduce(MPI_IN_PLACE, &nb_errors, 1, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    return nb_errors;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    long long int worst = 0;
+    for (int nz : {8, 12})
+    for (int nb_rhs : {1, 2, 3})
+    {
+        const long long int nb_errors = sorting_errors(nz, nb_rhs, nz + nb_rhs);
+        if (myrank == 0)
+            printf("nz = %d, %d rhs, %lld inconsistent values\n",
+                   nz, nb_rhs, nb_errors);
+        worst = std::max(worst, nb_errors);
+    }
+    if (myrank == 0)
+        printf("worst error %lld\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Transforms of the `PENCIL` backend compared with the FFTW-MPI
+ * transforms of the `FFTW` backend, for the same global field.
+ * The process grid is chosen by `pencil_fft` from the number of processes
+ * (1 x 1, 2 x 1, 2 x 2, 3 x 2, 3 x 3 for 1, 2, 4, 6, 9 processes).
+ * Both representations are gathered into global arrays, and compared:
+ *  - r2c of the two backends;
+ *  - c2r of the two backends, and with the original field.
+ * Prints the largest difference relative to the largest value, in units of
+ * the machine epsilon of each precision, see test_pencil_fft.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "field.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+double field_value(const int xx, const int yy, const int zz, const int cc)
+{
+    return (std::sin(0.3*xx + 1.1*yy*yy + 0.7*zz + cc) +
+            0.01*xx*yy - 0.02*zz*cc);
+}
+
+/* global (z, y, x) array, or (ky, kz, kx) array of complex numbers */
+template <typename rnumber, field_backend be>
+std::vector<double> gather(field<rnumber, be, THREE> *f)
+{
+    const field_layout<THREE> *layout = (
+            f->real_space_representation ? f->rlayout : f->clayout);
+    const int nvalues = f->real_space_representation ? 1 : 2;
+    std::vector<double> values(
+            layout->sizes[0]*layout->sizes[1]*layout->sizes[2]*3*nvalues, 0.0);
+    const hsize_t local_nx = (f->real_space_representation ?
+                              f->rmemlayout->subsizes[2] : layout->subsizes[2]);
+    for (hsize_t i0 = 0; i0 < layout->subsizes[0]; i0++)
+    for (hsize_t i1 = 0; i1 < layout->subsizes[1]; i1++)
+    for (hsize_t i2 = 0; i2 < layout->subsizes[2]; i2++)
+    for (int cc = 0; cc < 3*nvalues; cc++)
+        values[(((i0 + layout->starts[0])*layout->sizes[1] +
+                  i1 + layout->starts[1])*layout->sizes[2] +
+                 i2 + layout->starts[2])*3*nvalues + cc] = f->get_rdata()[
+            ((i0*layout->subsizes[1] + i1)*local_nx + i2)*3*nvalues + cc];
+    MPI_Allreduce(MPI_IN_PLACE, &values.front(), int(values.size()),
+                  MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return values;
+}
+
+/* largest difference, relative to the largest value of `b` */
+double max_difference(const std::vector<double> &a, const std::vector<double> &b)
+{
+    assert(a.size() == b.size());
+    double difference = 0, bmax = 0;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        difference = std::max(difference, std::fabs(a[i] - b[i]));
+        bmax = std::max(bmax, std::fabs(b[i]));
+    }
+    return difference / bmax;
+}
+
+template <typename rnumber>
+double pencil_error(const int nx, const int ny, const int nz)
+{
+    field<rnumber, PENCIL, THREE> *pfield = new field<rnumber, PENCIL, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    field<rnumber, FFTW, THREE> *sfield = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    pfield->real_space_representation = true;
+    sfield->real_space_representation = true;
+    pfield->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t xindex, ptrdiff_t yindex, ptrdiff_t zindex){
+        for (int cc = 0; cc < 3; cc++)
+            pfield->rval(rindex, cc) = field_value(
+                    xindex + pfield->rlayout->starts[2],
+                    yindex + pfield->rlayout->starts[1],
+                    zindex + pfield->rlayout->starts[0], cc);
+    });
+    sfield->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t xindex, ptrdiff_t yindex, ptrdiff_t zindex){
+        for (int cc = 0; cc < 3; cc++)
+            sfield->rval(rindex, cc) = field_value(
+                    xindex + sfield->rlayout->starts[2],
+                    yindex + sfield->rlayout->starts[1],
+                    zindex + sfield->rlayout->starts[0], cc);
+    });
+    const std::vector<double> original = gather(sfield);
+    assert(max_difference(gather(pfield), original) == 0);
+
+    const double eps = std::numeric_limits<rnumber>::epsilon();
+    pfield->dft();
+    sfield->dft();
+    const double r2c_error = max_difference(gather(pfield), gather(sfield)) / eps;
+
+    pfield->ift();
+    sfield->ift();
+    pfield->normalize();
+    sfield->normalize();
+    const std::vector<double> pvalues = gather(pfield);
+    const double c2r_error = max_difference(pvalues, gather(sfield)) / eps;
+    const double round_trip_error = max_difference(pvalues, original) / eps;
+    if (myrank == 0)
+        printf("%d x %d x %d on %d x %d processes, r2c %g, c2r %g, round trip %g\n",
+               nx, ny, nz, pfield->pencil->pgrid[0], pfield->pencil->pgrid[1],
+               r2c_error, c2r_error, round_trip_error);
+    delete pfield;
+    delete sfield;
+    return std::max(r2c_error, std::max(c2r_error, round_trip_error));
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    fftwf_mpi_init();
+    double worst = 0;
+    /* the `FFTW` backend allocates the real space slab, which only holds
+     * the Fourier representation if ny == nz */
+    const int shapes[3][3] = {{16, 12, 12}, {20, 15, 15}, {10, 9, 9}};
+    for (auto shape : shapes)
+    {
+        worst = std::max(worst, pencil_error<double>(shape[0], shape[1], shape[2]));
+        worst = std::max(worst, pencil_error<float>(shape[0], shape[1], shape[2]));
+    }
+    pencil_fft<double>::clear();
+    pencil_fft<float>::clear();
+    fftw_plan_registry<double>::clear();
+    fftw_plan_registry<float>::clear();
+    fftw_mpi_cleanup();
+    fftwf_mpi_cleanup();
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
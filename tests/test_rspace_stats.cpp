@@ -0,0 +1,265 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Real space statistics of several fields computed together by one
+ * `rspace_stats` object, compared with:
+ *  - the single field `field::compute_rspace_stats` and `joint_rspace_PDF`,
+ *    which must write the same moments and histograms;
+ *  - extrema and averages of powers computed directly, for a vector and a
+ *    scalar field.
+ * The `rspace_stats` object is used for two time offsets, with different
+ * data. Prints the largest relative difference of the moments, plus the
+ * number of differing histogram counts, see test_rspace_stats.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include "field.hpp"
+#include "rspace_stats.hpp"
+#include "hdf5_tools.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+const int nbins = 16;
+const int ntimes = 2;
+
+void create_dataset(
+        const hid_t group,
+        const std::string dset_name,
+        std::vector<hsize_t> dims,
+        const hid_t dtype)
+{
+    hid_t space = H5Screate_simple(dims.size(), &dims.front(), NULL);
+    hid_t dset = H5Dcreate(group, dset_name.c_str(), dtype, space,
+                           H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dclose(dset);
+    H5Sclose(space);
+}
+
+/* the datasets that `compute_rspace_stats` and `joint_rspace_PDF` expect */
+hid_t create_stats_group(const hid_t file, const std::string group_name)
+{
+    hid_t group = H5Gcreate(file, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t moments = H5Gcreate(group, "moments", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    hid_t histograms = H5Gcreate(group, "histograms", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    for (std::string name : {"a", "b"})
+    {
+        create_dataset(moments, name, {ntimes, 10, 4}, H5T_NATIVE_DOUBLE);
+        create_dataset(histograms, name, {ntimes, nbins, 4}, H5T_NATIVE_INT64);
+    }
+    create_dataset(moments, "s", {ntimes, 10}, H5T_NATIVE_DOUBLE);
+    create_dataset(histograms, "s", {ntimes, nbins}, H5T_NATIVE_INT64);
+    create_dataset(moments, "t", {ntimes, 10, 3, 3}, H5T_NATIVE_DOUBLE);
+    create_dataset(histograms, "t", {ntimes, nbins, 3, 3}, H5T_NATIVE_INT64);
+    create_dataset(histograms, "ab_components", {ntimes, nbins, nbins, 3, 3}, H5T_NATIVE_INT64);
+    create_dataset(histograms, "ab_magnitudes", {ntimes, nbins, nbins}, H5T_NATIVE_INT64);
+    create_dataset(histograms, "ss", {ntimes, nbins, nbins}, H5T_NATIVE_INT64);
+    H5Gclose(histograms);
+    H5Gclose(moments);
+    return group;
+}
+
+template <typename number>
+std::vector<number> read_dataset(const hid_t group, const std::string dset_name, const hid_t dtype)
+{
+    hid_t dset = H5Dopen(group, dset_name.c_str(), H5P_DEFAULT);
+    hid_t space = H5Dget_space(dset);
+    std::vector<number> data(H5Sget_simple_extent_npoints(space));
+    H5Sclose(space);
+    H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data.front());
+    H5Dclose(dset);
+    return data;
+}
+
+template <field_components fc>
+void fill_field(field<double, FFTW, fc> *f, const double scale, const double shift)
+{
+    f->real_space_representation = true;
+    f->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t, ptrdiff_t, ptrdiff_t){
+        for (int cc = 0; cc < int(ncomp(fc)); cc++)
+            f->get_rdata()[rindex*ncomp(fc) + cc] = scale*(
+                    std::sin(0.37*rindex + 1.1*myrank + 0.7*cc) + shift);
+    });
+}
+
+/* minimum, averages of the first 8 powers and maximum of the components
+ * and, for vectors, of the magnitude; computed without threads.
+ * as in `compute_rspace_stats`, the extrema start from 0, except for the
+ * minimum of the magnitude, which starts from its estimate */
+template <field_components fc>
+std::vector<double> direct_moments(
+        field<double, FFTW, fc> *f,
+        const std::vector<double> max_estimate)
+{
+    const int nc = ncomp(fc);
+    const int nvals = (nc == 3) ? 4 : 1;
+    std::vector<double> moments(10*nvals, 0);
+    if (nvals == 4)
+        moments[3] = max_estimate[3];
+    for (hsize_t zz = 0; zz < f->rlayout->subsizes[0]; zz++)
+    for (hsize_t yy = 0; yy < f->rlayout->subsizes[1]; yy++)
+    for (hsize_t xx = 0; xx < f->rlayout->subsizes[2]; xx++)
+    {
+        const ptrdiff_t rindex = (zz*f->rlayout->subsizes[1] + yy)*f->rmemlayout->subsizes[2] + xx;
+        double values[4] = {0, 0, 0, 0};
+        for (int cc = 0; cc < nc; cc++)
+        {
+            values[cc] = f->get_rdata()[rindex*nc + cc];
+            if (nvals == 4)
+                values[3] += values[cc]*values[cc];
+        }
+        if (nvals == 4)
+            values[3] = std::sqrt(values[3]);
+        for (int i = 0; i < nvals; i++)
+        {
+            moments[i] = std::min(moments[i], values[i]);
+            moments[9*nvals + i] = std::max(moments[9*nvals + i], values[i]);
+            for (int n = 1; n < 9; n++)
+                moments[n*nvals + i] += std::pow(values[i], n) / f->npoints;
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &moments[0], nvals, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &moments[nvals], 8*nvals, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &moments[9*nvals], nvals, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return moments;
+}
+
+double relative_difference(const std::vector<double> &a, const double *b)
+{
+    double error = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        error = std::max(error, std::fabs(a[i] - b[i]) / std::max(std::fabs(a[i]), 1e-300));
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    hid_t stat_file = -1, fused_group = -1, single_group = -1;
+    if (myrank == 0)
+    {
+        stat_file = H5Fcreate("test_rspace_stats.h5", H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        fused_group = create_stats_group(stat_file, "fused");
+        single_group = create_stats_group(stat_file, "single");
+    }
+    {
+        field<double, FFTW, THREE> *a = new field<double, FFTW, THREE>(8, 12, 12, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        field<double, FFTW, THREE> *b = new field<double, FFTW, THREE>(8, 12, 12, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        field<double, FFTW, ONE> *s = new field<double, FFTW, ONE>(8, 12, 12, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        field<double, FFTW, THREExTHREE> *t = new field<double, FFTW, THREExTHREE>(8, 12, 12, MPI_COMM_WORLD, FFTW_ESTIMATE);
+        /* the magnitude estimates are too small for some values, so that
+         * the last bins overflow */
+        const std::vector<double> a_estimate = {1.0, 1.0, 1.0, 1.5};
+        const std::vector<double> b_estimate = {2.0, 2.0, 2.0, 4.0};
+        const std::vector<double> s_estimate = {1.0};
+        const std::vector<double> t_estimate(9, 0.7);
+
+        std::vector<std::vector<double>> a_moments, s_moments;
+        rspace_stats<double, FFTW> stats;
+        stats.add_field(a, "a", a_estimate);
+        stats.add_field(b, "b", b_estimate);
+        stats.add_field(s, "s", s_estimate);
+        stats.add_field(t, "t", t_estimate);
+        stats.add_joint_PDF(a, b, "ab", a_estimate, b_estimate);
+        stats.add_joint_PDF(s, s, "ss", s_estimate, s_estimate);
+        for (int toffset = 0; toffset < ntimes; toffset++)
+        {
+            fill_field(a, 1.0 + toffset, 0.1);
+            fill_field(b, 3.0, -0.2*toffset);
+            fill_field(s, 0.8, 0.3);
+            fill_field(t, 0.5, -0.4);
+            stats.compute(fused_group, toffset);
+            a->compute_rspace_stats(single_group, "a", toffset, a_estimate);
+            b->compute_rspace_stats(single_group, "b", toffset, b_estimate);
+            s->compute_rspace_stats(single_group, "s", toffset, s_estimate);
+            t->compute_rspace_stats(single_group, "t", toffset, t_estimate);
+            joint_rspace_PDF(a, b, single_group, "ab", toffset, a_estimate, b_estimate);
+            joint_rspace_PDF(s, s, single_group, "ss", toffset, s_estimate, s_estimate);
+            a_moments.push_back(direct_moments(a, a_estimate));
+            s_moments.push_back(direct_moments(s, s_estimate));
+        }
+        delete t;
+        delete s;
+        delete b;
+        delete a;
+
+        double worst = 0;
+        if (myrank == 0)
+        {
+            hdf5_tools::close_cached_datasets(stat_file);
+            for (std::string name : {"moments/a", "moments/b", "moments/s", "moments/t"})
+            {
+                const std::vector<double> fused = read_dataset<double>(fused_group, name, H5T_NATIVE_DOUBLE);
+                const std::vector<double> single = read_dataset<double>(single_group, name, H5T_NATIVE_DOUBLE);
+                worst = std::max(worst, relative_difference(fused, &single.front()));
+            }
+            for (std::string name : {"histograms/a", "histograms/b", "histograms/s", "histograms/t",
+                                     "histograms/ab_components", "histograms/ab_magnitudes",
+                                     "histograms/ss"})
+            {
+                const std::vector<int64_t> fused = read_dataset<int64_t>(fused_group, name, H5T_NATIVE_INT64);
+                const std::vector<int64_t> single = read_dataset<int64_t>(single_group, name, H5T_NATIVE_INT64);
+                int64_t total = 0;
+                for (size_t i = 0; i < fused.size(); i++)
+                {
+                    worst += (fused[i] != single[i]);
+                    total += fused[i];
+                }
+                if (total == 0)
+                {
+                    printf("%s is empty\n", name.c_str());
+                    worst += 1;
+                }
+            }
+            const std::vector<double> fused_a = read_dataset<double>(fused_group, "moments/a", H5T_NATIVE_DOUBLE);
+            const std::vector<double> fused_s = read_dataset<double>(fused_group, "moments/s", H5T_NATIVE_DOUBLE);
+            for (int toffset = 0; toffset < ntimes; toffset++)
+            {
+                const double error_a = relative_difference(a_moments[toffset], &fused_a[toffset*a_moments[toffset].size()]);
+                const double error_s = relative_difference(s_moments[toffset], &fused_s[toffset*s_moments[toffset].size()]);
+                printf("time offset %d, moment errors %g %g\n", toffset, error_a, error_s);
+                worst = std::max(worst, std::max(error_a, error_s));
+            }
+            H5Gclose(single_group);
+            H5Gclose(fused_group);
+            H5Fclose(stat_file);
+            printf("worst error %g\n", worst);
+        }
+    }
+    fftw_plan_registry<double>::clear();
+    fftw_mpi_cleanup();
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,200 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Statistics rows written through `hdf5_tools::write_stats_row`, in
+ * blocks of a few rows, into datasets that are preallocated with fewer rows
+ * than written:
+ *  - complete blocks are written as soon as they are full, the dataset
+ *    growing with them;
+ *  - the remaining rows, one of them overwritten while buffered, are
+ *    written by `flush_stats`;
+ *  - rows written afterwards are written when the cached datasets are
+ *    closed, and datasets can be written again after that.
+ * Prints the number of wrong rows and sizes, see test_stats_buffer.py. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "hdf5_tools.hpp"
+
+int myrank, nprocs;
+
+const int nbins = 5;
+const int ncomponents = 3;
+const hsize_t flush_interval = 4;
+
+/* the moments are double and the histograms int64, one row each per
+ * time offset */
+std::vector<double> moments_row(const hsize_t toffset, const double shift = 0)
+{
+    std::vector<double> row(ncomponents);
+    for (int cc = 0; cc < ncomponents; cc++)
+        row[cc] = toffset*100 + cc + shift;
+    return row;
+}
+
+std::vector<int64_t> histogram_row(const hsize_t toffset)
+{
+    std::vector<int64_t> row(nbins);
+    for (int bb = 0; bb < nbins; bb++)
+        row[bb] = toffset*1000 + bb;
+    return row;
+}
+
+hid_t create_stats_dataset(
+        const hid_t group,
+        const std::string dset_name,
+        const hid_t dtype,
+        const hsize_t row_size,
+        const hsize_t nrows)
+{
+    hsize_t dims[2] = {nrows, row_size};
+    hsize_t maxdims[2] = {H5S_UNLIMITED, row_size};
+    hsize_t chunks[2] = {1, row_size};
+    hid_t space = H5Screate_simple(2, dims, maxdims);
+    hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(plist, 2, chunks);
+    hid_t dset = H5Dcreate(group, dset_name.c_str(), dtype, space,
+                           H5P_DEFAULT, plist, H5P_DEFAULT);
+    H5Pclose(plist);
+    H5Sclose(space);
+    return dset;
+}
+
+/* compares the rows that are in the file with the expected ones,
+ * `overwritten` being the row that was written twice */
+int check_file(
+        const hid_t group,
+        const hsize_t nrows,
+        const hsize_t overwritten)
+{
+    int errors = 0;
+    hid_t dset = H5Dopen(group, "moments", H5P_DEFAULT);
+    hid_t space = H5Dget_space(dset);
+    hsize_t dims[2];
+    H5Sget_simple_extent_dims(space, dims, NULL);
+    H5Sclose(space);
+    if (dims[0] != nrows)
+    {
+        printf("moments have %d rows instead of %d\n", int(dims[0]), int(nrows));
+        errors++;
+    }
+    std::vector<double> moments(dims[0]*dims[1]);
+    H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &moments.front());
+    H5Dclose(dset);
+    for (hsize_t toffset = 0; toffset < std::min(dims[0], nrows); toffset++)
+    {
+        const std::vector<double> row = moments_row(toffset, (toffset == overwritten) ? 0.5 : 0);
+        for (int cc = 0; cc < ncomponents; cc++)
+            if (moments[toffset*ncomponents + cc] != row[cc])
+            {
+                printf("wrong moments in row %d\n", int(toffset));
+                errors++;
+                break;
+            }
+    }
+
+    dset = H5Dopen(group, "histograms", H5P_DEFAULT);
+    space = H5Dget_space(dset);
+    H5Sget_simple_extent_dims(space, dims, NULL);
+    H5Sclose(space);
+    if (dims[0] != nrows)
+    {
+        printf("histograms have %d rows instead of %d\n", int(dims[0]), int(nrows));
+        errors++;
+    }
+    std::vector<int64_t> histograms(dims[0]*dims[1]);
+    H5Dread(dset, H5T_NATIVE_INT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, &histograms.front());
+    H5Dclose(dset);
+    for (hsize_t toffset = 0; toffset < std::min(dims[0], nrows); toffset++)
+    {
+        const std::vector<int64_t> row = histogram_row(toffset);
+        for (int bb = 0; bb < nbins; bb++)
+            if (histograms[toffset*nbins + bb] != row[bb])
+            {
+                printf("wrong histogram in row %d\n", int(toffset));
+                errors++;
+                break;
+            }
+    }
+    return errors;
+}
+
+int write_rows(
+        const hid_t group,
+        const hsize_t first_toffset,
+        const hsize_t last_toffset)
+{
+    for (hsize_t toffset = first_toffset; toffset < last_toffset; toffset++)
+    {
+        hdf5_tools::write_stats_row(group, "moments", toffset, &moments_row(toffset).front());
+        hdf5_tools::write_stats_row(group, "histograms", toffset, &histogram_row(toffset).front());
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    int errors = 0;
+    if (myrank == 0)
+    {
+        hid_t stat_file = H5Fcreate("test_stats_buffer.h5", H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        hid_t group = H5Gcreate(stat_file, "statistics", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Dclose(create_stats_dataset(group, "moments", H5T_NATIVE_DOUBLE, ncomponents, 2));
+        H5Dclose(create_stats_dataset(group, "histograms", H5T_NATIVE_INT64, nbins, 2));
+        hdf5_tools::set_stats_flush_interval(flush_interval);
+
+        /* 11 rows: two complete blocks in the file, 3 rows in memory */
+        const hsize_t overwritten = 9;
+        write_rows(group, 0, 11);
+        hdf5_tools::write_stats_row(group, "moments", overwritten,
+                                    &moments_row(overwritten, 0.5).front());
+        errors += check_file(group, 2*flush_interval, overwritten);
+        hdf5_tools::flush_stats(stat_file);
+        errors += check_file(group, 11, overwritten);
+
+        /* rows written after the flush go out with the cached datasets,
+         * and the datasets are opened again for the last row */
+        write_rows(group, 11, 13);
+        hdf5_tools::close_cached_datasets(stat_file);
+        errors += check_file(group, 13, overwritten);
+        write_rows(group, 13, 14);
+        hdf5_tools::flush_stats(stat_file);
+        errors += check_file(group, 14, overwritten);
+        hdf5_tools::close_cached_datasets(stat_file);
+        H5Gclose(group);
+        H5Fclose(stat_file);
+        printf("worst error %d\n", errors);
+    }
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* `field::symmetrize`, with the kx = 0 plane distributed over several
+ * processes, compared with the Hermitian symmetry imposed directly on
+ * values that every process can compute for any mode:
+ *  - the ky = 0 line gets the conjugates of its kz > 0 half, and a real
+ *    kz = 0 element;
+ *  - the planes ny - ky get the conjugates of the planes ky, for
+ *    0 < ky < ny/2, wherever these live;
+ *  - everything else is left as it is.
+ * Prints the largest difference, see test_symmetrize.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "field.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+double initial_value(
+        const ptrdiff_t yy, const ptrdiff_t zz, const ptrdiff_t xx,
+        const int cc, const int ii)
+{
+    return std::sin(1.3*yy + 0.7*zz + 0.11*xx + 0.5*cc + 2.1*ii);
+}
+
+double symmetric_value(
+        const ptrdiff_t ny, const ptrdiff_t nz,
+        const ptrdiff_t yy, const ptrdiff_t zz, const ptrdiff_t xx,
+        const int cc, const int ii)
+{
+    const double sign = (ii == 0) ? 1 : -1;
+    if (xx != 0)
+        return initial_value(yy, zz, xx, cc, ii);
+    if (yy == 0)
+    {
+        if (zz == 0 && ii == 1)
+            return 0;
+        if (zz > nz/2 && nz - zz < nz/2)
+            return sign*initial_value(0, nz - zz, 0, cc, ii);
+        return initial_value(yy, zz, xx, cc, ii);
+    }
+    if (yy > ny/2 && ny - yy < ny/2)
+        return sign*initial_value(ny - yy, (nz - zz) % nz, 0, cc, ii);
+    return initial_value(yy, zz, xx, cc, ii);
+}
+
+template <typename rnumber, field_components fc>
+double symmetrize_error(const int nx, const int ny, const int nz)
+{
+    field<rnumber, FFTW, fc> *f = new field<rnumber, FFTW, fc>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    const field_layout<fc> *cl = f->clayout;
+    f->real_space_representation = false;
+    rnumber *data = (rnumber*)f->get_cdata();
+    for (ptrdiff_t yy = 0; yy < ptrdiff_t(cl->subsizes[0]); yy++)
+    for (ptrdiff_t zz = 0; zz < ptrdiff_t(cl->subsizes[1]); zz++)
+    for (ptrdiff_t xx = 0; xx < ptrdiff_t(cl->subsizes[2]); xx++)
+    {
+        const ptrdiff_t cindex = (yy*cl->subsizes[1] + zz)*cl->subsizes[2] + xx;
+        for (int cc = 0; cc < int(ncomp(fc)); cc++)
+        for (int ii = 0; ii < 2; ii++)
+            data[2*(ncomp(fc)*cindex + cc) + ii] = initial_value(
+                    yy + cl->starts[0], zz + cl->starts[1], xx + cl->starts[2], cc, ii);
+    }
+    f->symmetrize();
+    double error = 0;
+    for (ptrdiff_t yy = 0; yy < ptrdiff_t(cl->subsizes[0]); yy++)
+    for (ptrdiff_t zz = 0; zz < ptrdiff_t(cl->subsizes[1]); zz++)
+    for (ptrdiff_t xx = 0; xx < ptrdiff_t(cl->subsizes[2]); xx++)
+    {
+        const ptrdiff_t cindex = (yy*cl->subsizes[1] + zz)*cl->subsizes[2] + xx;
+        for (int cc = 0; cc < int(ncomp(fc)); cc++)
+        for (int ii = 0; ii < 2; ii++)
+            error = std::max(error, std::fabs(
+                    double(data[2*(ncomp(fc)*cindex + cc) + ii]) -
+                    double(rnumber(symmetric_value(
+                            ny, nz,
+                            yy + cl->starts[0], zz + cl->starts[1], xx + cl->starts[2],
+                            cc, ii)))));
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    delete f;
+    return error;
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    fftwf_mpi_init();
+    double worst = 0;
+    /* even and odd numbers of planes */
+    const int shapes[3][3] = {{8, 12, 12}, {8, 10, 10}, {6, 9, 9}};
+    for (auto shape : shapes)
+    {
+        const double error_one = symmetrize_error<double, ONE>(shape[0], shape[1], shape[2]);
+        const double error_three = symmetrize_error<double, THREE>(shape[0], shape[1], shape[2]);
+        const double error_float = symmetrize_error<float, THREE>(shape[0], shape[1], shape[2]);
+        if (myrank == 0)
+            printf("%d x %d x %d, errors %g %g %g\n",
+                   shape[0], shape[1], shape[2],
+                   error_one, error_three, error_float);
+        worst = std::max(worst, std::max(error_one, std::max(error_three, error_float)));
+    }
+    fftw_plan_registry<double>::clear();
+    fftw_plan_registry<float>::clear();
+    fftw_mpi_cleanup();
+    fftwf_mpi_cleanup();
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
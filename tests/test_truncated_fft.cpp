@@ -0,0 +1,149 @@
+/**********************************************************************
+*                                                                     *
+*  Copyright 2015 Max Planck Institute                                *
+*                 for Dynamics and Self-Organization                  *
+*                                                                     *
+*  This file is part of bfps.                                         *
+*                                                                     *
+*  bfps is free software: you can redistribute it and/or modify       *
+*  it under the terms of the GNU General Public License as published  *
+*  by the Free Software Foundation, either version 3 of the License,  *
+*  or (at your option) any later version.                             *
+*                                                                     *
+*  bfps is distributed in the hope that it will be useful,            *
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of     *
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the      *
+*  GNU General Public License for more details.                       *
+*                                                                     *
+*  You should have received a copy of the GNU General Public License  *
+*  along with bfps.  If not, see <http://www.gnu.org/licenses/>       *
+*                                                                     *
+* Contact: Cristian.Lalescu@ds.mpg.de                                 *
+*                                                                     *
+**********************************************************************/
+
+
+
+
+/* Transforms of `truncated_fft` compared with the complete FFTW-MPI
+ * transforms of `field`:
+ *  - r2c of an arbitrary field must give the same modes inside the band,
+ *    and zeros outside;
+ *  - c2r of a dealiased field must give the same real space field.
+ * Prints the largest difference, in units of the machine epsilon of each
+ * precision, see test_truncated_fft.py. */
+
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <algorithm>
+#include "field.hpp"
+#include "scope_timer.hpp"
+
+int myrank, nprocs;
+
+template <typename rnumber, kspace_dealias_type dt>
+double truncation_error(const int nx, const int ny, const int nz)
+{
+    field<rnumber, FFTW, THREE> *full = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    field<rnumber, FFTW, THREE> *band = new field<rnumber, FFTW, THREE>(
+            nx, ny, nz, MPI_COMM_WORLD, FFTW_ESTIMATE);
+    kspace<FFTW, dt> *kk = new kspace<FFTW, dt>(full->clayout, 1., 1., 1.);
+    band->use_truncated_transforms(kk);
+
+    std::mt19937 gen(nx + myrank);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    full->real_space_representation = true;
+    band->real_space_representation = true;
+    full->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t, ptrdiff_t, ptrdiff_t){
+        for (int cc = 0; cc < 3; cc++)
+        {
+            full->rval(rindex, cc) = uniform(gen);
+            band->rval(rindex, cc) = full->rval(rindex, cc);
+        }
+    });
+    full->dft();
+    band->dft();
+
+    /* r2c: complete modes inside the band, zeros outside */
+    double error = 0;
+    kk->CLOOP_K2(
+            [&](ptrdiff_t cindex, ptrdiff_t xindex, ptrdiff_t yindex, ptrdiff_t, double){
+        const bool inside = (kk->kx[xindex]*kk->kx[xindex] +
+                             kk->ky[yindex]*kk->ky[yindex] <= kk->kM2);
+        for (int cc = 0; cc < 3; cc++)
+        for (int ii = 0; ii < 2; ii++)
+            error = std::max(error, double(std::fabs(
+                    band->cval(cindex, cc, ii) -
+                    (inside ? full->cval(cindex, cc, ii) : rnumber(0)))));
+    });
+
+    /* c2r of the dealiased field, with garbage outside the band of the
+     * truncated transform */
+    kk->CLOOP_K2(
+            [&](ptrdiff_t cindex, ptrdiff_t xindex, ptrdiff_t yindex, ptrdiff_t, double k2){
+        const bool inside = (kk->kx[xindex]*kk->kx[xindex] +
+                             kk->ky[yindex]*kk->ky[yindex] <= kk->kM2);
+        for (int cc = 0; cc < 3; cc++)
+        for (int ii = 0; ii < 2; ii++)
+        {
+            if (k2 >= kk->kM2)
+                full->cval(cindex, cc, ii) = 0;
+            band->cval(cindex, cc, ii) = (inside ? full->cval(cindex, cc, ii) : rnumber(123));
+        }
+    });
+    full->ift();
+    band->ift();
+    full->RLOOP(
+            [&](ptrdiff_t rindex, ptrdiff_t, ptrdiff_t, ptrdiff_t){
+        for (int cc = 0; cc < 3; cc++)
+            error = std::max(error, double(std::fabs(
+                    band->rval(rindex, cc) - full->rval(rindex, cc))) / std::sqrt(double(full->npoints)));
+    });
+    MPI_Allreduce(MPI_IN_PLACE, &error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    delete kk;
+    delete band;
+    delete full;
+    /* the modes are sums of npoints values of order 1, and the real space
+     * values sums of npoints modes of order sqrt(npoints) */
+    return error / (std::sqrt(double(nx)*ny*nz)*std::numeric_limits<rnumber>::epsilon());
+}
+
+int main(int argc, char *argv[])
+{
+    int mpiprovided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &mpiprovided);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+    fftw_mpi_init();
+    fftwf_mpi_init();
+    double worst = 0;
+    /* `kspace` numbers the ky values as if there were nz of them, so the
+     * band only matches the dealiasing sphere for ny == nz */
+    const int shapes[3][3] = {{16, 12, 12}, {20, 15, 15}, {12, 10, 10}};
+    for (auto shape : shapes)
+    {
+        const double error_smooth = truncation_error<double, SMOOTH>(shape[0], shape[1], shape[2]);
+        const double error_two_thirds = truncation_error<double, TWO_THIRDS>(shape[0], shape[1], shape[2]);
+        const double error_float = truncation_error<float, SMOOTH>(shape[0], shape[1], shape[2]);
+        if (myrank == 0)
+            printf("%d x %d x %d, errors %g %g %g\n",
+                   shape[0], shape[1], shape[2],
+                   error_smooth, error_two_thirds, error_float);
+        worst = std::max(worst, std::max(error_smooth, std::max(error_two_thirds, error_float)));
+    }
+    truncated_fft<double>::clear();
+    truncated_fft<float>::clear();
+    fftw_plan_registry<double>::clear();
+    fftw_plan_registry<float>::clear();
+    fftw_mpi_cleanup();
+    fftwf_mpi_cleanup();
+    if (myrank == 0)
+        printf("worst error %g\n", worst);
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}